@@ -0,0 +1,529 @@
+//
+//  LinearAlgebra.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+//  Standard header files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+//  Custom header files
+#include "LinearAlgebra.h"
+
+/// MARK: DENSE MATRICES
+int LUDecompose(int n, double *A, int *pivot)
+{
+    for(int k = 0; k < n; ++k)
+    {
+        int p = k;
+        double big = fabs(A[k*n + k]);
+        
+        //  Selecting the pivot row
+        for(int i = k + 1; i < n; ++i)
+        {
+            if(fabs(A[i*n + k]) > big)
+            {
+                big = fabs(A[i*n + k]);
+                p = i;
+            }
+        }
+        pivot[k] = p;
+        if(big == 0.0)
+        {
+            return 1;
+        }
+        if(p != k)
+        {
+            for(int j = 0; j < n; ++j)
+            {
+                double sto = A[k*n + j];
+                A[k*n + j] = A[p*n + j];
+                A[p*n + j] = sto;
+            }
+        }
+        
+        //  Eliminating below the pivot. The inner loop runs along contiguous rows.
+        for(int i = k + 1; i < n; ++i)
+        {
+            double factor = A[i*n + k]/A[k*n + k];
+            
+            A[i*n + k] = factor;
+            if(factor != 0.0)
+            {
+                for(int j = k + 1; j < n; ++j)
+                {
+                    A[i*n + j] -= factor*A[k*n + j];
+                }
+            }
+        }
+    }
+    
+    return 0;
+}
+
+void LUSolve(int n, const double *LU, const int *pivot, double *b)
+{
+    //  Applying the row permutation and forward substitution (L has a unit diagonal)
+    for(int k = 0; k < n; ++k)
+    {
+        if(pivot[k] != k)
+        {
+            double sto = b[k];
+            b[k] = b[pivot[k]];
+            b[pivot[k]] = sto;
+        }
+    }
+    for(int i = 1; i < n; ++i)
+    {
+        double sum = b[i];
+        for(int j = 0; j < i; ++j)
+        {
+            sum -= LU[i*n + j]*b[j];
+        }
+        b[i] = sum;
+    }
+    
+    //  Back substitution
+    for(int i = n - 1; i >= 0; --i)
+    {
+        double sum = b[i];
+        for(int j = i + 1; j < n; ++j)
+        {
+            sum -= LU[i*n + j]*b[j];
+        }
+        b[i] = sum/LU[i*n + i];
+    }
+}
+
+int SORSolve(int n, const double *A, const double *b, double *x, double omega, double tol, int maxiter)
+{
+    for(int iter = 1; iter <= maxiter; ++iter)
+    {
+        double change = 0.0;
+        
+        for(int i = 0; i < n; ++i)
+        {
+            double sum = b[i];
+            double xnew = 0.0;
+            double rel = 0.0;
+            
+            for(int j = 0; j < n; ++j)
+            {
+                if(j != i)
+                {
+                    sum -= A[i*n + j]*x[j];
+                }
+            }
+            xnew = sum/A[i*n + i];
+            xnew = x[i] + omega*(xnew - x[i]);
+            
+            rel = fabs(xnew - x[i])/(fabs(xnew) + 1e-300);
+            if(rel > change)
+            {
+                change = rel;
+            }
+            x[i] = xnew;
+        }
+        if(change < tol)
+        {
+            return iter;
+        }
+    }
+    
+    return -1;
+}
+
+/// MARK: SPARSE MATRICES
+void SparseMultiply(const SparseMatrix *A, const double *x, double *y)
+{
+    for(int i = 0; i < A->n; ++i)
+    {
+        double sum = 0.0;
+        
+        for(int p = A->rowptr[i]; p < A->rowptr[i + 1]; ++p)
+        {
+            sum += A->val[p]*x[A->col[p]];
+        }
+        y[i] = sum;
+    }
+}
+
+int SparseCGSolve(const SparseMatrix *A, const double *b, double *x, double tol, int maxiter)
+{
+    int n = A->n;
+    int iter = -1;
+    double *r = calloc(5*(size_t)n + 1, sizeof(double));
+    double *z = r + n;          // Preconditioned residual.
+    double *p = r + 2*n;        // Search direction.
+    double *q = r + 3*n;        // Product of the matrix and search direction.
+    double *dinv = r + 4*n;     // Reciprocal of the matrix diagonal (Jacobi preconditioner).
+    double bnorm = 0.0;
+    double rz = 0.0;
+    
+    SparseMultiply(A, x, q);
+    for(int i = 0; i < n; ++i)
+    {
+        r[i] = b[i] - q[i];
+        bnorm += b[i]*b[i];
+    }
+    bnorm = sqrt(bnorm);
+    if(bnorm == 0.0)
+    {
+        bnorm = 1.0;
+    }
+    
+    for(int i = 0; i < n; ++i)
+    {
+        dinv[i] = 1.0;
+        for(int c = A->rowptr[i]; c < A->rowptr[i + 1]; ++c)
+        {
+            if(A->col[c] == i && A->val[c] != 0.0)
+            {
+                dinv[i] = 1/A->val[c];
+                break;
+            }
+        }
+    }
+    
+    for(int k = 0; k < maxiter; ++k)
+    {
+        double rnorm = 0.0;
+        double rznew = 0.0;
+        double pq = 0.0;
+        double alpha = 0.0;
+        
+        for(int i = 0; i < n; ++i)
+        {
+            rnorm += r[i]*r[i];
+        }
+        if(sqrt(rnorm) <= tol*bnorm)
+        {
+            iter = k;
+            break;
+        }
+        
+        for(int i = 0; i < n; ++i)
+        {
+            z[i] = r[i]*dinv[i];
+            rznew += r[i]*z[i];
+        }
+        
+        if(k == 0)
+        {
+            for(int i = 0; i < n; ++i)
+            {
+                p[i] = z[i];
+            }
+        }else{
+            double beta = rznew/rz;
+            
+            for(int i = 0; i < n; ++i)
+            {
+                p[i] = z[i] + beta*p[i];
+            }
+        }
+        rz = rznew;
+        
+        SparseMultiply(A, p, q);
+        for(int i = 0; i < n; ++i)
+        {
+            pq += p[i]*q[i];
+        }
+        alpha = rz/pq;
+        for(int i = 0; i < n; ++i)
+        {
+            x[i] += alpha*p[i];
+            r[i] -= alpha*q[i];
+        }
+    }
+    
+    free(r);
+    return iter;
+}
+
+/// MARK: BAND MATRICES
+void BandMatrixAlloc(BandMatrix *A, int n, int kl, int ku)
+{
+    A->n = n;
+    A->kl = kl;
+    A->ku = ku;
+    A->ld = 2*kl + ku + 1;
+    A->ab = calloc((size_t)A->ld*n, sizeof(double));
+    A->pivot = calloc(n, sizeof(int));
+}
+
+void BandMatrixFree(BandMatrix *A)
+{
+    free(A->ab);
+    free(A->pivot);
+    A->ab = NULL;
+    A->pivot = NULL;
+}
+
+void BandAdd(BandMatrix *A, int i, int j, double value)
+{
+    A->ab[j*A->ld + A->kl + A->ku + i - j] += value;
+}
+
+int BandLUDecompose(BandMatrix *A)
+{
+    int kv = A->kl + A->ku;     // Bandwidth of the upper factor after interchanges.
+    int ju = 0;                 // Last column touched by the elimination so far.
+    double *ab = A->ab;
+    int ld = A->ld;
+    
+    for(int j = 0; j < A->n; ++j)
+    {
+        int km = (A->kl < A->n - 1 - j) ? A->kl : A->n - 1 - j;
+        int jp = 0;
+        double big = fabs(ab[j*ld + kv]);
+        
+        //  Selecting the pivot row
+        for(int r = 1; r <= km; ++r)
+        {
+            if(fabs(ab[j*ld + kv + r]) > big)
+            {
+                big = fabs(ab[j*ld + kv + r]);
+                jp = r;
+            }
+        }
+        A->pivot[j] = j + jp;
+        if(big == 0.0)
+        {
+            return 1;
+        }
+        
+        if(j + A->ku + jp > ju)
+        {
+            ju = (j + A->ku + jp < A->n - 1) ? j + A->ku + jp : A->n - 1;
+        }
+        
+        //  Swapping rows j and j + jp over the active columns
+        if(jp != 0)
+        {
+            for(int c = j; c <= ju; ++c)
+            {
+                double *a = &ab[c*ld + kv + j - c];
+                double *b = &ab[c*ld + kv + j + jp - c];
+                double sto = *a;
+                
+                *a = *b;
+                *b = sto;
+            }
+        }
+        
+        //  Multipliers and elimination of the trailing block
+        if(km > 0)
+        {
+            double *lcol = &ab[j*ld + kv];
+            
+            for(int r = 1; r <= km; ++r)
+            {
+                lcol[r] /= lcol[0];
+            }
+            for(int c = j + 1; c <= ju; ++c)
+            {
+                double *ucol = &ab[c*ld + kv + j - c];
+                double t = ucol[0];
+                
+                if(t != 0.0)
+                {
+                    for(int r = 1; r <= km; ++r)
+                    {
+                        ucol[r] -= lcol[r]*t;
+                    }
+                }
+            }
+        }
+    }
+    
+    return 0;
+}
+
+void BandLUSolve(const BandMatrix *A, double *b)
+{
+    int kv = A->kl + A->ku;
+    const double *ab = A->ab;
+    int ld = A->ld;
+    
+    //  Forward substitution, applying the row interchanges as they occur
+    for(int j = 0; j < A->n - 1; ++j)
+    {
+        int km = (A->kl < A->n - 1 - j) ? A->kl : A->n - 1 - j;
+        int p = A->pivot[j];
+        
+        if(p != j)
+        {
+            double sto = b[p];
+            
+            b[p] = b[j];
+            b[j] = sto;
+        }
+        for(int r = 1; r <= km; ++r)
+        {
+            b[j + r] -= ab[j*ld + kv + r]*b[j];
+        }
+    }
+    
+    //  Back substitution
+    for(int j = A->n - 1; j >= 0; --j)
+    {
+        int top = (j - kv > 0) ? j - kv : 0;
+        
+        b[j] /= ab[j*ld + kv];
+        for(int i = top; i < j; ++i)
+        {
+            b[i] -= ab[j*ld + kv + i - j]*b[j];
+        }
+    }
+}
+
+/// MARK: BLOCK TRIDIAGONAL MATRICES
+int BlockTridiagonalSolve(int nblocks, int m, const double *A, double *B, double *C, double *d)
+{
+    size_t mm = (size_t)m*m;
+    int *pivot = malloc(m*sizeof(int));
+    int *cols = malloc(m*sizeof(int));
+    
+    //  Forward elimination: B'_j = B_j - A_j G_(j-1), d'_j = d_j - A_j g_(j-1), with G_j = B'_j^-1 C_j stored over C_j and g_j over d_j.
+    for(int j = 0; j < nblocks; ++j)
+    {
+        double *Bj = &B[j*mm];
+        double *dj = &d[(size_t)j*m];
+        
+        if(j > 0)
+        {
+            const double *Aj = &A[j*mm];
+            const double *G = &C[(j - 1)*mm];
+            const double *gprev = &d[(size_t)(j - 1)*m];
+            
+            for(int i = 0; i < m; ++i)
+            {
+                for(int k = 0; k < m; ++k)
+                {
+                    double a = Aj[i*m + k];
+                    
+                    if(a == 0.0)
+                    {
+                        continue;
+                    }
+                    for(int l = 0; l < m; ++l)
+                    {
+                        Bj[i*m + l] -= a*G[k*m + l];
+                    }
+                    dj[i] -= a*gprev[k];
+                }
+            }
+        }
+        if(LUDecompose(m, Bj, pivot) != 0)
+        {
+            free(pivot);
+            free(cols);
+            return 1;
+        }
+        LUSolve(m, Bj, pivot, dj);
+        if(j < nblocks - 1)
+        {
+            double *Cj = &C[j*mm];
+            int ncols = 0;
+            
+            //  Only the nonzero columns of C_j give nonzero columns of G_j. They are solved together so the substitutions run along rows.
+            for(int l = 0; l < m; ++l)
+            {
+                for(int i = 0; i < m; ++i)
+                {
+                    if(Cj[i*m + l] != 0.0)
+                    {
+                        cols[ncols++] = l;
+                        break;
+                    }
+                }
+            }
+            for(int k = 0; k < m; ++k)
+            {
+                if(pivot[k] != k)
+                {
+                    for(int c = 0; c < ncols; ++c)
+                    {
+                        double sto = Cj[k*m + cols[c]];
+                        Cj[k*m + cols[c]] = Cj[pivot[k]*m + cols[c]];
+                        Cj[pivot[k]*m + cols[c]] = sto;
+                    }
+                }
+            }
+            for(int i = 1; i < m; ++i)
+            {
+                for(int k = 0; k < i; ++k)
+                {
+                    double factor = Bj[i*m + k];
+                    
+                    if(factor == 0.0)
+                    {
+                        continue;
+                    }
+                    for(int c = 0; c < ncols; ++c)
+                    {
+                        Cj[i*m + cols[c]] -= factor*Cj[k*m + cols[c]];
+                    }
+                }
+            }
+            for(int i = m - 1; i >= 0; --i)
+            {
+                for(int k = i + 1; k < m; ++k)
+                {
+                    double factor = Bj[i*m + k];
+                    
+                    if(factor == 0.0)
+                    {
+                        continue;
+                    }
+                    for(int c = 0; c < ncols; ++c)
+                    {
+                        Cj[i*m + cols[c]] -= factor*Cj[k*m + cols[c]];
+                    }
+                }
+                for(int c = 0; c < ncols; ++c)
+                {
+                    Cj[i*m + cols[c]] /= Bj[i*m + i];
+                }
+            }
+        }
+    }
+    
+    //  Back substitution: x_j = g_j - G_j x_(j+1)
+    for(int j = nblocks - 2; j >= 0; --j)
+    {
+        const double *G = &C[j*mm];
+        const double *xnext = &d[(size_t)(j + 1)*m];
+        double *dj = &d[(size_t)j*m];
+        
+        for(int i = 0; i < m; ++i)
+        {
+            for(int l = 0; l < m; ++l)
+            {
+                dj[i] -= G[i*m + l]*xnext[l];
+            }
+        }
+    }
+    
+    free(pivot);
+    free(cols);
+    
+    return 0;
+}
@@ -0,0 +1,129 @@
+//
+//  LinearAlgebra.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef LinearAlgebraDense_h
+#define LinearAlgebraDense_h
+
+/// This subroutine is used to factorise a dense square matrix into its lower and upper triangular factors (A = PLU) using Gaussian elimination with partial pivoting. The factors overwrite the matrix. This function returns 0 on success and 1 if the matrix is singular.
+/// @param n Order of the matrix.
+/// @param A Matrix stored in row-major order (n x n). Overwritten with the LU factors.
+/// @param pivot Array of n integers used to store the row permutation.
+int LUDecompose(int n, double *A, int *pivot);
+
+/// This subroutine is used to solve the linear system Ax = b using the factors generated by "LUDecompose(...)". The factors can be reused for any number of right-hand sides.
+/// @param n Order of the matrix.
+/// @param LU Factorised matrix from "LUDecompose(...)".
+/// @param pivot Row permutation from "LUDecompose(...)".
+/// @param b Right-hand side vector. Overwritten with the solution vector.
+void LUSolve(int n, const double *LU, const int *pivot, double *b);
+
+/// This subroutine is used to solve the linear system Ax = b by successive over-relaxation. The matrix should be diagonally dominant. This function returns the number of iterations performed or -1 if the tolerance was not met.
+/// @param n Order of the matrix.
+/// @param A Matrix stored in row-major order (n x n).
+/// @param b Right-hand side vector.
+/// @param x Initial guess. Overwritten with the solution vector.
+/// @param omega Relaxation factor (1 = Gauss-Seidel).
+/// @param tol Convergence tolerance on the largest relative change in x.
+/// @param maxiter Maximum number of iterations.
+int SORSolve(int n, const double *A, const double *b, double *x, double omega, double tol, int maxiter);
+
+#endif /* LinearAlgebraDense_h */
+
+#ifndef LinearAlgebraSparse_h
+#define LinearAlgebraSparse_h
+
+typedef struct SparseMatrix{
+    int n;          // Order of the matrix.
+    int nnz;        // Number of stored entries.
+    int *rowptr;    // Start of each row within "col" and "val" (n + 1 entries).
+    int *col;       // Column of each stored entry, sorted within each row.
+    double *val;    // Value of each stored entry.
+} SparseMatrix;
+
+/// This subroutine is used to calculate the product y = Ax for a matrix stored in compressed sparse row format.
+/// @param A Sparse matrix.
+/// @param x Vector multiplied by the matrix.
+/// @param y Vector where the product should be stored.
+void SparseMultiply(const SparseMatrix *A, const double *x, double *y);
+
+/// This subroutine is used to solve the linear system Ax = b by the conjugate gradient method with a diagonal (Jacobi) preconditioner. The matrix must be symmetric positive definite. This function returns the number of iterations performed or -1 if the tolerance was not met.
+/// @param A Sparse matrix.
+/// @param b Right-hand side vector.
+/// @param x Initial guess. Overwritten with the solution vector.
+/// @param tol Convergence tolerance on the residual norm relative to the norm of b.
+/// @param maxiter Maximum number of iterations.
+int SparseCGSolve(const SparseMatrix *A, const double *b, double *x, double tol, int maxiter);
+
+#endif /* LinearAlgebraSparse_h */
+
+#ifndef LinearAlgebraBand_h
+#define LinearAlgebraBand_h
+
+typedef struct BandMatrix{
+    int n;          // Order of the matrix.
+    int kl;         // Number of sub-diagonals.
+    int ku;         // Number of super-diagonals.
+    int ld;         // Stored rows per column (2 kl + ku + 1). The extra kl rows hold fill-in from row interchanges.
+    double *ab;     // Column-major band storage. Entry (i, j) is held at ab[j*ld + kl + ku + i - j].
+    int *pivot;     // Row interchanges from "BandLUDecompose(...)".
+} BandMatrix;
+
+/// This subroutine is used to allocate a zeroed band matrix. Arrays are released by "BandMatrixFree(...)".
+/// @param A Struct where the band matrix should be stored.
+/// @param n Order of the matrix.
+/// @param kl Number of sub-diagonals.
+/// @param ku Number of super-diagonals.
+void BandMatrixAlloc(BandMatrix *A, int n, int kl, int ku);
+
+/// This subroutine is used to release the arrays of a band matrix.
+/// @param A Band matrix.
+void BandMatrixFree(BandMatrix *A);
+
+/// This subroutine is used to add a value to entry (i, j) of a band matrix. The entry must lie within the band.
+/// @param A Band matrix.
+/// @param i Row of the entry.
+/// @param j Column of the entry.
+/// @param value Value added to the entry.
+void BandAdd(BandMatrix *A, int i, int j, double value);
+
+/// This subroutine is used to factorise a band matrix (A = PLU) using Gaussian elimination with partial pivoting. The work scales with n kl (kl + ku) rather than n^3. This function returns 0 on success and 1 if the matrix is singular.
+/// @param A Band matrix. Overwritten with the LU factors.
+int BandLUDecompose(BandMatrix *A);
+
+/// This subroutine is used to solve the linear system Ax = b using the factors generated by "BandLUDecompose(...)".
+/// @param A Factorised band matrix.
+/// @param b Right-hand side vector. Overwritten with the solution vector.
+void BandLUSolve(const BandMatrix *A, double *b);
+
+#endif /* LinearAlgebraBand_h */
+
+#ifndef LinearAlgebraBlock_h
+#define LinearAlgebraBlock_h
+
+/// This subroutine is used to solve a block tridiagonal linear system by block Gaussian elimination (the block Thomas algorithm). Each diagonal block is factorised with "LUDecompose(...)", so the work scales with nblocks m^3 rather than (nblocks m)^3. This function returns 0 on success and 1 if a diagonal block is singular.
+/// @param nblocks Number of block rows.
+/// @param m Order of each block.
+/// @param A Sub-diagonal blocks, each m x m row-major, stored consecutively. The first block is not used.
+/// @param B Diagonal blocks. Overwritten with their factors.
+/// @param C Super-diagonal blocks. The last block is not used. Overwritten with working values.
+/// @param d Right-hand side vector (nblocks m). Overwritten with the solution vector.
+int BlockTridiagonalSolve(int nblocks, int m, const double *A, double *B, double *C, double *d);
+
+#endif /* LinearAlgebraBlock_h */
@@ -0,0 +1,136 @@
+//
+//  Parallel.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+//  Standard header files
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+//  Custom header files
+#include "Parallel.h"
+
+#define maxthreads 64
+
+typedef struct ParallelBlock{
+    int start;                  // First element in block.
+    int end;                    // One past the last element in block.
+    ParallelKernel kernel;      // Kernel applied to the block.
+    void *context;              // Data shared between all blocks.
+} ParallelBlock;
+
+static void *parallelWorker(void *arg)
+{
+    ParallelBlock *block = (ParallelBlock *)arg;
+    
+    block->kernel(block->start, block->end, block->context);
+    
+    return NULL;
+}
+
+int parallelThreadCount(void)
+{
+    long cores = 0;
+    char *env = NULL;
+    
+    env = getenv("PROCESS_MODEL_THREADS");
+    if(env != NULL)
+    {
+        cores = atol(env);
+    }
+    if(cores < 1)
+    {
+        cores = sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    if(cores < 1)
+    {
+        cores = 1;
+    }
+    if(cores > maxthreads)
+    {
+        cores = maxthreads;
+    }
+    
+    return (int)cores;
+}
+
+void parallelFor(int count, int grain, ParallelKernel kernel, void *context)
+{
+    pthread_t threads[maxthreads];
+    ParallelBlock blocks[maxthreads];
+    int started[maxthreads];
+    int nthreads = 0;
+    int chunk = 0;
+    
+    if(count <= 0)
+    {
+        return;
+    }
+    if(grain < 1)
+    {
+        grain = 1;
+    }
+    
+    //  Limiting the number of threads so that every thread receives at least "grain" elements.
+    nthreads = parallelThreadCount();
+    if(nthreads > count/grain)
+    {
+        nthreads = count/grain;
+    }
+    if(nthreads <= 1)
+    {
+        kernel(0, count, context);
+        return;
+    }
+    
+    chunk = (count + nthreads - 1)/nthreads;
+    for(int i = 0; i < nthreads; ++i)
+    {
+        blocks[i].start = i*chunk;
+        blocks[i].end = (i + 1)*chunk;
+        if(blocks[i].end > count)
+        {
+            blocks[i].end = count;
+        }
+        blocks[i].kernel = kernel;
+        blocks[i].context = context;
+        started[i] = 0;
+    }
+    
+    //  Block 0 is processed on the calling thread.
+    for(int i = 1; i < nthreads; ++i)
+    {
+        if(blocks[i].start < blocks[i].end)
+        {
+            started[i] = (pthread_create(&threads[i], NULL, parallelWorker, &blocks[i]) == 0);
+        }
+    }
+    kernel(blocks[0].start, blocks[0].end, context);
+    
+    for(int i = 1; i < nthreads; ++i)
+    {
+        if(started[i])
+        {
+            pthread_join(threads[i], NULL);
+        }else if(blocks[i].start < blocks[i].end){
+            kernel(blocks[i].start, blocks[i].end, context);
+        }
+    }
+}
@@ -0,0 +1,37 @@
+//
+//  Parallel.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef Parallel_h
+#define Parallel_h
+
+/// Function pointer type used to describe a kernel that processes the half-open index range [start, end). Kernels must only write to the elements within their own range.
+typedef void (*ParallelKernel)(int start, int end, void *context);
+
+/// This subroutine returns the number of worker threads that will be used by "parallelFor(...)".
+int parallelThreadCount(void);
+
+/// This subroutine is used to split the index range [0, count) into contiguous blocks and run the kernel on each block concurrently. The subroutine returns once every block has been processed. If worker threads cannot be created, the remaining blocks are processed on the calling thread.
+/// @param count Total number of elements to be processed.
+/// @param grain Minimum number of elements assigned to a single thread.
+/// @param kernel Function used to process each block of elements.
+/// @param context Pointer to the data shared between all blocks.
+void parallelFor(int count, int grain, ParallelKernel kernel, void *context);
+
+#endif /* Parallel_h */
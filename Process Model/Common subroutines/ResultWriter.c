@@ -0,0 +1,563 @@
+//
+//  ResultWriter.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+//  Standard header files
+#include <math.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//  Custom header files
+#include "ResultWriter.h"
+
+#define maxdigits 14    // Largest number of digits after the point formatted on the fast path.
+#define maxprecision 40 // Largest number of digits after the point written at all.
+#define maxcell WriterNumberLength  // Space reserved in the buffer for one number.
+#define maxexact 1e15   // Largest scaled value formatted on the fast path, leaving a margin below the precision of a double.
+
+static int writerDefault = 0;   // Format chosen with "writerSetFormat(...)". Zero until set.
+
+static const uint64_t pow10int[maxdigits + 2] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL,
+    10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL,
+    1000000000000000ULL
+};
+
+static const double pow10exact[23] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/// MARK: FORMAT SELECTION
+int writerFormat(void)
+{
+    char *env = NULL;
+    
+    if(writerDefault != 0)
+    {
+        return writerDefault;
+    }
+    env = getenv("PROCESS_MODEL_OUTPUT");
+    if(env != NULL && (env[0] == 'c' || env[0] == 'C'))
+    {
+        return WriterCSV;
+    }
+    return WriterTSV;
+}
+
+void writerSetFormat(int format)
+{
+    writerDefault = (format == WriterCSV) ? WriterCSV : WriterTSV;
+}
+
+/// MARK: NUMBER FORMATTING
+/// This subroutine is used to scale a value by a power of ten. Powers up to 1e22 are exact doubles and are taken from a table.
+/// @param x Value to be scaled.
+/// @param k Power of ten.
+static double writerScale(double x, int k)
+{
+    if(k >= 0){
+        return (k < 23) ? x*pow10exact[k] : x*pow(10.0, k);
+    }else{
+        return (k > -23) ? x/pow10exact[-k] : x/pow(10.0, -k);
+    }
+}
+
+/// This subroutine is used to check whether a scaled value lies so close to halfway between two integers that rounding the product could differ from rounding the exact value, as printf does. This function returns 1 if the value should be passed to snprintf.
+/// @param scaled Absolute value multiplied by the power of ten.
+static int writerNearTie(double scaled)
+{
+    double frac = scaled - floor(scaled);
+    
+    return fabs(frac - 0.5) <= 1e-15*scaled + 1e-300;
+}
+
+/// This subroutine is used to format a value with snprintf when the fast path cannot be used. This function returns the number of characters actually stored, never more than "maxcell" - 1.
+/// @param out Array of at least "maxcell" characters where the text should be stored.
+/// @param format "%.*f" or "%.*E".
+/// @param digits Number of digits after the point.
+/// @param x Value to be converted.
+static int writerFallback(char *out, const char *format, int digits, double x)
+{
+    int n = snprintf(out, maxcell, format, digits, x);
+    
+    if(n < 0)
+    {
+        out[0] = '\0';
+        return 0;
+    }
+    
+    return (n < maxcell) ? n : maxcell - 1;
+}
+
+/// This subroutine is used to write the decimal digits of an unsigned integer. This function returns the number of characters written.
+/// @param out Array where the digits should be stored.
+/// @param u Integer to be written.
+/// @param width Minimum number of digits, padded with leading zeros.
+static int writerDigits(char *out, uint64_t u, int width)
+{
+    char tmp[24];
+    int n = 0;
+    
+    do
+    {
+        tmp[n++] = (char)('0' + u%10);
+        u /= 10;
+    }while(u != 0);
+    while(n < width)
+    {
+        tmp[n++] = '0';
+    }
+    for(int i = 0; i < n; ++i)
+    {
+        out[i] = tmp[n - 1 - i];
+    }
+    
+    return n;
+}
+
+int writerFormatDouble(char *out, double x, int style, int digits)
+{
+    double ax = fabs(x);
+    int len = 0;
+    
+    if(digits < 0)
+    {
+        digits = 0;
+    }
+    if(digits > maxprecision)
+    {
+        digits = maxprecision;
+    }
+    if(!isfinite(x) || digits > maxdigits)
+    {
+        return writerFallback(out, (style == WriterSci) ? "%.*E" : "%.*f", digits, x);
+    }
+    
+    if(style == WriterSci){
+        uint64_t u = 0;
+        uint64_t lo = pow10int[digits];
+        int e = 0;
+        
+        if(ax == 0.0){
+            e = 0;
+        }else{
+            double scaled = 0.0;
+            int b = 0;
+            
+            // Estimate of the decimal exponent from the binary exponent
+            frexp(ax, &b);
+            e = (int)floor((b - 1)*0.30102999566398120);
+            if(e < -290 || e > 290)
+            {
+                return writerFallback(out, "%.*E", digits, x);
+            }
+            // The estimate of the exponent may be one out either way, and rounding may carry into a new digit
+            for(int pass = 0; pass < 3; ++pass)
+            {
+                scaled = writerScale(ax, digits - e);
+                if(writerNearTie(scaled))
+                {
+                    return writerFallback(out, "%.*E", digits, x);
+                }
+                u = (uint64_t)(scaled + 0.5);
+                if(u >= 10*lo){
+                    ++e;
+                }else if(u < lo){
+                    --e;
+                }else{
+                    break;
+                }
+            }
+            if(u < lo || u >= 10*lo)
+            {
+                return writerFallback(out, "%.*E", digits, x);
+            }
+        }
+        
+        if(signbit(x))
+        {
+            out[len++] = '-';
+        }
+        out[len++] = (char)('0' + u/lo);
+        if(digits > 0)
+        {
+            out[len++] = '.';
+            len += writerDigits(&out[len], u%lo, digits);
+        }
+        out[len++] = 'E';
+        out[len++] = (e < 0) ? '-' : '+';
+        len += writerDigits(&out[len], (uint64_t)abs(e), 2);
+    }else{
+        uint64_t p = pow10int[digits];
+        double scaled = ax*(double)p;
+        uint64_t u = 0;
+        
+        if(!(scaled < maxexact) || writerNearTie(scaled))
+        {
+            return writerFallback(out, "%.*f", digits, x);
+        }
+        u = (uint64_t)(scaled + 0.5);
+        
+        if(signbit(x))
+        {
+            out[len++] = '-';
+        }
+        len += writerDigits(&out[len], u/p, 1);
+        if(digits > 0)
+        {
+            out[len++] = '.';
+            len += writerDigits(&out[len], u%p, digits);
+        }
+    }
+    out[len] = '\0';
+    
+    return len;
+}
+
+/// MARK: BUFFER
+/// This subroutine is used to pass the buffer to the file.
+/// @param w Writer from "writerOpen(...)".
+static void writerFlush(ResultWriter *w)
+{
+    if(w->len > 0)
+    {
+        if(fwrite(w->buf, 1, w->len, w->fp) != w->len)
+        {
+            w->failed = 1;
+        }
+        w->len = 0;
+    }
+}
+
+/// This subroutine is used to make sure that at least "n" characters can be added to the buffer.
+/// @param w Writer from "writerOpen(...)".
+/// @param n Number of characters to be added.
+static void writerReserve(ResultWriter *w, size_t n)
+{
+    if(w->len + n > WriterBufferSize)
+    {
+        writerFlush(w);
+    }
+}
+
+/// This subroutine is used to add characters to the buffer. Blocks larger than the buffer are passed straight to the file.
+/// @param w Writer from "writerOpen(...)".
+/// @param text Characters to be added.
+/// @param n Number of characters.
+static void writerPut(ResultWriter *w, const char *text, size_t n)
+{
+    if(w->fp == NULL)
+    {
+        return;
+    }
+    if(n > WriterBufferSize){
+        writerFlush(w);
+        if(fwrite(text, 1, n, w->fp) != n)
+        {
+            w->failed = 1;
+        }
+    }else{
+        writerReserve(w, n);
+        memcpy(&w->buf[w->len], text, n);
+        w->len += n;
+    }
+}
+
+/// MARK: FILE
+int writerOpen(ResultWriter *w, const char *title)
+{
+    time_t rawtime;
+    struct tm *info;
+    size_t len = 0;
+    
+    memset(w, 0, sizeof(ResultWriter));
+    w->format = writerFormat();
+    w->sep = (w->format == WriterCSV) ? ',' : '\t';
+    
+    //  Set file name as timestamp + title
+    time(&rawtime);
+    info = localtime(&rawtime);
+    len = strftime(w->filename, sizeof(w->filename), "%Y%m%d %H%M%S", info);
+    snprintf(&w->filename[len], sizeof(w->filename) - len, " %s%s", title, (w->format == WriterCSV) ? ".csv" : ".txt");
+    printf("File name: \"%s\"\n", w->filename);
+    
+    printf("Beginning file write...\n");
+    
+    w->buf = malloc(WriterBufferSize);
+    if(w->buf == NULL)
+    {
+        printf("Memory could not be allocated to write \"%s\".\n", w->filename);
+        return 0;
+    }
+    w->fp = fopen(w->filename, "w");
+    if(w->fp == NULL)
+    {
+        printf("File \"%s\" could not be opened.\n", w->filename);
+        free(w->buf);
+        w->buf = NULL;
+        return 0;
+    }
+    
+    return 1;
+}
+
+int writerConsole(ResultWriter *w)
+{
+    memset(w, 0, sizeof(ResultWriter));
+    w->format = WriterTSV;
+    w->sep = '\t';
+    w->console = 1;
+    
+    w->buf = malloc(WriterBufferSize);
+    if(w->buf == NULL)
+    {
+        printf("Memory could not be allocated to display the results.\n");
+        return 0;
+    }
+    w->fp = stdout;
+    
+    return 1;
+}
+
+int writerClose(ResultWriter *w)
+{
+    if(w->fp == NULL)
+    {
+        return 0;
+    }
+    writerFlush(w);
+    if(w->console){
+        fflush(w->fp);
+        w->fp = NULL;
+        free(w->buf);
+        w->buf = NULL;
+        
+        return !w->failed;
+    }
+    if(fclose(w->fp) != 0)
+    {
+        w->failed = 1;
+    }
+    w->fp = NULL;
+    free(w->buf);
+    w->buf = NULL;
+    
+    if(w->failed){
+        printf("Write to \"%s\" failed.\n", w->filename);
+        return 0;
+    }
+    printf("Write Complete\n");
+    
+    return 1;
+}
+
+/// MARK: FIELDS AND LINES
+/// This subroutine is used to write one field of "n" characters. In comma separated files the field is quoted if it contains a comma, quote or line break.
+/// @param w Writer from "writerOpen(...)".
+/// @param text Characters of the field.
+/// @param n Number of characters.
+static void writerFieldChars(ResultWriter *w, const char *text, size_t n)
+{
+    int quote = 0;
+    
+    if(w->format == WriterCSV)
+    {
+        for(size_t i = 0; i < n; ++i)
+        {
+            if(text[i] == ',' || text[i] == '"' || text[i] == '\n')
+            {
+                quote = 1;
+                break;
+            }
+        }
+    }
+    if(!quote)
+    {
+        writerPut(w, text, n);
+        return;
+    }
+    writerPut(w, "\"", 1);
+    for(size_t i = 0; i < n; ++i)
+    {
+        if(text[i] == '"')
+        {
+            writerPut(w, "\"", 1);
+        }
+        writerPut(w, &text[i], 1);
+    }
+    writerPut(w, "\"", 1);
+}
+
+/// This subroutine is used to write "n" characters of free text. In comma separated files each tab is taken as a field separator and each field is quoted as needed.
+/// @param w Writer from "writerOpen(...)".
+/// @param text Characters to be written.
+/// @param n Number of characters.
+static void writerChars(ResultWriter *w, const char *text, size_t n)
+{
+    size_t start = 0;
+    
+    if(w->format != WriterCSV)
+    {
+        writerPut(w, text, n);
+        return;
+    }
+    for(size_t i = 0; i < n; ++i)
+    {
+        if(text[i] == '\t' || text[i] == '\n')
+        {
+            writerFieldChars(w, &text[start], i - start);
+            writerPut(w, (text[i] == '\t') ? &w->sep : "\n", 1);
+            start = i + 1;
+        }
+    }
+    writerFieldChars(w, &text[start], n - start);
+}
+
+void writerText(ResultWriter *w, const char *text)
+{
+    writerChars(w, text, strlen(text));
+}
+
+void writerPrintf(ResultWriter *w, const char *format, ...)
+{
+    char line[512];
+    int n = 0;
+    va_list args;
+    
+    va_start(args, format);
+    n = vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    
+    if(n < 0)
+    {
+        return;
+    }
+    if((size_t)n < sizeof(line)){
+        writerChars(w, line, n);
+    }else{
+        // Longer than the line buffer, so format again into the heap
+        char *big = malloc(n + 1);
+        
+        if(big == NULL)
+        {
+            w->failed = 1;
+            return;
+        }
+        va_start(args, format);
+        vsnprintf(big, n + 1, format, args);
+        va_end(args);
+        writerChars(w, big, n);
+        free(big);
+    }
+}
+
+void writerField(ResultWriter *w, const char *text)
+{
+    writerFieldChars(w, text, strlen(text));
+}
+
+void writerNumber(ResultWriter *w, double x, int style, int digits)
+{
+    if(w->fp == NULL)
+    {
+        return;
+    }
+    writerReserve(w, maxcell);
+    w->len += writerFormatDouble(&w->buf[w->len], x, style, digits);
+}
+
+void writerSep(ResultWriter *w)
+{
+    writerPut(w, &w->sep, 1);
+}
+
+void writerEnd(ResultWriter *w)
+{
+    writerPut(w, "\n", 1);
+}
+
+void writerValue(ResultWriter *w, const char *label, double x, int digits, const char *units)
+{
+    writerField(w, label);
+    writerSep(w);
+    writerNumber(w, x, WriterFixed, digits);
+    writerSep(w);
+    writerField(w, units);
+    writerEnd(w);
+}
+
+/// MARK: TABLES
+void writerHeader(ResultWriter *w, int ncol, const WriterColumn *cols)
+{
+    for(int j = 0; j < ncol; ++j)
+    {
+        char heading[WriterNameLength];
+        
+        if(cols[j].units != NULL){
+            snprintf(heading, sizeof(heading), "%s (%s)", cols[j].name, cols[j].units);
+        }else{
+            snprintf(heading, sizeof(heading), "%s", cols[j].name);
+        }
+        if(j > 0)
+        {
+            writerSep(w);
+        }
+        writerField(w, heading);
+    }
+    writerEnd(w);
+}
+
+void writerRows(ResultWriter *w, int ncol, const WriterColumn *cols, int nrows)
+{
+    if(w->fp == NULL)
+    {
+        return;
+    }
+    for(int i = 0; i < nrows; ++i)
+    {
+        // Each cell reserves room for the separator and the longest number, so it is formatted straight into the buffer
+        for(int j = 0; j < ncol; ++j)
+        {
+            const WriterColumn *col = &cols[j];
+            size_t stride = (col->stride > 0) ? (size_t)col->stride : 1;
+            double scale = (col->scale != 0.0) ? col->scale : 1.0;
+            double x = col->data[i*stride]*scale + col->offset;
+            
+            writerReserve(w, maxcell + 1);
+            if(j > 0)
+            {
+                w->buf[w->len++] = w->sep;
+            }
+            w->len += writerFormatDouble(&w->buf[w->len], x, col->style, col->digits);
+        }
+        writerReserve(w, 1);
+        w->buf[w->len++] = '\n';
+    }
+}
+
+void writerTable(ResultWriter *w, int ncol, const WriterColumn *cols, int nrows)
+{
+    writerHeader(w, ncol, cols);
+    writerRows(w, ncol, cols, nrows);
+}
@@ -0,0 +1,145 @@
+//
+//  ResultWriter.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef ResultWriter_h
+#define ResultWriter_h
+
+#include <stdio.h>
+
+#define WriterTSV 1             // Tab separated values written to a .txt file.
+#define WriterCSV 2             // Comma separated values written to a .csv file.
+
+#define WriterFixed 1           // Fixed notation with a set number of decimal places, as "%.nf".
+#define WriterSci 2             // Scientific notation with a set number of digits after the point, as "%.nE".
+
+#define WriterBufferSize 1048576 // Number of characters held before the buffer is passed to the file.
+#define WriterNameLength 256    // Maximum length of a file name.
+#define WriterNumberLength 352  // Longest number written, including the terminating null: sign, 309 integer digits of the largest double, point and 40 decimals.
+
+/// This struct is used to collect formatted results in memory and pass them to the file in large blocks.
+typedef struct ResultWriter{
+    FILE *fp;                           // Pointer to the file location.
+    char filename[WriterNameLength];    // Name of the file being written.
+    char *buf;                          // Buffer of characters waiting to be written.
+    size_t len;                         // Number of characters in the buffer.
+    int format;                         // "WriterTSV" or "WriterCSV".
+    char sep;                           // Field separator for the format.
+    int failed;                         // Set if any write to the file failed.
+    int console;                        // Set if the writer is attached to the user console by "writerConsole(...)".
+} ResultWriter;
+
+/// This struct is used to describe one column of a results table: its heading, the data it is read from and how each value is formatted.
+typedef struct WriterColumn{
+    const char *name;       // Column heading.
+    const char *units;      // Units appended to the heading in brackets. NULL for none.
+    const double *data;     // First value of the column.
+    int stride;             // Distance between successive values. 0 is taken as 1.
+    int style;              // "WriterFixed" or "WriterSci".
+    int digits;             // Decimal places for "WriterFixed" or digits after the point for "WriterSci".
+    double scale;           // Multiplier applied to each value before it is written. 0 is taken as 1.
+    double offset;          // Added to each value after scaling.
+} WriterColumn;
+
+/// This subroutine returns the format used by "writerOpen(...)". The format is tab separated unless the environment variable "PROCESS_MODEL_OUTPUT" is "csv" or "writerSetFormat(...)" has been called.
+int writerFormat(void);
+
+/// This subroutine is used to set the format used by every following call to "writerOpen(...)".
+/// @param format "WriterTSV" or "WriterCSV".
+void writerSetFormat(int format);
+
+/// This subroutine is used to convert a double to text without going through printf. The output matches printf: values with more significant digits than a double can hold, values lying almost exactly halfway between two outputs, infinities and NaNs are passed to snprintf. This function returns the number of characters written, not including the terminating null.
+/// @param out Array of at least "WriterNumberLength" characters where the text should be stored.
+/// @param x Value to be converted.
+/// @param style "WriterFixed" or "WriterSci".
+/// @param digits Decimal places for "WriterFixed" or digits after the point for "WriterSci" (values above 14 are passed to snprintf and values above 40 are taken as 40).
+int writerFormatDouble(char *out, double x, int style, int digits);
+
+/// This subroutine is used to create a results file named with the current timestamp followed by the title, e.g. "20201017 120000 Compressor Results.txt". The file is checked for failure to open. This function returns 1 if the file is ready to be written and 0 otherwise.
+/// @param w Writer to be opened.
+/// @param title Text following the timestamp in the file name.
+int writerOpen(ResultWriter *w, const char *title);
+
+/// This subroutine is used to attach a writer to the user console, so that the same subroutine can display results or write them to file. The console is always tab separated. This function returns 1 if the writer is ready and 0 otherwise.
+/// @param w Writer to be attached.
+int writerConsole(ResultWriter *w);
+
+/// This subroutine is used to write the remaining buffer, close the file and report the outcome to the user console. A console writer is flushed without being closed or reported. This function returns 1 if every write succeeded and 0 otherwise.
+/// @param w Writer from "writerOpen(...)".
+int writerClose(ResultWriter *w);
+
+/// This subroutine is used to write free text such as titles and labelled values. In tab separated files the text is written exactly as given; in comma separated files each tab is taken as a field separator and each field is quoted as needed.
+/// @param w Writer from "writerOpen(...)".
+/// @param text Text to be written.
+void writerText(ResultWriter *w, const char *text);
+
+/// This subroutine is used to write formatted text, as "fprintf(...)", with tabs handled as in "writerText(...)". It is intended for titles, notes and summaries rather than large tables.
+/// @param w Writer from "writerOpen(...)".
+/// @param format Format string.
+void writerPrintf(ResultWriter *w, const char *format, ...);
+
+/// This subroutine is used to write a text field. In comma separated files the field is quoted if it contains a comma, quote or line break.
+/// @param w Writer from "writerOpen(...)".
+/// @param text Text of the field.
+void writerField(ResultWriter *w, const char *text);
+
+/// This subroutine is used to write a number field.
+/// @param w Writer from "writerOpen(...)".
+/// @param x Value to be written.
+/// @param style "WriterFixed" or "WriterSci".
+/// @param digits Decimal places for "WriterFixed" or digits after the point for "WriterSci".
+void writerNumber(ResultWriter *w, double x, int style, int digits);
+
+/// This subroutine is used to write the field separator of the file format.
+/// @param w Writer from "writerOpen(...)".
+void writerSep(ResultWriter *w);
+
+/// This subroutine is used to end a line.
+/// @param w Writer from "writerOpen(...)".
+void writerEnd(ResultWriter *w);
+
+/// This subroutine is used to write a labelled value on one line in the form "label, value, units", e.g. "P1 =	101.325	kPa".
+/// @param w Writer from "writerOpen(...)".
+/// @param label Label of the value.
+/// @param x Value to be written.
+/// @param digits Number of decimal places.
+/// @param units Units of the value.
+void writerValue(ResultWriter *w, const char *label, double x, int digits, const char *units);
+
+/// This subroutine is used to write the headings of a results table on one line.
+/// @param w Writer from "writerOpen(...)".
+/// @param ncol Number of columns.
+/// @param cols Columns of the table.
+void writerHeader(ResultWriter *w, int ncol, const WriterColumn *cols);
+
+/// This subroutine is used to write the rows of a results table, one line per row.
+/// @param w Writer from "writerOpen(...)".
+/// @param ncol Number of columns.
+/// @param cols Columns of the table.
+/// @param nrows Number of rows.
+void writerRows(ResultWriter *w, int ncol, const WriterColumn *cols, int nrows);
+
+/// This subroutine is used to write the headings and rows of a results table.
+/// @param w Writer from "writerOpen(...)".
+/// @param ncol Number of columns.
+/// @param cols Columns of the table.
+/// @param nrows Number of rows.
+void writerTable(ResultWriter *w, int ncol, const WriterColumn *cols, int nrows);
+
+#endif /* ResultWriter_h */
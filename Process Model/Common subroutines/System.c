@@ -31,7 +31,7 @@
 
 #define maxstrlen 128
 
-double inputDouble(int allowZero, int allowNeg, char VariableName[], char Units[])
+double inputDouble(int allowZero, int allowNeg, const char VariableName[], const char Units[])
 {
     char value[maxstrlen];  // Variable used to hold keyboard input.
     double input = 0.0;     // Variable used to store the double value before being returned to the calling function.
@@ -108,7 +108,13 @@ int Continue(int ControlVariable)
     while(ContCond == 1)
     {
         printf("Do you want to continue? ");
-        fgets(input, sizeof(input), stdin);
+        if(fgets(input, sizeof(input), stdin) == NULL)
+        {
+            //  End of input, nothing more can be asked
+            printf("\n");
+            ControlVariable = 0;
+            break;
+        }
         switch(input[0])
         {
             case '1':
@@ -134,3 +140,37 @@ int Continue(int ControlVariable)
     fflush(stdout);
     return ControlVariable;
 }
+
+int YesNo(const char *question)
+{
+    char input[maxstrlen];
+    
+    while(1)
+    {
+        printf("%s", question);
+        if(fgets(input, sizeof(input), stdin) == NULL)
+        {
+            //  End of input, taken as no
+            printf("\n");
+            return 0;
+        }
+        switch(input[0])
+        {
+            case '1':
+            case 'T':
+            case 'Y':
+            case 't':
+            case 'y':
+                return 1;
+            case '0':
+            case 'F':
+            case 'N':
+            case 'f':
+            case 'n':
+                return 0;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+}
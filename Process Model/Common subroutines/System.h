@@ -27,7 +27,7 @@
 /// @param allowNeg Integer value used to control whether a negative value is permitted in the data entry. A value of 0 will force a positive value to be entered.
 /// @param VariableName Variable descriptor.
 /// @param Units Units of the variable.
-double inputDouble(int allowZero, int allowNeg, char VariableName[], char Units[]);
+double inputDouble(int allowZero, int allowNeg, const char VariableName[], const char Units[]);
 
 #endif /* Input_h */
 
@@ -59,3 +59,12 @@ double pcterror(double input, double data);
 int Continue(int ControlVariable);
 
 #endif /* System_h */
+
+#ifndef YesNo_h
+#define YesNo_h
+
+/// This subroutine is used to ask the user a yes or no question. This function returns 1 for yes and 0 for no, or for the end of input.
+/// @param question Question displayed to the user.
+int YesNo(const char *question);
+
+#endif /* YesNo_h */
@@ -243,21 +243,21 @@ void B48CB(void);
 
 #endif /* B48CB_h */
 
-#ifndef B48CE_h
-#define B48CE_h
+#ifndef B49CE_h
+#define B49CE_h
 
-void B48CE(void);
+void B49CE(void);
 // This contains the course content for Multiphase Thermodynamics
 
-#endif /* B48CE_h */
+#endif /* B49CE_h */
 
-#ifndef B48CF_h
-#define B48CF_h
+#ifndef B49CF_h
+#define B49CF_h
 
-void B48CF(void);
+void B49CF(void);
 // This contains the course content for Process Modelling and Control
 
-#endif /* B48CF_h */
+#endif /* B49CF_h */
 
 //Year 4 Courses
 #ifndef B40DB_h
@@ -175,8 +175,9 @@ void B48BBtopic3()
         printf("5. Pitot Static Tube\n");
         printf("6. Orifice plate meter/ Venturi Meter\n");
         printf("7. Rotameter\n");
+        printf("8. Pipe network hydraulics\n");
         printf("q. Exit topic\n\n");
-        printf("Selection [1 - 7]: ");
+        printf("Selection [1 - 8]: ");
         
         fgets(input,sizeof(input),stdin);
         printf("\n");
@@ -202,13 +203,16 @@ void B48BBtopic3()
             case '7':
                 Rotameter();
                 break;
+            case '8':
+                PipeNetwork();
+                break;
             case '0':
             case 'Q':
             case 'q':
                 control = 0;
                 break;
             default:
-                printf("Input not recognised. Please enter an integer between 1 and 7.\n");
+                printf("Input not recognised. Please enter an integer between 1 and 8.\n");
                 break;
         }
         fflush(stdout);
@@ -217,7 +221,37 @@ void B48BBtopic3()
 
 void B48BBtopic4()
 {
-    PumpSizing();
+    char input[maxstrlen];
+    int control = 0;
+    
+    control = 1;
+    while(control == 1){
+        B48BBTopComm();
+        printf("1. Pump sizing\n");
+        printf("2. Pump selection (operating point and catalogue screening)\n");
+        printf("q. Exit topic\n\n");
+        printf("Selection [1 - 2]: ");
+        
+        fgets(input,sizeof(input),stdin);
+        printf("\n");
+        switch(input[0]){
+            case '1':
+                PumpSizing();
+                break;
+            case '2':
+                PumpSelection();
+                break;
+            case '0':
+            case 'Q':
+            case 'q':
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised. Please enter an integer between 1 and 2.\n");
+                break;
+        }
+        fflush(stdout);
+    }
 }
 /*
 void B48BBtopic5()
@@ -29,6 +29,7 @@
 
 //  Custom header files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BB_T1.h"
 #include "01aFluComp.h"
 
@@ -95,63 +96,24 @@ void FluCompDisplay(double P, double V, double n, double T, double c)
 void FluCompWrite(double P, double V, double n, double T, double c)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
-    
-    FILE *fp;   // Pointer to the file location.
-    //  Set file name as timestamp + Fluid Coefficient of Compressibility
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Fluid Coefficient of Compressibility Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /* //  This code does not work
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
-    }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
+    ResultWriter w;             // Buffered writer for the results file.
     
-    //  Open file
-    fp = fopen(filename, "w+");
+    //  Set file name as timestamp + Fluid Coefficient of Compressibility Results
+    if(!writerOpen(&w, "Fluid Coefficient of Compressibility Results"))
+    {
+        return;
+    }
     
     //  Write to file
-    fprintf(fp, "_Fluid_Coefficient_of_Compressibility_Results_\n");
-    fprintf(fp, "P =\t%.3f\tkPa\n", P*0.001);
-    fprintf(fp, "V =\t%.3f\tm3\n", V);
-    fprintf(fp, "n =\t%.3f\tmol\n", n);
-    fprintf(fp, "T =\t%.3f\tdeg C\n\n", (T - 273.15));
-    fprintf(fp, "c =\t%.6f\tm3/Pa\n", c);
+    writerPrintf(&w, "_Fluid_Coefficient_of_Compressibility_Results_\n");
+    writerPrintf(&w, "P =\t%.3f\tkPa\n", P*0.001);
+    writerPrintf(&w, "V =\t%.3f\tm3\n", V);
+    writerPrintf(&w, "n =\t%.3f\tmol\n", n);
+    writerPrintf(&w, "T =\t%.3f\tdeg C\n\n", (T - 273.15));
+    writerPrintf(&w, "c =\t%.6f\tm3/Pa\n", c);
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void FluCompWriteSwitch(double P, double V, double n, double T, double c)
@@ -29,6 +29,7 @@
 
 //  Custom header files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BB_T1.h"
 #include "01bFluidVHyd.h"
 
@@ -70,67 +71,23 @@ void FluidVHydDisplay(double rho, double h, double P)
 void FluidVHydWrite(double rho, double h, double P)
 {
     //  Function variables
-    char filename[maxstrlen];   // Character array used to store file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
     //  Set file name as timestamp + Vertical Hydrostatic Pressure Theorem Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Vertical Hydrostatic Pressure Theorem Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-    *filepath = (char)malloc((128*2)*sizeof(char));
-    
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-    printf("File path: \"%s\"\n", filepath);
-    
-    strcat(filepath, filename);
-    void free(void *filename);
-    
-    printf("File name: \"%s\"\n", filename);
-    printf("Full file path: \"%s\"\n\n", filepath);
-    
-    //Testing if directory is not present
-    
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, "Vertical Hydrostatic Pressure Theorem Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
-    fprintf(fp, "_Fluid_Vertical_Hydrostatic_Pressure_Results_\n");
-    fprintf(fp, "g =\t%.5f\tm/s2\n\n", g);
-    fprintf(fp, "rho =\t%.3f\tkg/m3\n", rho);
-    fprintf(fp, "h =\t%.3f\t m\n", h);
-    fprintf(fp, "P =\t%.3f\tPa\n", P);
+    writerPrintf(&w, "_Fluid_Vertical_Hydrostatic_Pressure_Results_\n");
+    writerPrintf(&w, "g =\t%.5f\tm/s2\n\n", g);
+    writerPrintf(&w, "rho =\t%.3f\tkg/m3\n", rho);
+    writerPrintf(&w, "h =\t%.3f\t m\n", h);
+    writerPrintf(&w, "P =\t%.3f\tPa\n", P);
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void FluidVHydWriteSwitch(double rho, double h, double P)
@@ -29,6 +29,7 @@
 
 //  Custom header files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BB_T1.h"
 #include "01cMano.h"
 
@@ -288,78 +289,34 @@ void ManoMeasDisplay(double P1, double P2, double rho1, double h1, double rho2,
 void ManoMeasWrite(double P1, double P2, double rho1, double h1, double rho2, double h2)
 {
     //  Function variables
-    char filename[maxstrlen];   // Character array used to store file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
-    
-    FILE *fp;   // Pointer to the file location.
+    ResultWriter w;             // Buffered writer for the results file.
     
     //  Set file name as timestamp + Manometer Measurement Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Manometer Measurement Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    
-    /*//driveloc is not suitable when determining the file path for mac
-    *filepath = (char)malloc(sizeof *filepath);
-    
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-    printf("File path: \"%s\"\n", filepath);
-    
-    strcat(filepath, filename);
-    void free(void *filename);
-    
-    printf("File name: \"%s\"\n", filename);
-    printf("Full file path: \"%s\"\n\n", filepath);
-    
-    //Testing if directory is not present
-    
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
-    }*/
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
+    if(!writerOpen(&w, "Manometer Measurement Results"))
+    {
+        return;
+    }
     
     //  Write to file
-    fprintf(fp, "_Manometer_Measurement_Calculations_\n\n");
-    fprintf(fp, "_Input_Parameters:_\n");
-    fprintf(fp, "\tProcess Fluid:\n");
-    fprintf(fp, "P1 =\t%.3f\tkPa_abs\n", P1*0.001);
-    fprintf(fp, "Process fluid density:\n");
-    fprintf(fp, "rho1 =\t%.3f\tkg/m3\n", rho1);
-    fprintf(fp, "Process fluid height:\n");
-    fprintf(fp, "h1 =\t%.3f\tm\n", h1);
-    fprintf(fp, "\tManometer Fluid:\n");
-    fprintf(fp, "P2 =\t%.3f\tkPa_abs\n", P2*0.001);
-    fprintf(fp, "Manometer fluid density:\n");
-    fprintf(fp, "rho2 =\t%.3f\tkg/m3\n\n", rho2);
-    
-    fprintf(fp, "_Output_Values:_\n");
-    fprintf(fp, "Manometer fluid height:\n");
-    fprintf(fp, "h2 =\t%.3f\tm\t= \\frac{\\rho_1gh_1 - \\Delta{P}}{\\rho_2g}\n", h2);
+    writerPrintf(&w, "_Manometer_Measurement_Calculations_\n\n");
+    writerPrintf(&w, "_Input_Parameters:_\n");
+    writerPrintf(&w, "\tProcess Fluid:\n");
+    writerPrintf(&w, "P1 =\t%.3f\tkPa_abs\n", P1*0.001);
+    writerPrintf(&w, "Process fluid density:\n");
+    writerPrintf(&w, "rho1 =\t%.3f\tkg/m3\n", rho1);
+    writerPrintf(&w, "Process fluid height:\n");
+    writerPrintf(&w, "h1 =\t%.3f\tm\n", h1);
+    writerPrintf(&w, "\tManometer Fluid:\n");
+    writerPrintf(&w, "P2 =\t%.3f\tkPa_abs\n", P2*0.001);
+    writerPrintf(&w, "Manometer fluid density:\n");
+    writerPrintf(&w, "rho2 =\t%.3f\tkg/m3\n\n", rho2);
+    
+    writerPrintf(&w, "_Output_Values:_\n");
+    writerPrintf(&w, "Manometer fluid height:\n");
+    writerPrintf(&w, "h2 =\t%.3f\tm\t= \\frac{\\rho_1gh_1 - \\Delta{P}}{\\rho_2g}\n", h2);
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void ManoMeasWriteSwitch(double P1, double P2, double rho1, double h1, double rho2, double h2)
@@ -421,78 +378,34 @@ void ManoEstiDisplay(double P1, double P2, double rho1, double h1, double rho2,
 void ManoEstiWrite(double P1, double P2, double rho1, double h1, double rho2, double h2)
 {
     //  Function variables
-    char filename[maxstrlen];   // Character array used to store file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;   // Pointer to the file location.
     //  Set file name as timestamp + Manometer Height Estimation Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Manometer Height Estimation Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-    *filepath = (char)malloc(sizeof *filepath);
-    
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-    printf("File path: \"%s\"\n", filepath);
-    
-    strcat(filepath, filename);
-    void free(void *filename);
-    
-    printf("File name: \"%s\"\n", filename);
-    printf("Full file path: \"%s\"\n\n", filepath);
-    
-    //Testing if directory is not present
-    
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, "Manometer Height Estimation Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
-    fprintf(fp, "_Manometer_Measurement_Calculations_\n\n");
-    fprintf(fp, "_Input_Parameters:_\n");
-    fprintf(fp, "\tProcess Fluid:\n");
-    fprintf(fp, "Process fluid density:\n");
-    fprintf(fp, "rho1 =\t%.3f\tkg/m3\n", rho1);
-    fprintf(fp, "Process fluid height:\n");
-    fprintf(fp, "h1 =\t%.3f\tm\n", h1);
-    fprintf(fp, "\tManometer Fluid:\n");
-    fprintf(fp, "P2 =\t%.3f\tkPa_abs\n", P2*0.001);
-    fprintf(fp, "Process fluid density:\n");
-    fprintf(fp, "rho2 =\t%.3f\tkg/m3\n", rho2);
-    fprintf(fp, "Process fluid height:\n");
-    fprintf(fp, "h2 =\t%.3f\tm\n\n", h2);
-    
-    fprintf(fp, "_Output_Values:_\n");
-    fprintf(fp, "P1 =\t%.3f\tkPa_abs\t= P2 + g(\\rho_2h_2 - \\rho_1h_1)\n", P1*0.001);
+    writerPrintf(&w, "_Manometer_Measurement_Calculations_\n\n");
+    writerPrintf(&w, "_Input_Parameters:_\n");
+    writerPrintf(&w, "\tProcess Fluid:\n");
+    writerPrintf(&w, "Process fluid density:\n");
+    writerPrintf(&w, "rho1 =\t%.3f\tkg/m3\n", rho1);
+    writerPrintf(&w, "Process fluid height:\n");
+    writerPrintf(&w, "h1 =\t%.3f\tm\n", h1);
+    writerPrintf(&w, "\tManometer Fluid:\n");
+    writerPrintf(&w, "P2 =\t%.3f\tkPa_abs\n", P2*0.001);
+    writerPrintf(&w, "Process fluid density:\n");
+    writerPrintf(&w, "rho2 =\t%.3f\tkg/m3\n", rho2);
+    writerPrintf(&w, "Process fluid height:\n");
+    writerPrintf(&w, "h2 =\t%.3f\tm\n\n", h2);
+    
+    writerPrintf(&w, "_Output_Values:_\n");
+    writerPrintf(&w, "P1 =\t%.3f\tkPa_abs\t= P2 + g(\\rho_2h_2 - \\rho_1h_1)\n", P1*0.001);
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void ManoEstiWriteSwitch(double P1, double P2, double rho1, double h1, double rho2, double h2)
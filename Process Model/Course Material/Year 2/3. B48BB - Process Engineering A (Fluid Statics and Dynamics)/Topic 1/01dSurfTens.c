@@ -29,6 +29,7 @@
 
 //  Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BB_T1.h"
 #include "01dSurfTens.h"
 
@@ -220,74 +221,30 @@ void duNouyDisplay(double F, double L, double C_F, double cang, double sigma)
 void duNouyWrite(double F, double L, double C_F, double cang, double sigma)
 {
     //  Function variables
-    char filename[maxstrlen];   // Character array used to store file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
     //  Set file name as timestamp + du Nouy
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " du Nouy");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-    *filepath = (char)malloc(sizeof *filepath);
-    
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-    printf("File path: \"%s\"\n", filepath);
-    
-    strcat(filepath, filename);
-    void free(void *filename);
-    
-    printf("File name: \"%s\"\n", filename);
-    printf("Full file path: \"%s\"\n\n", filepath);
-    
-    //Testing if directory is not present
-    
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, "du Nouy"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
-    fprintf(fp, "_du_Nouy_Surface_Tension_\n");
-    fprintf(fp, "\tInput Parameters:\n");
-    fprintf(fp, "Force required to break fluid surface:\n");
-    fprintf(fp, "F =\t%.3f\tN\n", F);
-    fprintf(fp, "Ring Circumference:\n");
-    fprintf(fp, "L =\t%.3f\tm3\n", L);
-    fprintf(fp, "Correction Factor:\n");
-    fprintf(fp, "C_F =\t%.3f\tmol\n", C_F);
-    fprintf(fp, "Contact angle:\n");
-    fprintf(fp, "phi =\t%.3f\trad\n\n", cang);
-    fprintf(fp, "\tOutput Parameters:\n");
-    fprintf(fp, "sigma =\t%.3f\tN/m\t= \\frac{(C_F)F}{2L\\cos\\phi}\n", sigma);
+    writerPrintf(&w, "_du_Nouy_Surface_Tension_\n");
+    writerPrintf(&w, "\tInput Parameters:\n");
+    writerPrintf(&w, "Force required to break fluid surface:\n");
+    writerPrintf(&w, "F =\t%.3f\tN\n", F);
+    writerPrintf(&w, "Ring Circumference:\n");
+    writerPrintf(&w, "L =\t%.3f\tm3\n", L);
+    writerPrintf(&w, "Correction Factor:\n");
+    writerPrintf(&w, "C_F =\t%.3f\tmol\n", C_F);
+    writerPrintf(&w, "Contact angle:\n");
+    writerPrintf(&w, "phi =\t%.3f\trad\n\n", cang);
+    writerPrintf(&w, "\tOutput Parameters:\n");
+    writerPrintf(&w, "sigma =\t%.3f\tN/m\t= \\frac{(C_F)F}{2L\\cos\\phi}\n", sigma);
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void duNouyWriteSwitch(double F, double L, double C_F, double cang, double sigma)
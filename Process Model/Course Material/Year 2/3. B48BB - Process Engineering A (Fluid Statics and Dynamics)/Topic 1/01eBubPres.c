@@ -29,6 +29,7 @@
 
 //  Custom header files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BB_T1.h"
 #include "01eBubPres.h"
 
@@ -76,71 +77,27 @@ void BubPresDisplay(double sigma, double r, double P)
 void BubPresWrite(double sigma, double r, double P)
 {
     //  Function variables
-    char filename[maxstrlen];   // Character array used to store file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
     //  Set file name as timestamp + Bubble Pressure Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Bubble Pressure Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-    *filepath = (char)malloc(sizeof *filepath);
-    
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-    printf("File path: \"%s\"\n", filepath);
-    
-    strcat(filepath, filename);
-    void free(void *filename);
-    
-    printf("File name: \"%s\"\n", filename);
-    printf("Full file path: \"%s\"\n\n", filepath);
-    
-    //Testing if directory is not present
-    
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, "Bubble Pressure Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
-    fprintf(fp, "_Bubble_Pressure_Calculations_\n");
-    fprintf(fp, "\tInput Parameters:\n");
-    fprintf(fp, "Surface tension:\n");
-    fprintf(fp, "sigma =\t%.3f\tN/m\n", sigma);
-    fprintf(fp, "Bubble radius:\n");
-    fprintf(fp, "r =\t%.3f\tmm\n\n", r*1000);
+    writerPrintf(&w, "_Bubble_Pressure_Calculations_\n");
+    writerPrintf(&w, "\tInput Parameters:\n");
+    writerPrintf(&w, "Surface tension:\n");
+    writerPrintf(&w, "sigma =\t%.3f\tN/m\n", sigma);
+    writerPrintf(&w, "Bubble radius:\n");
+    writerPrintf(&w, "r =\t%.3f\tmm\n\n", r*1000);
     
-    fprintf(fp, "\tOutput Parameters:\n");
-    fprintf(fp, "P =\t%.3f\tPa\t=\\frac{2\\sigma}{r}\n", P);
+    writerPrintf(&w, "\tOutput Parameters:\n");
+    writerPrintf(&w, "P =\t%.3f\tPa\t=\\frac{2\\sigma}{r}\n", P);
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void BubPresWriteSwitch(double sigma, double r, double P)
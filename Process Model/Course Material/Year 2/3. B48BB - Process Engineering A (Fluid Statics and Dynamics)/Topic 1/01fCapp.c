@@ -29,6 +29,7 @@
 
 //  Custom header files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BB_T1.h"
 #include "01dSurfTens.h"
 #include "01fCapp.h"
@@ -108,75 +109,30 @@ void CappDisplay(double sigma, double cang, double d, double h, double Pc)
 void CappWrite(double sigma, double cang, double d, double h, double Pc)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
-    
-    //  Set file name as timestamp + Capillarity Calculation Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Capillarity Calculations Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-    *filepath = (char)malloc(sizeof *filepath);
-    
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-    printf("File path: \"%s\"\n", filepath);
-    
-    strcat(filepath, filename);
-    void free(void *filename); // Removing 'filename' from the heap
-    
-    printf("File name: \"%s\"\n", filename);
-    printf("Full file path: \"%s\"\n\n", filepath);
-    
-    //Testing if directory is not present
-    
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    //  Set file name as timestamp + Capillarity Calculations Results
+    if(!writerOpen(&w, "Capillarity Calculations Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
-    fprintf(fp, "_Capillarity_Calculations_\n");
-    fprintf(fp, "\tInput Parameters:\n");
-    fprintf(fp, "Fluid surface tension:\n");
-    fprintf(fp, "sigma =\t%.3f\tN/m\n", sigma);
-    fprintf(fp, "Contact angle:\n");
-    fprintf(fp, "cang =\t%.3f\trad\n\n", cang);
-    
-    fprintf(fp, "\tOutput Parameters:\n");
-    fprintf(fp, "Capillary rise:\n");
-    fprintf(fp, "h =\t%.3f\tcm\t=\\frac{2\\sigma\\cos\\theta}{\\rho gr}\n",h*0.01);
-    fprintf(fp, "Capillary pressure:\n");
-    fprintf(fp, "Pc =\t%.3f\tPa\t=\\frac{2\\sigma\\cos\\theta}{r}\n",Pc);
+    writerPrintf(&w, "_Capillarity_Calculations_\n");
+    writerPrintf(&w, "\tInput Parameters:\n");
+    writerPrintf(&w, "Fluid surface tension:\n");
+    writerPrintf(&w, "sigma =\t%.3f\tN/m\n", sigma);
+    writerPrintf(&w, "Contact angle:\n");
+    writerPrintf(&w, "cang =\t%.3f\trad\n\n", cang);
+    
+    writerPrintf(&w, "\tOutput Parameters:\n");
+    writerPrintf(&w, "Capillary rise:\n");
+    writerPrintf(&w, "h =\t%.3f\tcm\t=\\frac{2\\sigma\\cos\\theta}{\\rho gr}\n",h*0.01);
+    writerPrintf(&w, "Capillary pressure:\n");
+    writerPrintf(&w, "Pc =\t%.3f\tPa\t=\\frac{2\\sigma\\cos\\theta}{r}\n",Pc);
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void CappWriteSwitch(double sigma, double cang, double d, double h, double Pc)
@@ -29,6 +29,7 @@
 
 //  Custom header files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BB_T2.h"
 #include "02aMassCon.h"
 
@@ -129,82 +130,43 @@ void MassConDisplay(double rho1, double rho2, double d1, double d2, double u1, d
 void MassConWrite(double rho1, double rho2, double d1, double d2, double u1, double u2, double q1, double q2, double m1, double m2)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
     //  Set file name as timestamp + Mass Conservation Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Mass Conservation Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, "Mass Conservation Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
-    fprintf(fp, "_Mass_Conservation_Principle_\n");
-    fprintf(fp, "Assuming the fluid is incompressible. \n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Initial fluid density:\n");
-    fprintf(fp, "rho1 =\t%.3f\tkg/m3\n", rho1);
-    fprintf(fp, "Final fluid density:\n");
-    fprintf(fp, "rho2 =\t%.3f\tkg/m3\n", rho2);
-    fprintf(fp, "Initial pipe diameter:\n");
-    fprintf(fp, "d1 =\t%.3f\tmm\n", d1*1000);
-    fprintf(fp, "Final pipe diameter:\n");
-    fprintf(fp, "d2 =\t%.3f\tmm\n", d2*1000);
-    fprintf(fp, "Initial fluid velocity:\n");
-    fprintf(fp, "u1 =\t%.3f\tm/s\n\n", u1);
+    writerPrintf(&w, "_Mass_Conservation_Principle_\n");
+    writerPrintf(&w, "Assuming the fluid is incompressible. \n");
+    writerPrintf(&w, "\tInput parameters:\n");
+    writerPrintf(&w, "Initial fluid density:\n");
+    writerPrintf(&w, "rho1 =\t%.3f\tkg/m3\n", rho1);
+    writerPrintf(&w, "Final fluid density:\n");
+    writerPrintf(&w, "rho2 =\t%.3f\tkg/m3\n", rho2);
+    writerPrintf(&w, "Initial pipe diameter:\n");
+    writerPrintf(&w, "d1 =\t%.3f\tmm\n", d1*1000);
+    writerPrintf(&w, "Final pipe diameter:\n");
+    writerPrintf(&w, "d2 =\t%.3f\tmm\n", d2*1000);
+    writerPrintf(&w, "Initial fluid velocity:\n");
+    writerPrintf(&w, "u1 =\t%.3f\tm/s\n\n", u1);
     
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "Final fluid velocity:\n");
-    fprintf(fp, "u2 =\t%.3f\tm/s\n", u2);
-    fprintf(fp, "Initial volumetric flowrate:\n");
-    fprintf(fp, "q1 =\t%.3f\tm3/s\n", q1);
-    fprintf(fp, "Final volumetric flowrate:\n");
-    fprintf(fp, "q2 =\t%.3f\tm3/s\n", q2);
-    fprintf(fp, "Initial mass flowrate:\n");
-    fprintf(fp, "m1 =\t%.3f\tkg/s\n", m1);
-    fprintf(fp, "Final mass flowrate:\n");
-    fprintf(fp, "m2 =\t%.3f\tkg/s\n\n", m2);
+    writerPrintf(&w, "\tOutput parameters:\n");
+    writerPrintf(&w, "Final fluid velocity:\n");
+    writerPrintf(&w, "u2 =\t%.3f\tm/s\n", u2);
+    writerPrintf(&w, "Initial volumetric flowrate:\n");
+    writerPrintf(&w, "q1 =\t%.3f\tm3/s\n", q1);
+    writerPrintf(&w, "Final volumetric flowrate:\n");
+    writerPrintf(&w, "q2 =\t%.3f\tm3/s\n", q2);
+    writerPrintf(&w, "Initial mass flowrate:\n");
+    writerPrintf(&w, "m1 =\t%.3f\tkg/s\n", m1);
+    writerPrintf(&w, "Final mass flowrate:\n");
+    writerPrintf(&w, "m2 =\t%.3f\tkg/s\n\n", m2);
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void MassConWriteSwitch(double rho1, double rho2, double d1, double d2, double u1, double u2, double q1, double q2, double m1, double m2)
@@ -29,6 +29,7 @@
 
 //  Custom header files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BB_T2.h"
 #include "02bEnerCon.h"
 
@@ -205,99 +206,60 @@ void EnerConDisplay(double h1, double h2, double u1, double u2, double z1, doubl
     fflush(stdout);
 }
 
-void EnerConWrite(double h1, double h2, double u1, double u2, double z1, double z2, double q, double w, double state1, double state2, double process, double check)
+void EnerConWrite(double h1, double h2, double u1, double u2, double z1, double z2, double q, double work, double state1, double state2, double process, double check)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
     //  Set file name as timestamp + Steady Flow Energy Equation Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Steady Flow Energy Equation Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, "Steady Flow Energy Equation Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
-    fprintf(fp, "_Steady-Flow_Energy_Equation_\n");
-    fprintf(fp, "Assuming the fluid is incompressible. \n");
-    fprintf(fp, "g =\t%.3f\tm/s2\n\n", g);
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Initial fluid enthalpy:\n");
-    fprintf(fp, "h1 =\t%.3f\tkJ/kg\n", h1*0.001);
-    fprintf(fp, "Final fluid enthalpy:\n");
-    fprintf(fp, "h2 =\t%.3f\tkJ/kg\n", h2*0.001);
-    fprintf(fp, "Initial fluid velocity:\n");
-    fprintf(fp, "u1 =\t%.3f\tm/s\n", u1);
-    fprintf(fp, "Final fluid velocity:\n");
-    fprintf(fp, "u2 =\t%.3f\tm/s\n", u2);
-    fprintf(fp, "Initial fluid height:\n");
-    fprintf(fp, "z1 =\t%.3f\tm\n", z1);
-    fprintf(fp, "Final fluid height:\n");
-    fprintf(fp, "z2 =\t%.3f\tm\n\n", z2);
-    
-    fprintf(fp, "Specific process heat:\n");
-    fprintf(fp, "q =\t%.3f\tkJ/kg\n", q*0.001);
-    fprintf(fp, "Specific process work:\n");
-    fprintf(fp, "w =\t%.3f\tkJ/kg\n\n", w*0.001);
-    
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "Energy content at state 1:\n");
-    fprintf(fp, "state1 =\t%.3f\tkJ/kg\n", state1*0.001);
-    fprintf(fp, "Energy content at state 2:\n");
-    fprintf(fp, "state2 =\t%.3f\tkJ/kg\n\n", state1*0.001);
-    
-    fprintf(fp, "Net process energy:\n");
-    fprintf(fp, "q + w =\t%.3f\tkJ/kg\n\n", process*0.001);
-    
-    fprintf(fp, "check =\t%.3f\tkJ/kg\n", check*0.001);
+    writerPrintf(&w, "_Steady-Flow_Energy_Equation_\n");
+    writerPrintf(&w, "Assuming the fluid is incompressible. \n");
+    writerPrintf(&w, "g =\t%.3f\tm/s2\n\n", g);
+    writerPrintf(&w, "\tInput parameters:\n");
+    writerPrintf(&w, "Initial fluid enthalpy:\n");
+    writerPrintf(&w, "h1 =\t%.3f\tkJ/kg\n", h1*0.001);
+    writerPrintf(&w, "Final fluid enthalpy:\n");
+    writerPrintf(&w, "h2 =\t%.3f\tkJ/kg\n", h2*0.001);
+    writerPrintf(&w, "Initial fluid velocity:\n");
+    writerPrintf(&w, "u1 =\t%.3f\tm/s\n", u1);
+    writerPrintf(&w, "Final fluid velocity:\n");
+    writerPrintf(&w, "u2 =\t%.3f\tm/s\n", u2);
+    writerPrintf(&w, "Initial fluid height:\n");
+    writerPrintf(&w, "z1 =\t%.3f\tm\n", z1);
+    writerPrintf(&w, "Final fluid height:\n");
+    writerPrintf(&w, "z2 =\t%.3f\tm\n\n", z2);
+    
+    writerPrintf(&w, "Specific process heat:\n");
+    writerPrintf(&w, "q =\t%.3f\tkJ/kg\n", q*0.001);
+    writerPrintf(&w, "Specific process work:\n");
+    writerPrintf(&w, "w =\t%.3f\tkJ/kg\n\n", work*0.001);
+    
+    writerPrintf(&w, "\tOutput parameters:\n");
+    writerPrintf(&w, "Energy content at state 1:\n");
+    writerPrintf(&w, "state1 =\t%.3f\tkJ/kg\n", state1*0.001);
+    writerPrintf(&w, "Energy content at state 2:\n");
+    writerPrintf(&w, "state2 =\t%.3f\tkJ/kg\n\n", state1*0.001);
+    
+    writerPrintf(&w, "Net process energy:\n");
+    writerPrintf(&w, "q + w =\t%.3f\tkJ/kg\n\n", process*0.001);
+    
+    writerPrintf(&w, "check =\t%.3f\tkJ/kg\n", check*0.001);
     
     if(fabs(check) <= 0.001)
     {
-        fprintf(fp, "Your process should work in reality\n");
+        writerPrintf(&w, "Your process should work in reality\n");
     }else{
-        fprintf(fp, "Your process is not at steady-state\n");
+        writerPrintf(&w, "Your process is not at steady-state\n");
     }
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void EnerConWriteSwitch(double h1, double h2, double u1, double u2, double z1, double z2, double q, double w, double state1, double state2, double process, double check)
@@ -98,12 +98,12 @@ void EnerConDisplay(double h1, double h2, double u1, double u2, double z1, doubl
 /// @param z1 Initial fluid height (m).
 /// @param z2 Final fluid height (m).
 /// @param q Process heat (J/ kg).
-/// @param w Process work (J/ kg).
+/// @param work Process work (J/ kg).
 /// @param state1 Total energy content at state 1 (J/kg).
 /// @param state2 Total energy content at state 2 (J/kg)
 /// @param process Net energy into/out of process (J/kg).
 /// @param check Value of inequality.
-void EnerConWrite(double h1, double h2, double u1, double u2, double z1, double z2, double q, double w, double state1, double state2, double process, double check);
+void EnerConWrite(double h1, double h2, double u1, double u2, double z1, double z2, double q, double work, double state1, double state2, double process, double check);
 
 /// Subroutine to ask the user if they would like to save the results of this program to a file.
 /// @param h1 Initial stream enthalpy (J/ kg).
@@ -29,6 +29,7 @@
 
 //  Custom header files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BB_T2.h"
 #include "02aMassCon.h"
 #include "02cBernEqn.h"
@@ -133,79 +134,40 @@ void BernEqnDisplay(double P1, double P2, double rho, double u1, double u2, doub
 void BernEqnWrite(double P1, double P2, double rho, double u1, double u2, double z1, double z2, double hf)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[4];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
     //  Set file name as timestamp + Bernoulli Equation Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Bernoulli Equation Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, "Bernoulli Equation Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
-    fprintf(fp, "_Bernoulli's_Equation_Results_\n");
-    fprintf(fp, "Assuming the fluid is incompressible. \n");
-    fprintf(fp, "g =\t%.3f\tm/s2\n\n", g);
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Initial fluid pressure:\n");
-    fprintf(fp, "P1 =\t%.3f\tkPa\n", P1*0.001);
-    fprintf(fp, "Fluid density:\n");
-    fprintf(fp, "rho =\t%.3f\tkg/m3\n", rho);
-    fprintf(fp, "Initial fluid velocity:\n");
-    fprintf(fp, "u1 =\t%.3f\tm/s\n", u1);
-    fprintf(fp, "Final fluid velocity:\n");
-    fprintf(fp, "u2 =\t%.3f\tm/s\n", u2);
-    fprintf(fp, "Initial fluid height:\n");
-    fprintf(fp, "z1 =\t%.3f\tm\n", z1);
-    fprintf(fp, "Final fluid height:\n");
-    fprintf(fp, "z2 =\t%.3f\tm\n", z2);
-    fprintf(fp, "Fluid frictional head loss:\n");
-    fprintf(fp, "hf =\t%.3f\tm\n\n", hf);
+    writerPrintf(&w, "_Bernoulli's_Equation_Results_\n");
+    writerPrintf(&w, "Assuming the fluid is incompressible. \n");
+    writerPrintf(&w, "g =\t%.3f\tm/s2\n\n", g);
+    writerPrintf(&w, "\tInput parameters:\n");
+    writerPrintf(&w, "Initial fluid pressure:\n");
+    writerPrintf(&w, "P1 =\t%.3f\tkPa\n", P1*0.001);
+    writerPrintf(&w, "Fluid density:\n");
+    writerPrintf(&w, "rho =\t%.3f\tkg/m3\n", rho);
+    writerPrintf(&w, "Initial fluid velocity:\n");
+    writerPrintf(&w, "u1 =\t%.3f\tm/s\n", u1);
+    writerPrintf(&w, "Final fluid velocity:\n");
+    writerPrintf(&w, "u2 =\t%.3f\tm/s\n", u2);
+    writerPrintf(&w, "Initial fluid height:\n");
+    writerPrintf(&w, "z1 =\t%.3f\tm\n", z1);
+    writerPrintf(&w, "Final fluid height:\n");
+    writerPrintf(&w, "z2 =\t%.3f\tm\n", z2);
+    writerPrintf(&w, "Fluid frictional head loss:\n");
+    writerPrintf(&w, "hf =\t%.3f\tm\n\n", hf);
     
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "Final fluid pressure:\n");
-    fprintf(fp, "P2 =\t%.3f\tkPa\n", P2*0.001);
+    writerPrintf(&w, "\tOutput parameters:\n");
+    writerPrintf(&w, "Final fluid pressure:\n");
+    writerPrintf(&w, "P2 =\t%.3f\tkPa\n", P2*0.001);
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void BernEqnWriteSwitch(double P1, double P2, double rho, double u1, double u2, double z1, double z2, double hf)
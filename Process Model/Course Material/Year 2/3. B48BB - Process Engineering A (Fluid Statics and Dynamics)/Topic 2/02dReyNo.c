@@ -29,6 +29,7 @@
 
 //  Custom header files
 #include "System.h"
+#include "ResultWriter.h"
 #include "DimensionlessNum.h"
 #include "B48BB_T2.h"
 #include "02dReyNo.h"
@@ -82,80 +83,41 @@ void ReyNoDisplay(double rho, double u, double d, double mu, double ReyNum)
 void ReyNoWrite(double rho, double u, double d, double mu, double ReyNum)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
     //  Set file name as timestamp + Reynolds Number Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Reynolds Number Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, "Reynolds Number Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
-    fprintf(fp, "_Reynold's_Number_Calculation_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Fluid density:\n");
-    fprintf(fp, "rho =\t%.3f\tkg/m3\n", rho);
-    fprintf(fp, "Fluid velocity:\n");
-    fprintf(fp, "u =\t%.3f\tm/s\n", u);
-    fprintf(fp, "Pipe internal diameter:");
-    fprintf(fp, "d =\t%.3f\tmm\n\n", d*1000);
-    fprintf(fp, "Fluid viscosity:\n");
-    fprintf(fp, "mu =\t%.3f\tcP\n", mu*1000);
-    
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "ReyNum =\t%.3f\t[ ]\t=\\frac{\\rho ud}{\\mu}\n", ReyNum);
+    writerPrintf(&w, "_Reynold's_Number_Calculation_\n");
+    writerPrintf(&w, "\tInput parameters:\n");
+    writerPrintf(&w, "Fluid density:\n");
+    writerPrintf(&w, "rho =\t%.3f\tkg/m3\n", rho);
+    writerPrintf(&w, "Fluid velocity:\n");
+    writerPrintf(&w, "u =\t%.3f\tm/s\n", u);
+    writerPrintf(&w, "Pipe internal diameter:");
+    writerPrintf(&w, "d =\t%.3f\tmm\n\n", d*1000);
+    writerPrintf(&w, "Fluid viscosity:\n");
+    writerPrintf(&w, "mu =\t%.3f\tcP\n", mu*1000);
+    
+    writerPrintf(&w, "\tOutput parameters:\n");
+    writerPrintf(&w, "ReyNum =\t%.3f\t[ ]\t=\\frac{\\rho ud}{\\mu}\n", ReyNum);
     if(ReyNum < 2000)
     {
-        fprintf(fp, "Flow regime is laminar \n");
+        writerPrintf(&w, "Flow regime is laminar \n");
     }else{
         if(ReyNum <3000){
-            fprintf(fp, "Flow regime lies within the transition region. Consider using experimental data going forward.\n");
+            writerPrintf(&w, "Flow regime lies within the transition region. Consider using experimental data going forward.\n");
         }else{
-            fprintf(fp, "Flow regime is turbulent. \n");
+            writerPrintf(&w, "Flow regime is turbulent. \n");
         }
     }
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void ReyNoWriteSwitch(double rho, double u, double d, double mu, double ReyNum)
@@ -29,6 +29,7 @@
 
 //  Custom header files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BB_T2.h"
 #include "02fViscCorr.h"
 
@@ -146,85 +147,47 @@ void ViscDisplay(int method, double a, double b, double T, double rho, double mu
 void ViscWrite(int method, double a, double b, double T, double rho, double mu, double upsi)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
+    const char *title = "Viscosity Correlation Results";    // Text following the timestamp in the file name.
     
-    FILE *fp;                   // Pointer to the file location.
     //  Set file name as timestamp + ... Viscosity Correlation Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
     if(method == 1){
-        strcat(filename, " Liquid Viscosity Correlation Results");
-        //printf("File name: \"%s\"\n", filename);
+        title = "Liquid Viscosity Correlation Results";
     }
     if(method == 2){
-        strcat(filename, " Vapour Viscosity Correlation Results");
-        //printf("File name: \"%s\"\n", filename);
+        title = "Vapour Viscosity Correlation Results";
     }
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-    
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, title))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
     if(method == 1){
-        fprintf(fp, "_Liquid_Viscosity_Correlation_\n");
+        writerPrintf(&w, "_Liquid_Viscosity_Correlation_\n");
     }
     if(method == 2){
-        fprintf(fp, "_Vapour_Viscosity_Correlation_\n");
+        writerPrintf(&w, "_Vapour_Viscosity_Correlation_\n");
     }
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "a =\t%.3f\n", a);
-    fprintf(fp, "b =\t%.3f\n", b);
-    fprintf(fp, "Temperature:\n");
-    fprintf(fp, "T =\t%.3f\t\n", T);
-    fprintf(fp, "Fluid density:\n");
-    fprintf(fp, "rho =\t%.3f\tkg/m3\n\n", rho);
+    writerPrintf(&w, "\tInput parameters:\n");
+    writerPrintf(&w, "a =\t%.3f\n", a);
+    writerPrintf(&w, "b =\t%.3f\n", b);
+    writerPrintf(&w, "Temperature:\n");
+    writerPrintf(&w, "T =\t%.3f\t\n", T);
+    writerPrintf(&w, "Fluid density:\n");
+    writerPrintf(&w, "rho =\t%.3f\tkg/m3\n\n", rho);
     
-    fprintf(fp, "\tOutput parameters:\n");
+    writerPrintf(&w, "\tOutput parameters:\n");
     if(method == 1){
-        fprintf(fp, "mu =\t%.3f\t...\t=ae^{\\frac{b}{T}}\n", mu);
+        writerPrintf(&w, "mu =\t%.3f\t...\t=ae^{\\frac{b}{T}}\n", mu);
     }
     if(method == 2){
-        fprintf(fp, "mu =\t%.3f\t...\t=\\frac{aT^{1.5}}{(b + T)\n", mu);
+        writerPrintf(&w, "mu =\t%.3f\t...\t=\\frac{aT^{1.5}}{(b + T)\n", mu);
     }
-    fprintf(fp, "upsilon =\t%.3f\t...\t=\\frac{\\mu}{\\rho}\n", upsi);
+    writerPrintf(&w, "upsilon =\t%.3f\t...\t=\\frac{\\mu}{\\rho}\n", upsi);
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void ViscWriteSwitch(int method, double a, double b, double T, double rho, double mu, double upsi)
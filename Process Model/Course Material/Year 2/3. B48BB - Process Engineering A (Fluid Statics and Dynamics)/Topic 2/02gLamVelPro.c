@@ -29,6 +29,7 @@
 
 //  Custom header files
 #include "System.h"
+#include "ResultWriter.h"
 #include "02gLamVelPro.h"
 
 /// MARK: SUBROUTINE DEFINITIONS
@@ -143,76 +144,38 @@ void LamVelProDisplay(double dP, double L, double d, double mu, int rows, LamVel
 void LamVelProWrite(double dP, double L, double d, double mu, int rows, LamVelProf profile)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
-    //  Set file name as timestamp + Laminar Velocity Profile Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
+    WriterColumn cols[3] = {
+        {"r", "mm", profile.r, 1, WriterFixed, 3, 1000.0, 0.0},
+        {"v_x", "m/s", profile.v_x, 1, WriterFixed, 5, 1.0, 0.0},
+        {"v_x/v_{max}", NULL, profile.ratio, 1, WriterFixed, 5, 1.0, 0.0}
+    };
     
-    strcat(filename, " Laminar Velocity Profile Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    //  Set file name as timestamp + Laminar Velocity Profile Results
+    if(!writerOpen(&w, "Laminar Velocity Profile Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
-    fprintf(fp, "_Laminar_Velocity_Profile_Calculation_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Fluid pressure loss:\n");
-    fprintf(fp, "dP =\t%.3f\tPa\n", dP);
-    fprintf(fp, "Pipe length:\n");
-    fprintf(fp, "L =\t%.3f\tm\n", L);
-    fprintf(fp, "Pipe diameter:\n");
-    fprintf(fp, "d =\t%.3f\tmm\n", d*1000);
-    fprintf(fp, "Fluid dynamic viscosity:\n");
-    fprintf(fp, "mu =\t%.3f\tcP\n\n", mu*1000);
+    writerText(&w, "_Laminar_Velocity_Profile_Calculation_\n");
+    writerText(&w, "\tInput parameters:\n");
+    writerText(&w, "Fluid pressure loss:\n");
+    writerValue(&w, "dP =", dP, 3, "Pa");
+    writerText(&w, "Pipe length:\n");
+    writerValue(&w, "L =", L, 3, "m");
+    writerText(&w, "Pipe diameter:\n");
+    writerValue(&w, "d =", d*1000, 3, "mm");
+    writerText(&w, "Fluid dynamic viscosity:\n");
+    writerValue(&w, "mu =", mu*1000, 3, "cP");
+    writerEnd(&w);
     
-    fprintf(fp, "\tOutput Parameters:\n");
-    fprintf(fp, "r (mm)\tv_x (m/s)\tv_x/v_{max}\n");
-    for(int i = 0; i < rows; ++i)
-    {
-        fprintf(fp, "%.3f\t", 1000*profile.r[i]);
-        fprintf(fp, "%.5f\t", profile.v_x[i]);
-        fprintf(fp, "%.5f\n", profile.ratio[i]);
-    }
+    writerText(&w, "\tOutput Parameters:\n");
+    writerTable(&w, 3, cols, rows);
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void LamVelProSwitch(int mode, double dP, double L, double d, double mu, int rows, LamVelProf profile)
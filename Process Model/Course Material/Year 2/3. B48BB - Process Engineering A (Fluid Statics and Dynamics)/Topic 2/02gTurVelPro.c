@@ -29,6 +29,7 @@
 
 //  Custom header files
 #include "System.h"
+#include "ResultWriter.h"
 #include "02gTurVelPro.h"
 
 /// MARK: SUBROUTINE DEFINITIONS
@@ -122,72 +123,33 @@ void TurVelProDisplay(double umax, double d, int rows, TurVelProf profile)
 void TurVelProWrite(double umax, double d, int rows, TurVelProf profile)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
-    //  Set file name as timestamp + Turbulent Velocity Profile Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
+    WriterColumn cols[3] = {
+        {"r", "mm", profile.r, 1, WriterFixed, 3, 1000.0, 0.0},
+        {"v_x", "m/s", profile.v_x, 1, WriterFixed, 5, 1.0, 0.0},
+        {"v_x/v_{max}", NULL, profile.ratio, 1, WriterFixed, 5, 1.0, 0.0}
+    };
     
-    strcat(filename, " Turbulent Velocity Profile Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    //  Set file name as timestamp + Turbulent Velocity Profile Results
+    if(!writerOpen(&w, "Turbulent Velocity Profile Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
-    fprintf(fp, "_Turbulent_Velocity_Profile_(Prandtl's_One-Seventh_Law)_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Maximum fluid velocity:\n");
-    fprintf(fp, "u_{max.} =\t%.3f\tm/s\n", umax);
-    fprintf(fp, "Pipe diameter:\n");
-    fprintf(fp, "d =\t%.3f\tmm\n", d*1000);
+    writerText(&w, "_Turbulent_Velocity_Profile_(Prandtl's_One-Seventh_Law)_Results_\n");
+    writerText(&w, "\tInput parameters:\n");
+    writerText(&w, "Maximum fluid velocity:\n");
+    writerValue(&w, "u_{max.} =", umax, 3, "m/s");
+    writerText(&w, "Pipe diameter:\n");
+    writerValue(&w, "d =", d*1000, 3, "mm");
     
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "r (mm)\tv_x (m/s)\tv_x/v_{max}\n");
-    for(int i = 0; i < rows; ++i)
-    {
-        fprintf(fp, "%.3f\t", 1000*profile.r[i]);
-        fprintf(fp, "%.5f\t", profile.v_x[i]);
-        fprintf(fp, "%.5f\n", profile.ratio[i]);
-    }
+    writerText(&w, "\tOutput parameters:\n");
+    writerTable(&w, 3, cols, rows);
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void TurVelProSwitch(int mode, double umax, double d, int rows, TurVelProf profile)
@@ -29,6 +29,7 @@
 
 //  Custom header files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BB_T2.h"
 #include "02hHagPois.h"
 
@@ -93,72 +94,33 @@ void HagPoisDisplay(double u, double mu, double L, double d, double dP)
 void HagPoisWrite(double u, double mu, double L, double d, double dP)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
     //  Set file name as timestamp + Hagen-Poiseuille Equation Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Hagen-Poiseuille Equation Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, "Hagen-Poiseuille Equation Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
-    fprintf(fp, "_Hagen-Pouseuille_Equation_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Fluid velocity:\n");
-    fprintf(fp, "u =\t%.3f\tm/s\n", u);
-    fprintf(fp, "Fluid viscosity:\n");
-    fprintf(fp, "mu =\t%.3f\tcP\n", mu*1000);
-    fprintf(fp, "Pipe length:\n");
-    fprintf(fp, "L =\t%.3f\tm\n", L);
-    fprintf(fp, "Pipe diameter:\n");
-    fprintf(fp, "d =\t%.3f\tmm\n\n", d*1000);
-    
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "Assuming fluid flow is isothermal\n");
-    fprintf(fp, "Fluid pressure loss:\n");
-    fprintf(fp, "dP =\t%.3f\tPa\t= \\frac{32u\\mu L}{d^2}", dP);
+    writerPrintf(&w, "_Hagen-Pouseuille_Equation_Results_\n");
+    writerPrintf(&w, "\tInput parameters:\n");
+    writerPrintf(&w, "Fluid velocity:\n");
+    writerPrintf(&w, "u =\t%.3f\tm/s\n", u);
+    writerPrintf(&w, "Fluid viscosity:\n");
+    writerPrintf(&w, "mu =\t%.3f\tcP\n", mu*1000);
+    writerPrintf(&w, "Pipe length:\n");
+    writerPrintf(&w, "L =\t%.3f\tm\n", L);
+    writerPrintf(&w, "Pipe diameter:\n");
+    writerPrintf(&w, "d =\t%.3f\tmm\n\n", d*1000);
+    
+    writerPrintf(&w, "\tOutput parameters:\n");
+    writerPrintf(&w, "Assuming fluid flow is isothermal\n");
+    writerPrintf(&w, "Fluid pressure loss:\n");
+    writerPrintf(&w, "dP =\t%.3f\tPa\t= \\frac{32u\\mu L}{d^2}", dP);
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void HagPoisWriteSwitch(double u, double mu, double L, double d, double dP)
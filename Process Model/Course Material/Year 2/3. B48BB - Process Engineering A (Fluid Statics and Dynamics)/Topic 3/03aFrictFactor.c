@@ -167,3 +167,77 @@ double Turbulent4(double d, double vareps)
     
     return FrictFactor;
 }
+
+/// This subroutine is used to solve the relative roughness form of "Turbulent3(...)" by Newton's method and find the derivative of the friction factor with respect to Reynolds number.
+static double FrictFactorTurbulent(double Re, double releps, double *dphi)
+{
+    double x = 0.0;     // 1/sqrt(phi)
+    double a = 0.0;     // Roughness term.
+    double b = 0.0;     // Reynolds number term.
+    double f = 0.0;     // Residual.
+    double df = 0.0;    // Residual derivative.
+    double dxdRe = 0.0;
+    
+    //  1/sqrt(phi) = -2.5 ln(0.27 vareps/d + 0.885/(Re sqrt(phi)))
+    a = 0.27*releps;
+    b = 0.885/Re;
+    
+    //  Initial guess taken from the Blasius type relation in "Turbulent1(...)".
+    x = pow(Re, (-0.25));
+    x = 0.0396*(x);
+    x = 1/sqrt(x);
+    
+    for(int i = 0; i < 50; ++i){
+        f = x + 2.5*log(a + b*x);
+        df = 1 + 2.5*b/(a + b*x);
+        
+        f = (f)/(df);
+        x = x - (f);
+        if(fabs(f) < 1e-12*x){
+            break;
+        }
+    }
+    
+    //  f(x, Re) = x + 2.5 ln(a + b x) = 0, so dx/dRe = -(df/dRe)/(df/dx).
+    dxdRe = 2.5*b*x/(Re*(a + b*x));
+    dxdRe = (dxdRe)/(1 + 2.5*b/(a + b*x));
+    
+    *dphi = -2*(dxdRe)/(x*x*x);
+    
+    return 1/(x*x);
+}
+
+double FrictFactorSolve(double Re, double releps)
+{
+    double dphi = 0.0;
+    
+    return FrictFactorDerivative(Re, releps, &dphi);
+}
+
+double FrictFactorDerivative(double Re, double releps, double *dphi)
+{
+    double phi0 = 0.0;  // Laminar friction factor at Re = 2000.
+    double m0 = 0.0;
+    double phi1 = 0.0;  // Turbulent friction factor at Re = 4000.
+    double m1 = 0.0;
+    double t = 0.0;
+    double span = 2000;
+    
+    if(Re < 2000){
+        *dphi = -8.0/(Re*Re);
+        return (8.0)/(Re);
+    }
+    if(Re >= 4000){
+        return FrictFactorTurbulent(Re, releps, dphi);
+    }
+    
+    //  Cubic Hermite bridge between the laminar and turbulent relations, matching value and slope at each end.
+    phi0 = 8.0/2000;
+    m0 = -8.0/(2000.0*2000.0);
+    phi1 = FrictFactorTurbulent(4000, releps, &m1);
+    t = (Re - 2000)/span;
+    
+    *dphi = (6*t*t - 6*t)*phi0/span + (3*t*t - 4*t + 1)*m0 + (-6*t*t + 6*t)*phi1/span + (3*t*t - 2*t)*m1;
+    
+    return (2*t*t*t - 3*t*t + 1)*phi0 + (t*t*t - 2*t*t + t)*span*m0 + (-2*t*t*t + 3*t*t)*phi1 + (t*t*t - t*t)*span*m1;
+}
@@ -77,3 +77,24 @@ double Turbulent3(double rho, double u, double d, double mu, double vareps);
 double Turbulent4(double d, double vareps);
 
 #endif /* Turbulent4_h */
+
+#ifndef FrictFactorSolve_h
+#define FrictFactorSolve_h
+
+/// This subroutine is used to calculate the friction factor without user interaction so that it can be called inside batch calculations. The laminar relation is used below Re = 2000 and the relative roughness form of "Turbulent3(...)" is solved with Newton's method above Re = 4000. A cubic bridge joins the two through the transition region so that the friction factor and its derivative are continuous. Smooth pipe is given by releps = 0.
+/// @param Re Reynolds number ([ ])
+/// @param releps Relative roughness, vareps/d ([ ])
+double FrictFactorSolve(double Re, double releps);
+
+#endif /* FrictFactorSolve_h */
+
+#ifndef FrictFactorDerivative_h
+#define FrictFactorDerivative_h
+
+/// This subroutine is used to calculate the friction factor from "FrictFactorSolve(...)" together with its analytic derivative with respect to the Reynolds number. The turbulent derivative is found by implicit differentiation of the friction factor relation. The friction factor is returned to the calling function.
+/// @param Re Reynolds number ([ ])
+/// @param releps Relative roughness, vareps/d ([ ])
+/// @param dphi Derivative of the friction factor with respect to Reynolds number ([ ])
+double FrictFactorDerivative(double Re, double releps, double *dphi);
+
+#endif /* FrictFactorDerivative_h */
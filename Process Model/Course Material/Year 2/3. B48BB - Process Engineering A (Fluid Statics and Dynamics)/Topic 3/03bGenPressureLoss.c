@@ -29,6 +29,7 @@
 
 //  Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "DimensionlessNum.h"
 #include "B48BB_T3.h"
 #include "03bGenPressureLoss.h"
@@ -192,84 +193,45 @@ void PressLossDisplay(double rho, double u, double d, double mu, double L, doubl
 void PressLossWrite(double rho, double u, double d, double mu, double L, double vareps, double phi, double dP)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
     //  Set file name as timestamp + Pressure Loss Equation Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Pressure Loss Equation Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, "Pressure Loss Equation Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
-    fprintf(fp, "_Pressure_Loss_Equation_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Fluid density:\n");
-    fprintf(fp, "rho =\t%.3f\tkg/m3\n", rho);
-    fprintf(fp, "Fluid velocity:\n");
-    fprintf(fp, "u =\t%.3f\tm/s\n", u);
-    fprintf(fp, "Fluid viscosity:\n");
-    fprintf(fp, "mu =\t%.3f\tPa.s\n\n", mu);
+    writerPrintf(&w, "_Pressure_Loss_Equation_Results_\n");
+    writerPrintf(&w, "\tInput parameters:\n");
+    writerPrintf(&w, "Fluid density:\n");
+    writerPrintf(&w, "rho =\t%.3f\tkg/m3\n", rho);
+    writerPrintf(&w, "Fluid velocity:\n");
+    writerPrintf(&w, "u =\t%.3f\tm/s\n", u);
+    writerPrintf(&w, "Fluid viscosity:\n");
+    writerPrintf(&w, "mu =\t%.3f\tPa.s\n\n", mu);
     
-    fprintf(fp, "Pipe diameter:\n");
-    fprintf(fp, "d =\t%.3f\tmm\n", d*1000);
-    fprintf(fp, "Pipe length:\n");
-    fprintf(fp, "L =\t%.3f\tm\n", L);
+    writerPrintf(&w, "Pipe diameter:\n");
+    writerPrintf(&w, "d =\t%.3f\tmm\n", d*1000);
+    writerPrintf(&w, "Pipe length:\n");
+    writerPrintf(&w, "L =\t%.3f\tm\n", L);
     if(vareps == 0.0){
-        fprintf(fp, "Pipe absolute roughness not used\n\n");
+        writerPrintf(&w, "Pipe absolute roughness not used\n\n");
     }else{
-        fprintf(fp, "Pipe absolute roughness:\n");
-        fprintf(fp, "vareps =\t%.3f\tmm\n\n", vareps*1000);
+        writerPrintf(&w, "Pipe absolute roughness:\n");
+        writerPrintf(&w, "vareps =\t%.3f\tmm\n\n", vareps*1000);
     }
     
-    fprintf(fp, "\tIntermediate parameters:\n");
-    fprintf(fp, "Friction factor:\n");
-    fprintf(fp, "phi =\t%.3f\t[]\n", phi);
+    writerPrintf(&w, "\tIntermediate parameters:\n");
+    writerPrintf(&w, "Friction factor:\n");
+    writerPrintf(&w, "phi =\t%.3f\t[]\n", phi);
     
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "Fluid pressure loss:\n");
-    fprintf(fp, "dP =\t%.3f\tPa\n", dP);
+    writerPrintf(&w, "\tOutput parameters:\n");
+    writerPrintf(&w, "Fluid pressure loss:\n");
+    writerPrintf(&w, "dP =\t%.3f\tPa\n", dP);
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void PressLossWriteSwitch(double rho, double u, double d, double mu, double L, double vareps, double phi, double dP)
@@ -29,6 +29,7 @@
 
 //  Custom header files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BB_T3.h"
 #include "03cHydrDiam.h"
 
@@ -85,67 +86,28 @@ void HydrDiamDisplay(double A_F, double P_W, double d_H)
 void HydrDiamWrite(double A_F, double P_W, double d_H)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
     //  Set file name as timestamp + Hydraulic Diameter Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Hydraulic Diameter Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, "Hydraulic Diameter Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
-    fprintf(fp, "_Hydraulic_Diameter_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Cross-sectional flow area:\n");
-    fprintf(fp, "A_F =\t%.3f\tmm2\n", A_F*pow(1000,2));
-    fprintf(fp, "Wetted perimeter:\n");
-    fprintf(fp, "P_W =\t%.3f\tcm\n\n", P_W*100);
+    writerPrintf(&w, "_Hydraulic_Diameter_Results_\n");
+    writerPrintf(&w, "\tInput parameters:\n");
+    writerPrintf(&w, "Cross-sectional flow area:\n");
+    writerPrintf(&w, "A_F =\t%.3f\tmm2\n", A_F*pow(1000,2));
+    writerPrintf(&w, "Wetted perimeter:\n");
+    writerPrintf(&w, "P_W =\t%.3f\tcm\n\n", P_W*100);
     
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "Hydraulic diameter:\n");
-    fprintf(fp, "d_H =\t%.3f\tmm\n", d_H*1000);
+    writerPrintf(&w, "\tOutput parameters:\n");
+    writerPrintf(&w, "Hydraulic diameter:\n");
+    writerPrintf(&w, "d_H =\t%.3f\tmm\n", d_H*1000);
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void HydrDiamWriteSwitch(double A_F, double P_W, double d_H)
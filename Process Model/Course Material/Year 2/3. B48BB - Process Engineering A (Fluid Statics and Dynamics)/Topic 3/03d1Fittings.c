@@ -29,6 +29,7 @@
 #include "03dTwoK.h"
 #include "03dThreeK.h"
 #include "03dEquivLeng.h"
+#include "03dFittingsLoss.h"
 
 #define maxstrlen 128
 
@@ -52,6 +53,7 @@ void Fittings()
             printf("2. 2K (Lost velocity heads)\n");
             printf("3. 3K (Lost velocity heads) (Recommended for NPS > NPS 12)\n");
             printf("4. Equivalent length\n");
+            printf("5. Line list (mixed methods)\n");
             printf("Selection: ");
             fgets(input, sizeof(input), stdin);
             switch(input[0])
@@ -72,6 +74,10 @@ void Fittings()
                     EquivalentLength();
                     whilside = 0;
                     break;
+                case '5':
+                    FittingsLoss();
+                    whilside = 0;
+                    break;
                 default:
                     printf("Input not recognised\n");
                     break;
@@ -29,6 +29,7 @@
 
 //  Custom header files
 #include "System.h"
+#include "ResultWriter.h"
 #include "03dEquivLeng.h"
 #include "03bGenPressureLoss.h"
 
@@ -37,34 +38,37 @@
 #define g 9.80665
 
 /// MARK: DATABANK
-EquivLenFits EquivLengData(EquivLenFits input)
+static const EquivLengDatabase EquivLengDatabank = {
+    .name = {
+        "Standard 45 deg elbow",
+        "90 deg elbow standard radius",
+        "90 deg square elbow",
+        "Entry from leg T-piece",
+        "Entry into leg T-piece",
+        "Sudden Reduction (Tank outlet)",
+        "Sudden Expansion (Tank Inlet)",
+        "Unions and Couplings",
+        "Globe valve fully open",
+        "Gate valve (100 pct)",
+        "Gate valve (75 pct)",
+        "Gate valve (50 pct)",
+        "Gate valve (25 pct)",
+        "Ball valve (100 pct)",
+        "Plug valve open"
+    },
+    .LeD = {15, 35, 75, 60, 90, 25, 50, 2, 450, 7.5, 40, 200, 800, 18, 18}
+};
+
+const EquivLengDatabase *EquivLengData(void)
 {
-    input.data[0] = 15;
-    input.data[1] = 35;
-    input.data[2] = 75;
-    input.data[3] = 60;
-    input.data[4] = 90;
-    input.data[5] = 25;
-    input.data[6] = 50;
-    input.data[7] = 2;
-    input.data[8] = 450;
-    input.data[9] = 7.5;
-    input.data[10] = 40;
-    input.data[11] = 200;
-    input.data[12] = 800;
-    input.data[13] = 18;
-    input.data[14] = 18;
-    
-    return input;
+    return &EquivLengDatabank;
 }
 
 /// MARK: VARIABLE INPUT
-EquivLenFits EquivLengVariable(EquivLenFits data, double *rho, double *u, double *d, double *mu, double *vareps, double *phi)
+void EquivLengVariable(EquivLenFits *data, double *rho, double *u, double *d, double *mu, double *vareps, double *phi)
 {
     char input[maxstrlen];  // Variable used to store keyboard input.
-    
-    //  Loading database into the data struct
-    data = EquivLengData(data);
+    const EquivLengDatabase *db = EquivLengData();
     
     //  Gathering data needed to calculate phi
     *rho = inputDouble(0, 0, "fluid density", "kg/m3");
@@ -84,52 +88,11 @@ EquivLenFits EquivLengVariable(EquivLenFits data, double *rho, double *u, double
     
     //  Getting counts
     printf("\nPlease enter the counts of each fitting:\n");
-    printf("Standard 45 deg elbow: ");
-    data.count[0] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("90 deg elbow standard radius: ");
-    data.count[1] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("90 deg square elbow: ");
-    data.count[2] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Entry from leg T-piece: ");
-    data.count[3] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Entry into leg T-piece: ");
-    data.count[4] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Sudden Reduction (Tank outlet): ");
-    data.count[5] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Sudden Expansion (Tank Inlet): ");
-    data.count[6] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Unions and Couplings: ");
-    data.count[7] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Globe valve fully open: ");
-    data.count[8] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Gate valve (100 pct): ");
-    data.count[9] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Gate valve (75 pct): ");
-    data.count[10] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Gate valve (50 pct): ");
-    data.count[11] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Gate valve (25 pct): ");
-    data.count[12] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Ball valve (100 pct): ");
-    data.count[13] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Plug valve open: ");
-    data.count[14] = atoi(fgets(input, sizeof(input), stdin));
-    
-    return data;
+    for(int i = 0; i < EquivLengCount; ++i)
+    {
+        printf("%s: ", db->name[i]);
+        data->count[i] = atoi(fgets(input, sizeof(input), stdin));
+    }
 }
 
 /// MARK: GENERAL CALCULATIONS
@@ -161,19 +124,28 @@ double EquivLengCalculateLoss(int count, double phi, double L_e, double rho, dou
 }
 
 /// MARK: ARRAY FUNCTION
-EquivLenFits EquivLengFinalTable(EquivLenFits data, double rho, double u, double d, double phi)
+void EquivLengFinalTable(EquivLenFits *data, double rho, double u, double phi)
 {
-    for(int i = 0; i < 15; ++i){
-        data.dP_f[i] = EquivLengCalculateLoss(data.count[i], phi, EquivLengCalculateL_e(data.data[i], d), rho, u, d);
-        data.h_f[i] = (data.dP_f[i])/(rho*g);
+    const EquivLengDatabase *db = EquivLengData();
+    double dPunit = 0.0;    // Pressure loss per unit L_e/d (Pa).
+    
+    //  dP_f = 8 phi (L_e/d) (rho u^2/2). L_e/d is taken straight from the database.
+    dPunit = pow(u, 2);
+    dPunit = rho*(dPunit);
+    dPunit = (dPunit)/2;
+    dPunit = 8*phi*(dPunit);
+    
+    for(int i = 0; i < EquivLengCount; ++i)
+    {
+        data->dP_f[i] = data->count[i]*db->LeD[i]*dPunit;
+        data->h_f[i] = (data->dP_f[i])/(rho*g);
     }
-    return data;
 }
 
 /// MARK: DISPLAY AND WRITE
-void EquivLengDisplay(EquivLenFits table, double rho, double u, double d, double mu, double vareps, double phi, double totalP, double totalh)
+void EquivLengDisplay(const EquivLenFits *table, double rho, double u, double d, double mu, double vareps, double phi, double totalP, double totalh)
 {
-    int i = 0;
+    const EquivLengDatabase *db = EquivLengData();
     
     printf("Fluid density:\n");
     printf("rho =\t%.3f\tkg/m3\n", rho);
@@ -201,305 +173,72 @@ void EquivLengDisplay(EquivLenFits table, double rho, double u, double d, double
     
     printf("Fitting\tL_e/d\tCount\tdP_f (Pa)\th_L (m)\n");
     
-    i = 0;
-    printf("Standard 45 deg elbow\t");
-    printf("%.1f\t", table.data[i]);
-    printf("%i\t", table.count[i]);
-    printf("%.3f\t", table.dP_f[i]);
-    printf("%.3f\n", table.h_f[i]);
-    ++i;
-    
-    printf("90 deg elbow standard radius\t");
-    printf("%.1f\t", table.data[i]);
-    printf("%i\t", table.count[i]);
-    printf("%.3f\t", table.dP_f[i]);
-    printf("%.3f\n", table.h_f[i]);
-    ++i;
-    
-    printf("90 deg square elbow\t");
-    printf("%.1f\t", table.data[i]);
-    printf("%i\t", table.count[i]);
-    printf("%.3f\t", table.dP_f[i]);
-    printf("%.3f\n", table.h_f[i]);
-    ++i;
-    
-    printf("Entry from leg T-piece\t");
-    printf("%.1f\t", table.data[i]);
-    printf("%i\t", table.count[i]);
-    printf("%.3f\t", table.dP_f[i]);
-    printf("%.3f\n", table.h_f[i]);
-    ++i;
-    
-    printf("Entry into leg T-piece\t");
-    printf("%.1f\t", table.data[i]);
-    printf("%i\t", table.count[i]);
-    printf("%.3f\t", table.dP_f[i]);
-    printf("%.3f\n", table.h_f[i]);
-    ++i;
-    
-    printf("Sudden Reduction (Tank outlet)\t");
-    printf("%.1f\t", table.data[i]);
-    printf("%i\t", table.count[i]);
-    printf("%.3f\t", table.dP_f[i]);
-    printf("%.3f\n", table.h_f[i]);
-    ++i;
-    
-    printf("Sudden Expansion (Tank Inlet)\t");
-    printf("%.1f\t", table.data[i]);
-    printf("%i\t", table.count[i]);
-    printf("%.3f\t", table.dP_f[i]);
-    printf("%.3f\n", table.h_f[i]);
-    ++i;
-    
-    printf("Unions and Couplings\t");
-    printf("%.1f\t", table.data[i]);
-    printf("%i\t", table.count[i]);
-    printf("%.3f\t", table.dP_f[i]);
-    printf("%.3f\n", table.h_f[i]);
-    ++i;
-    
-    printf("Globe valve fully open\t");
-    printf("%.1f\t", table.data[i]);
-    printf("%i\t", table.count[i]);
-    printf("%.3f\t", table.dP_f[i]);
-    printf("%.3f\n", table.h_f[i]);
-    ++i;
-    
-    printf("Gate valve (100 pct)\t");
-    printf("%.1f\t", table.data[i]);
-    printf("%i\t", table.count[i]);
-    printf("%.3f\t", table.dP_f[i]);
-    printf("%.3f\n", table.h_f[i]);
-    ++i;
-    
-    printf("Gate valve (75 pct)\t");
-    printf("%.1f\t", table.data[i]);
-    printf("%i\t", table.count[i]);
-    printf("%.3f\t", table.dP_f[i]);
-    printf("%.3f\n", table.h_f[i]);
-    ++i;
-    
-    printf("Gate valve (50 pct)\t");
-    printf("%.1f\t", table.data[i]);
-    printf("%i\t", table.count[i]);
-    printf("%.3f\t", table.dP_f[i]);
-    printf("%.3f\n", table.h_f[i]);
-    ++i;
-    
-    printf("Gate valve (25 pct)\t");
-    printf("%.1f\t", table.data[i]);
-    printf("%i\t", table.count[i]);
-    printf("%.3f\t", table.dP_f[i]);
-    printf("%.3f\n", table.h_f[i]);
-    ++i;
-    
-    printf("Ball valve (100 pct)\t");
-    printf("%.1f\t", table.data[i]);
-    printf("%i\t", table.count[i]);
-    printf("%.3f\t", table.dP_f[i]);
-    printf("%.3f\n", table.h_f[i]);
-    ++i;
-    
-    printf("Plug valve open\t");
-    printf("%.1f\t", table.data[i]);
-    printf("%i\t", table.count[i]);
-    printf("%.3f\t", table.dP_f[i]);
-    printf("%.3f\n", table.h_f[i]);
+    for(int i = 0; i < EquivLengCount; ++i)
+    {
+        printf("%s\t", db->name[i]);
+        printf("%.1f\t", db->LeD[i]);
+        printf("%i\t", table->count[i]);
+        printf("%.3f\t", table->dP_f[i]);
+        printf("%.3f\n", table->h_f[i]);
+    }
     fflush(stdout);
 }
 
-void EquivLengWrite(EquivLenFits table, double rho, double u, double d, double mu, double vareps, double phi, double totalP, double totalh)
+void EquivLengWrite(const EquivLenFits *table, double rho, double u, double d, double mu, double vareps, double phi, double totalP, double totalh)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
-    
-    FILE *fp;                   // Pointer to the file location.
-    //  Set file name as timestamp + Equivalent Length Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Equivalent Length");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    ResultWriter w;             // Buffered writer for the results file.
+    const EquivLengDatabase *db = EquivLengData();
+    
+    //  Set file name as timestamp + Equivalent Length
+    if(!writerOpen(&w, "Equivalent Length"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
     
-    printf("Beginning file write...\n");
+    //  Write to file
+    writerPrintf(&w, "_Pressure_Loss_Through_Pipe_Fittings_(Equivalent_Length_Method)_Results_\n");
     
-    //  Open file
-    fp = fopen(filename, "w+");
+    writerPrintf(&w, "Fluid density:\n");
+    writerPrintf(&w, "rho =\t%.3f\tkg/m3\n", rho);
     
-    //  Write to file
-    fprintf(fp, "_Pressure_Loss_Through_Pipe_Fittings_(Equivalent_Length_Method)_Results_\n");
-    free(filename);
-    
-    int i = 0;
-    
-    fprintf(fp, "Fluid density:\n");
-    fprintf(fp, "rho =\t%.3f\tkg/m3\n", rho);
-    
-    fprintf(fp, "Fluid velocity (m/s):\n");
-    fprintf(fp, "u =\t%.3f\tm/s\n", u);
-    
-    fprintf(fp, "Fluid viscosity (cP):\n");
-    fprintf(fp, "mu =\t%.3f\tcP\n", mu*1000);
-    
-    fprintf(fp, "Pipe internal diameter (mm):\n");
-    fprintf(fp, "d =\t%.1f\tmm\n", d*1000);
-    
-    fprintf(fp, "Pipe absolute roughness (mm):\n");
-    fprintf(fp, "vareps =\t%.5f\tmm\n", vareps*1000);
-    
-    fprintf(fp, "Friction Factor:\n");
-    fprintf(fp, "phi =\t%.5f\t[ ]\n\n", phi);
-    
-    fprintf(fp, "Total pressure loss:\n");
-    fprintf(fp, "dP_f =\t%.3f\tPa\n", totalP);
-    
-    fprintf(fp, "Total head loss:\n");
-    fprintf(fp, "h_L =\t%3f\tm\n\n", totalh);
-    
-    fprintf(fp, "Fitting\tL_e/d\tCount\tdP_f (Pa)\th_L (m)\n");
-    
-    i = 0;
-    fprintf(fp, "Standard 45 deg elbow\t");
-    fprintf(fp, "%.1f\t", table.data[i]);
-    fprintf(fp, "%i\t", table.count[i]);
-    fprintf(fp, "%.3f\t", table.dP_f[i]);
-    fprintf(fp, "%.3f\n", table.h_f[i]);
-    ++i;
-    
-    fprintf(fp, "90 deg elbow standard radius\t");
-    fprintf(fp, "%.1f\t", table.data[i]);
-    fprintf(fp, "%i\t", table.count[i]);
-    fprintf(fp, "%.3f\t", table.dP_f[i]);
-    fprintf(fp, "%.3f\n", table.h_f[i]);
-    ++i;
-    
-    fprintf(fp, "90 deg square elbow\t");
-    fprintf(fp, "%.1f\t", table.data[i]);
-    fprintf(fp, "%i\t", table.count[i]);
-    fprintf(fp, "%.3f\t", table.dP_f[i]);
-    fprintf(fp, "%.3f\n", table.h_f[i]);
-    ++i;
-    
-    fprintf(fp, "Entry from leg T-piece\t");
-    fprintf(fp, "%.1f\t", table.data[i]);
-    fprintf(fp, "%i\t", table.count[i]);
-    fprintf(fp, "%.3f\t", table.dP_f[i]);
-    fprintf(fp, "%.3f\n", table.h_f[i]);
-    ++i;
-    
-    fprintf(fp, "Entry into leg T-piece\t");
-    fprintf(fp, "%.1f\t", table.data[i]);
-    fprintf(fp, "%i\t", table.count[i]);
-    fprintf(fp, "%.3f\t", table.dP_f[i]);
-    fprintf(fp, "%.3f\n", table.h_f[i]);
-    ++i;
-    
-    fprintf(fp, "Sudden Reduction (Tank outlet)\t");
-    fprintf(fp, "%.1f\t", table.data[i]);
-    fprintf(fp, "%i\t", table.count[i]);
-    fprintf(fp, "%.3f\t", table.dP_f[i]);
-    fprintf(fp, "%.3f\n", table.h_f[i]);
-    ++i;
-    
-    fprintf(fp, "Sudden Expansion (Tank Inlet)\t");
-    fprintf(fp, "%.1f\t", table.data[i]);
-    fprintf(fp, "%i\t", table.count[i]);
-    fprintf(fp, "%.3f\t", table.dP_f[i]);
-    fprintf(fp, "%.3f\n", table.h_f[i]);
-    ++i;
-    
-    fprintf(fp, "Unions and Couplings\t");
-    fprintf(fp, "%.1f\t", table.data[i]);
-    fprintf(fp, "%i\t", table.count[i]);
-    fprintf(fp, "%.3f\t", table.dP_f[i]);
-    fprintf(fp, "%.3f\n", table.h_f[i]);
-    ++i;
-    
-    fprintf(fp, "Globe valve fully open\t");
-    fprintf(fp, "%.1f\t", table.data[i]);
-    fprintf(fp, "%i\t", table.count[i]);
-    fprintf(fp, "%.3f\t", table.dP_f[i]);
-    fprintf(fp, "%.3f\n", table.h_f[i]);
-    ++i;
-    
-    fprintf(fp, "Gate valve (100 pct)\t");
-    fprintf(fp, "%.1f\t", table.data[i]);
-    fprintf(fp, "%i\t", table.count[i]);
-    fprintf(fp, "%.3f\t", table.dP_f[i]);
-    fprintf(fp, "%.3f\n", table.h_f[i]);
-    ++i;
-    
-    fprintf(fp, "Gate valve (75 pct)\t");
-    fprintf(fp, "%.1f\t", table.data[i]);
-    fprintf(fp, "%i\t", table.count[i]);
-    fprintf(fp, "%.3f\t", table.dP_f[i]);
-    fprintf(fp, "%.3f\n", table.h_f[i]);
-    ++i;
-    
-    fprintf(fp, "Gate valve (50 pct)\t");
-    fprintf(fp, "%.1f\t", table.data[i]);
-    fprintf(fp, "%i\t", table.count[i]);
-    fprintf(fp, "%.3f\t", table.dP_f[i]);
-    fprintf(fp, "%.3f\n", table.h_f[i]);
-    ++i;
-    
-    fprintf(fp, "Gate valve (25 pct)\t");
-    fprintf(fp, "%.1f\t", table.data[i]);
-    fprintf(fp, "%i\t", table.count[i]);
-    fprintf(fp, "%.3f\t", table.dP_f[i]);
-    fprintf(fp, "%.3f\n", table.h_f[i]);
-    ++i;
-    
-    fprintf(fp, "Ball valve (100 pct)\t");
-    fprintf(fp, "%.1f\t", table.data[i]);
-    fprintf(fp, "%i\t", table.count[i]);
-    fprintf(fp, "%.3f\t", table.dP_f[i]);
-    fprintf(fp, "%.3f\n", table.h_f[i]);
-    ++i;
-    
-    fprintf(fp, "Plug valve open\t");
-    fprintf(fp, "%.1f\t", table.data[i]);
-    fprintf(fp, "%i\t", table.count[i]);
-    fprintf(fp, "%.3f\t", table.dP_f[i]);
-    fprintf(fp, "%.3f\n", table.h_f[i]);
+    writerPrintf(&w, "Fluid velocity (m/s):\n");
+    writerPrintf(&w, "u =\t%.3f\tm/s\n", u);
+    
+    writerPrintf(&w, "Fluid viscosity (cP):\n");
+    writerPrintf(&w, "mu =\t%.3f\tcP\n", mu*1000);
+    
+    writerPrintf(&w, "Pipe internal diameter (mm):\n");
+    writerPrintf(&w, "d =\t%.1f\tmm\n", d*1000);
+    
+    writerPrintf(&w, "Pipe absolute roughness (mm):\n");
+    writerPrintf(&w, "vareps =\t%.5f\tmm\n", vareps*1000);
+    
+    writerPrintf(&w, "Friction Factor:\n");
+    writerPrintf(&w, "phi =\t%.5f\t[ ]\n\n", phi);
+    
+    writerPrintf(&w, "Total pressure loss:\n");
+    writerPrintf(&w, "dP_f =\t%.3f\tPa\n", totalP);
+    
+    writerPrintf(&w, "Total head loss:\n");
+    writerPrintf(&w, "h_L =\t%3f\tm\n\n", totalh);
+    
+    writerPrintf(&w, "Fitting\tL_e/d\tCount\tdP_f (Pa)\th_L (m)\n");
+    
+    for(int i = 0; i < EquivLengCount; ++i)
+    {
+        writerPrintf(&w, "%s\t", db->name[i]);
+        writerPrintf(&w, "%.1f\t", db->LeD[i]);
+        writerPrintf(&w, "%i\t", table->count[i]);
+        writerPrintf(&w, "%.3f\t", table->dP_f[i]);
+        writerPrintf(&w, "%.3f\n", table->h_f[i]);
+    }
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
-void EquivLengWriteSwitch(EquivLenFits table, double rho, double u, double d, double mu, double vareps, double phi, double totalP, double totalh)
+void EquivLengWriteSwitch(const EquivLenFits *table, double rho, double u, double d, double mu, double vareps, double phi, double totalP, double totalh)
 {
     int control = 0;
     
@@ -555,17 +294,17 @@ void EquivalentLength()
     double elapsed = 0.0;
     
     //  Collecting data
-    *EquivLengTable = EquivLengVariable(*EquivLengTable, &rho, &u, &d, &mu, &vareps, &phi);
+    EquivLengVariable(EquivLengTable, &rho, &u, &d, &mu, &vareps, &phi);
     printf("\n");
     
     //  Performing calculations
     clock_getres(CLOCK_MONOTONIC, &start);
     clock_gettime(CLOCK_MONOTONIC, &start);
     
-    *EquivLengTable = EquivLengFinalTable(*EquivLengTable, rho, u, d, phi);
+    EquivLengFinalTable(EquivLengTable, rho, u, phi);
     
     //  Calculating total pressure and head loss
-    for(int i = 0; i < 15; ++i)
+    for(int i = 0; i < EquivLengCount; ++i)
     {
         totalP += EquivLengTable->dP_f[i];
         totalH += EquivLengTable->h_f[i];
@@ -578,10 +317,10 @@ void EquivalentLength()
     printf("Calculations completed in %.6f seconds.\n", elapsed);
     
     //  Displaying data
-    EquivLengDisplay(*EquivLengTable, rho, u, d, mu, vareps, phi, totalP, totalH);
+    EquivLengDisplay(EquivLengTable, rho, u, d, mu, vareps, phi, totalP, totalH);
     
     //  Writing data to file
-    EquivLengWriteSwitch(*EquivLengTable, rho, u, d, mu, vareps, phi, totalP, totalH);
+    EquivLengWriteSwitch(EquivLengTable, rho, u, d, mu, vareps, phi, totalP, totalH);
     free(EquivLengTable);
 }
 
@@ -22,11 +22,17 @@
 #ifndef EquivLengStruct
 #define EquivLengStruct
 
+#define EquivLengCount 15
+
+typedef struct EquivLengDatabase{
+    const char *name[EquivLengCount];   // Fitting description.
+    double LeD[EquivLengCount];         // Equivalent length in pipe diameters, L_e/d ([ ]).
+} EquivLengDatabase;
+
 typedef struct EquivLengthFittings{
-    double data[15];
-    int count[15];
-    double dP_f[15];
-    double h_f[15];
+    int count[EquivLengCount];          // Number of each fitting in the line.
+    double dP_f[EquivLengCount];        // Pressure loss through each fitting type (Pa).
+    double h_f[EquivLengCount];         // Head loss through each fitting type (m).
 } EquivLenFits;
 
 #endif /* EquivLengStruct */
@@ -34,19 +40,18 @@ typedef struct EquivLengthFittings{
 #ifndef EquivLengData_h
 #define EquivLengData_h
 
-/// This subroutine is used to write the equivalent length database constants to the struct where data is being collected to.
-/// @param input Struct where equivalent length data is being collected to.
-EquivLenFits EquivLengData(EquivLenFits input);
+/// This subroutine returns a pointer to the read-only equivalent length database. The database is a static table which is shared between all calls and should not be modified.
+const EquivLengDatabase *EquivLengData(void);
 
 /// This subroutine is used to collect the necessary data to calculate the pressure and head losses through pipe fittings through the equivalent length method.
-/// @param data Struct where equivalent length data is being collected to.
+/// @param data Struct where the fitting counts are being collected to.
 /// @param rho Fluid density (kg/m3)
 /// @param u Fluid velocity (m/s)
 /// @param d Pipe diameter (mm)
 /// @param mu Fluid viscosity (cP)
 /// @param vareps Absolute surface roughness (mm)
 /// @param phi Friction factor (This value is calculated using "phicalc(...)" from "03bGenPressureLoss.h").
-EquivLenFits EquivLengVariable(EquivLenFits data, double *rho, double *u, double *d, double *mu, double *vareps, double *phi);
+void EquivLengVariable(EquivLenFits *data, double *rho, double *u, double *d, double *mu, double *vareps, double *phi);
 
 #endif /* EquivLengData_h */
 
@@ -54,7 +59,7 @@ EquivLenFits EquivLengVariable(EquivLenFits data, double *rho, double *u, double
 #define EquivLengCalc_h
 
 /// This subroutine is used to calculate the equivalent length from the database constant and internal pipe diameter.
-/// @param input L_e/d value. This can be found in "[struct].data" section of the above declared struct.
+/// @param input L_e/d value. This can be found in "EquivLengData()->LeD".
 /// @param d Internal pipe diameter (m)
 double EquivLengCalculateL_e(double input, double d);
 
@@ -68,12 +73,11 @@ double EquivLengCalculateL_e(double input, double d);
 double EquivLengCalculateLoss(int count, double phi, double L_e, double rho, double u, double d);
 
 /// This subroutine is used to generate the calculation table for estimating the pressure and head losses through the Equivalent length method.
-/// @param data Struct where data requires manipulation.
+/// @param data Struct containing the fitting counts. The calculated losses are written to this struct.
 /// @param rho Fluid density (kg/m3).
 /// @param u Fluid velocity (m/s).
-/// @param d Internal pipe diameter (m).
 /// @param phi Friction factor ([ ]).
-EquivLenFits EquivLengFinalTable(EquivLenFits data, double rho, double u, double d, double phi);
+void EquivLengFinalTable(EquivLenFits *data, double rho, double u, double phi);
 
 #endif /* EquivLengCalc_h */
 
@@ -90,7 +94,7 @@ EquivLenFits EquivLengFinalTable(EquivLenFits data, double rho, double u, double
 /// @param phi Friction Factor.
 /// @param totalP Total pressure loss through pipe fittings.
 /// @param totalh Total head loss through pipe fittings.
-void EquivLengDisplay(EquivLenFits table, double rho, double u, double d, double mu, double vareps, double phi, double totalP, double totalh);
+void EquivLengDisplay(const EquivLenFits *table, double rho, double u, double d, double mu, double vareps, double phi, double totalP, double totalh);
 
 #endif /* EquivLengDisp_h */
 
@@ -107,7 +111,7 @@ void EquivLengDisplay(EquivLenFits table, double rho, double u, double d, double
 /// @param phi Friction Factor.
 /// @param totalP Total pressure loss through pipe fittings.
 /// @param totalh Total head loss through pipe fittings.
-void EquivLengWrite(EquivLenFits table, double rho, double u, double d, double mu, double vareps, double phi, double totalP, double totalh);
+void EquivLengWrite(const EquivLenFits *table, double rho, double u, double d, double mu, double vareps, double phi, double totalP, double totalh);
 
 /// This subroutine is used to ask the user if they would like to write the results to a file.
 /// @param table Equivalent length data table.
@@ -119,7 +123,7 @@ void EquivLengWrite(EquivLenFits table, double rho, double u, double d, double m
 /// @param phi Friction Factor.
 /// @param totalP Total pressure loss through pipe fittings.
 /// @param totalh Total head loss through pipe fittings.
-void EquivLengWriteSwitch(EquivLenFits table, double rho, double u, double d, double mu, double vareps, double phi, double totalP, double totalh);
+void EquivLengWriteSwitch(const EquivLenFits *table, double rho, double u, double d, double mu, double vareps, double phi, double totalP, double totalh);
 
 #endif /* EquivLengWrite_h */
 
@@ -0,0 +1,463 @@
+//
+//  03dFittingsLoss.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+/// MARK: HEADER DECLARATIONS
+//Standard Header Files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//Custom Header Files
+#include "System.h"
+#include "ResultWriter.h"
+#include "Parallel.h"
+#include "DimensionlessNum.h"
+#include "03aFrictFactor.h"
+#include "03dOneK.h"
+#include "03dTwoK.h"
+#include "03dThreeK.h"
+#include "03dEquivLeng.h"
+#include "03dFittingsLoss.h"
+
+/// MARK: SUBROUTINE DEFINITIONS
+#define maxstrlen 128
+#define g 9.80665
+#define ratebatch 256       // Flow conditions evaluated by each parallel task.
+
+static const char *FittingsMethodName[] = {"", "1K", "2K", "3K", "L_e/D"};
+
+/// This subroutine is used to find the number of rows within the database of a method.
+/// @param method Method identifier.
+static int FittingsDatabaseSize(int method)
+{
+    switch(method)
+    {
+        case FittingsOneK:
+            return OneKCount;
+        case FittingsTwoK:
+            return TwoKCount;
+        case FittingsThreeK:
+            return ThreeKCount;
+        case FittingsEquivLeng:
+            return EquivLengCount;
+        default:
+            return 0;
+    }
+}
+
+/// This subroutine is used to find the description of a fitting within the database of a method.
+/// @param method Method identifier.
+/// @param id Row of the fitting within the database.
+static const char *FittingsName(int method, int id)
+{
+    if(id < 0 || id >= FittingsDatabaseSize(method))
+    {
+        return NULL;
+    }
+    switch(method)
+    {
+        case FittingsOneK:
+            return OneKData()->name[id];
+        case FittingsTwoK:
+            return TwoKData()->name[id];
+        case FittingsThreeK:
+            return ThreeKData()->name[id];
+        case FittingsEquivLeng:
+            return EquivLengData()->name[id];
+        default:
+            return NULL;
+    }
+}
+
+/// MARK: VARIABLE INPUT
+void FittingsLineVariable(int i, FittingsLine *line)
+{
+    char input[maxstrlen];
+    char label[maxstrlen];
+    int control = 0;
+    int size = 0;
+    
+    printf("Line %i.\n", i + 1);
+    line->n = (int)inputDouble(0, 0, "number of different fittings on the line", "");
+    line->entry = calloc(line->n, sizeof(FittingsEntry));
+    
+    for(int j = 0; j < line->n; ++j)
+    {
+        control = 1;
+        while(control == 1)
+        {
+            printf("Method for fitting %i [1 = 1K, 2 = 2K, 3 = 3K, 4 = Equivalent length]: ", j + 1);
+            fgets(input, sizeof(input), stdin);
+            switch(input[0])
+            {
+                case '1':
+                case '2':
+                case '3':
+                case '4':
+                    line->entry[j].method = input[0] - '0';
+                    control = 0;
+                    break;
+                default:
+                    printf("Input not recognised\n");
+                    break;
+            }
+        }
+        
+        size = FittingsDatabaseSize(line->entry[j].method);
+        for(int k = 0; k < size; ++k)
+        {
+            printf("%i. %s\n", k + 1, FittingsName(line->entry[j].method, k));
+        }
+        control = 1;
+        while(control == 1)
+        {
+            printf("Fitting number [1 - %i]: ", size);
+            line->entry[j].id = atoi(fgets(input, sizeof(input), stdin)) - 1;
+            if(line->entry[j].id < 0 || line->entry[j].id >= size)
+            {
+                printf("Input not recognised\n");
+            }else{
+                control = 0;
+            }
+        }
+        
+        snprintf(label, sizeof(label), "number of \"%s\"", FittingsName(line->entry[j].method, line->entry[j].id));
+        line->entry[j].count = (int)inputDouble(0, 0, label, "");
+    }
+}
+
+void FittingsFlowVariable(int i, FittingsFlow *flow)
+{
+    printf("Flow condition for line %i.\n", i + 1);
+    flow->line[i] = i;
+    
+    flow->rho[i] = inputDouble(0, 0, "fluid density", "kg/m3");
+    
+    flow->u[i] = inputDouble(0, 0, "average fluid velocity", "m/s");
+    
+    flow->d[i] = inputDouble(0, 0, "internal pipe diameter", "mm");
+    flow->d[i] = flow->d[i]*0.001; // Conversion (mm to m)
+    
+    flow->mu[i] = inputDouble(0, 0, "fluid viscosity", "cP");
+    flow->mu[i] = flow->mu[i]*0.001; // Conversion (cP to Pa.s)
+    
+    flow->vareps[i] = inputDouble(1, 0, "pipe absolute roughness", "mm");
+    flow->vareps[i] = flow->vareps[i]*0.001; // Conversion (mm to m)
+    
+    flow->DN[i] = inputDouble(0, 0, "diameter nominal", "mm");
+}
+
+/// MARK: GENERAL CALCULATIONS
+int FittingsReduce(const FittingsLine *line, FittingsCoefficients *coef)
+{
+    const OneKDatabase *onek = OneKData();
+    const TwoKDatabase *twok = TwoKData();
+    const ThreeKDatabase *threek = ThreeKData();
+    const EquivLengDatabase *equiv = EquivLengData();
+    int skipped = 0;
+    
+    memset(coef, 0, sizeof(FittingsCoefficients));
+    for(int j = 0; j < line->n; ++j)
+    {
+        const FittingsEntry *e = &line->entry[j];
+        
+        if(FittingsName(e->method, e->id) == NULL)
+        {
+            ++skipped;
+            continue;
+        }
+        switch(e->method)
+        {
+            case FittingsOneK:
+                coef->K0 += e->count*onek->K[e->id];
+                break;
+            case FittingsTwoK:
+                coef->KRe += e->count*twok->k1[e->id];
+                coef->Kd2 += e->count*twok->kinf[e->id];
+                break;
+            case FittingsThreeK:
+                coef->KRe += e->count*threek->k1[e->id];
+                coef->K0 += e->count*threek->kinf[e->id];
+                coef->Kd3 += e->count*threek->kinf[e->id]*threek->Metkd[e->id];
+                break;
+            case FittingsEquivLeng:
+                coef->LeD += e->count*equiv->LeD[e->id];
+                break;
+        }
+    }
+    
+    return skipped;
+}
+
+typedef struct FittingsRateContext{
+    int nlines;
+    const FittingsCoefficients *coef;
+    const FittingsFlow *flow;
+    FittingsResult *result;
+} FittingsRateContext;
+
+/// This subroutine is used to evaluate a contiguous block of flow conditions. Used as the kernel of "parallelFor(...)".
+static void FittingsRateBlock(int start, int end, void *context)
+{
+    FittingsRateContext *ctx = context;
+    const FittingsFlow *flow = ctx->flow;
+    FittingsResult *result = ctx->result;
+    
+    for(int k = start; k < end; ++k)
+    {
+        const FittingsCoefficients *c = NULL;
+        double Re = 0.0;
+        double K = 0.0;
+        double term = 0.0;
+        
+        if(flow->line[k] < 0 || flow->line[k] >= ctx->nlines)
+        {
+            result->Re[k] = 0.0;
+            result->K[k] = 0.0;
+            result->headloss[k] = 0.0;
+            result->dP_f[k] = 0.0;
+            continue;
+        }
+        c = &ctx->coef[flow->line[k]];
+        
+        Re = ReynoldsNum(flow->rho[k], flow->u[k], flow->d[k], flow->mu[k]);
+        K = c->K0 + c->KRe/Re;
+        if(c->Kd2 != 0.0)
+        {
+            //  2K size correction uses the internal diameter in inches.
+            term = flow->d[k]/0.0254;
+            term = 1 + 1/(term);
+            K += c->Kd2*(term);
+        }
+        if(c->Kd3 != 0.0)
+        {
+            term = (flow->DN != NULL) ? flow->DN[k] : 1000*flow->d[k];
+            term = pow(term, (-0.3));
+            K += c->Kd3*(term);
+        }
+        if(c->LeD != 0.0)
+        {
+            term = (flow->vareps != NULL) ? flow->vareps[k]/flow->d[k] : 0.0;
+            term = FrictFactorSolve(Re, term);
+            K += 8*(term)*c->LeD;
+        }
+        
+        term = pow(flow->u[k], 2);
+        term = (term)/(2*g);
+        
+        result->Re[k] = Re;
+        result->K[k] = K;
+        result->headloss[k] = K*(term);
+        result->dP_f[k] = flow->rho[k]*g*result->headloss[k];
+    }
+}
+
+int FittingsRate(int nlines, const FittingsLine *lines, const FittingsFlow *flow, FittingsResult *result)
+{
+    FittingsCoefficients *coef = NULL;
+    FittingsRateContext ctx;
+    int skipped = 0;
+    
+    //  Every line is reduced once so that the batch only touches five coefficients per flow condition.
+    coef = calloc(nlines > 0 ? nlines : 1, sizeof(FittingsCoefficients));
+    for(int i = 0; i < nlines; ++i)
+    {
+        skipped += FittingsReduce(&lines[i], &coef[i]);
+    }
+    
+    ctx.nlines = nlines;
+    ctx.coef = coef;
+    ctx.flow = flow;
+    ctx.result = result;
+    parallelFor(flow->n, ratebatch, FittingsRateBlock, &ctx);
+    
+    free(coef);
+    return skipped;
+}
+
+/// MARK: DISPLAY AND WRITE
+void FittingsLossDisplay(int nlines, const FittingsLine *lines, const FittingsFlow *flow, const FittingsResult *result)
+{
+    printf("_Pressure_Loss_Through_Pipe_Fittings_(Line_List)_Results_\n");
+    for(int i = 0; i < nlines; ++i)
+    {
+        printf("\tLine %i:\n", i + 1);
+        printf("Method\tFitting\tCount\n");
+        for(int j = 0; j < lines[i].n; ++j)
+        {
+            const FittingsEntry *e = &lines[i].entry[j];
+            printf("%s\t%s\t%i\n", FittingsMethodName[e->method], FittingsName(e->method, e->id), e->count);
+        }
+        printf("\n");
+    }
+    
+    printf("\tLine ratings:\n");
+    printf("Line\trho (kg/m3)\tu (m/s)\td (mm)\tmu (cP)\tvareps (mm)\tDN (mm)\tRe ([ ])\tK ([ ])\th_f (m)\tdP_f (Pa)\n");
+    for(int k = 0; k < flow->n; ++k)
+    {
+        printf("%i\t%.3f\t%.3f\t%.3f\t%.3f\t%.4f\t%.1f\t%.3f\t%.3f\t%.3f\t%.3f\n", flow->line[k] + 1, flow->rho[k], flow->u[k], flow->d[k]*1000, flow->mu[k]*1000, flow->vareps[k]*1000, flow->DN[k], result->Re[k], result->K[k], result->headloss[k], result->dP_f[k]);
+    }
+    printf("\n");
+}
+
+void FittingsLossWrite(int nlines, const FittingsLine *lines, const FittingsFlow *flow, const FittingsResult *result)
+{
+    //  Function variables
+    ResultWriter w;             // Buffered writer for the results file.
+    
+    //  Set file name as timestamp + Fittings Line List Results
+    if(!writerOpen(&w, "Fittings Line List Results"))
+    {
+        return;
+    }
+    
+    //  Write to file
+    writerPrintf(&w, "_Pressure_Loss_Through_Pipe_Fittings_(Line_List)_Results_\n");
+    for(int i = 0; i < nlines; ++i)
+    {
+        writerPrintf(&w, "\tLine %i:\n", i + 1);
+        writerPrintf(&w, "Method\tFitting\tCount\n");
+        for(int j = 0; j < lines[i].n; ++j)
+        {
+            const FittingsEntry *e = &lines[i].entry[j];
+            writerPrintf(&w, "%s\t%s\t%i\n", FittingsMethodName[e->method], FittingsName(e->method, e->id), e->count);
+        }
+        writerPrintf(&w, "\n");
+    }
+    
+    writerPrintf(&w, "\tLine ratings:\n");
+    writerPrintf(&w, "Line\trho (kg/m3)\tu (m/s)\td (mm)\tmu (cP)\tvareps (mm)\tDN (mm)\tRe ([ ])\tK ([ ])\th_f (m)\tdP_f (Pa)\n");
+    for(int k = 0; k < flow->n; ++k)
+    {
+        writerPrintf(&w, "%i\t%.3f\t%.3f\t%.3f\t%.3f\t%.4f\t%.1f\t%.3f\t%.3f\t%.3f\t%.3f\n", flow->line[k] + 1, flow->rho[k], flow->u[k], flow->d[k]*1000, flow->mu[k]*1000, flow->vareps[k]*1000, flow->DN[k], result->Re[k], result->K[k], result->headloss[k], result->dP_f[k]);
+    }
+    
+    //  Close file
+    writerClose(&w);
+}
+
+void FittingsLossWriteSwitch(int nlines, const FittingsLine *lines, const FittingsFlow *flow, const FittingsResult *result)
+{
+    int control = 0;
+    
+    control = 1;
+    while(control == 1)
+    {
+        char input[maxstrlen];
+        
+        printf("Do you want to save results to file? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+            case 'T':
+            case 'Y':
+            case 't':
+            case 'y':
+                FittingsLossWrite(nlines, lines, flow, result);
+                control = 0;
+                break;
+            case '0':
+            case 'F':
+            case 'N':
+            case 'f':
+            case 'n':
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+}
+
+/// MARK: PSEUDO-MAIN FUNCTION
+void FittingsLoss(void)
+{
+    //  Variable declaration
+    int nlines = 0;                 // Number of lines.
+    FittingsLine *lines = NULL;     // Fittings installed on each line.
+    FittingsFlow flow;              // Flow condition applied to each line.
+    FittingsResult result;          // Calculated losses for each line.
+    double *store = NULL;           // Backing storage for the flow and result arrays.
+    
+        //  Variables for timing function
+    struct timespec start, end;
+    double elapsed = 0.0;
+    
+    printf("Pressure Loss through Pipe Fittings (Line List)\n");
+    
+    //  Collecting data
+    while(nlines < 1)
+    {
+        nlines = (int)inputDouble(0, 0, "number of lines", "");
+    }
+    lines = calloc(nlines, sizeof(FittingsLine));
+    store = calloc((size_t)nlines*10, sizeof(double));
+    
+    flow.n = nlines;
+    flow.line = calloc(nlines, sizeof(int));
+    flow.rho = store;
+    flow.u = store + nlines;
+    flow.d = store + 2*nlines;
+    flow.mu = store + 3*nlines;
+    flow.vareps = store + 4*nlines;
+    flow.DN = store + 5*nlines;
+    result.Re = store + 6*nlines;
+    result.K = store + 7*nlines;
+    result.headloss = store + 8*nlines;
+    result.dP_f = store + 9*nlines;
+    
+    for(int i = 0; i < nlines; ++i)
+    {
+        FittingsLineVariable(i, &lines[i]);
+        FittingsFlowVariable(i, &flow);
+        printf("\n");
+    }
+    
+    //  Performing calculations
+    clock_getres(CLOCK_MONOTONIC, &start);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    
+    FittingsRate(nlines, lines, &flow, &result);
+    
+    clock_getres(CLOCK_MONOTONIC, &end);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    elapsed = timer(start, end);
+
+    printf("Calculations completed in %.6f seconds.\n", elapsed);
+    
+    //  Displaying results
+    FittingsLossDisplay(nlines, lines, &flow, &result);
+    
+    //  Writing results
+    FittingsLossWriteSwitch(nlines, lines, &flow, &result);
+    
+    for(int i = 0; i < nlines; ++i)
+    {
+        free(lines[i].entry);
+    }
+    free(lines);
+    free(flow.line);
+    free(store);
+}
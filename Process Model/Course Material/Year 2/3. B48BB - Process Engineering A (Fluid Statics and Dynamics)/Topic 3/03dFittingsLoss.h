@@ -0,0 +1,134 @@
+//
+//  03dFittingsLoss.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef _3dFittingsLossStruct_h
+#define _3dFittingsLossStruct_h
+
+#define FittingsOneK 1          // Fitting row taken from "OneKData()".
+#define FittingsTwoK 2          // Fitting row taken from "TwoKData()".
+#define FittingsThreeK 3        // Fitting row taken from "ThreeKData()".
+#define FittingsEquivLeng 4     // Fitting row taken from "EquivLengData()".
+
+typedef struct FittingsEntry{
+    int method;     // Method used to evaluate the fitting (FittingsOneK, FittingsTwoK, FittingsThreeK or FittingsEquivLeng).
+    int id;         // Row of the fitting within the database of the chosen method.
+    int count;      // Number of the fitting on the line.
+} FittingsEntry;
+
+typedef struct FittingsLine{
+    int n;                  // Number of entries on the line.
+    FittingsEntry *entry;   // Sparse list of the fittings installed on the line.
+} FittingsLine;
+
+typedef struct FittingsCoefficients{
+    double K0;      // Constant resistance coefficient ([ ]). 1K values and 3K k_inf values.
+    double KRe;     // Coefficient of 1/Re ([ ]). 2K and 3K k_1 values.
+    double Kd2;     // Coefficient of (1 + 1/D_in) ([ ]). 2K k_inf values.
+    double Kd3;     // Coefficient of DN^-0.3 (mm^0.3). 3K k_inf k_d values.
+    double LeD;     // Coefficient of 8 phi ([ ]). Equivalent lengths, L_e/d.
+} FittingsCoefficients;
+
+typedef struct FittingsFlow{
+    int n;              // Number of flow conditions.
+    int *line;          // Line that each flow condition belongs to.
+    double *rho;        // Fluid density (kg/m3).
+    double *u;          // Fluid velocity (m/s).
+    double *d;          // Internal pipe diameter (m).
+    double *mu;         // Fluid viscosity (Pa.s).
+    double *vareps;     // Pipe absolute roughness (m). NULL is taken as smooth pipe.
+    double *DN;         // Diameter nominal (mm). NULL takes the internal pipe diameter.
+} FittingsFlow;
+
+typedef struct FittingsResult{
+    double *Re;         // Reynolds number ([ ]).
+    double *K;          // Total resistance coefficient of the line ([ ]).
+    double *headloss;   // Head loss through the fittings on the line (m).
+    double *dP_f;       // Pressure loss through the fittings on the line (Pa).
+} FittingsResult;
+
+#endif /* _3dFittingsLossStruct_h */
+
+#ifndef _3dFittingsLossVariable_h
+#define _3dFittingsLossVariable_h
+
+/// This subroutine is used to collect the sparse list of fittings installed on a single line. Each fitting is entered with the method used to evaluate it.
+/// @param i Line identifier.
+/// @param line Struct where the list of fittings should be entered.
+void FittingsLineVariable(int i, FittingsLine *line);
+
+/// This subroutine is used to collect the flow condition for a single line.
+/// @param i Flow condition identifier.
+/// @param flow Struct where the flow condition should be entered.
+void FittingsFlowVariable(int i, FittingsFlow *flow);
+
+#endif /* _3dFittingsLossVariable_h */
+
+#ifndef _3dFittingsLossCalc_h
+#define _3dFittingsLossCalc_h
+
+/// This subroutine is used to reduce the list of fittings on a line to the coefficients of the combined resistance coefficient, K = K0 + KRe/Re + Kd2(1 + 1/D_in) + Kd3/DN^0.3 + 8 phi LeD. Entries that do not refer to a row of a database are skipped.
+/// @param line List of fittings installed on the line.
+/// @param coef Struct where the line coefficients should be entered.
+/// @return Number of entries that were skipped.
+int FittingsReduce(const FittingsLine *line, FittingsCoefficients *coef);
+
+/// This subroutine is used to calculate the total resistance coefficient, head loss and pressure loss for every flow condition in a single pass. The fittings on each line are only reduced once regardless of the number of flow conditions.
+/// @param nlines Number of lines.
+/// @param lines Array of lines containing the installed fittings.
+/// @param flow Batch of flow conditions, each referring to a line.
+/// @param result Struct of arrays (flow->n elements) where the results should be entered.
+/// @return Number of fitting entries that were skipped.
+int FittingsRate(int nlines, const FittingsLine *lines, const FittingsFlow *flow, FittingsResult *result);
+
+#endif /* _3dFittingsLossCalc_h */
+
+#ifndef _3dFittingsLossDisplay_h
+#define _3dFittingsLossDisplay_h
+
+/// This subroutine is used to display the rating of every line.
+/// @param nlines Number of lines.
+/// @param lines Array of lines containing the installed fittings.
+/// @param flow Flow condition applied to each line.
+/// @param result Calculated resistance coefficients and losses.
+void FittingsLossDisplay(int nlines, const FittingsLine *lines, const FittingsFlow *flow, const FittingsResult *result);
+
+/// This subroutine is used to write the rating of every line to a .txt file.
+/// @param nlines Number of lines.
+/// @param lines Array of lines containing the installed fittings.
+/// @param flow Flow condition applied to each line.
+/// @param result Calculated resistance coefficients and losses.
+void FittingsLossWrite(int nlines, const FittingsLine *lines, const FittingsFlow *flow, const FittingsResult *result);
+
+/// This subroutine is used to check if the user would like to write the line ratings to a file.
+/// @param nlines Number of lines.
+/// @param lines Array of lines containing the installed fittings.
+/// @param flow Flow condition applied to each line.
+/// @param result Calculated resistance coefficients and losses.
+void FittingsLossWriteSwitch(int nlines, const FittingsLine *lines, const FittingsFlow *flow, const FittingsResult *result);
+
+#endif /* _3dFittingsLossDisplay_h */
+
+#ifndef _3dFittingsLoss_h
+#define _3dFittingsLoss_h
+
+/// This subroutine is used to guide the user through rating a list of lines whose fittings are evaluated with a mix of the 1K, 2K, 3K and equivalent length methods.
+void FittingsLoss(void);
+
+#endif /* _3dFittingsLoss_h */
@@ -22,10 +22,16 @@
 #ifndef OneKStruct
 #define OneKStruct
 
+#define OneKCount 15
+
+typedef struct OneKDatabase{
+    const char *name[OneKCount];    // Fitting description.
+    double K[OneKCount];            // Resistance coefficient ([ ]).
+} OneKDatabase;
+
 typedef struct OneKFittings{
-    double data[15];
-    int count[15];
-    double headloss[15];
+    int count[OneKCount];           // Number of each fitting in the line.
+    double headloss[OneKCount];     // Head loss through each fitting type (m).
 } OneKFittings;
 
 #endif /* OneKStruct */
@@ -33,9 +39,8 @@ typedef struct OneKFittings{
 #ifndef OneKData_h
 #define OneKData_h
 
-/// This subroutine is used to input K-values into the table being used by the "OneK(void)"
-/// @param input Table where data values should be inputted.
-OneKFittings OneKData(OneKFittings input);
+/// This subroutine returns a pointer to the read-only 1K database. The database is a static table which is shared between all calls and should not be modified.
+const OneKDatabase *OneKData(void);
 
 #endif /* OneKData_h */
 
@@ -45,7 +50,7 @@ OneKFittings OneKData(OneKFittings input);
 /// This subroutine is used to collect the fluid velocity and counts for each fitting available.
 /// @param table Table where fitting counts should be inputted.
 /// @param u Fluid velocity (m/s)
-OneKFittings OneKVariable(OneKFittings table, double *u);
+void OneKVariable(OneKFittings *table, double *u);
 
 #endif /* OneKVar */
 
@@ -54,7 +59,7 @@ OneKFittings OneKVariable(OneKFittings table, double *u);
 
 /// This subroutine is used to calculate the head loss associated with one fitting. The subroutine returns the total head loss for the singular fitting, multiplied by the count.
 /// @param count Number of occurences of the fitting being calculated.
-/// @param data Fitting k-value. This is numbered from 0 - 14 in the order that the counts were asked for in "OneK(void)".
+/// @param data Fitting k-value. This can be found in "OneKData()->K".
 /// @param u Fluid Velocity (m/ s).
 double OneKCalculation(int count, double data, double u);
 
@@ -64,9 +69,9 @@ double OneKCalculation(int count, double data, double u);
 #define OneKFinalTable_h
 
 /// This subroutine is used to perform the calculations required for the excess head/ 1K method of pressure losses through pipe fittings.
-/// @param data Table containing counts and k-values
+/// @param data Table containing counts. The calculated head losses are written to this table.
 /// @param u Fluid velocity (m/s)
-OneKFittings OneKFinalTable(OneKFittings data, double u);
+void OneKFinalTable(OneKFittings *data, double u);
 
 #endif /* OneKFinalTable_h */
 
@@ -74,10 +79,10 @@ OneKFittings OneKFinalTable(OneKFittings data, double u);
 #define OneKDisplay_h
 
 /// This subroutine is used to display the collected data and calculated table on the console.
-/// @param table Table containing counts, k-values and calculated head losses
+/// @param table Table containing counts and calculated head losses
 /// @param u Fluid velocity (m/s).
 /// @param total Total head losses presented in the table (m).
-void OneKDisplay(OneKFittings table, double u, double total);
+void OneKDisplay(const OneKFittings *table, double u, double total);
 
 #endif /* OneKDisplay_h */
 
@@ -85,16 +90,16 @@ void OneKDisplay(OneKFittings table, double u, double total);
 #define OneKWrite_h
 
 /// This subroutine is used to write the collected data and calculated table to a .txt file.
-/// @param table Table containing counts, k-values and calculated head losses
+/// @param table Table containing counts and calculated head losses
 /// @param u Fluid velocity (m/s).
 /// @param total Total head losses presented in the table (m).
-void OneKWrite(OneKFittings table, double u, double total);
+void OneKWrite(const OneKFittings *table, double u, double total);
 
 /// This subroutine is used to check whether the user would like to write the generated results to a file.
-/// @param table Table containing counts, k-values and calculated head losses
+/// @param table Table containing counts and calculated head losses
 /// @param u Fluid velocity (m/s).
 /// @param total Total head losses presented in the table (m).
-void OneKWriteSwitch(OneKFittings table, double u, double total);
+void OneKWriteSwitch(const OneKFittings *table, double u, double total);
 
 #endif /* OneKWrite_h */
 
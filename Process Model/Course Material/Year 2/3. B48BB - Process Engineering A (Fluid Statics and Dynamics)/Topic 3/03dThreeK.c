@@ -29,6 +29,7 @@
 
 //  Custom header files
 #include "System.h"
+#include "ResultWriter.h"
 #include "DimensionlessNum.h"
 #include "03dThreeK.h"
 
@@ -37,164 +38,64 @@
 #define g 9.80665
 
 /// MARK: DATA BANK
-ThreeKFittings ThreeKData(ThreeKFittings input)
+static const ThreeKDatabase ThreeKDatabank = {
+    .name = {
+        "90 deg Elbow, Threaded, Standard Radius (R/D = 1)",
+        "90 deg Elbow, Threaded, Long Radius (R/D = 1)",
+        "90 deg Elbow, Flanged or Welded, Standard Radius (R/D = 1)",
+        "90 deg Elbow, Flanged or Welded, Long Radius (R/D = 2)",
+        "90 deg Elbow, Flanged or Welded, Long Radius (R/D = 4)",
+        "90 deg Elbow, Flanged or Welded, Long Radius (R/D = 6)",
+        "90 deg Elbow, Mitered, 1 weld 90 deg",
+        "90 deg Elbow, Mitered, 2 weld 45 deg",
+        "90 deg Elbow, Mitered, 3 weld 30 deg",
+        "45 deg Elbow, Threaded, Standard Radius (R/D = 1)",
+        "45 deg Elbow, Threaded, Long Radius (R/D = 1.5)",
+        "45 deg Elbow, Mitered, 1 weld 45 deg",
+        "45 deg Elbow, Mitered, 2 weld 22.5 deg",
+        "180 deg Bend, threaded, close-return (R/D = 1)",
+        "180 deg Bend, threaded, flanged (R/D = 1)",
+        "180 deg Bend, threaded, All types (R/D = 1.5)",
+        "Tee Through-branch as an Elbow, threaded (R/D = 1)",
+        "Tee Through-branch as an Elbow, threaded (R/D = 1.5)",
+        "Tee Through-branch as an Elbow, flanged (R/D = 1)",
+        "Tee Through-branch as an Elbow, stub-in branch",
+        "Tee Run-through, threaded (R/D = 1)",
+        "Tee Run-through, flanged (R/D = 1)",
+        "Tee Run-through, stub-in branch",
+        "Angle valve, 45 deg, full line size \\beta = 1",
+        "Angle valve, 90 deg, full line size \\beta = 1",
+        "Globe valve, standard, \\beta = 1",
+        "Plug valve, branch flow",
+        "Plug valve, straight through",
+        "Plug valve, three-way (flow through)",
+        "Gate valve, standard, \\beta = 1",
+        "Ball valve, standard, \\beta = 1",
+        "Diaphragm valve, dam type",
+        "Swing check valve",
+        "Lift check valve"
+    },
+    .note = {
+        [32] = "N.B. V_{min} = 35\\left(\\rho\\frac{(lb_m)}{ft^3} \\right)^{-\\frac{1}{2}}",
+        [33] = "N.B. V_{min} = 40\\left(\\rho\\frac{(lb_m)}{ft^3} \\right)^{-\\frac{1}{2}}"
+    },
+    .k1 = {800, 800, 800, 800, 800, 800, 1000, 800, 800, 500, 500, 500, 500, 1000, 1000, 1000, 500, 800, 800, 1000, 200, 150, 100, 950, 1000, 1500, 500, 300, 300, 300, 300, 1000, 1500, 2000},
+    .kinf = {0.14, 0.071, 0.091, 0.056, 0.066, 0.075, 0.27, 0.068, 0.035, 0.071, 0.052, 0.086, 0.052, 0.23, 0.12, 0.1, 0.274, 0.14, 0.28, 0.34, 0.091, 0.05, 0.0, 0.25, 0.69, 1.7, 0.41, 0.084, 0.14, 0.037, 0.017, 0.69, 0.46, 2.85},
+    .Impkd = {4.0, 4.2, 4.0, 3.9, 3.9, 4.2, 4.0, 4.1, 4.2, 4.2, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 0.0, 4.0, 4.0, 3.6, 4.0, 3.9, 4.0, 3.9, 3.5, 4.9, 4.0, 3.8},
+    .Metkd = {10.6, 11.1, 10.6, 10.3, 10.3, 11.1, 10.6, 10.8, 11.1, 11.1, 10.6, 10.6, 10.6, 10.6, 10.6, 10.6, 10.6, 10.6, 10.6, 10.6, 10.6, 10.6, 0.0, 10.6, 10.6, 9.5, 10.6, 10.3, 10.6, 10.3, 9.2, 12.9, 10.6, 10.0}
+};
+
+const ThreeKDatabase *ThreeKData(void)
 {
-    //  Setting k_1 values
-    input.k1[0] = 800;
-    input.k1[1] = 800;
-    input.k1[2] = 800;
-    input.k1[3] = 800;
-    input.k1[4] = 800;
-    input.k1[5] = 800;
-    input.k1[6] = 1000;
-    input.k1[7] = 800;
-    input.k1[8] = 800;
-    input.k1[9] = 500;
-    input.k1[10] = 500;
-    input.k1[11] = 500;
-    input.k1[12] = 500;
-    input.k1[13] = 1000;
-    input.k1[14] = 1000;
-    input.k1[15] = 1000;
-    input.k1[16] = 500;
-    input.k1[17] = 800;
-    input.k1[18] = 800;
-    input.k1[19] = 1000;
-    input.k1[20] = 200;
-    input.k1[21] = 150;
-    input.k1[22] = 100;
-    input.k1[23] = 950;
-    input.k1[24] = 1000;
-    input.k1[25] = 1500;
-    input.k1[26] = 500;
-    input.k1[27] = 300;
-    input.k1[28] = 300;
-    input.k1[29] = 300;
-    input.k1[30] = 300;
-    input.k1[31] = 1000;
-    input.k1[32] = 1500;
-    input.k1[33] = 2000;
-    
-    //  Setting kinf values
-    input.kinf[0] = 0.14;
-    input.kinf[1] = 0.071;
-    input.kinf[2] = 0.091;
-    input.kinf[3] = 0.056;
-    input.kinf[4] = 0.066;
-    input.kinf[5] = 0.075;
-    input.kinf[6] = 0.27;
-    input.kinf[7] = 0.068;
-    input.kinf[8] = 0.035;
-    input.kinf[9] = 0.071;
-    input.kinf[10] = 0.052;
-    input.kinf[11] = 0.086;
-    input.kinf[12] = 0.052;
-    input.kinf[13] = 0.23;
-    input.kinf[14] = 0.12;
-    input.kinf[15] = 0.1;
-    input.kinf[16] = 0.274;
-    input.kinf[17] = 0.14;
-    input.kinf[18] = 0.28;
-    input.kinf[19] = 0.34;
-    input.kinf[20] = 0.091;
-    input.kinf[21] = 0.05;
-    input.kinf[22] = 0.0;
-    input.kinf[23] = 0.25;
-    input.kinf[24] = 0.69;
-    input.kinf[25] = 1.7;
-    input.kinf[26] = 0.41;
-    input.kinf[27] = 0.084;
-    input.kinf[28] = 0.14;
-    input.kinf[29] = 0.037;
-    input.kinf[30] = 0.017;
-    input.kinf[31] = 0.69;
-    input.kinf[32] = 0.46;
-    input.kinf[33] = 2.85;
-    
-    //  Setting k_d values (inches)
-    input.Impkd[0] = 4.0;
-    input.Impkd[1] = 4.2;
-    input.Impkd[2] = 4.0;
-    input.Impkd[3] = 3.9;
-    input.Impkd[4] = 3.9;
-    input.Impkd[5] = 4.2;
-    input.Impkd[6] = 4.0;
-    input.Impkd[7] = 4.1;
-    input.Impkd[8] = 4.2;
-    input.Impkd[9] = 4.2;
-    input.Impkd[10] = 4.0;
-    input.Impkd[11] = 4.0;
-    input.Impkd[12] = 4.0;
-    input.Impkd[13] = 4.0;
-    input.Impkd[14] = 4.0;
-    input.Impkd[15] = 4.0;
-    input.Impkd[16] = 4.0;
-    input.Impkd[17] = 4.0;
-    input.Impkd[18] = 4.0;
-    input.Impkd[19] = 4.0;
-    input.Impkd[20] = 4.0;
-    input.Impkd[21] = 4.0;
-    input.Impkd[22] = 0.0;
-    input.Impkd[23] = 4.0;
-    input.Impkd[24] = 4.0;
-    input.Impkd[25] = 3.6;
-    input.Impkd[26] = 4.0;
-    input.Impkd[27] = 3.9;
-    input.Impkd[28] = 4.0;
-    input.Impkd[29] = 3.9;
-    input.Impkd[30] = 3.5;
-    input.Impkd[31] = 4.9;
-    input.Impkd[32] = 4.0;
-    input.Impkd[33] = 3.8;
-    
-    //  Setting k_d values (mm)
-    input.Metkd[0] = 10.6;
-    input.Metkd[1] = 11.1;
-    input.Metkd[2] = 10.6;
-    input.Metkd[3] = 10.3;
-    input.Metkd[4] = 10.3;
-    input.Metkd[5] = 11.1;
-    input.Metkd[6] = 10.6;
-    input.Metkd[7] = 10.8;
-    input.Metkd[8] = 11.1;
-    input.Metkd[9] = 11.1;
-    input.Metkd[10] = 10.6;
-    input.Metkd[11] = 10.6;
-    input.Metkd[12] = 10.6;
-    input.Metkd[13] = 10.6;
-    input.Metkd[14] = 10.6;
-    input.Metkd[15] = 10.6;
-    input.Metkd[16] = 10.6;
-    input.Metkd[17] = 10.6;
-    input.Metkd[18] = 10.6;
-    input.Metkd[19] = 10.6;
-    input.Metkd[20] = 10.6;
-    input.Metkd[21] = 10.6;
-    input.Metkd[22] = 0.0;
-    input.Metkd[23] = 10.6;
-    input.Metkd[24] = 10.6;
-    input.Metkd[25] = 9.5;
-    input.Metkd[26] = 10.6;
-    input.Metkd[27] = 10.3;
-    input.Metkd[28] = 10.6;
-    input.Metkd[29] = 10.3;
-    input.Metkd[30] = 9.2;
-    input.Metkd[31] = 12.9;
-    input.Metkd[32] = 10.6;
-    input.Metkd[33] = 10.0;
-    
-    return input;
+    return &ThreeKDatabank;
 }
 
-/// MARK: GENERAL CALCULATION
-ThreeKFittings ThreeKVariable(ThreeKFittings table, double *DN, double *rho, double *u, double *d, double *mu)
+/// MARK: VARIABLE INPUT
+void ThreeKVariable(ThreeKFittings *table, double *DN, double *rho, double *u, double *d, double *mu)
 {
     char input[maxstrlen];  // Variable used to store keyboard input.
     int control = 0;          // Variable used to control user input.
-    
-    
-    //  Loading in the 3K database
-    table = ThreeKData(table);
+    const ThreeKDatabase *db = ThreeKData();
     
     //  Getting variables to calculate Reynolds number
     *rho = inputDouble(0, 0, "fluid density", "kg/m3");
@@ -222,111 +123,15 @@ ThreeKFittings ThreeKVariable(ThreeKFittings table, double *DN, double *rho, dou
     }
     *d = (*d)*0.001; //Conversion (mm to m)
     
-    printf("90 deg Elbow, Threaded, Standard Radius (R/D = 1): ");
-    table.count[0] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("90 deg Elbow, Threaded, Long Radius (R/D = 1): ");
-    table.count[1] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("90 deg Elbow, Flanged or Welded, Standard Radius (R/D = 1): ");
-    table.count[2] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("90 deg Elbow, Flanged or Welded, Long Radius (R/D = 2): ");
-    table.count[3] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("90 deg Elbow, Flanged or Welded, Long Radius (R/D = 4): ");
-    table.count[4] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("90 deg Elbow, Flanged or Welded, Long Radius (R/D = 6): ");
-    table.count[5] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("90 deg Elbow, Mitered, 1 weld 90 deg: ");
-    table.count[6] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("90 deg Elbow, Mitered, 2 weld 45 deg: ");
-    table.count[7] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("90 deg Elbow, Mitered, 3 weld 30 deg: ");
-    table.count[8] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("45 deg Elbow, Threaded, Standard Radius (R/D = 1): ");
-    table.count[9] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("45 deg Elbow, Threaded, Long Radius (R/D = 1.5): ");
-    table.count[10] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("45 deg Elbow, Mitered, 1 weld 45 deg: ");
-    table.count[11] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("45 deg Elbow, Mitered, 2 weld 22.5 deg: ");
-    table.count[12] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("180 deg Bend, threaded, close-return (R/D = 1): ");
-    table.count[13] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("180 deg Bend, threaded, flanged (R/D = 1): ");
-    table.count[14] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("180 deg Bend, threaded, All types (R/D = 1.5): ");
-    table.count[15] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Tee Through-branch as an Elbow, threaded (R/D = 1): ");
-    table.count[16] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Tee Through-branch as an Elbow, threaded (R/D = 1.5): ");
-    table.count[17] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Tee Through-branch as an Elbow, flanged (R/D = 1): ");
-    table.count[18] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Tee Through-branch as an Elbow, stub-in branch: ");
-    table.count[19] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Tee Run-through, threaded (R/D = 1): ");
-    table.count[20] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Tee Run-through, flanged (R/D = 1): ");
-    table.count[21] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Tee Run-through, stub-in branch: ");
-    table.count[22] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Angle valve, 45 deg, full line size \\beta = 1: ");
-    table.count[23] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Angle valve, 90 deg, full line size \\beta = 1: ");
-    table.count[24] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Globe valve, standard, \\beta = 1: ");
-    table.count[25] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Plug valve, branch flow: ");
-    table.count[26] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Plug valve, straight through: ");
-    table.count[27] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Plug valve, three-way (flow through): ");
-    table.count[28] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Gate valve, standard, \\beta = 1: ");
-    table.count[29] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Ball valve, standard, \\beta = 1: ");
-    table.count[30] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Diaphragm valve, dam type: ");
-    table.count[31] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("N.B. V_{min} = 35\\left(\\rho\\frac{(lb_m)}{ft^3} \\right)^{-\\frac{1}{2}}\n");
-    printf("Swing check valve Type: Vmin = 40: ");
-    table.count[32] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("N.B. V_{min} = 40\\left(\\rho\\frac{(lb_m)}{ft^3} \\right)^{-\\frac{1}{2}}\n");
-    printf("Lift check valve, Type: Vmin = 40: ");
-    table.count[33] = atoi(fgets(input, sizeof(input), stdin));
-    
-    return table;
+    for(int i = 0; i < ThreeKCount; ++i)
+    {
+        if(db->note[i] != NULL)
+        {
+            printf("%s\n", db->note[i]);
+        }
+        printf("%s: ", db->name[i]);
+        table->count[i] = atoi(fgets(input, sizeof(input), stdin));
+    }
 }
 
 /// MARK: GENERAL CALCULATIONS
@@ -372,26 +177,35 @@ double ThreeKCalculatePLoss(double h, double rho)
 }
 
 /// MARK: ARRAY FUNCTION
-ThreeKFittings ThreeKFinalTable(ThreeKFittings data, double rho, double u, double d, double mu, double DN, double *Re)
+void ThreeKFinalTable(ThreeKFittings *data, double rho, double u, double d, double mu, double DN, double *Re)
 {
-    double ReyNo = 0.0;
+    const ThreeKDatabase *db = ThreeKData();
+    double invRe = 0.0;     // Reciprocal of the Reynolds number.
+    double invDN = 0.0;     // Reciprocal of the nominal diameter term, 1/D_n^0.3.
+    double vhead = 0.0;     // Velocity head (m).
     
     *Re = ReynoldsNum(rho, u, d, mu);
-    ReyNo = (*Re);
     
-    for(int i = 0; i < 34; ++i)
+    //  Terms shared by every fitting are evaluated once.
+    invRe = 1/(*Re);
+    invDN = pow(DN, 0.3);
+    invDN = 1/(invDN);
+    vhead = pow(u, 2);
+    vhead = (vhead)/(2*g);
+    
+    for(int i = 0; i < ThreeKCount; ++i)
     {
-        data.headloss[i] = ThreeKCalculateHead(data.count[i], ThreeKCalculateK(ReyNo, DN, data.k1[i], data.kinf[i], data.Metkd[i]), u);
-        data.dP_f[i] = ThreeKCalculatePLoss(data.headloss[i], rho);
+        double K = db->k1[i]*invRe + db->kinf[i]*(1 + db->Metkd[i]*invDN);
+        
+        data->headloss[i] = data->count[i]*K*vhead;
+        data->dP_f[i] = rho*g*data->headloss[i];
     }
-    
-    return data;
 }
 
 /// MARK: DISPLAY AND WRITE
-void ThreeKDisplay(ThreeKFittings data, double rho, double u, double d, double mu, double Re, double DN, double TotalH, double TotalP)
+void ThreeKDisplay(const ThreeKFittings *data, double rho, double u, double d, double mu, double Re, double DN, double TotalH, double TotalP)
 {
-    int i = 0;
+    const ThreeKDatabase *db = ThreeKData();
     
     printf("Inputted parameters.\n");
     printf("Fluid density:\n");
@@ -418,776 +232,87 @@ void ThreeKDisplay(ThreeKFittings data, double rho, double u, double d, double m
     printf("h_L = K \\frac{u^2}{2*g}\n");
     printf("Fitting\tK_1\tK_inf\tK_d (in^{0.3})\tK_d (mm^{0.3})\tCount\tHead loss (m)\tdP_f (Pa)");
     
-    i = 0;
-    printf("90 deg Elbow, Threaded, Standard Radius (R/D = 1)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("90 deg Elbow, Threaded, Long Radius (R/D = 1)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("90 deg Elbow, Flanged or Welded, Standard Radius (R/D = 1)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("90 deg Elbow, Flanged or Welded, Long Radius (R/D = 2)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("90 deg Elbow, Flanged or Welded, Long Radius (R/D = 4)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("90 deg Elbow, Flanged or Welded, Long Radius (R/D = 6)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("90 deg Elbow, Mitered, 1 weld 90 deg\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("90 deg Elbow, Mitered, 2 weld 45 deg\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("90 deg Elbow, Mitered, 3 weld 30 deg\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("45 deg Elbow, Threaded, Standard Radius (R/D = 1)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("45 deg Elbow, Threaded, Long Radius (R/D = 1.5)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("45 deg Elbow, Mitered, 1 weld 45 deg\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("45 deg Elbow, Mitered, 2 weld 22.5 deg\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("180 deg Bend, threaded, close-return (R/D = 1)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("180 deg Bend, threaded, flanged (R/D = 1)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("180 deg Bend, threaded, All types (R/D = 1.5)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("Tee Through-branch as an Elbow, threaded (R/D = 1)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("Tee Through-branch as an Elbow, threaded (R/D = 1.5)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("Tee Through-branch as an Elbow, flanged (R/D = 1)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("Tee Through-branch as an Elbow, stub-in branch\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("Tee Run-through, threaded (R/D = 1)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("Tee Run-through, flanged (R/D = 1)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("Tee Run-through, stub-in branch\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("Angle valve, 45 deg, full line size \\beta = 1\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("Angle valve, 90 deg, full line size \\beta = 1\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("Globe valve, standard, \\beta = 1\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("Plug valve, branch flow\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("Plug valve, straight through\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("Plug valve, three-way (flow through)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("Gate valve, standard, \\beta = 1\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("Ball valve, standard, \\beta = 1\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("Diaphragm valve, dam type\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("Swing check valve\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\t", data.dP_f[i]);
-    printf("N.B. V_{min} = 35\\left(\\frac{(lb_m)}{ft^3} \\right)^{-\\frac{1}{2}}\n");
-    ++i;
-    
-    printf("Lift check valve\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.3f\t", data.kinf[i]);
-    printf("%.1f\t", data.Impkd[i]);
-    printf("%.1f\t", data.Metkd[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\t", data.dP_f[i]);
-    printf("N.B. V_{min} = 40\\left(\\frac{(lb_m)}{ft^3} \\right)^{-\\frac{1}{2}}\n");
+    for(int i = 0; i < ThreeKCount; ++i)
+    {
+        printf("%s\t", db->name[i]);
+        printf("%i\t", db->k1[i]);
+        printf("%.3f\t", db->kinf[i]);
+        printf("%.1f\t", db->Impkd[i]);
+        printf("%.1f\t", db->Metkd[i]);
+        printf("%i\t", data->count[i]);
+        printf("%.3f\t", data->headloss[i]);
+        printf("%.3f", data->dP_f[i]);
+        if(db->note[i] != NULL)
+        {
+            printf("\t%s", db->note[i]);
+        }
+        printf("\n");
+    }
     fflush(stdout);
 }
 
-void ThreeKWrite(ThreeKFittings data, double rho, double u, double d, double mu, double Re, double DN, double TotalH, double TotalP)
+void ThreeKWrite(const ThreeKFittings *data, double rho, double u, double d, double mu, double Re, double DN, double TotalH, double TotalP)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
+    const ThreeKDatabase *db = ThreeKData();
     
-    FILE *fp;                   // Pointer to the file location.
     //  Set file name as timestamp + 3K Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " 3K Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, "3K Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
-    fprintf(fp, "_Pressure_Loss_Through_Pipe_Fittings_(3K_Method)_Results_\n");
-    int i = 0;
-    
-    fprintf(fp, "Inputted parameters.\n");
-    fprintf(fp, "Fluid density:\n");
-    fprintf(fp, "rho =\t%.3f\tkg/m3\n", rho);
-    fprintf(fp, "Fluid velocity:\n");
-    fprintf(fp, "u =\t%.3f\tkg/m3\n", u);
-    fprintf(fp, "Fluid viscosity:\n");
-    fprintf(fp, "mu =\t%.3f\tcP\n\n", mu*1000);
-    
-    fprintf(fp, "Internal pipe diameter:\n");
-    fprintf(fp, "d =\t%.3f\tmm\n", d*1000);
-    fprintf(fp, "Diameter Nominal:\n");
-    fprintf(fp, "DN\t%.0f\t(mm)\n\n", DN);
-    
-    fprintf(fp, "Reynold's number:\n");
-    fprintf(fp, "Re =\t%.0f\t[ ]\n\n", Re);
-    
-    fprintf(fp, "Total head loss:\n");
-    fprintf(fp, "total =\t%.3f\tm\n\n", TotalH);
-    fprintf(fp, "Total pressure loss:\n");
-    fprintf(fp, "total =\t%.3f\tPa\n\n", TotalP);
-    
-    fprintf(fp, "K = \\frac{ K_1 }{ \\textrm{Re} } + K_{ \\infty }\\left(1 + \\frac{K_d}{D_n^{0.3}}\\right)\n");
-    fprintf(fp, "h_L = K \\frac{u^2}{2*g}\n");
-    fprintf(fp, "Fitting\tK_1\tK_inf\tK_d (in^{0.3})\tK_d (mm^{0.3})\tCount\tHead loss (m)\n");
-    
-    i = 0;
-    fprintf(fp, "90 deg Elbow, Threaded, Standard Radius (R/D = 1)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "90 deg Elbow, Threaded, Long Radius (R/D = 1)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "90 deg Elbow, Flanged or Welded, Standard Radius (R/D = 1)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "90 deg Elbow, Flanged or Welded, Long Radius (R/D = 2)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "90 deg Elbow, Flanged or Welded, Long Radius (R/D = 4)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "90 deg Elbow, Flanged or Welded, Long Radius (R/D = 6)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "90 deg Elbow, Mitered, 1 weld 90 deg\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "90 deg Elbow, Mitered, 2 weld 45 deg\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "90 deg Elbow, Mitered, 3 weld 30 deg\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "45 deg Elbow, Threaded, Standard Radius (R/D = 1)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "45 deg Elbow, Threaded, Long Radius (R/D = 1.5)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "45 deg Elbow, Mitered, 1 weld 45 deg\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "45 deg Elbow, Mitered, 2 weld 22.5 deg\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "180 deg Bend, threaded, close-return (R/D = 1)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "180 deg Bend, threaded, flanged (R/D = 1)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "180 deg Bend, threaded, All types (R/D = 1.5)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "Tee Through-branch as an Elbow, threaded (R/D = 1)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "Tee Through-branch as an Elbow, threaded (R/D = 1.5)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "Tee Through-branch as an Elbow, flanged (R/D = 1)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "Tee Through-branch as an Elbow, stub-in branch\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "Tee Run-through, threaded (R/D = 1)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "Tee Run-through, flanged (R/D = 1)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "Tee Run-through, stub-in branch\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "Angle valve, 45 deg, full line size \\beta = 1\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "Angle valve, 90 deg, full line size \\beta = 1\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "Globe valve, standard, \\beta = 1\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "Plug valve, branch flow\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "Plug valve, straight through\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "Plug valve, three-way (flow through)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "Gate valve, standard, \\beta = 1\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "Ball valve, standard, \\beta = 1\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "Diaphragm valve, dam type\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "Swing check valve\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\t", data.dP_f[i]);
-    fprintf(fp, "N.B. V_{min} = 35\\left(\\frac{(lb_m)}{ft^3} \\right)^{-\\frac{1}{2}}\n");
-    ++i;
-    
-    fprintf(fp, "Lift check valve\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.3f\t", data.kinf[i]);
-    fprintf(fp, "%.1f\t", data.Impkd[i]);
-    fprintf(fp, "%.1f\t", data.Metkd[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\t", data.dP_f[i]);
-    fprintf(fp, "N.B. V_{min} = 40\\left(\\frac{(lb_m)}{ft^3} \\right)^{-\\frac{1}{2}}\n");
+    writerPrintf(&w, "_Pressure_Loss_Through_Pipe_Fittings_(3K_Method)_Results_\n");
+    
+    writerPrintf(&w, "Inputted parameters.\n");
+    writerPrintf(&w, "Fluid density:\n");
+    writerPrintf(&w, "rho =\t%.3f\tkg/m3\n", rho);
+    writerPrintf(&w, "Fluid velocity:\n");
+    writerPrintf(&w, "u =\t%.3f\tkg/m3\n", u);
+    writerPrintf(&w, "Fluid viscosity:\n");
+    writerPrintf(&w, "mu =\t%.3f\tcP\n\n", mu*1000);
+    
+    writerPrintf(&w, "Internal pipe diameter:\n");
+    writerPrintf(&w, "d =\t%.3f\tmm\n", d*1000);
+    writerPrintf(&w, "Diameter Nominal:\n");
+    writerPrintf(&w, "DN\t%.0f\t(mm)\n\n", DN);
+    
+    writerPrintf(&w, "Reynold's number:\n");
+    writerPrintf(&w, "Re =\t%.0f\t[ ]\n\n", Re);
+    
+    writerPrintf(&w, "Total head loss:\n");
+    writerPrintf(&w, "total =\t%.3f\tm\n\n", TotalH);
+    writerPrintf(&w, "Total pressure loss:\n");
+    writerPrintf(&w, "total =\t%.3f\tPa\n\n", TotalP);
+    
+    writerPrintf(&w, "K = \\frac{ K_1 }{ \\textrm{Re} } + K_{ \\infty }\\left(1 + \\frac{K_d}{D_n^{0.3}}\\right)\n");
+    writerPrintf(&w, "h_L = K \\frac{u^2}{2*g}\n");
+    writerPrintf(&w, "Fitting\tK_1\tK_inf\tK_d (in^{0.3})\tK_d (mm^{0.3})\tCount\tHead loss (m)\n");
+    
+    for(int i = 0; i < ThreeKCount; ++i)
+    {
+        writerPrintf(&w, "%s\t", db->name[i]);
+        writerPrintf(&w, "%i\t", db->k1[i]);
+        writerPrintf(&w, "%.3f\t", db->kinf[i]);
+        writerPrintf(&w, "%.1f\t", db->Impkd[i]);
+        writerPrintf(&w, "%.1f\t", db->Metkd[i]);
+        writerPrintf(&w, "%i\t", data->count[i]);
+        writerPrintf(&w, "%.3f\t", data->headloss[i]);
+        writerPrintf(&w, "%.3f", data->dP_f[i]);
+        if(db->note[i] != NULL)
+        {
+            writerPrintf(&w, "\t%s", db->note[i]);
+        }
+        writerPrintf(&w, "\n");
+    }
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
-void ThreeKWriteSwitch(ThreeKFittings data, double rho, double u, double d, double mu, double Re, double DN, double TotalH, double TotalP)
+void ThreeKWriteSwitch(const ThreeKFittings *data, double rho, double u, double d, double mu, double Re, double DN, double TotalH, double TotalP)
 {
     int control = 0;
     
@@ -1244,16 +369,16 @@ void ThreeK()
     printf("Source: https://neutrium.net/fluid-flow/pressure-loss-from-fittings-3k-method/\n");
     
     //  Collecting data
-    *ThreeKTable = ThreeKVariable(*ThreeKTable, &DN, &rho, &u, &d, &mu);
+    ThreeKVariable(ThreeKTable, &DN, &rho, &u, &d, &mu);
     printf("\n");
     
     //  Performing calculations
     clock_getres(CLOCK_MONOTONIC, &start);
     clock_gettime(CLOCK_MONOTONIC, &start);
     
-    *ThreeKTable = ThreeKFinalTable(*ThreeKTable, rho, u, d, mu, DN, &Re);
+    ThreeKFinalTable(ThreeKTable, rho, u, d, mu, DN, &Re);
     
-    for(int i = 0; i < 34; ++i)
+    for(int i = 0; i < ThreeKCount; ++i)
     {
         TotalH += ThreeKTable->headloss[i];
         TotalP += ThreeKTable->dP_f[i];
@@ -1266,9 +391,9 @@ void ThreeK()
     printf("Calculations completed in %.6f seconds.\n", elapsed);
     
     //  Displaying results
-    ThreeKDisplay(*ThreeKTable, rho, u, d, mu, Re, DN, TotalH, TotalP);
+    ThreeKDisplay(ThreeKTable, rho, u, d, mu, Re, DN, TotalH, TotalP);
     
     //  Writing results
-    ThreeKWriteSwitch(*ThreeKTable, rho, u, d, mu, Re, DN, TotalH, TotalP);
+    ThreeKWriteSwitch(ThreeKTable, rho, u, d, mu, Re, DN, TotalH, TotalP);
     free(ThreeKTable);
 }
@@ -22,33 +22,39 @@
 #ifndef ThreeKStruct
 #define ThreeKStruct
 
+#define ThreeKCount 34
+
+typedef struct ThreeKDatabase{
+    const char *name[ThreeKCount];  // Fitting description.
+    const char *note[ThreeKCount];  // Usage note displayed alongside the fitting (NULL where none applies).
+    int k1[ThreeKCount];            // Resistance coefficient at Re = 1.
+    double kinf[ThreeKCount];       // Resistance coefficient at Re = infinity.
+    double Impkd[ThreeKCount];      // Diameter coefficient for imperial sizing (in^0.3).
+    double Metkd[ThreeKCount];      // Diameter coefficient for metric sizing (mm^0.3).
+} ThreeKDatabase;
+
 typedef struct ThreeKFittings{
-    int k1[34];
-    double kinf[34];
-    double Impkd[34];
-    double Metkd[34];
-    int count[34];
-    double headloss[34];
-    double dP_f[34];
-}ThreeKFittings;
+    int count[ThreeKCount];         // Number of each fitting in the line.
+    double headloss[ThreeKCount];   // Head loss through each fitting type (m).
+    double dP_f[ThreeKCount];       // Pressure loss through each fitting type (Pa).
+} ThreeKFittings;
 
 #endif /* ThreeKStruct */
 
 #ifndef ThreeKData_h
 #define ThreeKData_h
 
-/// This subroutine is used to load the 3K database into the struct stated above.
-/// @param input Struct where constants should be entered.
-ThreeKFittings ThreeKData(ThreeKFittings input);
+/// This subroutine is used to access the read-only 3K database.
+const ThreeKDatabase *ThreeKData(void);
 
 /// This subroutine is used to collect the variables required to run the calculations.
-/// @param table Struct where model constants and counts should be entered.
+/// @param table Struct where fitting counts should be entered.
 /// @param DN Diameter Nominal (mm)
 /// @param rho Fluid density (kg/ m3) - For Reynolds number.
 /// @param u Fluid velocity (m/ s) - For Reynolds number and 3K.
 /// @param d Internal pipe diameter (mm) - For Reynolds number.
 /// @param mu Fluid viscosity (cP) - For Reynolds number.
-ThreeKFittings ThreeKVariable(ThreeKFittings table, double *DN, double *rho, double *u, double *d, double *mu);
+void ThreeKVariable(ThreeKFittings *table, double *DN, double *rho, double *u, double *d, double *mu);
 
 #endif /* ThreeKData_h */
 
@@ -82,7 +88,7 @@ double ThreeKCalculatePLoss(double h, double rho);
 /// @param mu Fluid viscosity (Pa. s)
 /// @param DN Diameter Nominal
 /// @param Re Reynolds number ([ ])
-ThreeKFittings ThreeKFinalTable(ThreeKFittings data, double rho, double u, double d, double mu, double DN, double *Re);
+void ThreeKFinalTable(ThreeKFittings *data, double rho, double u, double d, double mu, double DN, double *Re);
 
 #endif /* ThreeKCalc_h */
 
@@ -99,7 +105,7 @@ ThreeKFittings ThreeKFinalTable(ThreeKFittings data, double rho, double u, doubl
 /// @param DN Diameter Nominal (mm)
 /// @param TotalH Total head loss (m)
 /// @param TotalP Total pressure loss (Pa)
-void ThreeKDisplay(ThreeKFittings data, double rho, double u, double d, double mu, double Re, double DN, double TotalH, double TotalP);
+void ThreeKDisplay(const ThreeKFittings *data, double rho, double u, double d, double mu, double Re, double DN, double TotalH, double TotalP);
 
 #endif /* ThreeKDisplay_h */
 
@@ -116,7 +122,7 @@ void ThreeKDisplay(ThreeKFittings data, double rho, double u, double d, double m
 /// @param DN Diameter Nominal (mm)
 /// @param TotalH Total head loss (m)
 /// @param TotalP Total pressure loss (Pa)
-void ThreeKWrite(ThreeKFittings data, double rho, double u, double d, double mu, double Re, double DN, double TotalH, double TotalP);
+void ThreeKWrite(const ThreeKFittings *data, double rho, double u, double d, double mu, double Re, double DN, double TotalH, double TotalP);
 
 /// This subroutine is used to check if the user would like to write the generated dataset and collected parameters to a file.
 /// @param data Generated data table.
@@ -128,7 +134,7 @@ void ThreeKWrite(ThreeKFittings data, double rho, double u, double d, double mu,
 /// @param DN Diameter Nominal (mm)
 /// @param TotalH Total head loss (m)
 /// @param TotalP Total pressure loss (Pa)
-void ThreeKWriteSwitch(ThreeKFittings data, double rho, double u, double d, double mu, double Re, double DN, double TotalH, double TotalP);
+void ThreeKWriteSwitch(const ThreeKFittings *data, double rho, double u, double d, double mu, double Re, double DN, double TotalH, double TotalP);
 
 #endif /* ThreeKWrite_h */
 
@@ -29,6 +29,7 @@
 
 //  Custom header files
 #include "System.h"
+#include "ResultWriter.h"
 #include "DimensionlessNum.h"
 #include "03dTwoK.h"
 
@@ -37,103 +38,55 @@
 #define g 9.80665
 
 /// MARK: DATA BANK
-TwoKFittings TwoKData(TwoKFittings input)
+static const TwoKDatabase TwoKDatabank = {
+    .name = {
+        "90 deg Elbow, Threaded (Standard Radius) (R/D = 1)",
+        "90 deg Elbow, Flanged/Welded (Standard Radius) (R/D = 1)",
+        "90 deg Elbow, All types (Long Radius) (R/D = 1.5)",
+        "90 deg Elbow Mitered (R/D = 1.5), 1 Weld (90 deg angle)",
+        "90 deg Elbow Mitered (R/D = 1.5), 2 Weld (45 deg angle)",
+        "90 deg Elbow Mitered (R/D = 1.5), 3 Weld (30 deg angle)",
+        "90 deg Elbow Mitered (R/D = 1.5), 4 Weld (22.5 deg angle)",
+        "90 deg Elbow Mitered (R/D = 1.5), 5 Weld (18 deg angle)",
+        "45 deg Elbow, All types (Standard Radius) (R/D = 1)",
+        "45 deg Elbow, All types (Long Radius) (R/D = 1.5)",
+        "45 deg Elbow Mitered, 1 Weld (45 deg angle)",
+        "45 deg Elbow Mitered, 2 Weld (45 deg angle)",
+        "180 deg bend, Screwed (Standard Radius) (R/D = 1)",
+        "180 deg bend, Flanged/Welded (Standard Radius) (R/D = 1)",
+        "180 deg bend, All types (Long Radius) (R/D = 1.5)",
+        "Tee (used as elbow), Screwed (Standard Radius) (R/D = 1)",
+        "Tee (used as elbow), Screwed (Long Radius)",
+        "Tee (used as elbow), Flanged/Welded (Standard Radius) (R/D = 1)",
+        "Tee (used as elbow), Stub-in-type Branch",
+        "Tee (Run Through), Screwed",
+        "Tee (Run Through), Flanged/Welded",
+        "Tee (Run Through), Stub-in-type Branch",
+        "Valves (Gate/ Ball/ Plug), Full Line Size (Beta = 1)",
+        "Valves (Gate/ Ball/ Plug), Reduced Trim (Beta = 0.9)",
+        "Valves (Gate/ Ball/ Plug), Reduced Trum (Beta = 0.8)",
+        "Globe Valve, Standard",
+        "Globe Valve, Angle",
+        "Diaphragm Valve, Dam Type",
+        "Butterfly Valve",
+        "Check Valves, Lift",
+        "Check Valves, Swing",
+        "Check Valves, Tilting-disk"
+    },
+    .k1 = {800, 800, 800, 1000, 800, 800, 800, 800, 500, 500, 500, 500, 1000, 1000, 1000, 500, 800, 800, 1000, 200, 150, 100, 300, 500, 1000, 1500, 1000, 1000, 800, 2000, 1500, 1000},
+    .kinf = {0.4, 0.25, 0.2, 1.15, 0.35, 0.3, 0.27, 0.25, 0.2, 0.15, 0.25, 0.15, 0.6, 0.35, 0.3, 0.7, 0.4, 0.8, 1.0, 0.1, 0.05, 0.0, 0.1, 0.15, 0.25, 4.0, 2.0, 2.0, 0.25, 10.0, 1.5, 0.5}
+};
+
+const TwoKDatabase *TwoKData(void)
 {
-    //  Loading k_1 values
-    input.k1[0] = 800;
-    input.k1[1] = 800;
-    input.k1[2] = 800;
-    
-    input.k1[3] = 1000;
-    input.k1[4] = 800;
-    input.k1[5] = 800;
-    input.k1[6] = 800;
-    input.k1[7] = 800;
-    
-    input.k1[8] = 500;
-    input.k1[9] = 500;
-    
-    input.k1[10] = 500;
-    input.k1[11] = 500;
-    
-    input.k1[12] = 1000;
-    input.k1[13] = 1000;
-    input.k1[14] = 1000;
-    
-    input.k1[15] = 500;
-    input.k1[16] = 800;
-    input.k1[17] = 800;
-    input.k1[18] = 1000;
-    
-    input.k1[19] = 200;
-    input.k1[20] = 150;
-    input.k1[21] = 100;
-    
-    input.k1[22] = 300;
-    input.k1[23] = 500;
-    input.k1[24] = 1000;
-    
-    input.k1[25] = 1500;
-    input.k1[26] = 1000;
-    input.k1[27] = 1000;
-    input.k1[28] = 800;
-    
-    input.k1[29] = 2000;
-    input.k1[30] = 1500;
-    input.k1[31] = 1000;
-    
-    //  Loading k_inf values
-    input.kinf[0] = 0.4;
-    input.kinf[1] = 0.25;
-    input.kinf[2] = 0.2;
-    
-    input.kinf[3] = 1.15;
-    input.kinf[4] = 0.35;
-    input.kinf[5] = 0.3;
-    input.kinf[6] = 0.27;
-    input.kinf[7] = 0.25;
-    
-    input.kinf[8] = 0.2;
-    input.kinf[9] = 0.15;
-    
-    input.kinf[10] = 0.25;
-    input.kinf[11] = 0.15;
-    
-    input.kinf[12] = 0.6;
-    input.kinf[13] = 0.35;
-    input.kinf[14] = 0.3;
-    
-    input.kinf[15] = 0.7;
-    input.kinf[16] = 0.4;
-    input.kinf[17] = 0.8;
-    input.kinf[18] = 1;
-    
-    input.kinf[19] = 0.1;
-    input.kinf[20] = 0.05;
-    input.kinf[21] = 0;
-    
-    input.kinf[22] = 0.1;
-    input.kinf[23] = 0.15;
-    input.kinf[24] = 0.25;
-    
-    input.kinf[25] = 4;
-    input.kinf[26] = 2;
-    input.kinf[27] = 2;
-    input.kinf[28] = 0.25;
-    
-    input.kinf[29] = 10;
-    input.kinf[30] = 1.5;
-    input.kinf[31] = 0.5;
-    
-    return input;
+    return &TwoKDatabank;
 }
 
 /// MARK: VARIABLE INPUT
-TwoKFittings TwoKVariable(TwoKFittings table, double *rho, double *u, double *d, double *mu, double *Impd)
+void TwoKVariable(TwoKFittings *table, double *rho, double *u, double *d, double *mu, double *Impd)
 {
     char input[maxstrlen];  // Variable used to store character input.
-    
-    table = TwoKData(table);
+    const TwoKDatabase *db = TwoKData();
     
     *rho = inputDouble(0, 0, "fluid density", "kg/m3");
     
@@ -149,81 +102,11 @@ TwoKFittings TwoKVariable(TwoKFittings table, double *rho, double *u, double *d,
     *d = (*d)*0.01; // Conversion to m
     
     printf("\nPlease enter the counts of each fitting:\n");
-    printf("90 deg Elbow, Threaded (Standard Radius) (R/D = 1): ");
-    table.count[0] = atoi(fgets(input, sizeof(input), stdin));
-    printf("90 deg Elbow, Flanged/Welded (Standard Radius) (R/D = 1): ");
-    table.count[1] = atoi(fgets(input, sizeof(input), stdin));
-    printf("90 deg Elbow, All types (Long Radius) (R/D = 1.5): ");
-    table.count[2] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("90 deg Elbow Mitered (R/D = 1.5), 1 Weld (90 deg angle): ");
-    table.count[3] = atoi(fgets(input, sizeof(input), stdin));
-    printf("90 deg Elbow Mitered (R/D = 1.5), 2 Weld (45 deg angle): ");
-    table.count[4] = atoi(fgets(input, sizeof(input), stdin));
-    printf("90 deg Elbow Mitered (R/D = 1.5), 3 Weld (30 deg angle): ");
-    table.count[5] = atoi(fgets(input, sizeof(input), stdin));
-    printf("90 deg Elbow Mitered (R/D = 1.5), 4 Weld (22.5 deg angle): ");
-    table.count[6] = atoi(fgets(input, sizeof(input), stdin));
-    printf("90 deg Elbow Mitered (R/D = 1.5), 5 Weld (18 deg angle): ");
-    table.count[7] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("45 deg Elbow, All types (Standard Radius) (R/D = 1): ");
-    table.count[8] = atoi(fgets(input, sizeof(input), stdin));
-    printf("45 deg Elbow, All types (Long Radius) (R/D = 1.5): ");
-    table.count[9] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("45 deg Elbow Mitered, 1 Weld (45 deg angle): ");
-    table.count[10] = atoi(fgets(input, sizeof(input), stdin));
-    printf("45 deg Elbow Mitered, 2 Weld (45 deg angle): ");
-    table.count[11] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("180 deg bend, Screwed (Standard Radius) (R/D = 1): ");
-    table.count[12] = atoi(fgets(input, sizeof(input), stdin));
-    printf("180 deg bend, Flanged/Welded (Standard Radius) (R/D = 1): ");
-    table.count[13] = atoi(fgets(input, sizeof(input), stdin));
-    printf("180 deg bend, All types (Long Radius) (R/D = 1.5): ");
-    table.count[14] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Tee (used as elbow), Screwed (Standard Radius) (R/D = 1): ");
-    table.count[15] = atoi(fgets(input, sizeof(input), stdin));
-    printf("Tee (used as elbow), Screwed (Long Radius): ");
-    table.count[16] = atoi(fgets(input, sizeof(input), stdin));
-    printf("Tee (used as elbow), Flanged/Welded (Standard Radius) (R/D = 1): ");
-    table.count[17] = atoi(fgets(input, sizeof(input), stdin));
-    printf("Tee (used as elbow), Stub-in-type Branch: ");
-    table.count[18] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Tee (Run Through), Screwed: ");
-    table.count[19] = atoi(fgets(input, sizeof(input), stdin));
-    printf("Tee (Run Through), Flanged/Welded: ");
-    table.count[20] = atoi(fgets(input, sizeof(input), stdin));
-    printf("Tee (Run Through), Stub-in-type Branch: ");
-    table.count[21] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Valves (Gate/ Ball/ Plug), Full Line Size (Beta = 1): ");
-    table.count[22] = atoi(fgets(input, sizeof(input), stdin));
-    printf("Valves (Gate/ Ball/ Plug), Reduced Trim (Beta = 0.9): ");
-    table.count[23] = atoi(fgets(input, sizeof(input), stdin));
-    printf("Valves (Gate/ Ball/ Plug), Reduced Trum (Beta = 0.8): ");
-    table.count[24] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Globe Valve, Standard: ");
-    table.count[25] = atoi(fgets(input, sizeof(input), stdin));
-    printf("Globe Valve, Angle: ");
-    table.count[26] = atoi(fgets(input, sizeof(input), stdin));
-    printf("Diaphragm Valve, Dam Type: ");
-    table.count[27] = atoi(fgets(input, sizeof(input), stdin));
-    printf("Butterfly Valve: ");
-    table.count[28] = atoi(fgets(input, sizeof(input), stdin));
-    
-    printf("Check Valves, Lift: ");
-    table.count[29] = atoi(fgets(input, sizeof(input), stdin));
-    printf("Check Valves, Swing: ");
-    table.count[30] = atoi(fgets(input, sizeof(input), stdin));
-    printf("Check Valves, Tilting-disk: ");
-    table.count[31] = atoi(fgets(input, sizeof(input), stdin));
-    
-    return table;
+    for(int i = 0; i < TwoKCount; ++i)
+    {
+        printf("%s: ", db->name[i]);
+        table->count[i] = atoi(fgets(input, sizeof(input), stdin));
+    }
 }
 
 /// MARK: GENERAL CALCULATIONS
@@ -265,25 +148,35 @@ double TwoKCalculatePLoss(double h, double rho)
 }
 
 /// MARK: ARRAY FUNCTION
-TwoKFittings TwoKFinalTable(TwoKFittings data, double rho, double u, double d, double mu, double Impd, double *Re)
+void TwoKFinalTable(TwoKFittings *data, double rho, double u, double d, double mu, double Impd, double *Re)
 {
-    double ReyNum = 0.0;
+    const TwoKDatabase *db = TwoKData();
+    double invRe = 0.0;     // Reciprocal of the Reynolds number.
+    double sizeterm = 0.0;  // Pipe size correction, (1 + 1/D).
+    double vhead = 0.0;     // Velocity head (m).
+    
     *Re = ReynoldsNum(rho, u, d, mu);
     
-    ReyNum = (*Re);
+    //  Terms shared by every fitting are evaluated once.
+    invRe = 1/(*Re);
+    sizeterm = 1/Impd;
+    sizeterm = 1 + (sizeterm);
+    vhead = pow(u, 2);
+    vhead = (vhead)/(2*g);
     
-    for(int i = 0; i < 32; ++i)
+    for(int i = 0; i < TwoKCount; ++i)
     {
-        data.headloss[i] = TwoKCalculateHead(data.count[i], TwoKCalculateK(ReyNum, Impd, data.k1[i], data.kinf[i]), u);
-        data.dP_f[i] = TwoKCalculatePLoss(data.headloss[i], rho);
+        double K = db->k1[i]*invRe + db->kinf[i]*sizeterm;
+        
+        data->headloss[i] = data->count[i]*K*vhead;
+        data->dP_f[i] = rho*g*data->headloss[i];
     }
-    return data;
 }
 
 /// MARK: DISPLAY AND WRITE
-void TwoKDisplay(TwoKFittings data, double rho, double u, double d, double mu, double Re, double TotalP, double TotalH)
+void TwoKDisplay(const TwoKFittings *data, double rho, double u, double d, double mu, double Re, double TotalP, double TotalH)
 {
-    int i = 0;
+    const TwoKDatabase *db = TwoKData();
     
     printf("Inputted parameters:\n");
     printf("Fluid density:\n");
@@ -310,625 +203,74 @@ void TwoKDisplay(TwoKFittings data, double rho, double u, double d, double mu, d
     printf("dP_f = \\rho g h_L\n\n");
     
     printf("Fitting\tK_1\tK_inf\tCount\tHead loss (m)\tPressure Loss (Pa)\n");
-    i = 0;
-    printf("90 deg Elbow, Threaded (Standard Radius) (R/D = 1)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("90 deg Elbow, Flanged/Welded (Standard Radius) (R/D = 1)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("90 deg Elbow, All types (Long Radius) (R/D = 1.5)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n\n", data.dP_f[i]);
-    ++i;
-    
-    
-    printf("90 deg Elbow Mitered (R/D = 1.5), 1 Weld (90 deg angle)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("90 deg Elbow Mitered (R/D = 1.5), 2 Weld (45 deg angle)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("90 deg Elbow Mitered (R/D = 1.5), 3 Weld (30 deg angle)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("90 deg Elbow Mitered (R/D = 1.5), 4 Weld (22.5 deg angle)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("90 deg Elbow Mitered (R/D = 1.5), 5 Weld (18 deg angle)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n\n", data.dP_f[i]);
-    ++i;
-    
-    
-    printf("45 deg Elbow, All types (Standard Radius) (R/D = 1)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("45 deg Elbow, All types (Long Radius) (R/D = 1.5)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n\n", data.dP_f[i]);
-    ++i;
-    
-    
-    printf("45 deg Elbow Mitered, 1 Weld (45 deg angle)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("45 deg Elbow Mitered, 2 Weld (45 deg angle)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n\n", data.dP_f[i]);
-    ++i;
-    
-    
-    printf("180 deg bend, Screwed (Standard Radius) (R/D = 1)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("180 deg bend, Flanged/Welded (Standard Radius) (R/D = 1)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("180 deg bend, All types (Long Radius) (R/D = 1.5)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n\n", data.dP_f[i]);
-    ++i;
-    
-    
-    printf("Tee (used as elbow), Screwed (Standard Radius) (R/D = 1)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("Tee (used as elbow), Screwed (Long Radius)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("Tee (used as elbow), Flanged/Welded (Standard Radius) (R/D = 1)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("Tee (used as elbow), Stub-in-type Branch\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n\n", data.dP_f[i]);
-    ++i;
-    
-    
-    printf("Tee (Run Through), Screwed\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("Tee (Run Through), Flanged/Welded\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("Tee (Run Through), Stub-in-type Branch\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n\n", data.dP_f[i]);
-    ++i;
-    
-    
-    printf("Valves (Gate/ Ball/ Plug), Full Line Size (Beta = 1)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("Valves (Gate/ Ball/ Plug), Reduced Trim (Beta = 0.9)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("Valves (Gate/ Ball/ Plug), Reduced Trum (Beta = 0.8)\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n\n", data.dP_f[i]);
-    ++i;
-    
-    
-    printf("Globe Valve, Standard\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("Globe Valve, Angle\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("Diaphragm Valve, Dam Type\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("Butterfly Valve\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n\n", data.dP_f[i]);
-    ++i;
-    
-    
-    printf("Check Valves, Lift\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("Check Valves, Swing\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    printf("Check Valves, Tilting-disk\t");
-    printf("%i\t", data.k1[i]);
-    printf("%.2f\t", data.kinf[i]);
-    printf("%i\t", data.count[i]);
-    printf("%.3f\t", data.headloss[i]);
-    printf("%.3f\n", data.dP_f[i]);
+    for(int i = 0; i < TwoKCount; ++i)
+    {
+        printf("%s\t", db->name[i]);
+        printf("%i\t", db->k1[i]);
+        printf("%.2f\t", db->kinf[i]);
+        printf("%i\t", data->count[i]);
+        printf("%.3f\t", data->headloss[i]);
+        printf("%.3f\n", data->dP_f[i]);
+    }
     
     fflush(stdout);
 }
 
-void TwoKWrite(TwoKFittings data, double rho, double u, double d, double mu, double Re, double TotalP, double TotalH)
+void TwoKWrite(const TwoKFittings *data, double rho, double u, double d, double mu, double Re, double TotalP, double TotalH)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
+    const TwoKDatabase *db = TwoKData();
     
-    FILE *fp;                   // Pointer to the file location.
     //  Set file name as timestamp + 2K Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " 2K Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, "2K Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
-    fprintf(fp, "_Pressure_Loss_Through_Pipe_Fittings_(2K_Method)_Results_\n");
-    
-    int i = 0;
-    
-    fprintf(fp, "Inputted parameters:\n");
-    fprintf(fp, "Fluid density:\n");
-    fprintf(fp, "rho =\t%.3f\tkg/m3\n", rho);
-    fprintf(fp, "Fluid velocity:\n");
-    fprintf(fp, "u =\t%.3f\tkg/m3\n", u);
-    fprintf(fp, "Fluid viscosity:\n");
-    fprintf(fp, "mu =\t%.3f\tcP\n\n", mu*1000);
-    
-    fprintf(fp, "Internal pipe diameter:\n");
-    fprintf(fp, "d =\t%.3f\tmm\n\n", d*1000);
-    
-    fprintf(fp, "Calculated parameters:\n");
-    fprintf(fp, "Reynold's number:\n");
-    fprintf(fp, "Re =\t%.0f\t[ ]\n", Re);
-    
-    fprintf(fp, "Total head loss:\n");
-    fprintf(fp, "total =\t%.3f\tm\n\n", TotalH);
-    fprintf(fp, "Total pressure loss:\n");
-    fprintf(fp, "total =\t%.3f\tPa\n\n", TotalP);
-    
-    fprintf(fp, "K = \\frac{ K_1 }{ \\textrm{Re} } + K_{ \\infty }\\left(1 + \\frac{1}{D}\\right)\n");
-    fprintf(fp, "h_L = K \\frac{u^2}{2*g}\n");
-    fprintf(fp, "dP_f = \\rho g h_L\n\n");
-    
-    fprintf(fp, "Fitting\tK_1\tK_inf\tCount\tHead loss (m)\tPressure Loss (Pa)\n");
-    i = 0;
-    fprintf(fp, "90 deg Elbow, Threaded (Standard Radius) (R/D = 1)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "90 deg Elbow, Flanged/Welded (Standard Radius) (R/D = 1)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "90 deg Elbow, All types (Long Radius) (R/D = 1.5)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n\n", data.dP_f[i]);
-    ++i;
-    
-    
-    fprintf(fp, "90 deg Elbow Mitered (R/D = 1.5), 1 Weld (90 deg angle)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "90 deg Elbow Mitered (R/D = 1.5), 2 Weld (45 deg angle)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "90 deg Elbow Mitered (R/D = 1.5), 3 Weld (30 deg angle)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "90 deg Elbow Mitered (R/D = 1.5), 4 Weld (22.5 deg angle)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "90 deg Elbow Mitered (R/D = 1.5), 5 Weld (18 deg angle)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n\n", data.dP_f[i]);
-    ++i;
-    
-    
-    fprintf(fp, "45 deg Elbow, All types (Standard Radius) (R/D = 1)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "45 deg Elbow, All types (Long Radius) (R/D = 1.5)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n\n", data.dP_f[i]);
-    ++i;
-    
-    
-    fprintf(fp, "45 deg Elbow Mitered, 1 Weld (45 deg angle)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "45 deg Elbow Mitered, 2 Weld (45 deg angle)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n\n", data.dP_f[i]);
-    ++i;
-    
-    
-    fprintf(fp, "180 deg bend, Screwed (Standard Radius) (R/D = 1)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "180 deg bend, Flanged/Welded (Standard Radius) (R/D = 1)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "180 deg bend, All types (Long Radius) (R/D = 1.5)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n\n", data.dP_f[i]);
-    ++i;
-    
-    
-    fprintf(fp, "Tee (used as elbow), Screwed (Standard Radius) (R/D = 1)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "Tee (used as elbow), Screwed (Long Radius)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "Tee (used as elbow), Flanged/Welded (Standard Radius) (R/D = 1)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "Tee (used as elbow), Stub-in-type Branch\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n\n", data.dP_f[i]);
-    ++i;
-    
-    
-    fprintf(fp, "Tee (Run Through), Screwed\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "Tee (Run Through), Flanged/Welded\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "Tee (Run Through), Stub-in-type Branch\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n\n", data.dP_f[i]);
-    ++i;
-    
-    
-    fprintf(fp, "Valves (Gate/ Ball/ Plug), Full Line Size (Beta = 1)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "Valves (Gate/ Ball/ Plug), Reduced Trim (Beta = 0.9)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "Valves (Gate/ Ball/ Plug), Reduced Trum (Beta = 0.8)\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n\n", data.dP_f[i]);
-    ++i;
-    
-    
-    fprintf(fp, "Globe Valve, Standard\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "Globe Valve, Angle\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "Diaphragm Valve, Dam Type\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "Butterfly Valve\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n\n", data.dP_f[i]);
-    ++i;
-    
-    
-    fprintf(fp, "Check Valves, Lift\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "Check Valves, Swing\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
-    
-    fprintf(fp, "Check Valves, Tilting-disk\t");
-    fprintf(fp, "%i\t", data.k1[i]);
-    fprintf(fp, "%.2f\t", data.kinf[i]);
-    fprintf(fp, "%i\t", data.count[i]);
-    fprintf(fp, "%.3f\t", data.headloss[i]);
-    fprintf(fp, "%.3f\n", data.dP_f[i]);
-    ++i;
+    writerPrintf(&w, "_Pressure_Loss_Through_Pipe_Fittings_(2K_Method)_Results_\n");
+    
+    writerPrintf(&w, "Inputted parameters:\n");
+    writerPrintf(&w, "Fluid density:\n");
+    writerPrintf(&w, "rho =\t%.3f\tkg/m3\n", rho);
+    writerPrintf(&w, "Fluid velocity:\n");
+    writerPrintf(&w, "u =\t%.3f\tkg/m3\n", u);
+    writerPrintf(&w, "Fluid viscosity:\n");
+    writerPrintf(&w, "mu =\t%.3f\tcP\n\n", mu*1000);
+    
+    writerPrintf(&w, "Internal pipe diameter:\n");
+    writerPrintf(&w, "d =\t%.3f\tmm\n\n", d*1000);
+    
+    writerPrintf(&w, "Calculated parameters:\n");
+    writerPrintf(&w, "Reynold's number:\n");
+    writerPrintf(&w, "Re =\t%.0f\t[ ]\n", Re);
+    
+    writerPrintf(&w, "Total head loss:\n");
+    writerPrintf(&w, "total =\t%.3f\tm\n\n", TotalH);
+    writerPrintf(&w, "Total pressure loss:\n");
+    writerPrintf(&w, "total =\t%.3f\tPa\n\n", TotalP);
+    
+    writerPrintf(&w, "K = \\frac{ K_1 }{ \\textrm{Re} } + K_{ \\infty }\\left(1 + \\frac{1}{D}\\right)\n");
+    writerPrintf(&w, "h_L = K \\frac{u^2}{2*g}\n");
+    writerPrintf(&w, "dP_f = \\rho g h_L\n\n");
+    
+    writerPrintf(&w, "Fitting\tK_1\tK_inf\tCount\tHead loss (m)\tPressure Loss (Pa)\n");
+    for(int i = 0; i < TwoKCount; ++i)
+    {
+        writerPrintf(&w, "%s\t", db->name[i]);
+        writerPrintf(&w, "%i\t", db->k1[i]);
+        writerPrintf(&w, "%.2f\t", db->kinf[i]);
+        writerPrintf(&w, "%i\t", data->count[i]);
+        writerPrintf(&w, "%.3f\t", data->headloss[i]);
+        writerPrintf(&w, "%.3f\n", data->dP_f[i]);
+    }
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
-void TwoKWriteSwitch(TwoKFittings data, double rho, double u, double d, double mu, double Re, double TotalP, double TotalH)
+void TwoKWriteSwitch(const TwoKFittings *data, double rho, double u, double d, double mu, double Re, double TotalP, double TotalH)
 {
     int control;
     
@@ -968,7 +310,7 @@ void TwoK()
 {
     //  Variable declaration
     double Re = 0.0;                // Reynolds number.
-    TwoKFittings *TwoKTable = calloc(1, sizeof(TwoKTable)); // Struct used to store collected data and individual head lossses.
+    TwoKFittings *TwoKTable = calloc(1, sizeof(TwoKFittings)); // Struct used to store collected data and individual head lossses.
     double TotalP = 0.0;            // Total pressure loss from specified fittings.
     double TotalH = 0.0;            // Total head loss from specified fittings.
     
@@ -983,16 +325,16 @@ void TwoK()
     double elapsed = 0.0;
     
     //  Collecting data
-    *TwoKTable = TwoKVariable(*TwoKTable, &rho, &u, &d, &mu, &impd);
+    TwoKVariable(TwoKTable, &rho, &u, &d, &mu, &impd);
     
     //  Performing calculations
     clock_getres(CLOCK_MONOTONIC, &start);
     clock_gettime(CLOCK_MONOTONIC, &start);
     
-    *TwoKTable = TwoKFinalTable(*TwoKTable, rho, u, d, mu, impd, &Re);
+    TwoKFinalTable(TwoKTable, rho, u, d, mu, impd, &Re);
     
     //  Calculating total head and pressure losses
-    for(int i = 0; i < 32; ++i)
+    for(int i = 0; i < TwoKCount; ++i)
     {
         TotalH += TwoKTable->headloss[i];
         TotalP += TwoKTable->dP_f[i];
@@ -1005,9 +347,9 @@ void TwoK()
     printf("Calculations completed in %.6f seconds.\n", elapsed);
     
     //  Displaying Results
-    TwoKDisplay(*TwoKTable, rho, u, d, mu, Re, TotalP, TotalH);
+    TwoKDisplay(TwoKTable, rho, u, d, mu, Re, TotalP, TotalH);
     
     //  Writing Results
-    TwoKWriteSwitch(*TwoKTable, rho, u, d, mu, Re, TotalP, TotalH);
+    TwoKWriteSwitch(TwoKTable, rho, u, d, mu, Re, TotalP, TotalH);
     free(TwoKTable);
 }
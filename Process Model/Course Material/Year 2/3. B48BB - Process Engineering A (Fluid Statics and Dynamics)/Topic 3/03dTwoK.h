@@ -22,12 +22,18 @@
 #ifndef TwoKStruct
 #define TwoKStruct
 
+#define TwoKCount 32
+
+typedef struct TwoKDatabase{
+    const char *name[TwoKCount];    // Fitting description.
+    int k1[TwoKCount];              // Resistance coefficient at Re = 1.
+    double kinf[TwoKCount];         // Resistance coefficient at Re = infinity.
+} TwoKDatabase;
+
 typedef struct TwoKFittings{
-    int k1[32];
-    double kinf[32];
-    int count[32];
-    double headloss[32];
-    double dP_f[32];
+    int count[TwoKCount];           // Number of each fitting in the line.
+    double headloss[TwoKCount];     // Head loss through each fitting type (m).
+    double dP_f[TwoKCount];         // Pressure loss through each fitting type (Pa).
 } TwoKFittings;
 
 #endif /* TwoKStruct */
@@ -35,18 +41,17 @@ typedef struct TwoKFittings{
 #ifndef TwoKData_h
 #define TwoKData_h
 
-/// This subroutine is used to write the 2K database into the struct where data is to be entered.
-/// @param input Table where 2K database constants should be written to.
-TwoKFittings TwoKData(TwoKFittings input);
+/// This subroutine returns a pointer to the read-only 2K database. The database is a static table which is shared between all calls and should not be modified.
+const TwoKDatabase *TwoKData(void);
 
 /// This subroutine is used to collect the required data to run calculate the head and pressure losses through the 2K method.
-/// @param table Table where collected variables should be stored.
+/// @param table Table where the fitting counts should be stored.
 /// @param rho Fluid density (kg/m3)
 /// @param u Fluid velocity (m/s)
 /// @param d Internal pipe diameter (mm)
 /// @param mu Fluid viscosity (cP)
 /// @param Impd Internal pipe diameter (inches)
-TwoKFittings TwoKVariable(TwoKFittings table, double *rho, double *u, double *d, double *mu, double *Impd);
+void TwoKVariable(TwoKFittings *table, double *rho, double *u, double *d, double *mu, double *Impd);
 
 #endif /* TwoKData_h */
 
@@ -72,14 +77,14 @@ double TwoKCalculateHead(int count, double K, double u);
 double TwoKCalculatePLoss(double h, double rho);
 
 /// This subroutine is used to perform the calculations for the head and pressure losses through the 2K method. 
-/// @param data Table containing collected data.
+/// @param data Table containing the fitting counts. The calculated losses are written to this table.
 /// @param rho Fluid density (kg/m3)
 /// @param u Fluid velocity (m/s)
 /// @param d Internal pipe diameter (m)
 /// @param mu Fluid viscosity (Pa.s)
 /// @param Impd Internal pipe diameter (inches)
 /// @param Re Reynold's number
-TwoKFittings TwoKFinalTable(TwoKFittings data, double rho, double u, double d, double mu, double Impd, double *Re);
+void TwoKFinalTable(TwoKFittings *data, double rho, double u, double d, double mu, double Impd, double *Re);
 
 #endif /* TwoKCalc_h */
 
@@ -87,7 +92,7 @@ TwoKFittings TwoKFinalTable(TwoKFittings data, double rho, double u, double d, d
 #define TwoKDisp_h
 
 /// This subroutine is used to display the collected data and generated data table on the user console.
-/// @param data Table containing collected data and calculated parameters.
+/// @param data Table containing the fitting counts and calculated losses.
 /// @param rho Fluid density (kg/m3)
 /// @param u Fluid velocity (m/s)
 /// @param d Internal pipe diameter (m)
@@ -95,7 +100,7 @@ TwoKFittings TwoKFinalTable(TwoKFittings data, double rho, double u, double d, d
 /// @param Re Reynold's number
 /// @param TotalP Total pressure loss (Pa)
 /// @param TotalH Total head loss (m)
-void TwoKDisplay(TwoKFittings data, double rho, double u, double d, double mu, double Re, double TotalP, double TotalH);
+void TwoKDisplay(const TwoKFittings *data, double rho, double u, double d, double mu, double Re, double TotalP, double TotalH);
 
 #endif /* TwoKDisp_h */
 
@@ -103,7 +108,7 @@ void TwoKDisplay(TwoKFittings data, double rho, double u, double d, double mu, d
 #define TwoKWrite_h
 
 /// This subroutine is used to write the collect data and calculated parameters to a .txt file.
-/// @param data Table containing collected data and calculated parameters.
+/// @param data Table containing the fitting counts and calculated losses.
 /// @param rho Fluid density (kg/m3)
 /// @param u Fluid velocity (m/s)
 /// @param d Internal pipe diameter (m)
@@ -111,10 +116,10 @@ void TwoKDisplay(TwoKFittings data, double rho, double u, double d, double mu, d
 /// @param Re Reynold's number
 /// @param TotalP Total pressure loss (Pa)
 /// @param TotalH Total head loss (m)
-void TwoKWrite(TwoKFittings data, double rho, double u, double d, double mu, double Re, double TotalP, double TotalH);
+void TwoKWrite(const TwoKFittings *data, double rho, double u, double d, double mu, double Re, double TotalP, double TotalH);
 
 /// This subroutine is used to ask the user if they would like to write the generated dataset and calculated parameters to a file.
-/// @param data Table containing collected data and calculated parameters.
+/// @param data Table containing the fitting counts and calculated losses.
 /// @param rho Fluid density (kg/m3)
 /// @param u Fluid velocity (m/s)
 /// @param d Internal pipe diameter (m)
@@ -122,7 +127,7 @@ void TwoKWrite(TwoKFittings data, double rho, double u, double d, double mu, dou
 /// @param Re Reynold's number
 /// @param TotalP Total pressure loss (Pa)
 /// @param TotalH Total head loss (m)
-void TwoKWriteSwitch(TwoKFittings data, double rho, double u, double d, double mu, double Re, double TotalP, double TotalH);
+void TwoKWriteSwitch(const TwoKFittings *data, double rho, double u, double d, double mu, double Re, double TotalP, double TotalH);
 
 #endif /* TwoKWrite_h */
 
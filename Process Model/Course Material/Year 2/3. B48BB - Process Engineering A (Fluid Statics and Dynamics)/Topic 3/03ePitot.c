@@ -29,6 +29,7 @@
 
 //  Custom header files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BB_T3.h"
 #include "03ePitot.h"
 #include "01cMano.h"
@@ -116,80 +117,41 @@ void PitotDisplay(double P1, double P2, double rho1, double rho2, double h1, dou
 void PitotWrite(double P1, double P2, double rho1, double rho2, double h1, double h2, double d, double v, double Q)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
     //  Set file name as timestamp + Pitot Static Tube Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Pitot Static Tube Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, "Pitot Static Tube Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
-    fprintf(fp, "_Pitot_Static_Tube_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Static pressure on connection:\n");
-    fprintf(fp, "P2 =\t%.3f\tkPa\n", P2*0.001);
-    fprintf(fp, "Process fluid density:\n");
-    fprintf(fp, "rho1 =\t%.3f\tkg/m3\n", rho1);
-    fprintf(fp, "Process fluid height in manometer element:\n");
-    fprintf(fp, "h1 =\t%.3f\tcm\n", h1*100);
-    fprintf(fp, "Manometer fluid density:\n");
-    fprintf(fp, "rho2 =\t%.3f\tkg/m3\n", rho2);
-    fprintf(fp, "Manometer fluid height:\n");
-    fprintf(fp, "h2 =\t%.3f\tcm\n", h2*100);
-    
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "Assuming skin friction losses can be ignored.\n");
-    fprintf(fp, "Therefore, assuming that the impact connection is located on the pipe centreline\n\n");
-    
-    fprintf(fp, "Process fluid pressure:\n");
-    fprintf(fp, "P1 =\t%.3f\tkPa\n", P1*0.001);
-    fprintf(fp, "Process fluid velocity:\n");
-    fprintf(fp, "u =\t%.3f\tm/s\n", v);
-    fprintf(fp, "Process fluid volumetric flowrate:\n");
-    fprintf(fp, "Q =\t%.3f\tm3/s\n", Q);
+    writerPrintf(&w, "_Pitot_Static_Tube_Results_\n");
+    writerPrintf(&w, "\tInput parameters:\n");
+    writerPrintf(&w, "Static pressure on connection:\n");
+    writerPrintf(&w, "P2 =\t%.3f\tkPa\n", P2*0.001);
+    writerPrintf(&w, "Process fluid density:\n");
+    writerPrintf(&w, "rho1 =\t%.3f\tkg/m3\n", rho1);
+    writerPrintf(&w, "Process fluid height in manometer element:\n");
+    writerPrintf(&w, "h1 =\t%.3f\tcm\n", h1*100);
+    writerPrintf(&w, "Manometer fluid density:\n");
+    writerPrintf(&w, "rho2 =\t%.3f\tkg/m3\n", rho2);
+    writerPrintf(&w, "Manometer fluid height:\n");
+    writerPrintf(&w, "h2 =\t%.3f\tcm\n", h2*100);
+    
+    writerPrintf(&w, "\tOutput parameters:\n");
+    writerPrintf(&w, "Assuming skin friction losses can be ignored.\n");
+    writerPrintf(&w, "Therefore, assuming that the impact connection is located on the pipe centreline\n\n");
+    
+    writerPrintf(&w, "Process fluid pressure:\n");
+    writerPrintf(&w, "P1 =\t%.3f\tkPa\n", P1*0.001);
+    writerPrintf(&w, "Process fluid velocity:\n");
+    writerPrintf(&w, "u =\t%.3f\tm/s\n", v);
+    writerPrintf(&w, "Process fluid volumetric flowrate:\n");
+    writerPrintf(&w, "Q =\t%.3f\tm3/s\n", Q);
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void PitotWriteSwitch(double P1, double P2, double rho1, double rho2, double h1, double h2, double d, double v, double Q)
@@ -29,6 +29,7 @@
 
 //  Custom header files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BB_T3.h"
 #include "03fOrifice.h"
 
@@ -131,82 +132,43 @@ void OrificeDisplay(double P1, double P2, double rho, double d1, double d2, doub
 void OrificeWrite(double P1, double P2, double rho, double d1, double d2, double C_d, double h_f, double u, double Q, double m)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
     //  Set file name as timestamp + Orifice Plate Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Orifice Plate Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, "Orifice Plate Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
-    fprintf(fp, "_Orifice_Plate_Flow_Measurement_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Initial fluid pressure:\n");
-    fprintf(fp, "P1 =\t%.3f\tkPa\n", P1*0.001);
-    fprintf(fp, "Final system pressure:\n");
-    fprintf(fp, "P2 =\t%.3f\tkPa\n", P2*0.001);
-    fprintf(fp, "Fluid density:\n");
-    fprintf(fp, "rho =\t%.3f\tkg/m3\n", rho);
+    writerPrintf(&w, "_Orifice_Plate_Flow_Measurement_Results_\n");
+    writerPrintf(&w, "\tInput parameters:\n");
+    writerPrintf(&w, "Initial fluid pressure:\n");
+    writerPrintf(&w, "P1 =\t%.3f\tkPa\n", P1*0.001);
+    writerPrintf(&w, "Final system pressure:\n");
+    writerPrintf(&w, "P2 =\t%.3f\tkPa\n", P2*0.001);
+    writerPrintf(&w, "Fluid density:\n");
+    writerPrintf(&w, "rho =\t%.3f\tkg/m3\n", rho);
     
-    fprintf(fp, "Pipe diameter:\n");
-    fprintf(fp, "d1 =\t%.3f\tmm\n", d1*1000);
-    fprintf(fp, "Vena Contracta Diameter:\n");
-    fprintf(fp, "d2 =\t%.3f\tmm\n", d2*1000);
-    fprintf(fp, "Discharge coefficient:\n");
-    fprintf(fp, "C_d =\t%.3f\t[ ]\n", C_d);
-    fprintf(fp, "Frictional head loss:\n");
-    fprintf(fp, "h_f =\t%.3f\tm\n\n", h_f);
+    writerPrintf(&w, "Pipe diameter:\n");
+    writerPrintf(&w, "d1 =\t%.3f\tmm\n", d1*1000);
+    writerPrintf(&w, "Vena Contracta Diameter:\n");
+    writerPrintf(&w, "d2 =\t%.3f\tmm\n", d2*1000);
+    writerPrintf(&w, "Discharge coefficient:\n");
+    writerPrintf(&w, "C_d =\t%.3f\t[ ]\n", C_d);
+    writerPrintf(&w, "Frictional head loss:\n");
+    writerPrintf(&w, "h_f =\t%.3f\tm\n\n", h_f);
     
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "Process fluid velocity:\n");
-    fprintf(fp, "u =\t%.3f\tm/s\n", u);
-    fprintf(fp, "Process fluid volumetric flowrate:\n");
-    fprintf(fp, "Q =\t%.3f\tm3/s\n", Q);
-    fprintf(fp, "Process fluid mass flowrate:\n");
-    fprintf(fp, "m =\t%.3f\tkg/s\n", m);
+    writerPrintf(&w, "\tOutput parameters:\n");
+    writerPrintf(&w, "Process fluid velocity:\n");
+    writerPrintf(&w, "u =\t%.3f\tm/s\n", u);
+    writerPrintf(&w, "Process fluid volumetric flowrate:\n");
+    writerPrintf(&w, "Q =\t%.3f\tm3/s\n", Q);
+    writerPrintf(&w, "Process fluid mass flowrate:\n");
+    writerPrintf(&w, "m =\t%.3f\tkg/s\n", m);
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void OrificeWriteSwitch(double P1, double P2, double rho, double d1, double d2, double C_d, double h_f, double u, double Q, double m)
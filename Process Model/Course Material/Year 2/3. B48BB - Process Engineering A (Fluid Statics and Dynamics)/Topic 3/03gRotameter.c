@@ -29,6 +29,7 @@
 
 //  Custom header files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BB_T3.h"
 #include "03gRotameter.h"
 
@@ -126,88 +127,49 @@ void RotameterDisplay(double rho, double V_f, double rho_f, double A_f, double a
 void RotameterWrite(double rho, double V_f, double rho_f, double A_f, double are1, double are2, double C_d, double dP, double m, double Q, double u)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
     //  Set file name as timestamp + Rotameter Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Rotameter Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, "Rotameter Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
-    fprintf(fp, "_Rotameter_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Fluid parameters:\n");
-    fprintf(fp, "Process fluid density:\n");
-    fprintf(fp, "rho =\t%.3f\tkg/m3\n\n", rho);
+    writerPrintf(&w, "_Rotameter_Results_\n");
+    writerPrintf(&w, "\tInput parameters:\n");
+    writerPrintf(&w, "Fluid parameters:\n");
+    writerPrintf(&w, "Process fluid density:\n");
+    writerPrintf(&w, "rho =\t%.3f\tkg/m3\n\n", rho);
     
-    fprintf(fp, "Float parameters:\n");
-    fprintf(fp, "Float volume:\n");
-    fprintf(fp, "V_f =\t%.3f\tm3\n", V_f);
-    fprintf(fp, "Float density:\n");
-    fprintf(fp, "rho_f =\t%.3f\tkg/m3\n", rho_f);
-    fprintf(fp, "Maximum cross-sectional area of float:\n");
-    fprintf(fp, "A_f =\t%.3f\tm2\n", A_f);
-    fprintf(fp, "Cross-sectional area of tube at point of float:\n");
-    fprintf(fp, "are1 =\t%.3f\tm2\n", are1);
-    fprintf(fp, "Annular area between float and tube at point:\n");
-    fprintf(fp, "are2 =\t%.3f\tm2\n\n", are2);
+    writerPrintf(&w, "Float parameters:\n");
+    writerPrintf(&w, "Float volume:\n");
+    writerPrintf(&w, "V_f =\t%.3f\tm3\n", V_f);
+    writerPrintf(&w, "Float density:\n");
+    writerPrintf(&w, "rho_f =\t%.3f\tkg/m3\n", rho_f);
+    writerPrintf(&w, "Maximum cross-sectional area of float:\n");
+    writerPrintf(&w, "A_f =\t%.3f\tm2\n", A_f);
+    writerPrintf(&w, "Cross-sectional area of tube at point of float:\n");
+    writerPrintf(&w, "are1 =\t%.3f\tm2\n", are1);
+    writerPrintf(&w, "Annular area between float and tube at point:\n");
+    writerPrintf(&w, "are2 =\t%.3f\tm2\n\n", are2);
     
-    fprintf(fp, "Device parameters:\n");
-    fprintf(fp, "Discharge Coefficient:\n");
-    fprintf(fp, "C_d =\t%.3f\t[ ]\n\n", C_d);
+    writerPrintf(&w, "Device parameters:\n");
+    writerPrintf(&w, "Discharge Coefficient:\n");
+    writerPrintf(&w, "C_d =\t%.3f\t[ ]\n\n", C_d);
     
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "Fluid pressure loss:\n");
-    fprintf(fp, "dP =\t%.3f\tPa\n", dP);
-    fprintf(fp, "Mass flowrate of process fluid:\n");
-    fprintf(fp, "m =\t%.3f\tkg/s\n", m);
-    fprintf(fp, "Volumetric flowrate of process fluid:\n");
-    fprintf(fp, "Q =\t%.3f\tm3/s\n", Q);
-    fprintf(fp, "Process fluid velocity:\n");
-    fprintf(fp, "u =\t%.3f\tm/s\n", u);
+    writerPrintf(&w, "\tOutput parameters:\n");
+    writerPrintf(&w, "Fluid pressure loss:\n");
+    writerPrintf(&w, "dP =\t%.3f\tPa\n", dP);
+    writerPrintf(&w, "Mass flowrate of process fluid:\n");
+    writerPrintf(&w, "m =\t%.3f\tkg/s\n", m);
+    writerPrintf(&w, "Volumetric flowrate of process fluid:\n");
+    writerPrintf(&w, "Q =\t%.3f\tm3/s\n", Q);
+    writerPrintf(&w, "Process fluid velocity:\n");
+    writerPrintf(&w, "u =\t%.3f\tm/s\n", u);
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void RotameterWriteSwitch(double rho, double V_f, double rho_f, double A_f, double are1, double are2, double C_d, double dP, double m, double Q, double u)
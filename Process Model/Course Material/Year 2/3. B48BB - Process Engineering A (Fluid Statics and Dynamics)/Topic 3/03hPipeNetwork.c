@@ -0,0 +1,781 @@
+//
+//  03hPipeNetwork.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+/// MARK: HEADER DECLARATIONS
+//Standard Header Files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//Custom Header Files
+#include "System.h"
+#include "ResultWriter.h"
+#include "LinearAlgebra.h"
+#include "Parallel.h"
+#include "B48BB_T3.h"
+#include "03aFrictFactor.h"
+#include "03dFittingsLoss.h"
+#include "03hPipeNetwork.h"
+
+/// MARK: SUBROUTINE DEFINITIONS
+#define maxstrlen 128
+#define g 9.80665
+#define PI 3.14159265358979323846
+#define umin 1e-7           // Smallest velocity used when evaluating the head loss (m/s).
+#define Gmin 1e-8           // Smallest head loss derivative allowed in the Jacobian (s/m2).
+#define linkbatch 512       // Links evaluated by each parallel task.
+
+/// MARK: VARIABLE INPUT
+void PipeNetworkVariable(PipeNetworkData *net)
+{
+    char input[maxstrlen];
+    char label[maxstrlen];
+    int control = 0;
+    
+    net->rho = inputDouble(0, 0, "fluid density", "kg/m3");
+    
+    net->mu = inputDouble(0, 0, "fluid viscosity", "cP");
+    net->mu = (net->mu)*0.001; // Conversion (cP to Pa.s)
+    
+    net->nnodes = (int)inputDouble(0, 0, "number of nodes", "");
+    net->node = calloc(net->nnodes, sizeof(NetworkNode));
+    for(int i = 0; i < net->nnodes; ++i)
+    {
+        NetworkNode *node = &net->node[i];
+        
+        printf("Node %i.\n", i + 1);
+        snprintf(label, sizeof(label), "elevation of node %i", i + 1);
+        node->z = inputDouble(1, 1, label, "m");
+        
+        control = 1;
+        while(control == 1)
+        {
+            printf("Is the pressure at node %i fixed? [Y/N] ", i + 1);
+            fgets(input, sizeof(input), stdin);
+            switch(input[0])
+            {
+                case '1':
+                case 'T':
+                case 'Y':
+                case 't':
+                case 'y':
+                    node->fixed = 1;
+                    node->P = inputDouble(1, 1, "node pressure", "kPa");
+                    node->P = (node->P)*1000; // Conversion (kPa to Pa)
+                    control = 0;
+                    break;
+                case '0':
+                case 'F':
+                case 'N':
+                case 'f':
+                case 'n':
+                    node->fixed = 0;
+                    node->demand = inputDouble(1, 1, "flowrate withdrawn from the node (negative for supply)", "m3/s");
+                    control = 0;
+                    break;
+                default:
+                    printf("Input not recognised\n");
+                    break;
+            }
+        }
+    }
+    
+    net->nlinks = (int)inputDouble(0, 0, "number of pipes and pumps", "");
+    net->link = calloc(net->nlinks, sizeof(NetworkLink));
+    for(int k = 0; k < net->nlinks; ++k)
+    {
+        NetworkLink *link = &net->link[k];
+        
+        printf("Link %i.\n", k + 1);
+        control = 1;
+        while(control == 1)
+        {
+            printf("Is link %i a pipe (1) or a pump (2)? ", k + 1);
+            fgets(input, sizeof(input), stdin);
+            switch(input[0])
+            {
+                case '1':
+                case '2':
+                    link->type = input[0] - '0';
+                    control = 0;
+                    break;
+                default:
+                    printf("Input not recognised\n");
+                    break;
+            }
+        }
+        
+        control = 1;
+        while(control == 1)
+        {
+            link->from = (int)inputDouble(0, 0, "upstream node", "") - 1;
+            link->to = (int)inputDouble(0, 0, "downstream node", "") - 1;
+            if(link->from < 0 || link->from >= net->nnodes || link->to < 0 || link->to >= net->nnodes || link->from == link->to)
+            {
+                printf("Links must join two different nodes between 1 and %i.\n", net->nnodes);
+            }else{
+                control = 0;
+            }
+        }
+        
+        if(link->type == NetworkPipe)
+        {
+            link->L = inputDouble(0, 0, "pipe length", "m");
+            
+            link->d = inputDouble(0, 0, "internal pipe diameter", "mm");
+            link->d = (link->d)*0.001; // Conversion (mm to m)
+            
+            link->vareps = inputDouble(1, 0, "pipe absolute roughness", "mm");
+            link->vareps = (link->vareps)*0.001; // Conversion (mm to m)
+            
+            control = 1;
+            while(control == 1)
+            {
+                printf("Are there fittings installed on pipe %i? [Y/N] ", k + 1);
+                fgets(input, sizeof(input), stdin);
+                switch(input[0])
+                {
+                    case '1':
+                    case 'T':
+                    case 'Y':
+                    case 't':
+                    case 'y':
+                        FittingsLineVariable(k, &link->fittings);
+                        control = 0;
+                        break;
+                    case '0':
+                    case 'F':
+                    case 'N':
+                    case 'f':
+                    case 'n':
+                        control = 0;
+                        break;
+                    default:
+                        printf("Input not recognised\n");
+                        break;
+                }
+            }
+        }else{
+            link->h0 = inputDouble(0, 0, "pump shut-off head", "m");
+            
+            link->r = inputDouble(1, 0, "pump curve coefficient, H = h0 - r Q^2", "s2/m5");
+        }
+    }
+}
+
+void PipeNetworkFree(PipeNetworkData *net)
+{
+    for(int k = 0; k < net->nlinks; ++k)
+    {
+        free(net->link[k].fittings.entry);
+    }
+    free(net->node);
+    free(net->link);
+    net->node = NULL;
+    net->link = NULL;
+}
+
+/// MARK: GENERAL CALCULATIONS
+double PipeNetworkHeadLoss(const NetworkLink *link, const FittingsCoefficients *coef, double rho, double mu, double *G)
+{
+    double area = 0.0;
+    double u = 0.0;         // Velocity magnitude used in the friction factor (m/s).
+    double Re = 0.0;
+    double phi = 0.0;
+    double dphi = 0.0;
+    double LD = 0.0;        // Pipe length and equivalent length of fittings in pipe diameters.
+    double K = 0.0;         // Size dependent resistance coefficients of the fittings.
+    double C = 0.0;         // Total resistance coefficient.
+    double dC = 0.0;        // Derivative of C with respect to Reynolds number.
+    double h = 0.0;
+    
+    area = PI*pow(link->d, 2);
+    area = (area)/4;
+    
+    u = fabs(link->Q)/area;
+    if(u < umin)
+    {
+        u = umin;
+    }
+    Re = rho*u*link->d/mu;
+    phi = FrictFactorDerivative(Re, link->vareps/link->d, &dphi);
+    
+    //  C = 8 phi (L/d + L_e/d) + K0 + KRe/Re + Kd2(1 + 1/D_in) + Kd3 DN^-0.3
+    LD = link->L/link->d + coef->LeD;
+    K = coef->K0;
+    if(coef->Kd2 != 0.0)
+    {
+        K += coef->Kd2*(1 + 0.0254/link->d);
+    }
+    if(coef->Kd3 != 0.0)
+    {
+        K += coef->Kd3*pow(1000*link->d, (-0.3));
+    }
+    C = 8*phi*LD + K + coef->KRe/Re;
+    dC = 8*dphi*LD - coef->KRe/(Re*Re);
+    
+    //  h = C u|u|/(2g), dh/du = |u| (2C + Re dC/dRe)/(2g)
+    h = u*u/(2*g);
+    h = C*(h);
+    if(link->Q < 0)
+    {
+        h = -(h);
+    }
+    
+    *G = u*(2*C + Re*dC)/(2*g);
+    *G = (*G)/area;
+    
+    return h;
+}
+
+typedef struct PipeNetworkContext{
+    const PipeNetworkData *net;
+    const FittingsCoefficients *coef;
+    double *F;      // Signed head loss across each link (m).
+    double *G;      // Derivative of F with respect to flowrate (s/m2).
+} PipeNetworkContext;
+
+/// This subroutine is used to evaluate the head loss and its derivative for a contiguous block of links. Used as the kernel of "parallelFor(...)".
+static void PipeNetworkLinkBlock(int start, int end, void *context)
+{
+    PipeNetworkContext *ctx = context;
+    const PipeNetworkData *net = ctx->net;
+    
+    for(int k = start; k < end; ++k)
+    {
+        const NetworkLink *link = &net->link[k];
+        
+        if(link->type == NetworkPump)
+        {
+            //  Head gain is returned as a negative loss: F = -(h0 - r Q|Q|)
+            double Qmag = fabs(link->Q);
+            
+            ctx->F[k] = -(link->h0 - link->r*link->Q*Qmag);
+            ctx->G[k] = 2*link->r*Qmag;
+        }else{
+            ctx->F[k] = PipeNetworkHeadLoss(link, &ctx->coef[k], net->rho, net->mu, &ctx->G[k]);
+        }
+        if(ctx->G[k] < Gmin)
+        {
+            ctx->G[k] = Gmin;
+        }
+    }
+}
+
+/// This subroutine is used to find the position of an entry within a row of a sparse matrix.
+static int PipeNetworkFind(const SparseMatrix *A, int row, int col)
+{
+    int lo = A->rowptr[row];
+    int hi = A->rowptr[row + 1] - 1;
+    
+    while(lo <= hi)
+    {
+        int mid = (lo + hi)/2;
+        
+        if(A->col[mid] == col)
+        {
+            return mid;
+        }
+        if(A->col[mid] < col)
+        {
+            lo = mid + 1;
+        }else{
+            hi = mid - 1;
+        }
+    }
+    return -1;
+}
+
+static int PipeNetworkCompare(const void *a, const void *b)
+{
+    return (*(const int *)a) - (*(const int *)b);
+}
+
+int PipeNetworkSolve(PipeNetworkData *net, double tol, int maxiter)
+{
+    int nn = net->nnodes;
+    int nl = net->nlinks;
+    int nu = 0;                 // Number of junctions (unknown heads).
+    int nfixed = 0;
+    int iter = -1;
+    double cgtol = 1e-6;        // Relative tolerance of the linear solution.
+    int *map = NULL;            // Row of each junction within the Jacobian (-1 for fixed pressure nodes).
+    int *pos = NULL;            // Positions of the four Jacobian entries touched by each link.
+    int *count = NULL;
+    FittingsCoefficients *coef = NULL;
+    double *F = NULL;
+    double *G = NULL;
+    double *b = NULL;
+    double *H = NULL;
+    SparseMatrix A;
+    PipeNetworkContext ctx;
+    
+    map = malloc(nn*sizeof(int));
+    for(int i = 0; i < nn; ++i)
+    {
+        NetworkNode *node = &net->node[i];
+        
+        if(node->fixed == 1)
+        {
+            node->H = node->P/(net->rho*g) + node->z;
+            map[i] = -1;
+            ++nfixed;
+        }else{
+            map[i] = nu;
+            ++nu;
+        }
+    }
+    if(nfixed == 0)
+    {
+        free(map);
+        return -1;
+    }
+    
+    //  Symbolic assembly: sparsity pattern of the nodal Jacobian, built once.
+    count = calloc(nu + 1, sizeof(int));
+    for(int i = 0; i < nu; ++i)
+    {
+        count[i] = 1;
+    }
+    for(int k = 0; k < nl; ++k)
+    {
+        int ri = map[net->link[k].from];
+        int rj = map[net->link[k].to];
+        
+        if(ri >= 0 && rj >= 0)
+        {
+            ++count[ri];
+            ++count[rj];
+        }
+    }
+    A.n = nu;
+    A.rowptr = malloc((nu + 1)*sizeof(int));
+    A.rowptr[0] = 0;
+    for(int i = 0; i < nu; ++i)
+    {
+        A.rowptr[i + 1] = A.rowptr[i] + count[i];
+    }
+    A.col = malloc((A.rowptr[nu] + 1)*sizeof(int));
+    for(int i = 0; i < nu; ++i)
+    {
+        A.col[A.rowptr[i]] = i;
+        count[i] = 1;
+    }
+    for(int k = 0; k < nl; ++k)
+    {
+        int ri = map[net->link[k].from];
+        int rj = map[net->link[k].to];
+        
+        if(ri >= 0 && rj >= 0)
+        {
+            A.col[A.rowptr[ri] + count[ri]++] = rj;
+            A.col[A.rowptr[rj] + count[rj]++] = ri;
+        }
+    }
+    //  Sorting each row and removing duplicates from parallel links
+    A.nnz = 0;
+    for(int i = 0; i < nu; ++i)
+    {
+        int start = A.rowptr[i];
+        int end = A.rowptr[i + 1];
+        int first = A.nnz;
+        
+        qsort(&A.col[start], end - start, sizeof(int), PipeNetworkCompare);
+        for(int p = start; p < end; ++p)
+        {
+            if(A.nnz == first || A.col[A.nnz - 1] != A.col[p])
+            {
+                A.col[A.nnz++] = A.col[p];
+            }
+        }
+        A.rowptr[i] = first;
+    }
+    A.rowptr[nu] = A.nnz;
+    A.val = calloc(A.nnz + 1, sizeof(double));
+    
+    pos = malloc(4*(size_t)nl*sizeof(int) + 1);
+    for(int k = 0; k < nl; ++k)
+    {
+        int ri = map[net->link[k].from];
+        int rj = map[net->link[k].to];
+        
+        pos[4*k] = (ri >= 0) ? PipeNetworkFind(&A, ri, ri) : -1;
+        pos[4*k + 1] = (rj >= 0) ? PipeNetworkFind(&A, rj, rj) : -1;
+        pos[4*k + 2] = (ri >= 0 && rj >= 0) ? PipeNetworkFind(&A, ri, rj) : -1;
+        pos[4*k + 3] = (ri >= 0 && rj >= 0) ? PipeNetworkFind(&A, rj, ri) : -1;
+    }
+    
+    //  Fittings are reduced once and flowrates initialised at 1 m/s (pipes) or half the shut-off head (pumps).
+    coef = calloc(nl + 1, sizeof(FittingsCoefficients));
+    for(int k = 0; k < nl; ++k)
+    {
+        NetworkLink *link = &net->link[k];
+        
+        if(link->type == NetworkPipe)
+        {
+            FittingsReduce(&link->fittings, &coef[k]);
+        }
+        if(link->Q == 0.0)
+        {
+            if(link->type == NetworkPipe)
+            {
+                link->Q = PI*pow(link->d, 2)/4;
+            }else{
+                link->Q = (link->r > 0) ? sqrt(0.5*link->h0/link->r) : 0.01;
+            }
+        }
+    }
+    
+    F = calloc(2*(size_t)nl + 1, sizeof(double));
+    G = F + nl;
+    b = calloc(2*(size_t)nu + 1, sizeof(double));
+    H = b + nu;
+    for(int i = 0; i < nn; ++i)
+    {
+        if(map[i] >= 0)
+        {
+            //  Initial junction heads taken from the mean fixed head.
+            double Hsum = 0.0;
+            
+            for(int j = 0; j < nn; ++j)
+            {
+                if(map[j] < 0)
+                {
+                    Hsum += net->node[j].H;
+                }
+            }
+            H[map[i]] = Hsum/nfixed;
+            break;
+        }
+    }
+    for(int i = 1; i < nu; ++i)
+    {
+        H[i] = H[0];
+    }
+    
+    ctx.net = net;
+    ctx.coef = coef;
+    ctx.F = F;
+    ctx.G = G;
+    
+    for(int it = 1; it <= maxiter; ++it)
+    {
+        double dQsum = 0.0;
+        double Qsum = 0.0;
+        
+        parallelFor(nl, linkbatch, PipeNetworkLinkBlock, &ctx);
+        
+        //  Numerical assembly of A H = b
+        memset(A.val, 0, A.nnz*sizeof(double));
+        for(int i = 0; i < nn; ++i)
+        {
+            if(map[i] >= 0)
+            {
+                b[map[i]] = -net->node[i].demand;
+            }
+        }
+        for(int k = 0; k < nl; ++k)
+        {
+            const NetworkLink *link = &net->link[k];
+            int ri = map[link->from];
+            int rj = map[link->to];
+            double c = 1/G[k];
+            double y = link->Q - F[k]*c;
+            
+            if(ri >= 0)
+            {
+                A.val[pos[4*k]] += c;
+                b[ri] -= y;
+                if(rj >= 0)
+                {
+                    A.val[pos[4*k + 2]] -= c;
+                }else{
+                    b[ri] += c*net->node[link->to].H;
+                }
+            }
+            if(rj >= 0)
+            {
+                A.val[pos[4*k + 1]] += c;
+                b[rj] += y;
+                if(ri >= 0)
+                {
+                    A.val[pos[4*k + 3]] -= c;
+                }else{
+                    b[rj] += c*net->node[link->from].H;
+                }
+            }
+        }
+        //  Junctions without links are held at their current head.
+        for(int i = 0; i < nu; ++i)
+        {
+            int p = PipeNetworkFind(&A, i, i);
+            
+            if(A.val[p] == 0.0)
+            {
+                A.val[p] = 1.0;
+                b[i] = H[i];
+            }
+        }
+        
+        //  Inexact Newton: the linear tolerance tightens as the flowrate corrections shrink.
+        if(nu > 0 && SparseCGSolve(&A, b, H, cgtol, 10*nu + 100) < 0)
+        {
+            break;
+        }
+        
+        //  Updating the flowrates from the new junction heads
+        for(int i = 0; i < nn; ++i)
+        {
+            if(map[i] >= 0)
+            {
+                net->node[i].H = H[map[i]];
+            }
+        }
+        for(int k = 0; k < nl; ++k)
+        {
+            NetworkLink *link = &net->link[k];
+            double Qnew = link->Q - F[k]/G[k] + (net->node[link->from].H - net->node[link->to].H)/G[k];
+            
+            dQsum += fabs(Qnew - link->Q);
+            Qsum += fabs(Qnew);
+            link->Q = Qnew;
+        }
+        
+        if(dQsum <= tol*Qsum)
+        {
+            iter = it;
+            break;
+        }
+        cgtol = 1e-4*dQsum/Qsum;
+        cgtol = (cgtol > 1e-6) ? 1e-6 : cgtol;
+        cgtol = (cgtol < 1e-12) ? 1e-12 : cgtol;
+    }
+    
+    //  Final head losses and junction pressures
+    parallelFor(nl, linkbatch, PipeNetworkLinkBlock, &ctx);
+    for(int i = 0; i < nn; ++i)
+    {
+        if(map[i] >= 0)
+        {
+            net->node[i].P = net->rho*g*(net->node[i].H - net->node[i].z);
+        }else{
+            net->node[i].demand = 0.0;
+        }
+    }
+    for(int k = 0; k < nl; ++k)
+    {
+        NetworkLink *link = &net->link[k];
+        
+        link->hf = (link->type == NetworkPump) ? -F[k] : F[k];
+        //  Flowrate leaving the network at each fixed pressure node
+        if(map[link->from] < 0)
+        {
+            net->node[link->from].demand -= link->Q;
+        }
+        if(map[link->to] < 0)
+        {
+            net->node[link->to].demand += link->Q;
+        }
+    }
+    
+    free(map);
+    free(pos);
+    free(count);
+    free(coef);
+    free(F);
+    free(b);
+    free(A.rowptr);
+    free(A.col);
+    free(A.val);
+    
+    return iter;
+}
+
+/// MARK: DISPLAY AND WRITE
+void PipeNetworkDisplay(const PipeNetworkData *net)
+{
+    printf("_Pipe_Network_Results_\n");
+    printf("Fluid density:\n");
+    printf("rho =\t%.3f\tkg/m3\n", net->rho);
+    printf("Fluid viscosity:\n");
+    printf("mu =\t%.3f\tcP\n\n", net->mu*1000);
+    
+    printf("\tNodes:\n");
+    printf("Node\tBoundary\tz (m)\tDemand (m3/s)\tH (m)\tP (kPa)\n");
+    for(int i = 0; i < net->nnodes; ++i)
+    {
+        const NetworkNode *node = &net->node[i];
+        
+        printf("%i\t%s\t%.3f\t%.5f\t%.3f\t%.3f\n", i + 1, (node->fixed == 1) ? "Fixed pressure" : "Junction", node->z, node->demand, node->H, node->P*0.001);
+    }
+    printf("\n");
+    
+    printf("\tLinks:\n");
+    printf("Link\tType\tFrom\tTo\tL (m)\td (mm)\tQ (m3/s)\tu (m/s)\th (m)\n");
+    for(int k = 0; k < net->nlinks; ++k)
+    {
+        const NetworkLink *link = &net->link[k];
+        
+        if(link->type == NetworkPump)
+        {
+            printf("%i\tPump\t%i\t%i\t-\t-\t%.5f\t-\t%.3f\n", k + 1, link->from + 1, link->to + 1, link->Q, link->hf);
+        }else{
+            printf("%i\tPipe\t%i\t%i\t%.3f\t%.3f\t%.5f\t%.3f\t%.3f\n", k + 1, link->from + 1, link->to + 1, link->L, link->d*1000, link->Q, 4*link->Q/(PI*link->d*link->d), link->hf);
+        }
+    }
+    printf("\n");
+}
+
+void PipeNetworkWrite(const PipeNetworkData *net)
+{
+    //  Function variables
+    ResultWriter w;             // Buffered writer for the results file.
+    
+    //  Set file name as timestamp + Pipe Network Results
+    if(!writerOpen(&w, "Pipe Network Results"))
+    {
+        return;
+    }
+    
+    //  Write to file
+    writerPrintf(&w, "_Pipe_Network_Results_\n");
+    writerPrintf(&w, "Fluid density:\n");
+    writerPrintf(&w, "rho =\t%.3f\tkg/m3\n", net->rho);
+    writerPrintf(&w, "Fluid viscosity:\n");
+    writerPrintf(&w, "mu =\t%.3f\tcP\n\n", net->mu*1000);
+    
+    writerPrintf(&w, "\tNodes:\n");
+    writerPrintf(&w, "Node\tBoundary\tz (m)\tDemand (m3/s)\tH (m)\tP (kPa)\n");
+    for(int i = 0; i < net->nnodes; ++i)
+    {
+        const NetworkNode *node = &net->node[i];
+        
+        writerPrintf(&w, "%i\t%s\t%.3f\t%.5f\t%.3f\t%.3f\n", i + 1, (node->fixed == 1) ? "Fixed pressure" : "Junction", node->z, node->demand, node->H, node->P*0.001);
+    }
+    writerPrintf(&w, "\n");
+    
+    writerPrintf(&w, "\tLinks:\n");
+    writerPrintf(&w, "Link\tType\tFrom\tTo\tL (m)\td (mm)\tQ (m3/s)\tu (m/s)\th (m)\n");
+    for(int k = 0; k < net->nlinks; ++k)
+    {
+        const NetworkLink *link = &net->link[k];
+        
+        if(link->type == NetworkPump)
+        {
+            writerPrintf(&w, "%i\tPump\t%i\t%i\t-\t-\t%.5f\t-\t%.3f\n", k + 1, link->from + 1, link->to + 1, link->Q, link->hf);
+        }else{
+            writerPrintf(&w, "%i\tPipe\t%i\t%i\t%.3f\t%.3f\t%.5f\t%.3f\t%.3f\n", k + 1, link->from + 1, link->to + 1, link->L, link->d*1000, link->Q, 4*link->Q/(PI*link->d*link->d), link->hf);
+        }
+    }
+    
+    //  Close file
+    writerClose(&w);
+}
+
+void PipeNetworkWriteSwitch(const PipeNetworkData *net)
+{
+    int control = 0;
+    
+    control = 1;
+    while(control == 1)
+    {
+        char input[maxstrlen];
+        
+        printf("Do you want to save results to file? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+            case 'T':
+            case 'Y':
+            case 't':
+            case 'y':
+                PipeNetworkWrite(net);
+                control = 0;
+                break;
+            case '0':
+            case 'F':
+            case 'N':
+            case 'f':
+            case 'n':
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+}
+
+/// MARK: PSEUDO-MAIN FUNCTION
+void PipeNetwork(void)
+{
+    int whilmain = 0;
+    printf("Pipe Network Hydraulics\n");
+    
+    whilmain = 1;
+    while(whilmain == 1)
+    {
+        //  Variable declaration
+        PipeNetworkData net;
+        int iter = 0;
+            //  Variables for timing function
+        struct timespec start, end;
+        double elapsed = 0.0;
+        
+        memset(&net, 0, sizeof(PipeNetworkData));
+        
+        //  Data Collection
+        PipeNetworkVariable(&net);
+        
+        //  Data Manipulation
+        clock_getres(CLOCK_MONOTONIC, &start);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        
+        iter = PipeNetworkSolve(&net, 1e-9, 100);
+        
+        clock_getres(CLOCK_MONOTONIC, &end);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        elapsed = timer(start, end);
+
+        printf("Calculations completed in %.6f seconds.\n", elapsed);
+        
+        if(iter > 0)
+        {
+            printf("Network converged in %i iterations.\n", iter);
+            
+            //  Displaying results
+            PipeNetworkDisplay(&net);
+            
+            //  Writing to File
+            PipeNetworkWriteSwitch(&net);
+        }else{
+            printf("The network could not be solved. Check that at least one node has a fixed pressure.\n");
+        }
+        
+        //  Continue function
+        whilmain = Continue(whilmain);
+        PipeNetworkFree(&net);
+    }
+    fflush(stdout);
+}
@@ -0,0 +1,116 @@
+//
+//  03hPipeNetwork.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef _3hPipeNetworkStruct_h
+#define _3hPipeNetworkStruct_h
+
+#define NetworkPipe 1       // Link is a pipe with fittings.
+#define NetworkPump 2       // Link is a pump following H = h0 - r Q^2.
+
+typedef struct NetworkNode{
+    double z;           // Node elevation (m).
+    double demand;      // Volumetric flowrate withdrawn from the node (m3/s). Negative values supply the node. Calculated for fixed pressure nodes.
+    int fixed;          // Boundary condition: junction (0) or fixed pressure (1).
+    double P;           // Node pressure (Pa). Specified for fixed pressure nodes, calculated for junctions.
+    double H;           // Piezometric head, P/(rho g) + z (m).
+} NetworkNode;
+
+typedef struct NetworkLink{
+    int type;               // Link type (NetworkPipe or NetworkPump).
+    int from;               // Upstream node. Positive flow runs from "from" to "to".
+    int to;                 // Downstream node.
+    double L;               // Pipe length (m).
+    double d;               // Internal pipe diameter (m).
+    double vareps;          // Pipe absolute roughness (m).
+    FittingsLine fittings;  // Fittings installed on the pipe.
+    double h0;              // Pump shut-off head (m).
+    double r;               // Pump curve coefficient (s2/m5).
+    double Q;               // Volumetric flowrate (m3/s).
+    double hf;              // Head loss across a pipe or head gain across a pump (m).
+} NetworkLink;
+
+typedef struct PipeNetworkData{
+    double rho;             // Fluid density (kg/m3).
+    double mu;              // Fluid viscosity (Pa.s).
+    int nnodes;             // Number of nodes.
+    int nlinks;             // Number of pipes and pumps.
+    NetworkNode *node;      // Array of nodes.
+    NetworkLink *link;      // Array of links.
+} PipeNetworkData;
+
+#endif /* _3hPipeNetworkStruct_h */
+
+#ifndef _3hPipeNetworkVariable_h
+#define _3hPipeNetworkVariable_h
+
+/// This subroutine is used to collect the fluid properties, nodes and links describing the network. Arrays are allocated by this subroutine and released by "PipeNetworkFree(...)".
+/// @param net Struct where the network description should be entered.
+void PipeNetworkVariable(PipeNetworkData *net);
+
+/// This subroutine is used to release the arrays allocated for a network.
+/// @param net Network description.
+void PipeNetworkFree(PipeNetworkData *net);
+
+#endif /* _3hPipeNetworkVariable_h */
+
+#ifndef _3hPipeNetworkCalc_h
+#define _3hPipeNetworkCalc_h
+
+/// This subroutine is used to calculate the head loss through a pipe and its derivative with respect to flowrate. The friction factor derivative is found analytically from "FrictFactorDerivative(...)".
+/// @param link Pipe description (flowrate taken from link->Q).
+/// @param coef Fittings coefficients from "FittingsReduce(...)".
+/// @param rho Fluid density (kg/m3).
+/// @param mu Fluid viscosity (Pa.s).
+/// @param G Derivative of the head loss with respect to flowrate (s/m2).
+/// @return Signed head loss (m).
+double PipeNetworkHeadLoss(const NetworkLink *link, const FittingsCoefficients *coef, double rho, double mu, double *G);
+
+/// This subroutine is used to solve the flowrate through every link and the head at every junction by the global gradient (Todini-Pilati) form of the Newton-Raphson method. Each iteration assembles the sparse nodal Jacobian in compressed sparse row format and solves it by preconditioned conjugate gradients. This function returns the number of iterations performed or -1 if the network did not converge or has no fixed pressure node.
+/// @param net Network description. Link flowrates are used as the initial guess when non-zero.
+/// @param tol Convergence tolerance on the sum of flowrate corrections relative to the sum of flowrates.
+/// @param maxiter Maximum number of Newton iterations.
+int PipeNetworkSolve(PipeNetworkData *net, double tol, int maxiter);
+
+#endif /* _3hPipeNetworkCalc_h */
+
+#ifndef _3hPipeNetworkDisplay_h
+#define _3hPipeNetworkDisplay_h
+
+/// This subroutine is used to display the solved nodes and links.
+/// @param net Solved network.
+void PipeNetworkDisplay(const PipeNetworkData *net);
+
+/// This subroutine is used to write the solved nodes and links to a .txt file.
+/// @param net Solved network.
+void PipeNetworkWrite(const PipeNetworkData *net);
+
+/// This subroutine is used to check if the user would like to write the solved network to a file.
+/// @param net Solved network.
+void PipeNetworkWriteSwitch(const PipeNetworkData *net);
+
+#endif /* _3hPipeNetworkDisplay_h */
+
+#ifndef _3hPipeNetwork_h
+#define _3hPipeNetwork_h
+
+/// This subroutine is used to guide the user through solving the flow distribution through a network of pipes and pumps.
+void PipeNetwork(void);
+
+#endif /* _3hPipeNetwork_h */
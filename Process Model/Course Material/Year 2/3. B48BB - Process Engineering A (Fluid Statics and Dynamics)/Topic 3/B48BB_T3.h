@@ -39,5 +39,7 @@ void OrificePlateMeter(void);
 
 /// This subroutine guides the user through gathering the data and calculation of the mass flowrate of a flowing fluid through a rotameter.
 void Rotameter(void);
+/// This subroutine guides the user through solving the flow distribution through a network of pipes and pumps.
+void PipeNetwork(void);
 
 #endif /* B48BB_T3_h */
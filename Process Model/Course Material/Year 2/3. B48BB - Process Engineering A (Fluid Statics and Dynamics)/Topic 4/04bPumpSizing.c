@@ -29,6 +29,7 @@
 
 //  Cusom header files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BB_T4.h"
 #include "04bPumpSizing.h"
 
@@ -188,101 +189,62 @@ void PumpDisplay(head suction, head discharge, double Q, double rho, double Psat
 void PumpWrite(head suction, head discharge, double Q, double rho, double Psat, double NPSHr, double NPSHa, double eta, double phead, double ppressure, double ppower)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
     //  Set file name as timestamp + Pump Sizing
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Pump Sizing");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, "Pump Sizing"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
-    fprintf(fp, "_Pump_Sizing_Results_\n");
-    
-    fprintf(fp, "Suction-side parameters.\n");
-    fprintf(fp, "Suction vessel pressure:\n");
-    fprintf(fp, "P =\t%.3f\tkPa\n", (suction.P)*0.001);
-    fprintf(fp, "Liquid level in Suction-side vessel:\n");
-    fprintf(fp, "h_s1 =\t%.3f\tm\n", suction.h1);
-    fprintf(fp, "Liquid level above pump inlet:\n");
-    fprintf(fp, "h_s2 =\t%.3f\tm\n", suction.h2);
-    fprintf(fp, "Suction side frictional losses:\n");
-    fprintf(fp, "h_f,s =\t%.3f\tm\n\n", suction.hf);
-    
-    fprintf(fp, "Discharge-side parameters.\n");
-    fprintf(fp, "Discharge vessel pressure:\n");
-    fprintf(fp, "P =\t%.3f\tkPa\n", (discharge.P)*0.001);
-    fprintf(fp, "Liquid level in Discharge-side vessel:\n");
-    fprintf(fp, "h_d1 =\t%.3f\tm\n", discharge.h1);
-    fprintf(fp, "Liquid level above pump outlet:\n");
-    fprintf(fp, "h_d2 =\t%.3f\tm\n", discharge.h2);
-    fprintf(fp, "Discharge side frictional losses:\n");
-    fprintf(fp, "h_f,d =\t%.3f\tm\n\n", discharge.hf);
-    
-    fprintf(fp, "Fluid-specific parameters\n");
-    fprintf(fp, "Volmetric flowrate:\n");
-    fprintf(fp, "Q =\t%.3f\tm3/s\n", Q);
-    fprintf(fp, "Fluid density:\n");
-    fprintf(fp, "rho =\t%.3f\tkg/m3\n", rho);
-    fprintf(fp, "Fluid saturated vapour pressure:\n");
-    fprintf(fp, "Psat =\t%.3f\tkPa\n\n", Psat*0.001);
-    
-    fprintf(fp, "Pump-specific parameters\n");
-    fprintf(fp, "Required NPSH:\n");
-    fprintf(fp, "NPSHr =\t%.2f\tm\n", NPSHr);
-    fprintf(fp, "Available NPSH:\n");
-    fprintf(fp, "NPSHa =\t%.2f\tm\n", NPSHa);
-    fprintf(fp, "Pump efficiency:");
-    fprintf(fp, "eta =\t%.1f\t%%\n\n", eta*100);
-    
-    fprintf(fp, "Pump head:\n");
-    fprintf(fp, "phead =\t%.3f\tm\n", phead);
-    fprintf(fp, "Pump pressure:\n");
-    fprintf(fp, "dP_P =\t%.3f\tkPa\n", ppressure*0.001);
-    fprintf(fp, "Pump power:\n");
-    fprintf(fp, "W_h =\t%.3f\tkW\n", ppower*0.001);
+    writerPrintf(&w, "_Pump_Sizing_Results_\n");
+    
+    writerPrintf(&w, "Suction-side parameters.\n");
+    writerPrintf(&w, "Suction vessel pressure:\n");
+    writerPrintf(&w, "P =\t%.3f\tkPa\n", (suction.P)*0.001);
+    writerPrintf(&w, "Liquid level in Suction-side vessel:\n");
+    writerPrintf(&w, "h_s1 =\t%.3f\tm\n", suction.h1);
+    writerPrintf(&w, "Liquid level above pump inlet:\n");
+    writerPrintf(&w, "h_s2 =\t%.3f\tm\n", suction.h2);
+    writerPrintf(&w, "Suction side frictional losses:\n");
+    writerPrintf(&w, "h_f,s =\t%.3f\tm\n\n", suction.hf);
+    
+    writerPrintf(&w, "Discharge-side parameters.\n");
+    writerPrintf(&w, "Discharge vessel pressure:\n");
+    writerPrintf(&w, "P =\t%.3f\tkPa\n", (discharge.P)*0.001);
+    writerPrintf(&w, "Liquid level in Discharge-side vessel:\n");
+    writerPrintf(&w, "h_d1 =\t%.3f\tm\n", discharge.h1);
+    writerPrintf(&w, "Liquid level above pump outlet:\n");
+    writerPrintf(&w, "h_d2 =\t%.3f\tm\n", discharge.h2);
+    writerPrintf(&w, "Discharge side frictional losses:\n");
+    writerPrintf(&w, "h_f,d =\t%.3f\tm\n\n", discharge.hf);
+    
+    writerPrintf(&w, "Fluid-specific parameters\n");
+    writerPrintf(&w, "Volmetric flowrate:\n");
+    writerPrintf(&w, "Q =\t%.3f\tm3/s\n", Q);
+    writerPrintf(&w, "Fluid density:\n");
+    writerPrintf(&w, "rho =\t%.3f\tkg/m3\n", rho);
+    writerPrintf(&w, "Fluid saturated vapour pressure:\n");
+    writerPrintf(&w, "Psat =\t%.3f\tkPa\n\n", Psat*0.001);
+    
+    writerPrintf(&w, "Pump-specific parameters\n");
+    writerPrintf(&w, "Required NPSH:\n");
+    writerPrintf(&w, "NPSHr =\t%.2f\tm\n", NPSHr);
+    writerPrintf(&w, "Available NPSH:\n");
+    writerPrintf(&w, "NPSHa =\t%.2f\tm\n", NPSHa);
+    writerPrintf(&w, "Pump efficiency:");
+    writerPrintf(&w, "eta =\t%.1f\t%%\n\n", eta*100);
+    
+    writerPrintf(&w, "Pump head:\n");
+    writerPrintf(&w, "phead =\t%.3f\tm\n", phead);
+    writerPrintf(&w, "Pump pressure:\n");
+    writerPrintf(&w, "dP_P =\t%.3f\tkPa\n", ppressure*0.001);
+    writerPrintf(&w, "Pump power:\n");
+    writerPrintf(&w, "W_h =\t%.3f\tkW\n", ppower*0.001);
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void PumpWriteSwitch(head suction, head discharge, double Q, double rho, double Psat, double NPSHr, double NPSHa, double eta, double phead, double ppressure, double ppower)
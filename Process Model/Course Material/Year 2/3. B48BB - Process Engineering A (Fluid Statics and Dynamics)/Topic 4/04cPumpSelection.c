@@ -0,0 +1,714 @@
+//
+//  04cPumpSelection.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+/// MARK: HEADER DECLARATIONS
+//  Standard header files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//  Custom header files
+#include "System.h"
+#include "ResultWriter.h"
+#include "Parallel.h"
+#include "B48BB_T4.h"
+#include "03dFittingsLoss.h"
+#include "03hPipeNetwork.h"
+#include "04bPumpSizing.h"
+#include "04cPumpSelection.h"
+
+/// MARK: SUBROUTINE DEFINITIONS
+#define maxstrlen 128
+#define g 9.80665
+#define trimlimit 0.7       // Smallest impeller diameter as a fraction of the measured diameter.
+#define pumpbatch 64        // Pumps screened by each parallel task.
+#define displaylimit 20     // Largest number of ranked pumps shown on the console.
+
+/// MARK: VARIABLE INPUT
+void PumpCurveVariable(PumpCurve *curve)
+{
+    char input[maxstrlen];
+    char label[maxstrlen];
+    
+    printf("Pump model: ");
+    fgets(input, sizeof(input), stdin);
+    input[strcspn(input, "\r\n")] = '\0';
+    strncpy(curve->name, input, PumpNameLength - 1);
+    curve->name[PumpNameLength - 1] = '\0';
+    
+    curve->N0 = inputDouble(0, 0, "speed the curves were measured at", "rpm");
+    curve->D0 = inputDouble(0, 0, "impeller diameter the curves were measured at", "mm");
+    curve->Qmax = inputDouble(0, 0, "largest flowrate on the curve", "m3/s");
+    
+    printf("Curves are entered as y = c0 + c1 Q + c2 Q^2 + c3 Q^3 with Q in m3/s.\n");
+    for(int i = 0; i < PumpCurveOrder; ++i)
+    {
+        snprintf(label, sizeof(label), "head coefficient c%i", i);
+        curve->H[i] = inputDouble(1, 1, label, "m");
+    }
+    for(int i = 0; i < PumpCurveOrder; ++i)
+    {
+        snprintf(label, sizeof(label), "efficiency coefficient c%i", i);
+        curve->eta[i] = inputDouble(1, 1, label, "[ ]");
+    }
+    for(int i = 0; i < PumpCurveOrder; ++i)
+    {
+        snprintf(label, sizeof(label), "required NPSH coefficient c%i", i);
+        curve->NPSHr[i] = inputDouble(1, 1, label, "m");
+    }
+    
+    curve->N = inputDouble(0, 0, "operating speed", "rpm");
+    curve->D = curve->D0;
+}
+
+int PumpCatalogueRead(const char *filename, PumpCurve **catalogue)
+{
+    char line[512];
+    int n = 0;
+    int size = 0;
+    FILE *fp = NULL;
+    PumpCurve *list = NULL;
+    
+    fp = fopen(filename, "r");
+    if(fp == NULL)
+    {
+        printf("Catalogue \"%s\" could not be opened.\n", filename);
+        *catalogue = NULL;
+        return 0;
+    }
+    
+    while(fgets(line, sizeof(line), fp) != NULL)
+    {
+        PumpCurve c;
+        
+        memset(&c, 0, sizeof(PumpCurve));
+        if(sscanf(line, "%31s %lf %lf %lf %lf %lf %lf %lf %lf %lf %lf %lf %lf %lf %lf %lf", c.name, &c.N0, &c.D0, &c.Qmax, &c.H[0], &c.H[1], &c.H[2], &c.H[3], &c.eta[0], &c.eta[1], &c.eta[2], &c.eta[3], &c.NPSHr[0], &c.NPSHr[1], &c.NPSHr[2], &c.NPSHr[3]) != 16)
+        {
+            //  Comments and incomplete lines are skipped.
+            continue;
+        }
+        c.N = c.N0;
+        c.D = c.D0;
+        
+        if(n == size)
+        {
+            size = (size == 0) ? 64 : 2*size;
+            list = realloc(list, size*sizeof(PumpCurve));
+        }
+        list[n] = c;
+        ++n;
+    }
+    fclose(fp);
+    
+    *catalogue = list;
+    return n;
+}
+
+/// This subroutine is used to collect the pipe and fittings on one side of the pump.
+/// @param side Description of the line printed to the user.
+/// @param id Line identifier passed to "FittingsLineVariable(...)".
+/// @param pipe Struct where the line should be entered.
+static void SystemLineVariable(const char *side, int id, NetworkLink *pipe)
+{
+    char input[maxstrlen];
+    int control = 0;
+    
+    printf("%s line\n", side);
+    pipe->type = NetworkPipe;
+    pipe->L = inputDouble(1, 0, "pipe length", "m");
+    
+    pipe->d = inputDouble(0, 0, "internal pipe diameter", "mm");
+    pipe->d = (pipe->d)*0.001; // Conversion (mm to m)
+    
+    pipe->vareps = inputDouble(1, 0, "pipe absolute roughness", "mm");
+    pipe->vareps = (pipe->vareps)*0.001; // Conversion (mm to m)
+    
+    control = 1;
+    while(control == 1)
+    {
+        printf("Are there fittings installed on the %s line? [Y/N] ", side);
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+            case 'T':
+            case 'Y':
+            case 't':
+            case 'y':
+                FittingsLineVariable(id, &pipe->fittings);
+                control = 0;
+                break;
+            case '0':
+            case 'F':
+            case 'N':
+            case 'f':
+            case 'n':
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+}
+
+void SystemCurveVariable(SystemCurve *sys)
+{
+    sys->rho = inputDouble(0, 0, "fluid density", "kg/m3");
+    
+    sys->mu = inputDouble(0, 0, "fluid viscosity", "cP");
+    sys->mu = (sys->mu)*0.001; // Conversion (cP to Pa.s)
+    
+    sys->Psat = inputDouble(0, 0, "fluid vapour pressure", "kPa");
+    sys->Psat = (sys->Psat)*1000;
+    
+    printf("Suction head parameters\n");
+    sys->suction.P = inputDouble(0, 0, "suction vessel pressure", "kPa");
+    sys->suction.P = (sys->suction.P)*1000;
+    
+    sys->suction.h1 = inputDouble(1, 1, "liquid level in Suction-side vessel", "m");
+    
+    sys->suction.h2 = inputDouble(1, 1, "liquid elevation above pump inlet", "m");
+    
+    SystemLineVariable("Suction", 0, &sys->spipe);
+    
+    printf("Discharge head parameters\n");
+    sys->discharge.P = inputDouble(0, 0, "discharge vessel pressure", "kPa");
+    sys->discharge.P = (sys->discharge.P)*1000;
+    
+    sys->discharge.h1 = inputDouble(1, 1, "liquid level in Discharge-side vessel", "m");
+    
+    sys->discharge.h2 = inputDouble(1, 1, "liquid elevation above pump outlet", "m");
+    
+    SystemLineVariable("Discharge", 1, &sys->dpipe);
+    
+    FittingsReduce(&sys->spipe.fittings, &sys->sK);
+    FittingsReduce(&sys->dpipe.fittings, &sys->dK);
+}
+
+/// MARK: GENERAL CALCULATIONS
+double PumpCurveEvaluate(const PumpCurve *curve, const double *c, int power, double Q, double *dydQ)
+{
+    double s = 0.0;     // Affinity ratio, (N/N0)(D/D0).
+    double Qr = 0.0;    // Flowrate on the measured curve.
+    double y = 0.0;
+    double dy = 0.0;
+    double scale = 1.0;
+    
+    s = curve->N/curve->N0;
+    s = (s)*curve->D/curve->D0;
+    Qr = Q/s;
+    
+    //  Horner's method for the polynomial and its derivative
+    for(int i = PumpCurveOrder - 1; i >= 0; --i)
+    {
+        dy = dy*Qr + y;
+        y = y*Qr + c[i];
+    }
+    
+    for(int i = 0; i < power; ++i)
+    {
+        scale = (scale)*s;
+    }
+    if(dydQ != NULL)
+    {
+        *dydQ = scale*dy/s;
+    }
+    
+    return scale*y;
+}
+
+double SystemCurveHead(const SystemCurve *sys, double Q, double *dHdQ, double *hfs)
+{
+    NetworkLink pipe;
+    double H = 0.0;
+    double hf = 0.0;
+    double G = 0.0;
+    
+    //  Static head
+    H = sys->rho*g;
+    H = (sys->discharge.P - sys->suction.P)/(H);
+    H = (H) + sys->discharge.h1 + sys->discharge.h2;
+    H = (H) - sys->suction.h1 - sys->suction.h2;
+    *dHdQ = 0.0;
+    
+    //  Suction side losses
+    if(sys->spipe.d > 0)
+    {
+        pipe = sys->spipe;
+        pipe.Q = Q;
+        hf = PipeNetworkHeadLoss(&pipe, &sys->sK, sys->rho, sys->mu, &G);
+        H = (H) + hf;
+        *dHdQ = (*dHdQ) + G;
+    }
+    if(hfs != NULL)
+    {
+        *hfs = hf;
+    }
+    
+    //  Discharge side losses
+    if(sys->dpipe.d > 0)
+    {
+        pipe = sys->dpipe;
+        pipe.Q = Q;
+        hf = PipeNetworkHeadLoss(&pipe, &sys->dK, sys->rho, sys->mu, &G);
+        H = (H) + hf;
+        *dHdQ = (*dHdQ) + G;
+    }
+    
+    return H;
+}
+
+void PumpOperatingPointSolve(const PumpCurve *curve, const SystemCurve *sys, PumpOperatingPoint *op)
+{
+    double lo = 0.0;
+    double hi = 0.0;
+    double Q = 0.0;
+    double f = 0.0;
+    double df = 0.0;
+    double dHp = 0.0;
+    double dHs = 0.0;
+    double hfs = 0.0;
+    
+    memset(op, 0, sizeof(PumpOperatingPoint));
+    op->D = curve->D;
+    hi = curve->Qmax*(curve->N/curve->N0)*(curve->D/curve->D0);
+    
+    //  F(Q) = H_pump(Q) - H_system(Q) is bracketed by the ends of the pump curve.
+    f = PumpCurveEvaluate(curve, curve->H, 2, lo, &dHp) - SystemCurveHead(sys, lo, &dHs, NULL);
+    if(f <= 0)
+    {
+        op->status = 1;
+        return;
+    }
+    f = PumpCurveEvaluate(curve, curve->H, 2, hi, &dHp) - SystemCurveHead(sys, hi, &dHs, NULL);
+    if(f > 0)
+    {
+        op->status = 2;
+        Q = hi;
+    }else{
+        Q = 0.5*hi;
+        for(int i = 0; i < 100; ++i)
+        {
+            double Qnew = 0.0;
+            
+            f = PumpCurveEvaluate(curve, curve->H, 2, Q, &dHp) - SystemCurveHead(sys, Q, &dHs, NULL);
+            df = dHp - dHs;
+            if(f > 0)
+            {
+                lo = Q;
+            }else{
+                hi = Q;
+            }
+            
+            //  Newton step, falling back on bisection when it leaves the bracket
+            Qnew = (df < 0) ? Q - f/df : lo - 1;
+            if(Qnew <= lo || Qnew >= hi)
+            {
+                Qnew = 0.5*(lo + hi);
+            }
+            if(fabs(Qnew - Q) <= 1e-12*hi)
+            {
+                Q = Qnew;
+                break;
+            }
+            Q = Qnew;
+        }
+    }
+    
+    op->Q = Q;
+    op->H = PumpCurveEvaluate(curve, curve->H, 2, Q, NULL);
+    op->eta = PumpCurveEvaluate(curve, curve->eta, 0, Q, NULL);
+    op->NPSHr = PumpCurveEvaluate(curve, curve->NPSHr, 2, Q, NULL);
+    
+    SystemCurveHead(sys, Q, &dHs, &hfs);
+    op->NPSHa = NPSHCalculation((head){sys->suction.P, sys->suction.h1, sys->suction.h2, hfs}, sys->Psat, sys->rho);
+    
+    op->power = PumpPressureCalculation(sys->rho, op->H);
+    op->power = (op->eta > 0) ? PumpPower(op->power, Q, op->eta) : INFINITY;
+}
+
+int PumpTrim(PumpCurve *curve, const SystemCurve *sys, double Qduty)
+{
+    double Hsys = 0.0;
+    double dHs = 0.0;
+    double lo = 0.0;
+    double hi = 0.0;
+    
+    Hsys = SystemCurveHead(sys, Qduty, &dHs, NULL);
+    
+    //  Pump head at the duty flowrate rises with impeller diameter, so the trimmed diameter is bracketed.
+    lo = trimlimit*curve->D0;
+    hi = curve->D0;
+    curve->D = hi;
+    if(PumpCurveEvaluate(curve, curve->H, 2, Qduty, NULL) < Hsys)
+    {
+        return 1;
+    }
+    curve->D = lo;
+    if(PumpCurveEvaluate(curve, curve->H, 2, Qduty, NULL) > Hsys)
+    {
+        //  Still oversized at the smallest trim, so the measured diameter is kept
+        curve->D = curve->D0;
+        return 1;
+    }
+    
+    for(int i = 0; i < 60; ++i)
+    {
+        curve->D = 0.5*(lo + hi);
+        if(PumpCurveEvaluate(curve, curve->H, 2, Qduty, NULL) > Hsys)
+        {
+            hi = curve->D;
+        }else{
+            lo = curve->D;
+        }
+    }
+    curve->D = hi;
+    
+    return 0;
+}
+
+typedef struct PumpScreenContext{
+    const PumpCurve *catalogue;
+    const SystemCurve *sys;
+    double Qduty;
+    int trim;
+    PumpOperatingPoint *op;
+} PumpScreenContext;
+
+/// This subroutine is used to solve the operating point of a contiguous block of pumps. Used as the kernel of "parallelFor(...)".
+static void PumpScreenBlock(int start, int end, void *context)
+{
+    PumpScreenContext *ctx = context;
+    
+    for(int i = start; i < end; ++i)
+    {
+        PumpCurve curve = ctx->catalogue[i];
+        int trimmed = 0;
+        
+        if(ctx->trim == 1)
+        {
+            trimmed = PumpTrim(&curve, ctx->sys, ctx->Qduty);
+        }
+        PumpOperatingPointSolve(&curve, ctx->sys, &ctx->op[i]);
+        if(trimmed != 0 && ctx->op[i].status == 0)
+        {
+            ctx->op[i].status = 3;
+        }
+    }
+}
+
+typedef struct PumpRankKey{
+    int id;
+    int feasible;
+    double power;
+    double margin;
+} PumpRankKey;
+
+static int PumpRankCompare(const void *a, const void *b)
+{
+    const PumpRankKey *x = a;
+    const PumpRankKey *y = b;
+    
+    if(x->feasible != y->feasible)
+    {
+        return y->feasible - x->feasible;
+    }
+    if(x->power != y->power)
+    {
+        return (x->power < y->power) ? -1 : 1;
+    }
+    if(x->margin != y->margin)
+    {
+        return (x->margin > y->margin) ? -1 : 1;
+    }
+    return x->id - y->id;
+}
+
+int PumpScreen(int n, const PumpCurve *catalogue, const SystemCurve *sys, double Qduty, int trim, PumpOperatingPoint *op, int *rank)
+{
+    PumpScreenContext ctx;
+    PumpRankKey *key = NULL;
+    int nfeasible = 0;
+    
+    ctx.catalogue = catalogue;
+    ctx.sys = sys;
+    ctx.Qduty = Qduty;
+    ctx.trim = trim;
+    ctx.op = op;
+    parallelFor(n, pumpbatch, PumpScreenBlock, &ctx);
+    
+    key = malloc((n + 1)*sizeof(PumpRankKey));
+    for(int i = 0; i < n; ++i)
+    {
+        key[i].id = i;
+        key[i].margin = op[i].NPSHa - op[i].NPSHr;
+        key[i].power = op[i].power;
+        key[i].feasible = (op[i].status == 0 && op[i].Q >= Qduty*(1 - 1e-6) && key[i].margin > 0 && op[i].eta > 0);
+        nfeasible += key[i].feasible;
+    }
+    qsort(key, n, sizeof(PumpRankKey), PumpRankCompare);
+    for(int i = 0; i < n; ++i)
+    {
+        rank[i] = key[i].id;
+    }
+    free(key);
+    
+    return nfeasible;
+}
+
+/// MARK: DISPLAY AND WRITE
+/// This subroutine is used to describe the status of an operating point.
+static const char *PumpStatus(const PumpOperatingPoint *op, double Qduty)
+{
+    if(op->status == 1)
+    {
+        return "Shut-off head below static head";
+    }
+    if(op->status == 2)
+    {
+        return "Runs off end of curve";
+    }
+    if(op->status == 3)
+    {
+        return "Cannot be trimmed to duty";
+    }
+    if(op->Q < Qduty*(1 - 1e-6))
+    {
+        return "Below duty";
+    }
+    if(op->NPSHa <= op->NPSHr)
+    {
+        return "Insufficient NPSH";
+    }
+    return "Meets duty";
+}
+
+void PumpSelectionDisplay(int n, const PumpCurve *catalogue, const PumpOperatingPoint *op, const int *rank, int nfeasible, double Qduty)
+{
+    int shown = (n < displaylimit) ? n : displaylimit;
+    
+    printf("_Pump_Selection_Results_\n");
+    printf("Duty flowrate:\n");
+    printf("Q =\t%.5f\tm3/s\n", Qduty);
+    printf("%i of %i pumps meet the duty.\n\n", nfeasible, n);
+    
+    printf("Rank\tPump\tD (mm)\tQ (m3/s)\tH (m)\teta (%%)\tNPSHr (m)\tNPSHa (m)\tW_h (kW)\tStatus\n");
+    for(int r = 0; r < shown; ++r)
+    {
+        const PumpOperatingPoint *p = &op[rank[r]];
+        
+        printf("%i\t%s\t%.1f\t%.5f\t%.3f\t%.1f\t%.2f\t%.2f\t%.3f\t%s\n", r + 1, catalogue[rank[r]].name, p->D, p->Q, p->H, p->eta*100, p->NPSHr, p->NPSHa, p->power*0.001, PumpStatus(p, Qduty));
+    }
+    if(shown < n)
+    {
+        printf("Only the first %i pumps are shown. Save the results to file for the full ranking.\n", shown);
+    }
+    printf("\n");
+    fflush(stdout);
+}
+
+void PumpSelectionWrite(int n, const PumpCurve *catalogue, const PumpOperatingPoint *op, const int *rank, int nfeasible, double Qduty)
+{
+    //  Function variables
+    ResultWriter w;             // Buffered writer for the results file.
+    
+    //  Set file name as timestamp + Pump Selection Results
+    if(!writerOpen(&w, "Pump Selection Results"))
+    {
+        return;
+    }
+    
+    //  Write to file
+    writerPrintf(&w, "_Pump_Selection_Results_\n");
+    writerPrintf(&w, "Duty flowrate:\n");
+    writerPrintf(&w, "Q =\t%.5f\tm3/s\n", Qduty);
+    writerPrintf(&w, "%i of %i pumps meet the duty.\n\n", nfeasible, n);
+    
+    writerPrintf(&w, "Rank\tPump\tD (mm)\tQ (m3/s)\tH (m)\teta (%%)\tNPSHr (m)\tNPSHa (m)\tW_h (kW)\tStatus\n");
+    for(int r = 0; r < n; ++r)
+    {
+        const PumpOperatingPoint *p = &op[rank[r]];
+        
+        writerPrintf(&w, "%i\t%s\t%.1f\t%.5f\t%.3f\t%.1f\t%.2f\t%.2f\t%.3f\t%s\n", r + 1, catalogue[rank[r]].name, p->D, p->Q, p->H, p->eta*100, p->NPSHr, p->NPSHa, p->power*0.001, PumpStatus(p, Qduty));
+    }
+    
+    //  Close file
+    writerClose(&w);
+}
+
+void PumpSelectionWriteSwitch(int n, const PumpCurve *catalogue, const PumpOperatingPoint *op, const int *rank, int nfeasible, double Qduty)
+{
+    int control = 0;
+    
+    control = 1;
+    while(control == 1)
+    {
+        char input[maxstrlen];
+        
+        printf("Do you want to save results to file? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+            case 'T':
+            case 'Y':
+            case 't':
+            case 'y':
+                PumpSelectionWrite(n, catalogue, op, rank, nfeasible, Qduty);
+                control = 0;
+                break;
+            case '0':
+            case 'F':
+            case 'N':
+            case 'f':
+            case 'n':
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+}
+
+/// MARK: PSEUDO-MAIN FUNCTION
+void PumpSelection(void)
+{
+    int whilmain = 0;
+    printf("Pump Selection (Operating Point and Catalogue Screening)\n");
+    
+    whilmain = 1;
+    while(whilmain == 1)
+    {
+        //  Variable declaration
+        char input[maxstrlen];
+        int control = 0;
+        int n = 0;                      // Number of pumps.
+        int trim = 0;                   // Trim impellers to the duty flowrate (1).
+        int nfeasible = 0;              // Number of pumps meeting the duty.
+        double Qduty = 0.0;             // Duty flowrate (m3/s).
+        SystemCurve sys;                // System curve description.
+        PumpCurve *catalogue = NULL;    // Pump curves.
+        PumpOperatingPoint *op = NULL;  // Operating point of each pump.
+        int *rank = NULL;               // Pumps ordered best first.
+            //  Variables for timing function
+        struct timespec start, end;
+        double elapsed = 0.0;
+        
+        memset(&sys, 0, sizeof(SystemCurve));
+        
+        //  Data Collection
+        SystemCurveVariable(&sys);
+        Qduty = inputDouble(0, 0, "duty flowrate", "m3/s");
+        
+        control = 1;
+        while(control == 1)
+        {
+            printf("Should the pump curves be entered by hand (1) or read from a catalogue file (2)? ");
+            fgets(input, sizeof(input), stdin);
+            switch(input[0])
+            {
+                case '1':
+                    n = (int)inputDouble(0, 0, "number of pumps", "");
+                    catalogue = calloc(n, sizeof(PumpCurve));
+                    for(int i = 0; i < n; ++i)
+                    {
+                        printf("Pump %i.\n", i + 1);
+                        PumpCurveVariable(&catalogue[i]);
+                    }
+                    control = 0;
+                    break;
+                case '2':
+                    printf("Catalogue file: ");
+                    fgets(input, sizeof(input), stdin);
+                    input[strcspn(input, "\r\n")] = '\0';
+                    n = PumpCatalogueRead(input, &catalogue);
+                    printf("%i pumps read.\n", n);
+                    control = (n > 0) ? 0 : 1;
+                    break;
+                default:
+                    printf("Input not recognised\n");
+                    break;
+            }
+        }
+        
+        control = 1;
+        while(control == 1)
+        {
+            printf("Should the impellers be trimmed to the duty flowrate? [Y/N] ");
+            fgets(input, sizeof(input), stdin);
+            switch(input[0])
+            {
+                case '1':
+                case 'T':
+                case 'Y':
+                case 't':
+                case 'y':
+                    trim = 1;
+                    control = 0;
+                    break;
+                case '0':
+                case 'F':
+                case 'N':
+                case 'f':
+                case 'n':
+                    trim = 0;
+                    control = 0;
+                    break;
+                default:
+                    printf("Input not recognised\n");
+                    break;
+            }
+        }
+        op = calloc(n, sizeof(PumpOperatingPoint));
+        rank = calloc(n, sizeof(int));
+        
+        //  Data Manipulation
+        clock_getres(CLOCK_MONOTONIC, &start);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        
+        nfeasible = PumpScreen(n, catalogue, &sys, Qduty, trim, op, rank);
+        
+        clock_getres(CLOCK_MONOTONIC, &end);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        elapsed = timer(start, end);
+
+        printf("Calculations completed in %.6f seconds.\n", elapsed);
+        
+        //  Displaying results
+        PumpSelectionDisplay(n, catalogue, op, rank, nfeasible, Qduty);
+        
+        //  Writing to File
+        PumpSelectionWriteSwitch(n, catalogue, op, rank, nfeasible, Qduty);
+        
+        //  Continue function
+        whilmain = Continue(whilmain);
+        free(sys.spipe.fittings.entry);
+        free(sys.dpipe.fittings.entry);
+        free(catalogue);
+        free(op);
+        free(rank);
+    }
+    fflush(stdout);
+}
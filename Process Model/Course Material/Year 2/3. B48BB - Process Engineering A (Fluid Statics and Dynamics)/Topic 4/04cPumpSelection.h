@@ -0,0 +1,155 @@
+//
+//  04cPumpSelection.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef _4cPumpSelectionStruct_h
+#define _4cPumpSelectionStruct_h
+
+#define PumpCurveOrder 4        // Number of polynomial coefficients describing each pump curve (cubic).
+#define PumpNameLength 32
+
+typedef struct PumpCurve{
+    char name[PumpNameLength];      // Pump model.
+    double N0;                      // Speed that the curves were measured at (rpm).
+    double D0;                      // Impeller diameter that the curves were measured at (mm).
+    double N;                       // Operating speed (rpm).
+    double D;                       // Operating (trimmed) impeller diameter (mm).
+    double Qmax;                    // Largest flowrate on the measured curve (m3/s).
+    double H[PumpCurveOrder];       // Head polynomial, H = H[0] + H[1] Q + H[2] Q^2 + H[3] Q^3 (m).
+    double eta[PumpCurveOrder];     // Efficiency polynomial ([ ]).
+    double NPSHr[PumpCurveOrder];   // Required NPSH polynomial (m).
+} PumpCurve;
+
+typedef struct SystemCurve{
+    double rho;             // Fluid density (kg/m3).
+    double mu;              // Fluid viscosity (Pa.s).
+    double Psat;            // Fluid saturated vapour pressure (Pa).
+    head suction;           // Suction vessel pressure and liquid elevations (hf unused).
+    head discharge;         // Discharge vessel pressure and liquid elevations (hf unused).
+    NetworkLink spipe;      // Suction pipe and fittings.
+    NetworkLink dpipe;      // Discharge pipe and fittings.
+    FittingsCoefficients sK;    // Reduced suction fittings.
+    FittingsCoefficients dK;    // Reduced discharge fittings.
+} SystemCurve;
+
+typedef struct PumpOperatingPoint{
+    int status;     // Operating point found (0), shut-off head below the static head (1), intersection beyond the end of the curve (2) or duty not met by trimming (3).
+    double D;       // Impeller diameter (mm).
+    double Q;       // Volumetric flowrate (m3/s).
+    double H;       // Pump head (m).
+    double eta;     // Pump efficiency ([ ]).
+    double NPSHr;   // Required NPSH (m).
+    double NPSHa;   // Available NPSH (m).
+    double power;   // Pump power requirement (W).
+} PumpOperatingPoint;
+
+#endif /* _4cPumpSelectionStruct_h */
+
+#ifndef _4cPumpSelectionVariable_h
+#define _4cPumpSelectionVariable_h
+
+/// This subroutine is used to collect a single pump curve by hand.
+/// @param curve Struct where the pump curve should be entered.
+void PumpCurveVariable(PumpCurve *curve);
+
+/// This subroutine is used to read a pump catalogue from a text file. Each line holds a pump model followed by N0, D0, Qmax and the four head, efficiency and NPSHr coefficients. This function returns the number of pumps read.
+/// @param filename Path to the catalogue file.
+/// @param catalogue Pointer set to the array of pumps read. Released with free().
+int PumpCatalogueRead(const char *filename, PumpCurve **catalogue);
+
+/// This subroutine is used to collect the fluid properties, vessel conditions and the suction and discharge lines.
+/// @param sys Struct where the system description should be entered.
+void SystemCurveVariable(SystemCurve *sys);
+
+#endif /* _4cPumpSelectionVariable_h */
+
+#ifndef _4cPumpSelectionCalc_h
+#define _4cPumpSelectionCalc_h
+
+/// This subroutine is used to evaluate a pump curve polynomial at the operating speed and impeller diameter using the affinity laws (Q ~ ND, H ~ (ND)^2, efficiency unchanged). The derivative with respect to flowrate is also returned.
+/// @param curve Pump curve.
+/// @param c Polynomial coefficients taken from the curve (H, eta or NPSHr).
+/// @param power Power of the speed ratio applied to the polynomial (2 for head and NPSHr, 0 for efficiency).
+/// @param Q Volumetric flowrate (m3/s).
+/// @param dydQ Derivative of the result with respect to flowrate. Not calculated when NULL.
+double PumpCurveEvaluate(const PumpCurve *curve, const double *c, int power, double Q, double *dydQ);
+
+/// This subroutine is used to calculate the head required by the system at a given flowrate, H = (P_d - P_s)/(rho g) + z_d - z_s + h_f,s + h_f,d. The pipe losses use "PipeNetworkHeadLoss(...)".
+/// @param sys System description.
+/// @param Q Volumetric flowrate (m3/s).
+/// @param dHdQ Derivative of the system head with respect to flowrate (s/m2).
+/// @param hfs Suction side head loss (m). Not calculated when NULL.
+double SystemCurveHead(const SystemCurve *sys, double Q, double *dHdQ, double *hfs);
+
+/// This subroutine is used to find the intersection of a pump curve and system curve by a safeguarded Newton-Raphson method and calculate the operating efficiency, NPSH and power.
+/// @param curve Pump curve.
+/// @param sys System description.
+/// @param op Struct where the operating point should be entered.
+void PumpOperatingPointSolve(const PumpCurve *curve, const SystemCurve *sys, PumpOperatingPoint *op);
+
+/// This subroutine is used to find the impeller diameter that places the operating point at the duty flowrate. This function returns 0 on success or 1 if the duty cannot be met between 70 % and 100 % of the measured impeller diameter.
+/// @param curve Pump curve. The operating diameter is overwritten with the trimmed diameter, or with the measured diameter if the trim fails.
+/// @param sys System description.
+/// @param Qduty Duty flowrate (m3/s).
+int PumpTrim(PumpCurve *curve, const SystemCurve *sys, double Qduty);
+
+/// This subroutine is used to screen a catalogue of pumps against a system in parallel and rank them. Pumps delivering at least the duty flowrate with a positive NPSH margin are ranked first by power and then by NPSH margin. When trimming is requested, a pump that cannot be trimmed to the duty is rated at its measured diameter and not counted as meeting the duty.
+/// @param n Number of pumps in the catalogue.
+/// @param catalogue Array of pump curves.
+/// @param sys System description.
+/// @param Qduty Duty flowrate (m3/s).
+/// @param trim Integer used to control whether impellers are trimmed to the duty flowrate (1) or used as catalogued (0).
+/// @param op Array of n operating points.
+/// @param rank Array of n pump indices, best first.
+/// @return Number of pumps that meet the duty.
+int PumpScreen(int n, const PumpCurve *catalogue, const SystemCurve *sys, double Qduty, int trim, PumpOperatingPoint *op, int *rank);
+
+#endif /* _4cPumpSelectionCalc_h */
+
+#ifndef _4cPumpSelectionDisplay_h
+#define _4cPumpSelectionDisplay_h
+
+/// This subroutine is used to display the ranked pumps.
+/// @param n Number of pumps in the catalogue.
+/// @param catalogue Array of pump curves.
+/// @param op Array of operating points.
+/// @param rank Array of pump indices, best first.
+/// @param nfeasible Number of pumps that meet the duty.
+/// @param Qduty Duty flowrate (m3/s).
+void PumpSelectionDisplay(int n, const PumpCurve *catalogue, const PumpOperatingPoint *op, const int *rank, int nfeasible, double Qduty);
+
+/// This subroutine is used to write the ranked pumps to a .txt file.
+/// @param n Number of pumps in the catalogue.
+/// @param catalogue Array of pump curves.
+/// @param op Array of operating points.
+/// @param rank Array of pump indices, best first.
+/// @param nfeasible Number of pumps that meet the duty.
+/// @param Qduty Duty flowrate (m3/s).
+void PumpSelectionWrite(int n, const PumpCurve *catalogue, const PumpOperatingPoint *op, const int *rank, int nfeasible, double Qduty);
+
+/// This subroutine is used to check if the user would like to write the ranked pumps to a file.
+/// @param n Number of pumps in the catalogue.
+/// @param catalogue Array of pump curves.
+/// @param op Array of operating points.
+/// @param rank Array of pump indices, best first.
+/// @param nfeasible Number of pumps that meet the duty.
+/// @param Qduty Duty flowrate (m3/s).
+void PumpSelectionWriteSwitch(int n, const PumpCurve *catalogue, const PumpOperatingPoint *op, const int *rank, int nfeasible, double Qduty);
+
+#endif /* _4cPumpSelectionDisplay_h */
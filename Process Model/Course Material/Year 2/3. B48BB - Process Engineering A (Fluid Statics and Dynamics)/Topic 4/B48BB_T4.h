@@ -24,5 +24,7 @@
 
 /// This subroutine guides the user through gathering the data and sizing of a centrifugal pump.
 void PumpSizing(void);
+/// This subroutine guides the user through finding the operating point of pumps against a system curve and ranking a pump catalogue.
+void PumpSelection(void);
 
 #endif /* B48BB_T4_h */
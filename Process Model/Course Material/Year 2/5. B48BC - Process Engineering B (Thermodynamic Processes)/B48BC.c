@@ -46,9 +46,9 @@ void B48BCtopic1(){
     control = 1;
     while(control == 1){
         B48BCTopComm();
-        printf("1. General Volume Work (Polytropic Process)\n2. Isothermal Volume Work\n3. Isobaric Volume Work\n4. Isochoric Heat\n5. Adiabatic Volume Work.\n");
+        printf("1. General Volume Work (Polytropic Process)\n2. Isothermal Volume Work\n3. Isobaric Volume Work\n4. Isochoric Heat\n5. Adiabatic Volume Work.\n6. Real Gas Process Paths (Cubic EOS).\n");
         printf("q. Exit topic\n\n");
-        printf("Selection [1 - 5]: ");
+        printf("Selection [1 - 6]: ");
         
         fgets(input, sizeof(input), stdin);
         switch(input[0]){
@@ -67,13 +67,16 @@ void B48BCtopic1(){
             case '5':
                 Adiabatic();
                 break;
+            case '6':
+                RealGasProcess();
+                break;
             case '0':
             case 'Q':
             case 'q':
                 control = 0;
                 break;
             default:
-                printf("Input not recognised. Please enter an integer between 1 and 5.\n");
+                printf("Input not recognised. Please enter an integer between 1 and 6.\n");
                 break;
         }
     }
@@ -86,9 +89,9 @@ void B48BCtopic2(){
     control = 1;
     while(control == 1){
         B48BCTopComm();
-        printf("1. Reciprocating compressor.\n2. Polytropic process shaft work\n3. First law for open systems.\n");
+        printf("1. Reciprocating compressor.\n2. Polytropic process shaft work\n3. First law for open systems.\n4. Steady-flow energy balance network.\n");
         printf("q. Exit topic. \n\n");
-        printf("Selections [1 - 3]: ");
+        printf("Selections [1 - 4]: ");
         fgets(input, sizeof(input), stdin);
         switch(input[0]){
             case '1':
@@ -100,13 +103,16 @@ void B48BCtopic2(){
             case '3':
                 OpenFirstLaw();
                 break;
+            case '4':
+                EnergyNetwork();
+                break;
             case '0':
             case 'Q':
             case 'q':
                 control = 0;
                 break;
             default:
-                printf("Input not recognised. Please enter an integer between 1 and 3.\n");
+                printf("Input not recognised. Please enter an integer between 1 and 4.\n");
                 break;
         }
     }
@@ -119,9 +125,9 @@ void B48BCtopic3(){
     control = 1;
     while(control == 1){
         B48BCTopComm();
-        printf("1. Joule-Thomson Effect.\n2. Multistage Gas Compression.\n3. Multistage Gas Compression Shaft Work Estimation\n");
+        printf("1. Joule-Thomson Effect.\n2. Multistage Gas Compression.\n3. Multistage Gas Compression Shaft Work Estimation\n4. Multistage Compressor Optimisation\n5. Joule-Thomson Inversion Curve and Throttling\n");
         printf("q. Exit topic. \n\n");
-        printf("Selections [1 - 3]: ");
+        printf("Selections [1 - 5]: ");
         fgets(input, sizeof(input), stdin);
         switch(input[0]){
             case '1':
@@ -133,13 +139,19 @@ void B48BCtopic3(){
             case '3':
                 MultistageShaftWork();
                 break;
+            case '4':
+                MultistageOptimiser();
+                break;
+            case '5':
+                JouleThomsonInversion();
+                break;
             case '0':
             case 'Q':
             case 'q':
                 control = 0;
                 break;
             default:
-                printf("Input not recognised. Please enter an integer between 1 and 3.\n");
+                printf("Input not recognised. Please enter an integer between 1 and 5.\n");
                 break;
         }
     }
@@ -152,9 +164,9 @@ void B48BCtopic4(){
     control = 1;
     while(control == 1){
         B48BCTopComm();
-        printf("1. Thermal Efficiency.\n2. Coefficient of Performance.\n3. Carnot Cycle\n4. The Clausius Inequality\n");
+        printf("1. Thermal Efficiency.\n2. Coefficient of Performance.\n3. Carnot Cycle\n4. The Clausius Inequality\n5. Power and Refrigeration Cycles\n6. Streamed Clausius Inequality Check\n7. Heat Pump and Refrigerator Performance Maps\n");
         printf("q. Exit topic. \n\n");
-        printf("Selection [1 - 4]: ");
+        printf("Selection [1 - 7]: ");
         fgets(input, sizeof(input), stdin);
         switch(input[0]){
             case '1':
@@ -169,13 +181,22 @@ void B48BCtopic4(){
             case '4':
                 ClausiusInequality();
                 break;
+            case '5':
+                CycleSimulator();
+                break;
+            case '6':
+                ClausiusStream();
+                break;
+            case '7':
+                CoPMap();
+                break;
             case '0':
             case 'Q':
             case 'q':
                 control = 0;
                 break;
             default:
-                printf("Input not recognised. Please enter an integer between 1 and 4.\n");
+                printf("Input not recognised. Please enter an integer between 1 and 7.\n");
                 break;
         }
     }
@@ -188,9 +209,9 @@ void B48BCtopic5(){
     control = 1;
     while(control == 1){
         B48BCTopComm();
-        printf("1. Steady-State Entropy Balance.\n2. Heat Engine/Pump Entropy Balance.\n3. Entropy Change Estimation.\n");
+        printf("1. Steady-State Entropy Balance.\n2. Heat Engine/Pump Entropy Balance.\n3. Entropy Change Estimation.\n4. Exergy and Entropy Generation Analysis.\n");
         printf("q. Exit topic. \n\n");
-        printf("Selection [1 - 2]: ");
+        printf("Selection [1 - 4]: ");
         fgets(input, sizeof(input), stdin);
         switch(input[0]){
             case '1':
@@ -202,13 +223,16 @@ void B48BCtopic5(){
             case '3':
                 StateEntropyChange();
                 break;
+            case '4':
+                ExergyAnalysis();
+                break;
             case '0':
             case 'Q':
             case 'q':
                 control = 0;
                 break;
             default:
-                printf("Input not recognised. Please enter an integer between 1 and 3.\n");
+                printf("Input not recognised. Please enter an integer between 1 and 4.\n");
                 break;
         }
     }
@@ -29,7 +29,9 @@
 
 //  Custom header files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BC_T1.h"
+#include "01fProcessPath.h"
 #include "01aPolytropic.h"
 
 /// MARK: SUBROUTINE DEFINITIONS
@@ -173,76 +175,39 @@ double PolyFinalTemperature(double T1, double P1, double P2, double alpha)
 }
 
 /// MARK: ARRAY FUNCTION
-T1ThermoProf PolyProfile(int method, double P1, double P2, double V1, double T1, double T2, double n, double R, double alpha)
+T1ThermoProf PolyProfile(int method, double P1, double P2, double V1, double T1, double T2, double n, double R, double alpha, int rows)
 {
-    double incr = 0.0;  // Increment between data points
-    int reso = 0;       // Resolution of generated plot
-    int i = 0;          // Row controller
+    T1ProcessPath path = {0};
+    T1ThermoProf profile = {0};
     
-    T1ThermoProf profile = {0.0};
-    double total = 0.0;
-    
-    reso = 249;
-        
-    if(method == 1){
-        incr = P2 - P1;
-        incr = (incr)/reso;
-    }
-    if(method == 2){
-        incr = T2 - T1;
-        incr = (incr)/reso;
-    }
-    
-    i = 0;
+    path.type = PathPolytropic;
+    path.alpha = alpha;
+    path.n = n;
+    path.Rgas = R;
     if(method == 1){
         // Pressure and volume must be stated
-        double Tnum = 0.0;
-        double Tden = 0.0;
-        
-        profile.P[i] = P1;
-        profile.V[i] = V1;
-        
-        Tnum = (profile.P[i])*(profile.V[i]);
-        Tden = n*R;
-        profile.T[i] = Tnum/Tden;
+        path.by = PathByPressure;
+        path.P1 = P1;
+        path.V1 = V1;
+        path.x1 = P1;
+        path.x2 = P2;
     }
     if(method == 2){
         // Temperature must be known. Not enough information is given to calculate the system pressure or volume
         printf("Assuming Ideal Gas Law applies\n\n");
-        profile.P[i] = 0.0;
-        profile.V[i] = 0.0;
-        profile.T[i] = T1;
+        path.by = PathByTemperature;
+        path.T1 = T1;
+        path.x1 = T1;
+        path.x2 = T2;
     }
-    profile.W_V[i] = 0.0;
+    PathInit(&path);
     
-    for(i = 1; i < (reso + 1); ++i)
-    {
-        if(method == 1){
-            double Tnum = 0.0;
-            double Tden = 0.0;
-            
-            profile.P[i] = profile.P[i-1] + incr;
-            profile.V[i] = PolyFinalVolume(profile.P[i-1], profile.P[i], profile.V[i-1], alpha);
-            
-            Tnum = (profile.P[i])*(profile.V[i]);
-            Tden = n*R;
-            profile.T[i] = Tnum/Tden;
-            
-            profile.W_V[i] = PolyVolume(profile.P[i-1], profile.P[i], profile.V[i-1], alpha);
-            total = total + profile.W_V[i];
-        }
-        if(method == 2){
-            profile.P[i] = 0.0;
-            profile.V[i] = 0.0;
-            profile.T[i] = profile.T[i - 1] + incr;
-            profile.W_V[i] = PolyTemperature(n, R, profile.T[i - 1], profile.T[i], alpha);
-            total = total + profile.W_V[i];
-        }
+    profile = PathProfile(&path, rows);
+    if(profile.rows > 0){
+        printf("Total Volume work done = %.3f kW\n", profile.W_V[profile.rows - 1]*0.001);
+        printf("Profile calculated in %d rows\n\n", profile.rows);
     }
     
-    printf("Total Volume work done = %.3f kW\n", total*0.001);
-    printf("Profile calculated in %d rows\n\n", i);
-    
     fflush(stdout);
     return profile;
 }
@@ -252,8 +217,6 @@ void PolyProcDisp(double P1, double P2, double V1, double V2, double T1, double
 {
     char input[maxstrlen];
     
-    double total = 0.0;
-    
     int control = 0;        // Variable used to force character input.
     
     printf("_Polytropic_Process_Results_\n");
@@ -303,15 +266,14 @@ void PolyProcDisp(double P1, double P2, double V1, double V2, double T1, double
                 printf("\tOutput parameters:\n");
                 // Profile (Two Temperature columns (K and deg C))
                 printf("P (kPa)\tV (m3)\tT (K)\tT(deg C)\t\tW_V (kW)\tW_V (kW)\n");
-                for(int i = 0; i < 250; ++i)
+                for(int i = 0; i < profile.rows; ++i)
                 {
                     printf("%f\t", profile.P[i]*0.001);
                     printf("%f\t", profile.V[i]);
                     printf("%f\t", profile.T[i]);
                     printf("%f\t\t", profile.T[i] - 273.15);
-                    printf("%f\t", profile.W_V[i]*0.001);
-                    total += profile.W_V[i]*0.001;
-                    printf("%f\n", total);
+                    printf("%f\t", (i > 0) ? (profile.W_V[i] - profile.W_V[i - 1])*0.001 : 0.0);
+                    printf("%f\n", profile.W_V[i]*0.001);
                 }
                 control = 0;
             break;
@@ -333,104 +295,83 @@ void PolyProcDisp(double P1, double P2, double V1, double V2, double T1, double
 void PolyProcWrite(double P1, double P2, double V1, double V2, double T1, double T2, double n, double R, double alpha, T1ThermoProf profile)
 {
     //  Function variables
-    char filename[maxstrlen];
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
-    
-    FILE *fp;
-    //  Set file name as timestamp + Polytropic Process Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Polytropic Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
-    }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
+    ResultWriter w;             // Buffered writer for the results file.
+    
+    double *dW_V = malloc(sizeof(double)*(profile.rows + 1));   // Volume work done over each step of the profile (W).
+    
+    WriterColumn cols[6] = {
+        {"P", "kPa", profile.P, 1, WriterFixed, 6, 0.001, 0.0},
+        {"V", "m3", profile.V, 1, WriterFixed, 6, 1.0, 0.0},
+        {"T", "K", profile.T, 1, WriterFixed, 6, 1.0, 0.0},
+        {"T", "deg C", profile.T, 1, WriterFixed, 6, 1.0, -273.15},
+        {"dW_V", "kW", dW_V, 1, WriterFixed, 6, 0.001, 0.0},
+        {"W_V", "kW", profile.W_V, 1, WriterFixed, 6, 0.001, 0.0}
+    };
     
-    printf("Beginning file write...\n");
+    if(dW_V == NULL)
+    {
+        printf("Memory could not be allocated to write the results.\n");
+        return;
+    }
+    for(int i = 0; i < profile.rows; ++i)
+    {
+        dW_V[i] = (i > 0) ? profile.W_V[i] - profile.W_V[i - 1] : 0.0;
+    }
     
-    //  Open file
-    fp = fopen(filename, "w+");
+    //  Set file name as timestamp + Polytropic Results
+    if(!writerOpen(&w, "Polytropic Results"))
+    {
+        free(dW_V);
+        return;
+    }
     
     //  Write to file
-    double total = 0.0;
-    
-    fprintf(fp, "_Polytropic_Process_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Initial system pressure:\n");
-    fprintf(fp, "P1 =\t%.3f\tkPa\n", P1*0.001);
-    fprintf(fp, "Final system pressure:\n");
-    fprintf(fp, "P2 =\t%.3f\tkPa\n\n", P2*0.001);
-    
-    fprintf(fp, "Initial system volume:\n");
-    fprintf(fp, "V1 =\t%.3f\tm3\n", V1);
-    fprintf(fp, "Final system volume:\n");
-    fprintf(fp, "V2 =\t%.3f\tm3\n\n", V2);
-    
-    fprintf(fp, "Initial system temperature:\n");
-    fprintf(fp, "T1 =\t%.3f\tdeg C\n", T1-273.15);
-    fprintf(fp, "Final system temperature:\n");
-    fprintf(fp, "T2 =\t%.3f\tdeg C\n\n", T2-273.15);
-    
-    fprintf(fp, "_System-Specific_parameters:_\n");
-    fprintf(fp, "Molar flowrate of component i:\n");
-    fprintf(fp, "n =\t%.3f\tkmol/s\n\n", n*0.001);
+    writerText(&w, "_Polytropic_Process_Results_\n");
+    writerText(&w, "\tInput parameters:\n");
+    writerText(&w, "Initial system pressure:\n");
+    writerValue(&w, "P1 =", P1*0.001, 3, "kPa");
+    writerText(&w, "Final system pressure:\n");
+    writerValue(&w, "P2 =", P2*0.001, 3, "kPa");
+    writerEnd(&w);
+    
+    writerText(&w, "Initial system volume:\n");
+    writerValue(&w, "V1 =", V1, 3, "m3");
+    writerText(&w, "Final system volume:\n");
+    writerValue(&w, "V2 =", V2, 3, "m3");
+    writerEnd(&w);
+    
+    writerText(&w, "Initial system temperature:\n");
+    writerValue(&w, "T1 =", T1-273.15, 3, "deg C");
+    writerText(&w, "Final system temperature:\n");
+    writerValue(&w, "T2 =", T2-273.15, 3, "deg C");
+    writerEnd(&w);
+    
+    writerText(&w, "_System-Specific_parameters:_\n");
+    writerText(&w, "Molar flowrate of component i:\n");
+    writerValue(&w, "n =", n*0.001, 3, "kmol/s");
+    writerEnd(&w);
     if( (fabs( R - (8.3145) ) < 0.001 && ((R >= 8.3140) || (R < 8.31449 && R < 8.31451))) ){
-        fprintf(fp, "Universal Gas Constant:\n");
-        fprintf(fp, "R =\t%.4f\tJ/(mol. K)\n\n", R);
+        writerText(&w, "Universal Gas Constant:\n");
+        writerValue(&w, "R =", R, 4, "J/(mol. K)");
+        writerEnd(&w);
     }else{
-        fprintf(fp, "Specific Gas Constant:\n");
-        fprintf(fp, "R =\t%.4f\tJ/(mol. K)\n\n", R);
+        writerText(&w, "Specific Gas Constant:\n");
+        writerValue(&w, "R =", R, 4, "J/(mol. K)");
+        writerEnd(&w);
     }
     
-    fprintf(fp, "Polytropic Index:\n");
-    fprintf(fp, "alpha =\t%.3f\t[ ]\n\n", alpha);
+    writerText(&w, "Polytropic Index:\n");
+    writerValue(&w, "alpha =", alpha, 3, "[ ]");
+    writerEnd(&w);
     
-    fprintf(fp, "\tOutput parameters:\n");
+    writerText(&w, "\tOutput parameters:\n");
     
     //  Profile (Two Temperature columns (K and deg C))
-    fprintf(fp, "P (kPa)\tV (m3)\tT (K)\tT(deg C)\t\tW_V (kW)\tW_V (kW)\n");
-    for(int i = 0; i < 250; ++i)
-    {
-        fprintf(fp, "%f\t", profile.P[i]*0.001);
-        fprintf(fp, "%f\t", profile.V[i]);
-        fprintf(fp, "%f\t", profile.T[i]);
-        fprintf(fp, "%f\t\t", profile.T[i] - 273.15);
-        fprintf(fp, "%f\t", profile.W_V[i]*0.001);
-        total += profile.W_V[i]*0.001;
-        fprintf(fp, "%f\n", total);
-    }
+    writerTable(&w, 6, cols, profile.rows);
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
+    free(dW_V);
 }
 
 void PolyProcSwitch(int mode, double P1, double P2, double V1, double V2, double T1, double T2, double n, double R, double alpha, T1ThermoProf profile)
@@ -491,11 +432,7 @@ void Polytropic()
         char input[maxstrlen];          // Variable used for character input.
         int method = 0;                 // Variable used to control subroutine behaviour.
         int whilmethod = 0;             // Variable used to control user input.
-        int elems = 0;                  // Variable used to store the total number of elements used in the profile struct.
-        
-        elems = 5*250;
-        
-        T1ThermoProf *profile = calloc(elems, sizeof(double));   // Struct used to store the polytropic process profile.
+        T1ThermoProf profile = {0};   // Struct used to store the polytropic process profile.
         double V2 = 0.0;                // Final process volume.
         
         double P1 = 0.0;                // Initial system pressure.
@@ -552,33 +489,35 @@ void Polytropic()
             clock_getres(CLOCK_MONOTONIC, &start);
             clock_gettime(CLOCK_MONOTONIC, &start);
             
-            *profile = PolyProfile(method, P1, P2, V1, T1, T2, n, R, alpha);
+            profile = PolyProfile(method, P1, P2, V1, T1, T2, n, R, alpha, T1ProfileRows);
             
-                //  Gathering unknown variables
-            V2 = profile->V[249];
-            if(method == 1){
-                T1 = profile->T[0];
-                T2 = profile->T[249];
-            }
-            if(method == 2){
-                P1 = profile->P[0];
-                P2 = profile->P[249];
-                V1 = profile->V[0];
-                V2 = profile->V[249];
-            }
-            clock_getres(CLOCK_MONOTONIC, &end);
-            clock_gettime(CLOCK_MONOTONIC, &end);
+            if(profile.rows > 0){
+                    //  Gathering unknown variables
+                V2 = profile.V[profile.rows - 1];
+                if(method == 1){
+                    T1 = profile.T[0];
+                    T2 = profile.T[profile.rows - 1];
+                }
+                if(method == 2){
+                    P1 = profile.P[0];
+                    P2 = profile.P[profile.rows - 1];
+                    V1 = profile.V[0];
+                    V2 = profile.V[profile.rows - 1];
+                }
+                clock_getres(CLOCK_MONOTONIC, &end);
+                clock_gettime(CLOCK_MONOTONIC, &end);
 
-            elapsed = timer(start, end);
+                elapsed = timer(start, end);
 
-            printf("Calculations completed in %.6f seconds.\n", elapsed);
-            
-            //  Displaying Results
-            PolyProcSwitch(1, P1, P2, V1, V2, T1, T2, n, R, alpha, *profile);
-            
-            // Writing to File
-            PolyProcSwitch(2, P1, P2, V1, V2, T1, T2, n, R, alpha, *profile);
-            free(profile);
+                printf("Calculations completed in %.6f seconds.\n", elapsed);
+                
+                //  Displaying Results
+                PolyProcSwitch(1, P1, P2, V1, V2, T1, T2, n, R, alpha, profile);
+                
+                // Writing to File
+                PolyProcSwitch(2, P1, P2, V1, V2, T1, T2, n, R, alpha, profile);
+                PathProfileFree(&profile);
+            }
         }
         //  Continue function
         whilmain = Continue(whilmain);
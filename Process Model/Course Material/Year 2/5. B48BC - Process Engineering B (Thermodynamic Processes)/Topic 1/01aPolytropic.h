@@ -102,7 +102,7 @@ double PolyFinalTemperature(double T1, double P1, double P2, double alpha);
 
 #include "B48BC_T1.h"
 
-/// This subroutine is used to determine the process profile given the input parameters.
+/// This subroutine is used to determine the process profile given the input parameters. Each row is evaluated from the closed-form path in "PathState(...)". Release the profile with "PathProfileFree(...)".
 /// @param method Integer variable used to determine what equation should be used. (1) = Pressure-Volume equation. (2) = Temperature equation.
 /// @param P1 Initial system pressure (Pa).
 /// @param P2 Final system pressure (Pa).
@@ -112,7 +112,8 @@ double PolyFinalTemperature(double T1, double P1, double P2, double alpha);
 /// @param n Moles of component in system (mol/s).
 /// @param R Specific gas constant (J/ mol.K).
 /// @param alpha Polytropic index ([ ]).
-T1ThermoProf PolyProfile(int method, double P1, double P2, double V1, double T1, double T2, double n, double R, double alpha);
+/// @param rows Number of rows in the generated profile.
+T1ThermoProf PolyProfile(int method, double P1, double P2, double V1, double T1, double T2, double n, double R, double alpha, int rows);
 /*  Pressure|Volume|Temperature|Work|Work_cum.|
  */ 
 
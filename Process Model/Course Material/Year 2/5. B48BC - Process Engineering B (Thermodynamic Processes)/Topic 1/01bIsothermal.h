@@ -85,14 +85,15 @@ double IsotFinalVolume(double V1, double P1, double P2);
 
 #include "B48BC_T1.h"
 
-/// This subroutine is used to estimate the process profile for an isothermal process. This subroutine requires "IdealPressure(...)" and "IdealVolume(...)" from "IdealGasLaw.h" to function as intended.
+/// This subroutine is used to estimate the process profile for an isothermal process. Each row is evaluated from the closed-form path in "PathState(...)". Release the profile with "PathProfileFree(...)".
 /// @param n Moles of component in system (mol/ s).
 /// @param T System temperature (K).
 /// @param P1 Initial system pressure (Pa).
 /// @param P2 Final system pressure (Pa).
 /// @param V1 Initial system volume (m3).
 /// @param V2 Final system volume (m3).
-T1ThermoProf IsotProfile(int method, double n, double T, double P1, double P2, double V1, double V2);
+/// @param rows Number of rows in the generated profile.
+T1ThermoProf IsotProfile(int method, double n, double T, double P1, double P2, double V1, double V2, int rows);
 /*  Pressure|Volume|Temperature|Work|Work_cum.|
  */
 
@@ -29,6 +29,8 @@
 
 //Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
+#include "01fProcessPath.h"
 #include "01cIsobaric.h"
 #include "IdealGasLaw.h"
 
@@ -67,6 +69,7 @@ double IsobVolume(double P, double V1, double V2)
     
     work = V2 - V1;
     work = P*(work);
+    work = -1*(work);   // Work done on the system, matching the process profile.
     
     return work;
 }
@@ -80,8 +83,6 @@ double IsobTemperature(double n, double T1, double T2)
     work = n*(work);
     work = -1 *(work);
     
-    work = -1*(work);
-    
     return work;
 }
 
@@ -96,62 +97,37 @@ double IsobFinalTemperature(double V1, double V2, double T1)
 }
 
 /// MARK: ARRAY FUNCTION
-T1ThermoProf IsobProfile(int method, double P, double V1, double V2, double T1, double T2, double n)
+T1ThermoProf IsobProfile(int method, double P, double V1, double V2, double T1, double T2, double n, int rows)
 {
-    double incr = 0.0;  // Increment between data points
-    int reso = 0;       // Resolution of generated plot
-    int i = 0;          // Row controller
-    
-    T1ThermoProf profile = {0.0};
-    double total = 0.0;
+    T1ProcessPath path = {0};
+    T1ThermoProf profile = {0};
     
-    reso = 249;
-    
-    if(method == 1){
-        incr = V2 - V1;
-        incr = (incr)/reso;
-    }
-    if(method == 2){
-        incr = T2 - T1;
-        incr = (incr)/reso;
-    }
+    path.type = PathIsobaric;
+    path.n = n;
+    path.Rgas = R;
     
     // Setting initial system conditions
-    i = 0;
     if(method == 1){
-        profile.P[i] = P;
-        profile.V[i] = V1;
-        profile.T[i] = IdealTemperature(n, profile.P[i], profile.V[i]);
+        path.by = PathByVolume;
+        path.P1 = P;
+        path.V1 = V1;
+        path.x1 = V1;
+        path.x2 = V2;
     }
     if(method == 2){
-        profile.P[i] = 0.0;
-        profile.V[i] = 0.0;
-        profile.T[i] = T1;
+        path.by = PathByTemperature;
+        path.T1 = T1;
+        path.x1 = T1;
+        path.x2 = T2;
     }
-    profile.W_V[i] = 0.0;
+    PathInit(&path);
     
-    for(i = 1; i < (reso + 1); ++i)
-    {
-        if(method == 1){
-            profile.P[i] = P;
-            profile.V[i] = profile.V[i - 1] + incr;
-            profile.T[i] = IsobFinalTemperature(profile.V[i - 1], profile.V[i], profile.T[i - 1]);
-            profile.W_V[i] = IsobVolume(profile.P[i], profile.V[i-1], profile.V[i]);
-            total = total + profile.W_V[i];
-        }
-        if(method == 2){
-            profile.P[i] = 0.0;
-            profile.V[i] = 0.0;
-            profile.T[i] = profile.T[i - 1] + incr;
-            profile.W_V[i] = IsobTemperature(n, profile.T[i - 1], profile.T[i]);
-            total = total + profile.W_V[i];
-        }
+    profile = PathProfile(&path, rows);
+    if(profile.rows > 0){
+        printf("Total Volume work done = %.3f kW\n", profile.W_V[profile.rows - 1]*0.001);
+        printf("Profile calculated in %d rows\n\n", profile.rows);
     }
     
-    if(method == 1 || method == 2){
-        printf("Total Volume work done = %.3f kW\n", total*0.001);
-        printf("Profile calculated in %d rows\n\n", i);
-    }
     return profile;
 }
 
@@ -160,8 +136,6 @@ void IsobProcDisplay(double P, double V1, double V2, double T1, double T2, doubl
 {
     char input[maxstrlen];
     
-    double total = 0.0;
-    
     int control = 0;        // Variable used to force character input.
     
     printf("_Isobaric_Process_Results_\n");
@@ -200,15 +174,14 @@ void IsobProcDisplay(double P, double V1, double V2, double T1, double T2, doubl
                 printf("\tOutput parameters:\n");
                 // Profile (Two Temperature columns (K and deg C))
                 printf("P (kPa)\tV (m3)\tT (K)\tT(deg C)\t\tW_V (kW)\tW_V (kW)\n");
-                for(int i = 0; i < 250; ++i)
+                for(int i = 0; i < profile.rows; ++i)
                 {
                     printf("%f\t", profile.P[i]*0.001);
                     printf("%f\t", profile.V[i]);
                     printf("%f\t", profile.T[i]);
                     printf("%f\t\t", profile.T[i] - 273.15);
-                    printf("%f\t", profile.W_V[i]*0.001);
-                    total += profile.W_V[i]*0.001;
-                    printf("%f\n", total);
+                    printf("%f\t", (i > 0) ? (profile.W_V[i] - profile.W_V[i - 1])*0.001 : 0.0);
+                    printf("%f\n", profile.W_V[i]*0.001);
                 }
                 control = 0;
             break;
@@ -230,94 +203,70 @@ void IsobProcDisplay(double P, double V1, double V2, double T1, double T2, doubl
 void IsobProcWrite(double P, double V1, double V2, double T1, double T2, double n, T1ThermoProf profile)
 {
     //  Function variables
-    char filename[maxstrlen];
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
-    
-    FILE *fp;
-    //  Set file name as timestamp + Isobaric Process Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
+    ResultWriter w;             // Buffered writer for the results file.
     
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
+    double *dW_V = malloc(sizeof(double)*(profile.rows + 1));   // Volume work done over each step of the profile (W).
     
-    strcat(filename, " Isobaric Results");
-    //printf("File name: \"%s\"\n", filename);
+    WriterColumn cols[6] = {
+        {"P", "kPa", profile.P, 1, WriterFixed, 6, 0.001, 0.0},
+        {"V", "m3", profile.V, 1, WriterFixed, 6, 1.0, 0.0},
+        {"T", "K", profile.T, 1, WriterFixed, 6, 1.0, 0.0},
+        {"T", "deg C", profile.T, 1, WriterFixed, 6, 1.0, -273.15},
+        {"dW_V", "kW", dW_V, 1, WriterFixed, 6, 0.001, 0.0},
+        {"W_V", "kW", profile.W_V, 1, WriterFixed, 6, 0.001, 0.0}
+    };
     
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(dW_V == NULL)
+    {
+        printf("Memory could not be allocated to write the results.\n");
+        return;
+    }
+    for(int i = 0; i < profile.rows; ++i)
+    {
+        dW_V[i] = (i > 0) ? profile.W_V[i] - profile.W_V[i - 1] : 0.0;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
     
-    //  Open file
-    fp = fopen(filename, "w+");
+    //  Set file name as timestamp + Isobaric Results
+    if(!writerOpen(&w, "Isobaric Results"))
+    {
+        free(dW_V);
+        return;
+    }
     
     //  Write to file
-    double total = 0.0;
+    writerText(&w, "_Isobaric_Process_Results_\n");
+    writerText(&w, "\tInput parameters:\n");
+    writerText(&w, "System pressure:\n");
+    writerValue(&w, "P =", P*0.001, 3, "kPa");
+    writerEnd(&w);
     
-    fprintf(fp, "_Isobaric_Process_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "System pressure:\n");
-    fprintf(fp, "P =\t%.3f\tkPa\n\n", P*0.001);
+    writerText(&w, "Initial system volume:\n");
+    writerValue(&w, "V1 =", V1, 3, "m3");
+    writerText(&w, "Final system volume:\n");
+    writerValue(&w, "V2 =", V2, 3, "m3");
+    writerEnd(&w);
     
-    fprintf(fp, "Initial system volume:\n");
-    fprintf(fp, "V1 =\t%.3f\tm3\n", V1);
-    fprintf(fp, "Final system volume:\n");
-    fprintf(fp, "V2 =\t%.3f\tm3\n\n", V2);
+    writerText(&w, "Initial system temperature:\n");
+    writerValue(&w, "T1 =", T1-273.15, 3, "deg C");
+    writerText(&w, "Final system temperature:\n");
+    writerValue(&w, "T2 =", T2-273.15, 3, "deg C");
+    writerEnd(&w);
     
-    fprintf(fp, "Initial system temperature:\n");
-    fprintf(fp, "T1 =\t%.3f\tdeg C\n", T1-273.15);
-    fprintf(fp, "Final system temperature:\n");
-    fprintf(fp, "T2 =\t%.3f\tdeg C\n\n", T2-273.15);
+    writerText(&w, "_System-Specific_parameters:_\n");
     
-    fprintf(fp, "_System-Specific_parameters:_\n");
+    writerText(&w, "Molar flowrate of component i:\n");
+    writerValue(&w, "n =", n*0.001, 3, "kmol/s");
+    writerValue(&w, "R =", R, 4, "J/(mol. K)");
+    writerEnd(&w);
     
-    fprintf(fp, "Molar flowrate of component i:\n");
-    fprintf(fp, "n =\t%.3f\tkmol/s\n", n*0.001);
-    fprintf(fp, "R =\t%.4f\tJ/(mol. K)\n\n", R);
-    
-    fprintf(fp, "\tOutput parameters:\n");
+    writerText(&w, "\tOutput parameters:\n");
     
     //  Profile (Two Temperature columns (K and deg C))
-    fprintf(fp, "P (kPa)\tV (m3)\tT (K)\tT(deg C)\t\tW_V (kW)\tW_V (kW)\n");
-    for(int i = 0; i < 250; ++i)
-    {
-        fprintf(fp, "%f\t", profile.P[i]*0.001);
-        fprintf(fp, "%f\t", profile.V[i]);
-        fprintf(fp, "%f\t", profile.T[i]);
-        fprintf(fp, "%f\t\t", profile.T[i] - 273.15);
-        fprintf(fp, "%f\t", profile.W_V[i]*0.001);
-        total += profile.W_V[i]*0.001;
-        fprintf(fp, "%f\n", total);
-    }
+    writerTable(&w, 6, cols, profile.rows);
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
+    free(dW_V);
 }
 
 void IsobProcSwitch(int mode, double P, double V1, double V2, double T1, double T2, double n, T1ThermoProf profile)
@@ -379,11 +328,7 @@ void Isobaric()
         char methodinput[maxstrlen];    // Variable used to store character input.
         int method = 0;                 // Variable used to control subroutine behaviour.
         int whilmethod = 0;             // Variable used to control user input.
-        int elems = 0;                  // Variable used to store the total number of elements used in the profile struct.
-        
-        elems = 5*250;
-        
-        T1ThermoProf *profile = calloc(elems, sizeof(double));   // Struct used to store the generated isobaric process profile.
+        T1ThermoProf profile = {0};   // Struct used to store the generated isobaric process profile.
         
         double P = 0.0;                 // System pressure.
         double V1 = 0.0;                // Initial system volume.
@@ -438,34 +383,36 @@ void Isobaric()
             clock_getres(CLOCK_MONOTONIC, &start);
             clock_gettime(CLOCK_MONOTONIC, &start);
             
-            *profile = IsobProfile(method, P, V1, V2, T1, T2, n);
-            
-            if(V1 == 0){
-                V1 = profile->V[0];
-            }
-            if(V2 == 0){
-                V2 = profile->V[249];
-            }
-            if(T1 == 0){
-                T1 = profile->T[0];
-            }
-            if(T2 == 0){
-                T2 = profile->T[249];
-            }
+            profile = IsobProfile(method, P, V1, V2, T1, T2, n, T1ProfileRows);
             
-            clock_getres(CLOCK_MONOTONIC, &end);
-            clock_gettime(CLOCK_MONOTONIC, &end);
+            if(profile.rows > 0){
+                if(V1 == 0){
+                    V1 = profile.V[0];
+                }
+                if(V2 == 0){
+                    V2 = profile.V[profile.rows - 1];
+                }
+                if(T1 == 0){
+                    T1 = profile.T[0];
+                }
+                if(T2 == 0){
+                    T2 = profile.T[profile.rows - 1];
+                }
+                
+                clock_getres(CLOCK_MONOTONIC, &end);
+                clock_gettime(CLOCK_MONOTONIC, &end);
 
-            elapsed = timer(start, end);
+                elapsed = timer(start, end);
 
-            printf("Calculations completed in %.6f seconds.\n", elapsed);
-            
-            //  Displaying results
-            IsobProcSwitch(1, P, V1, V2, T1, T2, n, *profile);
-            
-            //  Writing to File
-            IsobProcSwitch(2, P, V1, V2, T1, T2, n, *profile);
-            free(profile);
+                printf("Calculations completed in %.6f seconds.\n", elapsed);
+                
+                //  Displaying results
+                IsobProcSwitch(1, P, V1, V2, T1, T2, n, profile);
+                
+                //  Writing to File
+                IsobProcSwitch(2, P, V1, V2, T1, T2, n, profile);
+                PathProfileFree(&profile);
+            }
         }
         //Continue function
         whilmain = Continue(whilmain);
@@ -37,7 +37,7 @@ void IsobVariable(int method, double *P, double *V1,double *V2, double *T1, doub
 #ifndef IsobVolume_h
 #define IsobVolume_h
 
-/// This subroutine is used to calculate the volume work done associated with a change in volume for an isobaric process.
+/// This subroutine is used to calculate the volume work done on the system associated with a change in volume for an isobaric process.
 /// @param P  System pressure (Pa).
 /// @param V1 Initial system volume (m3).
 /// @param V2 Final system volume (m3).
@@ -48,7 +48,7 @@ double IsobVolume(double P, double V1, double V2);
 #ifndef IsobTemperature_h
 #define IsobTemperature_h
 
-/// This subroutine is used to calculate the volume work done associated with a change in temperature for an isobaric process.
+/// This subroutine is used to calculate the volume work done on the system associated with a change in temperature for an isobaric process.
 /// @param n Moles of component in system (mol/s).
 /// @param T1 Initial system temperature (K).
 /// @param T2 Final system temperature (K).
@@ -72,7 +72,7 @@ double IsobFinalTemperature(double V1, double V2, double T1);
 
 #include "B48BC_T1.h"
 
-/// This subroutine is used to calculate the process profile associated with an isobaric process. This subroutine requires "IdealTemperature(...)" and "IdealGasLaw.h" to function as intended.
+/// This subroutine is used to calculate the process profile associated with an isobaric process. Each row is evaluated from the closed-form path in "PathState(...)". Release the profile with "PathProfileFree(...)".
 /// @param method Integer variable used to determine what equation should be used. (1) = Pressure-Volume equation. (2) = Temperature equation.
 /// @param P System pressure (Pa).
 /// @param V1 Initial system volume (m3).
@@ -80,7 +80,8 @@ double IsobFinalTemperature(double V1, double V2, double T1);
 /// @param T1 Initial system temperature (K).
 /// @param T2 Final system temperature (K).
 /// @param n Moles of component in system (mol/s).
-T1ThermoProf IsobProfile(int method, double P, double V1, double V2, double T1, double T2, double n);
+/// @param rows Number of rows in the generated profile.
+T1ThermoProf IsobProfile(int method, double P, double V1, double V2, double T1, double T2, double n, int rows);
 /*  Pressure|Volume|Temperature|Work|Work_cum.|
  */
 
@@ -29,6 +29,8 @@
 
 //Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
+#include "01fProcessPath.h"
 #include "01dIsochoric.h"
 #include "IdealGasLaw.h"
 
@@ -101,63 +103,37 @@ double IsocFinalTemperature(double T1, double P1, double P2)
 }
 
 /// MARK: ARRAY FUNCTION
-T1ThermoProf IsocProfile(int method, double P1, double P2, double V, double T1, double T2, double n, double cv)
+T1ThermoProf IsocProfile(int method, double P1, double P2, double V, double T1, double T2, double n, double cv, int rows)
 {
-    double incr = 0.0;  // Increment between data points
-    int reso = 0;       // Resolution of the generated plot
-    int i = 0;          // Row controller
+    T1ProcessPath path = {0};
+    T1ThermoProf profile = {0};
     
-    T1ThermoProf profile = {0.0};
-    double total = 0.0;
-    
-    reso = 249;
-    
-    if(method == 1){
-        incr = P2 - P1;
-        incr = (incr)/reso;
-    }
-    if(method == 2){
-        incr = T2 - T1;
-        incr = (incr)/reso;
-    }
+    path.type = PathIsochoric;
+    path.n = n;
+    path.Rgas = R;
+    path.cv = cv;
     
     // Setting the initial system conditions
-    i = 0;
     if(method == 1){
-        profile.P[i] = P1;
-        profile.V[i] = V;
-        profile.T[i] = IdealTemperature(n, profile.P[i], profile.V[i]);
+        path.by = PathByPressure;
+        path.P1 = P1;
+        path.V1 = V;
+        path.x1 = P1;
+        path.x2 = P2;
     }
     if(method == 2){
-        profile.P[i] = 0.0;
-        profile.V[i] = 0.0;
-        profile.T[i] = T1;
+        path.by = PathByTemperature;
+        path.T1 = T1;
+        path.x1 = T1;
+        path.x2 = T2;
     }
-    profile.W_V[i] = 0.0;
-    profile.Q[i] = 0.0;
-    total = 0.0;
+    PathInit(&path);
     
-    for(i = 1; i < (reso + 1); ++i)
-    {
-        if(method == 1){
-            profile.P[i] = profile.P[i - 1] + incr;
-            profile.V[i] = V;
-            profile.T[i] = IsocFinalTemperature(profile.T[i - 1], profile.P[i - 1], profile.P[i]);
-            profile.W_V[i] = 0.0;
-            profile.Q[i] = IsocPressure(profile.P[i - 1], profile.P[i], profile.V[i], cv);
-            total += profile.Q[i];
-        }
-        if(method == 2){
-            profile.P[i] = 0.0;
-            profile.V[i] = 0.0;
-            profile.T[i] = profile.T[i - 1] + incr;
-            profile.W_V[i] = 0.0;
-            profile.Q[i] = IsocTemperature(profile.T[i - 1], profile.T[i], n, cv);
-            total += profile.Q[i];
-        }
+    profile = PathProfile(&path, rows);
+    if(profile.rows > 0){
+        printf("Total heat required = %.3f kW\n", profile.Q[profile.rows - 1]*0.001);
+        printf("Profile calculated in %d rows\n\n", profile.rows);
     }
-    printf("Total heat required = %.3f kW\n", total*0.001);
-    printf("Profile calculated in %d rows\n\n", i);
     
     return profile;
 }
@@ -167,8 +143,6 @@ void IsocProcDisplay(double P1, double P2, double V, double T1, double T2, doubl
 {
     char input[maxstrlen];
     
-    double total = 0.0;
-    
     int control = 0;        // Variable used to force character input.
     
     printf("_Isochoric_Process_Results_\n");
@@ -207,15 +181,14 @@ void IsocProcDisplay(double P1, double P2, double V, double T1, double T2, doubl
                 printf("\tOutput parameters:\n");
                 // Profile (Two Temperature columns (K and deg C))
                 printf("P (kPa)\tV (m3)\tT (K)\tT(deg C)\t\tQ (kW)\tQ (kW)\n");
-                for(int i = 0; i < 250; ++i)
+                for(int i = 0; i < profile.rows; ++i)
                 {
                     printf("%f\t", profile.P[i]*0.001);
                     printf("%f\t", profile.V[i]);
                     printf("%f\t", profile.T[i]);
                     printf("%f\t\t", profile.T[i] - 273.15);
-                    printf("%f\t", profile.Q[i]*0.001);
-                    total += profile.Q[i]*0.001;
-                    printf("%f\n", total);
+                    printf("%f\t", (i > 0) ? (profile.Q[i] - profile.Q[i - 1])*0.001 : 0.0);
+                    printf("%f\n", profile.Q[i]*0.001);
                 }
                 control = 0;
             break;
@@ -237,95 +210,74 @@ void IsocProcDisplay(double P1, double P2, double V, double T1, double T2, doubl
 void IsocProcWrite(double P1, double P2, double V, double T1, double T2, double n, double c_v, T1ThermoProf profile)
 {
     //  Function variables
-    char filename[maxstrlen];
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
-    
-    FILE *fp;
-    //  Set file name as timestamp + Isochoric Process Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
+    ResultWriter w;             // Buffered writer for the results file.
     
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
+    double *dQ = malloc(sizeof(double)*(profile.rows + 1));   // Heat supplied over each step of the profile (W).
     
-    strcat(filename, " Isochoric Results");
-    //printf("File name: \"%s\"\n", filename);
+    WriterColumn cols[6] = {
+        {"P", "kPa", profile.P, 1, WriterFixed, 6, 0.001, 0.0},
+        {"V", "m3", profile.V, 1, WriterFixed, 6, 1.0, 0.0},
+        {"T", "K", profile.T, 1, WriterFixed, 6, 1.0, 0.0},
+        {"T", "deg C", profile.T, 1, WriterFixed, 6, 1.0, -273.15},
+        {"dQ", "kW", dQ, 1, WriterFixed, 6, 0.001, 0.0},
+        {"Q", "kW", profile.Q, 1, WriterFixed, 6, 0.001, 0.0}
+    };
     
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(dQ == NULL)
+    {
+        printf("Memory could not be allocated to write the results.\n");
+        return;
+    }
+    for(int i = 0; i < profile.rows; ++i)
+    {
+        dQ[i] = (i > 0) ? profile.Q[i] - profile.Q[i - 1] : 0.0;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
     
-    //  Open file
-    fp = fopen(filename, "w+");
+    //  Set file name as timestamp + Isochoric Results
+    if(!writerOpen(&w, "Isochoric Results"))
+    {
+        free(dQ);
+        return;
+    }
     
     //  Write to file
-    double total = 0.0;
-    
-    fprintf(fp, "_Isochoric_Process_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Initial system pressure:\n");
-    fprintf(fp, "P1 =\t%.3f\tkPa\n\n", P1*0.001);
-    fprintf(fp, "Final system pressure:\n");
-    fprintf(fp, "P2 =\t%.3f\tkPa\n\n", P2*0.001);
-    
-    fprintf(fp, "System volume:\n");
-    fprintf(fp, "V =\t%.3f\tm3\n\n", V);
-    
-    fprintf(fp, "Initial system temperature:\n");
-    fprintf(fp, "T1 =\t%.3f\tdeg C\n\n", T1-273.15);
-    fprintf(fp, "Final system temperature:\n");
-    fprintf(fp, "T2 =\t%.3f\tdeg C\n\n", T2-273.15);
-    
-    fprintf(fp, "_System-Specific_parameters:_\n");
-    
-    fprintf(fp, "Molar flowrate of component i:\n");
-    fprintf(fp, "n =\t%.3f\tkmol/s\n\n", n*0.001);
-    fprintf(fp, "c_v =\t%.3f\tJ/(mol. K)\n", c_v);
-    fprintf(fp, "R =\t%.4f\tJ/(mol. K)\n\n", R);
-    
-    fprintf(fp, "\tOutput parameters:\n");
+    writerText(&w, "_Isochoric_Process_Results_\n");
+    writerText(&w, "\tInput parameters:\n");
+    writerText(&w, "Initial system pressure:\n");
+    writerValue(&w, "P1 =", P1*0.001, 3, "kPa");
+    writerEnd(&w);
+    writerText(&w, "Final system pressure:\n");
+    writerValue(&w, "P2 =", P2*0.001, 3, "kPa");
+    writerEnd(&w);
+    
+    writerText(&w, "System volume:\n");
+    writerValue(&w, "V =", V, 3, "m3");
+    writerEnd(&w);
+    
+    writerText(&w, "Initial system temperature:\n");
+    writerValue(&w, "T1 =", T1-273.15, 3, "deg C");
+    writerEnd(&w);
+    writerText(&w, "Final system temperature:\n");
+    writerValue(&w, "T2 =", T2-273.15, 3, "deg C");
+    writerEnd(&w);
+    
+    writerText(&w, "_System-Specific_parameters:_\n");
+    
+    writerText(&w, "Molar flowrate of component i:\n");
+    writerValue(&w, "n =", n*0.001, 3, "kmol/s");
+    writerEnd(&w);
+    writerValue(&w, "c_v =", c_v, 3, "J/(mol. K)");
+    writerValue(&w, "R =", R, 4, "J/(mol. K)");
+    writerEnd(&w);
+    
+    writerText(&w, "\tOutput parameters:\n");
     
     //  Profile (Two Temperature columns (K and deg C))
-    fprintf(fp, "P (kPa)\tV (m3)\tT (K)\tT(deg C)\t\tQ (kW)\tQ (kW)\n");
-    for(int i = 0; i < 250; ++i)
-    {
-        fprintf(fp, "%f\t", profile.P[i]*0.001);
-        fprintf(fp, "%f\t", profile.V[i]);
-        fprintf(fp, "%f\t", profile.T[i]);
-        fprintf(fp, "%f\t\t", profile.T[i] - 273.15);
-        fprintf(fp, "%f\t", profile.Q[i]*0.001);
-        total += profile.Q[i]*0.001;
-        fprintf(fp, "%f\n", total);
-    }
+    writerTable(&w, 6, cols, profile.rows);
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
+    free(dQ);
 }
 
 void IsocProcSwitch(int mode, double P1, double P2, double V, double T1, double T2, double n, double c_v, T1ThermoProf profile)
@@ -386,11 +338,7 @@ void Isochoric()
         char methodinput[maxstrlen];    // Variable used to store character input.
         int method = 0;                 // Variable used to control subroutine behaviour.
         int whilmethod = 0;             // Variable used to control user input.
-        int elems = 0;                  // Variable used to store the total number of elements used in the profile struct.
-        
-        elems = 5*250;
-        
-        T1ThermoProf *profile = calloc(elems, sizeof(double));   // Struct used to store the generated isochoric profile.
+        T1ThermoProf profile = {0};   // Struct used to store the generated isochoric profile.
         
         double P1 = 0.0;                // Initial system pressure.
         double P2 = 0.0;                // Final system pressure.
@@ -446,33 +394,35 @@ void Isochoric()
             clock_getres(CLOCK_MONOTONIC, &start);
             clock_gettime(CLOCK_MONOTONIC, &start);
             
-            *profile = IsocProfile(method, P1, P2, V, T1, T2, n, cv);
-            if(P1 == 0){
-                P1 = profile->P[0];
-            }
-            if(P2 == 0){
-                P2 = profile->P[249];
-            }
-            if(T1 == 0){
-                T1 = profile->T[0];
-            }
-            if(T2 == 0){
-                T2 = profile->T[249];
-            }
-            
-            clock_getres(CLOCK_MONOTONIC, &end);
-            clock_gettime(CLOCK_MONOTONIC, &end);
+            profile = IsocProfile(method, P1, P2, V, T1, T2, n, cv, T1ProfileRows);
+            if(profile.rows > 0){
+                if(P1 == 0){
+                    P1 = profile.P[0];
+                }
+                if(P2 == 0){
+                    P2 = profile.P[profile.rows - 1];
+                }
+                if(T1 == 0){
+                    T1 = profile.T[0];
+                }
+                if(T2 == 0){
+                    T2 = profile.T[profile.rows - 1];
+                }
+                
+                clock_getres(CLOCK_MONOTONIC, &end);
+                clock_gettime(CLOCK_MONOTONIC, &end);
 
-            elapsed = timer(start, end);
+                elapsed = timer(start, end);
 
-            printf("Calculations completed in %.6f seconds.\n", elapsed);
-            
-            //  Displaying results
-            IsocProcSwitch(1, P1, P2, V, T1, T2, n, cv, *profile);
-            
-            //  Writing to File
-            IsocProcSwitch(2, P1, P2, V, T1, T2, n, cv, *profile);
-            free(profile);
+                printf("Calculations completed in %.6f seconds.\n", elapsed);
+                
+                //  Displaying results
+                IsocProcSwitch(1, P1, P2, V, T1, T2, n, cv, profile);
+                
+                //  Writing to File
+                IsocProcSwitch(2, P1, P2, V, T1, T2, n, cv, profile);
+                PathProfileFree(&profile);
+            }
         }
         //Continue function
         whilmain = Continue(whilmain);
@@ -75,7 +75,7 @@ double IsocFinalTemperature(double T1, double P1, double P2);
 
 #include "B48BC_T1.h"
 
-/// This subroutine is used for calculating the process profile for an isochoric process. This subroutine requires "IdealTemperature(...)" from "IdealGasLaw.h" to function as intended.
+/// This subroutine is used for calculating the process profile for an isochoric process. Each row is evaluated from the closed-form path in "PathState(...)". Release the profile with "PathProfileFree(...)".
 /// @param method Integer variable used to determine what equation should be used. (1) = Pressure-Volume equation. (2) = Temperature equation.
 /// @param P1 Initial system pressure (Pa).
 /// @param P2 Final system pressure (Pa).
@@ -84,7 +84,8 @@ double IsocFinalTemperature(double T1, double P1, double P2);
 /// @param T2 Final system temperature (K).
 /// @param n Moles of component in system (mol/ s).
 /// @param cv Heat capacity at constant volume (kJ/kmol.K).
-T1ThermoProf IsocProfile(int method, double P1, double P2, double V, double T1, double T2, double n, double cv);
+/// @param rows Number of rows in the generated profile.
+T1ThermoProf IsocProfile(int method, double P1, double P2, double V, double T1, double T2, double n, double cv, int rows);
 /*  Pressure|Volume|Temperature|Work|Q|Q_cum.|
  */
 
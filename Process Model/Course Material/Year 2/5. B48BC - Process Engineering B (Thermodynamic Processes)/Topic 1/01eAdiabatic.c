@@ -29,6 +29,8 @@
 
 //Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
+#include "01fProcessPath.h"
 #include "01eAdiabatic.h"
 #include "IdealGasLaw.h"
 
@@ -166,75 +168,37 @@ double AdiaFinalVol(double V1, double P1, double P2, double gamma)
 }
 
 /// MARK: ARRAY FUNCTION
-T1ThermoProf AdiaProfile(int method, double P1, double P2, double V1, double V2, double T1, double n, double gamma)
+T1ThermoProf AdiaProfile(int method, double P1, double P2, double V1, double V2, double T1, double n, double gamma, int rows)
 {
-    double incr = 0.0;  // Difference between datapoints.
-    int reso = 249;     // Resolution of dataset.
-    int i = 0;          // Row controller.
-    
-    T1ThermoProf profile = {0.0};
-    // Initialising profile to arrays on zeros
-    for(int j = 0; j < 250; ++j){
-        profile.P[j] = 0.0;
-        profile.V[j] = 0.0;
-        profile.T[j] = 0.0;
-        profile.W_V[j] = 0.0;
-        profile.Q[j] = 0.0;
-    }
-    
-    double total = 0.0;
-    
+    T1ProcessPath path = {0};
+    T1ThermoProf profile = {0};
+    
+    path.type = PathAdiabatic;
+    path.alpha = gamma;
+    path.n = n;
+    path.Rgas = R;
+    path.P1 = P1;
     if(method == 1){
         // Volume work calculated from volume ratio
-        incr = V2 - V1;
-        incr = (incr)/reso;
+        path.by = PathByVolume;
+        path.V1 = V1;
+        path.x1 = V1;
+        path.x2 = V2;
     }
     if(method == 2){
         // Volume work calculated from pressure ratio
-        incr = P2 - P1;
-        incr = (incr)/reso;
+        path.by = PathByPressure;
+        path.T1 = T1;
+        path.x1 = P1;
+        path.x2 = P2;
     }
+    PathInit(&path);
     
-    i = 0;
-    if(method == 1)
-    {
-        profile.P[i] = P1;
-        profile.V[i] = V1;
-        profile.T[i] = IdealTemperature(n, profile.P[i], profile.V[i]);
-        
-        profile.W_V[i] = 0.0;
-        total = 0.0;
-    }
-    if(method == 2)
-    {
-        profile.P[i] = P1;
-        profile.T[i] = T1;
-        profile.V[i] = IdealVolume(n, profile.P[i], profile.T[i]);
-        
-        profile.W_V[i] = 0.0;
-        total = 0.0;
-    }
-    for(i = 1; i< (reso+1) ; ++i)
-    {
-        if(method == 1)
-        {
-            profile.V[i] = profile.V[i - 1] + incr;
-            profile.P[i] = AdiaFinalPress(profile.P[i - 1], profile.V[i - 1], profile.V[i], gamma);
-            profile.T[i] = AdiaFinalTemp(profile.T[i - 1], profile.P[i - 1], profile.P[i], gamma);
-            profile.W_V[i] = AdiaVolume(profile.P[i - 1], profile.V[i - 1], profile.V[i], gamma);
-            total += profile.W_V[i];
-        }
-        if(method == 2)
-        {
-            profile.P[i] = profile.P[i - 1]+incr;
-            profile.T[i] = AdiaFinalTemp(profile.T[i - 1], profile.P[i - 1], profile.P[i], gamma);
-            profile.V[i] = AdiaFinalVol(profile.V[i - 1], profile.P[i - 1], profile.P[i], gamma);
-            profile.W_V[i] = AdiaTemperature(n, profile.T[i - 1], profile.P[i - 1], profile.P[i], gamma);
-            total += profile.W_V[i];
-        }
+    profile = PathProfile(&path, rows);
+    if(profile.rows > 0){
+        printf("Total Volume work done = %.3f kW\n", profile.W_V[profile.rows - 1]*0.001);
+        printf("Profile calculated in %d rows\n\n", profile.rows);
     }
-    printf("Total Volume work done = %.3f kW\n", total*0.001);
-    printf("Profile calculated in %d rows\n\n", i);
     
     return profile;
 }
@@ -244,8 +208,6 @@ void AdiaProcDisplay(double P1, double P2, double V1, double V2, double T1, doub
 {
     char input[maxstrlen];
     
-    double total = 0.0;
-    
     int control = 0;        // Variable used to force character input.
     
     printf("_Adiabatic_Process_Results_\n");
@@ -289,15 +251,14 @@ void AdiaProcDisplay(double P1, double P2, double V1, double V2, double T1, doub
                 printf("\tOutput parameters:\n");
                 // Profile (Two Temperature columns (K and deg C))
                 printf("P (kPa)\tV (m3)\tT (K)\tT(deg C)\t\tW_V (kW)\tW_V (kW)\n");
-                for(int i = 0; i < 250; ++i)
+                for(int i = 0; i < profile.rows; ++i)
                 {
                     printf("%f\t", profile.P[i]*0.001);
                     printf("%f\t", profile.V[i]);
                     printf("%f\t", profile.T[i]);
                     printf("%f\t\t", profile.T[i] - 273.15);
-                    printf("%f\t", profile.W_V[i]*0.001);
-                    total += profile.W_V[i]*0.001;
-                    printf("%f\n", total);
+                    printf("%f\t", (i > 0) ? (profile.W_V[i] - profile.W_V[i - 1])*0.001 : 0.0);
+                    printf("%f\n", profile.W_V[i]*0.001);
                 }
                 control = 0;
             break;
@@ -319,98 +280,76 @@ void AdiaProcDisplay(double P1, double P2, double V1, double V2, double T1, doub
 void AdiaProcWrite(double P1, double P2, double V1, double V2, double T1, double T2, double n, double gamma, T1ThermoProf profile)
 {
     //  Function variables
-    char filename[maxstrlen];
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
-    
-    FILE *fp;
-    //  Set file name as timestamp + Adiabatic Process Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Adiabatic Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
-    }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
-    
-    //  Write to file
-    double total = 0.0;
-    
-    fprintf(fp, "_Adiabatic_Process_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Initial system pressure:\n");
-    fprintf(fp, "P1 =\t%.3f\tkPa\n", P1*0.001);
-    fprintf(fp, "Final system pressure:\n");
-    fprintf(fp, "P2 =\t%.3f\tkPa\n\n", P2*0.001);
-    
-    fprintf(fp, "Initial system volume:\n");
-    fprintf(fp, "V1 =\t%.3f\tm3\n", V1);
-    fprintf(fp, "Final system volume:\n");
-    fprintf(fp, "V2 =\t%.3f\tm3\n\n", V2);
+    ResultWriter w;             // Buffered writer for the results file.
     
-    fprintf(fp, "Initial system temperature:\n");
-    fprintf(fp, "T1 =\t%.3f\tdeg C\n", T1-273.15);
-    fprintf(fp, "Final system temperature:\n");
-    fprintf(fp, "T2 =\t%.3f\tdeg C\n\n", T2-273.15);
+    double *dW_V = malloc(sizeof(double)*(profile.rows + 1));   // Volume work done over each step of the profile (W).
     
-    fprintf(fp, "_System-Specific_parameters:_\n");
+    WriterColumn cols[6] = {
+        {"P", "kPa", profile.P, 1, WriterFixed, 6, 0.001, 0.0},
+        {"V", "m3", profile.V, 1, WriterFixed, 6, 1.0, 0.0},
+        {"T", "K", profile.T, 1, WriterFixed, 6, 1.0, 0.0},
+        {"T", "deg C", profile.T, 1, WriterFixed, 6, 1.0, -273.15},
+        {"dW_V", "kW", dW_V, 1, WriterFixed, 6, 0.001, 0.0},
+        {"W_V", "kW", profile.W_V, 1, WriterFixed, 6, 0.001, 0.0}
+    };
     
-    fprintf(fp, "Molar flowrate of component i:\n");
-    fprintf(fp, "n =\t%.3f\tkmol/s\n", n*0.001);
-    fprintf(fp, "R =\t%.4f\tJ/(mol. K)\n\n", R);
+    if(dW_V == NULL)
+    {
+        printf("Memory could not be allocated to write the results.\n");
+        return;
+    }
+    for(int i = 0; i < profile.rows; ++i)
+    {
+        dW_V[i] = (i > 0) ? profile.W_V[i] - profile.W_V[i - 1] : 0.0;
+    }
     
-    fprintf(fp, "Adiabatic Index:\n");
-    fprintf(fp, "gamma =\t%.3f\t[ ]\n\n", gamma);
+    //  Set file name as timestamp + Adiabatic Results
+    if(!writerOpen(&w, "Adiabatic Results"))
+    {
+        free(dW_V);
+        return;
+    }
     
-    fprintf(fp, "\tOutput parameters:\n");
+    //  Write to file
+    writerText(&w, "_Adiabatic_Process_Results_\n");
+    writerText(&w, "\tInput parameters:\n");
+    writerText(&w, "Initial system pressure:\n");
+    writerValue(&w, "P1 =", P1*0.001, 3, "kPa");
+    writerText(&w, "Final system pressure:\n");
+    writerValue(&w, "P2 =", P2*0.001, 3, "kPa");
+    writerEnd(&w);
+    
+    writerText(&w, "Initial system volume:\n");
+    writerValue(&w, "V1 =", V1, 3, "m3");
+    writerText(&w, "Final system volume:\n");
+    writerValue(&w, "V2 =", V2, 3, "m3");
+    writerEnd(&w);
+    
+    writerText(&w, "Initial system temperature:\n");
+    writerValue(&w, "T1 =", T1-273.15, 3, "deg C");
+    writerText(&w, "Final system temperature:\n");
+    writerValue(&w, "T2 =", T2-273.15, 3, "deg C");
+    writerEnd(&w);
+    
+    writerText(&w, "_System-Specific_parameters:_\n");
+    
+    writerText(&w, "Molar flowrate of component i:\n");
+    writerValue(&w, "n =", n*0.001, 3, "kmol/s");
+    writerValue(&w, "R =", R, 4, "J/(mol. K)");
+    writerEnd(&w);
+    
+    writerText(&w, "Adiabatic Index:\n");
+    writerValue(&w, "gamma =", gamma, 3, "[ ]");
+    writerEnd(&w);
+    
+    writerText(&w, "\tOutput parameters:\n");
     
     //  Profile (Two Temperature columns (K and deg C))
-    fprintf(fp, "P (kPa)\tV (m3)\tT (K)\tT(deg C)\t\tW_V (kW)\tW_V (kW)\n");
-    for(int i = 0; i < 250; ++i){
-        fprintf(fp, "%f\t", profile.P[i]*0.001);
-        fprintf(fp, "%f\t", profile.V[i]);
-        fprintf(fp, "%f\t", profile.T[i]);
-        fprintf(fp, "%f\t\t", profile.T[i] - 273.15);
-        fprintf(fp, "%f\t", profile.W_V[i]*0.001);
-        total += profile.W_V[i]*0.001;
-        fprintf(fp, "%f\n", total);
-    }
+    writerTable(&w, 6, cols, profile.rows);
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
+    free(dW_V);
 }
 
 void AdiaProcSwitch(int mode, double P1, double P2, double V1, double V2, double T1, double T2, double n, double gamma, T1ThermoProf profile)
@@ -472,11 +411,7 @@ void Adiabatic()
         char input[maxstrlen];          // Variable used to store character input.
         int method = 0;                 // Variable used to control subroutine behaviour.
         int whilmethod = 0;             // Variable used to control user input.
-        int elems = 0;                  // Variable used to store the total number of elements used in the profile struct.
-        
-        elems = 5*250;
-        
-        T1ThermoProf *profile = calloc(elems, sizeof(double));   // Struct used to store the generated adiabatic process profile.
+        T1ThermoProf profile = {0};   // Struct used to store the generated adiabatic process profile.
         double T2 = 0.0;                // Final system temperature.
         
         double P1 = 0.0;                // Initial system pressure.
@@ -533,40 +468,42 @@ void Adiabatic()
             clock_getres(CLOCK_MONOTONIC, &start);
             clock_gettime(CLOCK_MONOTONIC, &start);
             
-            *profile = AdiaProfile(method, P1, P2, V1, V2, T1, n, gamma);
-            
-            if(P1 == 0){
-                P1 = profile->P[0];
-            }
-            if(P2 == 0){
-                P2 = profile->P[249];
-            }
-            if(V1 == 0){
-                V1 = profile->V[0];
-            }
-            if(V2 == 0){
-                V2 = profile->V[249];
-            }
-            if(T1 == 0){
-                T1 = profile->T[0];
-            }
-            if(T2 == 0){
-                T2 = profile->T[249];
-            }
+            profile = AdiaProfile(method, P1, P2, V1, V2, T1, n, gamma, T1ProfileRows);
             
-            clock_getres(CLOCK_MONOTONIC, &end);
-            clock_gettime(CLOCK_MONOTONIC, &end);
+            if(profile.rows > 0){
+                if(P1 == 0){
+                    P1 = profile.P[0];
+                }
+                if(P2 == 0){
+                    P2 = profile.P[profile.rows - 1];
+                }
+                if(V1 == 0){
+                    V1 = profile.V[0];
+                }
+                if(V2 == 0){
+                    V2 = profile.V[profile.rows - 1];
+                }
+                if(T1 == 0){
+                    T1 = profile.T[0];
+                }
+                if(T2 == 0){
+                    T2 = profile.T[profile.rows - 1];
+                }
+                
+                clock_getres(CLOCK_MONOTONIC, &end);
+                clock_gettime(CLOCK_MONOTONIC, &end);
 
-            elapsed = timer(start, end);
+                elapsed = timer(start, end);
 
-            printf("Calculations completed in %.6f seconds.\n", elapsed);
-            
-            //  Displaying results
-            AdiaProcSwitch(1, P1, P2, V1, V2, T1, T2, n, gamma, *profile);
-            
-            //  Writing to File
-            AdiaProcSwitch(2, P1, P2, V1, V2, T1, T2, n, gamma, *profile);
-            free(profile);
+                printf("Calculations completed in %.6f seconds.\n", elapsed);
+                
+                //  Displaying results
+                AdiaProcSwitch(1, P1, P2, V1, V2, T1, T2, n, gamma, profile);
+                
+                //  Writing to File
+                AdiaProcSwitch(2, P1, P2, V1, V2, T1, T2, n, gamma, profile);
+                PathProfileFree(&profile);
+            }
         }
         //Continue function
         whilmain = Continue(whilmain);
@@ -101,7 +101,7 @@ double AdiaFinalVol(double V1, double P1, double P2, double gamma);
 
 #include "B48BC_T1.h"
 
-/// This subroutine is used to determine the process profile given the input parameters. This subroutine requires "IdealTemperature(...)" and "IdealVolume(...)" from "IdealGasLaw.h" to function as intended.
+/// This subroutine is used to determine the process profile given the input parameters. Each row is evaluated from the closed-form path in "PathState(...)". Release the profile with "PathProfileFree(...)".
 /// @param method Integer variable used to determine what equation should be used. (1) = Pressure-Volume equation. (2) = Pressure-Temperature equation.
 /// @param P1 Initial system pressure (Pa).
 /// @param P2 Final system pressure (Pa).
@@ -110,7 +110,8 @@ double AdiaFinalVol(double V1, double P1, double P2, double gamma);
 /// @param T1 Initial system temperature (K).
 /// @param n Moles of component in system (mol/s).
 /// @param gamma Heat capacity ratio ([ ]).
-T1ThermoProf AdiaProfile(int method, double P1, double P2, double V1, double V2, double T1, double n, double gamma);
+/// @param rows Number of rows in the generated profile.
+T1ThermoProf AdiaProfile(int method, double P1, double P2, double V1, double V2, double T1, double n, double gamma, int rows);
 /* 
  Pressure|Volume|Temperature|Work|Work_Cum.
  */
@@ -0,0 +1,224 @@
+//
+//  01fProcessPath.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+/// MARK: HEADER DECLARATIONS
+//  Standard header files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+//  Custom header files
+#include "Parallel.h"
+#include "B48BC_T1.h"
+#include "01fProcessPath.h"
+
+/// MARK: SUBROUTINE DEFINITIONS
+#define pathgrain 4096  // Minimum number of rows evaluated by a single thread.
+
+/// This struct is used to share a process path and its profile between the profile kernels.
+typedef struct PathProfileContext{
+    const T1ProcessPath *path;
+    T1ThermoProf *profile;
+} PathProfileContext;
+
+/// MARK: GENERAL CALCULATIONS
+void PathInit(T1ProcessPath *path)
+{
+    double nR = path->n*path->Rgas;
+    
+    if(path->type == PathPolytropic && fabs(path->alpha - 1.0) < 1e-9){
+        path->type = PathIsothermal;
+    }
+    if(path->type == PathPolytropic && fabs(path->alpha) < 1e-9){
+        path->type = PathIsobaric;
+    }
+    if(path->type == PathIsothermal){
+        path->alpha = 1.0;
+    }
+    if(path->type == PathIsobaric){
+        path->alpha = 0.0;
+    }
+    if(path->type == PathAdiabatic){
+        path->cv = path->Rgas/(path->alpha - 1.0);
+    }
+    
+    // Completing the initial state
+    if(path->P1 > 0.0 && path->V1 > 0.0){
+        path->T1 = (path->P1*path->V1)/nR;
+    }else if(path->P1 > 0.0 && path->T1 > 0.0){
+        path->V1 = (nR*path->T1)/path->P1;
+    }else if(path->V1 > 0.0 && path->T1 > 0.0){
+        path->P1 = (nR*path->T1)/path->V1;
+    }else{
+        path->P1 = 0.0;
+        path->V1 = 0.0;
+    }
+}
+
+void PathState(const T1ProcessPath *path, double x, double *P, double *V, double *T, double *W, double *Q)
+{
+    double alpha = path->alpha;
+    double ratio = 0.0;
+    
+    *P = 0.0;
+    *V = 0.0;
+    *T = path->T1;
+    
+    // Locating the state on the PV^alpha = const curve
+    if(path->by == PathByPressure){
+        *P = x;
+        ratio = path->P1/x;
+        if(path->type == PathIsochoric){
+            *V = path->V1;
+        }else if(path->type == PathIsothermal){
+            *V = path->V1*ratio;
+        }else{
+            *V = path->V1*pow(ratio, 1.0/alpha);
+        }
+    }
+    if(path->by == PathByVolume){
+        *V = x;
+        ratio = path->V1/x;
+        if(path->type == PathIsobaric){
+            *P = path->P1;
+        }else if(path->type == PathIsothermal){
+            *P = path->P1*ratio;
+        }else{
+            *P = path->P1*pow(ratio, alpha);
+        }
+    }
+    if(path->by == PathByPressure || path->by == PathByVolume){
+        if(path->type != PathIsothermal){
+            *T = path->T1*((*P)*(*V))/(path->P1*path->V1);
+        }
+    }
+    if(path->by == PathByTemperature){
+        *T = x;
+        ratio = x/path->T1;
+        if(path->P1 > 0.0){
+            // The pressure and volume can only be tracked when the initial state is fully known
+            if(path->type == PathIsochoric){
+                *P = path->P1*ratio;
+                *V = path->V1;
+            }else if(path->type == PathIsobaric){
+                *P = path->P1;
+                *V = path->V1*ratio;
+            }else{
+                *P = path->P1*pow(ratio, alpha/(alpha - 1.0));
+                *V = path->V1*ratio*(path->P1/(*P));
+            }
+        }
+    }
+    
+    // Cumulative volume work done on the system from the initial state
+    if(path->type == PathIsochoric){
+        *W = 0.0;
+    }else if(path->type == PathIsothermal){
+        *W = path->P1*path->V1*log(path->V1/(*V));
+    }else{
+        *W = path->n*path->Rgas*((*T) - path->T1)/(alpha - 1.0);
+    }
+    
+    // Cumulative heat supplied to the system from the first law
+    if(path->type == PathIsothermal){
+        *Q = -(*W);
+    }else if(path->type == PathAdiabatic){
+        *Q = 0.0;
+    }else if(path->cv > 0.0){
+        *Q = path->n*path->cv*((*T) - path->T1) - (*W);
+    }else{
+        *Q = 0.0;
+    }
+}
+
+T1ThermoProf PathProfileAlloc(int rows)
+{
+    T1ThermoProf profile = {0};
+    
+    profile.rows = rows;
+    profile.P = calloc(rows, sizeof(double));
+    profile.V = calloc(rows, sizeof(double));
+    profile.T = calloc(rows, sizeof(double));
+    profile.W_V = calloc(rows, sizeof(double));
+    profile.Q = calloc(rows, sizeof(double));
+    
+    return profile;
+}
+
+void PathProfileFree(T1ThermoProf *profile)
+{
+    free(profile->P);
+    free(profile->V);
+    free(profile->T);
+    free(profile->W_V);
+    free(profile->Q);
+    
+    profile->P = NULL;
+    profile->V = NULL;
+    profile->T = NULL;
+    profile->W_V = NULL;
+    profile->Q = NULL;
+    profile->rows = 0;
+}
+
+/// This subroutine is used to evaluate a block of rows of a process profile. Used as the kernel of "parallelFor(...)".
+/// @param start First row in the block.
+/// @param end One past the last row in the block.
+/// @param context Pointer to a "PathProfileContext" struct.
+static void PathProfileKernel(int start, int end, void *context)
+{
+    PathProfileContext *ctx = context;
+    const T1ProcessPath *path = ctx->path;
+    T1ThermoProf *profile = ctx->profile;
+    
+    double span = path->x2 - path->x1;
+    int last = profile->rows - 1;
+    
+    for(int i = start; i < end; ++i)
+    {
+        double x = 0.0;
+        
+        // Each point is placed directly so that the final row lands exactly on "x2"
+        x = (i == last) ? path->x2 : path->x1 + span*((double)i/last);
+        PathState(path, x, &profile->P[i], &profile->V[i], &profile->T[i], &profile->W_V[i], &profile->Q[i]);
+    }
+}
+
+T1ThermoProf PathProfile(const T1ProcessPath *path, int rows)
+{
+    T1ThermoProf profile = {0};
+    PathProfileContext ctx = {0};
+    
+    if(rows < 2){
+        rows = 2;
+    }
+    profile = PathProfileAlloc(rows);
+    if(profile.P == NULL || profile.V == NULL || profile.T == NULL || profile.W_V == NULL || profile.Q == NULL){
+        printf("Memory could not be allocated for the process profile.\n");
+        PathProfileFree(&profile);
+        return profile;
+    }
+    
+    ctx.path = path;
+    ctx.profile = &profile;
+    parallelFor(rows, pathgrain, PathProfileKernel, &ctx);
+    
+    return profile;
+}
@@ -0,0 +1,78 @@
+//
+//  01fProcessPath.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef ProcessPath_h
+#define ProcessPath_h
+
+#include "B48BC_T1.h"
+
+#define PathPolytropic 1
+#define PathIsothermal 2
+#define PathIsobaric 3
+#define PathIsochoric 4
+#define PathAdiabatic 5
+
+#define PathByPressure 1
+#define PathByVolume 2
+#define PathByTemperature 3
+
+/// This struct is used to describe a closed-system ideal gas process following PV^alpha = const from a known initial state.
+typedef struct T1ProcessPath{
+    int type;       // Process type (PathPolytropic ... PathAdiabatic).
+    int by;         // Independent variable spaced evenly along the profile (PathByPressure, PathByVolume or PathByTemperature).
+    double alpha;   // Polytropic index ([ ]). Ignored for isothermal, isobaric and isochoric processes.
+    double n;       // Moles of component in system (mol/s).
+    double Rgas;    // Gas constant (J/ mol.K).
+    double cv;      // Heat capacity at constant volume (J/ mol.K). Zero when unknown.
+    double P1;      // Initial system pressure (Pa). Zero when only the temperature is known.
+    double V1;      // Initial system volume (m3). Zero when only the temperature is known.
+    double T1;      // Initial system temperature (K).
+    double x1;      // Initial value of the independent variable.
+    double x2;      // Final value of the independent variable.
+} T1ProcessPath;
+
+/// This subroutine is used to complete the initial state of a process path from the ideal gas law. If two of "P1", "V1" and "T1" are known the third is calculated, otherwise the pressure and volume are left at zero. Polytropic paths with an index of one or zero are reclassified as isothermal or isobaric and adiabatic paths take their heat capacity from the heat capacity ratio.
+/// @param path Process path to be completed.
+void PathInit(T1ProcessPath *path);
+
+/// This subroutine is used to evaluate the state of the system and the cumulative energy requirements at any point along a process path from the closed-form PV^alpha relation. No point depends on any other.
+/// @param path Process path from "PathInit(...)".
+/// @param x Value of the independent variable.
+/// @param P System pressure (Pa).
+/// @param V System volume (m3).
+/// @param T System temperature (K).
+/// @param W Volume work done on the system since the initial state (W).
+/// @param Q Heat supplied to the system since the initial state (W).
+void PathState(const T1ProcessPath *path, double x, double *P, double *V, double *T, double *W, double *Q);
+
+/// This subroutine is used to allocate a zeroed process profile with the given number of rows.
+/// @param rows Number of rows in the profile.
+T1ThermoProf PathProfileAlloc(int rows);
+
+/// This subroutine is used to release the arrays held by a process profile.
+/// @param profile Process profile from "PathProfileAlloc(...)".
+void PathProfileFree(T1ThermoProf *profile);
+
+/// This subroutine is used to generate a process profile at any resolution. The independent variable is spaced evenly between "x1" and "x2" and each row is evaluated independently with "PathState(...)", so large profiles are split across the worker threads.
+/// @param path Process path from "PathInit(...)".
+/// @param rows Number of rows in the profile (minimum 2).
+T1ThermoProf PathProfile(const T1ProcessPath *path, int rows);
+
+#endif /* ProcessPath_h */
@@ -0,0 +1,756 @@
+//
+//  01gRealGasPath.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+/// MARK: HEADER DECLARATIONS
+//  Standard header files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//  Custom header files
+#include "System.h"
+#include "ResultWriter.h"
+#include "Parallel.h"
+#include "03aMixingRules.h"
+#include "B48BC_T1.h"
+#include "01fProcessPath.h"
+#include "01gRealGasPath.h"
+
+/// MARK: SUBROUTINE DEFINITIONS
+#define maxstrlen 128
+#define R 8.3145            // J/(mol.K)
+#define Tref 298.15         // Reference temperature for enthalpy and entropy (K).
+#define Pref 100000.0       // Reference pressure for entropy (Pa).
+#define realtol 1e-10       // Relative temperature change accepted by the single phase flashes.
+#define realmaxiter 100     // Iteration limit of the single phase flashes.
+#define realgrain 32        // Minimum number of rows evaluated by a single thread.
+
+//  Specifications of the single phase flashes
+#define RealSpecH 0
+#define RealSpecS 1
+#define RealSpecV 2
+
+/// This struct is used to share a real gas process and its profile between the profile kernels.
+typedef struct RealGasProfileContext{
+    const T1RealGas *gas;
+    const T1RealGasCase *rc;
+    const T1RealPoint *in;
+    T1ThermoProf *profile;
+} RealGasProfileContext;
+
+/// MARK: VARIABLE INPUT
+void RealGasVariable(T1RealGas *gas)
+{
+    char input[maxstrlen];
+    char prompt[maxstrlen];
+    int control = 0;
+    double sum = 0.0;
+    
+    memset(gas, 0, sizeof(T1RealGas));
+    
+    control = 1;
+    while(control == 1)
+    {
+        printf("Equation of state: Soave-Redlich-Kwong (1) or Peng-Robinson (2)? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+                gas->model = RealGasSRK;
+                control = 0;
+                break;
+            case '2':
+                gas->model = RealGasPR;
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+    
+    gas->ncomp = (int)inputDouble(0, 0, "number of components", "");
+    gas->ncomp = (gas->ncomp > MixMaxComp) ? MixMaxComp : gas->ncomp;
+    MixRuleInit(&gas->mix, gas->ncomp, (gas->model == RealGasSRK) ? MixSRK : MixPR, MixVdW);
+    for(int i = 0; i < gas->ncomp; ++i)
+    {
+        printf("Component %i name: ", i + 1);
+        fgets(input, sizeof(input), stdin);
+        input[strcspn(input, "\r\n")] = '\0';
+        snprintf(gas->mix.name[i], MixNameLength, "%.*s", MixNameLength - 1, input);
+        
+        gas->mix.Tc[i] = inputDouble(0, 0, "critical temperature", "K");
+        gas->mix.Pc[i] = inputDouble(0, 0, "critical pressure", "bar");
+        gas->mix.Pc[i] = (gas->mix.Pc[i])*100000; // Conversion (bar to Pa)
+        gas->mix.omega[i] = inputDouble(1, 1, "acentric factor", "[ ]");
+        gas->cp[i][0] = inputDouble(1, 1, "ideal gas heat capacity constant A", "J/mol.K");
+        gas->cp[i][1] = inputDouble(1, 1, "ideal gas heat capacity constant B", "J/mol.K2");
+        gas->cp[i][2] = inputDouble(1, 1, "ideal gas heat capacity constant C", "J/mol.K3");
+        gas->cp[i][3] = inputDouble(1, 1, "ideal gas heat capacity constant D", "J/mol.K4");
+    }
+    
+    if(gas->ncomp == 1)
+    {
+        gas->x[0] = 1.0;
+        return;
+    }
+    
+    for(int i = 0; i < gas->ncomp; ++i)
+    {
+        snprintf(prompt, sizeof(prompt), "mole fraction of %s", gas->mix.name[i]);
+        gas->x[i] = inputDouble(1, 0, prompt, "[ ]");
+        sum += gas->x[i];
+    }
+    if(sum <= 0.0)
+    {
+        printf("The mole fractions sum to zero. An equimolar gas is used instead.\n");
+        for(int i = 0; i < gas->ncomp; ++i)
+        {
+            gas->x[i] = 1.0;
+        }
+        sum = gas->ncomp;
+    }
+    for(int i = 0; i < gas->ncomp; ++i)
+    {
+        gas->x[i] = gas->x[i]/sum;
+    }
+    MixRuleVariable(&gas->mix);
+}
+
+/// This subroutine is used to collect the process for "RealGasProcess(...)". The path or machine type, inlet state, flowrate and end point are stored.
+/// @param rc Struct where the process description should be stored.
+static void RealGasCaseVariable(T1RealGasCase *rc)
+{
+    char input[maxstrlen];
+    int control = 0;
+    T1ProcessPath *path = &rc->path;
+    
+    memset(rc, 0, sizeof(T1RealGasCase));
+    
+    control = 1;
+    while(control == 1)
+    {
+        printf("Please select from the following processes:\n1. Reversible adiabatic\n2. Polytropic (PV^alpha = const)\n3. Isothermal\n4. Isobaric\n5. Isochoric\n6. Compressor or expander (isentropic efficiency)\n7. Compressor or expander (polytropic efficiency)\n");
+        printf("Selection [1 - 7]: ");
+        fgets(input, sizeof(input), stdin);
+        control = 0;
+        switch(input[0])
+        {
+            case '1':
+                path->type = PathAdiabatic;
+                break;
+            case '2':
+                path->type = PathPolytropic;
+                break;
+            case '3':
+                path->type = PathIsothermal;
+                break;
+            case '4':
+                path->type = PathIsobaric;
+                break;
+            case '5':
+                path->type = PathIsochoric;
+                break;
+            case '6':
+                rc->machine = RealGasIsentropicEff;
+                break;
+            case '7':
+                rc->machine = RealGasPolytropicEff;
+                break;
+            default:
+                printf("Input not recognised\n");
+                control = 1;
+                break;
+        }
+    }
+    
+    path->T1 = inputDouble(1, 1, "initial system temperature", "deg C");
+    path->T1 = (path->T1) + 273.15;
+    
+    path->P1 = inputDouble(0, 0, "initial system pressure", "kPa");
+    path->P1 = (path->P1)*1000;
+    
+    path->n = inputDouble(0, 0, "molar flowrate", "kmol/s");
+    path->n = (path->n)*1000;
+    path->Rgas = R;
+    
+    if(path->type == PathIsobaric || path->type == PathIsochoric)
+    {
+        path->by = PathByTemperature;
+        path->x1 = path->T1;
+        path->x2 = inputDouble(1, 1, "final system temperature", "deg C");
+        path->x2 = (path->x2) + 273.15;
+    }else{
+        path->by = PathByPressure;
+        path->x1 = path->P1;
+        path->x2 = inputDouble(0, 0, "final system pressure", "kPa");
+        path->x2 = (path->x2)*1000;
+    }
+    if(path->type == PathPolytropic)
+    {
+        path->alpha = inputDouble(0, 0, "polytropic index", "[ ]");
+    }
+    if(rc->machine != 0)
+    {
+        rc->eff = inputDouble(0, 0, (rc->machine == RealGasIsentropicEff) ? "isentropic efficiency" : "polytropic efficiency", "%");
+        rc->eff = (rc->eff)*0.01;
+    }
+}
+
+/// MARK: GENERAL CALCULATIONS
+/// This subroutine is used to calculate the ideal gas heat capacity, enthalpy and entropy of the gas. The enthalpy is relative to 25 deg C and the entropy to 25 deg C and 1 bar, including the entropy of mixing.
+static void RealGasIdealProperties(const T1RealGas *gas, double T, double *cp, double *h, double *s)
+{
+    *cp = 0.0;
+    *h = 0.0;
+    *s = 0.0;
+    for(int i = 0; i < gas->ncomp; ++i)
+    {
+        const double *c = gas->cp[i];
+        double x = gas->x[i];
+        
+        if(x <= 0.0)
+        {
+            continue;
+        }
+        *cp += x*(c[0] + c[1]*T + c[2]*T*T + c[3]*T*T*T);
+        *h += x*(c[0]*(T - Tref) + c[1]*(T*T - Tref*Tref)/2.0 + c[2]*(T*T*T - Tref*Tref*Tref)/3.0 + c[3]*(T*T*T*T - Tref*Tref*Tref*Tref)/4.0);
+        *s += x*(c[0]*log(T/Tref) + c[1]*(T - Tref) + c[2]*(T*T - Tref*Tref)/2.0 + c[3]*(T*T*T - Tref*Tref*Tref)/3.0 - R*log(x));
+    }
+}
+
+/// This subroutine is used to calculate the pressure of the gas at a temperature and molar volume from the equation of state, and its temperature derivative at constant volume.
+static double RealGasPressure(const T1RealGas *gas, MixState *st, double T, double v, double *dPdT)
+{
+    double d1 = (gas->model == RealGasSRK) ? 1.0 : 1.0 + sqrt(2.0);
+    double d2 = (gas->model == RealGasSRK) ? 0.0 : 1.0 - sqrt(2.0);
+    double den = 0.0;
+    
+    if(gas->model == RealGasIdeal)
+    {
+        *dPdT = R/v;
+        return R*T/v;
+    }
+    
+    MixRuleEvaluate(&gas->mix, st, T, gas->x);
+    den = (v + d1*st->bm)*(v + d2*st->bm);
+    *dPdT = R/(v - st->bm) - st->damdT/den;
+    
+    return R*T/(v - st->bm) - st->am/den;
+}
+
+double RealGasDeparture(const T1RealGas *gas, MixState *st, double T, double P, double *hdep, double *sdep)
+{
+    if(gas->model == RealGasIdeal)
+    {
+        *hdep = 0.0;
+        *sdep = 0.0;
+        return 1.0;
+    }
+    
+    return MixCubicPhase(&gas->mix, st, T, P, gas->x, MixVapourRoot, NULL, hdep, sdep);
+}
+
+void RealGasPoint(const T1RealGas *gas, MixState *st, double T, double P, T1RealPoint *pt)
+{
+    RealGasPhasePoint(gas, st, T, P, MixVapourRoot, pt);
+}
+
+void RealGasPhasePoint(const T1RealGas *gas, MixState *st, double T, double P, int root, T1RealPoint *pt)
+{
+    double cp = 0.0;
+    double hdep = 0.0;
+    double sdep = 0.0;
+    
+    RealGasIdealProperties(gas, T, &cp, &pt->h, &pt->s);
+    if(gas->model == RealGasIdeal){
+        pt->Z = 1.0;
+    }else{
+        pt->Z = MixCubicPhase(&gas->mix, st, T, P, gas->x, root, NULL, &hdep, &sdep);
+    }
+    pt->T = T;
+    pt->P = P;
+    pt->v = pt->Z*R*T/P;
+    pt->h += hdep;
+    pt->s += sdep - R*log(P/Pref);
+    pt->u = pt->h - P*pt->v;
+}
+
+/// This subroutine is used to solve for the temperature at which a property of the gas matches its specification at a fixed pressure. The secant method is started from the ideal gas slope and each step is limited to half of the current temperature.
+static int RealGasSolveT(const T1RealGas *gas, MixState *st, int spec, double P, double target, double T, T1RealPoint *pt)
+{
+    double f = 0.0;
+    double fprev = 0.0;
+    double Tprev = 0.0;
+    double slope = 0.0;
+    double step = 0.0;
+    double cp = 0.0;
+    double h = 0.0;
+    double s = 0.0;
+    
+    for(int iter = 0; iter < realmaxiter; ++iter)
+    {
+        if(spec == RealSpecV)
+        {
+            f = RealGasPressure(gas, st, T, target, &slope) - P;
+        }else{
+            RealGasPoint(gas, st, T, P, pt);
+            f = (spec == RealSpecH) ? pt->h - target : pt->s - target;
+            if(iter == 0)
+            {
+                RealGasIdealProperties(gas, T, &cp, &h, &s);
+                slope = (spec == RealSpecH) ? cp : cp/T;
+            }
+        }
+        if(iter > 0 && spec != RealSpecV && f != fprev)
+        {
+            slope = (f - fprev)/(T - Tprev);
+        }
+        if(slope <= 0.0)
+        {
+            RealGasIdealProperties(gas, T, &cp, &h, &s);
+            slope = (spec == RealSpecH) ? cp : (spec == RealSpecS) ? cp/T : R/target;
+        }
+        
+        step = -f/slope;
+        step = fmax(fmin(step, 0.5*T), -0.5*T);
+        Tprev = T;
+        fprev = f;
+        T = T + step;
+        if(fabs(step) < realtol*T)
+        {
+            RealGasPoint(gas, st, T, P, pt);
+            return 0;
+        }
+    }
+    RealGasPoint(gas, st, T, P, pt);
+    
+    return 1;
+}
+
+int RealGasFlashPH(const T1RealGas *gas, MixState *st, double P, double h, double Tguess, T1RealPoint *pt)
+{
+    return RealGasSolveT(gas, st, RealSpecH, P, h, Tguess, pt);
+}
+
+int RealGasFlashPS(const T1RealGas *gas, MixState *st, double P, double s, double Tguess, T1RealPoint *pt)
+{
+    return RealGasSolveT(gas, st, RealSpecS, P, s, Tguess, pt);
+}
+
+int RealGasFlashPV(const T1RealGas *gas, MixState *st, double P, double v, double Tguess, T1RealPoint *pt)
+{
+    return RealGasSolveT(gas, st, RealSpecV, P, v, Tguess, pt);
+}
+
+int RealGasMachine(const T1RealGas *gas, MixState *st, int machine, double eff, int steps, const T1RealPoint *in, double P2, T1RealPoint *out)
+{
+    T1RealPoint a = *in;
+    T1RealPoint b = *in;
+    int status = 0;
+    
+    if(machine == RealGasIsentropicEff || steps < 1)
+    {
+        steps = 1;
+    }
+    for(int k = 1; k <= steps; ++k)
+    {
+        double P = (k == steps) ? P2 : in->P*pow(P2/in->P, (double)k/steps);
+        double dh = 0.0;
+        
+        // Isentropic step, started from a diatomic ideal gas estimate, followed by the actual enthalpy change at the same pressure
+        status |= RealGasFlashPS(gas, st, P, a.s, a.T*pow(P/a.P, 2.0/7.0), &b);
+        dh = b.h - a.h;
+        dh = (P > a.P) ? dh/eff : dh*eff;
+        status |= RealGasFlashPH(gas, st, P, a.h + dh, b.T, &a);
+    }
+    *out = a;
+    
+    return status;
+}
+
+/// This subroutine is used to find the state at one value of the independent variable of a closed real gas path, together with the volume work done on and the heat supplied to each mole of gas since the initial state. This function returns the flash status, or -1 when the path cannot be traced by the independent variable.
+static int RealGasPathState(const T1RealGas *gas, MixState *st, const T1ProcessPath *path, const T1RealPoint *in, double x, double Tguess, T1RealPoint *pt, double *w, double *q)
+{
+    double v = (path->by == PathByVolume) ? x/path->n : 0.0;
+    double dPdT = 0.0;
+    double alpha = path->alpha;
+    int status = 0;
+    
+    switch(path->type)
+    {
+        case PathAdiabatic:
+            if(path->by != PathByPressure)
+            {
+                return -1;
+            }
+            status = RealGasFlashPS(gas, st, x, in->s, Tguess, pt);
+            *w = pt->u - in->u;
+            break;
+        case PathPolytropic:
+            if(path->by == PathByPressure)
+            {
+                v = in->v*pow(in->P/x, 1.0/alpha);
+                status = RealGasFlashPV(gas, st, x, v, Tguess, pt);
+            }else if(path->by == PathByVolume){
+                status = RealGasFlashPV(gas, st, in->P*pow(in->v/v, alpha), v, Tguess, pt);
+            }else{
+                return -1;
+            }
+            // PV^alpha = const fixes the work whatever the gas
+            if(fabs(alpha - 1.0) < 1e-9)
+            {
+                *w = in->P*in->v*log(in->v/pt->v);
+            }else{
+                *w = (pt->P*pt->v - in->P*in->v)/(alpha - 1.0);
+            }
+            break;
+        case PathIsothermal:
+            if(path->by == PathByPressure)
+            {
+                RealGasPoint(gas, st, in->T, x, pt);
+            }else if(path->by == PathByVolume){
+                RealGasPoint(gas, st, in->T, RealGasPressure(gas, st, in->T, v, &dPdT), pt);
+            }else{
+                return -1;
+            }
+            // Helmholtz energy change
+            *w = (pt->u - in->u) - in->T*(pt->s - in->s);
+            break;
+        case PathIsobaric:
+            if(path->by == PathByTemperature)
+            {
+                RealGasPoint(gas, st, x, in->P, pt);
+            }else if(path->by == PathByVolume){
+                status = RealGasFlashPV(gas, st, in->P, v, Tguess, pt);
+            }else{
+                return -1;
+            }
+            *w = -in->P*(pt->v - in->v);
+            break;
+        case PathIsochoric:
+            if(path->by == PathByTemperature)
+            {
+                RealGasPoint(gas, st, x, RealGasPressure(gas, st, x, in->v, &dPdT), pt);
+            }else if(path->by == PathByPressure){
+                status = RealGasFlashPV(gas, st, x, in->v, Tguess, pt);
+            }else{
+                return -1;
+            }
+            *w = 0.0;
+            break;
+        default:
+            return -1;
+    }
+    *q = (pt->u - in->u) - (*w);
+    if(path->type == PathAdiabatic)
+    {
+        *q = 0.0;
+    }
+    
+    return status;
+}
+
+/// This subroutine is used to evaluate a block of rows of a closed real gas path or an isentropic efficiency machine. Each block keeps its own equation of state cache and starts each flash from the temperature of the previous row. Used as the kernel of "parallelFor(...)".
+/// @param start First row in the block.
+/// @param end One past the last row in the block.
+/// @param context Pointer to a "RealGasProfileContext" struct.
+static void RealGasProfileKernel(int start, int end, void *context)
+{
+    RealGasProfileContext *ctx = context;
+    const T1RealGasCase *rc = ctx->rc;
+    const T1ProcessPath *path = &rc->path;
+    T1ThermoProf *profile = ctx->profile;
+    
+    MixState st;
+    T1RealPoint pt = *ctx->in;
+    int last = profile->rows - 1;
+    
+    MixStateReset(&st);
+    for(int i = start; i < end; ++i)
+    {
+        double x = 0.0;
+        double w = 0.0;
+        double q = 0.0;
+        double Tguess = pt.T;
+        
+        if(rc->machine != 0)
+        {
+            x = (i == last) ? path->x2 : path->x1*pow(path->x2/path->x1, (double)i/last);
+            RealGasMachine(ctx->gas, &st, rc->machine, rc->eff, 1, ctx->in, x, &pt);
+            w = pt.h - ctx->in->h;
+        }else{
+            x = (i == last) ? path->x2 : path->x1 + (path->x2 - path->x1)*((double)i/last);
+            if(RealGasPathState(ctx->gas, &st, path, ctx->in, x, Tguess, &pt, &w, &q) < 0)
+            {
+                continue;
+            }
+        }
+        profile->P[i] = pt.P;
+        profile->V[i] = pt.v*path->n;
+        profile->T[i] = pt.T;
+        profile->W_V[i] = w*path->n;
+        profile->Q[i] = q*path->n;
+    }
+}
+
+T1ThermoProf RealGasProfile(const T1RealGas *gas, const T1RealGasCase *rc, int rows)
+{
+    const T1ProcessPath *path = &rc->path;
+    T1ThermoProf profile = {0};
+    RealGasProfileContext ctx = {0};
+    MixState st;
+    T1RealPoint in;
+    T1RealPoint pt;
+    double w = 0.0;
+    double q = 0.0;
+    
+    if(rows < 2)
+    {
+        rows = 2;
+    }
+    
+    MixStateReset(&st);
+    RealGasPoint(gas, &st, path->T1, path->P1, &in);
+    if(rc->machine == 0 && RealGasPathState(gas, &st, path, &in, path->x1, in.T, &pt, &w, &q) < 0)
+    {
+        printf("This process cannot be traced by the chosen variable.\n");
+        return profile;
+    }
+    
+    profile = PathProfileAlloc(rows);
+    if(profile.P == NULL || profile.V == NULL || profile.T == NULL || profile.W_V == NULL || profile.Q == NULL)
+    {
+        printf("Memory could not be allocated for the process profile.\n");
+        PathProfileFree(&profile);
+        return profile;
+    }
+    
+    if(rc->machine == RealGasPolytropicEff)
+    {
+        // Each row is one small stage of the previous one, so the path is traced in order
+        pt = in;
+        for(int i = 0; i < rows; ++i)
+        {
+            if(i > 0)
+            {
+                double P = (i == rows - 1) ? path->x2 : path->x1*pow(path->x2/path->x1, (double)i/(rows - 1));
+                
+                RealGasMachine(gas, &st, RealGasPolytropicEff, rc->eff, 1, &pt, P, &pt);
+            }
+            profile.P[i] = pt.P;
+            profile.V[i] = pt.v*path->n;
+            profile.T[i] = pt.T;
+            profile.W_V[i] = (pt.h - in.h)*path->n;
+            profile.Q[i] = 0.0;
+        }
+        return profile;
+    }
+    
+    ctx.gas = gas;
+    ctx.rc = rc;
+    ctx.in = &in;
+    ctx.profile = &profile;
+    parallelFor(rows, realgrain, RealGasProfileKernel, &ctx);
+    
+    return profile;
+}
+
+/// MARK: DISPLAY AND WRITE
+/// This subroutine is used to print the real gas and ideal gas results to a writer. Used by both "RealGasPathDisplay(...)" and "RealGasPathWrite(...)".
+static void RealGasPathPrint(ResultWriter *w, const T1RealGas *gas, const T1RealGasCase *rc, T1ThermoProf real, T1ThermoProf ideal)
+{
+    const char *process[] = {"", "Polytropic", "Isothermal", "Isobaric", "Isochoric", "Reversible adiabatic"};
+    const T1ProcessPath *path = &rc->path;
+    int last = real.rows - 1;
+    WriterColumn cols[6] = {
+        {"P", "kPa", real.P, 1, WriterFixed, 6, 0.001, 0.0},
+        {"V", "m3/s", real.V, 1, WriterFixed, 6, 1.0, 0.0},
+        {"T", "K", real.T, 1, WriterFixed, 6, 1.0, 0.0},
+        {"T", "deg C", real.T, 1, WriterFixed, 6, 1.0, -273.15},
+        {(rc->machine == 0) ? "W_V" : "W_S", "kW", real.W_V, 1, WriterFixed, 6, 0.001, 0.0},
+        {"Q", "kW", real.Q, 1, WriterFixed, 6, 0.001, 0.0}
+    };
+    
+    writerPrintf(w, "_Real_Gas_Process_Results_\n");
+    if(rc->machine == RealGasIsentropicEff)
+    {
+        writerPrintf(w, "Adiabatic machine, isentropic efficiency %.2f %%\n", rc->eff*100);
+    }else if(rc->machine == RealGasPolytropicEff){
+        writerPrintf(w, "Adiabatic machine, polytropic efficiency %.2f %%\n", rc->eff*100);
+    }else{
+        writerPrintf(w, "%s process\n", process[path->type]);
+    }
+    writerPrintf(w, "Equation of state: %s\n\n", (gas->model == RealGasSRK) ? "Soave-Redlich-Kwong" : "Peng-Robinson");
+    
+    writerPrintf(w, "\tInput parameters:\n");
+    writerPrintf(w, "Component\tTc (K)\tPc (bar)\tomega (-)\tx (-)\n");
+    for(int i = 0; i < gas->ncomp; ++i)
+    {
+        writerPrintf(w, "%s\t%.2f\t%.3f\t%.4f\t%.4f\n", gas->mix.name[i], gas->mix.Tc[i], gas->mix.Pc[i]*1e-5, gas->mix.omega[i], gas->x[i]);
+    }
+    writerPrintf(w, "\nInitial system temperature:\n");
+    writerPrintf(w, "T1 =\t%.3f\tdeg C\n", path->T1 - 273.15);
+    writerPrintf(w, "Initial system pressure:\n");
+    writerPrintf(w, "P1 =\t%.3f\tkPa\n", path->P1*0.001);
+    writerPrintf(w, "Molar flowrate:\n");
+    writerPrintf(w, "n =\t%.3f\tkmol/s\n", path->n*0.001);
+    if(rc->machine == 0 && path->type == PathPolytropic)
+    {
+        writerPrintf(w, "Polytropic index:\n");
+        writerPrintf(w, "alpha =\t%.3f\t[ ]\n", path->alpha);
+    }
+    
+    if(real.rows == 0)
+    {
+        return;
+    }
+    writerPrintf(w, "\n\tOutput parameters:\n");
+    writerPrintf(w, "\tReal gas\tIdeal gas\n");
+    writerPrintf(w, "T2 (deg C)\t%.3f\t%.3f\n", real.T[last] - 273.15, ideal.T[last] - 273.15);
+    writerPrintf(w, "P2 (kPa)\t%.3f\t%.3f\n", real.P[last]*0.001, ideal.P[last]*0.001);
+    writerPrintf(w, "V2 (m3/s)\t%.5g\t%.5g\n", real.V[last], ideal.V[last]);
+    writerPrintf(w, "%s (kW)\t%.3f\t%.3f\n", (rc->machine == 0) ? "W_V" : "W_S", real.W_V[last]*0.001, ideal.W_V[last]*0.001);
+    writerPrintf(w, "Q (kW)\t%.3f\t%.3f\n", real.Q[last]*0.001, ideal.Q[last]*0.001);
+    
+    writerPrintf(w, "\nReal gas profile:\n");
+    writerTable(w, 6, cols, real.rows);
+}
+
+void RealGasPathDisplay(const T1RealGas *gas, const T1RealGasCase *rc, T1ThermoProf real, T1ThermoProf ideal)
+{
+    ResultWriter w;             // Console writer for the results.
+    
+    if(writerConsole(&w))
+    {
+        RealGasPathPrint(&w, gas, rc, real, ideal);
+        writerClose(&w);
+    }
+}
+
+void RealGasPathWrite(const T1RealGas *gas, const T1RealGasCase *rc, T1ThermoProf real, T1ThermoProf ideal)
+{
+    //  Function variables
+    ResultWriter w;             // Buffered writer for the results file.
+    
+    //  Set file name as timestamp + Real Gas Process Results
+    if(!writerOpen(&w, "Real Gas Process Results"))
+    {
+        return;
+    }
+    
+    //  Write to file
+    RealGasPathPrint(&w, gas, rc, real, ideal);
+    
+    //  Close file
+    writerClose(&w);
+}
+
+void RealGasPathWriteSwitch(const T1RealGas *gas, const T1RealGasCase *rc, T1ThermoProf real, T1ThermoProf ideal)
+{
+    int control = 0;
+    
+    control = 1;
+    while(control == 1)
+    {
+        char input[maxstrlen];
+        
+        printf("Do you want to save results to file? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+            case 'T':
+            case 'Y':
+            case 't':
+            case 'y':
+                RealGasPathWrite(gas, rc, real, ideal);
+                control = 0;
+                break;
+            case '0':
+            case 'F':
+            case 'N':
+            case 'f':
+            case 'n':
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+}
+
+/// MARK: PSEUDO-MAIN FUNCTION
+void RealGasProcess(void)
+{
+    int whilmain = 0;
+    printf("Real Gas Process Paths\n");
+    
+    whilmain = 1;
+    while(whilmain == 1)
+    {
+        //  Variable declaration
+        T1RealGas gas;                  // Real gas description.
+        T1RealGas ideal;                // The same gas without departure functions.
+        T1RealGasCase rc;               // Process description.
+        T1ThermoProf realprof;          // Real gas process profile.
+        T1ThermoProf idealprof;         // Ideal gas process profile.
+        
+            //  Variables for timing function
+        struct timespec start, end;
+        double elapsed = 0.0;
+        
+        //  Data Collection
+        RealGasVariable(&gas);
+        RealGasCaseVariable(&rc);
+        
+        //  Running calculations
+        clock_getres(CLOCK_MONOTONIC, &start);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        
+        ideal = gas;
+        ideal.model = RealGasIdeal;
+        realprof = RealGasProfile(&gas, &rc, T1ProfileRows);
+        idealprof = RealGasProfile(&ideal, &rc, T1ProfileRows);
+        
+        clock_getres(CLOCK_MONOTONIC, &end);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        
+        elapsed = timer(start, end);
+        
+        printf("Calculations completed in %.6f seconds.\n", elapsed);
+        
+        //  Displaying results
+        RealGasPathDisplay(&gas, &rc, realprof, idealprof);
+        
+        //  Writing to File
+        RealGasPathWriteSwitch(&gas, &rc, realprof, idealprof);
+        
+        PathProfileFree(&realprof);
+        PathProfileFree(&idealprof);
+        
+        //  Continue function
+        whilmain = Continue(whilmain);
+    }
+    fflush(stdout);
+}
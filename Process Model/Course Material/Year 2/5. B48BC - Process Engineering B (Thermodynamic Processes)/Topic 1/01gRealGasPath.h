@@ -0,0 +1,171 @@
+//
+//  01gRealGasPath.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef RealGasPathStruct_h
+#define RealGasPathStruct_h
+
+#include "03aMixingRules.h"
+#include "B48BC_T1.h"
+#include "01fProcessPath.h"
+
+//  Property models
+#define RealGasIdeal 0          // Ideal gas. The departure functions are zero.
+#define RealGasSRK 1            // Soave-Redlich-Kwong.
+#define RealGasPR 2             // Peng-Robinson.
+
+//  Adiabatic machines
+#define RealGasIsentropicEff 1  // Compressor or expander rated by an isentropic efficiency.
+#define RealGasPolytropicEff 2  // Compressor or expander rated by a polytropic (small stage) efficiency.
+
+typedef struct T1RealGas{
+    int model;                  // Property model.
+    int ncomp;                  // Number of components.
+    MixRule mix;                // Critical properties and mixing rule used by the equation of state.
+    double cp[MixMaxComp][4];   // Ideal gas heat capacity, cp = cp[0] + cp[1] T + cp[2] T^2 + cp[3] T^3 (J/mol.K).
+    double x[MixMaxComp];       // Mole fractions.
+} T1RealGas;
+
+typedef struct T1RealPoint{
+    double T;                   // Temperature (K).
+    double P;                   // Pressure (Pa).
+    double v;                   // Molar volume (m3/mol).
+    double Z;                   // Compressibility factor ([ ]).
+    double h;                   // Molar enthalpy relative to the ideal gas at 25 deg C (J/mol).
+    double s;                   // Molar entropy relative to the ideal gas at 25 deg C and 1 bar (J/mol.K).
+    double u;                   // Molar internal energy (J/mol).
+} T1RealPoint;
+
+typedef struct T1RealGasCase{
+    int machine;                // Adiabatic machine, or zero for a closed process path.
+    double eff;                 // Machine efficiency ([ ]).
+    T1ProcessPath path;         // Closed process path, or the inlet state, flowrate and discharge pressure ("x2") of the machine.
+} T1RealGasCase;
+
+#endif /* RealGasPathStruct_h */
+
+#ifndef RealGasPathVariable_h
+#define RealGasPathVariable_h
+
+/// This subroutine is used to collect the equation of state, component data and composition of a real gas.
+/// @param gas Struct where the gas description should be stored.
+void RealGasVariable(T1RealGas *gas);
+
+#endif /* RealGasPathVariable_h */
+
+#ifndef RealGasPathCalc_h
+#define RealGasPathCalc_h
+
+/// This subroutine is used to calculate the enthalpy and entropy departure functions of the gas from the cubic equation of state. The vapour root is used throughout. This function returns the compressibility factor.
+/// @param gas Gas description.
+/// @param st Mixture state holding the cached equation of state parameters. Reset with "MixStateReset(...)" before first use.
+/// @param T Temperature (K).
+/// @param P Pressure (Pa).
+/// @param hdep Enthalpy departure, h - h(ideal gas) (J/mol).
+/// @param sdep Entropy departure, s - s(ideal gas) (J/mol.K).
+double RealGasDeparture(const T1RealGas *gas, MixState *st, double T, double P, double *hdep, double *sdep);
+
+/// This subroutine is used to calculate the molar volume, enthalpy, entropy and internal energy of the gas at a temperature and pressure.
+/// @param gas Gas description.
+/// @param st Mixture state.
+/// @param T Temperature (K).
+/// @param P Pressure (Pa).
+/// @param pt Struct where the state should be stored.
+void RealGasPoint(const T1RealGas *gas, MixState *st, double T, double P, T1RealPoint *pt);
+
+/// This subroutine is used to calculate the molar volume, enthalpy, entropy and internal energy of the fluid at a temperature and pressure on a chosen root of the equation of state. "RealGasPoint(...)" is this subroutine on the vapour root.
+/// @param gas Fluid description.
+/// @param st Mixture state.
+/// @param T Temperature (K).
+/// @param P Pressure (Pa).
+/// @param root Root used (MixLiquidRoot, MixVapourRoot or MixStableRoot).
+/// @param pt Struct where the state should be stored.
+void RealGasPhasePoint(const T1RealGas *gas, MixState *st, double T, double P, int root, T1RealPoint *pt);
+
+/// This subroutine is used to find the state of the gas with a given pressure and molar enthalpy (single phase PH flash). This function returns 0 when converged or 1 otherwise.
+/// @param gas Gas description.
+/// @param st Mixture state.
+/// @param P Pressure (Pa).
+/// @param h Molar enthalpy (J/mol).
+/// @param Tguess Initial temperature estimate (K).
+/// @param pt Struct where the state should be stored.
+int RealGasFlashPH(const T1RealGas *gas, MixState *st, double P, double h, double Tguess, T1RealPoint *pt);
+
+/// This subroutine is used to find the state of the gas with a given pressure and molar entropy (single phase PS flash). This function returns 0 when converged or 1 otherwise.
+/// @param gas Gas description.
+/// @param st Mixture state.
+/// @param P Pressure (Pa).
+/// @param s Molar entropy (J/mol.K).
+/// @param Tguess Initial temperature estimate (K).
+/// @param pt Struct where the state should be stored.
+int RealGasFlashPS(const T1RealGas *gas, MixState *st, double P, double s, double Tguess, T1RealPoint *pt);
+
+/// This subroutine is used to find the state of the gas with a given pressure and molar volume. This function returns 0 when converged or 1 otherwise.
+/// @param gas Gas description.
+/// @param st Mixture state.
+/// @param P Pressure (Pa).
+/// @param v Molar volume (m3/mol).
+/// @param Tguess Initial temperature estimate (K).
+/// @param pt Struct where the state should be stored.
+int RealGasFlashPV(const T1RealGas *gas, MixState *st, double P, double v, double Tguess, T1RealPoint *pt);
+
+/// This subroutine is used to find the discharge state of an adiabatic compressor or expander. An isentropic efficiency is applied to the whole pressure change, while a polytropic efficiency is applied to each of "steps" equal pressure ratios in turn. This function returns 0 when every flash converged or 1 otherwise.
+/// @param gas Gas description.
+/// @param st Mixture state.
+/// @param machine Efficiency definition (RealGasIsentropicEff or RealGasPolytropicEff).
+/// @param eff Efficiency ([ ]).
+/// @param steps Number of pressure steps used with a polytropic efficiency.
+/// @param in Inlet state.
+/// @param P2 Discharge pressure (Pa).
+/// @param out Struct where the discharge state should be stored.
+int RealGasMachine(const T1RealGas *gas, MixState *st, int machine, double eff, int steps, const T1RealPoint *in, double P2, T1RealPoint *out);
+
+/// This subroutine is used to generate the profile of a real gas process. Closed paths are evaluated from state functions at each row independently and split across the worker threads: reversible adiabatic, polytropic (PV^alpha) and isothermal paths by pressure or volume, and isobaric and isochoric paths by temperature, volume or pressure. Machines are profiled along a geometric pressure series, with "W_V" holding the cumulative shaft work. Returns an empty profile when the path and independent variable cannot be combined.
+/// @param gas Gas description.
+/// @param rc Process description. "P1" and "T1" of the path must be set.
+/// @param rows Number of rows in the profile (minimum 2).
+T1ThermoProf RealGasProfile(const T1RealGas *gas, const T1RealGasCase *rc, int rows);
+
+#endif /* RealGasPathCalc_h */
+
+#ifndef RealGasPathDisplay_h
+#define RealGasPathDisplay_h
+
+/// This subroutine is used to output the real gas and ideal gas profiles generated in "RealGasProfile(...)" to the user console.
+/// @param gas Gas description.
+/// @param rc Process description.
+/// @param real Real gas profile.
+/// @param ideal Ideal gas profile.
+void RealGasPathDisplay(const T1RealGas *gas, const T1RealGasCase *rc, T1ThermoProf real, T1ThermoProf ideal);
+
+/// This subroutine is used to write the real gas and ideal gas profiles generated in "RealGasProfile(...)" to a .txt file.
+/// @param gas Gas description.
+/// @param rc Process description.
+/// @param real Real gas profile.
+/// @param ideal Ideal gas profile.
+void RealGasPathWrite(const T1RealGas *gas, const T1RealGasCase *rc, T1ThermoProf real, T1ThermoProf ideal);
+
+/// This subroutine is used to check if the user would like to write the results to a file.
+/// @param gas Gas description.
+/// @param rc Process description.
+/// @param real Real gas profile.
+/// @param ideal Ideal gas profile.
+void RealGasPathWriteSwitch(const T1RealGas *gas, const T1RealGasCase *rc, T1ThermoProf real, T1ThermoProf ideal);
+
+#endif /* RealGasPathDisplay_h */
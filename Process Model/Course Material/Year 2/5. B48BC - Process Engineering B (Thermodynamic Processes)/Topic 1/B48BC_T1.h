@@ -22,14 +22,16 @@
 #ifndef ThermoProfiler_h
 #define ThermoProfiler_h
 
-/// This struct is used to hold the generated dataset for a thermodynamic process.
+#define T1ProfileRows 250 // Default number of rows generated for a process profile.
+
+/// This struct is used to hold the generated dataset for a thermodynamic process. Allocated with "PathProfileAlloc(...)" and released with "PathProfileFree(...)".
 typedef struct T1ThermodynamicProfile{
-    // Remember to change the limits of the intervals and for loops in the function as well!
-    double P[250];
-    double V[250];
-    double T[250];
-    double W_V[250]; // Cumulative energy requirements are not calculated and stored in the struct
-    double Q[250];
+    int rows;       // Number of rows in the profile.
+    double *P;      // System pressure (Pa).
+    double *V;      // System volume (m3).
+    double *T;      // System temperature (K).
+    double *W_V;    // Cumulative volume work done on the system (W).
+    double *Q;      // Cumulative heat supplied to the system (W).
 } T1ThermoProf;
 
 #endif /* ThermoProfiler_h */
@@ -52,6 +54,9 @@ void Isochoric(void);
 /// This subroutine is used to guide the user through collecting the data required to estimate the volume work and plot the thermodynamic profile for an Adiabatic process.
 void Adiabatic(void);
 
+/// This subroutine is used to guide the user through collecting the data required to trace a process or an adiabatic compressor on real gas properties from a cubic equation of state, and to compare it with the ideal gas result.
+void RealGasProcess(void);
+
 #endif /* B48BC_T1_h */
 
 #ifndef Isothermal_h
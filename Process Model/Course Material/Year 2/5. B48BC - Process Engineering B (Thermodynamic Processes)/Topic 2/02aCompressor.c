@@ -29,35 +29,55 @@
 
 // Custom header files
 #include "System.h"
+#include "ResultWriter.h"
 #include "IdealGasLaw.h"
+#include "Parallel.h"
 #include "B48BC_T2.h"
 #include "02aCompressor.h"
-#include "02bPolyShaftWork.h"
-
-#include "01aPolytropic.h"
-#include "01bIsothermal.h"
-#include "01cIsobaric.h"
 
 /// MARK: SUBROUTINE DEFINITIONS
 #define maxstrlen 128
+#define compgrain 4096  // Minimum number of rows evaluated by a single thread.
+#define sweepgrain 256  // Minimum number of cycles evaluated by a single thread.
+
+/// This struct is used to share a cycle and its profile between the profile kernels.
+typedef struct CompProfileContext{
+    const T2CompCycle *cycle;
+    T2CompProfile *profile;
+} CompProfileContext;
+
+/// This struct is used to share the sweep between the sweep kernels.
+typedef struct CompSweepContext{
+    const T2CompCycle *base;
+    double clo;
+    double chi;
+    int nc;
+    double rlo;
+    double rhi;
+    int nr;
+    T2CompCycle *out;
+} CompSweepContext;
 
 /// MARK: VARIABLE INPUT
-void CompressorVariable(int method, double *P1, double *P2, double *Vc, double *V1, double *T1, double *T2, double *n, double *R, double *alpha)
+void CompressorVariable(int method, T2CompCycle *cycle)
 {
     int control = 0;    // Variable used to control user input.
     
+    memset(cycle, 0, sizeof(T2CompCycle));
+    cycle->method = method;
+    
     if(method == 1 || method == 2){
-        *P1 = inputDouble(0, 0, "initial system pressure", "kPa");
-        *P1 = (*P1)*1000;
+        cycle->P1 = inputDouble(0, 0, "initial system pressure", "kPa");
+        cycle->P1 = (cycle->P1)*1000;
         
         control = 1;
         while(control == 1)
         {
-            *P2 = inputDouble(0, 0, "final system pressure", "kPa");
-            *P2 = (*P2)*1000;
-            if((*P1) > (*P2))
+            cycle->P2 = inputDouble(0, 0, "final system pressure", "kPa");
+            cycle->P2 = (cycle->P2)*1000;
+            if((cycle->P1) > (cycle->P2))
             {
-                printf("System pressure at start of compression = %.3f kPa\n", (*P1)*0.001);
+                printf("System pressure at start of compression = %.3f kPa\n", (cycle->P1)*0.001);
                 printf("Expansion process has been stated, please re-enter value for P2.\n");
             }else{
                 // P2 > P1 indicated a compression is indeed happening
@@ -67,339 +87,457 @@ void CompressorVariable(int method, double *P1, double *P2, double *Vc, double *
     }
     
     if(method == 1 || method == 2){
-        *T1 = inputDouble(1, 1, "initial system temperature", "deg C");
-        *T1 = (*T1) + 273.15;
+        cycle->T1 = inputDouble(1, 1, "initial system temperature", "deg C");
+        cycle->T1 = (cycle->T1) + 273.15;
     }
     
     if(method == 1 || method == 2){
-        *n = inputDouble(0, 0, "molar flowrate", "kmol/s");
-        *n = (*n) * 1000;
+        cycle->n = inputDouble(0, 0, "molar flowrate", "kmol/s");
+        cycle->n = (cycle->n) * 1000;
     }
     
     if(method == 1 || method == 2){
-        *Vc = inputDouble(0, 0, "clearance volume", "m3");
+        cycle->V1 = IdealVolume(cycle->n, cycle->P1, cycle->T1);
         
-        *V1 = IdealVolume(*n, *P1, *T1);
+        control = 1;
+        while(control == 1)
+        {
+            cycle->Vc = inputDouble(0, 0, "clearance volume", "m3");
+            if(cycle->Vc < cycle->V1)
+            {
+                control = 0;
+            }else{
+                printf("System volume at start of compression = %.3f m3\n", cycle->V1);
+                printf("The clearance volume must be smaller than the cylinder volume, please re-enter value for Vc.\n");
+            }
+        }
     }
     
     if(method == 1){
-        *R = 8.3145;
+        cycle->R = 8.3145;
     }
     
     if(method == 2){
-        *R = inputDouble(0, 0, "specific gas constant", "J/mol.K");
+        cycle->R = inputDouble(0, 0, "specific gas constant", "J/mol.K");
     }
     
     if(method == 1){
-        *alpha = 1;
+        cycle->alpha = 1;
     }
     if(method == 2){
-        *alpha = inputDouble(0, 0, "polytropic index", "[ ]");
+        cycle->alpha = inputDouble(0, 0, "polytropic index", "[ ]");
     }
 }
 
 /// MARK: ARRAY FUNCTION
-T2CompProfile CompressorProfile(int method, double P1, double P2, double Vc, double *V1, double *V2, double T1, double n, double R, double alpha)
+/// This subroutine is used to evaluate a point on a compression or re-expansion stage from PV^alpha = const.
+/// @param Pa Pressure at the start of the stage (Pa).
+/// @param Va Volume at the start of the stage (m3).
+/// @param Ta Temperature at the start of the stage (K).
+/// @param alpha Polytropic index.
+/// @param P Pressure at the point (Pa).
+/// @param V Volume at the point (m3).
+/// @param T Temperature at the point (K).
+/// @param W_V Volume work done on the gas since the start of the stage (W).
+static void CompStageState(double Pa, double Va, double Ta, double alpha, double P, double *V, double *T, double *W_V)
 {
-    T2CompProfile profile = {0.0};
-    //  2560 total double elements -> 2560 * 8 bytes = 20 480 bytes = 20.480 KB required.
-    //  Automatic memory allocation should be able to handle this struct. Assuming typical cache size for a modern computer is about 32 KB. Some computers with a core CPU cache less than 17 KB may struggle with this program. Intel Core i3 - 6100E has a cache size of 3MB so this program should run fine on intel machines.
-    
-    double incr = 0.0;  // Increment between datapoints
-    int elem = 0;       // Element counter
-    
-    // Stage 1: Isobaric Expansion (Volume increases)
-        // This process must occur between elements 0 to 5
-    // Expansion from Vc to V1 (Only variable that is changing in this process)
-    *V1 = IdealVolume(n, P1, T1);
-    incr = (*V1) - Vc;
-    incr = (incr)/5; // Vc will go into element 0 process into 1 to 5
-    
-    // Loading initial values
-    elem = 0;
-    profile.P[elem] = P1;
-    profile.V[elem] = Vc;
-    profile.T[elem] = T1;
-    profile.W_V[elem] = 0.0;
-    profile.W_S[elem] = 0.0;
-    
-    for(elem = 1; elem < 6; ++ elem){
-        profile.P[elem] = P1; // Isobaric process, pressure will stay constant
-        profile.V[elem] = profile.V[elem - 1] + incr;
-        profile.T[elem] = T1;
-        profile.W_V[elem] = IsobVolume(profile.P[elem], profile.V[elem - 1], profile.V[elem]);
-        profile.W_S[elem] = profile.V[elem]*(profile.P[elem] - profile.P[elem - 1]); // Pressure is not changing so no shaft work is being done. Calculation is being performed just in case.
+    double ratio = P/Pa;
+    
+    *V = Va*pow(ratio, -1.0/alpha);
+    *T = Ta*pow(ratio, (alpha - 1.0)/alpha);
+    if(fabs(alpha - 1.0) < 1e-9){
+        *W_V = Pa*Va*log(ratio);
+    }else{
+        *W_V = (P*(*V) - Pa*Va)/(alpha - 1.0);
     }
+}
+
+int CompressorCycle(T2CompCycle *cycle)
+{
+    double P1 = cycle->P1;
+    double P2 = cycle->P2;
+    double alpha = 0.0;
+    double temp = 0.0;
     
-    // Stage 2: Isothermal/ Polytropic Compression
-        // This process must occur between elements 6 to 505
-    if(method == 1 || method == 2){
-        // Pressure is used to set the data point on the profile
-        incr = P2 - P1;
-        incr = (incr)/500;
+    if(cycle->method == 1){
+        cycle->alpha = 1.0;
     }
+    alpha = cycle->alpha;
     
-    for(elem = 6; elem < 506; ++elem){
-        if(method == 1){
-            profile.P[elem] = profile.P[elem - 1] + incr;
-            profile.T[elem] = profile.T[5];
-            profile.V[elem] = IsotFinalVolume(profile.V[elem - 1], profile.P[elem - 1], profile.P[elem]);
-            profile.W_V[elem] = IsotPressure(n, profile.T[elem], profile.P[elem - 1], profile.P[elem]);
-            profile.W_S[elem] = IdealShaftCalculation(n, R, profile.T[elem - 1], profile.P[elem - 1], profile.P[elem]);
-        }
-        if(method == 2){
-            profile.P[elem] = profile.P[elem - 1] + incr;
-            profile.V[elem] = PolyFinalVolume(profile.P[elem - 1], profile.P[elem], profile.V[elem - 1], alpha);
-            profile.T[elem] = PolyFinalTemperature(profile.T[elem - 1], profile.P[elem - 1], profile.P[elem], alpha);
-            profile.W_V[elem] = PolyVolume(profile.P[elem - 1], profile.P[elem], profile.V[elem - 1], alpha);
-            profile.W_S[elem] = PolyShaftCalculation(n, R, profile.T[elem - 1], profile.P[elem - 1], profile.P[elem], alpha);
-        }
+    cycle->Vs = cycle->V1 - cycle->Vc;
+    cycle->c = cycle->Vc/cycle->Vs;
+    
+    // Stage 1: Compression from the cylinder volume to the discharge pressure
+    CompStageState(P1, cycle->V1, cycle->T1, alpha, P2, &cycle->V2, &cycle->T2, &cycle->W_V[0]);
+    
+    // Stage 3: Re-expansion of the clearance gas to the suction pressure. Following the same path back to P1 returns the gas to T1.
+    CompStageState(P2, cycle->Vc, cycle->T2, alpha, P1, &cycle->V4, &temp, &cycle->W_V[2]);
+    
+    cycle->etaV = (cycle->V1 - cycle->V4)/cycle->Vs;
+    if(!(cycle->V4 < cycle->V1))
+    {
+        // The clearance gas fills the cylinder, so the discharge pressure is never reached
+        cycle->etaV = 0.0;
+        cycle->nDel = 0.0;
+        memset(cycle->W_V, 0, sizeof(cycle->W_V));
+        memset(cycle->W_S, 0, sizeof(cycle->W_S));
+        cycle->Wnet = 0.0;
+        return 0;
     }
-    *V2 = profile.V[505];
-    
-    // Stage 3: Isobaric Compression (Volume decreases
-        // This process must occur between elements 506 to 511
-    // System volume is used to set the data points on the profile
-    incr = Vc - profile.V[505];
-    incr = (incr)/6;
-    
-    for(elem = 506; elem < 512; ++elem){
-        profile.P[elem] = profile.P[elem - 1]; // Isobaric process, pressure will stay constant
-        profile.V[elem] = profile.V[elem - 1] + incr;
-        profile.T[elem] = profile.T[elem - 1];
-        profile.W_V[elem] = IsobVolume(profile.P[elem], profile.V[elem - 1], profile.V[elem]);
-        profile.W_S[elem] = profile.V[elem]*(profile.P[elem] - profile.P[elem - 1]); // Pressure is not changing so no shaft work is being done. Calculation is being performed just in case.
+    // The clearance gas is at T1 and P1 after re-expansion, so the gas delivered is in proportion to the volume drawn in
+    cycle->nDel = cycle->n*(cycle->V1 - cycle->V4)/cycle->V1;
+    
+    // Stage 2: Isobaric discharge and Stage 4: Isobaric intake
+    cycle->W_V[1] = P2*(cycle->V2 - cycle->Vc);
+    cycle->W_V[3] = -P1*(cycle->V1 - cycle->V4);
+    
+    // The integral of V dP is alpha times the volume work along PV^alpha = const and zero along an isobar
+    cycle->W_S[0] = alpha*cycle->W_V[0];
+    cycle->W_S[1] = 0.0;
+    cycle->W_S[2] = alpha*cycle->W_V[2];
+    cycle->W_S[3] = 0.0;
+    
+    cycle->Wnet = 0.0;
+    for(int k = 0; k < CompStages; ++k)
+    {
+        cycle->Wnet += cycle->W_V[k];
     }
     
-    return profile;
+    return 1;
 }
 
-/// MARK: DISPLAY AND WRITE
-void CompresDisplay(double P1, double P2, double Vc, double V1, double V2, double T1, double T2, double n, double R, double alpha, T2CompProfile profile)
+T2CompProfile CompProfileAlloc(int rows)
 {
-    char input[maxstrlen];
-    
-    int control = 0;        // Variable used to force character input.
-    printf("_Reciprocating_Compressor_Results_\n");
-    printf("\tInput parameters:\n");
-    printf("Initial system pressure:\n");
-    printf("P1 =\t%.3f\tkPa\n", P1*0.001);
-    printf("Final system pressure:\n");
-    printf("P2 =\t%.3f\tkPa\n\n", P2*0.001);
-    
-    printf("Clearance volume:\n");
-    printf("Vc =\t%.3f\tm3\n", Vc);
-    printf("System volume before compression:\n");
-    printf("V1 =\t%.3f\tm3\n", V1);
-    printf("System volume after compression:\n");
-    printf("V2 =\t%.3f\tm3\n\n", V2);
-    
-    printf("Initial system temperature:\n");
-    printf("T1 =\t%.3f\tdeg C\n", T1-273.15);
-    printf("Final system volume:\n");
-    printf("T2 =\t%.3f\tdeg C\n\n", T2-273.15);
-    
-    printf("_System-Specific_parameters:_\n");
-    printf("Molar flowrate of component i:\n");
-    printf("n =\t%.3f\tkmol/s\n", n*0.001);
-    if( fabs( R - (8.3145) ) <= 0.0005 ){
-        printf("Universal Gas Constant:\n");
-        printf("R =\t%.4f\tJ/(mol. K)\n\n", R);
-    }else{
-        printf("Specific Gas Constant:\n");
-        printf("R =\t%.4f\tJ/(mol. K)\n\n", R);
-    }
+    T2CompProfile profile = {0};
     
-    printf("Polytropic Index:\n");
-    printf("alpha =\t%.3f\t[ ]\n\n", alpha);
+    profile.rows = rows;
+    profile.P = calloc(rows, sizeof(double));
+    profile.V = calloc(rows, sizeof(double));
+    profile.T = calloc(rows, sizeof(double));
+    profile.W_V = calloc(rows, sizeof(double));
+    profile.W_S = calloc(rows, sizeof(double));
+    
+    return profile;
+}
+
+void CompProfileFree(T2CompProfile *profile)
+{
+    free(profile->P);
+    free(profile->V);
+    free(profile->T);
+    free(profile->W_V);
+    free(profile->W_S);
+    
+    profile->P = NULL;
+    profile->V = NULL;
+    profile->T = NULL;
+    profile->W_V = NULL;
+    profile->W_S = NULL;
+    profile->rows = 0;
+}
+
+/// This subroutine is used to evaluate a block of rows of an indicator diagram. Used as the kernel of "parallelFor(...)".
+/// @param start First row in the block.
+/// @param end One past the last row in the block.
+/// @param context Pointer to a "CompProfileContext" struct.
+static void CompProfileKernel(int start, int end, void *context)
+{
+    CompProfileContext *ctx = context;
+    const T2CompCycle *cy = ctx->cycle;
+    T2CompProfile *profile = ctx->profile;
+    const int *first = profile->start;
     
-    control = 1;
-    while(control == 1)
+    for(int i = start; i < end; ++i)
     {
-        printf("Do you want to display the generated profile? ");
-        fgets(input, sizeof(input), stdin);
-        switch(input[0])
+        double f = 0.0;
+        double W = 0.0;
+        int k = 0;
+        
+        // Locating the stage of the row
+        while(k < CompStages && i >= first[k + 1])
         {
-            case '1':
-            case 'T':
-            case 'Y':
-            case 't':
-            case 'y':
-                printf("\tOutput parameters:\n");
-                // Profile (Two Temperature columns (K and deg C))
-                printf("P (kPa)\tV (m3)\tT (K)\tT(deg C)\t\tW_V (kW)\tW_S (kW)\n");
-                for(int i = 0; i < 512; ++i)
-                {
-                    printf("%f\t", profile.P[i]*0.001);
-                    printf("%f\t", profile.V[i]);
-                    printf("%f\t", profile.T[i]);
-                    printf("%f\t\t", profile.T[i] - 273.15);
-                    printf("%f\t", profile.W_V[i]*0.001);
-                    printf("%f\n", profile.W_S[i]*0.001);
-                }
-                
-                control = 0;
+            ++k;
+        }
+        if(k < CompStages)
+        {
+            f = (double)(i - first[k])/(first[k + 1] - first[k]);
+        }
+        
+        switch(k)
+        {
+            case 0:
+                profile->P[i] = cy->P1 + f*(cy->P2 - cy->P1);
+                CompStageState(cy->P1, cy->V1, cy->T1, cy->alpha, profile->P[i], &profile->V[i], &profile->T[i], &W);
+                profile->W_V[i] = W;
+                profile->W_S[i] = cy->alpha*W;
                 break;
-            case '0':
-            case 'F':
-            case 'N':
-            case 'f':
-            case 'n':
-                control = 0;
+            case 1:
+                profile->P[i] = cy->P2;
+                profile->V[i] = cy->V2 + f*(cy->Vc - cy->V2);
+                profile->T[i] = cy->T2;
+                profile->W_V[i] = cy->W_V[0] + cy->P2*(cy->V2 - profile->V[i]);
+                profile->W_S[i] = cy->W_S[0];
+                break;
+            case 2:
+                profile->P[i] = cy->P2 + f*(cy->P1 - cy->P2);
+                CompStageState(cy->P2, cy->Vc, cy->T2, cy->alpha, profile->P[i], &profile->V[i], &profile->T[i], &W);
+                profile->W_V[i] = cy->W_V[0] + cy->W_V[1] + W;
+                profile->W_S[i] = cy->W_S[0] + cy->alpha*W;
+                break;
+            case 3:
+                profile->P[i] = cy->P1;
+                profile->V[i] = cy->V4 + f*(cy->V1 - cy->V4);
+                profile->T[i] = cy->T1;
+                profile->W_V[i] = cy->W_V[0] + cy->W_V[1] + cy->W_V[2] - cy->P1*(profile->V[i] - cy->V4);
+                profile->W_S[i] = cy->W_S[0] + cy->W_S[2];
                 break;
             default:
-                printf("Input not recognised\n");
-            break;
+                // Row closing the cycle
+                profile->P[i] = cy->P1;
+                profile->V[i] = cy->V1;
+                profile->T[i] = cy->T1;
+                profile->W_V[i] = cy->Wnet;
+                profile->W_S[i] = cy->W_S[0] + cy->W_S[2];
+                break;
         }
     }
-    fflush(stdout);
 }
 
-void CompresWrite(double P1, double P2, double Vc, double V1, double V2, double T1, double T2, double n, double R, double alpha, T2CompProfile profile)
+int CompressorProfile(const T2CompCycle *cycle, T2CompProfile *profile)
 {
-    //  Function variables
-    char filename[maxstrlen];
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    CompProfileContext ctx = {0};
+    int rows = profile->rows;
+    int isobaric = 0;   // Rows in each isobaric stage.
+    int curved = 0;     // Rows in both curved stages.
     
-    FILE *fp;
-    //  Set file name as timestamp + Compressor Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Compressor Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
+    if(rows < CompMinRows || !(cycle->nDel > 0.0))
+    {
+        return 0;
+    }
+    
+    // Three eighths of the rows for each curved stage and one eighth for each isobaric stage
+    isobaric = (rows - 1)/8;
+    isobaric = (isobaric < 1) ? 1 : isobaric;
+    curved = rows - 1 - 2*isobaric;
+    
+    profile->start[0] = 0;
+    profile->start[1] = profile->start[0] + (curved + 1)/2;
+    profile->start[2] = profile->start[1] + isobaric;
+    profile->start[3] = profile->start[2] + curved/2;
+    profile->start[4] = profile->start[3] + isobaric;
+    
+    ctx.cycle = cycle;
+    ctx.profile = profile;
+    parallelFor(rows, compgrain, CompProfileKernel, &ctx);
+    
+    return 1;
+}
 
-    strcat(filepath, filename);
+/// This subroutine is used to evaluate a block of cycles of a sweep. Used as the kernel of "parallelFor(...)".
+/// @param start First cycle in the block.
+/// @param end One past the last cycle in the block.
+/// @param context Pointer to a "CompSweepContext" struct.
+static void CompSweepKernel(int start, int end, void *context)
+{
+    CompSweepContext *ctx = context;
+    const T2CompCycle *base = ctx->base;
+    
+    for(int i = start; i < end; ++i)
+    {
+        T2CompCycle *cy = &ctx->out[i];
+        int ic = i/ctx->nr;
+        int ir = i%ctx->nr;
+        double c = (ctx->nc > 1) ? ctx->clo + (ctx->chi - ctx->clo)*((double)ic/(ctx->nc - 1)) : ctx->clo;
+        double r = (ctx->nr > 1) ? ctx->rlo + (ctx->rhi - ctx->rlo)*((double)ir/(ctx->nr - 1)) : ctx->rlo;
+        
+        *cy = *base;
+        cy->Vc = c*base->Vs;
+        cy->V1 = cy->Vc + base->Vs;
+        cy->n = base->n*(cy->V1/base->V1);
+        cy->P2 = r*base->P1;
+        CompressorCycle(cy);
+    }
+}
 
-    printf("Full file path: \"%s\"\n\n", filepath);
+void CompressorSweep(const T2CompCycle *base, double clo, double chi, int nc, double rlo, double rhi, int nr, T2CompCycle *out)
+{
+    CompSweepContext ctx = {base, clo, chi, nc, rlo, rhi, nr, out};
+    
+    parallelFor(nc*nr, sweepgrain, CompSweepKernel, &ctx);
+}
 
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+/// MARK: DISPLAY AND WRITE
+/// This subroutine is used to print the cycle to a writer. Used by both "CompresDisplay(...)" and "CompresWrite(...)".
+static void CompresPrint(ResultWriter *w, const T2CompCycle *cy)
+{
+    const char *stage[CompStages] = {"Compression", "Discharge", "Re-expansion", "Intake"};
+    
+    writerPrintf(w, "_Reciprocating_Compressor_Results_\n");
+    writerPrintf(w, "\tInput parameters:\n");
+    writerPrintf(w, "Initial system pressure:\n");
+    writerPrintf(w, "P1 =\t%.3f\tkPa\n", cy->P1*0.001);
+    writerPrintf(w, "Final system pressure:\n");
+    writerPrintf(w, "P2 =\t%.3f\tkPa\n\n", cy->P2*0.001);
+    
+    writerPrintf(w, "Clearance volume:\n");
+    writerPrintf(w, "Vc =\t%.3f\tm3\n", cy->Vc);
+    writerPrintf(w, "System volume before compression:\n");
+    writerPrintf(w, "V1 =\t%.3f\tm3\n", cy->V1);
+    writerPrintf(w, "System volume after compression:\n");
+    writerPrintf(w, "V2 =\t%.3f\tm3\n", cy->V2);
+    writerPrintf(w, "System volume after re-expansion:\n");
+    writerPrintf(w, "V4 =\t%.3f\tm3\n\n", cy->V4);
+    
+    writerPrintf(w, "Initial system temperature:\n");
+    writerPrintf(w, "T1 =\t%.3f\tdeg C\n", cy->T1 - 273.15);
+    writerPrintf(w, "Final system temperature:\n");
+    writerPrintf(w, "T2 =\t%.3f\tdeg C\n\n", cy->T2 - 273.15);
+    
+    writerPrintf(w, "_System-Specific_parameters:_\n");
+    writerPrintf(w, "Molar flowrate of component i:\n");
+    writerPrintf(w, "n =\t%.3f\tkmol/s\n", cy->n*0.001);
+    if( fabs( cy->R - (8.3145) ) <= 0.0005 ){
+        writerPrintf(w, "Universal Gas Constant:\n");
+        writerPrintf(w, "R =\t%.4f\tJ/(mol. K)\n\n", cy->R);
+    }else{
+        writerPrintf(w, "Specific Gas Constant:\n");
+        writerPrintf(w, "R =\t%.4f\tJ/(mol. K)\n\n", cy->R);
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
     
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
-    
-    //  Write to file
-    fprintf(fp, "_Reciprocating_Compressor_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Initial system pressure:\n");
-    fprintf(fp, "P1 =\t%.3f\tkPa\n", P1*0.001);
-    fprintf(fp, "Final system pressure:\n");
-    fprintf(fp, "P2 =\t%.3f\tkPa\n\n", P2*0.001);
-    
-    fprintf(fp, "Clearance volume:\n");
-    fprintf(fp, "Vc =\t%.3f\tm3\n", Vc);
-    fprintf(fp, "Initial system volume:\n");
-    fprintf(fp, "V1 =\t%.3f\tm3\n", V1);
-    fprintf(fp, "Final system volume:\n");
-    fprintf(fp, "V2 =\t%.3f\tm3\n\n", V2);
-    
-    fprintf(fp, "Initial system temperature:\n");
-    fprintf(fp, "T1 =\t%.3f\tdeg C\n", T1-273.15);
-    fprintf(fp, "Final system temperature:\n");
-    fprintf(fp, "T2 =\t%.3f\tdeg C\n\n", T2-273.15);
-    
-    fprintf(fp, "_System-Specific_parameters:_\n");
-    
-    fprintf(fp, "Molar flowrate of component i:\n");
-    fprintf(fp, "n =\t%.3f\tkmol/s\n", n*0.001);
-    if( fabs( R - (8.3145) ) < 0.0005 ){
-        fprintf(fp, "Universal Gas Constant:\n");
-        fprintf(fp, "R =\t%.4f\tJ/(mol. K)\n\n", R);
+    writerPrintf(w, "Polytropic Index:\n");
+    writerPrintf(w, "alpha =\t%.3f\t[ ]\n\n", cy->alpha);
+    
+    writerPrintf(w, "_Clearance_Effects_\n");
+    writerPrintf(w, "Swept volume:\n");
+    writerPrintf(w, "Vs =\t%.3f\tm3\n", cy->Vs);
+    writerPrintf(w, "Clearance fraction:\n");
+    writerPrintf(w, "c =\t%.4f\t[ ]\n", cy->c);
+    writerPrintf(w, "Volumetric efficiency:\n");
+    writerPrintf(w, "eta_V =\t%.3f\t%%\n", 100*cy->etaV);
+    writerPrintf(w, "Gas delivered:\n");
+    writerPrintf(w, "n_del =\t%.3f\tkmol/s\n\n", cy->nDel*0.001);
+    
+    if(cy->nDel > 0.0){
+        writerPrintf(w, "Stage\tW_V (kW)\tW_S (kW)\n");
+        for(int k = 0; k < CompStages; ++k)
+        {
+            writerPrintf(w, "%s\t%f\t%f\n", stage[k], cy->W_V[k]*0.001, cy->W_S[k]*0.001);
+        }
+        writerPrintf(w, "Indicated work of the cycle:\n");
+        writerPrintf(w, "W =\t%.3f\tkW\n", cy->Wnet*0.001);
+        writerPrintf(w, "Indicated work per mole delivered:\n");
+        writerPrintf(w, "w =\t%.3f\tkJ/mol\n\n", cy->Wnet/cy->nDel*0.001);
     }else{
-        fprintf(fp, "Specific Gas Constant:\n");
-        fprintf(fp, "R =\t%.4f\tJ/(mol. K)\n\n", R);
+        writerPrintf(w, "The clearance gas re-expands to fill the cylinder, so no gas is delivered.\n\n");
+    }
+}
+
+/// This subroutine is used to print the indicator diagram to a writer. Used by both "CompresDisplay(...)" and "CompresWrite(...)".
+static void CompresProfilePrint(ResultWriter *w, const T2CompProfile *profile)
+{
+    //  Profile (Two Temperature columns (K and deg C))
+    WriterColumn cols[6] = {
+        {"P", "kPa", profile->P, 1, WriterFixed, 6, 0.001, 0.0},
+        {"V", "m3", profile->V, 1, WriterFixed, 6, 1.0, 0.0},
+        {"T", "K", profile->T, 1, WriterFixed, 6, 1.0, 0.0},
+        {"T", "deg C", profile->T, 1, WriterFixed, 6, 1.0, -273.15},
+        {"W_V", "kW", profile->W_V, 1, WriterFixed, 6, 0.001, 0.0},
+        {"W_S", "kW", profile->W_S, 1, WriterFixed, 6, 0.001, 0.0}
+    };
+    
+    writerText(w, "\tOutput parameters:\n");
+    writerTable(w, 6, cols, profile->rows);
+}
+
+void CompresDisplay(const T2CompCycle *cycle, const T2CompProfile *profile)
+{
+    ResultWriter w;             // Console writer for the results.
+    
+    if(writerConsole(&w))
+    {
+        CompresPrint(&w, cycle);
+        writerClose(&w);
     }
     
-    fprintf(fp, "Polytropic Index:\n");
-    fprintf(fp, "alpha =\t%.3f\t[ ]\n\n", alpha);
+    if(profile->rows > 0 && YesNo("Do you want to display the generated profile? ") && writerConsole(&w))
+    {
+        CompresProfilePrint(&w, profile);
+        writerClose(&w);
+    }
+}
+
+void CompresWrite(const T2CompCycle *cycle, const T2CompProfile *profile)
+{
+    //  Function variables
+    ResultWriter w;             // Buffered writer for the results file.
     
-    fprintf(fp, "\tOutput parameters:\n");
+    //  Set file name as timestamp + Compressor Results
+    if(!writerOpen(&w, "Compressor Results"))
+    {
+        return;
+    }
     
-    //  Profile (Two Temperature columns (K and deg C))
-    fprintf(fp, "P (kPa)\tV (m3)\tT (K)\tT(deg C)\t\tW_V (kW)\tW_S (kW)\n");
-    for(int i = 0; i < 512; ++i)
+    //  Write to file
+    CompresPrint(&w, cycle);
+    if(profile->rows > 0)
     {
-        fprintf(fp, "%f\t", profile.P[i]*0.001);
-        fprintf(fp, "%f\t", profile.V[i]);
-        fprintf(fp, "%f\t", profile.T[i]);
-        fprintf(fp, "%f\t\t", profile.T[i] - 273.15);
-        fprintf(fp, "%f\t", profile.W_V[i]*0.001);
-        fprintf(fp, "%f\n", profile.W_S[i]*0.001);
+        CompresProfilePrint(&w, profile);
     }
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
-void CompresSwitch(int mode, double P1, double P2, double Vc, double V1, double V2, double T1, double T2, double n, double R, double alpha, T2CompProfile profile)
+void CompresSwitch(int mode, const T2CompCycle *cycle, const T2CompProfile *profile)
 {
-    int control = 0;
-    control = 1;
-    while(control == 1)
+    if(mode == 1 && YesNo("Do you want to display the results? "))
     {
-        char input[maxstrlen];
-        
-        if(mode == 1){
-            printf("Do you want to display the results? ");
-        }
-        if(mode == 2){
-            printf("Do you want to save results to file? ");
+        CompresDisplay(cycle, profile);
+    }
+    if(mode == 2 && YesNo("Do you want to save results to file? "))
+    {
+        CompresWrite(cycle, profile);
+    }
+}
+
+void CompresSweepDisplay(int nc, int nr, const T2CompCycle *sweep)
+{
+    printf("_Clearance_and_Pressure_Ratio_Sweep_\n");
+    printf("Volumetric efficiency (%%):\n");
+    printf("c \\ P2/P1");
+    for(int j = 0; j < nr; ++j)
+    {
+        printf("\t%.3f", sweep[j].P2/sweep[j].P1);
+    }
+    printf("\n");
+    for(int i = 0; i < nc; ++i)
+    {
+        printf("%.4f", sweep[i*nr].c);
+        for(int j = 0; j < nr; ++j)
+        {
+            printf("\t%.2f", 100*sweep[i*nr + j].etaV);
         }
-        fgets(input, sizeof(input), stdin);
-        switch(input[0])
+        printf("\n");
+    }
+    printf("\n");
+    
+    // The discharge temperature and the work per mole delivered depend only on the pressure ratio
+    printf("P2/P1\tT2 (deg C)\tw (kJ/mol)\n");
+    for(int j = 0; j < nr; ++j)
+    {
+        const T2CompCycle *cy = NULL;
+        
+        for(int i = 0; i < nc && cy == NULL; ++i)
         {
-            case '1':
-            case 'T':
-            case 'Y':
-            case 't':
-            case 'y':
-                if(mode == 1){
-                    CompresDisplay(P1, P2, Vc, V1, V2, T1, T2, n, R, alpha, profile);
-                }
-                if(mode == 2){
-                    CompresWrite(P1, P2, Vc, V1, V2, T1, T2, n, R, alpha, profile);
-                }
-                control = 0;
-                break;
-            case '0':
-            case 'F':
-            case 'N':
-            case 'f':
-            case 'n':
-                control = 0;
-                break;
-            default:
-                printf("Input not recognised\n");
-                break;
+            cy = (sweep[i*nr + j].nDel > 0.0) ? &sweep[i*nr + j] : NULL;
+        }
+        if(cy == NULL){
+            printf("%.3f\t-\t-\n", sweep[j].P2/sweep[j].P1);
+        }else{
+            printf("%.3f\t%.3f\t%.4f\n", cy->P2/cy->P1, cy->T2 - 273.15, cy->Wnet/cy->nDel*0.001);
         }
     }
+    fflush(stdout);
 }
 
 /// MARK: PSEUDO-MAIN FUNCTION
@@ -416,22 +554,17 @@ void Compressor(void)
         char methodinput[maxstrlen];    // Variable used to store character input.
         int method = 0;                 // Variable used to control subroutine behaviour.
         int whilmethod = 0;             // Variable used to control user input.
-        int elems = 0;                  // Variable used to store the total number of elements used in the data struct.
-        
-        elems = 5*512;
+        int rows = 0;                   // Number of rows in the indicator diagram.
+        int nc = 0;                     // Number of clearance fractions in the sweep.
+        int nr = 0;                     // Number of pressure ratios in the sweep.
+        double clo = 0.0;               // First clearance fraction in the sweep.
+        double chi = 0.0;               // Last clearance fraction in the sweep.
+        double rlo = 0.0;               // First pressure ratio in the sweep.
+        double rhi = 0.0;               // Last pressure ratio in the sweep.
         
-        T2CompProfile *profile = calloc(elems, sizeof(double));  // Struct used to store the process profile for a reciprocating compressor.
-        double T2 = 0.0;                // Final compressor temperature.
-        
-        double P1 = 0.0;                // Initial system pressure.
-        double P2 = 0.0;                // Final system pressure.
-        double Vc = 0.0;                // Clearance volume.
-        double V1 = 0.0;                // Maximum compressor volume.
-        double V2 = 0.0;                // Compressor volume when discharge starts.
-        double T1 = 0.0;                // Initial compressor temperature.
-        double n = 0.0;                 // Moles of component in system.
-        double R = 0.0;                 // Gas constant.
-        double alpha = 0.0;             // Polytropic index.
+        T2CompCycle cycle = {0};        // Struct used to store the states and stage work of one compressor cycle.
+        T2CompProfile profile = {0};    // Struct used to store the process profile for a reciprocating compressor.
+        T2CompCycle *sweep = NULL;      // Cycles of the clearance and pressure ratio sweep.
         
             //  Variables for timing function
         struct timespec start, end;
@@ -473,18 +606,68 @@ void Compressor(void)
         }
         if(method == 1||method == 2){
             //  Collecting data
-            CompressorVariable(method, &P1, &P2, &Vc, &V1, &T1, &T2, &n, &R, &alpha);
-            if(alpha == 1.0){
-                method = 1;
+            CompressorVariable(method, &cycle);
+            if(cycle.alpha == 1.0){
+                cycle.method = 1;
+            }
+            
+            whilmethod = 1;
+            while(whilmethod == 1)
+            {
+                rows = (int)inputDouble(0, 0, "number of rows in the indicator diagram", "[ ]");
+                if(rows >= CompMinRows){
+                    whilmethod = 0;
+                }else{
+                    printf("The indicator diagram needs at least %d rows.\n", CompMinRows);
+                }
+            }
+            
+            if(YesNo("Do you want to sweep the clearance fraction and pressure ratio? "))
+            {
+                clo = inputDouble(1, 0, "first clearance fraction", "[ ]");
+                chi = inputDouble(1, 0, "last clearance fraction", "[ ]");
+                nc = (int)inputDouble(0, 0, "number of clearance fractions", "[ ]");
+                whilmethod = 1;
+                while(whilmethod == 1)
+                {
+                    rlo = inputDouble(0, 0, "first pressure ratio", "[ ]");
+                    rhi = inputDouble(0, 0, "last pressure ratio", "[ ]");
+                    if(rlo > 1 && rhi > 1){
+                        whilmethod = 0;
+                    }else{
+                        // P2 > P1 for every cycle of the sweep, as for a single cycle
+                        printf("Expansion process has been stated, please re-enter pressure ratios greater than 1.\n");
+                    }
+                }
+                nr = (int)inputDouble(0, 0, "number of pressure ratios", "[ ]");
+                sweep = calloc((size_t)nc*nr, sizeof(T2CompCycle));
+                if(sweep == NULL)
+                {
+                    printf("Memory could not be allocated for the sweep.\n");
+                    nc = 0;
+                    nr = 0;
+                }
+            }
+            
+            profile = CompProfileAlloc(rows);
+            if(profile.P == NULL || profile.V == NULL || profile.T == NULL || profile.W_V == NULL || profile.W_S == NULL)
+            {
+                printf("Memory could not be allocated for the indicator diagram.\n");
+                CompProfileFree(&profile);
             }
             
             //  Data Manipulation
             clock_getres(CLOCK_MONOTONIC, &start);
             clock_gettime(CLOCK_MONOTONIC, &start);
             
-            *profile = CompressorProfile(method, P1, P2, Vc, &V1, &V2, T1, n, R, alpha);
-            
-            T2 = profile->T[505];
+            if(CompressorCycle(&cycle) == 0 || CompressorProfile(&cycle, &profile) == 0)
+            {
+                CompProfileFree(&profile);
+            }
+            if(sweep != NULL)
+            {
+                CompressorSweep(&cycle, clo, chi, nc, rlo, rhi, nr, sweep);
+            }
             
             clock_getres(CLOCK_MONOTONIC, &end);
             clock_gettime(CLOCK_MONOTONIC, &end);
@@ -494,16 +677,21 @@ void Compressor(void)
             printf("Calculations completed in %.6f seconds.\n", elapsed);
             
             //  Displaying results
-            CompresSwitch(1, P1, P2, Vc, V1, V2, T1, T2, n, R, alpha, *profile);
+            CompresSwitch(1, &cycle, &profile);
+            if(sweep != NULL)
+            {
+                CompresSweepDisplay(nc, nr, sweep);
+            }
             
             //  Writing to File
-            CompresSwitch(2, P1, P2, Vc, V1, V2, T1, T2, n, R, alpha, *profile);
+            CompresSwitch(2, &cycle, &profile);
             
         }
         //  Continue function
         whilmain = Continue(whilmain);
     quit:
-        free(profile);
+        CompProfileFree(&profile);
+        free(sweep);
     }
     fflush(stdout);
 }
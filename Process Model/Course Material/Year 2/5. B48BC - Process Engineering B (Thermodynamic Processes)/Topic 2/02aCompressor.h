@@ -22,12 +22,41 @@
 #ifndef CompStruct
 #define CompStruct
 
+#define CompProfileRows 512 // Default number of rows generated for an indicator diagram.
+#define CompStages 4        // Compression, discharge, re-expansion and intake.
+#define CompMinRows 5       // One row for each stage and the row closing the cycle.
+
+/// This struct is used to describe one cycle of a reciprocating compressor with a clearance volume. States 1 to 4 are the start of compression, the start of discharge, the end of discharge and the start of intake.
+typedef struct CompCycle{
+    int method;                 // (1) = Isothermal. (2) = Polytropic.
+    double P1;                  // Suction pressure (Pa).
+    double P2;                  // Discharge pressure (Pa).
+    double T1;                  // Suction temperature (K).
+    double n;                   // Moles of gas in the cylinder at the start of compression (mol/ s).
+    double R;                   // Gas constant (J/ mol. K).
+    double alpha;               // Polytropic index. One for isothermal compression.
+    double Vc;                  // Clearance volume (m3).
+    double V1;                  // Cylinder volume at the start of compression (m3).
+    double V2;                  // Cylinder volume when discharge starts (m3).
+    double V4;                  // Cylinder volume when intake starts, after the clearance gas has re-expanded (m3).
+    double T2;                  // Discharge temperature (K).
+    double Vs;                  // Swept volume, V1 - Vc (m3).
+    double c;                   // Clearance fraction, Vc/Vs ([ ]).
+    double etaV;                // Volumetric efficiency, (V1 - V4)/Vs ([ ]).
+    double nDel;                // Gas delivered per cycle (mol/ s).
+    double W_V[CompStages];     // Volume work done on the gas in each stage (W).
+    double W_S[CompStages];     // Shaft work, the integral of V dP, in each stage (W).
+    double Wnet;                // Indicated work of the cycle (W).
+} T2CompCycle;
+
 typedef struct CompProfile{
-    double P[512]; // System pressure
-    double V[512]; // System volume
-    double T[512]; // System temperature
-    double W_V[512]; // Volume work
-    double W_S[512]; // Shaft work
+    int rows;                   // Number of rows in the profile.
+    int start[CompStages + 1];  // First row of each stage. The last entry is the row closing the cycle.
+    double *P;                  // System pressure (Pa).
+    double *V;                  // System volume (m3).
+    double *T;                  // System temperature (K).
+    double *W_V;                // Cumulative volume work done on the gas (W).
+    double *W_S;                // Cumulative shaft work (W).
 } T2CompProfile;
 
 #endif /* CompStruct */
@@ -37,34 +66,41 @@ typedef struct CompProfile{
 
 /// This subroutine is used to collect the data required to perform the calculations for a reciprocating compressor undergoing an isothermal or polytropic process.
 /// @param method Integer variable used to determine which equation should be used and hence the variables required. (1) = Isothermal equation. (2) = Polytropic equation (Pressure-Volume statement). 
-/// @param P1 Initial system pressure. (kPa).
-/// @param P2 Final system pressure. (kPa).
-/// @param Vc Clearance volume (m3).
-/// @param V1 Initial system volume. (m3).
-/// @param T1 Initial system temperature. For the isothermal equation, this variable is the constant temperature. (deg C).
-/// @param T2 Final system temperature. (deg C).
-/// @param n Moles of component. (kmol/ s).
-/// @param R Specific gas constant. (J/ mol. K).
-/// @param alpha Polytropic index.
-void CompressorVariable(int method, double *P1, double *P2, double *Vc, double *V1, double *T1, double *T2, double *n, double *R, double *alpha);
+/// @param cycle Struct where the suction and discharge conditions, gas properties and clearance volume should be stored.
+void CompressorVariable(int method, T2CompCycle *cycle);
 
 #endif /* _2aCompressor_h */
 
 #ifndef CompressorProfile_h
 #define CompressorProfile_h
 
-/// This subroutine is used to generate the profile for one sweep of the compressor. For this subroutine to operate, it requires "IdealGasLaw.h" and "Isobaric.h". It also requires "Isothermal.h" or "Polytropic.h" to function dependent on the value of 'int method'.
-/// @param method Integer variable used to determine which equation should be used and hence the variables required. (1) = Isothermal equation. (2) = Polytropic equation (Pressure-Volume statement). 
-/// @param P1 Initial system pressure. (Pa).
-/// @param P2 Final system pressure. (Pa).
-/// @param Vc Clearance volume (m3).
-/// @param V1 Initial system volume. (m3).
-/// @param V2 System volume after compression. (m3).
-/// @param T1 Initial system temperature. For the isothermal equation, this variable is the constant temperature. (K).
-/// @param n Moles of component. (mol/ s).
-/// @param R Specific gas constant. (J/ mol. K).
-/// @param alpha Polytropic index.
-T2CompProfile CompressorProfile(int method, double P1, double P2, double Vc, double *V1, double *V2, double T1, double n, double R, double alpha);
+/// This subroutine is used to complete the four states of the cycle and the work of each stage from their analytic integrals. The clearance gas re-expands along the same path as the compression, returning to the suction temperature. This function returns 0 if the clearance gas does not re-expand below the cylinder volume, in which case no gas is delivered and the work is left at zero.
+/// @param cycle Cycle with "method", "P1", "P2", "T1", "n", "R", "alpha", "Vc" and "V1" set.
+int CompressorCycle(T2CompCycle *cycle);
+
+/// This subroutine is used to allocate a zeroed indicator diagram with the given number of rows.
+/// @param rows Number of rows in the profile.
+T2CompProfile CompProfileAlloc(int rows);
+
+/// This subroutine is used to release the arrays held by an indicator diagram.
+/// @param profile Indicator diagram from "CompProfileAlloc(...)".
+void CompProfileFree(T2CompProfile *profile);
+
+/// This subroutine is used to fill an indicator diagram of any resolution for one cycle, starting and ending at the start of compression. Compression and re-expansion are spaced evenly in pressure and take three eighths of the rows each; discharge and intake are spaced evenly in volume. Every row is evaluated in closed form, so large profiles are split across the worker threads. This function returns 0 if the profile has fewer than "CompMinRows" rows or the cycle delivers no gas.
+/// @param cycle Cycle from "CompressorCycle(...)".
+/// @param profile Indicator diagram with its arrays allocated for "profile->rows" rows.
+int CompressorProfile(const T2CompCycle *cycle, T2CompProfile *profile);
+
+/// This subroutine is used to evaluate a grid of cycles over clearance fraction and pressure ratio. The swept volume and suction state of "base" are kept, so the gas in the cylinder scales with the cylinder volume. Results are stored row by row, one row of pressure ratios for each clearance fraction.
+/// @param base Cycle from "CompressorCycle(...)".
+/// @param clo First clearance fraction ([ ]).
+/// @param chi Last clearance fraction ([ ]).
+/// @param nc Number of clearance fractions.
+/// @param rlo First pressure ratio ([ ]).
+/// @param rhi Last pressure ratio ([ ]).
+/// @param nr Number of pressure ratios.
+/// @param out Array of "nc*nr" cycles where the results should be stored.
+void CompressorSweep(const T2CompCycle *base, double clo, double chi, int nc, double rlo, double rhi, int nr, T2CompCycle *out);
 
 #endif /* CompressorProfile_h */
 
@@ -72,18 +108,9 @@ T2CompProfile CompressorProfile(int method, double P1, double P2, double Vc, dou
 #define CompresDisp_h
 
 /// This subroutine is used to output the collected data and generated process simulation to the user console.
-/// @param P1 Initial system pressure. (Pa).
-/// @param P2 Final system pressure. (Pa).
-/// @param Vc Clearance volume (m3).
-/// @param V1 Initial system volume. (m3).
-/// @param V2 System volume after compression. (m3).
-/// @param T1 Initial system temperature. For the isothermal equation, this variable is the constant temperature. (K).
-/// @param T2 Final system temperature. (K).
-/// @param n Moles of component. (mol/ s).
-/// @param R Specific gas constant. (J/ mol. K).
-/// @param alpha Polytropic index.
+/// @param cycle Compressor cycle.
 /// @param profile Compressor Profile.
-void CompresDisplay(double P1, double P2, double Vc, double V1, double V2, double T1, double T2, double n, double R, double alpha, T2CompProfile profile);
+void CompresDisplay(const T2CompCycle *cycle, const T2CompProfile *profile);
 
 #endif /* CompresDisp_h */
 
@@ -91,32 +118,20 @@ void CompresDisplay(double P1, double P2, double Vc, double V1, double V2, doubl
 #define CompresWrite_h
 
 /// This subroutine is used to write the collected data and generated process simulation to a .txt file.
-/// @param P1 Initial system pressure. (Pa).
-/// @param P2 Final system pressure. (Pa).
-/// @param Vc Clearance volume (m3).
-/// @param V1 Initial system volume. (m3).
-/// @param V2 System volume after compression. (m3).
-/// @param T1 Initial system temperature. For the isothermal equation, this variable is the constant temperature. (K).
-/// @param T2 Final system temperature. (K).
-/// @param n Moles of component. (mol/ s).
-/// @param R Specific gas constant. (J/ mol. K).
-/// @param alpha Polytropic index.
+/// @param cycle Compressor cycle.
 /// @param profile Compressor Profile.
-void CompresWrite(double P1, double P2, double Vc, double V1, double V2, double T1, double T2, double n, double R, double alpha, T2CompProfile profile);
+void CompresWrite(const T2CompCycle *cycle, const T2CompProfile *profile);
 
 /// Subroutine to ask the user if they would like to either display the results on the console or save the results of this program to a file.
 /// @param mode Integer used to control whether this function will access the display (1) or write (2) function.
-/// @param P1 Initial system pressure. (Pa).
-/// @param P2 Final system pressure. (Pa).
-/// @param Vc Clearance volume (m3).
-/// @param V1 Initial system volume. (m3).
-/// @param V2 System volume after compression. (m3).
-/// @param T1 Initial system temperature. For the isothermal equation, this variable is the constant temperature. (K).
-/// @param T2 Final system temperature. (K).
-/// @param n Moles of component. (mol/ s).
-/// @param R Specific gas constant. (J/ mol. K).
-/// @param alpha Polytropic index.
+/// @param cycle Compressor cycle.
 /// @param profile Compressor Profile.
-void CompresSwitch(int mode, double P1, double P2, double Vc, double V1, double V2, double T1, double T2, double n, double R, double alpha, T2CompProfile profile);
+void CompresSwitch(int mode, const T2CompCycle *cycle, const T2CompProfile *profile);
+
+/// This subroutine is used to output the volumetric efficiency, discharge temperature and specific indicated work of a clearance and pressure ratio sweep to the user console.
+/// @param nc Number of clearance fractions.
+/// @param nr Number of pressure ratios.
+/// @param sweep Cycles from "CompressorSweep(...)".
+void CompresSweepDisplay(int nc, int nr, const T2CompCycle *sweep);
 
 #endif /* CompresWrite_h */
@@ -29,6 +29,7 @@
 
 // Custom header files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BC_T2.h"
 #include "02bPolyShaftWork.h"
 
@@ -141,83 +142,44 @@ void PolyShaftDisplay(double n, double R, double T1, double P1, double P2, doubl
 void PolyShaftWrite(double n, double R, double T1, double P1, double P2, double alpha, double W_S)
 {
     //  Function variables
-    char filename[maxstrlen];
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;
     //  Set file name as timestamp + Polytropic Shaft Work Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Polytropic Shaft Work Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, "Polytropic Shaft Work Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
-    fprintf(fp, "_Polytropic_Shaft_Work_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Initial System Pressure:\n");
-    fprintf(fp, "P_1 =\t%.3f\tkPa\n", P1*0.001);
-    fprintf(fp, "Final System Pressure:\n");
-    fprintf(fp, "P_2 =\t%.3f\tkPa\n", P2*0.001);
-    
-    fprintf(fp, "Initial System Temperature:\n");
-    fprintf(fp, "T_1 =\t%.3f\tdeg C\n", T1 - 273.15);
-    
-    fprintf(fp, "Molar flowrate of component i:\n");
-    fprintf(fp, "n =\t%.3f\tkmol/s\n", n*0.001);
+    writerPrintf(&w, "_Polytropic_Shaft_Work_Results_\n");
+    writerPrintf(&w, "\tInput parameters:\n");
+    writerPrintf(&w, "Initial System Pressure:\n");
+    writerPrintf(&w, "P_1 =\t%.3f\tkPa\n", P1*0.001);
+    writerPrintf(&w, "Final System Pressure:\n");
+    writerPrintf(&w, "P_2 =\t%.3f\tkPa\n", P2*0.001);
+    
+    writerPrintf(&w, "Initial System Temperature:\n");
+    writerPrintf(&w, "T_1 =\t%.3f\tdeg C\n", T1 - 273.15);
+    
+    writerPrintf(&w, "Molar flowrate of component i:\n");
+    writerPrintf(&w, "n =\t%.3f\tkmol/s\n", n*0.001);
     if( (fabs( R - (8.3145) ) < 0.001 && ((R >= 8.3140) || (R < 8.31449 && R < 8.31451))) ){
-        fprintf(fp, "Universal Gas Constant:\n");
-        fprintf(fp, "R =\t%.4f\tJ/(mol. K)\n\n", R);
+        writerPrintf(&w, "Universal Gas Constant:\n");
+        writerPrintf(&w, "R =\t%.4f\tJ/(mol. K)\n\n", R);
     }else{
-        fprintf(fp, "Specific Gas Constant:\n");
-        fprintf(fp, "R =\t%.4f\tJ/(mol. K)\n\n", R);
+        writerPrintf(&w, "Specific Gas Constant:\n");
+        writerPrintf(&w, "R =\t%.4f\tJ/(mol. K)\n\n", R);
     }
     
-    fprintf(fp, "Polytropic Index:\n");
-    fprintf(fp, "alpha =\t%.3f\t[ ]\n\n", alpha);
+    writerPrintf(&w, "Polytropic Index:\n");
+    writerPrintf(&w, "alpha =\t%.3f\t[ ]\n\n", alpha);
     
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "Shaft Work:\n");
-    fprintf(fp, "W_S =\t%.3f\tkW\n", W_S*0.001);
+    writerPrintf(&w, "\tOutput parameters:\n");
+    writerPrintf(&w, "Shaft Work:\n");
+    writerPrintf(&w, "W_S =\t%.3f\tkW\n", W_S*0.001);
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void PolyShaftWriteSwitch(double n, double R, double T1, double P1, double P2, double alpha, double W_S)
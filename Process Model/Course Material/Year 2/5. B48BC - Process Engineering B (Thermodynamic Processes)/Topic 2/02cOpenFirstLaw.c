@@ -29,6 +29,7 @@
 
 //Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BC_T2.h"
 #include "02cOpenFirstLaw.h"
 
@@ -156,50 +157,13 @@ void OpenFirstLawDisplay(T2StateEnergy state1,T2StateEnergy state2, double q, do
 void OpenFirstLawWrite(T2StateEnergy state1,T2StateEnergy state2, double q, double w_s, double sysstate)
 {
     //  Function variables
-    char filename[maxstrlen];
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;
     //  Set file name as timestamp + First Law Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " First Law Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, "First Law Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
     double u1 = 0.0;    // Initial fluid velocity.
@@ -210,41 +174,39 @@ void OpenFirstLawWrite(T2StateEnergy state1,T2StateEnergy state2, double q, doub
     OpenInitialValue(state1, &u1, &z1);
     OpenInitialValue(state2, &u2, &z2);
     
-    fprintf(fp, "_First_Law_Applied_to_Open_Systems_\n");
-    fprintf(fp, "Assuming the fluid is incompressible. \n");
-    fprintf(fp, "g =\t9.80665\tm/s2\n\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Initial fluid enthalpy:\n");
-    fprintf(fp, "h1 =\t%.3f\tkJ/kmol\n", 0.001*state1.enthalpy);
-    fprintf(fp, "Final fluid enthalpy:\n");
-    fprintf(fp, "h2 =\t%.3f\tkJ/kmol\n", 0.001*state2.enthalpy);
-    fprintf(fp, "Initial fluid velocity:\n");
-    fprintf(fp, "u1 =\t%.3f\tm/s\n", u1);
-    fprintf(fp, "Final fluid velocity:\n");
-    fprintf(fp, "u2 =\t%.3f\tm/s\n", u2);
-    fprintf(fp, "Initial fluid height:\n");
-    fprintf(fp, "z1 =\t%.3f\tm\n", z1);
-    fprintf(fp, "Final fluid height:\n");
-    fprintf(fp, "z2 =\t%.3f\tm\n\n", z2);
-    
-    fprintf(fp, "Molar process heat:\n");
-    fprintf(fp, "q =\t%.3f\tkJ/kmol\n", q*0.001);
-    fprintf(fp, "Molar shaft work:\n");
-    fprintf(fp, "w =\t%.3f\tkJ/kmol\n\n", w_s*0.001);
-    
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "System state =\t%.3f\tkJ/kmol\n", sysstate*0.001);
+    writerPrintf(&w, "_First_Law_Applied_to_Open_Systems_\n");
+    writerPrintf(&w, "Assuming the fluid is incompressible. \n");
+    writerPrintf(&w, "g =\t9.80665\tm/s2\n\n");
+    writerPrintf(&w, "\tInput parameters:\n");
+    writerPrintf(&w, "Initial fluid enthalpy:\n");
+    writerPrintf(&w, "h1 =\t%.3f\tkJ/kmol\n", 0.001*state1.enthalpy);
+    writerPrintf(&w, "Final fluid enthalpy:\n");
+    writerPrintf(&w, "h2 =\t%.3f\tkJ/kmol\n", 0.001*state2.enthalpy);
+    writerPrintf(&w, "Initial fluid velocity:\n");
+    writerPrintf(&w, "u1 =\t%.3f\tm/s\n", u1);
+    writerPrintf(&w, "Final fluid velocity:\n");
+    writerPrintf(&w, "u2 =\t%.3f\tm/s\n", u2);
+    writerPrintf(&w, "Initial fluid height:\n");
+    writerPrintf(&w, "z1 =\t%.3f\tm\n", z1);
+    writerPrintf(&w, "Final fluid height:\n");
+    writerPrintf(&w, "z2 =\t%.3f\tm\n\n", z2);
+    
+    writerPrintf(&w, "Molar process heat:\n");
+    writerPrintf(&w, "q =\t%.3f\tkJ/kmol\n", q*0.001);
+    writerPrintf(&w, "Molar shaft work:\n");
+    writerPrintf(&w, "w =\t%.3f\tkJ/kmol\n\n", w_s*0.001);
+    
+    writerPrintf(&w, "\tOutput parameters:\n");
+    writerPrintf(&w, "System state =\t%.3f\tkJ/kmol\n", sysstate*0.001);
     
     if(fabs(sysstate) < 0.005){
-        fprintf(fp, "This unit operation is operating at steady-state conditions.\n");
+        writerPrintf(&w, "This unit operation is operating at steady-state conditions.\n");
     }else{
-        fprintf(fp, "This unit operation is operating at unsteady-state conditions.\n");
+        writerPrintf(&w, "This unit operation is operating at unsteady-state conditions.\n");
     }
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void OpenFirstLawWriteSwitch(T2StateEnergy state1,T2StateEnergy state2, double q, double w_s, double sysstate)
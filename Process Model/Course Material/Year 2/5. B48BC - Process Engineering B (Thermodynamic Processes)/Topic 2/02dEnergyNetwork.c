@@ -0,0 +1,1382 @@
+//
+//  02dEnergyNetwork.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+/// MARK: HEADER DECLARATIONS
+//  Standard header files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//  Custom header files
+#include "System.h"
+#include "ResultWriter.h"
+#include "02dEnergyNetwork.h"
+
+/// MARK: SUBROUTINE DEFINITIONS
+#define maxstrlen 128
+#define g 9.80665
+
+/// This struct is used to store one row of the coupled block while it is eliminated.
+typedef struct EnNetRow{
+    int nnz;            // Number of entries.
+    int cap;            // Allocated entries.
+    int *col;           // Block column of each entry.
+    double *val;        // Value of each entry.
+    double rhs;         // Right hand side.
+} EnNetRow;
+
+/// This struct is used to store the rows of the coupled block that hold a column while it is eliminated.
+typedef struct EnNetList{
+    int n;              // Number of rows.
+    int cap;            // Allocated rows.
+    int *idx;           // Rows holding the column.
+} EnNetList;
+
+/// This struct is used to store a binary heap of rows keyed by their number of entries. Entries are left in place when a row changes and are skipped when taken if the key no longer matches the row.
+typedef struct EnNetHeap{
+    int n;              // Number of entries.
+    int cap;            // Allocated entries.
+    int *key;           // Number of entries in the row when it was added.
+    int *row;           // Row of each entry.
+} EnNetHeap;
+
+/// MARK: VARIABLE INPUT
+T2EnergyNetwork *EnNetVariable(void)
+{
+    T2EnergyNetwork *net = NULL;
+    int nunit = 0;
+    int nstream = 0;
+    
+    nunit = (int)inputDouble(0, 0, "number of units", "[ ]");
+    nstream = (int)inputDouble(0, 0, "number of streams", "[ ]");
+    
+    net = EnNetCreate(nunit, nstream);
+    if(net == NULL)
+    {
+        printf("Memory could not be allocated for the network.\n");
+        return NULL;
+    }
+    
+    for(int k = 0; k < nunit; ++k)
+    {
+        int Qknown = 0;
+        int Wknown = 0;
+        int moles = 0;
+        double Q = 0.0;
+        double W = 0.0;
+        
+        printf("Unit %d:\n", k + 1);
+        Qknown = YesNo("Is the heat duty known? ");
+        if(Qknown)
+        {
+            Q = inputDouble(1, 1, "heat added to the unit", "kW");
+            Q = (Q)*1000;
+        }
+        Wknown = YesNo("Is the shaft work known? ");
+        if(Wknown)
+        {
+            W = inputDouble(1, 1, "shaft work done on the unit", "kW");
+            W = (W)*1000;
+        }
+        moles = YesNo("Are moles conserved across the unit (no reaction)? ");
+        EnNetUnit(net, k, Qknown, Q, Wknown, W, moles);
+    }
+    
+    for(int s = 0; s < nstream; ++s)
+    {
+        int from = 0;
+        int to = 0;
+        int Fknown = 0;
+        double F = 0.0;
+        double h = 0.0;
+        double M = 0.0;
+        double u = 0.0;
+        double z = 0.0;
+        int valid = 0;
+        
+        printf("Stream %d:\n", s + 1);
+        valid = 0;
+        while(valid == 0)
+        {
+            from = (int)inputDouble(1, 0, "unit the stream leaves (0 if it enters the network)", "[ ]");
+            to = (int)inputDouble(1, 0, "unit the stream enters (0 if it leaves the network)", "[ ]");
+            Fknown = YesNo("Is the molar flowrate known? ");
+            if(Fknown)
+            {
+                F = inputDouble(1, 0, "molar flowrate", "mol/s");
+            }
+            h = inputDouble(1, 1, "molar enthalpy", "kJ/kmol");
+            M = inputDouble(0, 0, "molar mass", "g/mol");
+            M = (M)*0.001;
+            u = inputDouble(1, 0, "velocity", "m/s");
+            z = inputDouble(1, 1, "elevation above the datum", "m");
+            
+            valid = EnNetStream(net, s, from - 1, to - 1, Fknown, F, h, M, u, z);
+            if(valid == 0)
+            {
+                printf("A stream must join two different units, or a unit and the boundary, numbered 1 to %d.\n", nunit);
+            }
+        }
+    }
+    
+    return net;
+}
+
+/// MARK: GENERAL CALCULATIONS
+T2EnergyNetwork *EnNetCreate(int nunit, int nstream)
+{
+    T2EnergyNetwork *net = calloc(1, sizeof(T2EnergyNetwork));
+    int neq = 2*nunit;
+    int nmax = nstream + 2*nunit;
+    
+    if(net == NULL)
+    {
+        return NULL;
+    }
+    net->nunit = nunit;
+    net->nstream = nstream;
+    net->unit = calloc(nunit, sizeof(T2NetUnit));
+    net->stream = calloc(nstream, sizeof(T2NetStream));
+    net->adjStart = calloc(nunit + 1, sizeof(int));
+    net->adjStream = calloc(2*nstream, sizeof(int));
+    net->varKind = calloc(nmax, sizeof(int));
+    net->varRef = calloc(nmax, sizeof(int));
+    net->varSolved = calloc(nmax, sizeof(int));
+    net->varBlock = calloc(nmax, sizeof(int));
+    net->streamVar = calloc(nstream, sizeof(int));
+    net->unitQVar = calloc(nunit, sizeof(int));
+    net->unitWVar = calloc(nunit, sizeof(int));
+    net->orderEq = calloc(neq, sizeof(int));
+    net->orderVar = calloc(neq, sizeof(int));
+    net->blockEq = calloc(neq, sizeof(int));
+    net->blockVar = calloc(nmax, sizeof(int));
+    net->blockStart = calloc(neq + 1, sizeof(int));
+    net->blockVarStart = calloc(neq + 1, sizeof(int));
+    net->count = calloc(neq, sizeof(int));
+    net->queue = calloc(2*neq, sizeof(int));
+    net->eqDirty = calloc(neq, sizeof(char));
+    net->dirty = calloc(neq, sizeof(int));
+    if(net->unit == NULL || net->stream == NULL || net->adjStart == NULL || net->adjStream == NULL || net->varKind == NULL || net->varRef == NULL || net->varSolved == NULL || net->varBlock == NULL || net->streamVar == NULL || net->unitQVar == NULL || net->unitWVar == NULL || net->orderEq == NULL || net->orderVar == NULL || net->blockEq == NULL || net->blockVar == NULL || net->blockStart == NULL || net->blockVarStart == NULL || net->count == NULL || net->queue == NULL || net->eqDirty == NULL || net->dirty == NULL)
+    {
+        EnNetFree(net);
+        return NULL;
+    }
+    
+    for(int k = 0; k < nunit; ++k)
+    {
+        net->unit[k].Qknown = 1;
+        net->unit[k].Wknown = 1;
+        net->unit[k].moles = 1;
+    }
+    for(int s = 0; s < nstream; ++s)
+    {
+        net->stream[s].from = EnNetBoundary;
+        net->stream[s].to = EnNetBoundary;
+        net->stream[s].Fknown = 1;
+    }
+    net->rebuild = 1;
+    
+    return net;
+}
+
+void EnNetFree(T2EnergyNetwork *net)
+{
+    if(net == NULL)
+    {
+        return;
+    }
+    free(net->unit);
+    free(net->stream);
+    free(net->adjStart);
+    free(net->adjStream);
+    free(net->varKind);
+    free(net->varRef);
+    free(net->varSolved);
+    free(net->varBlock);
+    free(net->streamVar);
+    free(net->unitQVar);
+    free(net->unitWVar);
+    free(net->orderEq);
+    free(net->orderVar);
+    free(net->blockEq);
+    free(net->blockVar);
+    free(net->blockStart);
+    free(net->blockVarStart);
+    free(net->count);
+    free(net->queue);
+    free(net->eqDirty);
+    free(net->dirty);
+    free(net);
+}
+
+int EnNetStream(T2EnergyNetwork *net, int s, int from, int to, int Fknown, double F, double h, double M, double u, double z)
+{
+    T2NetStream *st = &net->stream[s];
+    
+    if(from < EnNetBoundary || from >= net->nunit || to < EnNetBoundary || to >= net->nunit || from == to)
+    {
+        return 0;
+    }
+    st->from = from;
+    st->to = to;
+    st->Fknown = Fknown;
+    st->F = F;
+    st->h = h;
+    st->M = M;
+    st->u = u;
+    st->z = z;
+    net->rebuild = 1;
+    
+    return 1;
+}
+
+void EnNetUnit(T2EnergyNetwork *net, int k, int Qknown, double Q, int Wknown, double W, int moles)
+{
+    T2NetUnit *un = &net->unit[k];
+    
+    un->Qknown = Qknown;
+    un->Q = Q;
+    un->Wknown = Wknown;
+    un->W = W;
+    un->moles = moles;
+    net->rebuild = 1;
+}
+
+double EnNetStreamEnergy(const T2NetStream *st)
+{
+    return st->h + st->M*(0.5*st->u*st->u + g*st->z);
+}
+
+/// This subroutine is used to mark a balance to be revisited on the next solve.
+static void EnNetMark(T2EnergyNetwork *net, int eq)
+{
+    if(net->eqDirty[eq] == 0)
+    {
+        net->eqDirty[eq] = 1;
+        net->dirty[net->ndirty] = eq;
+        ++net->ndirty;
+    }
+}
+
+/// This subroutine is used to mark the balances of a unit to be revisited on the next solve.
+/// @param net Energy balance network.
+/// @param k Unit index, or "EnNetBoundary".
+/// @param mole Set when the molar balance should be marked as well as the energy balance.
+static void EnNetMarkUnit(T2EnergyNetwork *net, int k, int mole)
+{
+    if(k == EnNetBoundary)
+    {
+        return;
+    }
+    if(mole && net->unit[k].moles)
+    {
+        EnNetMark(net, 2*k);
+    }
+    EnNetMark(net, 2*k + 1);
+}
+
+void EnNetSetFlow(T2EnergyNetwork *net, int s, double F)
+{
+    net->stream[s].F = F;
+    EnNetMarkUnit(net, net->stream[s].from, 1);
+    EnNetMarkUnit(net, net->stream[s].to, 1);
+}
+
+void EnNetSetState(T2EnergyNetwork *net, int s, double h, double u, double z)
+{
+    net->stream[s].h = h;
+    net->stream[s].u = u;
+    net->stream[s].z = z;
+    EnNetMarkUnit(net, net->stream[s].from, 0);
+    EnNetMarkUnit(net, net->stream[s].to, 0);
+}
+
+void EnNetSetDuty(T2EnergyNetwork *net, int k, double Q, double W)
+{
+    net->unit[k].Q = Q;
+    net->unit[k].W = W;
+    EnNetMarkUnit(net, k, 0);
+}
+
+/// This subroutine is used to find the value of an unknown.
+static double *EnNetValue(T2EnergyNetwork *net, int var)
+{
+    int ref = net->varRef[var];
+    
+    switch(net->varKind[var])
+    {
+        case 0:
+            return &net->stream[ref].F;
+        case 1:
+            return &net->unit[ref].Q;
+        default:
+            return &net->unit[ref].W;
+    }
+}
+
+/// This subroutine is used to find the balances an unknown appears in. This function returns the number of balances.
+/// @param net Energy balance network.
+/// @param var Unknown.
+/// @param eq Array where the balances should be stored (at least four).
+static int EnNetVarEquations(const T2EnergyNetwork *net, int var, int *eq)
+{
+    int n = 0;
+    int ref = net->varRef[var];
+    
+    if(net->varKind[var] == 0){
+        int end[2] = {net->stream[ref].from, net->stream[ref].to};
+        
+        for(int i = 0; i < 2; ++i)
+        {
+            if(end[i] == EnNetBoundary)
+            {
+                continue;
+            }
+            if(net->unit[end[i]].moles)
+            {
+                eq[n] = 2*end[i];
+                ++n;
+            }
+            eq[n] = 2*end[i] + 1;
+            ++n;
+        }
+    }else{
+        eq[n] = 2*ref + 1;
+        ++n;
+    }
+    
+    return n;
+}
+
+/// This subroutine is used to mark every balance an unknown appears in.
+static void EnNetMarkVar(T2EnergyNetwork *net, int var)
+{
+    int eq[4];
+    int n = EnNetVarEquations(net, var, eq);
+    
+    for(int i = 0; i < n; ++i)
+    {
+        EnNetMark(net, eq[i]);
+    }
+}
+
+/// This subroutine is used to evaluate a balance at the current values. This function returns in minus out, plus heat and work for the energy balance.
+/// @param net Energy balance network.
+/// @param eq Balance.
+/// @param scale Variable where the sum of the magnitudes of the terms should be stored, or NULL.
+static double EnNetResidual(const T2EnergyNetwork *net, int eq, double *scale)
+{
+    int k = eq/2;
+    int energy = eq%2;
+    double r = 0.0;
+    double sum = 0.0;
+    
+    for(int i = net->adjStart[k]; i < net->adjStart[k + 1]; ++i)
+    {
+        const T2NetStream *st = &net->stream[net->adjStream[i]];
+        double term = energy ? st->F*EnNetStreamEnergy(st) : st->F;
+        
+        r += (st->to == k) ? term : -term;
+        sum += fabs(term);
+    }
+    if(energy)
+    {
+        r += net->unit[k].Q + net->unit[k].W;
+        sum += fabs(net->unit[k].Q) + fabs(net->unit[k].W);
+    }
+    if(scale != NULL)
+    {
+        *scale = sum;
+    }
+    
+    return r;
+}
+
+/// This subroutine is used to find the coefficient of an unknown in a balance.
+static double EnNetCoefficient(const T2EnergyNetwork *net, int eq, int var)
+{
+    int k = eq/2;
+    int ref = net->varRef[var];
+    
+    if(net->varKind[var] == 0)
+    {
+        const T2NetStream *st = &net->stream[ref];
+        double c = (double)(st->to == k) - (double)(st->from == k);
+        
+        return (eq%2) ? c*EnNetStreamEnergy(st) : c;
+    }
+    
+    return (eq%2 && ref == k) ? 1.0 : 0.0;
+}
+
+/// This subroutine is used to find the only undetermined unknown of a balance while the solution order is built.
+static int EnNetFreeVar(const T2EnergyNetwork *net, int eq)
+{
+    int k = eq/2;
+    
+    for(int i = net->adjStart[k]; i < net->adjStart[k + 1]; ++i)
+    {
+        int var = net->streamVar[net->adjStream[i]];
+        
+        if(var >= 0 && net->varSolved[var] == 0)
+        {
+            return var;
+        }
+    }
+    if(eq%2 && net->unitQVar[k] >= 0 && net->varSolved[net->unitQVar[k]] == 0)
+    {
+        return net->unitQVar[k];
+    }
+    if(eq%2 && net->unitWVar[k] >= 0 && net->varSolved[net->unitWVar[k]] == 0)
+    {
+        return net->unitWVar[k];
+    }
+    
+    return -1;
+}
+
+/// This subroutine is used to check that the unknowns a balance takes as known, every unknown outside the coupled block apart from "var", are determined. This function returns 1 if they are and 0 otherwise.
+static int EnNetInputsSolved(const T2EnergyNetwork *net, int eq, int var)
+{
+    int k = eq/2;
+    int qw[2] = {net->unitQVar[k], net->unitWVar[k]};
+    
+    for(int i = net->adjStart[k]; i < net->adjStart[k + 1]; ++i)
+    {
+        int v = net->streamVar[net->adjStream[i]];
+        
+        if(v >= 0 && v != var && net->varBlock[v] < 0 && net->varSolved[v] == 0)
+        {
+            return 0;
+        }
+    }
+    for(int j = 0; eq%2 && j < 2; ++j)
+    {
+        if(qw[j] >= 0 && qw[j] != var && net->varBlock[qw[j]] < 0 && net->varSolved[qw[j]] == 0)
+        {
+            return 0;
+        }
+    }
+    
+    return 1;
+}
+
+/// This subroutine is used to find the balance representing a part of the coupled block, halving the path to it on the way.
+static int EnNetRoot(int *parent, int e)
+{
+    while(parent[e] != e)
+    {
+        parent[e] = parent[parent[e]];
+        e = parent[e];
+    }
+    
+    return e;
+}
+
+/// This subroutine is used to build the solution order. Balances with one undetermined unknown are queued and solved for it, which may leave another balance with one undetermined unknown. The balances and unknowns left when the queue empties form the coupled block, which is split into parts that share no unknowns.
+static void EnNetAnalyse(T2EnergyNetwork *net)
+{
+    int neq = 2*net->nunit;
+    int nq = 0;
+    int eq[4];
+    
+    //  Streams attached to each unit
+    memset(net->adjStart, 0, (net->nunit + 1)*sizeof(int));
+    for(int s = 0; s < net->nstream; ++s)
+    {
+        if(net->stream[s].from != EnNetBoundary)
+        {
+            ++net->adjStart[net->stream[s].from + 1];
+        }
+        if(net->stream[s].to != EnNetBoundary)
+        {
+            ++net->adjStart[net->stream[s].to + 1];
+        }
+    }
+    for(int k = 0; k < net->nunit; ++k)
+    {
+        net->adjStart[k + 1] += net->adjStart[k];
+        net->count[k] = net->adjStart[k];
+    }
+    for(int s = 0; s < net->nstream; ++s)
+    {
+        if(net->stream[s].from != EnNetBoundary)
+        {
+            net->adjStream[net->count[net->stream[s].from]++] = s;
+        }
+        if(net->stream[s].to != EnNetBoundary)
+        {
+            net->adjStream[net->count[net->stream[s].to]++] = s;
+        }
+    }
+    
+    //  Unknowns
+    net->nvar = 0;
+    for(int s = 0; s < net->nstream; ++s)
+    {
+        net->streamVar[s] = -1;
+        if(net->stream[s].Fknown == 0)
+        {
+            net->streamVar[s] = net->nvar;
+            net->varKind[net->nvar] = 0;
+            net->varRef[net->nvar] = s;
+            ++net->nvar;
+        }
+    }
+    for(int k = 0; k < net->nunit; ++k)
+    {
+        net->unitQVar[k] = -1;
+        net->unitWVar[k] = -1;
+        if(net->unit[k].Qknown == 0)
+        {
+            net->unitQVar[k] = net->nvar;
+            net->varKind[net->nvar] = 1;
+            net->varRef[net->nvar] = k;
+            ++net->nvar;
+        }
+        if(net->unit[k].Wknown == 0)
+        {
+            net->unitWVar[k] = net->nvar;
+            net->varKind[net->nvar] = 2;
+            net->varRef[net->nvar] = k;
+            ++net->nvar;
+        }
+    }
+    
+    //  Undetermined unknowns in each balance
+    memset(net->count, 0, neq*sizeof(int));
+    for(int v = 0; v < net->nvar; ++v)
+    {
+        int n = EnNetVarEquations(net, v, eq);
+        
+        for(int i = 0; i < n; ++i)
+        {
+            ++net->count[eq[i]];
+        }
+        net->varSolved[v] = 0;
+        net->varBlock[v] = -1;
+    }
+    
+    //  Propagation order
+    for(int e = 0; e < neq; ++e)
+    {
+        if(net->count[e] == 1 && (e%2 || net->unit[e/2].moles))
+        {
+            net->queue[nq] = e;
+            ++nq;
+        }
+    }
+    net->norder = 0;
+    for(int head = 0; head < nq; ++head)
+    {
+        int e = net->queue[head];
+        int v = 0;
+        int n = 0;
+        
+        if(net->count[e] != 1)
+        {
+            continue;
+        }
+        v = EnNetFreeVar(net, e);
+        net->orderEq[net->norder] = e;
+        net->orderVar[net->norder] = v;
+        ++net->norder;
+        net->varSolved[v] = 1;
+        
+        n = EnNetVarEquations(net, v, eq);
+        for(int i = 0; i < n; ++i)
+        {
+            --net->count[eq[i]];
+            if(net->count[eq[i]] == 1)
+            {
+                net->queue[nq] = eq[i];
+                ++nq;
+            }
+        }
+    }
+    
+    //  Coupled block, split into parts that share no unknowns by joining the balances of each unknown
+    for(int e = 0; e < neq; ++e)
+    {
+        net->queue[e] = e;
+        net->queue[neq + e] = -1;
+    }
+    for(int v = 0; v < net->nvar; ++v)
+    {
+        if(net->varSolved[v] == 0)
+        {
+            int n = EnNetVarEquations(net, v, eq);
+            
+            for(int i = 1; i < n; ++i)
+            {
+                net->queue[EnNetRoot(net->queue, eq[i])] = EnNetRoot(net->queue, eq[0]);
+            }
+        }
+    }
+    net->nblockEq = 0;
+    net->nblock = 0;
+    for(int e = 0; e < neq; ++e)
+    {
+        if(net->count[e] > 0)
+        {
+            int r = EnNetRoot(net->queue, e);
+            
+            if(net->queue[neq + r] < 0)
+            {
+                net->queue[neq + r] = net->nblock;
+                ++net->nblock;
+            }
+            net->count[e] = net->queue[neq + r];
+            ++net->nblockEq;
+        }else{
+            net->count[e] = -1;
+        }
+    }
+    
+    //  Counting sort of the balances and unknowns by part
+    memset(net->blockStart, 0, (net->nblock + 1)*sizeof(int));
+    memset(net->blockVarStart, 0, (net->nblock + 1)*sizeof(int));
+    for(int e = 0; e < neq; ++e)
+    {
+        if(net->count[e] >= 0)
+        {
+            ++net->blockStart[net->count[e] + 1];
+        }
+    }
+    for(int v = 0; v < net->nvar; ++v)
+    {
+        if(net->varSolved[v] == 0)
+        {
+            EnNetVarEquations(net, v, eq);
+            ++net->blockVarStart[net->count[eq[0]] + 1];
+        }
+    }
+    for(int b = 0; b < net->nblock; ++b)
+    {
+        net->blockStart[b + 1] += net->blockStart[b];
+        net->blockVarStart[b + 1] += net->blockVarStart[b];
+        net->queue[neq + b] = net->blockStart[b];
+    }
+    for(int e = 0; e < neq; ++e)
+    {
+        if(net->count[e] >= 0)
+        {
+            net->blockEq[net->queue[neq + net->count[e]]++] = e;
+        }
+    }
+    for(int b = 0; b < net->nblock; ++b)
+    {
+        net->queue[neq + b] = net->blockVarStart[b];
+    }
+    for(int v = 0; v < net->nvar; ++v)
+    {
+        if(net->varSolved[v] == 0)
+        {
+            EnNetVarEquations(net, v, eq);
+            net->varBlock[v] = net->queue[neq + net->count[eq[0]]]++;
+            net->blockVar[net->varBlock[v]] = v;
+        }
+    }
+    net->nblockVar = net->blockVarStart[net->nblock];
+    
+    //  Every balance is revisited after a rebuild
+    for(int e = 0; e < neq; ++e)
+    {
+        if(e%2 || net->unit[e/2].moles)
+        {
+            EnNetMark(net, e);
+        }
+    }
+    net->rebuild = 0;
+}
+
+/// This subroutine is used to add an entry to a row of the coupled block, or to add to the entry already in the column. This function returns 0 if the row could not be enlarged.
+static int EnNetRowAdd(EnNetRow *row, int col, double val)
+{
+    for(int i = 0; i < row->nnz; ++i)
+    {
+        if(row->col[i] == col)
+        {
+            row->val[i] += val;
+            return 1;
+        }
+    }
+    if(row->nnz == row->cap)
+    {
+        int cap = 2*row->cap + 4;
+        int *c = realloc(row->col, cap*sizeof(int));
+        double *v = NULL;
+        
+        if(c == NULL)
+        {
+            return 0;
+        }
+        row->col = c;
+        v = realloc(row->val, cap*sizeof(double));
+        if(v == NULL)
+        {
+            return 0;
+        }
+        row->val = v;
+        row->cap = cap;
+    }
+    row->col[row->nnz] = col;
+    row->val[row->nnz] = val;
+    ++row->nnz;
+    
+    return 1;
+}
+
+/// This subroutine is used to add a row to the list of a column. This function returns 0 if the list could not be enlarged.
+static int EnNetListAdd(EnNetList *list, int i)
+{
+    if(list->n == list->cap)
+    {
+        int cap = 2*list->cap + 4;
+        int *idx = realloc(list->idx, cap*sizeof(int));
+        
+        if(idx == NULL)
+        {
+            return 0;
+        }
+        list->idx = idx;
+        list->cap = cap;
+    }
+    list->idx[list->n] = i;
+    ++list->n;
+    
+    return 1;
+}
+
+/// This subroutine is used to decide whether heap entry a is taken before entry b: fewer entries first, then the lower row.
+static int EnNetHeapBefore(const EnNetHeap *heap, int a, int b)
+{
+    return heap->key[a] < heap->key[b] || (heap->key[a] == heap->key[b] && heap->row[a] < heap->row[b]);
+}
+
+/// This subroutine is used to exchange two heap entries.
+static void EnNetHeapSwap(EnNetHeap *heap, int a, int b)
+{
+    int key = heap->key[a];
+    int row = heap->row[a];
+    
+    heap->key[a] = heap->key[b];
+    heap->row[a] = heap->row[b];
+    heap->key[b] = key;
+    heap->row[b] = row;
+}
+
+/// This subroutine is used to add a row to the heap. This function returns 0 if the heap could not be enlarged.
+static int EnNetHeapPush(EnNetHeap *heap, int key, int row)
+{
+    int i = heap->n;
+    
+    if(heap->n == heap->cap)
+    {
+        int cap = 2*heap->cap + 16;
+        int *k = realloc(heap->key, cap*sizeof(int));
+        int *r = NULL;
+        
+        if(k == NULL)
+        {
+            return 0;
+        }
+        heap->key = k;
+        r = realloc(heap->row, cap*sizeof(int));
+        if(r == NULL)
+        {
+            return 0;
+        }
+        heap->row = r;
+        heap->cap = cap;
+    }
+    heap->key[i] = key;
+    heap->row[i] = row;
+    ++heap->n;
+    while(i > 0 && EnNetHeapBefore(heap, i, (i - 1)/2))
+    {
+        EnNetHeapSwap(heap, i, (i - 1)/2);
+        i = (i - 1)/2;
+    }
+    
+    return 1;
+}
+
+/// This subroutine is used to take the first entry off the heap. This function returns the row of the entry, or -1 if the heap is empty.
+/// @param heap Heap of rows.
+/// @param key Variable where the key of the entry should be stored.
+static int EnNetHeapPop(EnNetHeap *heap, int *key)
+{
+    int row = 0;
+    int i = 0;
+    
+    if(heap->n == 0)
+    {
+        return -1;
+    }
+    row = heap->row[0];
+    *key = heap->key[0];
+    --heap->n;
+    heap->key[0] = heap->key[heap->n];
+    heap->row[0] = heap->row[heap->n];
+    for(;;)
+    {
+        int l = 2*i + 1;
+        int first = i;
+        
+        if(l < heap->n && EnNetHeapBefore(heap, l, first))
+        {
+            first = l;
+        }
+        if(l + 1 < heap->n && EnNetHeapBefore(heap, l + 1, first))
+        {
+            first = l + 1;
+        }
+        if(first == i)
+        {
+            break;
+        }
+        EnNetHeapSwap(heap, i, first);
+        i = first;
+    }
+    
+    return row;
+}
+
+/// This subroutine is used to solve one part of the coupled block by sparse elimination. At each step the remaining row with the fewest entries is taken from a heap as the pivot row, pivoting on its largest entry, to limit fill-in. Only the rows listed under the pivot column are eliminated, so the work follows the entries and fill-in rather than the size of the part. Rows left empty are redundant balances, which are checked for closure, and columns never pivoted are unknowns that cannot be determined. A pivot whose row still holds such a column, directly or through back substitution, or whose balances take an undetermined unknown as known, is left undetermined as well.
+/// @param net Energy balance network.
+/// @param b Part of the coupled block.
+static void EnNetBlockSolve(T2EnergyNetwork *net, int b)
+{
+    int e0 = net->blockStart[b];
+    int v0 = net->blockVarStart[b];
+    int m = net->blockStart[b + 1] - e0;
+    int n = net->blockVarStart[b + 1] - v0;
+    int npiv = 0;
+    int ok = 1;
+    EnNetRow *row = calloc(m, sizeof(EnNetRow));
+    EnNetList *colRows = calloc(n + 1, sizeof(EnNetList));
+    EnNetHeap heap = {0};
+    int *pivRow = calloc(n + 1, sizeof(int));
+    int *pivCol = calloc(n + 1, sizeof(int));
+    char *used = calloc(m + 1, sizeof(char));
+    char *taint = calloc(m + 1, sizeof(char));     // Rows depending on an undetermined unknown outside the block.
+    char *det = calloc(n + 1, sizeof(char));       // Columns fixed by the specification.
+    double *dx = calloc(n + 1, sizeof(double));
+    
+    if(row == NULL || colRows == NULL || pivRow == NULL || pivCol == NULL || used == NULL || taint == NULL || det == NULL || dx == NULL)
+    {
+        ok = 0;
+    }
+    
+    //  Rows of the part, with the residual at the current values on the right hand side
+    for(int i = 0; ok && i < m; ++i)
+    {
+        int e = net->blockEq[e0 + i];
+        int k = e/2;
+        int var[2] = {net->unitQVar[k], net->unitWVar[k]};
+        
+        for(int j = net->adjStart[k]; ok && j < net->adjStart[k + 1]; ++j)
+        {
+            int v = net->streamVar[net->adjStream[j]];
+            
+            if(v >= 0 && net->varBlock[v] >= 0)
+            {
+                ok = EnNetRowAdd(&row[i], net->varBlock[v] - v0, EnNetCoefficient(net, e, v));
+            }
+        }
+        for(int j = 0; ok && e%2 && j < 2; ++j)
+        {
+            if(var[j] >= 0 && net->varBlock[var[j]] >= 0)
+            {
+                ok = EnNetRowAdd(&row[i], net->varBlock[var[j]] - v0, 1.0);
+            }
+        }
+        row[i].rhs = -EnNetResidual(net, e, NULL);
+        taint[i] = !EnNetInputsSolved(net, e, -1);
+        for(int j = 0; ok && j < row[i].nnz; ++j)
+        {
+            ok = EnNetListAdd(&colRows[row[i].col[j]], i);
+        }
+        if(ok && row[i].nnz > 0)
+        {
+            ok = EnNetHeapPush(&heap, row[i].nnz, i);
+        }
+    }
+    
+    //  Elimination on the sparsest row first
+    while(ok && npiv < n)
+    {
+        int p = -1;
+        int key = 0;
+        int c = 0;
+        int col = 0;
+        double piv = 0.0;
+        
+        while(p < 0 && heap.n > 0)
+        {
+            int i = EnNetHeapPop(&heap, &key);
+            
+            if(used[i] == 0 && row[i].nnz == key)
+            {
+                p = i;
+            }
+        }
+        if(p < 0)
+        {
+            break;
+        }
+        used[p] = 1;
+        for(int j = 1; j < row[p].nnz; ++j)
+        {
+            if(fabs(row[p].val[j]) > fabs(row[p].val[c]))
+            {
+                c = j;
+            }
+        }
+        if(row[p].val[c] == 0.0)
+        {
+            continue;
+        }
+        col = row[p].col[c];
+        piv = row[p].val[c];
+        pivRow[npiv] = p;
+        pivCol[npiv] = col;
+        ++npiv;
+        
+        for(int t = 0; ok && t < colRows[col].n; ++t)
+        {
+            int i = colRows[col].idx[t];
+            int j = 0;
+            double f = 0.0;
+            
+            if(used[i])
+            {
+                continue;
+            }
+            while(j < row[i].nnz && row[i].col[j] != col)
+            {
+                ++j;
+            }
+            if(j == row[i].nnz)
+            {
+                continue;
+            }
+            f = row[i].val[j]/piv;
+            for(int q = 0; ok && q < row[p].nnz; ++q)
+            {
+                int nnz = row[i].nnz;
+                
+                if(q == c)
+                {
+                    continue;
+                }
+                ok = EnNetRowAdd(&row[i], row[p].col[q], -f*row[p].val[q]);
+                if(ok && row[i].nnz > nnz)
+                {
+                    ok = EnNetListAdd(&colRows[row[p].col[q]], i);
+                }
+            }
+            row[i].rhs -= f*row[p].rhs;
+            taint[i] = taint[i] || taint[p];
+            
+            //  Remove the eliminated column
+            --row[i].nnz;
+            row[i].col[j] = row[i].col[row[i].nnz];
+            row[i].val[j] = row[i].val[row[i].nnz];
+            if(ok && row[i].nnz > 0)
+            {
+                ok = EnNetHeapPush(&heap, row[i].nnz, i);
+            }
+        }
+    }
+    if(ok == 0)
+    {
+        printf("Memory could not be allocated for the coupled balances.\n");
+    }
+    
+    //  Back substitution
+    for(int t = npiv - 1; ok && t >= 0; --t)
+    {
+        int p = pivRow[t];
+        int col = pivCol[t];
+        double sum = row[p].rhs;
+        double a = 0.0;
+        
+        //  Later pivots are fixed before this one, and columns never pivoted are not
+        det[col] = !taint[p];
+        for(int j = 0; j < row[p].nnz; ++j)
+        {
+            if(row[p].col[j] == col){
+                a = row[p].val[j];
+            }else{
+                sum -= row[p].val[j]*dx[row[p].col[j]];
+                det[col] = det[col] && (row[p].val[j] == 0.0 || det[row[p].col[j]]);
+            }
+        }
+        dx[col] = sum/a;
+    }
+    
+    //  Update the unknowns
+    for(int j = 0; ok && j < n; ++j)
+    {
+        net->varSolved[net->blockVar[v0 + j]] = 0;
+    }
+    for(int t = 0; ok && t < npiv; ++t)
+    {
+        int v = net->blockVar[v0 + pivCol[t]];
+        
+        net->varSolved[v] = det[pivCol[t]];
+        if(dx[pivCol[t]] != 0.0)
+        {
+            *EnNetValue(net, v) += dx[pivCol[t]];
+            EnNetMarkVar(net, v);
+        }
+    }
+    
+    for(int i = 0; row != NULL && i < m; ++i)
+    {
+        free(row[i].col);
+        free(row[i].val);
+    }
+    for(int j = 0; colRows != NULL && j < n; ++j)
+    {
+        free(colRows[j].idx);
+    }
+    free(row);
+    free(colRows);
+    free(heap.key);
+    free(heap.row);
+    free(pivRow);
+    free(pivCol);
+    free(used);
+    free(taint);
+    free(det);
+    free(dx);
+}
+
+/// This subroutine is used to evaluate the balances of a unit and flag it when either does not close.
+static void EnNetUnitClosure(T2EnergyNetwork *net, int k)
+{
+    T2NetUnit *un = &net->unit[k];
+    double smole = 0.0;
+    double senergy = 0.0;
+    int closure = 0;
+    
+    un->rmole = un->moles ? EnNetResidual(net, 2*k, &smole) : 0.0;
+    un->renergy = EnNetResidual(net, 2*k + 1, &senergy);
+    closure = (fabs(un->rmole) > EnNetTol*smole + 1e-12) || (fabs(un->renergy) > EnNetTol*senergy + 1e-9);
+    net->nclosure += closure - un->closure;
+    un->closure = closure;
+}
+
+int EnNetSolve(T2EnergyNetwork *net)
+{
+    if(net->rebuild)
+    {
+        EnNetAnalyse(net);
+    }
+    
+    //  Balances solved one at a time
+    for(int i = 0; i < net->norder; ++i)
+    {
+        int e = net->orderEq[i];
+        int v = net->orderVar[i];
+        int solved = 0;
+        double c = 0.0;
+        double dx = 0.0;
+        
+        if(net->eqDirty[e] == 0)
+        {
+            continue;
+        }
+        //  An unknown found from a balance that holds an undetermined one is itself undetermined
+        c = EnNetCoefficient(net, e, v);
+        solved = (c != 0.0 && EnNetInputsSolved(net, e, v));
+        if(solved != net->varSolved[v])
+        {
+            net->varSolved[v] = solved;
+            EnNetMarkVar(net, v);
+        }
+        if(c == 0.0)
+        {
+            continue;
+        }
+        dx = -EnNetResidual(net, e, NULL)/c;
+        if(dx != 0.0)
+        {
+            *EnNetValue(net, v) += dx;
+            EnNetMarkVar(net, v);
+        }
+    }
+    
+    //  Parts of the coupled block with a balance to revisit
+    for(int b = 0; b < net->nblock; ++b)
+    {
+        int dirty = 0;
+        
+        for(int i = net->blockStart[b]; dirty == 0 && i < net->blockStart[b + 1]; ++i)
+        {
+            dirty = net->eqDirty[net->blockEq[i]];
+        }
+        if(dirty)
+        {
+            EnNetBlockSolve(net, b);
+        }
+    }
+    
+    //  Closure of the balances revisited
+    for(int i = 0; i < net->ndirty; ++i)
+    {
+        int e = net->dirty[i];
+        
+        net->eqDirty[e] = 0;
+        EnNetUnitClosure(net, e/2);
+    }
+    net->ndirty = 0;
+    
+    net->nfree = 0;
+    for(int v = 0; v < net->nvar; ++v)
+    {
+        net->nfree += (net->varSolved[v] == 0);
+    }
+    
+    return net->nclosure;
+}
+
+/// MARK: DISPLAY AND WRITE
+/// This subroutine is used to print the results to a writer. Used by both "EnNetDisplay(...)" and "EnNetWrite(...)".
+static void EnNetPrint(ResultWriter *w, const T2EnergyNetwork *net)
+{
+    writerPrintf(w, "_Steady-Flow_Energy_Balance_Network_\n");
+    writerPrintf(w, "g =\t9.80665\tm/s2\n\n");
+    
+    writerPrintf(w, "\tStreams:\n");
+    writerPrintf(w, "Stream\tFrom\tTo\tF (mol/s)\th (kJ/kmol)\tM (g/mol)\tu (m/s)\tz (m)\tEnergy flow (kW)\n");
+    for(int s = 0; s < net->nstream; ++s)
+    {
+        const T2NetStream *st = &net->stream[s];
+        int var = net->streamVar[s];
+        
+        writerPrintf(w, "%d\t", s + 1);
+        if(st->from == EnNetBoundary){
+            writerPrintf(w, "-\t");
+        }else{
+            writerPrintf(w, "%d\t", st->from + 1);
+        }
+        if(st->to == EnNetBoundary){
+            writerPrintf(w, "-\t");
+        }else{
+            writerPrintf(w, "%d\t", st->to + 1);
+        }
+        if(var >= 0 && net->varSolved[var] == 0){
+            writerPrintf(w, "undetermined\t");
+        }else{
+            writerPrintf(w, "%.4f%s\t", st->F, (var >= 0) ? "*" : "");
+        }
+        writerPrintf(w, "%.3f\t%.3f\t%.3f\t%.3f\t%.3f\n", st->h, st->M*1000, st->u, st->z, st->F*EnNetStreamEnergy(st)*0.001);
+    }
+    writerPrintf(w, "\n");
+    
+    writerPrintf(w, "\tUnits:\n");
+    writerPrintf(w, "Unit\tQ (kW)\tW (kW)\tMolar residual (mol/s)\tEnergy residual (kW)\tCloses\n");
+    for(int k = 0; k < net->nunit; ++k)
+    {
+        const T2NetUnit *un = &net->unit[k];
+        int var[2] = {net->unitQVar[k], net->unitWVar[k]};
+        double val[2] = {un->Q, un->W};
+        
+        writerPrintf(w, "%d\t", k + 1);
+        for(int j = 0; j < 2; ++j)
+        {
+            if(var[j] >= 0 && net->varSolved[var[j]] == 0){
+                writerPrintf(w, "undetermined\t");
+            }else{
+                writerPrintf(w, "%.3f%s\t", val[j]*0.001, (var[j] >= 0) ? "*" : "");
+            }
+        }
+        if(un->moles){
+            writerPrintf(w, "%.3g\t", un->rmole);
+        }else{
+            writerPrintf(w, "-\t");
+        }
+        writerPrintf(w, "%.3g\t%s\n", un->renergy*0.001, un->closure ? "No" : "Yes");
+    }
+    writerPrintf(w, "* Calculated from the balances.\n\n");
+    
+    writerPrintf(w, "\tSolution:\n");
+    writerPrintf(w, "Unknowns:\t%d\n", net->nvar);
+    writerPrintf(w, "Solved one at a time:\t%d\n", net->norder);
+    writerPrintf(w, "Solved as a coupled block:\t%d unknowns in %d balances\n", net->nblockVar, net->nblockEq);
+    writerPrintf(w, "Undetermined:\t%d\n", net->nfree);
+    writerPrintf(w, "Units failing closure:\t%d\n", net->nclosure);
+    if(net->nfree > 0)
+    {
+        writerPrintf(w, "The network is underspecified. Specify more flowrates, duties or works.\n");
+    }
+    if(net->nclosure > 0)
+    {
+        writerPrintf(w, "Some balances do not close. The specified values are inconsistent or the network is overspecified.\n");
+    }
+}
+
+void EnNetDisplay(const T2EnergyNetwork *net)
+{
+    ResultWriter w;             // Console writer for the results.
+    
+    if(writerConsole(&w))
+    {
+        EnNetPrint(&w, net);
+        writerClose(&w);
+    }
+}
+
+void EnNetWrite(const T2EnergyNetwork *net)
+{
+    //  Function variables
+    ResultWriter w;             // Buffered writer for the results file.
+    
+    //  Set file name as timestamp + Energy Network Results
+    if(!writerOpen(&w, "Energy Network Results"))
+    {
+        return;
+    }
+    
+    //  Write to file
+    EnNetPrint(&w, net);
+    
+    //  Close file
+    writerClose(&w);
+}
+
+void EnNetWriteSwitch(const T2EnergyNetwork *net)
+{
+    if(YesNo("Do you want to save results to file? "))
+    {
+        EnNetWrite(net);
+    }
+}
+
+/// MARK: PSEUDO-MAIN FUNCTION
+void EnergyNetwork(void)
+{
+    int whilmain = 0;
+    printf("Steady-Flow Energy Balance Network\n");
+    
+    whilmain = 1;
+    while(whilmain == 1)
+    {
+        //  Variable declaration
+        char input[maxstrlen];
+        T2EnergyNetwork *net = NULL;    // Units and streams of the network.
+        
+            //  Variables for timing function
+        struct timespec start, end;
+        double elapsed = 0.0;
+        
+        //  Data Collection
+        net = EnNetVariable();
+        
+        if(net != NULL)
+        {
+            int change = 1;
+            
+            while(change == 1)
+            {
+                //  Running calculations
+                clock_getres(CLOCK_MONOTONIC, &start);
+                clock_gettime(CLOCK_MONOTONIC, &start);
+                
+                EnNetSolve(net);
+                
+                clock_getres(CLOCK_MONOTONIC, &end);
+                clock_gettime(CLOCK_MONOTONIC, &end);
+                
+                elapsed = timer(start, end);
+                
+                printf("Calculations completed in %.6f seconds.\n", elapsed);
+                
+                //  Displaying results
+                EnNetDisplay(net);
+                
+                //  Changing one stream or unit and solving again
+                change = YesNo("Do you want to change a stream or unit and solve again? ");
+                if(change == 1)
+                {
+                    printf("Stream (1) or unit (2)? ");
+                    fgets(input, sizeof(input), stdin);
+                    if(input[0] == '1')
+                    {
+                        int s = (int)inputDouble(0, 0, "stream number", "[ ]") - 1;
+                        
+                        if(s >= 0 && s < net->nstream){
+                            double h = 0.0;
+                            double u = 0.0;
+                            double z = 0.0;
+                            
+                            if(net->stream[s].Fknown)
+                            {
+                                EnNetSetFlow(net, s, inputDouble(1, 0, "molar flowrate", "mol/s"));
+                            }
+                            h = inputDouble(1, 1, "molar enthalpy", "kJ/kmol");
+                            u = inputDouble(1, 0, "velocity", "m/s");
+                            z = inputDouble(1, 1, "elevation above the datum", "m");
+                            EnNetSetState(net, s, h, u, z);
+                        }else{
+                            printf("There is no stream %d.\n", s + 1);
+                        }
+                    }else if(input[0] == '2'){
+                        int k = (int)inputDouble(0, 0, "unit number", "[ ]") - 1;
+                        
+                        if(k >= 0 && k < net->nunit){
+                            double Q = net->unit[k].Q;
+                            double W = net->unit[k].W;
+                            
+                            if(net->unit[k].Qknown)
+                            {
+                                Q = 1000*inputDouble(1, 1, "heat added to the unit", "kW");
+                            }
+                            if(net->unit[k].Wknown)
+                            {
+                                W = 1000*inputDouble(1, 1, "shaft work done on the unit", "kW");
+                            }
+                            EnNetSetDuty(net, k, Q, W);
+                        }else{
+                            printf("There is no unit %d.\n", k + 1);
+                        }
+                    }else{
+                        printf("Input not recognised\n");
+                    }
+                }
+            }
+            
+            //  Writing to File
+            EnNetWriteSwitch(net);
+            
+            EnNetFree(net);
+        }
+        
+        //  Continue function
+        whilmain = Continue(whilmain);
+    }
+    fflush(stdout);
+}
@@ -0,0 +1,181 @@
+//
+//  02dEnergyNetwork.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef _2dEnergyNetworkStruct_h
+#define _2dEnergyNetworkStruct_h
+
+#define EnNetBoundary -1    // Stream end that lies outside the network.
+#define EnNetTol 1e-6       // Relative tolerance used to flag a balance that does not close.
+
+typedef struct T2NetStream{
+    int from;               // Unit the stream leaves, or "EnNetBoundary".
+    int to;                 // Unit the stream enters, or "EnNetBoundary".
+    int Fknown;             // Set when the molar flowrate is specified.
+    double F;               // Molar flowrate (mol/s).
+    double h;               // Molar enthalpy (J/mol).
+    double M;               // Molar mass (kg/mol).
+    double u;               // Velocity (m/s).
+    double z;               // Elevation above the datum (m).
+} T2NetStream;
+
+typedef struct T2NetUnit{
+    int Qknown;             // Set when the heat duty is specified.
+    int Wknown;             // Set when the shaft work is specified.
+    int moles;              // Set when moles are conserved, so a molar balance is written as well as the energy balance.
+    double Q;               // Heat added to the unit (W).
+    double W;               // Shaft work done on the unit (W).
+    double rmole;           // Molar balance residual, in minus out (mol/s).
+    double renergy;         // Energy balance residual, in minus out (W).
+    int closure;            // Set when either balance does not close.
+} T2NetUnit;
+
+typedef struct T2EnergyNetwork{
+    int nunit;              // Number of units.
+    int nstream;            // Number of streams.
+    T2NetUnit *unit;        // Units, each with a molar and an energy balance.
+    T2NetStream *stream;    // Streams connecting the units.
+    int rebuild;            // Set when a specification changes and the solution order must be rebuilt.
+    int nclosure;           // Number of units whose balances do not close.
+    int nfree;              // Number of unknowns that could not be determined.
+    //  Solution structure, built by "EnNetSolve(...)". Equation 2k is the molar balance and 2k + 1 the energy balance of unit k.
+    int *adjStart;          // Start of the streams attached to each unit in "adjStream".
+    int *adjStream;         // Streams attached to each unit.
+    int nvar;               // Number of unknowns.
+    int *varKind;           // Unknown type: 0 stream flowrate, 1 heat duty or 2 shaft work.
+    int *varRef;            // Stream or unit of each unknown.
+    int *varSolved;         // Set when the unknown has been determined.
+    int *varBlock;          // Column of each unknown in the coupled block, or -1.
+    int *streamVar;         // Unknown of each stream flowrate, or -1.
+    int *unitQVar;          // Unknown of each heat duty, or -1.
+    int *unitWVar;          // Unknown of each shaft work, or -1.
+    int norder;             // Number of equations solved one at a time.
+    int *orderEq;           // Equations solved one at a time, in order.
+    int *orderVar;          // Unknown found from each of those equations.
+    int nblockEq;           // Number of equations in the coupled block.
+    int *blockEq;           // Equations solved together as a sparse linear system.
+    int nblockVar;          // Number of unknowns in the coupled block.
+    int *blockVar;          // Unknowns of the coupled block.
+    int nblock;             // Number of parts of the coupled block that share no unknowns.
+    int *blockStart;        // Start of each part in "blockEq".
+    int *blockVarStart;     // Start of each part in "blockVar".
+    int *count;             // Working array of undetermined unknowns in each equation, then of the part of the coupled block holding it.
+    int *queue;             // Working array of equations with one undetermined unknown.
+    char *eqDirty;          // Set for each equation that needs to be revisited.
+    int ndirty;             // Number of equations that need to be revisited.
+    int *dirty;             // Equations that need to be revisited.
+} T2EnergyNetwork;
+
+#endif /* _2dEnergyNetworkStruct_h */
+
+#ifndef _2dEnergyNetworkVariable_h
+#define _2dEnergyNetworkVariable_h
+
+/// This subroutine is used to collect the units and streams of an energy balance network. This function returns NULL if the network could not be allocated.
+T2EnergyNetwork *EnNetVariable(void);
+
+#endif /* _2dEnergyNetworkVariable_h */
+
+#ifndef _2dEnergyNetworkCalculation_h
+#define _2dEnergyNetworkCalculation_h
+
+/// This subroutine is used to allocate an empty network. All flowrates, duties and works start as known and zero, and each unit conserves moles. This function returns NULL if the memory could not be allocated.
+/// @param nunit Number of units.
+/// @param nstream Number of streams.
+T2EnergyNetwork *EnNetCreate(int nunit, int nstream);
+
+/// This subroutine is used to release a network made by "EnNetCreate(...)".
+/// @param net Network to be released.
+void EnNetFree(T2EnergyNetwork *net);
+
+/// This subroutine is used to specify a stream. Since it may change which quantities are unknown, the solution order is rebuilt on the next solve. This function returns 1 if the stream is valid, or 0 otherwise.
+/// @param net Energy balance network.
+/// @param s Stream index.
+/// @param from Unit the stream leaves, or "EnNetBoundary".
+/// @param to Unit the stream enters, or "EnNetBoundary".
+/// @param Fknown Set when the molar flowrate is specified.
+/// @param F Molar flowrate, or the starting value when unknown (mol/s).
+/// @param h Molar enthalpy (J/mol).
+/// @param M Molar mass (kg/mol).
+/// @param u Velocity (m/s).
+/// @param z Elevation above the datum (m).
+int EnNetStream(T2EnergyNetwork *net, int s, int from, int to, int Fknown, double F, double h, double M, double u, double z);
+
+/// This subroutine is used to specify a unit. Since it may change which quantities are unknown, the solution order is rebuilt on the next solve.
+/// @param net Energy balance network.
+/// @param k Unit index.
+/// @param Qknown Set when the heat duty is specified.
+/// @param Q Heat added to the unit (W).
+/// @param Wknown Set when the shaft work is specified.
+/// @param W Shaft work done on the unit (W).
+/// @param moles Set when moles are conserved across the unit.
+void EnNetUnit(T2EnergyNetwork *net, int k, int Qknown, double Q, int Wknown, double W, int moles);
+
+/// This subroutine is used to change the flowrate of a stream whose flowrate is specified. Only the balances of the two units it joins are marked to be revisited.
+/// @param net Energy balance network.
+/// @param s Stream index.
+/// @param F Molar flowrate (mol/s).
+void EnNetSetFlow(T2EnergyNetwork *net, int s, double F);
+
+/// This subroutine is used to change the enthalpy, velocity and elevation of a stream. Only the energy balances of the two units it joins are marked to be revisited.
+/// @param net Energy balance network.
+/// @param s Stream index.
+/// @param h Molar enthalpy (J/mol).
+/// @param u Velocity (m/s).
+/// @param z Elevation above the datum (m).
+void EnNetSetState(T2EnergyNetwork *net, int s, double h, double u, double z);
+
+/// This subroutine is used to change the specified heat duty and shaft work of a unit. Only the energy balance of the unit is marked to be revisited.
+/// @param net Energy balance network.
+/// @param k Unit index.
+/// @param Q Heat added to the unit (W).
+/// @param W Shaft work done on the unit (W).
+void EnNetSetDuty(T2EnergyNetwork *net, int k, double Q, double W);
+
+/// This subroutine is used to calculate the specific energy a stream carries, h + M(u^2/2 + gz) (J/mol).
+/// @param st Stream.
+double EnNetStreamEnergy(const T2NetStream *st);
+
+/// This subroutine is used to solve the network for the unknown flowrates, duties and works, and to check that every balance closes.
+///
+/// When the specification has changed, the solution order is rebuilt. Balances with a single undetermined unknown are solved one at a time in a propagation order, and the balances left over, with several unknowns each, are solved together. They are split into parts that share no unknowns, and each part is solved as a sparse linear system by elimination, taking the row with the fewest entries first from a heap and visiting only the rows that hold the pivot column.
+/// When only values have changed, only the balances marked by the setters, and those downstream of them in the solution order, are revisited. A part of the coupled block is only solved again when one of its balances is marked.
+///
+/// This function returns the number of units whose balances do not close.
+/// @param net Energy balance network.
+int EnNetSolve(T2EnergyNetwork *net);
+
+#endif /* _2dEnergyNetworkCalculation_h */
+
+#ifndef _2dEnergyNetworkDisplay_h
+#define _2dEnergyNetworkDisplay_h
+
+/// This subroutine is used to output the streams, units and balance closures to the user console.
+/// @param net Energy balance network.
+void EnNetDisplay(const T2EnergyNetwork *net);
+
+/// This subroutine is used to write the streams, units and balance closures to a .txt file.
+/// @param net Energy balance network.
+void EnNetWrite(const T2EnergyNetwork *net);
+
+/// This subroutine is used to ask the user if they would like to save the results of this program to a file.
+/// @param net Energy balance network.
+void EnNetWriteSwitch(const T2EnergyNetwork *net);
+
+#endif /* _2dEnergyNetworkDisplay_h */
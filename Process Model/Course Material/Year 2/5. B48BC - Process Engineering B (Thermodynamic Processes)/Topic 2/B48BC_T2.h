@@ -40,4 +40,7 @@ void PolyShaftWork(void);
 /// This subroutine guides the user through the calculations to first the overall energy content for an open systems and notifies the user of whether the process is operating at steady- or unsteady-state.
 void OpenFirstLaw(void);
 
+/// This subroutine guides the user through the calculations to solve the steady-flow energy balances of a network of units and streams for the unknown flowrates, heat duties and shaft works, and to check that every balance closes. Single changes can then be made and solved again incrementally.
+void EnergyNetwork(void);
+
 #endif /* B48BC_T2_h */
@@ -29,6 +29,7 @@
 
 //Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "03CubicEOS.h"
 #include "B48BC_T3.h"
 #include "03aJTEffect.h"
@@ -173,98 +174,59 @@ void JTEffectDisplay(double Tc, double Pc, double T, double P, double v, double
 void JTEffectWrite(double Tc, double Pc, double T, double P, double v, double c_p, double a, double b, double mu_JT, double Tinv)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
-    //  Set file name as timestamp + Joule-Thomson Effect
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, "  Joule-Thomson Effect");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    //  Set file name as timestamp +  Joule-Thomson Effect
+    if(!writerOpen(&w, " Joule-Thomson Effect"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
-    fprintf(fp, "_Joule-Thomson_Effect_\n");
-    fprintf(fp, "\tInput parameters\n");
-    fprintf(fp, "Critical Temperature:\n");
-    fprintf(fp, "Tc =\t%.3f\tdeg C\n", Tc - 273.15);
-    fprintf(fp, "Critical Pressure:\n");
-    fprintf(fp, "Pc =\t%.3f\tbar\n", Pc/100000);
-    fprintf(fp, "System Temperature:\n");
-    fprintf(fp, "T =\t%.3f\tdeg C\n", T - 273.15);
-    fprintf(fp, "System Pressure:\n");
-    fprintf(fp, "P =\t%.3f\tbar\n", P/100000);
-    fprintf(fp, "Molar volume:\n");
-    fprintf(fp, "v =\t%.3f\tm3/kmol\n", v*1000);
-    fprintf(fp, "Heat capacity at constant pressure:\n");
-    fprintf(fp, "c_p =\t%.3f\tJ/(mol.K)\n\n", c_p);
-    
-    fprintf(fp, "\tIntermediate parameters\nVan der Waals EOS constants\n");
-    fprintf(fp, "a =\t%.3f\t(J.m3)/(mol2)\n", a);
-    fprintf(fp, "b =\t%.3fE-05\tm3/mol\n\n", b*100000);
-    
-    fprintf(fp, "\tOutput parameters\n");
-    fprintf(fp, "Isobaric thermal expansion coefficient:\n");
-    fprintf(fp, "alpha =\t%.5f\t1/K\n", 1/Tinv);
-    fprintf(fp, "Joule-Thomson Coefficient:\n");
-    fprintf(fp, "mu_JT =\t%.3f\tK/Pa\n", mu_JT);
+    writerPrintf(&w, "_Joule-Thomson_Effect_\n");
+    writerPrintf(&w, "\tInput parameters\n");
+    writerPrintf(&w, "Critical Temperature:\n");
+    writerPrintf(&w, "Tc =\t%.3f\tdeg C\n", Tc - 273.15);
+    writerPrintf(&w, "Critical Pressure:\n");
+    writerPrintf(&w, "Pc =\t%.3f\tbar\n", Pc/100000);
+    writerPrintf(&w, "System Temperature:\n");
+    writerPrintf(&w, "T =\t%.3f\tdeg C\n", T - 273.15);
+    writerPrintf(&w, "System Pressure:\n");
+    writerPrintf(&w, "P =\t%.3f\tbar\n", P/100000);
+    writerPrintf(&w, "Molar volume:\n");
+    writerPrintf(&w, "v =\t%.3f\tm3/kmol\n", v*1000);
+    writerPrintf(&w, "Heat capacity at constant pressure:\n");
+    writerPrintf(&w, "c_p =\t%.3f\tJ/(mol.K)\n\n", c_p);
+    
+    writerPrintf(&w, "\tIntermediate parameters\nVan der Waals EOS constants\n");
+    writerPrintf(&w, "a =\t%.3f\t(J.m3)/(mol2)\n", a);
+    writerPrintf(&w, "b =\t%.3fE-05\tm3/mol\n\n", b*100000);
+    
+    writerPrintf(&w, "\tOutput parameters\n");
+    writerPrintf(&w, "Isobaric thermal expansion coefficient:\n");
+    writerPrintf(&w, "alpha =\t%.5f\t1/K\n", 1/Tinv);
+    writerPrintf(&w, "Joule-Thomson Coefficient:\n");
+    writerPrintf(&w, "mu_JT =\t%.3f\tK/Pa\n", mu_JT);
     if(mu_JT > 0)
     {
         //  Coefficient is positive
-        fprintf(fp, "The VdW gas will cool as it expands\n\n");
+        writerPrintf(&w, "The VdW gas will cool as it expands\n\n");
     }
     if(mu_JT < 0)
     {
         //  Coefficient is negative
-        fprintf(fp, "The VdW gas will heat up as it expands\n\n");
+        writerPrintf(&w, "The VdW gas will heat up as it expands\n\n");
     }
     if(mu_JT == 0)
     {
         //  Coefficient is at the inversion temperature
-        fprintf(fp, "The VdW gas is at its inversion temperature\n\n");
+        writerPrintf(&w, "The VdW gas is at its inversion temperature\n\n");
     }
-    fprintf(fp, "Inversion Temperature:\n");
-    fprintf(fp, "T_i =\t%.2f\tK\n", Tinv);
+    writerPrintf(&w, "Inversion Temperature:\n");
+    writerPrintf(&w, "T_i =\t%.2f\tK\n", Tinv);
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void JTEffectWriteSwitch(double Tc, double Pc, double T, double P, double v, double c_p, double a, double b, double mu_JT, double Tinv)
@@ -29,6 +29,7 @@
 
 //Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "IdealGasLaw.h"
 #include "01cIsobaric.h"
 #include "01eAdiabatic.h"
@@ -296,94 +297,63 @@ void MSCompDisplay(double P1, double P2, double Vc, double V1, double V2, double
 void MSCompWrite(double P1, double P2, double Vc, double V1, double V2, double T1, double T2, double n, double N, double gamma, T3CompProfile profile)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
-    
-    FILE *fp;                   // Pointer to the file location.
-    //  Set file name as timestamp + Multistage Compressor Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Multistage Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    ResultWriter w;             // Buffered writer for the results file.
+    
+    WriterColumn cols[6] = {
+        {"P", "kPa", profile.P, 1, WriterFixed, 6, 0.001, 0.0},
+        {"V", "m3", profile.V, 1, WriterFixed, 6, 1.0, 0.0},
+        {"T", "K", profile.T, 1, WriterFixed, 6, 1.0, 0.0},
+        {"T", "deg C", profile.T, 1, WriterFixed, 6, 1.0, -273.15},
+        {"W_V", "kW", profile.W_V, 1, WriterFixed, 6, 0.001, 0.0},
+        {"W_S", "kW", profile.W_S, 1, WriterFixed, 6, 0.001, 0.0}
+    };
+    
+    //  Set file name as timestamp + Multistage Results
+    if(!writerOpen(&w, "Multistage Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
-    fprintf(fp, "_Multistage_Compressor_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Initial system pressure:\n");
-    fprintf(fp, "P1 =\t%.3f\tkPa\n", P1*0.001);
-    fprintf(fp, "Final system pressure:\n");
-    fprintf(fp, "P2 =\t%.3f\tkPa\n\n", P2*0.001);
-    
-    fprintf(fp, "Clearance volume:\n");
-    fprintf(fp, "Vc =\t%.3f\tm3\n", Vc);
-    fprintf(fp, "Initial system volume before compression:\n");
-    fprintf(fp, "V1 =\t%.3f\tm3\n", V1);
-    fprintf(fp, "Final system volume after compression:\n");
-    fprintf(fp, "V2 =\t%.3f\tm3\n\n", V2);
-    
-    fprintf(fp, "Initial system temperature:\n");
-    fprintf(fp, "T1 =\t%.3f\tdeg C\n", T1-273.15);
-    fprintf(fp, "Final system temperature:\n");
-    fprintf(fp, "T2 =\t%.3f\tdeg C\n\n", T2-273.15);
-    
-    fprintf(fp, "Molar flowrate of component i:\n");
-    fprintf(fp, "n =\t%.3f\tkmol/s\n", n*0.001);
-    fprintf(fp, "Universal Gas Constant:\n");
-    fprintf(fp, "R =\t%.3f\tJ/(mol. K)\n\n", R);
-    
-    fprintf(fp, "Heat capacity ratio:\n");
-    fprintf(fp, "gamma =\t%.3f\t[ ]\n\n", gamma);
-    
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "P (kPa)\tV (m3)\tT (K)\tT(deg C)\t\tW_V (kW)\tW_S (kW)\n");
-    for(int i = 0; i < 1500; ++i){
-        fprintf(fp, "%f\t", profile.P[i]*0.001);
-        fprintf(fp, "%f\t", profile.V[i]);
-        fprintf(fp, "%f\t", profile.T[i]);
-        fprintf(fp, "%f\t\t", profile.T[i] - 273.15);
-        fprintf(fp, "%f\t", profile.W_V[i]*0.001);
-        fprintf(fp, "%f\n", profile.W_S[i]*0.001);
-    }
+    writerText(&w, "_Multistage_Compressor_Results_\n");
+    writerText(&w, "\tInput parameters:\n");
+    writerText(&w, "Initial system pressure:\n");
+    writerValue(&w, "P1 =", P1*0.001, 3, "kPa");
+    writerText(&w, "Final system pressure:\n");
+    writerValue(&w, "P2 =", P2*0.001, 3, "kPa");
+    writerEnd(&w);
+    
+    writerText(&w, "Clearance volume:\n");
+    writerValue(&w, "Vc =", Vc, 3, "m3");
+    writerText(&w, "Initial system volume before compression:\n");
+    writerValue(&w, "V1 =", V1, 3, "m3");
+    writerText(&w, "Final system volume after compression:\n");
+    writerValue(&w, "V2 =", V2, 3, "m3");
+    writerEnd(&w);
+    
+    writerText(&w, "Initial system temperature:\n");
+    writerValue(&w, "T1 =", T1 - 273.15, 3, "deg C");
+    writerText(&w, "Final system temperature:\n");
+    writerValue(&w, "T2 =", T2 - 273.15, 3, "deg C");
+    writerEnd(&w);
+    
+    writerText(&w, "Molar flowrate of component i:\n");
+    writerValue(&w, "n =", n*0.001, 3, "kmol/s");
+    writerText(&w, "Universal Gas Constant:\n");
+    writerValue(&w, "R =", R, 3, "J/(mol. K)");
+    writerEnd(&w);
+    
+    writerText(&w, "Heat capacity ratio:\n");
+    writerValue(&w, "gamma =", gamma, 3, "[ ]");
+    writerEnd(&w);
+    
+    writerText(&w, "\tOutput parameters:\n");
+    
+    //  Profile (Two Temperature columns (K and deg C))
+    writerTable(&w, 6, cols, 1500);
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void MSCompSwitch(int mode, double P1, double P2, double Vc, double V1, double V2, double T1, double T2, double n, double N, double gamma, T3CompProfile profile)
@@ -441,11 +411,7 @@ void MultistageCompressor(void)
     while(whilmain == 1)
     {
         //  Variable declaration
-        int elems = 0;                  // Variable used to store the total number of elements used in the data struct.
-        
-        elems = 5*1500;
-        
-        T3CompProfile *profile = calloc(elems, sizeof(double));  // Struct where the generated multistage adiabat is stored.
+        T3CompProfile *profile = calloc(1, sizeof(T3CompProfile));  // Struct where the generated multistage adiabat is stored.
         double V1 = 0.0;                // Initial system volume before compression.
         double V2 = 0.0;                // Final system volume after multistage compression.
         double T2 = 0.0;                // Final system temperature after multistage compression.
@@ -29,6 +29,7 @@
 
 //Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BC_T3.h"
 #include "03cMultistageEstimation.h"
 
@@ -134,78 +135,39 @@ void MSShaftWorkDisplay(double P1, double P2, double T1, double mol, double gamm
 void MSShaftWorkWrite(double P1, double P2, double T1, double mol, double gamma, double N, double shaftwork)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
     //  Set file name as timestamp + Multistage Shaft Work Estimation
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Multistage Shaft Work Estimation");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, "Multistage Shaft Work Estimation"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
-    fprintf(fp, "_Multistage_Compressor_Shaft_Work_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Initial system pressure: ");
-    fprintf(fp, "P1 =\t%.3f\tkPa\n", P1*0.001);
-    fprintf(fp, "Final system pressure: ");
-    fprintf(fp, "P2 =\t%.3f\tkPa\n\n", P2*0.001);
+    writerPrintf(&w, "_Multistage_Compressor_Shaft_Work_Results_\n");
+    writerPrintf(&w, "\tInput parameters:\n");
+    writerPrintf(&w, "Initial system pressure: ");
+    writerPrintf(&w, "P1 =\t%.3f\tkPa\n", P1*0.001);
+    writerPrintf(&w, "Final system pressure: ");
+    writerPrintf(&w, "P2 =\t%.3f\tkPa\n\n", P2*0.001);
     
-    fprintf(fp, "Initial system temperature: ");
-    fprintf(fp, "T1 =\t%.3f\tdeg C\n\n", T1-273.15);
+    writerPrintf(&w, "Initial system temperature: ");
+    writerPrintf(&w, "T1 =\t%.3f\tdeg C\n\n", T1-273.15);
     
-    fprintf(fp, "Molar flowrate of component i:\n");
-    fprintf(fp, "n =\t%.3f\tkmol/s\n", mol*0.001);
-    fprintf(fp, "Universal Gas Constant:\n");
-    fprintf(fp, "R =\t%.3f\tJ/(mol. K)\n\n", R);
+    writerPrintf(&w, "Molar flowrate of component i:\n");
+    writerPrintf(&w, "n =\t%.3f\tkmol/s\n", mol*0.001);
+    writerPrintf(&w, "Universal Gas Constant:\n");
+    writerPrintf(&w, "R =\t%.3f\tJ/(mol. K)\n\n", R);
     
-    fprintf(fp, "Heat capacity ratio:\n");
-    fprintf(fp, "gamma =\t%.3f\t[ ]\n\n", gamma);
+    writerPrintf(&w, "Heat capacity ratio:\n");
+    writerPrintf(&w, "gamma =\t%.3f\t[ ]\n\n", gamma);
     
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "Total shaft work:\n");
-    fprintf(fp, "shaftWork =\t%.3f\tkW\n", shaftwork*0.001);
+    writerPrintf(&w, "\tOutput parameters:\n");
+    writerPrintf(&w, "Total shaft work:\n");
+    writerPrintf(&w, "shaftWork =\t%.3f\tkW\n", shaftwork*0.001);
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void MSShaftWorkWriteSwitch(double P1, double P2, double T1, double mol, double gamma, double N, double shaftwork)
@@ -0,0 +1,537 @@
+//
+//  03dMultistageOptimiser.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+/// MARK: HEADER DECLARATIONS
+//  Standard header files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//  Custom header files
+#include "System.h"
+#include "ResultWriter.h"
+#include "Parallel.h"
+#include "03dMultistageOptimiser.h"
+
+/// MARK: SUBROUTINE DEFINITIONS
+#define maxstrlen 128
+#define R 8.3145            // J/(mol.K)
+#define msopttol 1e-9       // Largest change in any log pressure ratio accepted as converged.
+#define msoptmaxiter 500    // Iteration limit of the projected gradient search.
+#define msoptfd 1e-6        // Step in the log pressure ratios used by the finite difference gradient.
+
+/// This struct is used to share the specification and results between the stage count kernels.
+typedef struct MSOptContext{
+    const T3MSOptSpec *spec;
+    T3MSOptResult *res;
+} MSOptContext;
+
+/// MARK: VARIABLE INPUT
+void MSOptVariable(T3MSOptSpec *spec)
+{
+    char prompt[maxstrlen];
+    int control = 0;
+    
+    memset(spec, 0, sizeof(T3MSOptSpec));
+    
+    control = 1;
+    while(control == 1)
+    {
+        spec->P1 = inputDouble(0, 0, "suction pressure", "kPa");
+        spec->P1 = (spec->P1)*1000;
+        
+        spec->P2 = inputDouble(0, 0, "final discharge pressure", "kPa");
+        spec->P2 = (spec->P2)*1000;
+        if(spec->P2 > spec->P1){
+            control = 0;
+        }else{
+            printf("The discharge pressure must be greater than the suction pressure.\n");
+        }
+    }
+    
+    spec->T1 = inputDouble(1, 1, "suction temperature", "deg C");
+    spec->T1 = (spec->T1) + 273.15;
+    
+    spec->n = inputDouble(0, 0, "molar flowrate", "kmol/s");
+    spec->n = (spec->n)*1000;
+    
+    spec->gamma = inputDouble(0, 0, "heat capacity ratio", "[ ]");
+    
+    control = 1;
+    while(control == 1)
+    {
+        spec->eta = inputDouble(0, 0, "isentropic efficiency of each stage", "%");
+        spec->eta = (spec->eta)*0.01;
+        if(spec->eta <= 1.0){
+            control = 0;
+        }else{
+            printf("The isentropic efficiency cannot exceed 100 %%.\n");
+        }
+    }
+    
+    control = 1;
+    while(control == 1)
+    {
+        spec->Nmax = (int)inputDouble(0, 0, "largest number of stages to consider", "[ ]");
+        if(spec->Nmax >= 1 && spec->Nmax <= MSOptMaxStages){
+            control = 0;
+        }else{
+            printf("Please enter an integer between 1 and %i.\n", MSOptMaxStages);
+        }
+    }
+    
+    spec->Tcool = inputDouble(1, 1, "coolant temperature", "deg C");
+    spec->Tcool = (spec->Tcool) + 273.15;
+    
+    if(spec->Nmax > 1 && YesNo("Do the intercoolers have different approach temperatures or pressure drops? "))
+    {
+        for(int k = 0; k < spec->Nmax - 1; ++k)
+        {
+            snprintf(prompt, sizeof(prompt), "approach temperature of intercooler %i", k + 1);
+            spec->approach[k] = inputDouble(1, 0, prompt, "K");
+            snprintf(prompt, sizeof(prompt), "pressure drop across intercooler %i", k + 1);
+            spec->dP[k] = inputDouble(1, 0, prompt, "%");
+            spec->dP[k] = (spec->dP[k])*0.01;
+        }
+    }else{
+        spec->approach[0] = inputDouble(1, 0, "intercooler approach temperature", "K");
+        spec->dP[0] = inputDouble(1, 0, "pressure drop across each intercooler", "%");
+        spec->dP[0] = (spec->dP[0])*0.01;
+        for(int k = 1; k < MSOptMaxStages; ++k)
+        {
+            spec->approach[k] = spec->approach[0];
+            spec->dP[k] = spec->dP[0];
+        }
+    }
+    for(int k = 0; k < MSOptMaxStages; ++k)
+    {
+        spec->dP[k] = (spec->dP[k] > 0.99) ? 0.99 : spec->dP[k];
+    }
+    
+    if(YesNo("Is there a limit on the stage discharge temperature? "))
+    {
+        spec->Tmax = inputDouble(1, 1, "largest stage discharge temperature", "deg C");
+        spec->Tmax = (spec->Tmax) + 273.15;
+    }
+    
+    spec->ccool = inputDouble(1, 0, "cost of intercooler duty as shaft power per unit duty", "[ ]");
+    spec->cfix = inputDouble(1, 0, "fixed cost of each intercooler as shaft power", "kW");
+    spec->cfix = (spec->cfix)*1000;
+}
+
+/// MARK: GENERAL CALCULATIONS
+double MSOptEvaluate(const T3MSOptSpec *spec, int N, const double *lnr, T3MSOptResult *res)
+{
+    double a = (spec->gamma - 1)/spec->gamma;
+    double cp = spec->gamma*R/(spec->gamma - 1);
+    double Pin = spec->P1;
+    double Tin = spec->T1;
+    double W = 0.0;
+    double Q = 0.0;
+    double cost = 0.0;
+    
+    for(int k = 0; k < N; ++k)
+    {
+        double Pout = Pin*exp(lnr[k]);
+        double Tout = Tin*(1 + (exp(a*lnr[k]) - 1)/spec->eta);
+        double Ws = spec->n*cp*(Tout - Tin);
+        double Qc = 0.0;
+        double Tnext = Tout;
+        
+        // The gas is cooled between stages but leaves the final stage uncooled
+        if(k < N - 1)
+        {
+            Tnext = spec->Tcool + spec->approach[k];
+            Tnext = (Tnext < Tout) ? Tnext : Tout;
+            Qc = spec->n*cp*(Tout - Tnext);
+        }
+        
+        if(res != NULL)
+        {
+            res->Pin[k] = Pin;
+            res->Pout[k] = Pout;
+            res->Tin[k] = Tin;
+            res->Tout[k] = Tout;
+            res->Ws[k] = Ws;
+            res->Qc[k] = Qc;
+        }
+        W += Ws;
+        Q += Qc;
+        
+        Pin = (k < N - 1) ? Pout*(1 - spec->dP[k]) : Pout;
+        Tin = Tnext;
+    }
+    cost = W + spec->ccool*Q + spec->cfix*(N - 1);
+    
+    if(res != NULL)
+    {
+        res->N = N;
+        res->W = W;
+        res->Q = Q;
+        res->cost = cost;
+    }
+    
+    return cost;
+}
+
+/// This subroutine is used to project a set of log pressure ratios onto the stages that deliver the overall pressure ratio within their bounds. Every ratio is shifted by the same amount and clipped, with the shift found by bisection.
+/// @param N Number of stages.
+/// @param y Log pressure ratios to be projected.
+/// @param L Upper bound on each log pressure ratio.
+/// @param total Sum of log pressure ratios required.
+/// @param x Array where the projected ratios should be stored.
+static void MSOptProject(int N, const double *y, const double *L, double total, double *x)
+{
+    double lo = y[0] - L[0];
+    double hi = y[0];
+    
+    for(int k = 1; k < N; ++k)
+    {
+        lo = (y[k] - L[k] < lo) ? y[k] - L[k] : lo;
+        hi = (y[k] > hi) ? y[k] : hi;
+    }
+    
+    for(int iter = 0; iter < 200; ++iter)
+    {
+        double tau = 0.5*(lo + hi);
+        double sum = 0.0;
+        
+        for(int k = 0; k < N; ++k)
+        {
+            x[k] = y[k] - tau;
+            x[k] = (x[k] < 0.0) ? 0.0 : x[k];
+            x[k] = (x[k] > L[k]) ? L[k] : x[k];
+            sum += x[k];
+        }
+        if(sum > total){
+            lo = tau;
+        }else{
+            hi = tau;
+        }
+        if(hi - lo < 1e-15)
+        {
+            break;
+        }
+    }
+}
+
+int MSOptStages(const T3MSOptSpec *spec, int N, T3MSOptResult *res)
+{
+    double a = (spec->gamma - 1)/spec->gamma;
+    double total = log(spec->P2/spec->P1);
+    double L[MSOptMaxStages];
+    double x[MSOptMaxStages];
+    double y[MSOptMaxStages];
+    double xt[MSOptMaxStages];
+    double g[MSOptMaxStages];
+    double Lsum = 0.0;
+    double f = 0.0;
+    double step = 0.0;
+    
+    memset(res, 0, sizeof(T3MSOptResult));
+    res->N = N;
+    
+    // Each intercooler pressure drop has to be recovered by the stages that follow it
+    for(int k = 0; k < N - 1; ++k)
+    {
+        total -= log(1 - spec->dP[k]);
+    }
+    
+    // Bounds from the temperature limit, using the warmest gas each stage can receive
+    for(int k = 0; k < N; ++k)
+    {
+        double Tin = (k == 0) ? spec->T1 : spec->Tcool + spec->approach[k - 1];
+        
+        if(spec->Tmax <= 0.0){
+            L[k] = total;
+        }else if(spec->Tmax <= Tin){
+            L[k] = 0.0;
+        }else{
+            L[k] = log(1 + spec->eta*(spec->Tmax/Tin - 1))/a;
+            L[k] = (L[k] > total) ? total : L[k];
+        }
+        Lsum += L[k];
+    }
+    if(Lsum < total*(1 - 1e-12))
+    {
+        res->feasible = 0;
+        return 0;
+    }
+    res->feasible = 1;
+    
+    // Starting from the equal ratio split
+    for(int k = 0; k < N; ++k)
+    {
+        y[k] = total/N;
+    }
+    MSOptProject(N, y, L, total, x);
+    f = MSOptEvaluate(spec, N, x, NULL);
+    
+    for(int iter = 0; iter < msoptmaxiter && N > 1; ++iter)
+    {
+        double gmax = 0.0;
+        double change = 0.0;
+        double ft = 0.0;
+        int accepted = 0;
+        
+        res->iter = iter + 1;
+        
+        // Central difference gradient
+        for(int k = 0; k < N; ++k)
+        {
+            double hold = x[k];
+            double fp = 0.0;
+            double fm = 0.0;
+            
+            x[k] = hold + msoptfd;
+            fp = MSOptEvaluate(spec, N, x, NULL);
+            x[k] = hold - msoptfd;
+            fm = MSOptEvaluate(spec, N, x, NULL);
+            x[k] = hold;
+            g[k] = (fp - fm)/(2*msoptfd);
+            gmax = (fabs(g[k]) > gmax) ? fabs(g[k]) : gmax;
+        }
+        if(gmax == 0.0)
+        {
+            break;
+        }
+        if(step == 0.0)
+        {
+            step = 0.1*total/(N*gmax);
+        }
+        
+        // Backtracking until the projected step gives a sufficient decrease
+        for(int back = 0; back < 60; ++back)
+        {
+            double decrease = 0.0;
+            
+            for(int k = 0; k < N; ++k)
+            {
+                y[k] = x[k] - step*g[k];
+            }
+            MSOptProject(N, y, L, total, xt);
+            for(int k = 0; k < N; ++k)
+            {
+                decrease += g[k]*(x[k] - xt[k]);
+            }
+            ft = MSOptEvaluate(spec, N, xt, NULL);
+            if(ft <= f - 1e-4*decrease)
+            {
+                accepted = 1;
+                break;
+            }
+            step = 0.5*step;
+        }
+        if(accepted == 0)
+        {
+            break;
+        }
+        
+        for(int k = 0; k < N; ++k)
+        {
+            double d = fabs(xt[k] - x[k]);
+            
+            change = (d > change) ? d : change;
+            x[k] = xt[k];
+        }
+        f = ft;
+        step = 2*step;
+        if(change < msopttol)
+        {
+            break;
+        }
+    }
+    
+    MSOptEvaluate(spec, N, x, res);
+    res->feasible = 1;
+    
+    return 1;
+}
+
+/// This subroutine is used to optimise a block of stage counts. Used as the kernel of "parallelFor(...)".
+/// @param start First stage count index in the block.
+/// @param end One past the last stage count index in the block.
+/// @param context Pointer to a "MSOptContext" struct.
+static void MSOptKernel(int start, int end, void *context)
+{
+    MSOptContext *ctx = context;
+    
+    for(int i = start; i < end; ++i)
+    {
+        MSOptStages(ctx->spec, i + 1, &ctx->res[i]);
+    }
+}
+
+int MSOptimise(const T3MSOptSpec *spec, T3MSOptResult *res)
+{
+    MSOptContext ctx = {spec, res};
+    int best = -1;
+    
+    parallelFor(spec->Nmax, 1, MSOptKernel, &ctx);
+    
+    for(int i = 0; i < spec->Nmax; ++i)
+    {
+        if(res[i].feasible && (best < 0 || res[i].cost < res[best].cost))
+        {
+            best = i;
+        }
+    }
+    
+    return best;
+}
+
+/// MARK: DISPLAY AND WRITE
+/// This subroutine is used to print the optimisation results to a writer. Used by both "MSOptDisplay(...)" and "MSOptWrite(...)".
+static void MSOptPrint(ResultWriter *w, const T3MSOptSpec *spec, const T3MSOptResult *res, int best)
+{
+    writerPrintf(w, "_Multistage_Compressor_Optimisation_Results_\n");
+    writerPrintf(w, "\tInput parameters:\n");
+    writerPrintf(w, "Suction pressure:\n");
+    writerPrintf(w, "P1 =\t%.3f\tkPa\n", spec->P1*0.001);
+    writerPrintf(w, "Final discharge pressure:\n");
+    writerPrintf(w, "P2 =\t%.3f\tkPa\n", spec->P2*0.001);
+    writerPrintf(w, "Suction temperature:\n");
+    writerPrintf(w, "T1 =\t%.3f\tdeg C\n", spec->T1 - 273.15);
+    writerPrintf(w, "Molar flowrate:\n");
+    writerPrintf(w, "n =\t%.3f\tkmol/s\n", spec->n*0.001);
+    writerPrintf(w, "Heat capacity ratio:\n");
+    writerPrintf(w, "gamma =\t%.3f\t[ ]\n", spec->gamma);
+    writerPrintf(w, "Isentropic efficiency:\n");
+    writerPrintf(w, "eta =\t%.2f\t%%\n", spec->eta*100);
+    writerPrintf(w, "Coolant temperature:\n");
+    writerPrintf(w, "Tcool =\t%.3f\tdeg C\n", spec->Tcool - 273.15);
+    if(spec->Tmax > 0.0)
+    {
+        writerPrintf(w, "Largest stage discharge temperature:\n");
+        writerPrintf(w, "Tmax =\t%.3f\tdeg C\n", spec->Tmax - 273.15);
+    }
+    writerPrintf(w, "Cost of intercooler duty:\n");
+    writerPrintf(w, "ccool =\t%.4f\t[ ]\n", spec->ccool);
+    writerPrintf(w, "Fixed cost of each intercooler:\n");
+    writerPrintf(w, "cfix =\t%.3f\tkW\n\n", spec->cfix*0.001);
+    
+    writerPrintf(w, "\tStage count comparison:\n");
+    writerPrintf(w, "N\tW_S (kW)\tQ (kW)\tCost (kW)\tIterations\n");
+    for(int i = 0; i < spec->Nmax; ++i)
+    {
+        if(res[i].feasible){
+            writerPrintf(w, "%i\t%.3f\t%.3f\t%.3f\t%i%s\n", res[i].N, res[i].W*0.001, res[i].Q*0.001, res[i].cost*0.001, res[i].iter, (i == best) ? "\t(optimum)" : "");
+        }else{
+            writerPrintf(w, "%i\tDischarge temperature limit cannot be met.\n", res[i].N);
+        }
+    }
+    
+    if(best < 0)
+    {
+        writerPrintf(w, "\nNo stage count meets the discharge temperature limit.\n");
+        return;
+    }
+    writerPrintf(w, "\n\tOptimum train (%i stages):\n", res[best].N);
+    writerPrintf(w, "Stage\tPin (kPa)\tPout (kPa)\tRatio (-)\tTin (deg C)\tTout (deg C)\tW_S (kW)\tQ (kW)\n");
+    for(int k = 0; k < res[best].N; ++k)
+    {
+        writerPrintf(w, "%i\t%.3f\t%.3f\t%.4f\t%.3f\t%.3f\t%.3f\t%.3f\n", k + 1, res[best].Pin[k]*0.001, res[best].Pout[k]*0.001, res[best].Pout[k]/res[best].Pin[k], res[best].Tin[k] - 273.15, res[best].Tout[k] - 273.15, res[best].Ws[k]*0.001, res[best].Qc[k]*0.001);
+    }
+}
+
+void MSOptDisplay(const T3MSOptSpec *spec, const T3MSOptResult *res, int best)
+{
+    ResultWriter w;             // Console writer for the results.
+    
+    if(writerConsole(&w))
+    {
+        MSOptPrint(&w, spec, res, best);
+        writerClose(&w);
+    }
+}
+
+void MSOptWrite(const T3MSOptSpec *spec, const T3MSOptResult *res, int best)
+{
+    //  Function variables
+    ResultWriter w;             // Buffered writer for the results file.
+    
+    //  Set file name as timestamp + Multistage Optimisation Results
+    if(!writerOpen(&w, "Multistage Optimisation Results"))
+    {
+        return;
+    }
+    
+    //  Write to file
+    MSOptPrint(&w, spec, res, best);
+    
+    //  Close file
+    writerClose(&w);
+}
+
+void MSOptWriteSwitch(const T3MSOptSpec *spec, const T3MSOptResult *res, int best)
+{
+    if(YesNo("Do you want to save results to file? "))
+    {
+        MSOptWrite(spec, res, best);
+    }
+}
+
+/// MARK: PSEUDO-MAIN FUNCTION
+void MultistageOptimiser(void)
+{
+    int whilmain = 0;
+    printf("Multistage Compressor Optimisation\n");
+    
+    whilmain = 1;
+    while(whilmain == 1)
+    {
+        //  Variable declaration
+        T3MSOptSpec spec;                       // Compressor specification.
+        T3MSOptResult res[MSOptMaxStages];      // Optimised train for each stage count.
+        int best = 0;                           // Index of the cheapest feasible train.
+        
+            //  Variables for timing function
+        struct timespec start, end;
+        double elapsed = 0.0;
+        
+        //  Data Collection
+        MSOptVariable(&spec);
+        
+        //  Running calculations
+        clock_getres(CLOCK_MONOTONIC, &start);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        
+        best = MSOptimise(&spec, res);
+        
+        clock_getres(CLOCK_MONOTONIC, &end);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        
+        elapsed = timer(start, end);
+        
+        printf("Calculations completed in %.6f seconds.\n", elapsed);
+        
+        //  Displaying results
+        MSOptDisplay(&spec, res, best);
+        
+        //  Writing to File
+        MSOptWriteSwitch(&spec, res, best);
+        
+        //  Continue function
+        whilmain = Continue(whilmain);
+    }
+    fflush(stdout);
+}
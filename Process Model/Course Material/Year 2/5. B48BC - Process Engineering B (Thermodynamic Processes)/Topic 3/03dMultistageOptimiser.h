@@ -0,0 +1,112 @@
+//
+//  03dMultistageOptimiser.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef _3dMultistageOptimiserStruct_h
+#define _3dMultistageOptimiserStruct_h
+
+#define MSOptMaxStages 12   // Largest number of compression stages considered.
+
+typedef struct T3MSOptSpec{
+    double P1;                          // Suction pressure (Pa).
+    double P2;                          // Final discharge pressure (Pa).
+    double T1;                          // Suction temperature (K).
+    double n;                           // Molar flowrate (mol/s).
+    double gamma;                       // Heat capacity ratio ([ ]).
+    double eta;                         // Isentropic efficiency of each stage ([ ]).
+    double Tcool;                       // Coolant temperature (K).
+    double approach[MSOptMaxStages];    // Approach temperature of each intercooler, in order from the first stage (K).
+    double dP[MSOptMaxStages];          // Fractional pressure drop across each intercooler ([ ]).
+    double Tmax;                        // Largest allowed stage discharge temperature (K).
+    double ccool;                       // Cost of intercooler duty, as shaft power per unit duty ([ ]).
+    double cfix;                        // Fixed cost of each intercooler, as shaft power (W).
+    int Nmax;                           // Largest number of stages considered.
+} T3MSOptSpec;
+
+typedef struct T3MSOptResult{
+    int N;                              // Number of stages.
+    int feasible;                       // Set when the discharge temperature limit can be met.
+    int iter;                           // Projected gradient iterations used.
+    double cost;                        // Shaft power plus intercooler cost (W).
+    double W;                           // Total shaft power (W).
+    double Q;                           // Total intercooler duty (W).
+    double Pin[MSOptMaxStages];         // Stage suction pressures (Pa).
+    double Pout[MSOptMaxStages];        // Stage discharge pressures (Pa).
+    double Tin[MSOptMaxStages];         // Stage suction temperatures (K).
+    double Tout[MSOptMaxStages];        // Stage discharge temperatures (K).
+    double Ws[MSOptMaxStages];          // Stage shaft power (W).
+    double Qc[MSOptMaxStages];          // Duty of the intercooler after each stage (W).
+} T3MSOptResult;
+
+#endif /* _3dMultistageOptimiserStruct_h */
+
+#ifndef _3dMultistageOptimiserVariable_h
+#define _3dMultistageOptimiserVariable_h
+
+/// This subroutine is used to collect the compression duty, intercooler data, temperature limit and costs for the multistage compressor optimisation.
+/// @param spec Struct where the specification should be stored.
+void MSOptVariable(T3MSOptSpec *spec);
+
+#endif /* _3dMultistageOptimiserVariable_h */
+
+#ifndef _3dMultistageOptimiserCalculation_h
+#define _3dMultistageOptimiserCalculation_h
+
+/// This subroutine is used to simulate a train of adiabatic stages with intercoolers for given stage pressure ratios. Gas leaves each intercooler at the coolant temperature plus its approach, or uncooled if it is already colder, and loses the intercooler pressure drop. This function returns the shaft power plus the intercooler cost.
+/// @param spec Compressor specification.
+/// @param N Number of stages.
+/// @param lnr Natural logarithms of the stage pressure ratios.
+/// @param res Struct where the stage results should be stored.
+double MSOptEvaluate(const T3MSOptSpec *spec, int N, const double *lnr, T3MSOptResult *res);
+
+/// This subroutine is used to find the interstage pressures that minimise the cost of an N stage train. The stage pressure ratios start from the equal ratio split and are refined by projected gradient steps. Each step keeps the overall pressure ratio and bounds every ratio between one and the ratio at which the stage reaches the discharge temperature limit. This function returns 1 when the limit can be met, or 0 otherwise.
+/// @param spec Compressor specification.
+/// @param N Number of stages.
+/// @param res Struct where the optimised train should be stored.
+int MSOptStages(const T3MSOptSpec *spec, int N, T3MSOptResult *res);
+
+/// This subroutine is used to optimise every stage count from one to "Nmax" in parallel. This function returns the index of the cheapest feasible train, or -1 when none meets the temperature limit.
+/// @param spec Compressor specification.
+/// @param res Array of "Nmax" results, one for each stage count.
+int MSOptimise(const T3MSOptSpec *spec, T3MSOptResult *res);
+
+#endif /* _3dMultistageOptimiserCalculation_h */
+
+#ifndef _3dMultistageOptimiserDisplay_h
+#define _3dMultistageOptimiserDisplay_h
+
+/// This subroutine is used to output the optimisation results to the user console.
+/// @param spec Compressor specification.
+/// @param res Array of results from "MSOptimise(...)".
+/// @param best Index of the cheapest feasible train.
+void MSOptDisplay(const T3MSOptSpec *spec, const T3MSOptResult *res, int best);
+
+/// This subroutine is used to write the optimisation results to a .txt file.
+/// @param spec Compressor specification.
+/// @param res Array of results from "MSOptimise(...)".
+/// @param best Index of the cheapest feasible train.
+void MSOptWrite(const T3MSOptSpec *spec, const T3MSOptResult *res, int best);
+
+/// This subroutine is used to check if the user would like to write the results to a file.
+/// @param spec Compressor specification.
+/// @param res Array of results from "MSOptimise(...)".
+/// @param best Index of the cheapest feasible train.
+void MSOptWriteSwitch(const T3MSOptSpec *spec, const T3MSOptResult *res, int best);
+
+#endif /* _3dMultistageOptimiserDisplay_h */
@@ -0,0 +1,826 @@
+//
+//  03eJTInversion.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+/// MARK: HEADER DECLARATIONS
+//  Standard header files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//  Custom header files
+#include "System.h"
+#include "ResultWriter.h"
+#include "Parallel.h"
+#include "03CubicEOS.h"
+#include "03eJTInversion.h"
+
+/// MARK: SUBROUTINE DEFINITIONS
+#define maxstrlen 128
+#define R 8.3145            // J/(mol.K)
+#define Tref 298.15         // Reference temperature for enthalpy (K).
+#define jtscan 256          // Temperatures scanned at each pressure of the inversion curve.
+#define jtbisect 60         // Bisection steps used to refine each inversion temperature.
+
+/// This struct is used to share the inversion curve between the pressure kernels.
+typedef struct JTCurveContext{
+    const T3JTFluid *fluid;
+    T3JTCurve *curve;
+} JTCurveContext;
+
+/// This struct is used to share a batch of throttling valves between the batch kernels.
+typedef struct JTBatchContext{
+    const T3JTFluid *fluid;
+    const double *T1;
+    const double *P1;
+    const double *P2;
+    int steps;
+    double *T2;
+} JTBatchContext;
+
+/// MARK: VARIABLE INPUT
+void JTFluidVariable(T3JTFluid *fluid)
+{
+    char input[maxstrlen];
+    int control = 0;
+    
+    memset(fluid, 0, sizeof(T3JTFluid));
+    
+    control = 1;
+    while(control == 1)
+    {
+        printf("Equation of state: van der Waals (1), Redlich-Kwong (2), Soave-Redlich-Kwong (3) or Peng-Robinson (4)? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+                fluid->eos = JTVdW;
+                control = 0;
+                break;
+            case '2':
+                fluid->eos = JTRK;
+                control = 0;
+                break;
+            case '3':
+                fluid->eos = JTSRK;
+                control = 0;
+                break;
+            case '4':
+                fluid->eos = JTPR;
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+    
+    fluid->Tc = inputDouble(0, 0, "critical temperature", "K");
+    fluid->Pc = inputDouble(0, 0, "critical pressure", "bar");
+    fluid->Pc = (fluid->Pc)*100000; // Conversion (bar to Pa)
+    if(fluid->eos == JTSRK || fluid->eos == JTPR)
+    {
+        fluid->omega = inputDouble(1, 1, "acentric factor", "[ ]");
+    }
+    fluid->cp[0] = inputDouble(1, 1, "ideal gas heat capacity constant A", "J/mol.K");
+    fluid->cp[1] = inputDouble(1, 1, "ideal gas heat capacity constant B", "J/mol.K2");
+    fluid->cp[2] = inputDouble(1, 1, "ideal gas heat capacity constant C", "J/mol.K3");
+    fluid->cp[3] = inputDouble(1, 1, "ideal gas heat capacity constant D", "J/mol.K4");
+    
+    JTFluidInit(fluid);
+}
+
+/// MARK: GENERAL CALCULATIONS
+void JTFluidInit(T3JTFluid *fluid)
+{
+    double Tc = fluid->Tc;
+    double Pc = fluid->Pc*1e-5;     // The "03CubicEOS.h" constants are in bar and cm3.
+    
+    fluid->kappa = 0.0;
+    switch(fluid->eos)
+    {
+        case JTRK:
+            fluid->ac = RKcalculateA(Tc, Pc, Tc);
+            fluid->b = RKcalculateB(Tc, Pc);
+            fluid->d1 = 1.0;
+            fluid->d2 = 0.0;
+            break;
+        case JTSRK:
+            fluid->ac = SRKcalculateA(Tc, Pc, Tc, fluid->omega);
+            fluid->b = RKcalculateB(Tc, Pc);
+            fluid->kappa = SRKcalculateAcFunc(fluid->omega);
+            fluid->d1 = 1.0;
+            fluid->d2 = 0.0;
+            break;
+        case JTPR:
+            fluid->ac = PRcalculateA(Tc, Pc, Tc, fluid->omega);
+            fluid->b = PRcalculateB(Tc, Pc);
+            fluid->kappa = PRcalculateAcFunc(fluid->omega);
+            fluid->d1 = 1.0 + sqrt(2.0);
+            fluid->d2 = 1.0 - sqrt(2.0);
+            break;
+        default:
+            fluid->ac = VdWcalculateA(Tc, Pc);
+            fluid->b = VdWcalculateB(Tc, Pc);
+            fluid->d1 = 0.0;
+            fluid->d2 = 0.0;
+            break;
+    }
+    fluid->ac = (fluid->ac)*1e-7;   // Conversion (bar.cm6/mol2 to Pa.m6/mol2)
+    fluid->b = (fluid->b)*1e-6;     // Conversion (cm3/mol to m3/mol)
+}
+
+/// This subroutine is used to calculate the attraction parameter and its first and second temperature derivatives. Redlich-Kwong uses alpha = Tr^-0.5, while the Soave alpha function, alpha = (1 + kappa(1 - Tr^0.5))^2, covers Soave-Redlich-Kwong, Peng-Robinson and (with kappa = 0) van der Waals.
+static inline void JTAttraction(const T3JTFluid *fluid, double T, double *a, double *da, double *d2a)
+{
+    double sq = sqrt(T/fluid->Tc);
+    
+    if(fluid->eos == JTRK){
+        *a = fluid->ac/sq;
+        *da = -0.5*(*a)/T;
+        *d2a = 0.75*(*a)/(T*T);
+    }else{
+        double f = 1 + fluid->kappa*(1 - sq);
+        
+        *a = fluid->ac*f*f;
+        *da = -fluid->ac*fluid->kappa*f/(sq*fluid->Tc);
+        *d2a = fluid->ac*fluid->kappa/(2*fluid->Tc*fluid->Tc)*(fluid->kappa/(sq*sq) + f/(sq*sq*sq));
+    }
+}
+
+/// This subroutine is used to calculate the reduced residual Gibbs energy of a root of the cubic, used to choose the stable root.
+static double JTGibbs(double Z, double A, double B, double d1, double d2)
+{
+    double L = (d1 == d2) ? B/Z : log((Z + d1*B)/(Z + d2*B))/(d1 - d2);
+    
+    return Z - 1 - log(Z - B) - A/B*L;
+}
+
+/// This subroutine is used to find the compressibility factor of the stable root of the generic cubic equation of state. The roots are found analytically and polished with Newton steps.
+static double JTStableRoot(double A, double B, double d1, double d2)
+{
+    double c2 = (d1 + d2 - 1)*B - 1;
+    double c1 = d1*d2*B*B - (d1 + d2)*B*(1 + B) + A;
+    double c0 = -(d1*d2*B*B*(1 + B) + A*B);
+    double p = c1 - c2*c2/3;
+    double q = 2*c2*c2*c2/27 - c2*c1/3 + c0;
+    double disc = q*q/4 + p*p*p/27;
+    double Zr[3];
+    double Z = -1.0;
+    int n = 0;
+    
+    if(disc > 0.0 || p == 0.0){
+        double s = sqrt(fmax(disc, 0.0));
+        
+        Zr[0] = cbrt(-q/2 + s) + cbrt(-q/2 - s) - c2/3;
+        n = 1;
+    }else{
+        double r = 2*sqrt(-p/3);
+        double phi = acos(fmax(-1.0, fmin(1.0, 3*q/(p*r))))/3;
+        
+        for(int k = 0; k < 3; ++k)
+        {
+            Zr[k] = r*cos(phi - 2*M_PI*k/3) - c2/3;
+        }
+        n = 3;
+    }
+    
+    for(int k = 0; k < n; ++k)
+    {
+        for(int iter = 0; iter < 2; ++iter)
+        {
+            double f = ((Zr[k] + c2)*Zr[k] + c1)*Zr[k] + c0;
+            double df = (3*Zr[k] + 2*c2)*Zr[k] + c1;
+            
+            Zr[k] = (df != 0.0) ? Zr[k] - f/df : Zr[k];
+        }
+        if(Zr[k] <= B)
+        {
+            continue;
+        }
+        if(Z < 0.0 || JTGibbs(Zr[k], A, B, d1, d2) < JTGibbs(Z, A, B, d1, d2))
+        {
+            Z = Zr[k];
+        }
+    }
+    
+    return (Z < 0.0) ? B*(1 + 1e-10) : Z;
+}
+
+void JTMuKernel(const T3JTFluid *fluid, int count, const double *T, const double *P, double *mu, double *v)
+{
+    _Alignas(64) double a[JTBlock];
+    _Alignas(64) double da[JTBlock];
+    _Alignas(64) double d2a[JTBlock];
+    _Alignas(64) double vm[JTBlock];
+    const double *c = fluid->cp;
+    double b = fluid->b;
+    double d1 = fluid->d1;
+    double d2 = fluid->d2;
+    int vdw = (d1 == d2);
+    
+    for(int base = 0; base < count; base += JTBlock)
+    {
+        int m = (count - base < JTBlock) ? count - base : JTBlock;
+        const double *t = T + base;
+        const double *p = P + base;
+        
+        //  Attraction parameter and its temperature derivatives
+        for(int i = 0; i < m; ++i)
+        {
+            JTAttraction(fluid, t[i], &a[i], &da[i], &d2a[i]);
+        }
+        
+        //  Stable roots
+        for(int i = 0; i < m; ++i)
+        {
+            double A = a[i]*p[i]/(R*R*t[i]*t[i]);
+            double B = b*p[i]/(R*t[i]);
+            
+            vm[i] = JTStableRoot(A, B, d1, d2)*R*t[i]/p[i];
+        }
+        
+        //  Derivatives of the equation of state. cp = cp(ideal gas) - R + cv(residual) - T (dP/dT)^2/(dP/dv)
+        for(int i = 0; i < m; ++i)
+        {
+            double ti = t[i];
+            double vv = vm[i];
+            double den = (vv + d1*b)*(vv + d2*b);
+            double Lb = vdw ? 1.0/vv : log((vv + d1*b)/(vv + d2*b))/((d1 - d2)*b);
+            double dPdT = R/(vv - b) - da[i]/den;
+            double dPdv = -R*ti/((vv - b)*(vv - b)) + a[i]*(2*vv + (d1 + d2)*b)/(den*den);
+            double cp = c[0] + c[1]*ti + c[2]*ti*ti + c[3]*ti*ti*ti - R + ti*d2a[i]*Lb - ti*dPdT*dPdT/dPdv;
+            
+            mu[base + i] = (-ti*dPdT/dPdv - vv)/cp;
+        }
+        if(v != NULL)
+        {
+            memcpy(v + base, vm, m*sizeof(double));
+        }
+    }
+}
+
+double JTEnthalpy(const T3JTFluid *fluid, double T, double P)
+{
+    const double *c = fluid->cp;
+    double b = fluid->b;
+    double d1 = fluid->d1;
+    double d2 = fluid->d2;
+    double a = 0.0;
+    double da = 0.0;
+    double d2a = 0.0;
+    double Z = 0.0;
+    double vv = 0.0;
+    double Lb = 0.0;
+    double h = 0.0;
+    
+    JTAttraction(fluid, T, &a, &da, &d2a);
+    Z = JTStableRoot(a*P/(R*R*T*T), b*P/(R*T), d1, d2);
+    vv = Z*R*T/P;
+    Lb = (d1 == d2) ? 1.0/vv : log((vv + d1*b)/(vv + d2*b))/((d1 - d2)*b);
+    
+    h = c[0]*(T - Tref) + c[1]*(T*T - Tref*Tref)/2.0 + c[2]*(T*T*T - Tref*Tref*Tref)/3.0 + c[3]*(T*T*T*T - Tref*Tref*Tref*Tref)/4.0;
+    h += R*T*(Z - 1) + (T*da - a)*Lb;
+    
+    return h;
+}
+
+/// This subroutine is used to find the inversion temperatures at one pressure. Going up in temperature, the coefficient turns positive at the lower inversion temperature and negative again at the upper one.
+static void JTCurveRow(const T3JTFluid *fluid, double P, double *Tlow, double *Thigh)
+{
+    double T[jtscan];
+    double Pv[jtscan];
+    double mu[jtscan];
+    double Tmin = 0.3*fluid->Tc;
+    double Tmax = 12.0*fluid->Tc;
+    
+    *Tlow = 0.0;
+    *Thigh = 0.0;
+    for(int i = 0; i < jtscan; ++i)
+    {
+        T[i] = Tmin*pow(Tmax/Tmin, (double)i/(jtscan - 1));
+        Pv[i] = P;
+    }
+    JTMuKernel(fluid, jtscan, T, Pv, mu, NULL);
+    
+    for(int i = 0; i < jtscan - 1; ++i)
+    {
+        double lo = T[i];
+        double hi = T[i + 1];
+        double vlo = 0.0;
+        double vhi = 0.0;
+        double m = 0.0;
+        int rising = (mu[i] <= 0.0 && mu[i + 1] > 0.0);
+        
+        if(rising == 0 && !(mu[i] > 0.0 && mu[i + 1] <= 0.0))
+        {
+            continue;
+        }
+        for(int iter = 0; iter < jtbisect; ++iter)
+        {
+            double mid = 0.5*(lo + hi);
+            
+            JTMuKernel(fluid, 1, &mid, &P, &m, NULL);
+            if((m > 0.0) == rising){
+                hi = mid;
+            }else{
+                lo = mid;
+            }
+        }
+        
+        // A sign change across a jump in volume is the saturation curve, not an inversion point
+        JTMuKernel(fluid, 1, &lo, &P, &m, &vlo);
+        JTMuKernel(fluid, 1, &hi, &P, &m, &vhi);
+        if(fabs(vhi - vlo) > 0.05*vlo)
+        {
+            continue;
+        }
+        if(rising){
+            *Tlow = 0.5*(lo + hi);
+        }else{
+            *Thigh = 0.5*(lo + hi);
+        }
+    }
+}
+
+/// This subroutine is used to find the inversion temperatures at a block of pressures. Used as the kernel of "parallelFor(...)".
+/// @param start First pressure in the block.
+/// @param end One past the last pressure in the block.
+/// @param context Pointer to a "JTCurveContext" struct.
+static void JTCurveKernel(int start, int end, void *context)
+{
+    JTCurveContext *ctx = context;
+    T3JTCurve *curve = ctx->curve;
+    
+    for(int i = start; i < end; ++i)
+    {
+        JTCurveRow(ctx->fluid, curve->P[i], &curve->Tlow[i], &curve->Thigh[i]);
+    }
+}
+
+T3JTCurve JTInversionCurve(const T3JTFluid *fluid, double Pmax, int rows)
+{
+    T3JTCurve curve = {0};
+    JTCurveContext ctx = {fluid, &curve};
+    
+    curve.P = calloc(rows, sizeof(double));
+    curve.Tlow = calloc(rows, sizeof(double));
+    curve.Thigh = calloc(rows, sizeof(double));
+    if(curve.P == NULL || curve.Tlow == NULL || curve.Thigh == NULL)
+    {
+        printf("Memory could not be allocated for the inversion curve.\n");
+        JTCurveFree(&curve);
+        return curve;
+    }
+    curve.rows = rows;
+    
+    for(int i = 0; i < rows; ++i)
+    {
+        curve.P[i] = Pmax*(i + 1)/rows;
+    }
+    parallelFor(rows, 1, JTCurveKernel, &ctx);
+    
+    return curve;
+}
+
+T3JTPath JTThrottlePath(const T3JTFluid *fluid, double T1, double P1, double P2, int steps)
+{
+    T3JTPath path = {0};
+    double dP = (P2 - P1)/steps;
+    
+    path.P = calloc(steps + 1, sizeof(double));
+    path.T = calloc(steps + 1, sizeof(double));
+    path.mu = calloc(steps + 1, sizeof(double));
+    if(path.P == NULL || path.T == NULL || path.mu == NULL)
+    {
+        printf("Memory could not be allocated for the throttling path.\n");
+        JTPathFree(&path);
+        return path;
+    }
+    path.rows = steps + 1;
+    
+    path.P[0] = P1;
+    path.T[0] = T1;
+    for(int k = 0; k < steps; ++k)
+    {
+        double T = path.T[k];
+        double P = path.P[k];
+        double Ts = 0.0;
+        double Ps = 0.0;
+        double k1 = 0.0;
+        double k2 = 0.0;
+        double k3 = 0.0;
+        double k4 = 0.0;
+        
+        JTMuKernel(fluid, 1, &T, &P, &k1, NULL);
+        Ts = T + 0.5*dP*k1;
+        Ps = P + 0.5*dP;
+        JTMuKernel(fluid, 1, &Ts, &Ps, &k2, NULL);
+        Ts = T + 0.5*dP*k2;
+        JTMuKernel(fluid, 1, &Ts, &Ps, &k3, NULL);
+        Ts = T + dP*k3;
+        Ps = (k == steps - 1) ? P2 : P + dP;
+        JTMuKernel(fluid, 1, &Ts, &Ps, &k4, NULL);
+        
+        path.mu[k] = k1;
+        path.T[k + 1] = T + dP*(k1 + 2*k2 + 2*k3 + k4)/6;
+        path.P[k + 1] = Ps;
+    }
+    JTMuKernel(fluid, 1, &path.T[steps], &path.P[steps], &path.mu[steps], NULL);
+    path.drift = JTEnthalpy(fluid, path.T[steps], P2) - JTEnthalpy(fluid, T1, P1);
+    
+    return path;
+}
+
+/// This subroutine is used to integrate a block of throttling paths, advancing "JTBlock" paths together through each Runge-Kutta stage. Used as the kernel of "parallelFor(...)".
+/// @param start First valve in the block.
+/// @param end One past the last valve in the block.
+/// @param context Pointer to a "JTBatchContext" struct.
+static void JTBatchKernel(int start, int end, void *context)
+{
+    JTBatchContext *ctx = context;
+    _Alignas(64) double T[JTBlock];
+    _Alignas(64) double P[JTBlock];
+    _Alignas(64) double dP[JTBlock];
+    _Alignas(64) double Ts[JTBlock];
+    _Alignas(64) double Ps[JTBlock];
+    _Alignas(64) double k[JTBlock];
+    _Alignas(64) double sum[JTBlock];
+    
+    for(int base = start; base < end; base += JTBlock)
+    {
+        int m = (end - base < JTBlock) ? end - base : JTBlock;
+        
+        for(int i = 0; i < m; ++i)
+        {
+            T[i] = ctx->T1[base + i];
+            P[i] = ctx->P1[base + i];
+            dP[i] = (ctx->P2[base + i] - P[i])/ctx->steps;
+        }
+        for(int step = 0; step < ctx->steps; ++step)
+        {
+            JTMuKernel(ctx->fluid, m, T, P, k, NULL);
+            for(int i = 0; i < m; ++i)
+            {
+                sum[i] = k[i];
+                Ts[i] = T[i] + 0.5*dP[i]*k[i];
+                Ps[i] = P[i] + 0.5*dP[i];
+            }
+            JTMuKernel(ctx->fluid, m, Ts, Ps, k, NULL);
+            for(int i = 0; i < m; ++i)
+            {
+                sum[i] += 2*k[i];
+                Ts[i] = T[i] + 0.5*dP[i]*k[i];
+            }
+            JTMuKernel(ctx->fluid, m, Ts, Ps, k, NULL);
+            for(int i = 0; i < m; ++i)
+            {
+                sum[i] += 2*k[i];
+                Ts[i] = T[i] + dP[i]*k[i];
+                Ps[i] = P[i] + dP[i];
+            }
+            JTMuKernel(ctx->fluid, m, Ts, Ps, k, NULL);
+            for(int i = 0; i < m; ++i)
+            {
+                T[i] += dP[i]*(sum[i] + k[i])/6;
+                P[i] = Ps[i];
+            }
+        }
+        for(int i = 0; i < m; ++i)
+        {
+            ctx->T2[base + i] = T[i];
+        }
+    }
+}
+
+void JTThrottleBatch(const T3JTFluid *fluid, int count, const double *T1, const double *P1, const double *P2, int steps, double *T2)
+{
+    JTBatchContext ctx = {fluid, T1, P1, P2, steps, T2};
+    
+    parallelFor(count, JTBlock, JTBatchKernel, &ctx);
+}
+
+void JTCurveFree(T3JTCurve *curve)
+{
+    free(curve->P);
+    free(curve->Tlow);
+    free(curve->Thigh);
+    memset(curve, 0, sizeof(T3JTCurve));
+}
+
+void JTPathFree(T3JTPath *path)
+{
+    free(path->P);
+    free(path->T);
+    free(path->mu);
+    memset(path, 0, sizeof(T3JTPath));
+}
+
+/// MARK: DISPLAY AND WRITE
+/// This subroutine is used to print the results to a writer. Used by both "JTInversionDisplay(...)" and "JTInversionWrite(...)".
+static void JTInversionPrint(ResultWriter *w, const T3JTFluid *fluid, T3JTCurve curve, T3JTPath path, int count, const double *T1, const double *P1, double P2, const double *T2)
+{
+    const char *eos[] = {"van der Waals", "Redlich-Kwong", "Soave-Redlich-Kwong", "Peng-Robinson"};
+    
+    writerPrintf(w, "_Joule-Thomson_Inversion_and_Throttling_Results_\n");
+    writerPrintf(w, "\tInput parameters:\n");
+    writerPrintf(w, "Equation of state: %s\n", eos[fluid->eos]);
+    writerPrintf(w, "Critical temperature:\n");
+    writerPrintf(w, "Tc =\t%.3f\tK\n", fluid->Tc);
+    writerPrintf(w, "Critical pressure:\n");
+    writerPrintf(w, "Pc =\t%.3f\tbar\n", fluid->Pc*1e-5);
+    if(fluid->eos == JTSRK || fluid->eos == JTPR)
+    {
+        writerPrintf(w, "Acentric factor:\n");
+        writerPrintf(w, "omega =\t%.4f\t[ ]\n", fluid->omega);
+    }
+    writerPrintf(w, "Equation of state parameters:\n");
+    writerPrintf(w, "ac =\t%.6g\tPa.m6/mol2\n", fluid->ac);
+    writerPrintf(w, "b =\t%.6g\tm3/mol\n\n", fluid->b);
+    
+    if(curve.rows > 0)
+    {
+        writerPrintf(w, "\tInversion curve:\n");
+        writerPrintf(w, "P (kPa)\tPr (-)\tTlow (K)\tThigh (K)\tTlow/Tc (-)\tThigh/Tc (-)\n");
+        for(int i = 0; i < curve.rows; ++i)
+        {
+            writerPrintf(w, "%.3f\t%.4f\t", curve.P[i]*0.001, curve.P[i]/fluid->Pc);
+            if(curve.Tlow[i] > 0.0){
+                writerPrintf(w, "%.3f\t", curve.Tlow[i]);
+            }else{
+                writerPrintf(w, "-\t");
+            }
+            if(curve.Thigh[i] > 0.0){
+                writerPrintf(w, "%.3f\t", curve.Thigh[i]);
+            }else{
+                writerPrintf(w, "-\t");
+            }
+            writerPrintf(w, "%.4f\t%.4f\n", curve.Tlow[i]/fluid->Tc, curve.Thigh[i]/fluid->Tc);
+        }
+        writerPrintf(w, "\n");
+    }
+    
+    if(path.rows > 0)
+    {
+        int last = path.rows - 1;
+        
+        writerPrintf(w, "\tThrottling path:\n");
+        writerPrintf(w, "Inlet state:\n");
+        writerPrintf(w, "T1 =\t%.3f\tdeg C\n", path.T[0] - 273.15);
+        writerPrintf(w, "P1 =\t%.3f\tkPa\n", path.P[0]*0.001);
+        writerPrintf(w, "Outlet state:\n");
+        writerPrintf(w, "T2 =\t%.3f\tdeg C\n", path.T[last] - 273.15);
+        writerPrintf(w, "P2 =\t%.3f\tkPa\n", path.P[last]*0.001);
+        writerPrintf(w, "Temperature change:\n");
+        writerPrintf(w, "dT =\t%.4f\tK\n", path.T[last] - path.T[0]);
+        writerPrintf(w, "Enthalpy change along the integrated path:\n");
+        writerPrintf(w, "dh =\t%.3g\tJ/mol\n\n", path.drift);
+        writerPrintf(w, "P (kPa)\tT (deg C)\tmu_JT (K/bar)\n");
+        for(int i = 0; i < path.rows; ++i)
+        {
+            writerPrintf(w, "%.3f\t%.4f\t%.6f\n", path.P[i]*0.001, path.T[i] - 273.15, path.mu[i]*1e5);
+        }
+        writerPrintf(w, "\n");
+    }
+    
+    if(count > 0)
+    {
+        writerPrintf(w, "\tValve outlet temperatures (outlet pressure %.3f kPa):\n", P2*0.001);
+        writerPrintf(w, "T1 (deg C)\tP1 (kPa)\tT2 (deg C)\tdT (K)\n");
+        for(int i = 0; i < count; ++i)
+        {
+            writerPrintf(w, "%.3f\t%.3f\t%.3f\t%.4f\n", T1[i] - 273.15, P1[i]*0.001, T2[i] - 273.15, T2[i] - T1[i]);
+        }
+    }
+}
+
+void JTInversionDisplay(const T3JTFluid *fluid, T3JTCurve curve, T3JTPath path, int count, const double *T1, const double *P1, double P2, const double *T2)
+{
+    ResultWriter w;             // Console writer for the results.
+    
+    if(writerConsole(&w))
+    {
+        JTInversionPrint(&w, fluid, curve, path, count, T1, P1, P2, T2);
+        writerClose(&w);
+    }
+}
+
+void JTInversionWrite(const T3JTFluid *fluid, T3JTCurve curve, T3JTPath path, int count, const double *T1, const double *P1, double P2, const double *T2)
+{
+    //  Function variables
+    ResultWriter w;             // Buffered writer for the results file.
+    
+    //  Set file name as timestamp + JT Inversion Results
+    if(!writerOpen(&w, "JT Inversion Results"))
+    {
+        return;
+    }
+    
+    //  Write to file
+    JTInversionPrint(&w, fluid, curve, path, count, T1, P1, P2, T2);
+    
+    //  Close file
+    writerClose(&w);
+}
+
+void JTInversionWriteSwitch(const T3JTFluid *fluid, T3JTCurve curve, T3JTPath path, int count, const double *T1, const double *P1, double P2, const double *T2)
+{
+    int control = 0;
+    
+    control = 1;
+    while(control == 1)
+    {
+        char input[maxstrlen];
+        
+        printf("Do you want to save results to file? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+            case 'T':
+            case 'Y':
+            case 't':
+            case 'y':
+                JTInversionWrite(fluid, curve, path, count, T1, P1, P2, T2);
+                control = 0;
+                break;
+            case '0':
+            case 'F':
+            case 'N':
+            case 'f':
+            case 'n':
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+}
+
+/// MARK: PSEUDO-MAIN FUNCTION
+void JouleThomsonInversion(void)
+{
+    int whilmain = 0;
+    printf("Joule-Thomson Inversion Curve and Throttling\n");
+    
+    whilmain = 1;
+    while(whilmain == 1)
+    {
+        //  Variable declaration
+        char input[maxstrlen];
+        T3JTFluid fluid;                // Gas description.
+        T3JTCurve curve = {0};          // Inversion curve.
+        T3JTPath path = {0};            // Throttling path.
+        double *T1 = NULL;              // Inlet temperatures of the valve batch.
+        double *P1 = NULL;              // Inlet pressures of the valve batch.
+        double *P2v = NULL;             // Outlet pressures of the valve batch.
+        double *T2 = NULL;              // Outlet temperatures of the valve batch.
+        double P2 = 0.0;                // Outlet pressure.
+        int count = 0;                  // Number of valves in the batch.
+        int mode = 0;                   // Calculation selected.
+        int control = 0;
+        
+        double Pmax = 0.0;              // Largest pressure of the inversion curve.
+        int rows = 0;                   // Number of pressures on the inversion curve.
+        double Tin = 0.0;               // Valve inlet temperature.
+        double Pin = 0.0;               // Valve inlet pressure.
+        double Tlast = 0.0;             // Last inlet temperature of the batch.
+        double Plast = 0.0;             // Last inlet pressure of the batch.
+        int nT = 0;                     // Number of inlet temperatures in the batch.
+        int nP = 0;                     // Number of inlet pressures in the batch.
+        int steps = 0;                  // Pressure steps along each throttling path.
+        
+            //  Variables for timing function
+        struct timespec start, end;
+        double elapsed = 0.0;
+        
+        //  Data Collection
+        JTFluidVariable(&fluid);
+        
+        control = 1;
+        while(control == 1)
+        {
+            printf("Please select a calculation:\n1. Inversion curve\n2. Throttling path of one valve\n3. Outlet temperatures of a batch of valves\n");
+            printf("Selection [1 - 3]: ");
+            fgets(input, sizeof(input), stdin);
+            mode = input[0] - '0';
+            if(mode >= 1 && mode <= 3){
+                control = 0;
+            }else{
+                printf("Input not recognised\n");
+            }
+        }
+        
+        if(mode == 1)
+        {
+            Pmax = inputDouble(0, 0, "largest reduced pressure, P/Pc", "[ ]");
+            Pmax = (Pmax)*fluid.Pc;
+            rows = (int)inputDouble(0, 0, "number of pressures", "[ ]");
+        }
+        if(mode == 2)
+        {
+            Tin = inputDouble(1, 1, "valve inlet temperature", "deg C");
+            Tin = (Tin) + 273.15;
+            Pin = inputDouble(0, 0, "valve inlet pressure", "kPa");
+            Pin = (Pin)*1000;
+        }
+        if(mode == 3)
+        {
+            Tin = inputDouble(1, 1, "first valve inlet temperature", "deg C");
+            Tin = (Tin) + 273.15;
+            Tlast = inputDouble(1, 1, "last valve inlet temperature", "deg C");
+            Tlast = (Tlast) + 273.15;
+            nT = (int)inputDouble(0, 0, "number of inlet temperatures", "[ ]");
+            Pin = inputDouble(0, 0, "first valve inlet pressure", "kPa");
+            Pin = (Pin)*1000;
+            Plast = inputDouble(0, 0, "last valve inlet pressure", "kPa");
+            Plast = (Plast)*1000;
+            nP = (int)inputDouble(0, 0, "number of inlet pressures", "[ ]");
+        }
+        if(mode == 2 || mode == 3)
+        {
+            P2 = inputDouble(0, 0, "valve outlet pressure", "kPa");
+            P2 = (P2)*1000;
+            steps = (int)inputDouble(0, 0, "number of pressure steps along each path", "[ ]");
+        }
+        
+        //  Running calculations
+        clock_getres(CLOCK_MONOTONIC, &start);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        
+        if(mode == 1)
+        {
+            curve = JTInversionCurve(&fluid, Pmax, rows);
+        }
+        if(mode == 2)
+        {
+            path = JTThrottlePath(&fluid, Tin, Pin, P2, steps);
+        }
+        if(mode == 3)
+        {
+            count = nT*nP;
+            T1 = calloc(count, sizeof(double));
+            P1 = calloc(count, sizeof(double));
+            P2v = calloc(count, sizeof(double));
+            T2 = calloc(count, sizeof(double));
+            if(T1 == NULL || P1 == NULL || P2v == NULL || T2 == NULL)
+            {
+                printf("Memory could not be allocated for the valve batch.\n");
+                count = 0;
+            }
+            for(int i = 0; i < count; ++i)
+            {
+                int iT = i/nP;
+                int iP = i%nP;
+                
+                T1[i] = (nT == 1) ? Tin : Tin + (Tlast - Tin)*iT/(nT - 1);
+                P1[i] = (nP == 1) ? Pin : Pin + (Plast - Pin)*iP/(nP - 1);
+                P2v[i] = P2;
+            }
+            JTThrottleBatch(&fluid, count, T1, P1, P2v, steps, T2);
+        }
+        
+        clock_getres(CLOCK_MONOTONIC, &end);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        
+        elapsed = timer(start, end);
+        
+        printf("Calculations completed in %.6f seconds.\n", elapsed);
+        
+        //  Displaying results
+        JTInversionDisplay(&fluid, curve, path, count, T1, P1, P2, T2);
+        
+        //  Writing to File
+        JTInversionWriteSwitch(&fluid, curve, path, count, T1, P1, P2, T2);
+        
+        JTCurveFree(&curve);
+        JTPathFree(&path);
+        free(T1);
+        free(P1);
+        free(P2v);
+        free(T2);
+        
+        //  Continue function
+        whilmain = Continue(whilmain);
+    }
+    fflush(stdout);
+}
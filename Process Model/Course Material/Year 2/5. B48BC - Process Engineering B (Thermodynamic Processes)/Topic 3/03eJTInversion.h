@@ -0,0 +1,164 @@
+//
+//  03eJTInversion.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef _3eJTInversionStruct_h
+#define _3eJTInversionStruct_h
+
+//  Cubic equations of state
+#define JTVdW 0             // van der Waals.
+#define JTRK 1              // Redlich-Kwong.
+#define JTSRK 2             // Soave-Redlich-Kwong.
+#define JTPR 3              // Peng-Robinson.
+
+#define JTBlock 64          // Number of states evaluated together by "JTMuKernel(...)".
+
+typedef struct T3JTFluid{
+    int eos;                // Cubic equation of state.
+    double Tc;              // Critical temperature (K).
+    double Pc;              // Critical pressure (Pa).
+    double omega;           // Acentric factor ([ ]).
+    double cp[4];           // Ideal gas heat capacity, cp = cp[0] + cp[1] T + cp[2] T^2 + cp[3] T^3 (J/mol.K).
+    //  Set by "JTFluidInit(...)"
+    double ac;              // Attraction parameter at the critical temperature (Pa.m6/mol2).
+    double b;               // Co-volume (m3/mol).
+    double kappa;           // Slope of the Soave alpha function ([ ]).
+    double d1;              // First denominator constant, P = RT/(v - b) - a/((v + d1 b)(v + d2 b)).
+    double d2;              // Second denominator constant.
+} T3JTFluid;
+
+typedef struct T3JTCurve{
+    int rows;               // Number of pressures.
+    double *P;              // Pressure (Pa).
+    double *Tlow;           // Lower inversion temperature, or zero when there is none (K).
+    double *Thigh;          // Upper inversion temperature, or zero when there is none (K).
+} T3JTCurve;
+
+typedef struct T3JTPath{
+    int rows;               // Number of points along the path.
+    double *P;              // Pressure (Pa).
+    double *T;              // Temperature (K).
+    double *mu;             // Joule-Thomson coefficient (K/Pa).
+    double drift;           // Enthalpy change between the ends of the integrated path (J/mol).
+} T3JTPath;
+
+#endif /* _3eJTInversionStruct_h */
+
+#ifndef _3eJTInversionVariable_h
+#define _3eJTInversionVariable_h
+
+/// This subroutine is used to collect the equation of state, critical properties and ideal gas heat capacity of a pure gas.
+/// @param fluid Struct where the gas description should be stored.
+void JTFluidVariable(T3JTFluid *fluid);
+
+#endif /* _3eJTInversionVariable_h */
+
+#ifndef _3eJTInversionCalculation_h
+#define _3eJTInversionCalculation_h
+
+/// This subroutine is used to calculate the co-volume, critical attraction parameter and alpha function slope of the chosen equation of state from the "03CubicEOS" constants.
+/// @param fluid Gas description.
+void JTFluidInit(T3JTFluid *fluid);
+
+/// This subroutine is used to calculate the Joule-Thomson coefficient, mu = (T (dv/dT)_P - v)/cp, at many states with the cubic equation of state. The states are taken in blocks of "JTBlock". The attraction parameter and its temperature derivatives, and then the derivatives of the equation of state, are each evaluated in straight loops over the block so they can be vectorised; only the cubic roots are found one state at a time. The root with the lowest Gibbs energy is used.
+/// @param fluid Gas description.
+/// @param count Number of states.
+/// @param T Temperatures (K).
+/// @param P Pressures (Pa).
+/// @param mu Array where the Joule-Thomson coefficients should be stored (K/Pa).
+/// @param v Array where the molar volumes should be stored, or NULL (m3/mol).
+void JTMuKernel(const T3JTFluid *fluid, int count, const double *T, const double *P, double *mu, double *v);
+
+/// This subroutine is used to calculate the molar enthalpy of the gas relative to the ideal gas at 25 deg C.
+/// @param fluid Gas description.
+/// @param T Temperature (K).
+/// @param P Pressure (Pa).
+double JTEnthalpy(const T3JTFluid *fluid, double T, double P);
+
+/// This subroutine is used to trace the Joule-Thomson inversion curve, mu = 0, over evenly spaced pressures up to "Pmax". At each pressure the coefficient is scanned over temperature with "JTMuKernel(...)" and every sign change is refined by bisection. Sign changes caused by a jump between the liquid and vapour roots are discarded. The pressures are split across the worker threads.
+/// @param fluid Gas description.
+/// @param Pmax Largest pressure (Pa).
+/// @param rows Number of pressures.
+T3JTCurve JTInversionCurve(const T3JTFluid *fluid, double Pmax, int rows);
+
+/// This subroutine is used to integrate an isenthalpic throttling path, dT/dP = mu, from the inlet state to the outlet pressure with the fourth order Runge-Kutta method. The path is assumed to stay in one phase.
+/// @param fluid Gas description.
+/// @param T1 Inlet temperature (K).
+/// @param P1 Inlet pressure (Pa).
+/// @param P2 Outlet pressure (Pa).
+/// @param steps Number of pressure steps.
+T3JTPath JTThrottlePath(const T3JTFluid *fluid, double T1, double P1, double P2, int steps);
+
+/// This subroutine is used to find the outlet temperatures of many throttling valves at once. The paths are split across the worker threads, and each Runge-Kutta stage evaluates a block of paths with one call of "JTMuKernel(...)".
+/// @param fluid Gas description.
+/// @param count Number of valves.
+/// @param T1 Inlet temperatures (K).
+/// @param P1 Inlet pressures (Pa).
+/// @param P2 Outlet pressures (Pa).
+/// @param steps Number of pressure steps along each path.
+/// @param T2 Array where the outlet temperatures should be stored (K).
+void JTThrottleBatch(const T3JTFluid *fluid, int count, const double *T1, const double *P1, const double *P2, int steps, double *T2);
+
+/// This subroutine is used to free the arrays of an inversion curve.
+/// @param curve Inversion curve.
+void JTCurveFree(T3JTCurve *curve);
+
+/// This subroutine is used to free the arrays of a throttling path.
+/// @param path Throttling path.
+void JTPathFree(T3JTPath *path);
+
+#endif /* _3eJTInversionCalculation_h */
+
+#ifndef _3eJTInversionDisplay_h
+#define _3eJTInversionDisplay_h
+
+/// This subroutine is used to output the inversion curve, throttling path or batch of valve outlet temperatures to the user console.
+/// @param fluid Gas description.
+/// @param curve Inversion curve, or an empty curve.
+/// @param path Throttling path, or an empty path.
+/// @param count Number of valves in the batch.
+/// @param T1 Inlet temperatures of the batch (K).
+/// @param P1 Inlet pressures of the batch (Pa).
+/// @param P2 Outlet pressure of the batch (Pa).
+/// @param T2 Outlet temperatures of the batch (K).
+void JTInversionDisplay(const T3JTFluid *fluid, T3JTCurve curve, T3JTPath path, int count, const double *T1, const double *P1, double P2, const double *T2);
+
+/// This subroutine is used to write the inversion curve, throttling path or batch of valve outlet temperatures to a .txt file.
+/// @param fluid Gas description.
+/// @param curve Inversion curve, or an empty curve.
+/// @param path Throttling path, or an empty path.
+/// @param count Number of valves in the batch.
+/// @param T1 Inlet temperatures of the batch (K).
+/// @param P1 Inlet pressures of the batch (Pa).
+/// @param P2 Outlet pressure of the batch (Pa).
+/// @param T2 Outlet temperatures of the batch (K).
+void JTInversionWrite(const T3JTFluid *fluid, T3JTCurve curve, T3JTPath path, int count, const double *T1, const double *P1, double P2, const double *T2);
+
+/// This subroutine is used to check if the user would like to write the results to a file.
+/// @param fluid Gas description.
+/// @param curve Inversion curve, or an empty curve.
+/// @param path Throttling path, or an empty path.
+/// @param count Number of valves in the batch.
+/// @param T1 Inlet temperatures of the batch (K).
+/// @param P1 Inlet pressures of the batch (Pa).
+/// @param P2 Outlet pressure of the batch (Pa).
+/// @param T2 Outlet temperatures of the batch (K).
+void JTInversionWriteSwitch(const T3JTFluid *fluid, T3JTCurve curve, T3JTPath path, int count, const double *T1, const double *P1, double P2, const double *T2);
+
+#endif /* _3eJTInversionDisplay_h */
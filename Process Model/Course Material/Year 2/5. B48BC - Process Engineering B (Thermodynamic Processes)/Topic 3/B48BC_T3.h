@@ -31,4 +31,10 @@ void MultistageCompressor(void);
 /// This subroutine is used to estimate the total shaft work for a multistage gas compressor using the pressure-temperature statement of an adiabatic process assuming complete intercooling between stages.
 void MultistageShaftWork(void);
 
+/// This subroutine is used to find the number of stages and interstage pressures that minimise the shaft power and intercooling cost of a multistage gas compressor, allowing for intercooler approach temperatures, pressure drops and a stage discharge temperature limit.
+void MultistageOptimiser(void);
+
+/// This subroutine is used to trace the Joule-Thomson inversion curve over pressure with a cubic equation of state, and to integrate isenthalpic throttling paths to find the outlet temperatures of valves and let-down stations, singly or for a batch of inlet conditions.
+void JouleThomsonInversion(void);
+
 #endif /* B48BC_T3_h */
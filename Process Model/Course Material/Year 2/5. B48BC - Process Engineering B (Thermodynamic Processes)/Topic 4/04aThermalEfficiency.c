@@ -29,6 +29,7 @@
 
 //Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BC_T4.h"
 #include "04aThermalEfficiency.h"
 
@@ -142,98 +143,59 @@ void ThermEffDisplay(int method, double wnet, double qhot, double qcold, double
 void ThermEffWrite(int method, double wnet, double qhot, double qcold, double THot, double TCold, double eta, double etac)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
     //  Set file name as timestamp + Thermal Efficiency Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Thermal Efficiency Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, "Thermal Efficiency Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
-    fprintf(fp, "_Thermal_Efficiency_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
+    writerPrintf(&w, "_Thermal_Efficiency_Results_\n");
+    writerPrintf(&w, "\tInput parameters:\n");
     if(method == 1)
     {
-        fprintf(fp, "Specific net work:\n");
-        fprintf(fp, "w_net =\t%.3f\tkJ/kg\n", wnet);
+        writerPrintf(&w, "Specific net work:\n");
+        writerPrintf(&w, "w_net =\t%.3f\tkJ/kg\n", wnet);
     }
     if(method == 2)
     {
-        fprintf(fp, "Specific heat sent to cold reservoir:\n");
-        fprintf(fp, "qcold =\t%.3f\tkJ/kg\n", qcold);
+        writerPrintf(&w, "Specific heat sent to cold reservoir:\n");
+        writerPrintf(&w, "qcold =\t%.3f\tkJ/kg\n", qcold);
     }
     if(method == 1 || method == 2)
     {
-        fprintf(fp, "Specific heat received from hot reservoir:\n");
-        fprintf(fp, "qhot =\t%.3f\tkJ/kg\n\n", qhot);
+        writerPrintf(&w, "Specific heat received from hot reservoir:\n");
+        writerPrintf(&w, "qhot =\t%.3f\tkJ/kg\n\n", qhot);
         
-        fprintf(fp, "Equivalent Carnot cycle parameters.\n");
-        fprintf(fp, "Cold reservoir Temperature:\n");
-        fprintf(fp, "T_cold =\t%.3f\tK\n", TCold);
-        fprintf(fp, "Hot reservoir Temperature:\n");
-        fprintf(fp, "T_hot =\t%.3f\tK\n\n", THot);
+        writerPrintf(&w, "Equivalent Carnot cycle parameters.\n");
+        writerPrintf(&w, "Cold reservoir Temperature:\n");
+        writerPrintf(&w, "T_cold =\t%.3f\tK\n", TCold);
+        writerPrintf(&w, "Hot reservoir Temperature:\n");
+        writerPrintf(&w, "T_hot =\t%.3f\tK\n\n", THot);
     }
     
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "Thermal efficiency of process:\n");
-    fprintf(fp, "eta =\t%.4f\t%%\n", eta);
-    fprintf(fp, "Equivalent Carnot cycle thermal efficiency:\n");
-    fprintf(fp, "eta_carnot =\t%.4f\t%%\n", etac);
+    writerPrintf(&w, "\tOutput parameters:\n");
+    writerPrintf(&w, "Thermal efficiency of process:\n");
+    writerPrintf(&w, "eta =\t%.4f\t%%\n", eta);
+    writerPrintf(&w, "Equivalent Carnot cycle thermal efficiency:\n");
+    writerPrintf(&w, "eta_carnot =\t%.4f\t%%\n", etac);
     
     if(eta == etac)
     {
-        fprintf(fp, "Your process is reversible\n");
+        writerPrintf(&w, "Your process is reversible\n");
     }else{
         if(eta < etac)
         {
-            fprintf(fp, "Your process is irreversible\n");
+            writerPrintf(&w, "Your process is irreversible\n");
         }else{
-            fprintf(fp, "Your process violates the second law.\n");
+            writerPrintf(&w, "Your process violates the second law.\n");
         }
     }
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void ThermEffWriteSwitch(int method, double wnet, double qhot, double qcold, double THot, double TCold, double eta, double etac)
@@ -29,6 +29,7 @@
 
 //Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BC_T4.h"
 #include "04bCoefficientofPerformance.h"
 
@@ -186,115 +187,76 @@ void CoPDisplay(int method, double wnet, double qhot, double qcold, double THot,
 void CoPWrite(int method, double wnet, double qhot, double qcold, double THot, double TCold, double CoP, double CoPRev, double eta, double etac)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
-    //  Set file name as timestamp + Polytropic Process Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " [Program Name] Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    //  Set file name as timestamp + [Program Name] Results
+    if(!writerOpen(&w, "[Program Name] Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
-    fprintf(fp, "_Thermal_Efficiency_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
+    writerPrintf(&w, "_Thermal_Efficiency_Results_\n");
+    writerPrintf(&w, "\tInput parameters:\n");
     if(method == 1)
     {
         //Fridge selected
-        fprintf(fp, "Specific heat received from cold reservoir:\n");
-        fprintf(fp, "q_cold =\t%.3f\tkJ/kg\n", qcold);
+        writerPrintf(&w, "Specific heat received from cold reservoir:\n");
+        writerPrintf(&w, "q_cold =\t%.3f\tkJ/kg\n", qcold);
     }
     if(method == 2)
     {
         //Heat pump selected
-        fprintf(fp, "Specific heat supplied to hot reservoir:\n");
-        fprintf(fp, "q_hot =\t%.3f\tkJ/kg\n", qhot);
+        writerPrintf(&w, "Specific heat supplied to hot reservoir:\n");
+        writerPrintf(&w, "q_hot =\t%.3f\tkJ/kg\n", qhot);
     }
     
-    fprintf(fp, "Specific net work:\n");
-    fprintf(fp, "w_net =\t%.3f\tkJ/kg\n\n", wnet);
+    writerPrintf(&w, "Specific net work:\n");
+    writerPrintf(&w, "w_net =\t%.3f\tkJ/kg\n\n", wnet);
     
-    fprintf(fp, "Hot reservoir temperature:\n");
-    fprintf(fp, "T_Hot =\t%.3f\tkJ/kg\n", THot);
-    fprintf(fp, "Cold reservoir temperature:\n");
-    fprintf(fp, "T_cold =\t%.3f\tkJ/kg\n", TCold);
+    writerPrintf(&w, "Hot reservoir temperature:\n");
+    writerPrintf(&w, "T_Hot =\t%.3f\tkJ/kg\n", THot);
+    writerPrintf(&w, "Cold reservoir temperature:\n");
+    writerPrintf(&w, "T_cold =\t%.3f\tkJ/kg\n", TCold);
     
-    fprintf(fp, "\tOutput parameters:\n");
+    writerPrintf(&w, "\tOutput parameters:\n");
     if(method == 1)
     {
-        fprintf(fp, "Coefficient of Performance:\n");
-        fprintf(fp, "CoP_fridge =\t%.3f\t[ ]\n", CoP);
-        fprintf(fp, "Thermal efficiency:\n");
-        fprintf(fp, "eta_fridge =\t%.3f\t%%\n\n", eta);
+        writerPrintf(&w, "Coefficient of Performance:\n");
+        writerPrintf(&w, "CoP_fridge =\t%.3f\t[ ]\n", CoP);
+        writerPrintf(&w, "Thermal efficiency:\n");
+        writerPrintf(&w, "eta_fridge =\t%.3f\t%%\n\n", eta);
         
-        fprintf(fp, "Reversible Coefficient of Performance:\n");
-        fprintf(fp, "CoP_{fridge}^{Rev} =\t%.3f\t[ ]\n", CoPRev);
+        writerPrintf(&w, "Reversible Coefficient of Performance:\n");
+        writerPrintf(&w, "CoP_{fridge}^{Rev} =\t%.3f\t[ ]\n", CoPRev);
     }
     if(method == 2)
     {
-        fprintf(fp, "Coefficient of Performance:\n");
-        fprintf(fp, "CoP_{heat pump} =\t%.3f\t[ ]\n", CoP);
-        fprintf(fp, "Thermal efficiency:\n");
-        fprintf(fp, "eta_{heat pump} =\t%.3f\t%%\n\n", eta);
+        writerPrintf(&w, "Coefficient of Performance:\n");
+        writerPrintf(&w, "CoP_{heat pump} =\t%.3f\t[ ]\n", CoP);
+        writerPrintf(&w, "Thermal efficiency:\n");
+        writerPrintf(&w, "eta_{heat pump} =\t%.3f\t%%\n\n", eta);
         
-        fprintf(fp, "Reversible Coefficient of Performance:\n");
-        fprintf(fp, "CoP_{heat pump}^{Rev} =\t%.3f\t[ ]\n", CoPRev);
+        writerPrintf(&w, "Reversible Coefficient of Performance:\n");
+        writerPrintf(&w, "CoP_{heat pump}^{Rev} =\t%.3f\t[ ]\n", CoPRev);
     }
-    fprintf(fp, "Reversible thermal efficiency:\n");
-    fprintf(fp, "eta_Carnot =\t%.3f\t%%\n\n", etac);
+    writerPrintf(&w, "Reversible thermal efficiency:\n");
+    writerPrintf(&w, "eta_Carnot =\t%.3f\t%%\n\n", etac);
     
     if(CoP == CoPRev)
     {
-        fprintf(fp, "This process is reversible.\n");
+        writerPrintf(&w, "This process is reversible.\n");
     }else{
         if(CoP < CoPRev)
         {
-            fprintf(fp, "This process is irreversible.\n");
+            writerPrintf(&w, "This process is irreversible.\n");
         }else{
-            fprintf(fp, "This process violates the second law.\n");
+            writerPrintf(&w, "This process violates the second law.\n");
         }
     }
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void CoPWriteSwitch(int method, double wnet, double qhot, double qcold, double THot, double TCold, double CoP, double CoPRev, double eta, double etac)
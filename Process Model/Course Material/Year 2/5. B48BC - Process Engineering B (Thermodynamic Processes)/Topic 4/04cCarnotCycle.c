@@ -29,6 +29,7 @@
 
 //Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "IdealGasLaw.h"
 #include "01bIsothermal.h"
 #include "01eAdiabatic.h"
@@ -324,136 +325,109 @@ void CarnotDisplay(double P1, double P2, double P3, double P4, double THot, doub
 void CarnotWrite(double P1, double P2, double P3, double P4, double THot, double TCold, double n, double gamma1, double gamma2, T4CarnotProfile profile, double worknet, double qhot, double qcold)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
-    //  Set file name as timestamp + Carnot Cycle Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Carnot Cycle Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
-    }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
+    double *total = malloc(sizeof(double)*3*1500);  // Running totals of the volume work, heat and entropy, stored row by row.
+    double etaproc = 0.0;
+    double etarev = 0.0;
     
-    printf("Beginning file write...\n");
+    WriterColumn cols[10] = {
+        {"P", "kPa", profile.P, 1, WriterFixed, 6, 0.001, 0.0},
+        {"V", "m3", profile.V, 1, WriterFixed, 6, 1.0, 0.0},
+        {"T", "K", profile.T, 1, WriterFixed, 6, 1.0, 0.0},
+        {"T", "deg C", profile.T, 1, WriterFixed, 6, 1.0, -273.15},
+        {"dW_V", "kW", profile.work, 1, WriterFixed, 6, 0.001, 0.0},
+        {"W_V", "kW", total, 3, WriterFixed, 6, 0.001, 0.0},
+        {"dQ", "kW", profile.heat, 1, WriterFixed, 6, 0.001, 0.0},
+        {"Q", "kW", total + 1, 3, WriterFixed, 6, 0.001, 0.0},
+        {"dS", "kJ/K(.s)", profile.entropy, 1, WriterFixed, 6, 0.001, 0.0},
+        {"S", "kJ/K(.s)", total + 2, 3, WriterFixed, 6, 0.001, 0.0}
+    };
+    
+    if(total == NULL)
+    {
+        printf("Memory could not be allocated to write the results.\n");
+        return;
+    }
+    for(int i = 0; i < 1500; ++i)
+    {
+        total[3*i] = profile.work[i] + ((i > 0) ? total[3*(i - 1)] : 0.0);
+        total[3*i + 1] = profile.heat[i] + ((i > 0) ? total[3*(i - 1) + 1] : 0.0);
+        total[3*i + 2] = profile.entropy[i] + ((i > 0) ? total[3*(i - 1) + 2] : 0.0);
+    }
     
-    //  Open file
-    fp = fopen(filename, "w+");
+    //  Set file name as timestamp + Carnot Cycle Results
+    if(!writerOpen(&w, "Carnot Cycle Results"))
+    {
+        free(total);
+        return;
+    }
     
     //  Write to file
-    fprintf(fp, "_Carnot_Cycle_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Pressure before entry into pump:\n");
-    fprintf(fp, "P1 =\t%.3f\tkPa\n", P1*0.001);
-    fprintf(fp, "Pressure before entry into boiler:\n");
-    fprintf(fp, "P2 =\t%.3f\tkPa\n", P2*0.001);
-    fprintf(fp, "Pressure before entry into turbine:\n");
-    fprintf(fp, "P3 =\t%.3f\tkPa\n", P3*0.001);
-    fprintf(fp, "Pressure before entry into condenser:\n");
-    fprintf(fp, "P4 =\t%.3f\tkPa\n\n", P4*0.001);
-    
-    fprintf(fp, "Hot reservoir temperature:\n");
-    fprintf(fp, "T_Hot =\t%.2f\tdeg C\n", THot - 273.15);
-    fprintf(fp, "Cold reservoir temperature:\n");
-    fprintf(fp, "T_Cold =\t%.2f\tdeg C\n\n", TCold - 273.15);
-    
-    fprintf(fp, "Heat capacity ratio in pump:\n");
-    fprintf(fp, "gamma1 =\t%.3f\t[ ]\n", gamma1);
-    fprintf(fp, "Heat capacity ratio in turbine:\n");
-    fprintf(fp, "gamma2 =\t%.3f\t[ ]\n\n", gamma2);
-    
-    fprintf(fp, "Molar flowrate in system:\n");
-    fprintf(fp, "n =\t%.3f\tkmol/s\n\n", n*0.001);
-    
-    fprintf(fp, "\tCalculated process parameters:\n");
-    fprintf(fp, "Net work:\n");
-    fprintf(fp, "w_net =\t%.3f\tkW\n", worknet*0.001);
-    fprintf(fp, "Heat supplied to cycle from hot reservoir:\n");
-    fprintf(fp, "q_Hot =\t%.3f\tkW\n", qhot*0.001);
-    fprintf(fp, "Heat sent from cycle from cold reservoir:\n");
-    fprintf(fp, "q_Cold =\t%.3f\tkW\n", qcold*0.001);
-    
-    double etaproc = 0.0;
-    double etarev = 0.0;
+    writerText(&w, "_Carnot_Cycle_Results_\n");
+    writerText(&w, "\tInput parameters:\n");
+    writerText(&w, "Pressure before entry into pump:\n");
+    writerValue(&w, "P1 =", P1*0.001, 3, "kPa");
+    writerText(&w, "Pressure before entry into boiler:\n");
+    writerValue(&w, "P2 =", P2*0.001, 3, "kPa");
+    writerText(&w, "Pressure before entry into turbine:\n");
+    writerValue(&w, "P3 =", P3*0.001, 3, "kPa");
+    writerText(&w, "Pressure before entry into condenser:\n");
+    writerValue(&w, "P4 =", P4*0.001, 3, "kPa");
+    writerEnd(&w);
+    
+    writerText(&w, "Hot reservoir temperature:\n");
+    writerValue(&w, "T_Hot =", THot - 273.15, 2, "deg C");
+    writerText(&w, "Cold reservoir temperature:\n");
+    writerValue(&w, "T_Cold =", TCold - 273.15, 2, "deg C");
+    writerEnd(&w);
+    
+    writerText(&w, "Heat capacity ratio in pump:\n");
+    writerValue(&w, "gamma1 =", gamma1, 3, "[ ]");
+    writerText(&w, "Heat capacity ratio in turbine:\n");
+    writerValue(&w, "gamma2 =", gamma2, 3, "[ ]");
+    writerEnd(&w);
+    
+    writerText(&w, "Molar flowrate in system:\n");
+    writerValue(&w, "n =", n*0.001, 3, "kmol/s");
+    writerEnd(&w);
+    
+    writerText(&w, "\tCalculated process parameters:\n");
+    writerText(&w, "Net work:\n");
+    writerValue(&w, "w_net =", worknet*0.001, 3, "kW");
+    writerText(&w, "Heat supplied to cycle from hot reservoir:\n");
+    writerValue(&w, "q_Hot =", qhot*0.001, 3, "kW");
+    writerText(&w, "Heat sent from cycle from cold reservoir:\n");
+    writerValue(&w, "q_Cold =", qcold*0.001, 3, "kW");
     
     etaproc = ThermEffCalc2(qhot, qcold);
     etarev = ThermEffCarnotCalculation(THot, TCold);
     
-    fprintf(fp, "Thermal efficiency of cycle:\n");
-    fprintf(fp, "eta =\t%.3f\t%%\n", etaproc*100);
-    fprintf(fp, "Thermal efficiency from reservoir temperatures:\n");
-    fprintf(fp, "eta =\t%.3f\t%%\n", etarev*100);
+    writerText(&w, "Thermal efficiency of cycle:\n");
+    writerValue(&w, "eta =", etaproc*100, 3, "%");
+    writerText(&w, "Thermal efficiency from reservoir temperatures:\n");
+    writerValue(&w, "eta =", etarev*100, 3, "%");
     
     if(fabs(etaproc - etarev) < 0.0005)
     {
-        fprintf(fp, "Your process is reversible\n\n");
+        writerText(&w, "Your process is reversible\n\n");
     }else{
         if(etaproc < etarev)
         {
-            fprintf(fp, "Your process is irreversible\n\n");
+            writerText(&w, "Your process is irreversible\n\n");
         }else{
-            fprintf(fp, "Your process violates the second law.\n\n");
+            writerText(&w, "Your process violates the second law.\n\n");
         }
     }
     
-    fprintf(fp, "\tOutput parameters:\n");
-    double totalwork = 0.0;
-    double totalheat = 0.0;
-    double totalchaos = 0.0;
-    
-    fprintf(fp, "P (kPa)\tV (m3)\tT (K)\tT(deg C)\t\tW_V (kW)\tW_V (kW)\t\tQ (kW)\tQ (kW)\t\tS (kJ/K(.s))\tS (kJ/K(.s))\n");
-    for(int i = 0; i < 1500; ++i){
-        fprintf(fp, "%f\t", profile.P[i]*0.001);
-        fprintf(fp, "%f\t", profile.V[i]);
-        fprintf(fp, "%f\t", profile.T[i]);
-        fprintf(fp, "%f\t\t", profile.T[i] - 273.15);
-        
-        fprintf(fp, "%f\t", profile.work[i]*0.001);
-        totalwork += profile.work[i];
-        fprintf(fp, "%f\t\t", totalwork*0.001);
-        
-        fprintf(fp, "%f\t", profile.heat[i]*0.001);
-        totalheat += profile.heat[i];
-        fprintf(fp, "%f\t\t", totalheat*0.001);
-        
-        fprintf(fp, "%f\t", profile.entropy[i]*0.001);
-        totalchaos += profile.entropy[i];
-        fprintf(fp, "%f\n", totalchaos*0.001);
-    }
+    writerText(&w, "\tOutput parameters:\n");
+    
+    //  Profile (Two Temperature columns (K and deg C), each step followed by its running total)
+    writerTable(&w, 10, cols, 1500);
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
+    free(total);
 }
 
 void CarnotSwitch(int mode, double P1, double P2, double P3, double P4, double THot, double TCold, double n, double gamma1, double gamma2, T4CarnotProfile profile, double worknet, double qhot, double qcold)
@@ -29,6 +29,7 @@
 
 //Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BC_T4.h"
 #include "04dClausiusInequality.h"
 
@@ -95,80 +96,41 @@ void EntropyDisplay(int imax, T4EntropyDef data)
 void EntropyWrite(int imax, T4EntropyDef data)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
     //  Set file name as timestamp + Clausius Inequality Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Clausius Inequality Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, "Clausius Inequality Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
-    fprintf(fp, "_Clausius_Inequality_Results_\n");
-    fprintf(fp, "q (kJ/kg)\tT (K)\ts (kJ/kg.K)\t\\sum_i\\frac{q_i}{T_i}\n");
+    writerPrintf(&w, "_Clausius_Inequality_Results_\n");
+    writerPrintf(&w, "q (kJ/kg)\tT (K)\ts (kJ/kg.K)\t\\sum_i\\frac{q_i}{T_i}\n");
     for(int i = 0; i < imax; ++i)
     {
-        fprintf(fp, "%.3f\t", data.q[i]);
-        fprintf(fp, "%.2f\t", data.T[i]);
-        fprintf(fp, "%.3f\t", data.s[i]);
-        fprintf(fp, "%.3f\n", data.sum[i]);
+        writerPrintf(&w, "%.3f\t", data.q[i]);
+        writerPrintf(&w, "%.2f\t", data.T[i]);
+        writerPrintf(&w, "%.3f\t", data.s[i]);
+        writerPrintf(&w, "%.3f\n", data.sum[i]);
         if( i == (imax - 1))    // Testing for final element
         {
             if(data.sum[i] > 0)
             {
-                fprintf(fp, "This process does not violate the second law of thermodynamics.\n");
+                writerPrintf(&w, "This process does not violate the second law of thermodynamics.\n");
             }else{
                 if(data.sum[i] == 0)
                 {
-                    fprintf(fp, "This process is reversible.\n");
+                    writerPrintf(&w, "This process is reversible.\n");
                 }else{
-                    fprintf(fp, "This process violates the second law of thermodynamics.\n");
+                    writerPrintf(&w, "This process violates the second law of thermodynamics.\n");
                 }
             }
         }
     }
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void EntropyWriteSwitch(int imax, T4EntropyDef data)
@@ -0,0 +1,1213 @@
+//
+//  04eCycleSimulator.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+/// MARK: HEADER DECLARATIONS
+//  Standard header files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//  Custom header files
+#include "System.h"
+#include "ResultWriter.h"
+#include "Parallel.h"
+#include "03aMixingRules.h"
+#include "01gRealGasPath.h"
+#include "04aThermalEfficiency.h"
+#include "04bCoefficientofPerformance.h"
+#include "04eCycleSimulator.h"
+
+/// MARK: SUBROUTINE DEFINITIONS
+#define maxstrlen 128
+#define R 8.3145            // J/(mol.K)
+#define cycletol 1e-10      // Relative temperature change accepted by the saturation and single phase solvers.
+#define cyclemaxiter 200    // Iteration limit of the saturation and single phase solvers.
+#define cyclegrain 4        // Minimum number of designs evaluated by a single thread.
+
+//  Kinds of cached property call
+#define CycleCallSatP 1
+#define CycleCallSatT 2
+#define CycleCallPT 3
+#define CycleCallPH 4
+#define CycleCallPS 5
+
+//  Pressure levels of the Rankine turbine
+#define CycleLevelReheat 1
+#define CycleLevelExtract 2
+#define CycleLevelExhaust 3
+
+/// This struct is used to share a cycle and the swept design variable between the sweep kernels.
+typedef struct CycleSweepContext{
+    const T4Cycle *cy;
+    double lo;
+    double hi;
+    int count;
+    T4CycleResult *res;
+} CycleSweepContext;
+
+/// MARK: VARIABLE INPUT
+/// This subroutine is used to collect a pure working fluid described by a cubic equation of state.
+/// @param fluid Struct where the fluid should be stored.
+static void CycleFluidVariable(T1RealGas *fluid)
+{
+    char input[maxstrlen];
+    int control = 0;
+    
+    memset(fluid, 0, sizeof(T1RealGas));
+    
+    control = 1;
+    while(control == 1)
+    {
+        printf("Equation of state: Soave-Redlich-Kwong (1) or Peng-Robinson (2)? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+                fluid->model = RealGasSRK;
+                control = 0;
+                break;
+            case '2':
+                fluid->model = RealGasPR;
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+    
+    fluid->ncomp = 1;
+    fluid->x[0] = 1.0;
+    MixRuleInit(&fluid->mix, 1, (fluid->model == RealGasSRK) ? MixSRK : MixPR, MixVdW);
+    
+    printf("Working fluid name: ");
+    fgets(input, sizeof(input), stdin);
+    input[strcspn(input, "\r\n")] = '\0';
+    snprintf(fluid->mix.name[0], MixNameLength, "%.*s", MixNameLength - 1, input);
+    
+    fluid->mix.Tc[0] = inputDouble(0, 0, "critical temperature", "K");
+    fluid->mix.Pc[0] = inputDouble(0, 0, "critical pressure", "bar");
+    fluid->mix.Pc[0] = (fluid->mix.Pc[0])*100000; // Conversion (bar to Pa)
+    fluid->mix.omega[0] = inputDouble(1, 1, "acentric factor", "[ ]");
+    fluid->cp[0][0] = inputDouble(1, 1, "ideal gas heat capacity constant A", "J/mol.K");
+    fluid->cp[0][1] = inputDouble(1, 1, "ideal gas heat capacity constant B", "J/mol.K2");
+    fluid->cp[0][2] = inputDouble(1, 1, "ideal gas heat capacity constant C", "J/mol.K3");
+    fluid->cp[0][3] = inputDouble(1, 1, "ideal gas heat capacity constant D", "J/mol.K4");
+}
+
+void CycleSimVariable(T4Cycle *cy)
+{
+    char input[maxstrlen];
+    int control = 0;
+    
+    memset(cy, 0, sizeof(T4Cycle));
+    
+    control = 1;
+    while(control == 1)
+    {
+        printf("Please select a cycle:\n1. Rankine (reheat and regeneration optional)\n2. Brayton (recuperation optional)\n3. Vapour compression refrigeration\n");
+        printf("Selection [1 - 3]: ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+                cy->type = CycleRankine;
+                control = 0;
+                break;
+            case '2':
+                cy->type = CycleBrayton;
+                control = 0;
+                break;
+            case '3':
+                cy->type = CycleVapourCompression;
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+    
+    if(cy->type == CycleRankine)
+    {
+        T4RankineSpec *rk = &cy->rankine;
+        
+        CycleFluidVariable(&cy->fluid);
+        rk->Pcond = inputDouble(0, 0, "condenser pressure", "kPa");
+        rk->Pcond = (rk->Pcond)*1000;
+        rk->Pboil = inputDouble(0, 0, "boiler pressure", "kPa");
+        rk->Pboil = (rk->Pboil)*1000;
+        rk->Tboil = inputDouble(1, 1, "turbine inlet temperature", "deg C");
+        rk->Tboil = (rk->Tboil) + 273.15;
+        if(YesNo("Is the steam reheated? "))
+        {
+            rk->Prh = inputDouble(0, 0, "reheat pressure", "kPa");
+            rk->Prh = (rk->Prh)*1000;
+            rk->Trh = inputDouble(1, 1, "reheat temperature", "deg C");
+            rk->Trh = (rk->Trh) + 273.15;
+        }
+        if(YesNo("Is there an open feedwater heater? "))
+        {
+            rk->Pfwh = inputDouble(0, 0, "feedwater heater pressure", "kPa");
+            rk->Pfwh = (rk->Pfwh)*1000;
+        }
+        rk->etaT = inputDouble(0, 0, "turbine isentropic efficiency", "%");
+        rk->etaT = (rk->etaT)*0.01;
+        rk->etaP = inputDouble(0, 0, "pump isentropic efficiency", "%");
+        rk->etaP = (rk->etaP)*0.01;
+    }
+    if(cy->type == CycleBrayton)
+    {
+        T4BraytonSpec *br = &cy->brayton;
+        
+        RealGasVariable(&cy->fluid);
+        br->P1 = inputDouble(0, 0, "compressor inlet pressure", "kPa");
+        br->P1 = (br->P1)*1000;
+        br->T1 = inputDouble(1, 1, "compressor inlet temperature", "deg C");
+        br->T1 = (br->T1) + 273.15;
+        br->rp = inputDouble(0, 0, "pressure ratio", "[ ]");
+        br->T3 = inputDouble(1, 1, "turbine inlet temperature", "deg C");
+        br->T3 = (br->T3) + 273.15;
+        br->etaC = inputDouble(0, 0, "compressor isentropic efficiency", "%");
+        br->etaC = (br->etaC)*0.01;
+        br->etaT = inputDouble(0, 0, "turbine isentropic efficiency", "%");
+        br->etaT = (br->etaT)*0.01;
+        if(YesNo("Is there a recuperator? "))
+        {
+            br->recup = inputDouble(0, 0, "recuperator effectiveness", "%");
+            br->recup = (br->recup)*0.01;
+        }
+    }
+    if(cy->type == CycleVapourCompression)
+    {
+        T4VapCompSpec *vc = &cy->vapcomp;
+        
+        CycleFluidVariable(&cy->fluid);
+        vc->Tevap = inputDouble(1, 1, "evaporating temperature", "deg C");
+        vc->Tevap = (vc->Tevap) + 273.15;
+        vc->Tcond = inputDouble(1, 1, "condensing temperature", "deg C");
+        vc->Tcond = (vc->Tcond) + 273.15;
+        vc->superheat = inputDouble(1, 0, "superheat at the evaporator outlet", "K");
+        vc->subcool = inputDouble(1, 0, "subcooling at the condenser outlet", "K");
+        vc->etaC = inputDouble(0, 0, "compressor isentropic efficiency", "%");
+        vc->etaC = (vc->etaC)*0.01;
+    }
+    
+    cy->n = inputDouble(0, 0, "molar flowrate of working fluid", "kmol/s");
+    cy->n = (cy->n)*1000;
+}
+
+/// MARK: GENERAL CALCULATIONS
+/// This subroutine is used to return the more severe of two status codes.
+static int CycleWorst(int a, int b)
+{
+    return (a > b) ? a : b;
+}
+
+/// This subroutine is used to check if the working fluid is resolved into liquid and vapour states. Only a single component with a cubic equation of state is.
+static int CycleTwoPhase(const T1RealGas *fluid)
+{
+    return (fluid->ncomp == 1 && fluid->model != RealGasIdeal);
+}
+
+/// This subroutine is used to copy an equation of state point into a cycle state point.
+static void CyclePointSet(T4CyclePoint *pt, const T1RealPoint *rp, double q)
+{
+    pt->T = rp->T;
+    pt->P = rp->P;
+    pt->v = rp->v;
+    pt->h = rp->h;
+    pt->s = rp->s;
+    pt->q = q;
+}
+
+/// This subroutine is used to look up a property call in the workspace cache. This function returns 1 and copies the stored states when the call was made before in this evaluation, or 0 otherwise.
+static int CycleCacheFind(T4CycleCache *c, int spec, double P, double value, int *status, T4CyclePoint *a, T4CyclePoint *b)
+{
+    for(int i = 0; i < c->count; ++i)
+    {
+        if(c->spec[i] == spec && c->P[i] == P && c->value[i] == value)
+        {
+            *status = c->status[i];
+            *a = c->pt[i][0];
+            if(b != NULL)
+            {
+                *b = c->pt[i][1];
+            }
+            c->hits++;
+            return 1;
+        }
+    }
+    c->misses++;
+    
+    return 0;
+}
+
+/// This subroutine is used to store the result of a property call in the workspace cache, replacing the oldest entry once the cache is full. This function returns the status of the call.
+static int CycleCacheStore(T4CycleCache *c, int spec, double P, double value, int status, const T4CyclePoint *a, const T4CyclePoint *b)
+{
+    int i = 0;
+    
+    if(c->count < CycleCacheSize){
+        i = c->count;
+        c->count++;
+    }else{
+        i = c->next;
+        c->next = (c->next + 1)%CycleCacheSize;
+    }
+    c->spec[i] = spec;
+    c->P[i] = P;
+    c->value[i] = value;
+    c->status[i] = status;
+    c->pt[i][0] = *a;
+    c->pt[i][1] = (b != NULL) ? *b : *a;
+    
+    return status;
+}
+
+/// This subroutine is used to empty the property cache at the start of an evaluation. The equation of state parameters are kept, as they only depend on the fluid.
+static void CycleCacheClear(T4CycleCache *c)
+{
+    c->count = 0;
+    c->next = 0;
+    c->hits = 0;
+    c->misses = 0;
+}
+
+void CycleWorkReset(T4CycleWork *w)
+{
+    MixStateReset(&w->st);
+    CycleCacheClear(&w->cache);
+}
+
+/// This subroutine is used to find the saturation pressure of a pure fluid at a temperature by successive substitution, P = P phiL/phiV. When only one root of the equation of state exists the pressure is moved towards the two phase region first. "P" holds the starting estimate on entry, or zero to start from the Wilson correlation.
+static int CycleSatSolve(const T1RealGas *fluid, MixState *st, double T, double *P, T4CyclePoint *liq, T4CyclePoint *vap)
+{
+    const MixRule *mix = &fluid->mix;
+    double lnphiL[MixMaxComp];
+    double lnphiV[MixMaxComp];
+    double Pk = *P;
+    T1RealPoint rp;
+    int status = CycleNotConverged;
+    
+    if(T >= mix->Tc[0])
+    {
+        return CycleInvalid;
+    }
+    if(Pk <= 0.0)
+    {
+        Pk = mix->Pc[0]*exp(5.373*(1 + mix->omega[0])*(1 - mix->Tc[0]/T));
+    }
+    
+    for(int iter = 0; iter < 5*cyclemaxiter; ++iter)
+    {
+        double ZL = MixCubicPhase(mix, st, T, Pk, fluid->x, MixLiquidRoot, lnphiL, NULL, NULL);
+        double ZV = MixCubicPhase(mix, st, T, Pk, fluid->x, MixVapourRoot, lnphiV, NULL, NULL);
+        double d = 0.0;
+        
+        if(ZV - ZL < 1e-9*ZV)
+        {
+            // Only one root: raise the pressure of a vapour and lower the pressure of a liquid
+            Pk = (ZV > 0.3) ? 1.5*Pk : Pk/1.5;
+            continue;
+        }
+        d = lnphiL[0] - lnphiV[0];
+        Pk = Pk*exp(d);
+        if(fabs(d) < cycletol)
+        {
+            status = CycleOK;
+            break;
+        }
+    }
+    *P = Pk;
+    
+    RealGasPhasePoint(fluid, st, T, Pk, MixLiquidRoot, &rp);
+    CyclePointSet(liq, &rp, 0.0);
+    RealGasPhasePoint(fluid, st, T, Pk, MixVapourRoot, &rp);
+    CyclePointSet(vap, &rp, 1.0);
+    
+    return status;
+}
+
+int CycleSaturationT(const T1RealGas *fluid, T4CycleWork *w, double T, T4CyclePoint *liq, T4CyclePoint *vap)
+{
+    int status = CycleOK;
+    double P = 0.0;
+    
+    if(CycleCacheFind(&w->cache, CycleCallSatT, T, 0.0, &status, liq, vap))
+    {
+        return status;
+    }
+    status = CycleSatSolve(fluid, &w->st, T, &P, liq, vap);
+    
+    return CycleCacheStore(&w->cache, CycleCallSatT, T, 0.0, status, liq, vap);
+}
+
+int CycleSaturationP(const T1RealGas *fluid, T4CycleWork *w, double P, T4CyclePoint *liq, T4CyclePoint *vap)
+{
+    const MixRule *mix = &fluid->mix;
+    double Tc = mix->Tc[0];
+    double T = 0.0;
+    int status = CycleNotConverged;
+    
+    if(CycleCacheFind(&w->cache, CycleCallSatP, P, 0.0, &status, liq, vap))
+    {
+        return status;
+    }
+    if(P >= mix->Pc[0])
+    {
+        memset(liq, 0, sizeof(T4CyclePoint));
+        memset(vap, 0, sizeof(T4CyclePoint));
+        return CycleCacheStore(&w->cache, CycleCallSatP, P, 0.0, CycleInvalid, liq, vap);
+    }
+    
+    // Wilson estimate, then Newton steps in 1/T along the Clapeyron slope, d(lnP)/d(1/T) = -dh/(R dZ)
+    T = Tc/(1 - log(P/mix->Pc[0])/(5.373*(1 + mix->omega[0])));
+    for(int iter = 0; iter < cyclemaxiter; ++iter)
+    {
+        double Psat = P;
+        double dZ = 0.0;
+        double Tn = 0.0;
+        
+        T = (T >= Tc) ? Tc*(1 - 1e-6) : T;
+        status = CycleSatSolve(fluid, &w->st, T, &Psat, liq, vap);
+        dZ = Psat*(vap->v - liq->v)/(R*T);
+        Tn = 1.0/(1.0/T - (log(P) - log(Psat))*R*dZ/(vap->h - liq->h));
+        Tn = (Tn >= Tc) ? 0.5*(T + Tc) : Tn;
+        if(fabs(Tn - T) < cycletol*T)
+        {
+            Psat = P;
+            status = CycleSatSolve(fluid, &w->st, Tn, &Psat, liq, vap);
+            break;
+        }
+        T = Tn;
+        status = CycleNotConverged;
+    }
+    
+    return CycleCacheStore(&w->cache, CycleCallSatP, P, 0.0, status, liq, vap);
+}
+
+/// This subroutine is used to evaluate the property of a single phase state used as a flash specification.
+static double CycleSpecValue(int spec, const T1RealPoint *rp)
+{
+    return (spec == CycleCallPH) ? rp->h : rp->s;
+}
+
+/// This subroutine is used to find the temperature on one root of the equation of state at which the enthalpy or entropy matches its specification at a fixed pressure. The bracket is widened until it holds the solution and then closed by the Illinois false position method, as both properties increase with temperature along a root.
+static int CycleSolveT(const T1RealGas *fluid, MixState *st, int root, int spec, double P, double target, double Tlo, double Thi, T4CyclePoint *pt)
+{
+    T1RealPoint a;
+    T1RealPoint b;
+    T1RealPoint c;
+    double fa = 0.0;
+    double fb = 0.0;
+    double fc = 0.0;
+    double Tmin = 0.2*fluid->mix.Tc[0];
+    double width = Thi - Tlo;
+    int side = 0;
+    
+    RealGasPhasePoint(fluid, st, Tlo, P, root, &a);
+    RealGasPhasePoint(fluid, st, Thi, P, root, &b);
+    fa = CycleSpecValue(spec, &a) - target;
+    fb = CycleSpecValue(spec, &b) - target;
+    for(int iter = 0; fa > 0.0 && iter < 60; ++iter)
+    {
+        Thi = Tlo;
+        fb = fa;
+        b = a;
+        Tlo = fmax(Tlo - width, Tmin);
+        width = 2*width;
+        RealGasPhasePoint(fluid, st, Tlo, P, root, &a);
+        fa = CycleSpecValue(spec, &a) - target;
+        if(Tlo == Tmin && fa > 0.0)
+        {
+            CyclePointSet(pt, &a, (root == MixLiquidRoot) ? 0.0 : 1.0);
+            return CycleNotConverged;
+        }
+    }
+    for(int iter = 0; fb < 0.0 && iter < 60; ++iter)
+    {
+        Tlo = Thi;
+        fa = fb;
+        a = b;
+        Thi = Thi + width;
+        width = 2*width;
+        RealGasPhasePoint(fluid, st, Thi, P, root, &b);
+        fb = CycleSpecValue(spec, &b) - target;
+    }
+    
+    c = a;
+    for(int iter = 0; iter < cyclemaxiter; ++iter)
+    {
+        double T = (fb - fa == 0.0) ? 0.5*(Tlo + Thi) : (Tlo*fb - Thi*fa)/(fb - fa);
+        
+        RealGasPhasePoint(fluid, st, T, P, root, &c);
+        fc = CycleSpecValue(spec, &c) - target;
+        if(fc == 0.0 || Thi - Tlo < cycletol*T)
+        {
+            break;
+        }
+        if(fc < 0.0){
+            Tlo = T;
+            fa = fc;
+            fb = (side < 0) ? 0.5*fb : fb;
+            side = -1;
+        }else{
+            Thi = T;
+            fb = fc;
+            fa = (side > 0) ? 0.5*fa : fa;
+            side = 1;
+        }
+        if(fabs(Thi - Tlo) < cycletol*T)
+        {
+            break;
+        }
+    }
+    CyclePointSet(pt, &c, (root == MixLiquidRoot) ? 0.0 : 1.0);
+    
+    return (fabs(Thi - Tlo) < 1e3*cycletol*c.T || fc == 0.0) ? CycleOK : CycleNotConverged;
+}
+
+int CycleStatePT(const T1RealGas *fluid, T4CycleWork *w, double T, double P, T4CyclePoint *pt)
+{
+    T4CyclePoint liq;
+    T4CyclePoint vap;
+    T1RealPoint rp;
+    int status = CycleOK;
+    
+    if(CycleCacheFind(&w->cache, CycleCallPT, P, T, &status, pt, NULL))
+    {
+        return status;
+    }
+    
+    if(CycleTwoPhase(fluid) == 0)
+    {
+        RealGasPoint(fluid, &w->st, T, P, &rp);
+        CyclePointSet(pt, &rp, 1.0);
+    }else if(CycleSaturationP(fluid, w, P, &liq, &vap) == CycleInvalid){
+        // Supercritical pressure
+        RealGasPhasePoint(fluid, &w->st, T, P, MixStableRoot, &rp);
+        CyclePointSet(pt, &rp, (T < fluid->mix.Tc[0]) ? 0.0 : 1.0);
+    }else{
+        RealGasPhasePoint(fluid, &w->st, T, P, (T < liq.T) ? MixLiquidRoot : MixVapourRoot, &rp);
+        CyclePointSet(pt, &rp, (T < liq.T) ? 0.0 : 1.0);
+    }
+    
+    return CycleCacheStore(&w->cache, CycleCallPT, P, T, status, pt, NULL);
+}
+
+/// This subroutine is used to find the state of the working fluid at a pressure and a molar enthalpy or entropy. Used by both "CycleStatePH(...)" and "CycleStatePS(...)".
+static int CycleStateSpec(const T1RealGas *fluid, T4CycleWork *w, int spec, double P, double value, T4CyclePoint *pt)
+{
+    T4CyclePoint liq;
+    T4CyclePoint vap;
+    T1RealPoint rp;
+    int status = CycleOK;
+    
+    if(CycleCacheFind(&w->cache, spec, P, value, &status, pt, NULL))
+    {
+        return status;
+    }
+    
+    if(CycleTwoPhase(fluid) == 0)
+    {
+        status = (spec == CycleCallPH) ? RealGasFlashPH(fluid, &w->st, P, value, 300.0, &rp) : RealGasFlashPS(fluid, &w->st, P, value, 300.0, &rp);
+        status = (status == 0) ? CycleOK : CycleNotConverged;
+        CyclePointSet(pt, &rp, 1.0);
+    }else if(CycleSaturationP(fluid, w, P, &liq, &vap) == CycleInvalid){
+        double Tc = fluid->mix.Tc[0];
+        
+        status = CycleSolveT(fluid, &w->st, MixStableRoot, spec, P, value, 0.9*Tc, 1.1*Tc, pt);
+        pt->q = (pt->T < Tc) ? 0.0 : 1.0;
+    }else{
+        double vL = (spec == CycleCallPH) ? liq.h : liq.s;
+        double vV = (spec == CycleCallPH) ? vap.h : vap.s;
+        
+        if(value <= vL){
+            status = CycleSolveT(fluid, &w->st, MixLiquidRoot, spec, P, value, liq.T - 10.0, liq.T, pt);
+        }else if(value >= vV){
+            status = CycleSolveT(fluid, &w->st, MixVapourRoot, spec, P, value, vap.T, vap.T + 10.0, pt);
+        }else{
+            double q = (value - vL)/(vV - vL);
+            
+            pt->T = liq.T;
+            pt->P = P;
+            pt->v = liq.v + q*(vap.v - liq.v);
+            pt->h = liq.h + q*(vap.h - liq.h);
+            pt->s = liq.s + q*(vap.s - liq.s);
+            pt->q = q;
+        }
+    }
+    
+    return CycleCacheStore(&w->cache, spec, P, value, status, pt, NULL);
+}
+
+int CycleStatePH(const T1RealGas *fluid, T4CycleWork *w, double P, double h, T4CyclePoint *pt)
+{
+    return CycleStateSpec(fluid, w, CycleCallPH, P, h, pt);
+}
+
+int CycleStatePS(const T1RealGas *fluid, T4CycleWork *w, double P, double s, T4CyclePoint *pt)
+{
+    return CycleStateSpec(fluid, w, CycleCallPS, P, s, pt);
+}
+
+int CycleMachine(const T1RealGas *fluid, T4CycleWork *w, double eta, const T4CyclePoint *in, double P, T4CyclePoint *out)
+{
+    T4CyclePoint ideal;
+    double dh = 0.0;
+    int status = CycleOK;
+    
+    status = CycleStatePS(fluid, w, P, in->s, &ideal);
+    dh = ideal.h - in->h;
+    dh = (P > in->P) ? dh/eta : dh*eta;
+    status = CycleWorst(status, CycleStatePH(fluid, w, P, in->h + dh, out));
+    
+    return status;
+}
+
+/// This subroutine is used to append a state point to the results of a cycle.
+static void CycleAddPoint(T4CycleResult *res, const char *label, const T4CyclePoint *pt, double flow)
+{
+    if(res->npoint >= CycleMaxPoints)
+    {
+        return;
+    }
+    res->label[res->npoint] = label;
+    res->pt[res->npoint] = *pt;
+    res->flow[res->npoint] = flow;
+    res->npoint++;
+}
+
+/// This subroutine is used to evaluate a Rankine cycle. The turbine expands in sections between the reheat, extraction and condenser pressures, with the isentropic efficiency applied to each section. The extraction to the open feedwater heater is sized so that the heater delivers saturated liquid.
+static int CycleRankineEvaluate(const T4Cycle *cy, T4CycleWork *w, T4CycleResult *res)
+{
+    const T4RankineSpec *rk = &cy->rankine;
+    const T1RealGas *fluid = &cy->fluid;
+    T4CyclePoint condL;
+    T4CyclePoint condV;
+    T4CyclePoint fwhL;
+    T4CyclePoint fwhV;
+    T4CyclePoint pump1;
+    T4CyclePoint feed;
+    T4CyclePoint boil;
+    T4CyclePoint cur;
+    T4CyclePoint out;
+    double levelP[3];
+    int levelKind[3];
+    int nlevel = 0;
+    double flow = 1.0;
+    double Thot = rk->Tboil;
+    int status = CycleOK;
+    
+    res->design = rk->Pboil;
+    if(CycleTwoPhase(fluid) == 0 || rk->Pcond <= 0.0 || rk->Pboil <= rk->Pcond)
+    {
+        return CycleInvalid;
+    }
+    if((rk->Prh > 0.0 && (rk->Prh <= rk->Pcond || rk->Prh >= rk->Pboil)) || (rk->Pfwh > 0.0 && (rk->Pfwh <= rk->Pcond || rk->Pfwh >= rk->Pboil)))
+    {
+        return CycleInvalid;
+    }
+    
+    // Condensate and feed pumps
+    status = CycleSaturationP(fluid, w, rk->Pcond, &condL, &condV);
+    if(status == CycleInvalid)
+    {
+        return status;
+    }
+    CycleAddPoint(res, "Condenser outlet", &condL, 1.0);
+    if(rk->Pfwh > 0.0){
+        status = CycleWorst(status, CycleMachine(fluid, w, rk->etaP, &condL, rk->Pfwh, &pump1));
+        status = CycleWorst(status, CycleSaturationP(fluid, w, rk->Pfwh, &fwhL, &fwhV));
+        status = CycleWorst(status, CycleMachine(fluid, w, rk->etaP, &fwhL, rk->Pboil, &feed));
+        CycleAddPoint(res, "Condensate pump outlet", &pump1, 1.0);
+        CycleAddPoint(res, "Feedwater heater outlet", &fwhL, 1.0);
+        CycleAddPoint(res, "Feed pump outlet", &feed, 1.0);
+    }else{
+        status = CycleWorst(status, CycleMachine(fluid, w, rk->etaP, &condL, rk->Pboil, &feed));
+        CycleAddPoint(res, "Feed pump outlet", &feed, 1.0);
+    }
+    
+    status = CycleWorst(status, CycleStatePT(fluid, w, rk->Tboil, rk->Pboil, &boil));
+    CycleAddPoint(res, "Boiler outlet", &boil, 1.0);
+    res->Qin = boil.h - feed.h;
+    
+    // Turbine pressure levels in the order they are reached. Extraction comes before reheat at the same pressure.
+    if(rk->Pfwh > 0.0)
+    {
+        levelP[nlevel] = rk->Pfwh;
+        levelKind[nlevel] = CycleLevelExtract;
+        nlevel++;
+    }
+    if(rk->Prh > 0.0)
+    {
+        levelP[nlevel] = rk->Prh;
+        levelKind[nlevel] = CycleLevelReheat;
+        if(nlevel == 1 && rk->Prh > rk->Pfwh)
+        {
+            levelP[1] = levelP[0];
+            levelKind[1] = levelKind[0];
+            levelP[0] = rk->Prh;
+            levelKind[0] = CycleLevelReheat;
+        }
+        nlevel++;
+    }
+    levelP[nlevel] = rk->Pcond;
+    levelKind[nlevel] = CycleLevelExhaust;
+    nlevel++;
+    
+    cur = boil;
+    for(int k = 0; k < nlevel; ++k)
+    {
+        status = CycleWorst(status, CycleMachine(fluid, w, rk->etaT, &cur, levelP[k], &out));
+        res->Wout += flow*(cur.h - out.h);
+        cur = out;
+        if(levelKind[k] == CycleLevelReheat)
+        {
+            CycleAddPoint(res, "Turbine outlet to reheater", &out, flow);
+            status = CycleWorst(status, CycleStatePT(fluid, w, rk->Trh, rk->Prh, &cur));
+            CycleAddPoint(res, "Reheater outlet", &cur, flow);
+            res->Qin += flow*(cur.h - out.h);
+            Thot = fmax(Thot, rk->Trh);
+        }
+        if(levelKind[k] == CycleLevelExtract)
+        {
+            CycleAddPoint(res, "Turbine extraction", &out, flow);
+            res->y = (fwhL.h - pump1.h)/(out.h - pump1.h);
+            if(res->y < 0.0 || res->y > 1.0)
+            {
+                return CycleInvalid;
+            }
+            flow = 1.0 - res->y;
+        }
+        if(levelKind[k] == CycleLevelExhaust)
+        {
+            CycleAddPoint(res, "Turbine exhaust", &out, flow);
+        }
+    }
+    
+    if(rk->Pfwh > 0.0){
+        res->flow[1] = 1.0 - res->y;
+        res->Win = (1.0 - res->y)*(pump1.h - condL.h) + (feed.h - fwhL.h);
+    }else{
+        res->Win = feed.h - condL.h;
+    }
+    res->Qout = flow*(cur.h - condL.h);
+    res->flow[0] = flow;
+    res->Wnet = res->Wout - res->Win;
+    res->eff = ThermEffCalc1(res->Wnet, res->Qin);
+    res->carnot = ThermEffCarnotCalculation(Thot, condL.T);
+    
+    return status;
+}
+
+/// This subroutine is used to evaluate a Brayton cycle. The recuperator transfers its effectiveness times the smaller of the heat the cold stream could take up to the turbine exhaust temperature and the heat the exhaust could give up to the compressor discharge temperature.
+static int CycleBraytonEvaluate(const T4Cycle *cy, T4CycleWork *w, T4CycleResult *res)
+{
+    const T4BraytonSpec *br = &cy->brayton;
+    const T1RealGas *fluid = &cy->fluid;
+    double P2 = br->P1*br->rp;
+    T4CyclePoint p1;
+    T4CyclePoint p2;
+    T4CyclePoint p3;
+    T4CyclePoint p4;
+    T4CyclePoint hot;
+    T4CyclePoint cold;
+    T4CyclePoint heated;
+    T4CyclePoint cooled;
+    double Qr = 0.0;
+    int status = CycleOK;
+    
+    res->design = br->rp;
+    if(br->rp <= 1.0 || br->T3 <= br->T1)
+    {
+        return CycleInvalid;
+    }
+    
+    status = CycleStatePT(fluid, w, br->T1, br->P1, &p1);
+    status = CycleWorst(status, CycleMachine(fluid, w, br->etaC, &p1, P2, &p2));
+    status = CycleWorst(status, CycleStatePT(fluid, w, br->T3, P2, &p3));
+    status = CycleWorst(status, CycleMachine(fluid, w, br->etaT, &p3, br->P1, &p4));
+    heated = p2;
+    cooled = p4;
+    if(br->recup > 0.0 && p4.T > p2.T)
+    {
+        status = CycleWorst(status, CycleStatePT(fluid, w, p4.T, P2, &cold));
+        status = CycleWorst(status, CycleStatePT(fluid, w, p2.T, br->P1, &hot));
+        Qr = br->recup*fmin(cold.h - p2.h, p4.h - hot.h);
+        status = CycleWorst(status, CycleStatePH(fluid, w, P2, p2.h + Qr, &heated));
+        status = CycleWorst(status, CycleStatePH(fluid, w, br->P1, p4.h - Qr, &cooled));
+    }
+    
+    CycleAddPoint(res, "Compressor inlet", &p1, 1.0);
+    CycleAddPoint(res, "Compressor outlet", &p2, 1.0);
+    if(Qr > 0.0)
+    {
+        CycleAddPoint(res, "Recuperator cold outlet", &heated, 1.0);
+    }
+    CycleAddPoint(res, "Turbine inlet", &p3, 1.0);
+    CycleAddPoint(res, "Turbine outlet", &p4, 1.0);
+    if(Qr > 0.0)
+    {
+        CycleAddPoint(res, "Recuperator hot outlet", &cooled, 1.0);
+    }
+    
+    res->Win = p2.h - p1.h;
+    res->Wout = p3.h - p4.h;
+    res->Wnet = res->Wout - res->Win;
+    res->Qin = p3.h - heated.h;
+    res->Qout = cooled.h - p1.h;
+    res->eff = ThermEffCalc1(res->Wnet, res->Qin);
+    res->carnot = ThermEffCarnotCalculation(br->T3, br->T1);
+    
+    return status;
+}
+
+/// This subroutine is used to evaluate a vapour compression refrigeration cycle with an isenthalpic expansion valve.
+static int CycleVapCompEvaluate(const T4Cycle *cy, T4CycleWork *w, T4CycleResult *res)
+{
+    const T4VapCompSpec *vc = &cy->vapcomp;
+    const T1RealGas *fluid = &cy->fluid;
+    T4CyclePoint evapL;
+    T4CyclePoint evapV;
+    T4CyclePoint condL;
+    T4CyclePoint condV;
+    T4CyclePoint p1;
+    T4CyclePoint p2;
+    T4CyclePoint p3;
+    T4CyclePoint p4;
+    int status = CycleOK;
+    
+    res->design = vc->Tcond;
+    if(CycleTwoPhase(fluid) == 0 || vc->Tcond <= vc->Tevap)
+    {
+        return CycleInvalid;
+    }
+    
+    status = CycleSaturationT(fluid, w, vc->Tevap, &evapL, &evapV);
+    status = CycleWorst(status, CycleSaturationT(fluid, w, vc->Tcond, &condL, &condV));
+    if(status == CycleInvalid)
+    {
+        return status;
+    }
+    
+    p1 = evapV;
+    if(vc->superheat > 0.0)
+    {
+        status = CycleWorst(status, CycleStatePT(fluid, w, vc->Tevap + vc->superheat, evapV.P, &p1));
+    }
+    status = CycleWorst(status, CycleMachine(fluid, w, vc->etaC, &p1, condV.P, &p2));
+    p3 = condL;
+    if(vc->subcool > 0.0)
+    {
+        status = CycleWorst(status, CycleStatePT(fluid, w, vc->Tcond - vc->subcool, condL.P, &p3));
+    }
+    status = CycleWorst(status, CycleStatePH(fluid, w, evapV.P, p3.h, &p4));
+    
+    CycleAddPoint(res, "Evaporator outlet", &p1, 1.0);
+    CycleAddPoint(res, "Compressor outlet", &p2, 1.0);
+    CycleAddPoint(res, "Condenser outlet", &p3, 1.0);
+    CycleAddPoint(res, "Expansion valve outlet", &p4, 1.0);
+    
+    res->Win = p2.h - p1.h;
+    res->Wnet = -res->Win;
+    res->Qin = p1.h - p4.h;
+    res->Qout = p2.h - p3.h;
+    res->eff = CoPFridge(res->Qin, res->Win);
+    res->effhp = CoPHeatPump(res->Qout, res->Win);
+    res->carnot = CoPRevFridge(vc->Tevap, vc->Tcond);
+    
+    return status;
+}
+
+int CycleEvaluate(const T4Cycle *cy, T4CycleWork *w, T4CycleResult *res)
+{
+    memset(res, 0, sizeof(T4CycleResult));
+    CycleCacheClear(&w->cache);
+    
+    switch(cy->type)
+    {
+        case CycleRankine:
+            res->status = CycleRankineEvaluate(cy, w, res);
+            break;
+        case CycleBrayton:
+            res->status = CycleBraytonEvaluate(cy, w, res);
+            break;
+        case CycleVapourCompression:
+            res->status = CycleVapCompEvaluate(cy, w, res);
+            break;
+        default:
+            res->status = CycleInvalid;
+            break;
+    }
+    res->hits = w->cache.hits;
+    res->misses = w->cache.misses;
+    
+    return res->status;
+}
+
+/// This subroutine is used to evaluate a block of designs of a sweep. Used as the kernel of "parallelFor(...)".
+/// @param start First design in the block.
+/// @param end One past the last design in the block.
+/// @param context Pointer to a "CycleSweepContext" struct.
+static void CycleSweepKernel(int start, int end, void *context)
+{
+    CycleSweepContext *ctx = context;
+    T4CycleWork *w = malloc(sizeof(T4CycleWork));
+    T4Cycle *cy = malloc(sizeof(T4Cycle));
+    
+    if(w == NULL || cy == NULL)
+    {
+        free(w);
+        free(cy);
+        for(int i = start; i < end; ++i)
+        {
+            memset(&ctx->res[i], 0, sizeof(T4CycleResult));
+            ctx->res[i].status = CycleNotConverged;
+        }
+        return;
+    }
+    
+    *cy = *ctx->cy;
+    CycleWorkReset(w);
+    for(int i = start; i < end; ++i)
+    {
+        double x = (ctx->count == 1) ? ctx->lo : ctx->lo + (ctx->hi - ctx->lo)*((double)i/(ctx->count - 1));
+        
+        switch(cy->type)
+        {
+            case CycleRankine:
+                cy->rankine.Pboil = x;
+                break;
+            case CycleBrayton:
+                cy->brayton.rp = x;
+                break;
+            case CycleVapourCompression:
+                cy->vapcomp.Tcond = x;
+                break;
+        }
+        CycleEvaluate(cy, w, &ctx->res[i]);
+        ctx->res[i].design = x;
+    }
+    free(w);
+    free(cy);
+}
+
+void CycleSweep(const T4Cycle *cy, double lo, double hi, int count, T4CycleResult *res)
+{
+    CycleSweepContext ctx = {cy, lo, hi, count, res};
+    
+    parallelFor(count, cyclegrain, CycleSweepKernel, &ctx);
+}
+
+/// MARK: DISPLAY AND WRITE
+/// This subroutine is used to convert the swept design variable to the units shown to the user.
+static double CycleDesignDisplay(int type, double x)
+{
+    if(type == CycleRankine)
+    {
+        return x*0.001;
+    }
+    if(type == CycleVapourCompression)
+    {
+        return x - 273.15;
+    }
+    
+    return x;
+}
+
+/// This subroutine is used to print the cycle results, and the sweep when one was run, to a writer. Used by both "CycleDisplay(...)" and "CycleWrite(...)".
+static void CyclePrint(ResultWriter *w, const T4Cycle *cy, const T4CycleResult *res, const T4CycleResult *sweep, int count)
+{
+    const char *status[] = {"", "At least one state point did not converge.", "The specification cannot be evaluated with this working fluid."};
+    const char *design[] = {"", "Pboil (kPa)", "rp (-)", "Tcond (deg C)"};
+    double n = cy->n;
+    
+    writerPrintf(w, "_Thermodynamic_Cycle_Results_\n");
+    writerPrintf(w, "\tInput parameters:\n");
+    if(cy->type == CycleRankine)
+    {
+        const T4RankineSpec *rk = &cy->rankine;
+        
+        writerPrintf(w, "Rankine cycle%s%s\n", (rk->Prh > 0.0) ? " with reheat" : "", (rk->Pfwh > 0.0) ? " with an open feedwater heater" : "");
+        writerPrintf(w, "Condenser pressure:\n");
+        writerPrintf(w, "Pcond =\t%.3f\tkPa\n", rk->Pcond*0.001);
+        writerPrintf(w, "Boiler pressure:\n");
+        writerPrintf(w, "Pboil =\t%.3f\tkPa\n", rk->Pboil*0.001);
+        writerPrintf(w, "Turbine inlet temperature:\n");
+        writerPrintf(w, "Tboil =\t%.3f\tdeg C\n", rk->Tboil - 273.15);
+        if(rk->Prh > 0.0)
+        {
+            writerPrintf(w, "Reheat pressure:\n");
+            writerPrintf(w, "Prh =\t%.3f\tkPa\n", rk->Prh*0.001);
+            writerPrintf(w, "Reheat temperature:\n");
+            writerPrintf(w, "Trh =\t%.3f\tdeg C\n", rk->Trh - 273.15);
+        }
+        if(rk->Pfwh > 0.0)
+        {
+            writerPrintf(w, "Feedwater heater pressure:\n");
+            writerPrintf(w, "Pfwh =\t%.3f\tkPa\n", rk->Pfwh*0.001);
+        }
+        writerPrintf(w, "Turbine and pump isentropic efficiencies:\n");
+        writerPrintf(w, "etaT =\t%.2f\t%%\n", rk->etaT*100);
+        writerPrintf(w, "etaP =\t%.2f\t%%\n", rk->etaP*100);
+    }
+    if(cy->type == CycleBrayton)
+    {
+        const T4BraytonSpec *br = &cy->brayton;
+        
+        writerPrintf(w, "Brayton cycle%s\n", (br->recup > 0.0) ? " with a recuperator" : "");
+        writerPrintf(w, "Compressor inlet pressure:\n");
+        writerPrintf(w, "P1 =\t%.3f\tkPa\n", br->P1*0.001);
+        writerPrintf(w, "Compressor inlet temperature:\n");
+        writerPrintf(w, "T1 =\t%.3f\tdeg C\n", br->T1 - 273.15);
+        writerPrintf(w, "Pressure ratio:\n");
+        writerPrintf(w, "rp =\t%.3f\t[ ]\n", br->rp);
+        writerPrintf(w, "Turbine inlet temperature:\n");
+        writerPrintf(w, "T3 =\t%.3f\tdeg C\n", br->T3 - 273.15);
+        writerPrintf(w, "Compressor and turbine isentropic efficiencies:\n");
+        writerPrintf(w, "etaC =\t%.2f\t%%\n", br->etaC*100);
+        writerPrintf(w, "etaT =\t%.2f\t%%\n", br->etaT*100);
+        if(br->recup > 0.0)
+        {
+            writerPrintf(w, "Recuperator effectiveness:\n");
+            writerPrintf(w, "e =\t%.2f\t%%\n", br->recup*100);
+        }
+    }
+    if(cy->type == CycleVapourCompression)
+    {
+        const T4VapCompSpec *vc = &cy->vapcomp;
+        
+        writerPrintf(w, "Vapour compression refrigeration cycle\n");
+        writerPrintf(w, "Evaporating temperature:\n");
+        writerPrintf(w, "Tevap =\t%.3f\tdeg C\n", vc->Tevap - 273.15);
+        writerPrintf(w, "Condensing temperature:\n");
+        writerPrintf(w, "Tcond =\t%.3f\tdeg C\n", vc->Tcond - 273.15);
+        writerPrintf(w, "Superheat and subcooling:\n");
+        writerPrintf(w, "dTsh =\t%.3f\tK\n", vc->superheat);
+        writerPrintf(w, "dTsc =\t%.3f\tK\n", vc->subcool);
+        writerPrintf(w, "Compressor isentropic efficiency:\n");
+        writerPrintf(w, "etaC =\t%.2f\t%%\n", vc->etaC*100);
+    }
+    writerPrintf(w, "Working fluid: ");
+    for(int i = 0; i < cy->fluid.ncomp; ++i)
+    {
+        writerPrintf(w, "%s%s", (i > 0) ? ", " : "", cy->fluid.mix.name[i]);
+    }
+    writerPrintf(w, " (%s)\n", (cy->fluid.model == RealGasSRK) ? "Soave-Redlich-Kwong" : (cy->fluid.model == RealGasPR) ? "Peng-Robinson" : "Ideal gas");
+    writerPrintf(w, "Molar flowrate:\n");
+    writerPrintf(w, "n =\t%.3f\tkmol/s\n\n", n*0.001);
+    
+    if(res->status != CycleOK)
+    {
+        writerPrintf(w, "%s\n\n", status[res->status]);
+    }
+    if(res->status != CycleInvalid)
+    {
+        writerPrintf(w, "\tOutput parameters:\n");
+        writerPrintf(w, "Point\tDescription\tT (deg C)\tP (kPa)\th (kJ/kmol)\ts (kJ/kmol.K)\tq (-)\tFlow (-)\n");
+        for(int i = 0; i < res->npoint; ++i)
+        {
+            const T4CyclePoint *pt = &res->pt[i];
+            
+            writerPrintf(w, "%i\t%s\t%.3f\t%.3f\t%.2f\t%.4f\t%.4f\t%.4f\n", i + 1, res->label[i], pt->T - 273.15, pt->P*0.001, pt->h, pt->s, pt->q, res->flow[i]);
+        }
+        writerPrintf(w, "\n");
+        
+        if(cy->type == CycleVapourCompression){
+            writerPrintf(w, "Refrigeration duty:\n");
+            writerPrintf(w, "QC =\t%.3f\tkW\n", res->Qin*n*0.001);
+            writerPrintf(w, "Heat rejected:\n");
+            writerPrintf(w, "QH =\t%.3f\tkW\n", res->Qout*n*0.001);
+            writerPrintf(w, "Compressor work:\n");
+            writerPrintf(w, "W =\t%.3f\tkW\n\n", res->Win*n*0.001);
+            writerPrintf(w, "Coefficient of performance (refrigerator):\n");
+            writerPrintf(w, "CoP =\t%.4f\t[ ]\n", res->eff);
+            writerPrintf(w, "Coefficient of performance (heat pump):\n");
+            writerPrintf(w, "CoP =\t%.4f\t[ ]\n", res->effhp);
+            writerPrintf(w, "Reversible coefficient of performance (refrigerator):\n");
+            writerPrintf(w, "CoPrev =\t%.4f\t[ ]\n", res->carnot);
+            writerPrintf(w, "Second law efficiency:\n");
+            writerPrintf(w, "eta =\t%.2f\t%%\n", res->eff/res->carnot*100);
+        }else{
+            writerPrintf(w, "Heat supplied:\n");
+            writerPrintf(w, "Qin =\t%.3f\tkW\n", res->Qin*n*0.001);
+            writerPrintf(w, "Heat rejected:\n");
+            writerPrintf(w, "Qout =\t%.3f\tkW\n", res->Qout*n*0.001);
+            writerPrintf(w, "Turbine work:\n");
+            writerPrintf(w, "Wt =\t%.3f\tkW\n", res->Wout*n*0.001);
+            writerPrintf(w, "%s work:\n", (cy->type == CycleRankine) ? "Pump" : "Compressor");
+            writerPrintf(w, "Win =\t%.3f\tkW\n", res->Win*n*0.001);
+            writerPrintf(w, "Net work:\n");
+            writerPrintf(w, "Wnet =\t%.3f\tkW\n", res->Wnet*n*0.001);
+            writerPrintf(w, "Back work ratio:\n");
+            writerPrintf(w, "bwr =\t%.4f\t[ ]\n", res->Win/res->Wout);
+            if(cy->type == CycleRankine && cy->rankine.Pfwh > 0.0)
+            {
+                writerPrintf(w, "Fraction extracted to the feedwater heater:\n");
+                writerPrintf(w, "y =\t%.4f\t[ ]\n", res->y);
+            }
+            writerPrintf(w, "\nThermal efficiency:\n");
+            writerPrintf(w, "eta =\t%.2f\t%%\n", res->eff*100);
+            writerPrintf(w, "Carnot efficiency:\n");
+            writerPrintf(w, "etac =\t%.2f\t%%\n", res->carnot*100);
+        }
+        writerPrintf(w, "\nProperty calls: %i evaluated, %i from cache\n", res->misses, res->hits);
+    }
+    
+    if(count > 0)
+    {
+        writerPrintf(w, "\n\tDesign sweep:\n");
+        writerPrintf(w, "%s\tWnet (kW)\tQin (kW)\t%s\tStatus\n", design[cy->type], (cy->type == CycleVapourCompression) ? "CoP (-)" : "eta (%)");
+        for(int i = 0; i < count; ++i)
+        {
+            const T4CycleResult *r = &sweep[i];
+            
+            if(r->status == CycleInvalid){
+                writerPrintf(w, "%.4f\t-\t-\t-\tInvalid\n", CycleDesignDisplay(cy->type, r->design));
+            }else{
+                writerPrintf(w, "%.4f\t%.3f\t%.3f\t%.4f\t%s\n", CycleDesignDisplay(cy->type, r->design), r->Wnet*n*0.001, r->Qin*n*0.001, (cy->type == CycleVapourCompression) ? r->eff : r->eff*100, (r->status == CycleOK) ? "OK" : "Not converged");
+            }
+        }
+    }
+}
+
+void CycleDisplay(const T4Cycle *cy, const T4CycleResult *res, const T4CycleResult *sweep, int count)
+{
+    ResultWriter w;             // Console writer for the results.
+    
+    if(writerConsole(&w))
+    {
+        CyclePrint(&w, cy, res, sweep, count);
+        writerClose(&w);
+    }
+}
+
+void CycleWrite(const T4Cycle *cy, const T4CycleResult *res, const T4CycleResult *sweep, int count)
+{
+    //  Function variables
+    ResultWriter w;             // Buffered writer for the results file.
+    
+    //  Set file name as timestamp + Cycle Results
+    if(!writerOpen(&w, "Cycle Results"))
+    {
+        return;
+    }
+    
+    //  Write to file
+    CyclePrint(&w, cy, res, sweep, count);
+    
+    //  Close file
+    writerClose(&w);
+}
+
+void CycleWriteSwitch(const T4Cycle *cy, const T4CycleResult *res, const T4CycleResult *sweep, int count)
+{
+    if(YesNo("Do you want to save results to file? "))
+    {
+        CycleWrite(cy, res, sweep, count);
+    }
+}
+
+/// MARK: PSEUDO-MAIN FUNCTION
+void CycleSimulator(void)
+{
+    int whilmain = 0;
+    printf("Power and Refrigeration Cycles\n");
+    
+    whilmain = 1;
+    while(whilmain == 1)
+    {
+        //  Variable declaration
+        const char *design[] = {"", "boiler pressure", "pressure ratio", "condensing temperature"};
+        const char *units[] = {"", "kPa", "[ ]", "deg C"};
+        T4Cycle *cy = malloc(sizeof(T4Cycle));              // Cycle specification.
+        T4CycleWork *work = malloc(sizeof(T4CycleWork));    // Equation of state and property cache.
+        T4CycleResult res;                                  // Results of the specified design.
+        T4CycleResult *sweep = NULL;                        // Results of the design sweep.
+        int count = 0;                                      // Number of designs in the sweep.
+        double lo = 0.0;                                    // First value of the swept design variable.
+        double hi = 0.0;                                    // Last value of the swept design variable.
+        char prompt[maxstrlen];
+        
+            //  Variables for timing function
+        struct timespec start, end;
+        double elapsed = 0.0;
+        
+        if(cy == NULL || work == NULL)
+        {
+            printf("Memory could not be allocated for the cycle.\n");
+            free(cy);
+            free(work);
+            return;
+        }
+        
+        //  Data Collection
+        CycleSimVariable(cy);
+        snprintf(prompt, sizeof(prompt), "Do you want to sweep the %s? ", design[cy->type]);
+        if(YesNo(prompt))
+        {
+            snprintf(prompt, sizeof(prompt), "first %s", design[cy->type]);
+            lo = inputDouble(1, 1, prompt, units[cy->type]);
+            snprintf(prompt, sizeof(prompt), "last %s", design[cy->type]);
+            hi = inputDouble(1, 1, prompt, units[cy->type]);
+            lo = (cy->type == CycleRankine) ? lo*1000 : (cy->type == CycleVapourCompression) ? lo + 273.15 : lo;
+            hi = (cy->type == CycleRankine) ? hi*1000 : (cy->type == CycleVapourCompression) ? hi + 273.15 : hi;
+            count = (int)inputDouble(0, 0, "number of designs", "[ ]");
+            sweep = calloc(count, sizeof(T4CycleResult));
+            count = (sweep == NULL) ? 0 : count;
+        }
+        
+        //  Running calculations
+        clock_getres(CLOCK_MONOTONIC, &start);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        
+        CycleWorkReset(work);
+        CycleEvaluate(cy, work, &res);
+        if(count > 0)
+        {
+            CycleSweep(cy, lo, hi, count, sweep);
+        }
+        
+        clock_getres(CLOCK_MONOTONIC, &end);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        
+        elapsed = timer(start, end);
+        
+        printf("Calculations completed in %.6f seconds.\n", elapsed);
+        
+        //  Displaying results
+        CycleDisplay(cy, &res, sweep, count);
+        
+        //  Writing to File
+        CycleWriteSwitch(cy, &res, sweep, count);
+        
+        free(sweep);
+        free(work);
+        free(cy);
+        
+        //  Continue function
+        whilmain = Continue(whilmain);
+    }
+    fflush(stdout);
+}
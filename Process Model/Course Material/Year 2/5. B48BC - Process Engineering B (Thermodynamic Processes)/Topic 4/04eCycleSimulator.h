@@ -0,0 +1,231 @@
+//
+//  04eCycleSimulator.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef _4eCycleSimulatorStruct_h
+#define _4eCycleSimulatorStruct_h
+
+#include "03aMixingRules.h"
+#include "01gRealGasPath.h"
+
+//  Cycle types
+#define CycleRankine 1              // Rankine cycle with optional reheat and an open feedwater heater.
+#define CycleBrayton 2              // Brayton cycle with an optional recuperator.
+#define CycleVapourCompression 3    // Vapour compression refrigeration cycle.
+
+//  Evaluation status
+#define CycleOK 0                   // Every state point was found.
+#define CycleNotConverged 1         // At least one flash did not converge.
+#define CycleInvalid 2              // The specification cannot be evaluated (e.g. pressures out of order or a supercritical condenser).
+
+#define CycleMaxPoints 12           // Largest number of state points in a cycle.
+#define CycleCacheSize 32           // Number of property calls remembered within one evaluation.
+
+typedef struct T4CyclePoint{
+    double T;                       // Temperature (K).
+    double P;                       // Pressure (Pa).
+    double v;                       // Molar volume (m3/mol).
+    double h;                       // Molar enthalpy (J/mol).
+    double s;                       // Molar entropy (J/mol.K).
+    double q;                       // Vapour fraction, zero for liquid and one for vapour or supercritical fluid ([ ]).
+} T4CyclePoint;
+
+typedef struct T4CycleCache{
+    int count;                              // Number of stored entries.
+    int next;                               // Entry replaced when the cache is full.
+    int hits;                               // Property calls answered from the cache.
+    int misses;                             // Property calls that had to be evaluated.
+    int spec[CycleCacheSize];               // Kind of property call.
+    double P[CycleCacheSize];               // Pressure or saturation temperature of the call.
+    double value[CycleCacheSize];           // Temperature, enthalpy or entropy of the call.
+    int status[CycleCacheSize];             // Status returned by the call.
+    T4CyclePoint pt[CycleCacheSize][2];     // States returned (saturated liquid and vapour for saturation calls).
+} T4CycleCache;
+
+typedef struct T4CycleWork{
+    MixState st;                    // Equation of state parameters cached by temperature.
+    T4CycleCache cache;             // State points cached within one evaluation.
+} T4CycleWork;
+
+typedef struct T4RankineSpec{
+    double Pcond;                   // Condenser pressure (Pa).
+    double Pboil;                   // Boiler pressure (Pa).
+    double Tboil;                   // Turbine inlet temperature (K).
+    double Prh;                     // Reheat pressure, or zero without reheat (Pa).
+    double Trh;                     // Reheat temperature (K).
+    double Pfwh;                    // Open feedwater heater pressure, or zero without regeneration (Pa).
+    double etaT;                    // Turbine isentropic efficiency ([ ]).
+    double etaP;                    // Pump isentropic efficiency ([ ]).
+} T4RankineSpec;
+
+typedef struct T4BraytonSpec{
+    double P1;                      // Compressor inlet pressure (Pa).
+    double T1;                      // Compressor inlet temperature (K).
+    double rp;                      // Pressure ratio ([ ]).
+    double T3;                      // Turbine inlet temperature (K).
+    double etaC;                    // Compressor isentropic efficiency ([ ]).
+    double etaT;                    // Turbine isentropic efficiency ([ ]).
+    double recup;                   // Recuperator effectiveness, or zero without a recuperator ([ ]).
+} T4BraytonSpec;
+
+typedef struct T4VapCompSpec{
+    double Tevap;                   // Evaporating temperature (K).
+    double Tcond;                   // Condensing temperature (K).
+    double superheat;               // Superheat at the evaporator outlet (K).
+    double subcool;                 // Subcooling at the condenser outlet (K).
+    double etaC;                    // Compressor isentropic efficiency ([ ]).
+} T4VapCompSpec;
+
+typedef struct T4Cycle{
+    int type;                       // Cycle type.
+    double n;                       // Molar flowrate of working fluid through the boiler, heater or compressor (mol/s).
+    T1RealGas fluid;                // Working fluid. Phase change cycles need a single component described by a cubic equation of state.
+    T4RankineSpec rankine;          // Rankine cycle specification.
+    T4BraytonSpec brayton;          // Brayton cycle specification.
+    T4VapCompSpec vapcomp;          // Vapour compression cycle specification.
+} T4Cycle;
+
+typedef struct T4CycleResult{
+    int status;                             // Evaluation status.
+    double design;                          // Main design variable: boiler pressure (Pa), pressure ratio ([ ]) or condensing temperature (K).
+    int npoint;                             // Number of state points.
+    const char *label[CycleMaxPoints];      // Description of each state point.
+    T4CyclePoint pt[CycleMaxPoints];        // State points in flow order.
+    double flow[CycleMaxPoints];            // Fraction of the molar flowrate passing each state point ([ ]).
+    double Win;                             // Work supplied to pumps and compressors (J/mol).
+    double Wout;                            // Work produced by turbines (J/mol).
+    double Wnet;                            // Net work produced (J/mol). Negative for a refrigeration cycle.
+    double Qin;                             // Heat supplied by the boiler, heater or evaporator (J/mol).
+    double Qout;                            // Heat rejected by the condenser or cooler (J/mol).
+    double eff;                             // Thermal efficiency, or refrigeration coefficient of performance ([ ]).
+    double effhp;                           // Heat pump coefficient of performance. Vapour compression only ([ ]).
+    double carnot;                          // Carnot efficiency or coefficient of performance between the cycle temperature extremes ([ ]).
+    double y;                               // Fraction of flow extracted to the feedwater heater. Rankine only ([ ]).
+    int hits;                               // Property calls answered from the cache.
+    int misses;                             // Property calls evaluated.
+} T4CycleResult;
+
+#endif /* _4eCycleSimulatorStruct_h */
+
+#ifndef _4eCycleSimulatorVariable_h
+#define _4eCycleSimulatorVariable_h
+
+/// This subroutine is used to collect the cycle type, working fluid, operating conditions and component efficiencies.
+/// @param cy Struct where the cycle should be stored.
+void CycleSimVariable(T4Cycle *cy);
+
+#endif /* _4eCycleSimulatorVariable_h */
+
+#ifndef _4eCycleSimulatorCalculation_h
+#define _4eCycleSimulatorCalculation_h
+
+/// This subroutine is used to prepare a workspace for cycle evaluations. A workspace must not be shared between threads.
+/// @param w Workspace.
+void CycleWorkReset(T4CycleWork *w);
+
+/// This subroutine is used to find the saturated liquid and vapour states of a pure fluid at a pressure. The saturation temperature is found from the Clausius-Clapeyron slope of the equal fugacity pressure. This function returns "CycleOK", "CycleNotConverged", or "CycleInvalid" at or above the critical pressure.
+/// @param fluid Working fluid.
+/// @param w Workspace.
+/// @param P Pressure (Pa).
+/// @param liq Struct where the saturated liquid should be stored.
+/// @param vap Struct where the saturated vapour should be stored.
+int CycleSaturationP(const T1RealGas *fluid, T4CycleWork *w, double P, T4CyclePoint *liq, T4CyclePoint *vap);
+
+/// This subroutine is used to find the saturated liquid and vapour states of a pure fluid at a temperature by successive substitution on the fugacity coefficients. This function returns "CycleOK", "CycleNotConverged", or "CycleInvalid" at or above the critical temperature.
+/// @param fluid Working fluid.
+/// @param w Workspace.
+/// @param T Temperature (K).
+/// @param liq Struct where the saturated liquid should be stored.
+/// @param vap Struct where the saturated vapour should be stored.
+int CycleSaturationT(const T1RealGas *fluid, T4CycleWork *w, double T, T4CyclePoint *liq, T4CyclePoint *vap);
+
+/// This subroutine is used to find the state of the working fluid at a temperature and pressure. A pure fluid below its critical pressure is placed on the liquid or vapour branch by its saturation temperature. This function returns the status of the state.
+/// @param fluid Working fluid.
+/// @param w Workspace.
+/// @param T Temperature (K).
+/// @param P Pressure (Pa).
+/// @param pt Struct where the state should be stored.
+int CycleStatePT(const T1RealGas *fluid, T4CycleWork *w, double T, double P, T4CyclePoint *pt);
+
+/// This subroutine is used to find the state of the working fluid at a pressure and molar enthalpy. A pure fluid below its critical pressure may be returned as a liquid-vapour mixture. This function returns the status of the state.
+/// @param fluid Working fluid.
+/// @param w Workspace.
+/// @param P Pressure (Pa).
+/// @param h Molar enthalpy (J/mol).
+/// @param pt Struct where the state should be stored.
+int CycleStatePH(const T1RealGas *fluid, T4CycleWork *w, double P, double h, T4CyclePoint *pt);
+
+/// This subroutine is used to find the state of the working fluid at a pressure and molar entropy. A pure fluid below its critical pressure may be returned as a liquid-vapour mixture. This function returns the status of the state.
+/// @param fluid Working fluid.
+/// @param w Workspace.
+/// @param P Pressure (Pa).
+/// @param s Molar entropy (J/mol.K).
+/// @param pt Struct where the state should be stored.
+int CycleStatePS(const T1RealGas *fluid, T4CycleWork *w, double P, double s, T4CyclePoint *pt);
+
+/// This subroutine is used to find the discharge state of an adiabatic pump, compressor or turbine from its isentropic efficiency. This function returns the status of the discharge state.
+/// @param fluid Working fluid.
+/// @param w Workspace.
+/// @param eta Isentropic efficiency ([ ]).
+/// @param in Inlet state.
+/// @param P Discharge pressure (Pa).
+/// @param out Struct where the discharge state should be stored.
+int CycleMachine(const T1RealGas *fluid, T4CycleWork *w, double eta, const T4CyclePoint *in, double P, T4CyclePoint *out);
+
+/// This subroutine is used to evaluate every state point, work and heat duty of a cycle. The property cache of the workspace is emptied first, so repeated saturation and state calls within the evaluation are only calculated once. No output is printed, so the subroutine may be called in a loop or by an optimiser. This function returns the status of the evaluation.
+/// @param cy Cycle specification.
+/// @param w Workspace.
+/// @param res Struct where the results should be stored.
+int CycleEvaluate(const T4Cycle *cy, T4CycleWork *w, T4CycleResult *res);
+
+/// This subroutine is used to evaluate a cycle over evenly spaced values of its main design variable in parallel: the boiler pressure of a Rankine cycle, the pressure ratio of a Brayton cycle or the condensing temperature of a vapour compression cycle. Each worker thread keeps its own workspace.
+/// @param cy Cycle specification.
+/// @param lo First value of the design variable (Pa, [ ] or K).
+/// @param hi Last value of the design variable (Pa, [ ] or K).
+/// @param count Number of designs.
+/// @param res Array of "count" results.
+void CycleSweep(const T4Cycle *cy, double lo, double hi, int count, T4CycleResult *res);
+
+#endif /* _4eCycleSimulatorCalculation_h */
+
+#ifndef _4eCycleSimulatorDisplay_h
+#define _4eCycleSimulatorDisplay_h
+
+/// This subroutine is used to output the state points and performance of a cycle, and the design sweep when one was run, to the user console.
+/// @param cy Cycle specification.
+/// @param res Results from "CycleEvaluate(...)".
+/// @param sweep Results from "CycleSweep(...)", or NULL.
+/// @param count Number of designs in the sweep.
+void CycleDisplay(const T4Cycle *cy, const T4CycleResult *res, const T4CycleResult *sweep, int count);
+
+/// This subroutine is used to write the state points and performance of a cycle, and the design sweep when one was run, to a .txt file.
+/// @param cy Cycle specification.
+/// @param res Results from "CycleEvaluate(...)".
+/// @param sweep Results from "CycleSweep(...)", or NULL.
+/// @param count Number of designs in the sweep.
+void CycleWrite(const T4Cycle *cy, const T4CycleResult *res, const T4CycleResult *sweep, int count);
+
+/// This subroutine is used to check if the user would like to write the results to a file.
+/// @param cy Cycle specification.
+/// @param res Results from "CycleEvaluate(...)".
+/// @param sweep Results from "CycleSweep(...)", or NULL.
+/// @param count Number of designs in the sweep.
+void CycleWriteSwitch(const T4Cycle *cy, const T4CycleResult *res, const T4CycleResult *sweep, int count);
+
+#endif /* _4eCycleSimulatorDisplay_h */
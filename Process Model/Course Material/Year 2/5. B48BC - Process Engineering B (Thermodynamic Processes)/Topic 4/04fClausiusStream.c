@@ -0,0 +1,329 @@
+//
+//  04fClausiusStream.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+/// MARK: HEADER DECLARATIONS
+//  Standard header files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//  Custom header files
+#include "System.h"
+#include "ResultWriter.h"
+#include "04aThermalEfficiency.h"
+#include "04dClausiusInequality.h"
+#include "04fClausiusStream.h"
+
+/// MARK: SUBROUTINE DEFINITIONS
+#define maxstrlen 128
+
+/// MARK: VARIABLE INPUT
+void ClausiusStreamVariable(char *filename, int *celsius, long long *every)
+{
+    printf("Each line of the file should hold the heat received over a segment (kJ/kg) and the temperature at which it crosses the boundary, separated by a space, tab or comma.\n");
+    printf("File name: ");
+    fgets(filename, maxstrlen, stdin);
+    filename[strcspn(filename, "\r\n")] = '\0';
+    
+    *celsius = YesNo("Are the temperatures in deg C (otherwise K)? ");
+    *every = (long long)inputDouble(1, 0, "number of samples between running reports (0 for none)", "[ ]");
+}
+
+/// MARK: GENERAL CALCULATIONS
+void ClausiusSumAdd(T4CompSum *acc, double x)
+{
+    double t = acc->sum + x;
+    
+    if(fabs(acc->sum) >= fabs(x)){
+        acc->c += (acc->sum - t) + x;
+    }else{
+        acc->c += (x - t) + acc->sum;
+    }
+    acc->sum = t;
+}
+
+double ClausiusSumTotal(const T4CompSum *acc)
+{
+    return acc->sum + acc->c;
+}
+
+void ClausiusStreamReset(T4ClausiusStream *acc)
+{
+    memset(acc, 0, sizeof(T4ClausiusStream));
+    acc->Tmin = INFINITY;
+    acc->Tmax = 0.0;
+}
+
+int ClausiusStreamAdd(T4ClausiusStream *acc, double q, double T)
+{
+    double s = 0.0;
+    
+    if(!(T > 0.0))
+    {
+        ++acc->rejected;
+        return 0;
+    }
+    s = EntropyCalc(q, T);
+    
+    ClausiusSumAdd(&acc->cyclic, s);
+    ClausiusSumAdd(&acc->absS, fabs(s));
+    if(q > 0.0){
+        ClausiusSumAdd(&acc->qin, q);
+    }else{
+        ClausiusSumAdd(&acc->qout, q);
+    }
+    acc->naive += s;
+    acc->Tmin = fmin(acc->Tmin, T);
+    acc->Tmax = fmax(acc->Tmax, T);
+    ++acc->n;
+    
+    return 1;
+}
+
+long long ClausiusStreamRead(FILE *fp, T4ClausiusStream *acc, int celsius, long long every)
+{
+    char line[256];
+    long long accepted = 0;
+    
+    if(every > 0)
+    {
+        printf("Samples\tsum q/T (kJ/kg.K)\tS_gen (kJ/kg.K)\n");
+    }
+    while(fgets(line, sizeof(line), fp) != NULL)
+    {
+        char *end = NULL;
+        char *p = line;
+        double q = 0.0;
+        double T = 0.0;
+        
+        //  Lines longer than the buffer are skipped whole.
+        if(strchr(line, '\n') == NULL && !feof(fp))
+        {
+            int ch = 0;
+            
+            while((ch = fgetc(fp)) != '\n' && ch != EOF);
+            ++acc->rejected;
+            continue;
+        }
+        while(*p == ' ' || *p == '\t')
+        {
+            ++p;
+        }
+        if(*p == '#' || *p == '\n' || *p == '\r' || *p == '\0')
+        {
+            continue;
+        }
+        
+        q = strtod(p, &end);
+        if(end == p)
+        {
+            ++acc->rejected;
+            continue;
+        }
+        p = end;
+        while(*p == ' ' || *p == '\t' || *p == ',' || *p == ';')
+        {
+            ++p;
+        }
+        T = strtod(p, &end);
+        if(end == p)
+        {
+            ++acc->rejected;
+            continue;
+        }
+        if(celsius)
+        {
+            T = T + 273.15;
+        }
+        
+        if(ClausiusStreamAdd(acc, q, T))
+        {
+            ++accepted;
+            if(every > 0 && acc->n % every == 0)
+            {
+                double sum = ClausiusSumTotal(&acc->cyclic);
+                
+                printf("%lld\t%.9g\t%.9g\n", acc->n, sum, 0.0 - sum);
+            }
+        }
+    }
+    
+    return accepted;
+}
+
+/// MARK: DISPLAY AND WRITE
+/// This subroutine is used to print the results to a writer. Used by both "ClausiusStreamDisplay(...)" and "ClausiusStreamWrite(...)".
+static void ClausiusStreamPrint(ResultWriter *w, const T4ClausiusStream *acc)
+{
+    double sum = ClausiusSumTotal(&acc->cyclic);
+    double absS = ClausiusSumTotal(&acc->absS);
+    double qin = ClausiusSumTotal(&acc->qin);
+    double qout = ClausiusSumTotal(&acc->qout);
+    double wnet = qin + qout;
+    
+    writerPrintf(w, "_Streamed_Clausius_Inequality_Results_\n");
+    writerPrintf(w, "Samples accepted:\t%lld\n", acc->n);
+    writerPrintf(w, "Lines rejected:\t%lld\n\n", acc->rejected);
+    if(acc->n == 0)
+    {
+        writerPrintf(w, "No heat transfer segments were read.\n");
+        return;
+    }
+    
+    writerPrintf(w, "Temperature range:\n");
+    writerPrintf(w, "Tmin =\t%.3f\tK\n", acc->Tmin);
+    writerPrintf(w, "Tmax =\t%.3f\tK\n", acc->Tmax);
+    writerPrintf(w, "Heat received:\n");
+    writerPrintf(w, "q_in =\t%.6g\tkJ/kg\n", qin);
+    writerPrintf(w, "Heat rejected:\n");
+    writerPrintf(w, "q_out =\t%.6g\tkJ/kg\n", qout);
+    writerPrintf(w, "Net work produced:\n");
+    writerPrintf(w, "w =\t%.6g\tkJ/kg\n", wnet);
+    if(qin > 0.0 && wnet > 0.0)
+    {
+        writerPrintf(w, "Thermal efficiency:\n");
+        writerPrintf(w, "eta =\t%.3f\t%%\n", 100*wnet/qin);
+        writerPrintf(w, "Carnot efficiency between Tmax and Tmin:\n");
+        writerPrintf(w, "eta_c =\t%.3f\t%%\n", 100*ThermEffCarnotCalculation(acc->Tmax, acc->Tmin));
+    }
+    writerPrintf(w, "\n");
+    
+    writerPrintf(w, "Cyclic integral:\n");
+    writerPrintf(w, "sum q/T =\t%.9g\tkJ/kg.K\n", sum);
+    writerPrintf(w, "Entropy generated:\n");
+    writerPrintf(w, "S_gen =\t%.9g\tkJ/kg.K\n", 0.0 - sum);
+    writerPrintf(w, "Sum of |q/T|:\n");
+    writerPrintf(w, "sum |q/T| =\t%.9g\tkJ/kg.K\n", absS);
+    writerPrintf(w, "Rounding error removed by compensated summation:\n");
+    writerPrintf(w, "%.3g\tkJ/kg.K\n\n", acc->naive - sum);
+    
+    if(fabs(sum) <= ClausiusTol*absS){
+        writerPrintf(w, "This cycle is reversible.\n");
+    }else{
+        if(sum < 0){
+            writerPrintf(w, "This cycle does not violate the second law of thermodynamics.\n");
+        }else{
+            writerPrintf(w, "This cycle violates the second law of thermodynamics.\n");
+        }
+    }
+}
+
+void ClausiusStreamDisplay(const T4ClausiusStream *acc)
+{
+    ResultWriter w;             // Console writer for the results.
+    
+    if(writerConsole(&w))
+    {
+        ClausiusStreamPrint(&w, acc);
+        writerClose(&w);
+    }
+}
+
+void ClausiusStreamWrite(const T4ClausiusStream *acc)
+{
+    //  Function variables
+    ResultWriter w;             // Buffered writer for the results file.
+    
+    //  Set file name as timestamp + Clausius Stream Results
+    if(!writerOpen(&w, "Clausius Stream Results"))
+    {
+        return;
+    }
+    
+    //  Write to file
+    ClausiusStreamPrint(&w, acc);
+    
+    //  Close file
+    writerClose(&w);
+}
+
+void ClausiusStreamWriteSwitch(const T4ClausiusStream *acc)
+{
+    if(YesNo("Do you want to save results to file? "))
+    {
+        ClausiusStreamWrite(acc);
+    }
+}
+
+/// MARK: PSEUDO-MAIN FUNCTION
+void ClausiusStream(void)
+{
+    int whilmain = 0;
+    printf("Streamed Clausius Inequality Check\n");
+    
+    whilmain = 1;
+    while(whilmain == 1)
+    {
+        //  Variable declaration
+        char filename[maxstrlen];   // File of heat transfer segments.
+        int celsius = 0;            // Set if the file temperatures are in deg C.
+        long long every = 0;        // Samples between running reports.
+        int more = 0;               // Set while more files are to be read into the same integral.
+        T4ClausiusStream acc;       // Accumulators of the cyclic integral.
+        
+            //  Variables for timing function
+        struct timespec start, end;
+        double elapsed = 0.0;
+        
+        ClausiusStreamReset(&acc);
+        
+        more = 1;
+        while(more == 1)
+        {
+            FILE *fp = NULL;
+            long long count = 0;
+            
+            //  Data Collection
+            ClausiusStreamVariable(filename, &celsius, &every);
+            
+            fp = fopen(filename, "r");
+            if(fp == NULL){
+                printf("File \"%s\" could not be opened.\n", filename);
+            }else{
+                //  Running calculations
+                clock_getres(CLOCK_MONOTONIC, &start);
+                clock_gettime(CLOCK_MONOTONIC, &start);
+                
+                count = ClausiusStreamRead(fp, &acc, celsius, every);
+                fclose(fp);
+                
+                clock_getres(CLOCK_MONOTONIC, &end);
+                clock_gettime(CLOCK_MONOTONIC, &end);
+                
+                elapsed = timer(start, end);
+                
+                printf("%lld samples read in %.6f seconds.\n", count, elapsed);
+            }
+            more = YesNo("Do you want to add another file to the same cycle? ");
+        }
+        
+        //  Displaying results
+        ClausiusStreamDisplay(&acc);
+        
+        //  Writing to File
+        ClausiusStreamWriteSwitch(&acc);
+        
+        //  Continue function
+        whilmain = Continue(whilmain);
+    }
+    fflush(stdout);
+}
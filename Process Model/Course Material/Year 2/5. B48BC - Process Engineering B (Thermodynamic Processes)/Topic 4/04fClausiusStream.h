@@ -0,0 +1,102 @@
+//
+//  04fClausiusStream.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef _4fClausiusStreamStruct_h
+#define _4fClausiusStreamStruct_h
+
+#define ClausiusTol 1e-9    // Cyclic integral treated as zero (reversible) below this fraction of sum |q/T|.
+
+typedef struct T4CompSum{
+    double sum;             // Running sum.
+    double c;               // Running compensation for the low-order bits lost from "sum".
+} T4CompSum;
+
+typedef struct T4ClausiusStream{
+    long long n;            // Samples accepted.
+    long long rejected;     // Lines that could not be read or had a temperature at or below absolute zero.
+    T4CompSum cyclic;       // Cyclic integral of dq/T (kJ/kg.K).
+    T4CompSum absS;         // Sum of |q/T| (kJ/kg.K).
+    T4CompSum qin;          // Heat received by the cycle (kJ/kg).
+    T4CompSum qout;         // Heat rejected by the cycle, as a negative number (kJ/kg).
+    double naive;           // Cyclic integral summed without compensation, for comparison (kJ/kg.K).
+    double Tmin;            // Lowest temperature seen (K).
+    double Tmax;            // Highest temperature seen (K).
+} T4ClausiusStream;
+
+#endif /* _4fClausiusStreamStruct_h */
+
+#ifndef _4fClausiusStreamVariable_h
+#define _4fClausiusStreamVariable_h
+
+/// This subroutine is used to collect the name of a file of heat transfer samples, the temperature units it uses and how often the running integral should be reported.
+/// @param filename Array where the file name should be stored (at least 128 characters).
+/// @param celsius Variable where 1 should be stored if the temperatures are in deg C, or 0 if in K.
+/// @param every Variable where the number of samples between running reports should be stored (0 for none).
+void ClausiusStreamVariable(char *filename, int *celsius, long long *every);
+
+#endif /* _4fClausiusStreamVariable_h */
+
+#ifndef _4fClausiusStreamCalculation_h
+#define _4fClausiusStreamCalculation_h
+
+/// This subroutine is used to add a value to a compensated sum using Neumaier's variant of Kahan summation. The rounding error of each addition is carried in a separate term, so the error of a long sum does not grow with the number of terms.
+/// @param acc Compensated sum.
+/// @param x Value to be added.
+void ClausiusSumAdd(T4CompSum *acc, double x);
+
+/// This subroutine is used to find the value of a compensated sum.
+/// @param acc Compensated sum.
+double ClausiusSumTotal(const T4CompSum *acc);
+
+/// This subroutine is used to empty the accumulators before a new cycle is checked.
+/// @param acc Accumulators.
+void ClausiusStreamReset(T4ClausiusStream *acc);
+
+/// This subroutine is used to add one heat transfer segment to the cyclic integral. This function returns 1 if the segment was accepted, or 0 if its temperature is at or below absolute zero.
+/// @param acc Accumulators.
+/// @param q Heat received by the cycle over the segment (kJ/kg).
+/// @param T Temperature at which the heat crosses the boundary (K).
+int ClausiusStreamAdd(T4ClausiusStream *acc, double q, double T);
+
+/// This subroutine is used to read heat transfer segments from a file one line at a time and add them to the cyclic integral, using constant memory however long the file is. Each line holds the heat "q" (kJ/kg) and temperature "T"; lines starting with '#' and lines that cannot be read are skipped. This function returns the number of segments accepted from the file.
+/// @param fp File to be read.
+/// @param acc Accumulators, which may already hold segments from earlier files.
+/// @param celsius Set if the temperatures are in deg C rather than K.
+/// @param every Number of samples between running reports on the user console (0 for none).
+long long ClausiusStreamRead(FILE *fp, T4ClausiusStream *acc, int celsius, long long every);
+
+#endif /* _4fClausiusStreamCalculation_h */
+
+#ifndef _4fClausiusStreamDisplay_h
+#define _4fClausiusStreamDisplay_h
+
+/// This subroutine is used to output the cyclic integral, entropy generation and heat totals to the user console.
+/// @param acc Accumulators.
+void ClausiusStreamDisplay(const T4ClausiusStream *acc);
+
+/// This subroutine is used to write the cyclic integral, entropy generation and heat totals to a .txt file.
+/// @param acc Accumulators.
+void ClausiusStreamWrite(const T4ClausiusStream *acc);
+
+/// This subroutine is used to ask the user if they would like to save the results of this program to a file.
+/// @param acc Accumulators.
+void ClausiusStreamWriteSwitch(const T4ClausiusStream *acc);
+
+#endif /* _4fClausiusStreamDisplay_h */
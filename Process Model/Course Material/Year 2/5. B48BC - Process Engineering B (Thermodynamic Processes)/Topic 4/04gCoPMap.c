@@ -0,0 +1,645 @@
+//
+//  04gCoPMap.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+/// MARK: HEADER DECLARATIONS
+//  Standard header files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//  Custom header files
+#include "System.h"
+#include "ResultWriter.h"
+#include "04gCoPMap.h"
+
+/// MARK: SUBROUTINE DEFINITIONS
+#define maxstrlen 128
+#define maxloads 16
+
+/// MARK: VARIABLE INPUT
+T4CoPMap *CoPMapVariable(T4CoPMapSpec *spec)
+{
+    char input[maxstrlen];
+    int control = 0;
+    int nload = 0;
+    int nhour = 0;
+    double Tload[maxloads];
+    double *Tamb = NULL;
+    T4CoPMap *map = NULL;
+    
+    memset(spec, 0, sizeof(T4CoPMapSpec));
+    
+    control = 1;
+    while(control == 1)
+    {
+        printf("Heat pump (1) or refrigerator (2)? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+                spec->mode = CoPMapHeatPump;
+                control = 0;
+                break;
+            case '2':
+                spec->mode = CoPMapFridge;
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+    
+    control = 1;
+    while(control == 1)
+    {
+        spec->etaC = inputDouble(0, 0, "fraction of the Carnot coefficient of performance achieved", "%");
+        if(spec->etaC <= 100){
+            control = 0;
+        }else{
+            printf("No real cycle can exceed the Carnot coefficient of performance, please enter a value of at most 100 %%.\n");
+        }
+    }
+    spec->etaC = (spec->etaC)*0.01; // Conversion (% to [ ])
+    spec->dTevap = inputDouble(1, 0, "approach temperature at the evaporator", "K");
+    spec->dTcond = inputDouble(1, 0, "approach temperature at the condenser", "K");
+    spec->CoPmax = inputDouble(0, 0, "largest coefficient of performance allowed", "[ ]");
+    
+    control = 1;
+    while(control == 1)
+    {
+        spec->Tbal = inputDouble(1, 1, "balance temperature", "deg C");
+        spec->Tbal = (spec->Tbal) + 273.15; // Conversion (deg C to K)
+        spec->Tdesign = inputDouble(1, 1, "design ambient temperature", "deg C");
+        spec->Tdesign = (spec->Tdesign) + 273.15; // Conversion (deg C to K)
+        if((spec->mode == CoPMapHeatPump && spec->Tdesign < spec->Tbal) || (spec->mode == CoPMapFridge && spec->Tdesign > spec->Tbal)){
+            control = 0;
+        }else{
+            if(spec->mode == CoPMapHeatPump){
+                printf("The design ambient temperature must be below the balance temperature.\n");
+            }else{
+                printf("The design ambient temperature must be above the balance temperature.\n");
+            }
+        }
+    }
+    spec->Qdesign = inputDouble(0, 0, "demand at the design ambient temperature", "kW");
+    
+    control = 1;
+    while(control == 1)
+    {
+        nload = (int)inputDouble(0, 0, "number of load temperatures", "[ ]");
+        if(nload <= maxloads){
+            control = 0;
+        }else{
+            printf("At most %d load temperatures may be mapped.\n", maxloads);
+        }
+    }
+    for(int j = 0; j < nload; ++j)
+    {
+        char label[maxstrlen];
+        
+        if(spec->mode == CoPMapHeatPump){
+            snprintf(label, sizeof(label), "heat delivery temperature %d", j + 1);
+        }else{
+            snprintf(label, sizeof(label), "cold space temperature %d", j + 1);
+        }
+        Tload[j] = inputDouble(1, 1, label, "deg C");
+        Tload[j] = Tload[j] + 273.15; // Conversion (deg C to K)
+    }
+    
+    control = 1;
+    while(control == 1)
+    {
+        if(YesNo("Do you want to read hourly ambient temperatures from a file (otherwise a synthetic year is used)? ")){
+            int celsius = 0;
+            
+            printf("File name: ");
+            fgets(input, sizeof(input), stdin);
+            input[strcspn(input, "\r\n")] = '\0';
+            celsius = YesNo("Are the temperatures in deg C (otherwise K)? ");
+            
+            nhour = CoPMapReadProfile(input, celsius, &Tamb);
+            if(nhour > 0){
+                printf("%d hourly temperatures read.\n", nhour);
+                control = 0;
+            }else{
+                printf("No temperatures could be read from \"%s\".\n", input);
+            }
+        }else{
+            double Tmean = 0.0;
+            double annual = 0.0;
+            double daily = 0.0;
+            double coldest = 0.0;
+            
+            Tmean = inputDouble(1, 1, "annual mean ambient temperature", "deg C");
+            Tmean = Tmean + 273.15; // Conversion (deg C to K)
+            annual = inputDouble(1, 0, "amplitude of the annual variation", "K");
+            daily = inputDouble(1, 0, "amplitude of the daily variation", "K");
+            coldest = inputDouble(1, 0, "day of the year with the lowest mean temperature", "[ ]");
+            
+            nhour = 8760;
+            Tamb = malloc(nhour*sizeof(double));
+            if(Tamb == NULL)
+            {
+                return NULL;
+            }
+            CoPMapProfile(nhour, Tmean, annual, daily, coldest, Tamb);
+            control = 0;
+        }
+    }
+    
+    map = CoPMapCreate(nhour, nload);
+    if(map != NULL)
+    {
+        memcpy(map->Tamb, Tamb, nhour*sizeof(double));
+        memcpy(map->Tload, Tload, nload*sizeof(double));
+    }
+    free(Tamb);
+    
+    return map;
+}
+
+/// MARK: GENERAL CALCULATIONS
+T4CoPMap *CoPMapCreate(int nhour, int nload)
+{
+    T4CoPMap *map = NULL;
+    size_t cells = (size_t)nhour*nload;
+    
+    if(nhour < 1 || nload < 1)
+    {
+        return NULL;
+    }
+    map = calloc(1, sizeof(T4CoPMap));
+    if(map == NULL)
+    {
+        return NULL;
+    }
+    map->nhour = nhour;
+    map->nload = nload;
+    
+    map->Tamb = calloc(nhour, sizeof(double));
+    map->Q = calloc(nhour, sizeof(double));
+    map->Tload = calloc(nload, sizeof(double));
+    map->W = calloc(nload, sizeof(double));
+    map->SPF = calloc(nload, sizeof(double));
+    map->meanCoP = calloc(nload, sizeof(double));
+    map->meanEtaII = calloc(nload, sizeof(double));
+    map->CoP = calloc(cells, sizeof(double));
+    map->CoPc = calloc(cells, sizeof(double));
+    map->etaII = calloc(cells, sizeof(double));
+    
+    if(map->Tamb == NULL || map->Q == NULL || map->Tload == NULL || map->W == NULL || map->SPF == NULL || map->meanCoP == NULL || map->meanEtaII == NULL || map->CoP == NULL || map->CoPc == NULL || map->etaII == NULL)
+    {
+        CoPMapFree(map);
+        return NULL;
+    }
+    
+    return map;
+}
+
+void CoPMapFree(T4CoPMap *map)
+{
+    if(map == NULL)
+    {
+        return;
+    }
+    free(map->Tamb);
+    free(map->Q);
+    free(map->Tload);
+    free(map->W);
+    free(map->SPF);
+    free(map->meanCoP);
+    free(map->meanEtaII);
+    free(map->CoP);
+    free(map->CoPc);
+    free(map->etaII);
+    free(map);
+}
+
+void CoPMapProfile(int nhour, double Tmean, double annual, double daily, double coldest, double *T)
+{
+    for(int h = 0; h < nhour; ++h)
+    {
+        double day = h/24.0;
+        double hour = (double)(h % 24);
+        
+        T[h] = Tmean - annual*cos(2*M_PI*(day - coldest)/365.0) - daily*cos(2*M_PI*(hour - 3.0)/24.0);
+    }
+}
+
+int CoPMapReadProfile(const char *filename, int celsius, double **T)
+{
+    FILE *fp = NULL;
+    char line[256];
+    int n = 0;
+    int size = 8760;
+    double *data = NULL;
+    
+    *T = NULL;
+    fp = fopen(filename, "r");
+    if(fp == NULL)
+    {
+        return 0;
+    }
+    data = malloc(size*sizeof(double));
+    if(data == NULL)
+    {
+        fclose(fp);
+        return 0;
+    }
+    
+    while(fgets(line, sizeof(line), fp) != NULL)
+    {
+        char *end = NULL;
+        char *p = line;
+        double value = 0.0;
+        
+        while(*p == ' ' || *p == '\t')
+        {
+            ++p;
+        }
+        if(*p == '#')
+        {
+            continue;
+        }
+        value = strtod(p, &end);
+        if(end == p)
+        {
+            continue;
+        }
+        if(celsius)
+        {
+            value = value + 273.15;
+        }
+        if(n == size)
+        {
+            double *grown = realloc(data, 2*size*sizeof(double));
+            
+            if(grown == NULL)
+            {
+                break;
+            }
+            data = grown;
+            size = 2*size;
+        }
+        data[n] = value;
+        ++n;
+    }
+    fclose(fp);
+    
+    if(n == 0){
+        free(data);
+    }else{
+        *T = data;
+    }
+    
+    return n;
+}
+
+void CoPMapRow(const T4CoPMapSpec *spec, int n, const double *Tamb, double Tload, double *CoP, double *CoPc, double *etaII)
+{
+    const double etaC = spec->etaC;
+    const double CoPmax = spec->CoPmax;
+    
+    //  The reversible values follow "CoPRevHeatPump(...)" and "CoPRevFridge(...)", written out so that the loops vectorise.
+    if(spec->mode == CoPMapHeatPump){
+        const double Th = Tload + spec->dTcond;
+        
+        for(int i = 0; i < n; ++i)
+        {
+            double Tc = Tamb[i] - spec->dTevap;
+            double lift = Th - Tc;
+            double dT = Tload - Tamb[i];
+            double cop = (lift > 0.0) ? etaC*Th/lift : CoPmax;
+            double copc = (dT > 0.0) ? Tload/dT : 0.0;
+            
+            cop = (cop < CoPmax) ? cop : CoPmax;
+            CoP[i] = cop;
+            CoPc[i] = copc;
+            etaII[i] = (dT > 0.0) ? cop/copc : 0.0;
+        }
+    }else{
+        const double Tc = Tload - spec->dTevap;
+        
+        for(int i = 0; i < n; ++i)
+        {
+            double Th = Tamb[i] + spec->dTcond;
+            double lift = Th - Tc;
+            double dT = Tamb[i] - Tload;
+            double cop = (lift > 0.0) ? etaC*Tc/lift : CoPmax;
+            double copc = (dT > 0.0) ? Tload/dT : 0.0;
+            
+            cop = (cop < CoPmax) ? cop : CoPmax;
+            CoP[i] = cop;
+            CoPc[i] = copc;
+            etaII[i] = (dT > 0.0) ? cop/copc : 0.0;
+        }
+    }
+}
+
+void CoPMapEvaluate(const T4CoPMapSpec *spec, T4CoPMap *map)
+{
+    for(int j = 0; j < map->nload; ++j)
+    {
+        size_t row = (size_t)j*map->nhour;
+        
+        CoPMapRow(spec, map->nhour, map->Tamb, map->Tload[j], &map->CoP[row], &map->CoPc[row], &map->etaII[row]);
+    }
+}
+
+void CoPMapDemand(const T4CoPMapSpec *spec, T4CoPMap *map)
+{
+    //  Positive for a heat pump and negative for a refrigerator, so that one expression covers both.
+    double span = spec->Tbal - spec->Tdesign;
+    
+    for(int h = 0; h < map->nhour; ++h)
+    {
+        double frac = (span != 0.0) ? (spec->Tbal - map->Tamb[h])/span : 1.0;
+        
+        map->Q[h] = spec->Qdesign*((frac > 0.0) ? frac : 0.0);
+    }
+}
+
+void CoPMapSeasonal(T4CoPMap *map)
+{
+    map->Qtot = 0.0;
+    for(int h = 0; h < map->nhour; ++h)
+    {
+        map->Qtot += map->Q[h];
+    }
+    
+    for(int j = 0; j < map->nload; ++j)
+    {
+        const double *CoP = &map->CoP[(size_t)j*map->nhour];
+        const double *etaII = &map->etaII[(size_t)j*map->nhour];
+        double W = 0.0;
+        double sumCoP = 0.0;
+        double sumEta = 0.0;
+        int lift = 0;
+        
+        //  Each hour is one time step, so the hourly demand in kW sums to kWh.
+        for(int h = 0; h < map->nhour; ++h)
+        {
+            W += map->Q[h]/CoP[h];
+            sumCoP += CoP[h];
+            sumEta += etaII[h];
+            lift += (etaII[h] > 0.0);
+        }
+        map->W[j] = W;
+        map->SPF[j] = (W > 0.0) ? map->Qtot/W : 0.0;
+        map->meanCoP[j] = sumCoP/map->nhour;
+        map->meanEtaII[j] = (lift > 0) ? sumEta/lift : 0.0;
+    }
+}
+
+/// MARK: DISPLAY AND WRITE
+/// This subroutine is used to print the seasonal results and the binned map to a writer. Used by both "CoPMapDisplay(...)" and "CoPMapWrite(...)".
+static void CoPMapPrint(ResultWriter *w, const T4CoPMapSpec *spec, const T4CoPMap *map)
+{
+    double Tmin = INFINITY;
+    double Tmax = -INFINITY;
+    double Tlow = 0.0;
+    int nbin = 0;
+    
+    for(int h = 0; h < map->nhour; ++h)
+    {
+        Tmin = fmin(Tmin, map->Tamb[h]);
+        Tmax = fmax(Tmax, map->Tamb[h]);
+    }
+    
+    if(spec->mode == CoPMapHeatPump){
+        writerPrintf(w, "_Heat_Pump_Performance_Map_\n");
+    }else{
+        writerPrintf(w, "_Refrigerator_Performance_Map_\n");
+    }
+    writerPrintf(w, "Hours mapped:\t%d\n", map->nhour);
+    writerPrintf(w, "Ambient temperature range:\n");
+    writerPrintf(w, "Tmin =\t%.2f\tdeg C\n", Tmin - 273.15);
+    writerPrintf(w, "Tmax =\t%.2f\tdeg C\n", Tmax - 273.15);
+    writerPrintf(w, "Fraction of Carnot achieved:\n");
+    writerPrintf(w, "eta_C =\t%.1f\t%%\n", 100*spec->etaC);
+    writerPrintf(w, "Evaporator and condenser approaches:\n");
+    writerPrintf(w, "dT_evap =\t%.2f\tK\n", spec->dTevap);
+    writerPrintf(w, "dT_cond =\t%.2f\tK\n", spec->dTcond);
+    writerPrintf(w, "Seasonal demand:\n");
+    writerPrintf(w, "Q =\t%.6g\tkWh\n\n", map->Qtot);
+    
+    writerPrintf(w, "Load T (deg C)\tCoP min\tCoP mean\tCoP max\teta_II mean (%%)\tW (kWh)\tSPF\n");
+    for(int j = 0; j < map->nload; ++j)
+    {
+        const double *CoP = &map->CoP[(size_t)j*map->nhour];
+        double lo = INFINITY;
+        double hi = -INFINITY;
+        
+        for(int h = 0; h < map->nhour; ++h)
+        {
+            lo = fmin(lo, CoP[h]);
+            hi = fmax(hi, CoP[h]);
+        }
+        writerPrintf(w, "%.2f\t%.3f\t%.3f\t%.3f\t%.2f\t%.6g\t", map->Tload[j] - 273.15, lo, map->meanCoP[j], hi, 100*map->meanEtaII[j], map->W[j]);
+        if(map->W[j] > 0.0){
+            writerPrintf(w, "%.3f\n", map->SPF[j]);
+        }else{
+            writerPrintf(w, "-\n");
+        }
+    }
+    writerPrintf(w, "\n");
+    
+    //  Ambient temperature bins
+    Tlow = CoPMapBinWidth*floor((Tmin - 273.15)/CoPMapBinWidth);
+    nbin = (int)floor((Tmax - 273.15 - Tlow)/CoPMapBinWidth) + 1;
+    
+    writerPrintf(w, "Ambient bin (deg C)\tHours\tDemand (kWh)");
+    for(int j = 0; j < map->nload; ++j)
+    {
+        writerPrintf(w, "\tCoP at %.1f deg C", map->Tload[j] - 273.15);
+    }
+    writerPrintf(w, "\n");
+    for(int b = 0; b < nbin; ++b)
+    {
+        double lo = Tlow + b*CoPMapBinWidth;
+        double Qbin = 0.0;
+        int hours = 0;
+        
+        for(int h = 0; h < map->nhour; ++h)
+        {
+            int bin = (int)floor((map->Tamb[h] - 273.15 - Tlow)/CoPMapBinWidth);
+            
+            if(bin == b)
+            {
+                Qbin += map->Q[h];
+                ++hours;
+            }
+        }
+        if(hours == 0)
+        {
+            continue;
+        }
+        writerPrintf(w, "%.0f to %.0f\t%d\t%.6g", lo, lo + CoPMapBinWidth, hours, Qbin);
+        for(int j = 0; j < map->nload; ++j)
+        {
+            const double *CoP = &map->CoP[(size_t)j*map->nhour];
+            double sum = 0.0;
+            
+            for(int h = 0; h < map->nhour; ++h)
+            {
+                int bin = (int)floor((map->Tamb[h] - 273.15 - Tlow)/CoPMapBinWidth);
+                
+                if(bin == b)
+                {
+                    sum += CoP[h];
+                }
+            }
+            writerPrintf(w, "\t%.3f", sum/hours);
+        }
+        writerPrintf(w, "\n");
+    }
+}
+
+void CoPMapDisplay(const T4CoPMapSpec *spec, const T4CoPMap *map)
+{
+    ResultWriter w;             // Console writer for the results.
+    
+    if(writerConsole(&w))
+    {
+        CoPMapPrint(&w, spec, map);
+        writerClose(&w);
+    }
+}
+
+void CoPMapWrite(const T4CoPMapSpec *spec, const T4CoPMap *map)
+{
+    //  Function variables
+    ResultWriter w;             // Buffered writer for the results file.
+    char heading[maxstrlen];    // Variable used to store each load column heading.
+    
+    //  Set file name as timestamp + CoP Map Results
+    if(!writerOpen(&w, "CoP Map Results"))
+    {
+        return;
+    }
+    
+    //Write to file
+    CoPMapPrint(&w, spec, map);
+    writerEnd(&w);
+    
+    writerField(&w, "Hour");
+    writerSep(&w);
+    writerField(&w, "Tamb (deg C)");
+    writerSep(&w);
+    writerField(&w, "Q (kW)");
+    for(int j = 0; j < map->nload; ++j)
+    {
+        snprintf(heading, sizeof(heading), "CoP at %.1f deg C", map->Tload[j] - 273.15);
+        writerSep(&w);
+        writerField(&w, heading);
+        writerSep(&w);
+        writerField(&w, "CoP_c");
+        writerSep(&w);
+        writerField(&w, "eta_II (%)");
+    }
+    writerEnd(&w);
+    for(int h = 0; h < map->nhour; ++h)
+    {
+        writerNumber(&w, h, WriterFixed, 0);
+        writerSep(&w);
+        writerNumber(&w, map->Tamb[h] - 273.15, WriterFixed, 2);
+        writerSep(&w);
+        writerNumber(&w, map->Q[h], WriterFixed, 3);
+        for(int j = 0; j < map->nload; ++j)
+        {
+            size_t k = (size_t)j*map->nhour + h;
+            
+            writerSep(&w);
+            writerNumber(&w, map->CoP[k], WriterFixed, 4);
+            writerSep(&w);
+            writerNumber(&w, map->CoPc[k], WriterFixed, 4);
+            writerSep(&w);
+            writerNumber(&w, 100*map->etaII[k], WriterFixed, 2);
+        }
+        writerEnd(&w);
+    }
+    
+    //Close file
+    writerClose(&w);
+}
+
+void CoPMapWriteSwitch(const T4CoPMapSpec *spec, const T4CoPMap *map)
+{
+    if(YesNo("Do you want to save results to file? "))
+    {
+        CoPMapWrite(spec, map);
+    }
+}
+
+/// MARK: PSEUDO-MAIN FUNCTION
+void CoPMap(void)
+{
+    int whilmain = 0;
+    printf("Heat Pump and Refrigerator Performance Maps\n");
+    
+    whilmain = 1;
+    while(whilmain == 1)
+    {
+        //  Variable declaration
+        T4CoPMapSpec spec;          // Machine and demand model.
+        T4CoPMap *map = NULL;       // Performance map.
+        
+            //  Variables for timing function
+        struct timespec start, end;
+        double elapsed = 0.0;
+        
+        //  Data Collection
+        map = CoPMapVariable(&spec);
+        
+        if(map == NULL){
+            printf("Memory could not be allocated for the map.\n");
+        }else{
+            //  Running calculations
+            clock_getres(CLOCK_MONOTONIC, &start);
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            
+            CoPMapEvaluate(&spec, map);
+            CoPMapDemand(&spec, map);
+            CoPMapSeasonal(map);
+            
+            clock_getres(CLOCK_MONOTONIC, &end);
+            clock_gettime(CLOCK_MONOTONIC, &end);
+            
+            elapsed = timer(start, end);
+            
+            printf("Calculations completed in %.6f seconds.\n", elapsed);
+            
+            //  Displaying results
+            CoPMapDisplay(&spec, map);
+            
+            //  Writing to File
+            CoPMapWriteSwitch(&spec, map);
+            
+            CoPMapFree(map);
+        }
+        
+        //  Continue function
+        whilmain = Continue(whilmain);
+    }
+    fflush(stdout);
+}
@@ -0,0 +1,137 @@
+//
+//  04gCoPMap.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef _4gCoPMapStruct_h
+#define _4gCoPMapStruct_h
+
+#define CoPMapHeatPump 1    // Heat pump taking heat from the ambient and delivering it at the load temperature.
+#define CoPMapFridge 2      // Refrigerator taking heat from the load temperature and rejecting it to the ambient.
+#define CoPMapBinWidth 5.0  // Width of the ambient temperature bins in the summary (K).
+
+typedef struct T4CoPMapSpec{
+    int mode;               // "CoPMapHeatPump" or "CoPMapFridge".
+    double dTevap;          // Approach between the cold reservoir and the evaporating refrigerant (K).
+    double dTcond;          // Approach between the condensing refrigerant and the hot reservoir (K).
+    double etaC;            // Fraction of the Carnot coefficient of performance between the refrigerant temperatures achieved by the machine ([ ]).
+    double CoPmax;          // Largest coefficient of performance allowed, used when there is little or no lift ([ ]).
+    double Tbal;            // Balance temperature, beyond which there is a heating or cooling demand (K).
+    double Tdesign;         // Design ambient temperature (K).
+    double Qdesign;         // Demand at the design ambient temperature (kW).
+} T4CoPMapSpec;
+
+typedef struct T4CoPMap{
+    int nhour;              // Number of hourly ambient temperatures.
+    int nload;              // Number of load temperatures.
+    double *Tamb;           // Hourly ambient temperatures (K).
+    double *Tload;          // Load temperatures: heat delivery temperatures of a heat pump or cold space temperatures of a refrigerator (K).
+    double *CoP;            // Coefficient of performance of the machine, row "j" for load temperature "j" ([ ]).
+    double *CoPc;           // Carnot coefficient of performance between the ambient and load temperatures, or zero when there is no lift ([ ]).
+    double *etaII;          // Second law efficiency, CoP/CoPc, or zero when there is no lift ([ ]).
+    double *Q;              // Hourly heating or cooling demand (kW).
+    double Qtot;            // Seasonal demand (kWh).
+    double *W;              // Seasonal work input for each load temperature (kWh).
+    double *SPF;            // Seasonal performance factor for each load temperature ([ ]).
+    double *meanCoP;        // Time averaged coefficient of performance for each load temperature ([ ]).
+    double *meanEtaII;      // Time averaged second law efficiency over the hours with lift ([ ]).
+} T4CoPMap;
+
+#endif /* _4gCoPMapStruct_h */
+
+#ifndef _4gCoPMapVariable_h
+#define _4gCoPMapVariable_h
+
+/// This subroutine is used to collect the machine, demand model and load temperatures, and the hourly ambient temperatures from a file or a synthetic year. This function returns NULL if the map could not be allocated.
+/// @param spec Struct where the machine and demand model should be stored.
+T4CoPMap *CoPMapVariable(T4CoPMapSpec *spec);
+
+#endif /* _4gCoPMapVariable_h */
+
+#ifndef _4gCoPMapCalculation_h
+#define _4gCoPMapCalculation_h
+
+/// This subroutine is used to allocate a map. This function returns NULL if the memory could not be allocated.
+/// @param nhour Number of hourly ambient temperatures.
+/// @param nload Number of load temperatures.
+T4CoPMap *CoPMapCreate(int nhour, int nload);
+
+/// This subroutine is used to release a map made by "CoPMapCreate(...)".
+/// @param map Map to be released.
+void CoPMapFree(T4CoPMap *map);
+
+/// This subroutine is used to build a synthetic year of hourly ambient temperatures from an annual and a daily cosine, coldest at 03:00 on the coldest day.
+/// @param nhour Number of hours.
+/// @param Tmean Annual mean temperature (K).
+/// @param annual Amplitude of the annual variation (K).
+/// @param daily Amplitude of the daily variation (K).
+/// @param coldest Day of the year with the lowest mean temperature.
+/// @param T Array where the temperatures should be stored (K).
+void CoPMapProfile(int nhour, double Tmean, double annual, double daily, double coldest, double *T);
+
+/// This subroutine is used to read hourly ambient temperatures from a file, one per line. Lines starting with '#' and lines that cannot be read are skipped. This function returns the number of temperatures read, or 0 if the file could not be opened.
+/// @param filename File to be read.
+/// @param celsius Set if the temperatures are in deg C rather than K.
+/// @param T Variable where a pointer to the allocated temperatures should be stored (K).
+int CoPMapReadProfile(const char *filename, int celsius, double **T);
+
+/// This subroutine is used to evaluate one row of the map, for one load temperature, over every ambient temperature. The coefficient of performance is "etaC" times the Carnot value between the evaporating and condensing temperatures, found from the reservoirs and approaches, and limited to "CoPmax". The loop has no calls or early exits so that it can be vectorised.
+/// @param spec Machine specification.
+/// @param n Number of ambient temperatures.
+/// @param Tamb Ambient temperatures (K).
+/// @param Tload Load temperature (K).
+/// @param CoP Array where the coefficients of performance should be stored ([ ]).
+/// @param CoPc Array where the Carnot coefficients of performance should be stored ([ ]).
+/// @param etaII Array where the second law efficiencies should be stored ([ ]).
+void CoPMapRow(const T4CoPMapSpec *spec, int n, const double *Tamb, double Tload, double *CoP, double *CoPc, double *etaII);
+
+/// This subroutine is used to evaluate every row of the map with "CoPMapRow(...)".
+/// @param spec Machine specification.
+/// @param map Map with the ambient and load temperatures set.
+void CoPMapEvaluate(const T4CoPMapSpec *spec, T4CoPMap *map);
+
+/// This subroutine is used to find the hourly demand from the degree-hours beyond the balance temperature, scaled to the design demand at the design ambient temperature.
+/// @param spec Demand model.
+/// @param map Map with the ambient temperatures set.
+void CoPMapDemand(const T4CoPMapSpec *spec, T4CoPMap *map);
+
+/// This subroutine is used to aggregate each row of the map into the seasonal work, the seasonal performance factor (seasonal demand over seasonal work) and the time averaged coefficient of performance and second law efficiency.
+/// @param map Evaluated map with the hourly demand set.
+void CoPMapSeasonal(T4CoPMap *map);
+
+#endif /* _4gCoPMapCalculation_h */
+
+#ifndef _4gCoPMapDisplay_h
+#define _4gCoPMapDisplay_h
+
+/// This subroutine is used to output the seasonal results for each load temperature and the map averaged over ambient temperature bins to the user console.
+/// @param spec Machine specification.
+/// @param map Evaluated map.
+void CoPMapDisplay(const T4CoPMapSpec *spec, const T4CoPMap *map);
+
+/// This subroutine is used to write the seasonal results, the binned map and the full hourly map to a .txt file.
+/// @param spec Machine specification.
+/// @param map Evaluated map.
+void CoPMapWrite(const T4CoPMapSpec *spec, const T4CoPMap *map);
+
+/// This subroutine is used to ask the user if they would like to save the results of this program to a file.
+/// @param spec Machine specification.
+/// @param map Evaluated map.
+void CoPMapWriteSwitch(const T4CoPMapSpec *spec, const T4CoPMap *map);
+
+#endif /* _4gCoPMapDisplay_h */
@@ -34,4 +34,13 @@ void CarnotCycle(void);
 /// This subroutine is used to guide the user through evaluating the thermodynamic feasibility of a process through analysis of the conserved heat-temperature property (entropic contributions) throughout a process. After all heat contributions have been inputted into the subroutine, it then notifies the user of whether the given process is in violation of the second law of thermodynamics.
 void ClausiusInequality(void);
 
+/// This subroutine is used to simulate Rankine cycles with reheat and regeneration, Brayton cycles with recuperation and vapour compression refrigeration cycles from component efficiencies, with the working fluid described by a cubic equation of state. The main design variable of the cycle may be swept in parallel.
+void CycleSimulator(void);
+
+/// This subroutine is used to check the Clausius inequality for a logged cycle by streaming heat transfer samples from one or more files, reporting the running cyclic integral of dq/T and the entropy generated.
+void ClausiusStream(void);
+
+/// This subroutine is used to map the coefficient of performance and second law efficiency of a heat pump or refrigerator over a year of hourly ambient temperatures and several load temperatures, and to aggregate the map into seasonal performance factors.
+void CoPMap(void);
+
 #endif /* B48BC_T4_h */
@@ -28,6 +28,7 @@
 
 //Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BC_T5.h"
 #include "05aEntropyBalance.h"
 
@@ -125,92 +126,49 @@ void EntropyBalanceDisplay(double m, double cp, double T1, double T2, double TSu
 void EntropyBalanceWrite(double m, double cp, double T1, double T2, double TSurr, double SysEntropy, double SurrEntropy, double TotalEntropy)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
-    //  Set file name as timestamp + Entropy Balance Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Isobaric Entropy Balance Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-    *filepath = (char)malloc(sizeof *filepath);
-    
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-    printf("File path: \"%s\"\n", filepath);
-    
-    strcat(filepath, filename);
-    void free(void *filename); // Removing 'filename' from the heap
-    
-    printf("File name: \"%s\"\n", filename);
-    printf("Full file path: \"%s\"\n\n", filepath);
-    
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    //  Set file name as timestamp + Isobaric Entropy Balance Results
+    if(!writerOpen(&w, "Isobaric Entropy Balance Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //Open file
-    fp = fopen(filename, "w+");
     
-    //Write to file
-    fprintf(fp, "_Steady-State_Entropy_Balance_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Mass flow rate through system:\n");
-    fprintf(fp, "m =\t%.3f\tkg/s\n", m);
-    fprintf(fp, "Heat capacity at constant pressure:\n");
-    fprintf(fp, "cp =\t%.3f\tkJ/kg.K\n\n", cp);
+    //  Write to file
+    writerPrintf(&w, "_Steady-State_Entropy_Balance_Results_\n");
+    writerPrintf(&w, "\tInput parameters:\n");
+    writerPrintf(&w, "Mass flow rate through system:\n");
+    writerPrintf(&w, "m =\t%.3f\tkg/s\n", m);
+    writerPrintf(&w, "Heat capacity at constant pressure:\n");
+    writerPrintf(&w, "cp =\t%.3f\tkJ/kg.K\n\n", cp);
     
-    fprintf(fp, "Initial system temperature:\n");
-    fprintf(fp, "T1 =\t%.3f\tdeg C\n", T1 - 273.15);
-    fprintf(fp, "Final system temperature:\n");
-    fprintf(fp, "T2 =\t%.3f\tdeg C\n", T2 - 273.15);
-    fprintf(fp, "Temperature of system surroundings:\n");
-    fprintf(fp, "TSurr =\t%.3f\tdeg C\n\n", TSurr - 273.15);
+    writerPrintf(&w, "Initial system temperature:\n");
+    writerPrintf(&w, "T1 =\t%.3f\tdeg C\n", T1 - 273.15);
+    writerPrintf(&w, "Final system temperature:\n");
+    writerPrintf(&w, "T2 =\t%.3f\tdeg C\n", T2 - 273.15);
+    writerPrintf(&w, "Temperature of system surroundings:\n");
+    writerPrintf(&w, "TSurr =\t%.3f\tdeg C\n\n", TSurr - 273.15);
     
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "System entropy change:\n");
-    fprintf(fp, "dS_{sys} =\t%.3f\tkW/K\n", SysEntropy);
-    fprintf(fp, "System entropy change:\n");
-    fprintf(fp, "dS_{surr} =\t%.3f\tkW/K\n", SurrEntropy);
-    fprintf(fp, "System entropy change:\n");
-    fprintf(fp, "dS_{total} =\t%.3f\tkW/K\n\n", TotalEntropy);
+    writerPrintf(&w, "\tOutput parameters:\n");
+    writerPrintf(&w, "System entropy change:\n");
+    writerPrintf(&w, "dS_{sys} =\t%.3f\tkW/K\n", SysEntropy);
+    writerPrintf(&w, "System entropy change:\n");
+    writerPrintf(&w, "dS_{surr} =\t%.3f\tkW/K\n", SurrEntropy);
+    writerPrintf(&w, "System entropy change:\n");
+    writerPrintf(&w, "dS_{total} =\t%.3f\tkW/K\n\n", TotalEntropy);
     
     if(TotalEntropy > 0){
-        fprintf(fp, "This isobaric process is irreversible.\n");
+        writerPrintf(&w, "This isobaric process is irreversible.\n");
     }else{
         if(TotalEntropy == 0){
-            fprintf(fp, "This isobaric process is reversible.\n");
+            writerPrintf(&w, "This isobaric process is reversible.\n");
         }else{
-            fprintf(fp, "This isobaric process is impossible.\n");
+            writerPrintf(&w, "This isobaric process is impossible.\n");
         }
     }
     
-    //Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    //  Close file
+    writerClose(&w);
 }
 
 void EntropyBalanceWriteSwitch(double m, double cp, double T1, double T2, double TSurr, double SysEntropy, double SurrEntropy, double TotalEntropy)
@@ -28,6 +28,7 @@
 
 //Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "04dClausiusInequality.h"
 #include "05aEntropyBalance.h"
 #include "05bEngineEntropyBalance.h"
@@ -172,125 +173,84 @@ void EngineEntropyDisplay(int mode, double work, double TSurr, T5Reservoir hot,
 void EngineEntropyWrite(int mode, double work, double TSurr, T5Reservoir hot, T5Reservoir cold, int HotCount, int ColdCount, double dSHot, double dSCold, double dSTotal)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
+    const char *title = "Entropy Balance Results";  // Text following the timestamp in the file name.
     
-    FILE *fp;                   // Pointer to the file location.
     //  Set file name as timestamp + Heat Engine Entropy Balance Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
     if(mode == 1){
-        strcat(filename, " Heat Engine Entropy Balance Results");
+        title = "Heat Engine Entropy Balance Results";
     }
     if(mode == 2){
-        strcat(filename, " Heat Pump Entropy Balance Results");
+        title = "Heat Pump Entropy Balance Results";
     }
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-    *filepath = (char)malloc(sizeof *filepath);
-    
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-    printf("File path: \"%s\"\n", filepath);
-    
-    strcat(filepath, filename);
-    void free(void *filename); // Removing 'filename' from the heap
-    
-    printf("File name: \"%s\"\n", filename);
-    printf("Full file path: \"%s\"\n\n", filepath);
-    
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, title))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //Open file
-    fp = fopen(filename, "w+");
     
-    //Write to file
+    //  Write to file
     if(mode == 1){
-        fprintf(fp, "_Heat_Engine_Entropy_Balance_Results_\n");
+        writerPrintf(&w, "_Heat_Engine_Entropy_Balance_Results_\n");
     }
     if(mode == 2){
-        fprintf(fp, "_Heat_Pump_Entropy_Balance_Results_\n");
+        writerPrintf(&w, "_Heat_Pump_Entropy_Balance_Results_\n");
     }
-    fprintf(fp, "\tInput parameters:\n");
+    writerPrintf(&w, "\tInput parameters:\n");
     if(mode == 1){
-        fprintf(fp, "Net work:\n");
-        fprintf(fp, "work =\t%.3f\tkJ/kg\n", work);
+        writerPrintf(&w, "Net work:\n");
+        writerPrintf(&w, "work =\t%.3f\tkJ/kg\n", work);
     }
     if(mode == 2){
-        fprintf(fp, "Work input:\n");
-        fprintf(fp, "work =\t%.3f\tkJ/kg\n", work);
+        writerPrintf(&w, "Work input:\n");
+        writerPrintf(&w, "work =\t%.3f\tkJ/kg\n", work);
     }
-    fprintf(fp, "Temperature of surroundings:\n");
-    fprintf(fp, "T_{Surr} =\t%.3f\tdeg C\n\n", TSurr - 273.15);
+    writerPrintf(&w, "Temperature of surroundings:\n");
+    writerPrintf(&w, "T_{Surr} =\t%.3f\tdeg C\n\n", TSurr - 273.15);
     
-    fprintf(fp, "\tIntermediate parameters:\n");
+    writerPrintf(&w, "\tIntermediate parameters:\n");
     if(mode == 1){
-        fprintf(fp, "q_H (kJ/kg)");
+        writerPrintf(&w, "q_H (kJ/kg)");
     }
     if(mode == 2){
-        fprintf(fp, "q_C (kJ/kg)");
+        writerPrintf(&w, "q_C (kJ/kg)");
     }
-    fprintf(fp, "\tT (deg C)\t\t ds (kJ/(kg.K))\n");
+    writerPrintf(&w, "\tT (deg C)\t\t ds (kJ/(kg.K))\n");
     if(mode == 1){
         for(int i = 0; i < HotCount; ++i){
-            fprintf(fp, "%.3f\t", hot.q[i]);
-            fprintf(fp, "%.2f\t\t", hot.T[i]-273.15);
-            fprintf(fp, "%.3f\n", hot.s[i]);
+            writerPrintf(&w, "%.3f\t", hot.q[i]);
+            writerPrintf(&w, "%.2f\t\t", hot.T[i]-273.15);
+            writerPrintf(&w, "%.3f\n", hot.s[i]);
         }
     }
     if(mode == 2){
         for(int i = 0; i < ColdCount; ++i){
-            fprintf(fp, "%.3f\t", cold.q[i]);
-            fprintf(fp, "%.2f\t\t", cold.T[i]-273.15);
-            fprintf(fp, "%.3f\n", cold.s[i]);
+            writerPrintf(&w, "%.3f\t", cold.q[i]);
+            writerPrintf(&w, "%.2f\t\t", cold.T[i]-273.15);
+            writerPrintf(&w, "%.3f\n", cold.s[i]);
         }
     }
     
-    fprintf(fp, "\n");
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "Entropy change of hot reservoir(s):\n");
-    fprintf(fp, "dS_{Hot} =\t%.5f\tkJ/kg\n", dSHot);
-    fprintf(fp, "Entropy change of cold reservoir(s):\n");
-    fprintf(fp, "dS_{Cold} =\t%.5f\tkJ/kg\n", dSCold);
-    fprintf(fp, "Entropy generated:\n");
-    fprintf(fp, "dS_{Total} =\t%.5f\tkJ/kg\n", dSTotal);
+    writerPrintf(&w, "\n");
+    writerPrintf(&w, "\tOutput parameters:\n");
+    writerPrintf(&w, "Entropy change of hot reservoir(s):\n");
+    writerPrintf(&w, "dS_{Hot} =\t%.5f\tkJ/kg\n", dSHot);
+    writerPrintf(&w, "Entropy change of cold reservoir(s):\n");
+    writerPrintf(&w, "dS_{Cold} =\t%.5f\tkJ/kg\n", dSCold);
+    writerPrintf(&w, "Entropy generated:\n");
+    writerPrintf(&w, "dS_{Total} =\t%.5f\tkJ/kg\n", dSTotal);
     
     if(dSTotal > 0){
-        fprintf(fp, "This process is irreversible.\n");
+        writerPrintf(&w, "This process is irreversible.\n");
     }else{
         if(dSTotal == 0){
-            fprintf(fp, "This process is reversible.\n");
+            writerPrintf(&w, "This process is reversible.\n");
         }else{
-            fprintf(fp, "This process is impossible.\n");
+            writerPrintf(&w, "This process is impossible.\n");
         }
     }
     
-    //Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    //  Close file
+    writerClose(&w);
 }
 
 void EngineEntropyWriteSwitch(int mode, double work, double TSurr, T5Reservoir hot, T5Reservoir cold, int HotCount, int ColdCount, double dSHot, double dSCold, double dSTotal)
@@ -28,6 +28,7 @@
 
 //Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BC_T5.h"
 #include "05cStateEntropyChange.h"
 
@@ -121,6 +122,30 @@ double TvIdealCalculation(double cp, double T1, double T2, double v1, double v2)
     return ds;
 }
 
+void PTIdealBatch(int count, const double *cp, const double *P1, const double *P2, const double *T1, const double *T2, double *ds)
+{
+    for(int i = 0; i < count; ++i)
+    {
+        ds[i] = cp[i]*log(T2[i]/T1[i]) - R*log(P2[i]/P1[i]);
+    }
+}
+
+void PvIdealBatch(int count, const double *cp, const double *P1, const double *P2, const double *v1, const double *v2, double *ds)
+{
+    for(int i = 0; i < count; ++i)
+    {
+        ds[i] = cp[i]*log(v2[i]/v1[i]) + (cp[i] - R)*log(P2[i]/P1[i]);
+    }
+}
+
+void TvIdealBatch(int count, const double *cp, const double *T1, const double *T2, const double *v1, const double *v2, double *ds)
+{
+    for(int i = 0; i < count; ++i)
+    {
+        ds[i] = R*log(v2[i]/v1[i]) + (cp[i] - R)*log(T2[i]/T1[i]);
+    }
+}
+
 /// MARK: DISPLAY AND WRITE
 void EntropyChangeDisplay(double cp, double P1, double P2, double v1, double v2, double T1, double T2, double ds)
 {
@@ -151,83 +176,40 @@ void EntropyChangeDisplay(double cp, double P1, double P2, double v1, double v2,
 void EntropyChangeWrite(double cp, double P1, double P2, double v1, double v2, double T1, double T2, double ds)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
     //  Set file name as timestamp + Entropy Change Estimation
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Entropy Change Estimation");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-    *filepath = (char)malloc(sizeof *filepath);
-    
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-    printf("File path: \"%s\"\n", filepath);
-    
-    strcat(filepath, filename);
-    void free(void *filename); // Removing 'filename' from the heap
-    
-    printf("File name: \"%s\"\n", filename);
-    printf("Full file path: \"%s\"\n\n", filepath);
-    
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, "Entropy Change Estimation"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //Open file
-    fp = fopen(filename, "w+");
     
-    //Write to file
-    fprintf(fp, "_Entropy_Change_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Initial system pressure:\n");
-    fprintf(fp, "P1 =\t%.3f\tkPa\n", P1);
-    fprintf(fp, "Final system pressure:\n");
-    fprintf(fp, "P2 =\t%.3f\tkPa\n\n", P2);
+    //  Write to file
+    writerPrintf(&w, "_Entropy_Change_Results_\n");
+    writerPrintf(&w, "\tInput parameters:\n");
+    writerPrintf(&w, "Initial system pressure:\n");
+    writerPrintf(&w, "P1 =\t%.3f\tkPa\n", P1);
+    writerPrintf(&w, "Final system pressure:\n");
+    writerPrintf(&w, "P2 =\t%.3f\tkPa\n\n", P2);
     
-    fprintf(fp, "Initial molar volume:\n");
-    fprintf(fp, "v1 =\t%.3f\tm3/kmol\n", v1);
-    fprintf(fp, "Final molar volume:\n");
-    fprintf(fp, "v2 =\t%.3f\tm3/kmol\n\n", v2);
+    writerPrintf(&w, "Initial molar volume:\n");
+    writerPrintf(&w, "v1 =\t%.3f\tm3/kmol\n", v1);
+    writerPrintf(&w, "Final molar volume:\n");
+    writerPrintf(&w, "v2 =\t%.3f\tm3/kmol\n\n", v2);
     
-    fprintf(fp, "Initial system temperature:\n");
-    fprintf(fp, "T1 =\t%.3f\tdeg C\n", T1 - 273.15);
-    fprintf(fp, "Final system temperature:\n");
-    fprintf(fp, "T2 =\t%.3f\tdeg C\n\n", T2 - 273.15);
+    writerPrintf(&w, "Initial system temperature:\n");
+    writerPrintf(&w, "T1 =\t%.3f\tdeg C\n", T1 - 273.15);
+    writerPrintf(&w, "Final system temperature:\n");
+    writerPrintf(&w, "T2 =\t%.3f\tdeg C\n\n", T2 - 273.15);
     
-    fprintf(fp, "Heat capacity at constant pressure:\n");
-    fprintf(fp, "c_P =\t%.3f\tkJ/kmol.K\n\n", cp);
+    writerPrintf(&w, "Heat capacity at constant pressure:\n");
+    writerPrintf(&w, "c_P =\t%.3f\tkJ/kmol.K\n\n", cp);
     
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "ds =\t%.5f\tkJ/kmol.K\n", ds);
+    writerPrintf(&w, "\tOutput parameters:\n");
+    writerPrintf(&w, "ds =\t%.5f\tkJ/kmol.K\n", ds);
     
-    //Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    //  Close file
+    writerClose(&w);
 }
 
 void EntropyChangeWriteSwitch(double cp, double P1, double P2, double v1, double v2, double T1, double T2, double ds)
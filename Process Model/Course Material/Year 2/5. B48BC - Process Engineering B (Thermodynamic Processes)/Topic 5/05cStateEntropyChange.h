@@ -61,6 +61,36 @@ double PvIdealCalculation(double cp, double P1, double P2, double v1, double v2)
 /// @param v2 Final molar volume (m3/kmol).
 double TvIdealCalculation(double cp, double T1, double T2, double v1, double v2);
 
+/// This subroutine is used to calculate the entropy changes of many states at once from their pressure and temperature ratios, as "PTIdealCalculation(...)" does for one.
+/// @param count Number of states.
+/// @param cp Heat capacities at constant pressure (kJ/kmol.K).
+/// @param P1 Initial pressures (kPa).
+/// @param P2 Final pressures (kPa).
+/// @param T1 Initial temperatures (K).
+/// @param T2 Final temperatures (K).
+/// @param ds Array where the entropy changes should be stored (kJ/kmol.K).
+void PTIdealBatch(int count, const double *cp, const double *P1, const double *P2, const double *T1, const double *T2, double *ds);
+
+/// This subroutine is used to calculate the entropy changes of many states at once from their pressure and molar volume ratios, as "PvIdealCalculation(...)" does for one.
+/// @param count Number of states.
+/// @param cp Heat capacities at constant pressure (kJ/kmol.K).
+/// @param P1 Initial pressures (kPa).
+/// @param P2 Final pressures (kPa).
+/// @param v1 Initial molar volumes (m3/kmol).
+/// @param v2 Final molar volumes (m3/kmol).
+/// @param ds Array where the entropy changes should be stored (kJ/kmol.K).
+void PvIdealBatch(int count, const double *cp, const double *P1, const double *P2, const double *v1, const double *v2, double *ds);
+
+/// This subroutine is used to calculate the entropy changes of many states at once from their temperature and molar volume ratios, as "TvIdealCalculation(...)" does for one.
+/// @param count Number of states.
+/// @param cp Heat capacities at constant pressure (kJ/kmol.K).
+/// @param T1 Initial temperatures (K).
+/// @param T2 Final temperatures (K).
+/// @param v1 Initial molar volumes (m3/kmol).
+/// @param v2 Final molar volumes (m3/kmol).
+/// @param ds Array where the entropy changes should be stored (kJ/kmol.K).
+void TvIdealBatch(int count, const double *cp, const double *T1, const double *T2, const double *v1, const double *v2, double *ds);
+
 #endif /* StateEntropyChangeCalculation_h */
 
 #ifndef StateEntropyChangeDisplay_h
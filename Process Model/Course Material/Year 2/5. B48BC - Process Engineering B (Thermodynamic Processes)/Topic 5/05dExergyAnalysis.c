@@ -0,0 +1,603 @@
+//
+//  05dExergyAnalysis.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+/// MARK: HEADER DECLARATIONS
+//  Standard header files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//  Custom header files
+#include "System.h"
+#include "ResultWriter.h"
+#include "05cStateEntropyChange.h"
+#include "05dExergyAnalysis.h"
+
+/// MARK: SUBROUTINE DEFINITIONS
+#define maxstrlen 128
+#define R 8.3145
+
+/// MARK: VARIABLE INPUT
+T5ExSite *ExSiteVariable(void)
+{
+    char input[maxstrlen];
+    char prompt[maxstrlen];
+    T5ExSite *site = NULL;
+    int nunit = 0;
+    int nstream = 0;
+    int ncomp = 0;
+    
+    nunit = (int)inputDouble(0, 0, "number of units", "[ ]");
+    nstream = (int)inputDouble(0, 0, "number of streams", "[ ]");
+    ncomp = (int)inputDouble(0, 0, "number of components", "[ ]");
+    if(ncomp > ExMaxComp)
+    {
+        printf("At most %d components are supported.\n", ExMaxComp);
+        ncomp = ExMaxComp;
+    }
+    
+    site = ExSiteCreate(nunit, nstream, ncomp);
+    if(site == NULL)
+    {
+        printf("Memory could not be allocated for the site.\n");
+        return NULL;
+    }
+    
+    site->T0 = inputDouble(1, 1, "dead state temperature", "deg C");
+    site->T0 = (site->T0) + 273.15;
+    site->P0 = inputDouble(0, 0, "dead state pressure", "kPa");
+    for(int j = 0; j < ncomp; ++j)
+    {
+        sprintf(prompt, "standard chemical exergy of component %d", j + 1);
+        site->ex0[j] = inputDouble(1, 1, prompt, "kJ/mol");
+        site->ex0[j] = (site->ex0[j])*1000;
+    }
+    
+    for(int k = 0; k < nunit; ++k)
+    {
+        T5ExUnit *un = &site->unit[k];
+        
+        printf("Unit %d:\n", k + 1);
+        un->Q = inputDouble(1, 1, "heat added to the unit", "kW");
+        un->Tb = site->T0;
+        if(un->Q != 0.0)
+        {
+            un->Tb = inputDouble(1, 1, "temperature of the boundary the heat crosses", "deg C");
+            un->Tb = (un->Tb) + 273.15;
+        }
+        un->W = inputDouble(1, 1, "shaft work done on the unit", "kW");
+    }
+    
+    for(int s = 0; s < nstream; ++s)
+    {
+        T5ExStream *st = &site->stream[s];
+        double sum = 0.0;
+        int control = 0;
+        
+        printf("Stream %d:\n", s + 1);
+        control = 1;
+        while(control == 1)
+        {
+            st->from = (int)inputDouble(1, 0, "unit the stream leaves (0 if it enters the site)", "[ ]") - 1;
+            st->to = (int)inputDouble(1, 0, "unit the stream enters (0 if it leaves the site)", "[ ]") - 1;
+            if(st->from >= nunit || st->to >= nunit || st->from == st->to){
+                printf("A stream must join two different units, or a unit and the boundary, numbered 1 to %d.\n", nunit);
+            }else{
+                control = 0;
+            }
+        }
+        if(st->to == ExBoundary && st->from != ExBoundary)
+        {
+            st->waste = YesNo("Is the stream discarded as waste? ");
+        }
+        st->F = inputDouble(1, 0, "molar flowrate", "kmol/s");
+        st->cp = inputDouble(0, 0, "heat capacity at constant pressure", "kJ/kmol.K");
+        
+        control = 1;
+        while(control == 1)
+        {
+            printf("State given by pressure-temperature (1), pressure-molar volume (2) or temperature-molar volume (3)? ");
+            fgets(input, sizeof(input), stdin);
+            st->form = input[0] - '0';
+            if(st->form == ExPT || st->form == ExPv || st->form == ExTv){
+                control = 0;
+            }else{
+                printf("Input not recognised\n");
+            }
+        }
+        if(st->form != ExTv)
+        {
+            st->P = inputDouble(0, 0, "pressure", "kPa");
+        }
+        if(st->form != ExPv)
+        {
+            st->T = inputDouble(1, 1, "temperature", "deg C");
+            st->T = (st->T) + 273.15;
+        }
+        if(st->form != ExPT)
+        {
+            st->v = inputDouble(0, 0, "molar volume", "m3/kmol");
+        }
+        
+        st->y[0] = 1.0;
+        if(ncomp > 1)
+        {
+            for(int j = 0; j < ncomp; ++j)
+            {
+                sprintf(prompt, "mole fraction of component %d", j + 1);
+                st->y[j] = inputDouble(1, 0, prompt, "[ ]");
+                sum += st->y[j];
+            }
+            if(sum > 0.0 && fabs(sum - 1.0) > 1e-6)
+            {
+                printf("Mole fractions sum to %.4f and have been normalised.\n", sum);
+                for(int j = 0; j < ncomp; ++j)
+                {
+                    st->y[j] = (st->y[j])/sum;
+                }
+            }
+        }
+    }
+    
+    return site;
+}
+
+/// MARK: GENERAL CALCULATIONS
+T5ExSite *ExSiteCreate(int nunit, int nstream, int ncomp)
+{
+    T5ExSite *site = calloc(1, sizeof(T5ExSite));
+    
+    if(site == NULL)
+    {
+        return NULL;
+    }
+    site->nunit = nunit;
+    site->nstream = nstream;
+    site->ncomp = ncomp;
+    site->T0 = 298.15;
+    site->P0 = 101.325;
+    site->unit = calloc(nunit, sizeof(T5ExUnit));
+    site->stream = calloc(nstream, sizeof(T5ExStream));
+    site->loss = calloc(nunit + nstream, sizeof(T5ExLoss));
+    if(site->unit == NULL || site->stream == NULL || site->loss == NULL)
+    {
+        ExSiteFree(site);
+        return NULL;
+    }
+    for(int k = 0; k < nunit; ++k)
+    {
+        site->unit[k].Tb = site->T0;
+    }
+    for(int s = 0; s < nstream; ++s)
+    {
+        site->stream[s].from = ExBoundary;
+        site->stream[s].to = ExBoundary;
+        site->stream[s].form = ExPT;
+        site->stream[s].y[0] = 1.0;
+    }
+    
+    return site;
+}
+
+void ExSiteFree(T5ExSite *site)
+{
+    if(site == NULL)
+    {
+        return;
+    }
+    free(site->unit);
+    free(site->stream);
+    free(site->loss);
+    free(site);
+}
+
+void ExStreamStates(T5ExSite *site)
+{
+    int n = site->nstream;
+    double T0 = site->T0;
+    double P0 = site->P0;
+    double v0 = R*T0/P0;
+    int *idx = calloc(n, sizeof(int));
+    double *cp = calloc(n, sizeof(double));
+    double *ref1 = calloc(n, sizeof(double));
+    double *ref2 = calloc(n, sizeof(double));
+    double *x1 = calloc(n, sizeof(double));
+    double *x2 = calloc(n, sizeof(double));
+    double *ds = calloc(n, sizeof(double));
+    
+    if(idx == NULL || cp == NULL || ref1 == NULL || ref2 == NULL || x1 == NULL || x2 == NULL || ds == NULL)
+    {
+        printf("Memory could not be allocated for the stream states.\n");
+        n = 0;
+    }
+    
+    //  Completing each state from the pair given
+    for(int s = 0; s < n; ++s)
+    {
+        T5ExStream *st = &site->stream[s];
+        
+        switch(st->form)
+        {
+            case ExPv:
+                st->T = st->P*st->v/R;
+                break;
+            case ExTv:
+                st->P = R*st->T/st->v;
+                break;
+            default:
+                st->v = R*st->T/st->P;
+                break;
+        }
+    }
+    
+    //  Entropy relative to the dead state, one batch for each pair of state variables
+    for(int form = ExPT; form <= ExTv; ++form)
+    {
+        int m = 0;
+        
+        for(int s = 0; s < n; ++s)
+        {
+            const T5ExStream *st = &site->stream[s];
+            
+            if(st->form != form)
+            {
+                continue;
+            }
+            idx[m] = s;
+            cp[m] = st->cp;
+            switch(form)
+            {
+                case ExPT:
+                    ref1[m] = P0;
+                    ref2[m] = T0;
+                    x1[m] = st->P;
+                    x2[m] = st->T;
+                    break;
+                case ExPv:
+                    ref1[m] = P0;
+                    ref2[m] = v0;
+                    x1[m] = st->P;
+                    x2[m] = st->v;
+                    break;
+                default:
+                    ref1[m] = T0;
+                    ref2[m] = v0;
+                    x1[m] = st->T;
+                    x2[m] = st->v;
+                    break;
+            }
+            ++m;
+        }
+        switch(form)
+        {
+            case ExPT:
+                PTIdealBatch(m, cp, ref1, x1, ref2, x2, ds);
+                break;
+            case ExPv:
+                PvIdealBatch(m, cp, ref1, x1, ref2, x2, ds);
+                break;
+            default:
+                TvIdealBatch(m, cp, ref1, x1, ref2, x2, ds);
+                break;
+        }
+        for(int i = 0; i < m; ++i)
+        {
+            site->stream[idx[i]].s = ds[i];
+        }
+    }
+    
+    //  Physical and chemical exergy
+    for(int s = 0; s < n; ++s)
+    {
+        T5ExStream *st = &site->stream[s];
+        double mix = 0.0;
+        
+        st->exph = st->cp*(st->T - T0) - T0*st->s;
+        st->exch = 0.0;
+        for(int j = 0; j < site->ncomp; ++j)
+        {
+            st->exch += st->y[j]*site->ex0[j];
+            if(st->y[j] > 0.0)
+            {
+                mix += st->y[j]*log(st->y[j]);
+            }
+        }
+        st->exch += R*T0*mix;
+    }
+    
+    free(idx);
+    free(cp);
+    free(ref1);
+    free(ref2);
+    free(x1);
+    free(x2);
+    free(ds);
+}
+
+void ExUnitBalance(T5ExSite *site)
+{
+    double T0 = site->T0;
+    
+    site->Exin = 0.0;
+    site->Exout = 0.0;
+    site->Exd = 0.0;
+    site->Sgen = 0.0;
+    
+    //  Heat and work
+    for(int k = 0; k < site->nunit; ++k)
+    {
+        T5ExUnit *un = &site->unit[k];
+        double Qex = un->Q*(1 - T0/un->Tb);
+        
+        un->Exdph = un->W + Qex;
+        un->Exdch = 0.0;
+        un->Exin = fmax(un->W, 0.0) + fmax(Qex, 0.0);
+        site->Exin += un->Exin;
+        site->Exout += fmax(-un->W, 0.0) + fmax(-Qex, 0.0);
+    }
+    
+    //  Streams, in minus out
+    for(int s = 0; s < site->nstream; ++s)
+    {
+        const T5ExStream *st = &site->stream[s];
+        double Eph = st->F*st->exph;
+        double Ech = st->F*st->exch;
+        
+        if(st->to == ExBoundary){
+            site->Exout += Eph + Ech;
+        }else{
+            site->unit[st->to].Exdph += Eph;
+            site->unit[st->to].Exdch += Ech;
+            site->unit[st->to].Exin += Eph + Ech;
+        }
+        if(st->from == ExBoundary){
+            site->Exin += Eph + Ech;
+        }else{
+            site->unit[st->from].Exdph -= Eph;
+            site->unit[st->from].Exdch -= Ech;
+        }
+    }
+    
+    //  Destruction and entropy generation (Gouy-Stodola)
+    for(int k = 0; k < site->nunit; ++k)
+    {
+        T5ExUnit *un = &site->unit[k];
+        
+        un->Exd = un->Exdph + un->Exdch;
+        un->Sgen = un->Exd/T0;
+        un->psi = (un->Exin > 0.0) ? 1 - un->Exd/un->Exin : 0.0;
+        site->Exd += un->Exd;
+        site->Sgen += un->Sgen;
+    }
+}
+
+/// This subroutine is used to order losses largest first. Used by "qsort(...)".
+static int ExLossCompare(const void *a, const void *b)
+{
+    double la = ((const T5ExLoss *)a)->Ex;
+    double lb = ((const T5ExLoss *)b)->Ex;
+    
+    return (la < lb) - (la > lb);
+}
+
+void ExRankLosses(T5ExSite *site)
+{
+    site->nloss = 0;
+    for(int k = 0; k < site->nunit; ++k)
+    {
+        site->loss[site->nloss].kind = 0;
+        site->loss[site->nloss].ref = k;
+        site->loss[site->nloss].Ex = site->unit[k].Exd;
+        ++site->nloss;
+    }
+    for(int s = 0; s < site->nstream; ++s)
+    {
+        const T5ExStream *st = &site->stream[s];
+        
+        if(st->to == ExBoundary && st->from != ExBoundary && st->waste)
+        {
+            site->loss[site->nloss].kind = 1;
+            site->loss[site->nloss].ref = s;
+            site->loss[site->nloss].Ex = st->F*(st->exph + st->exch);
+            ++site->nloss;
+        }
+    }
+    qsort(site->loss, site->nloss, sizeof(T5ExLoss), ExLossCompare);
+}
+
+void ExSiteAnalyse(T5ExSite *site)
+{
+    ExStreamStates(site);
+    ExUnitBalance(site);
+    ExRankLosses(site);
+}
+
+/// MARK: DISPLAY AND WRITE
+/// This subroutine is used to print the results to a writer. Used by both "ExSiteDisplay(...)" and "ExSiteWrite(...)".
+static void ExSitePrint(ResultWriter *w, const T5ExSite *site)
+{
+    double total = 0.0;
+    
+    for(int i = 0; i < site->nloss; ++i)
+    {
+        total += site->loss[i].Ex;
+    }
+    
+    writerPrintf(w, "_Exergy_and_Entropy_Generation_Analysis_\n");
+    writerPrintf(w, "\tDead state:\n");
+    writerPrintf(w, "T0 =\t%.3f\tdeg C\n", site->T0 - 273.15);
+    writerPrintf(w, "P0 =\t%.3f\tkPa\n", site->P0);
+    for(int j = 0; j < site->ncomp; ++j)
+    {
+        writerPrintf(w, "ex0(%d) =\t%.3f\tkJ/mol\n", j + 1, site->ex0[j]*0.001);
+    }
+    writerPrintf(w, "\n");
+    
+    writerPrintf(w, "\tStreams:\n");
+    writerPrintf(w, "Stream\tFrom\tTo\tF (kmol/s)\tT (deg C)\tP (kPa)\tv (m3/kmol)\ts - s0 (kJ/kmol.K)\tex_ph (kJ/kmol)\tex_ch (kJ/kmol)\tExergy flow (kW)\tLeaves as\n");
+    for(int s = 0; s < site->nstream; ++s)
+    {
+        const T5ExStream *st = &site->stream[s];
+        
+        writerPrintf(w, "%d\t", s + 1);
+        if(st->from == ExBoundary){
+            writerPrintf(w, "-\t");
+        }else{
+            writerPrintf(w, "%d\t", st->from + 1);
+        }
+        if(st->to == ExBoundary){
+            writerPrintf(w, "-\t");
+        }else{
+            writerPrintf(w, "%d\t", st->to + 1);
+        }
+        writerPrintf(w, "%.5f\t%.3f\t%.3f\t%.5f\t%.4f\t%.3f\t%.3f\t%.3f\t", st->F, st->T - 273.15, st->P, st->v, st->s, st->exph, st->exch, st->F*(st->exph + st->exch));
+        if(st->to != ExBoundary || st->from == ExBoundary){
+            writerPrintf(w, "-\n");
+        }else if(st->waste){
+            writerPrintf(w, "Waste\n");
+        }else{
+            writerPrintf(w, "Product\n");
+        }
+    }
+    writerPrintf(w, "\n");
+    
+    writerPrintf(w, "\tUnits:\n");
+    writerPrintf(w, "Unit\tQ (kW)\tTb (deg C)\tW (kW)\tEx_d,ph (kW)\tEx_d,ch (kW)\tEx_d (kW)\tS_gen (kW/K)\tpsi (%%)\tSecond law\n");
+    for(int k = 0; k < site->nunit; ++k)
+    {
+        const T5ExUnit *un = &site->unit[k];
+        
+        writerPrintf(w, "%d\t%.3f\t%.3f\t%.3f\t%.3f\t%.3f\t%.3f\t%.5f\t%.2f\t%s\n", k + 1, un->Q, un->Tb - 273.15, un->W, un->Exdph, un->Exdch, un->Exd, un->Sgen, un->psi*100, (un->Exd < -1e-9*fmax(un->Exin, 1.0)) ? "Violated" : "Satisfied");
+    }
+    writerPrintf(w, "\n");
+    
+    writerPrintf(w, "\tRanked losses:\n");
+    writerPrintf(w, "Rank\tSource\tEx (kW)\tShare (%%)\n");
+    for(int i = 0; i < site->nloss; ++i)
+    {
+        const T5ExLoss *ls = &site->loss[i];
+        
+        if(ls->kind == 0){
+            writerPrintf(w, "%d\tDestroyed in unit %d\t", i + 1, ls->ref + 1);
+        }else{
+            writerPrintf(w, "%d\tDiscarded in waste stream %d\t", i + 1, ls->ref + 1);
+        }
+        writerPrintf(w, "%.3f\t%.2f\n", ls->Ex, (total != 0.0) ? 100*ls->Ex/total : 0.0);
+    }
+    writerPrintf(w, "\n");
+    
+    writerPrintf(w, "\tSite:\n");
+    writerPrintf(w, "Exergy supplied by feeds, work and heat:\n");
+    writerPrintf(w, "Ex_in =\t%.3f\tkW\n", site->Exin);
+    writerPrintf(w, "Exergy destroyed:\n");
+    writerPrintf(w, "Ex_d =\t%.3f\tkW\n", site->Exd);
+    writerPrintf(w, "Exergy carried out by products, wastes and exported work and heat:\n");
+    writerPrintf(w, "Ex_out =\t%.3f\tkW\n", site->Exout);
+    writerPrintf(w, "Entropy generated:\n");
+    writerPrintf(w, "S_gen =\t%.5f\tkW/K\n", site->Sgen);
+}
+
+void ExSiteDisplay(const T5ExSite *site)
+{
+    ResultWriter w;             // Console writer for the results.
+    
+    if(writerConsole(&w))
+    {
+        ExSitePrint(&w, site);
+        writerClose(&w);
+    }
+}
+
+void ExSiteWrite(const T5ExSite *site)
+{
+    //  Function variables
+    ResultWriter w;             // Buffered writer for the results file.
+    
+    //  Set file name as timestamp + Exergy Analysis Results
+    if(!writerOpen(&w, "Exergy Analysis Results"))
+    {
+        return;
+    }
+    
+    //  Write to file
+    ExSitePrint(&w, site);
+    
+    //  Close file
+    writerClose(&w);
+}
+
+void ExSiteWriteSwitch(const T5ExSite *site)
+{
+    if(YesNo("Do you want to save results to file? "))
+    {
+        ExSiteWrite(site);
+    }
+}
+
+/// MARK: PSEUDO-MAIN FUNCTION
+void ExergyAnalysis(void)
+{
+    int whilmain = 0;
+    printf("Exergy and Entropy Generation Analysis\n");
+    
+    whilmain = 1;
+    while(whilmain == 1)
+    {
+        //  Variable declaration
+        T5ExSite *site = NULL;      // Units and streams of the site.
+        
+            //  Variables for timing function
+        struct timespec start, end;
+        double elapsed = 0.0;
+        
+        //  Data Collection
+        site = ExSiteVariable();
+        
+        if(site != NULL)
+        {
+            //  Running calculations
+            clock_getres(CLOCK_MONOTONIC, &start);
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            
+            ExSiteAnalyse(site);
+            
+            clock_getres(CLOCK_MONOTONIC, &end);
+            clock_gettime(CLOCK_MONOTONIC, &end);
+            
+            elapsed = timer(start, end);
+            
+            printf("Calculations completed in %.6f seconds.\n", elapsed);
+            
+            //  Displaying results
+            ExSiteDisplay(site);
+            
+            //  Writing to File
+            ExSiteWriteSwitch(site);
+            
+            ExSiteFree(site);
+        }
+        
+        //  Continue function
+        whilmain = Continue(whilmain);
+    }
+    fflush(stdout);
+}
@@ -0,0 +1,140 @@
+//
+//  05dExergyAnalysis.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef _5dExergyAnalysisStruct_h
+#define _5dExergyAnalysisStruct_h
+
+#define ExMaxComp 8         // Largest number of components.
+#define ExBoundary -1       // Stream end that lies outside the site.
+#define ExPT 1              // Stream state given by pressure and temperature.
+#define ExPv 2              // Stream state given by pressure and molar volume.
+#define ExTv 3              // Stream state given by temperature and molar volume.
+
+typedef struct T5ExStream{
+    int from;               // Unit the stream leaves, or "ExBoundary".
+    int to;                 // Unit the stream enters, or "ExBoundary".
+    int form;               // Pair of state variables given: "ExPT", "ExPv" or "ExTv".
+    int waste;              // Stream leaving the site is discarded as waste (1) or kept as a product (0).
+    double F;               // Molar flowrate (kmol/s).
+    double cp;              // Ideal gas heat capacity at constant pressure (kJ/kmol.K).
+    double P;               // Pressure (kPa).
+    double T;               // Temperature (K).
+    double v;               // Molar volume (m3/kmol).
+    double y[ExMaxComp];    // Mole fractions ([ ]).
+    //  Calculated
+    double s;               // Entropy relative to the dead state at the same composition (kJ/kmol.K).
+    double exph;            // Physical exergy (kJ/kmol).
+    double exch;            // Chemical exergy (kJ/kmol).
+} T5ExStream;
+
+typedef struct T5ExUnit{
+    double Q;               // Heat added to the unit (kW).
+    double Tb;              // Temperature of the boundary the heat crosses (K).
+    double W;               // Shaft work done on the unit (kW).
+    //  Calculated
+    double Exdph;           // Physical exergy destroyed (kW).
+    double Exdch;           // Chemical exergy destroyed (kW).
+    double Exd;             // Total exergy destroyed (kW).
+    double Sgen;            // Entropy generated (kW/K).
+    double Exin;            // Exergy supplied to the unit (kW).
+    double psi;             // Exergetic efficiency, 1 - Exd/Exin ([ ]).
+} T5ExUnit;
+
+typedef struct T5ExLoss{
+    int kind;               // Destruction in a unit (0) or exergy discarded from the site in a waste stream (1).
+    int ref;                // Unit or stream.
+    double Ex;              // Exergy lost (kW).
+} T5ExLoss;
+
+typedef struct T5ExSite{
+    int nunit;              // Number of units.
+    int nstream;            // Number of streams.
+    int ncomp;              // Number of components.
+    double T0;              // Dead state temperature (K).
+    double P0;              // Dead state pressure (kPa).
+    double ex0[ExMaxComp];  // Standard chemical exergy of each component at the dead state (kJ/kmol).
+    T5ExUnit *unit;         // Units.
+    T5ExStream *stream;     // Streams.
+    //  Calculated
+    int nloss;              // Number of losses ranked.
+    T5ExLoss *loss;         // Losses, largest first.
+    double Exin;            // Exergy supplied to the site by feeds, work and heat (kW).
+    double Exd;             // Exergy destroyed in the units (kW).
+    double Exout;           // Exergy carried out of the site by streams, and by exported work and heat (kW).
+    double Sgen;            // Entropy generated in the units (kW/K).
+} T5ExSite;
+
+#endif /* _5dExergyAnalysisStruct_h */
+
+#ifndef _5dExergyAnalysisVariable_h
+#define _5dExergyAnalysisVariable_h
+
+/// This subroutine is used to collect the dead state, components, units and streams of the site. This function returns NULL if the site could not be allocated.
+T5ExSite *ExSiteVariable(void);
+
+#endif /* _5dExergyAnalysisVariable_h */
+
+#ifndef _5dExergyAnalysisCalculation_h
+#define _5dExergyAnalysisCalculation_h
+
+/// This subroutine is used to allocate an empty site with the dead state at 298.15 K and 101.325 kPa. This function returns NULL if the memory could not be allocated.
+/// @param nunit Number of units.
+/// @param nstream Number of streams.
+/// @param ncomp Number of components (at most "ExMaxComp").
+T5ExSite *ExSiteCreate(int nunit, int nstream, int ncomp);
+
+/// This subroutine is used to release a site made by "ExSiteCreate(...)".
+/// @param site Site to be released.
+void ExSiteFree(T5ExSite *site);
+
+/// This subroutine is used to find the state, entropy and exergy of every stream. The streams are grouped by the pair of state variables given, and the entropy of each group relative to the dead state is found in one call of "PTIdealBatch(...)", "PvIdealBatch(...)" or "TvIdealBatch(...)". The physical exergy is then (h - h0) - T0(s - s0), and the chemical exergy is the mole fraction weighted standard chemical exergy plus the ideal mixing term R T0 sum(y ln y).
+/// @param site Site to be analysed.
+void ExStreamStates(T5ExSite *site);
+
+/// This subroutine is used to find the exergy destroyed and entropy generated in every unit from its exergy balance. Heat carries exergy Q(1 - T0/Tb) and shaft work is pure exergy. The destruction is split into the change in chemical exergy of the streams and the physical remainder, and the entropy generated is the destruction over T0. Each stream is visited once.
+/// @param site Site to be analysed.
+void ExUnitBalance(T5ExSite *site);
+
+/// This subroutine is used to rank the exergy destroyed in each unit and the exergy discarded from the site in each waste stream, largest first. Exergy carried out in products is kept, so it is not ranked as a loss.
+/// @param site Site to be analysed.
+void ExRankLosses(T5ExSite *site);
+
+/// This subroutine is used to run "ExStreamStates(...)", "ExUnitBalance(...)" and "ExRankLosses(...)" in turn.
+/// @param site Site to be analysed.
+void ExSiteAnalyse(T5ExSite *site);
+
+#endif /* _5dExergyAnalysisCalculation_h */
+
+#ifndef _5dExergyAnalysisDisplay_h
+#define _5dExergyAnalysisDisplay_h
+
+/// This subroutine is used to output the stream exergies, unit exergy destruction and ranked losses to the user console.
+/// @param site Analysed site.
+void ExSiteDisplay(const T5ExSite *site);
+
+/// This subroutine is used to write the stream exergies, unit exergy destruction and ranked losses to a .txt file.
+/// @param site Analysed site.
+void ExSiteWrite(const T5ExSite *site);
+
+/// This subroutine is used to ask the user if they would like to save the results of this program to a file.
+/// @param site Analysed site.
+void ExSiteWriteSwitch(const T5ExSite *site);
+
+#endif /* _5dExergyAnalysisDisplay_h */
@@ -17,4 +17,7 @@ void EngineEntropyBalance(void);
 /// This subroutine is used to guide the user through estimating the entropy change of a system through the Gibbs-Duhem statement combined with the entropy Maxwell equation. This subroutine is not applicable where the working fluid changes phase between the two end-states.
 void StateEntropyChange(void);
 
+/// This subroutine is used to guide the user through an exergy analysis of a site of units and streams, finding the physical and chemical exergy destroyed and entropy generated in each unit and ranking the losses.
+void ExergyAnalysis(void);
+
 #endif /* B48BC_T5_h */
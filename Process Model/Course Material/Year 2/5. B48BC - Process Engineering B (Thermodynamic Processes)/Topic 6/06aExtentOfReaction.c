@@ -28,6 +28,7 @@
 
 //Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BC_T6.h"
 #include "06aExtentOfReaction.h"
 
@@ -66,71 +67,28 @@ void EoRDisplay(double reacted, double stoich, double EoR)
 void EoRWrite(double reacted, double stoich, double EoR)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
     //  Set file name as timestamp + Extent of Reaction Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Extent of Reaction Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-    *filepath = (char)malloc(sizeof *filepath);
-    
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-    printf("File path: \"%s\"\n", filepath);
-    
-    strcat(filepath, filename);
-    void free(void *filename); // Removing 'filename' from the heap
-    
-    printf("File name: \"%s\"\n", filename);
-    printf("Full file path: \"%s\"\n\n", filepath);
-    
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, "Extent of Reaction Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //Open file
-    fp = fopen(filename, "w+");
     
-    //Write to file
-    fprintf(fp, "_Extent_of_Reaction_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Moles of species reacted:\n");
-    fprintf(fp, "\\Delta{n}_i =\t%.3f\tmol\n", reacted);
-    fprintf(fp, "Stoichiometric coefficient:\n");
-    fprintf(fp, "v_i =\t%.3f\n\n", stoich);
+    //  Write to file
+    writerPrintf(&w, "_Extent_of_Reaction_Results_\n");
+    writerPrintf(&w, "\tInput parameters:\n");
+    writerPrintf(&w, "Moles of species reacted:\n");
+    writerPrintf(&w, "\\Delta{n}_i =\t%.3f\tmol\n", reacted);
+    writerPrintf(&w, "Stoichiometric coefficient:\n");
+    writerPrintf(&w, "v_i =\t%.3f\n\n", stoich);
     
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "Extent of Reaction:\n");
-    fprintf(fp, "\\varepsilon = \t%.3f\tmol\n", EoR);
+    writerPrintf(&w, "\tOutput parameters:\n");
+    writerPrintf(&w, "Extent of Reaction:\n");
+    writerPrintf(&w, "\\varepsilon = \t%.3f\tmol\n", EoR);
     
-    //Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    //  Close file
+    writerClose(&w);
 }
 
 void EoRWriteSwitch(double reacted, double stoich, double EoR)
@@ -28,6 +28,7 @@
 
 //Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BC_T6.h"
 #include "06bEquilibriumConversion.h"
 
@@ -112,99 +113,56 @@ void EquiConvDisplay(int mode, double reacted, double stoich, double EoR, double
 void EquiConvWrite(int mode, double reacted, double stoich, double EoR, double initial, double Conv)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
     //  Set file name as timestamp + Equilibrium Conversion Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Equilibrium Conversion Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-    *filepath = (char)malloc(sizeof *filepath);
-    
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-    printf("File path: \"%s\"\n", filepath);
-    
-    strcat(filepath, filename);
-    void free(void *filename); // Removing 'filename' from the heap
-    
-    printf("File name: \"%s\"\n", filename);
-    printf("Full file path: \"%s\"\n\n", filepath);
-    
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, "Equilibrium Conversion Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //Open file
-    fp = fopen(filename, "w+");
     
-    //Write to file
-    fprintf(fp, "_Equilibrium_Conversion_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
+    //  Write to file
+    writerPrintf(&w, "_Equilibrium_Conversion_Results_\n");
+    writerPrintf(&w, "\tInput parameters:\n");
     if(mode == 1)
     {
-        fprintf(fp, "Moles of i ");
+        writerPrintf(&w, "Moles of i ");
         if(stoich < 0){
-            fprintf(fp, "reacted:\n");
+            writerPrintf(&w, "reacted:\n");
         }else{
-            fprintf(fp, "produced:\n");
+            writerPrintf(&w, "produced:\n");
         }
-        fprintf(fp, "\\Delta{n}_i =\t%.3f\tmol\n", reacted);
+        writerPrintf(&w, "\\Delta{n}_i =\t%.3f\tmol\n", reacted);
     }
     if(mode == 2)
     {
-        fprintf(fp, "Stoichiometric coefficient:\n");
-        fprintf(fp, "v_i =\t%.3f\n", stoich);
+        writerPrintf(&w, "Stoichiometric coefficient:\n");
+        writerPrintf(&w, "v_i =\t%.3f\n", stoich);
         
-        fprintf(fp, "Extent of reaction:\n");
-        fprintf(fp, "\\varepsilon =\t%.3f\tmol\n", EoR);
+        writerPrintf(&w, "Extent of reaction:\n");
+        writerPrintf(&w, "\\varepsilon =\t%.3f\tmol\n", EoR);
     }
-    fprintf(fp, "Initial moles of species i:\n");
-    fprintf(fp, "n_{i, 0} =\t%.3f\tmol\n\n", initial);
+    writerPrintf(&w, "Initial moles of species i:\n");
+    writerPrintf(&w, "n_{i, 0} =\t%.3f\tmol\n\n", initial);
     
     if(mode == 2)
     {
-        fprintf(fp, "\tIntermediate parameters:\n");
-        fprintf(fp, "Moles of i");
+        writerPrintf(&w, "\tIntermediate parameters:\n");
+        writerPrintf(&w, "Moles of i");
         if(stoich < 0){
-            fprintf(fp, " reacted:\n");
+            writerPrintf(&w, " reacted:\n");
         }else{
-            fprintf(fp, " produced:\n");
+            writerPrintf(&w, " produced:\n");
         }
-        fprintf(fp, "\\Delta{n}_i =\t%.3f\tmol\n\n", stoich*EoR);
+        writerPrintf(&w, "\\Delta{n}_i =\t%.3f\tmol\n\n", stoich*EoR);
     }
     
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "Equilibrium conversion:\n");
-    fprintf(fp, "\\chi =\t%.3f\n", Conv);
+    writerPrintf(&w, "\tOutput parameters:\n");
+    writerPrintf(&w, "Equilibrium conversion:\n");
+    writerPrintf(&w, "\\chi =\t%.3f\n", Conv);
     
-    //Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    //  Close file
+    writerClose(&w);
 }
 
 void EquiConvWriteSwitch(int mode, double reacted, double stoich, double EoR, double initial, double Conv)
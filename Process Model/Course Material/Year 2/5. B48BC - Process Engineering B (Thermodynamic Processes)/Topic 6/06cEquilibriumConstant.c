@@ -28,6 +28,7 @@
 
 //Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BC_T6.h"
 #include "06cEquilibriumConstant.h"
 
@@ -170,97 +171,54 @@ void EquiConstDisplay(int mode, double h_rxn, double K1, double K2, double KP, d
 void EquiConstWrite(int mode, double h_rxn, double K1, double K2, double KP, double T1, double T2, double P1, double stoich)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
     //  Set file name as timestamp + Equilibrium Constant Estimation
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Equilibrium Constant Estimation");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-    *filepath = (char)malloc(sizeof *filepath);
-    
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-    printf("File path: \"%s\"\n", filepath);
-    
-    strcat(filepath, filename);
-    void free(void *filename); // Removing 'filename' from the heap
-    
-    printf("File name: \"%s\"\n", filename);
-    printf("Full file path: \"%s\"\n\n", filepath);
-    
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, "Equilibrium Constant Estimation"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //Open file
-    fp = fopen(filename, "w+");
     
-    //Write to file
-    fprintf(fp, "_Equilibrium_Constant_Estimation_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Overall stoichiometric coefficient:\n");
-    fprintf(fp, "v =\t%.3f\n", stoich);
-    fprintf(fp, "Enthalpy change of reaction:\n");
-    fprintf(fp, "h_rxn =\t%.3f\tJ/mol\n\n", h_rxn);
+    //  Write to file
+    writerPrintf(&w, "_Equilibrium_Constant_Estimation_\n");
+    writerPrintf(&w, "\tInput parameters:\n");
+    writerPrintf(&w, "Overall stoichiometric coefficient:\n");
+    writerPrintf(&w, "v =\t%.3f\n", stoich);
+    writerPrintf(&w, "Enthalpy change of reaction:\n");
+    writerPrintf(&w, "h_rxn =\t%.3f\tJ/mol\n\n", h_rxn);
     
-    fprintf(fp, "Reference equilibrium constant:\n");
-    fprintf(fp, "K1 =\t%.3f\t[ ]\n\n", K1);
+    writerPrintf(&w, "Reference equilibrium constant:\n");
+    writerPrintf(&w, "K1 =\t%.3f\t[ ]\n\n", K1);
     
-    fprintf(fp, "Reference temperature:\n");
-    fprintf(fp, "T1 =\t%.3f\tdeg C\n", T1 - 273.15);
-    fprintf(fp, "System temperature:\n");
-    fprintf(fp, "T2 =\t%.3f\tdeg C\n\n", T2 - 273.15);
+    writerPrintf(&w, "Reference temperature:\n");
+    writerPrintf(&w, "T1 =\t%.3f\tdeg C\n", T1 - 273.15);
+    writerPrintf(&w, "System temperature:\n");
+    writerPrintf(&w, "T2 =\t%.3f\tdeg C\n\n", T2 - 273.15);
     
     if(mode == 2)
     {
-        fprintf(fp, "Reference pressure:\n");
-        fprintf(fp, "P1 =\t%.3f\tbar\n\n", P1);
+        writerPrintf(&w, "Reference pressure:\n");
+        writerPrintf(&w, "P1 =\t%.3f\tbar\n\n", P1);
         
-        fprintf(fp, "\tIntermediate parameters:\n");
-        fprintf(fp, "Temperature adjusted equilibrium constant:\n");
-        fprintf(fp, "K2 =\t%.3f\t[ ]\n\n", K2);
+        writerPrintf(&w, "\tIntermediate parameters:\n");
+        writerPrintf(&w, "Temperature adjusted equilibrium constant:\n");
+        writerPrintf(&w, "K2 =\t%.3f\t[ ]\n\n", K2);
     }
     
-    fprintf(fp, "\tOutput parameters:\n");
+    writerPrintf(&w, "\tOutput parameters:\n");
     if(mode == 1)
     {
-        fprintf(fp, "Temperature adjusted equilibrium constant:\n");
-        fprintf(fp, "K2 =\t%.3f\t[ ]\n\n", K2);
+        writerPrintf(&w, "Temperature adjusted equilibrium constant:\n");
+        writerPrintf(&w, "K2 =\t%.3f\t[ ]\n\n", K2);
     }
     if(mode == 2)
     {
-        fprintf(fp, "Pressure adjusted equilibrium constant:\n");
-        fprintf(fp, "KP =\t%.3f\t[ ]\n\n", KP);
+        writerPrintf(&w, "Pressure adjusted equilibrium constant:\n");
+        writerPrintf(&w, "KP =\t%.3f\t[ ]\n\n", KP);
     }
     
-    //Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    //  Close file
+    writerClose(&w);
 }
 
 void EquiConstWriteSwitch(int mode, double h_rxn, double K1, double K2, double KP, double T1, double T2, double P1, double stoich)
@@ -28,6 +28,7 @@
 
 //Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "06dIdealReactionComposition.h"
 
 /// MARK: SUBROUTINE DEFINITIONS
@@ -291,137 +292,89 @@ void IdealRxnCompDisplay(species reagents, species products, int numreags, int n
 void IdealRxnCompWrite(species reagents, species products, int numreags, int numprods, double totalmoles, double T, double P, double Pref, GibbsRxn results, double K, double KP, double totalstoich)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    char fileconds[maxstrlen];
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
-    
-    FILE *fp;                   // Pointer to the file location.
-    //  Set file name as timestamp + Ideal Reaction Composition
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Ideal Reaction Composition");
-    //printf("File name: \"%s\"\n", filename);
-    
-    sprintf(fileconds, " T %.0f K", T);
-    strcat(filename, fileconds);
-    
-    sprintf(fileconds, " P %.0f atm", P);
-    strcat(filename, fileconds);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-    *filepath = (char)malloc(sizeof *filepath);
-    
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-    printf("File path: \"%s\"\n", filepath);
-    
-    strcat(filepath, filename);
-    void free(void *filename); // Removing 'filename' from the heap
-    
-    printf("File name: \"%s\"\n", filename);
-    printf("Full file path: \"%s\"\n\n", filepath);
-    
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
-    }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
+    ResultWriter w;             // Buffered writer for the results file.
+    char title[maxstrlen];      // Text following the timestamp in the file name.
     
-    //Open file
-    fp = fopen(filename, "w+");
+    //  Set file name as timestamp + Ideal Reaction Composition + conditions
+    snprintf(title, sizeof(title), "Ideal Reaction Composition T %.0f K P %.0f atm", T, P);
+    if(!writerOpen(&w, title))
+    {
+        return;
+    }
     
-    //Write to file
-    fprintf(fp, "_Ideal_Reaction_Composition_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Reference Pressure:\n");
-    fprintf(fp, "Pref =\t%.3f\tatm\n\n", Pref);
+    //  Write to file
+    writerPrintf(&w, "_Ideal_Reaction_Composition_\n");
+    writerPrintf(&w, "\tInput parameters:\n");
+    writerPrintf(&w, "Reference Pressure:\n");
+    writerPrintf(&w, "Pref =\t%.3f\tatm\n\n", Pref);
     
-    fprintf(fp, "System Pressure:\n");
-    fprintf(fp, "P =\t%.3f\tatm\n", P);
-    fprintf(fp, "System Temperature:\n");
-    fprintf(fp, "T =\t%.3f\tdeg C\n\n", T - 273.15);
+    writerPrintf(&w, "System Pressure:\n");
+    writerPrintf(&w, "P =\t%.3f\tatm\n", P);
+    writerPrintf(&w, "System Temperature:\n");
+    writerPrintf(&w, "T =\t%.3f\tdeg C\n\n", T - 273.15);
     
     printf("Total moles present:\n");
     printf("n =\t%.3f\tmol\n\n", totalmoles);
     
-    fprintf(fp, "Equilibrium constant:\n");
-    fprintf(fp, "K =\t%.3f\t[ ]\n\n", K);
-    fprintf(fp, "KP =\t%.3f\tbar^%.2f\n\n", KP, totalstoich);
+    writerPrintf(&w, "Equilibrium constant:\n");
+    writerPrintf(&w, "K =\t%.3f\t[ ]\n\n", K);
+    writerPrintf(&w, "KP =\t%.3f\tbar^%.2f\n\n", KP, totalstoich);
     
-    fprintf(fp, "Reagents stoichiometry:\n");
+    writerPrintf(&w, "Reagents stoichiometry:\n");
     for(int i = 0; i < numreags; ++i)
     {
-        fprintf(fp, "v_%d =\t%.2f\n", i + 1, reagents.stoich[i]);
+        writerPrintf(&w, "v_%d =\t%.2f\n", i + 1, reagents.stoich[i]);
     }
     for(int i = 0; i < numprods; ++i)
     {
-        fprintf(fp, "v_%d =\t%.2f\n", i + numreags + 1, products.stoich[i]);
+        writerPrintf(&w, "v_%d =\t%.2f\n", i + numreags + 1, products.stoich[i]);
     }
     
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "\\varepsilon (mol)\t\t");
+    writerPrintf(&w, "\tOutput parameters:\n");
+    writerPrintf(&w, "\\varepsilon (mol)\t\t");
     
     for(int i = 0; i < numreags; ++i)
     {
-        fprintf(fp, "x_%d\t", i + 1);
-        fprintf(fp, "mu_%d\t", i + 1);
+        writerPrintf(&w, "x_%d\t", i + 1);
+        writerPrintf(&w, "mu_%d\t", i + 1);
     }
-    fprintf(fp, "\t");
+    writerPrintf(&w, "\t");
     
     for(int i = 0; i < numprods; ++i)
     {
-        fprintf(fp, "x_%d\t", i + numreags + 1);
-        fprintf(fp, "mu_%d\t", i + numreags + 1);
+        writerPrintf(&w, "x_%d\t", i + numreags + 1);
+        writerPrintf(&w, "mu_%d\t", i + numreags + 1);
     }
-    fprintf(fp, "\t");
+    writerPrintf(&w, "\t");
     
-    fprintf(fp, "G^{mix} (J)\t\t");
+    writerPrintf(&w, "G^{mix} (J)\t\t");
     
-    fprintf(fp, "\\sum_i \\mu_i v_i\n");
+    writerPrintf(&w, "\\sum_i \\mu_i v_i\n");
     
     for(int i = 0; i < 1001; ++i){
-        fprintf(fp, "%.3f\t\t", results.EoR[i]);
+        writerPrintf(&w, "%.3f\t\t", results.EoR[i]);
         
         for(int j = 0; j < numreags; ++j)
         {
-            fprintf(fp, "%.5f\t", results.reags[j][i]);
-            fprintf(fp, "%.5f\t", results.reagsmu[j][i]);
+            writerPrintf(&w, "%.5f\t", results.reags[j][i]);
+            writerPrintf(&w, "%.5f\t", results.reagsmu[j][i]);
         }
-        fprintf(fp, "\t");
+        writerPrintf(&w, "\t");
         
         for(int j = 0; j < numprods; ++j)
         {
-            fprintf(fp, "%.5f\t", results.prods[j][i]);
-            fprintf(fp, "%.5f\t", results.prodsmu[j][i]);
+            writerPrintf(&w, "%.5f\t", results.prods[j][i]);
+            writerPrintf(&w, "%.5f\t", results.prodsmu[j][i]);
         }
-        fprintf(fp, "\t");
+        writerPrintf(&w, "\t");
         
-        fprintf(fp, "%.3f\t\t", results.Gmix[i]);
+        writerPrintf(&w, "%.3f\t\t", results.Gmix[i]);
         
-        fprintf(fp, "%.3f\n", results.Cond[i]);
+        writerPrintf(&w, "%.3f\n", results.Cond[i]);
     }
     
-    //Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    //  Close file
+    writerClose(&w);
 }
 
 void IdealRxnCompSwitch(int mode, species reagents, species products, int numreags, int numprods, double totalmoles, double T, double P, double Pref, GibbsRxn results, double K, double KP, double totalstoich)
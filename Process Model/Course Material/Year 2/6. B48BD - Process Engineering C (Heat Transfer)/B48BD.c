@@ -128,9 +128,10 @@ void B48BDtopic3(){
         printf("1. Lagging thickness.\n");
         printf("2. Film heat transfer coefficient.\n");
         printf("3. Monochromatic emissive power (Planck's distribution law).\n");
+        printf("4. Radiation enclosure (radiosity network).\n");
         
         printf("q. Exit topic.\n");
-        printf("Selection [1 - 3]: ");
+        printf("Selection [1 - 4]: ");
         fgets(input, sizeof(input), stdin);
         switch(input[0])
         {
@@ -144,6 +145,8 @@ void B48BDtopic3(){
                 RadWavelength();
                 break;
             case '4':
+                RadEnclosure();
+                break;
             case '0':
             case 'Q':
             case 'q':
@@ -28,6 +28,7 @@
 
 //Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BD_T1.h"
 #include "01aTemperatureConversion.h"
 
@@ -291,163 +292,120 @@ void TempConvDisplay(int initialUnits, int outputUnits, double measurement, doub
 void TempConvWrite(int initialUnits, int outputUnits, double measurement, double celsius, double fahrenheit, double kelvin, double rankine)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
     //  Set file name as timestamp + Temperature Conversion Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Temperature Conversion Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-    *filepath = (char)malloc(sizeof *filepath);
-    
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-    printf("File path: \"%s\"\n", filepath);
-    
-    strcat(filepath, filename);
-    void free(void *filename); // Removing 'filename' from the heap
-    
-    printf("File name: \"%s\"\n", filename);
-    printf("Full file path: \"%s\"\n\n", filepath);
-    
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, "Temperature Conversion Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //Open file
-    fp = fopen(filename, "w+");
     
-    //Write to file
-    fprintf(fp, "_Temperature_Conversion_Results_\n");
+    //  Write to file
+    writerPrintf(&w, "_Temperature_Conversion_Results_\n");
     if(initialUnits == outputUnits)
     {
         // No conversion required.
-        fprintf(fp, "No conversion required.\n");
+        writerPrintf(&w, "No conversion required.\n");
     }else{
-        fprintf(fp, "\tInput parameters:\n");
-        fprintf(fp, "Temperature Measurement:\n");
+        writerPrintf(&w, "\tInput parameters:\n");
+        writerPrintf(&w, "Temperature Measurement:\n");
         if(initialUnits == 1)
         {
             // Input in Celsius.
-            fprintf(fp, "T =\t%.3f\tdeg C\n", measurement);
+            writerPrintf(&w, "T =\t%.3f\tdeg C\n", measurement);
             
-            fprintf(fp, "\n\tOutput parameters:\n");
-            fprintf(fp, "Converted temperature:\n");
+            writerPrintf(&w, "\n\tOutput parameters:\n");
+            writerPrintf(&w, "Converted temperature:\n");
             if(outputUnits == 2 || outputUnits == 5)
             {
                 // Output in Fahrenheit.
-                fprintf(fp, "T =\t%.3f\tdeg F\n", fahrenheit);
+                writerPrintf(&w, "T =\t%.3f\tdeg F\n", fahrenheit);
             }
             if(outputUnits == 3 || outputUnits == 5)
             {
                 // Output in Kelvin.
-                fprintf(fp, "T =\t%.3f\tK\n", kelvin);
+                writerPrintf(&w, "T =\t%.3f\tK\n", kelvin);
             }
             if(outputUnits == 4 || outputUnits == 5)
             {
                 // Output in Rankine.
-                fprintf(fp, "T =\t%.3f\tR\n", rankine);
+                writerPrintf(&w, "T =\t%.3f\tR\n", rankine);
             }
         }
         if(initialUnits == 2)
         {
             // Input in Fahrenheit.
-            fprintf(fp, "T =\t%.3f\tdeg F\n", measurement);
+            writerPrintf(&w, "T =\t%.3f\tdeg F\n", measurement);
             
-            fprintf(fp, "\n\tOutput parameters:\n");
-            fprintf(fp, "Converted temperature:\n");
+            writerPrintf(&w, "\n\tOutput parameters:\n");
+            writerPrintf(&w, "Converted temperature:\n");
             if(outputUnits == 1 || outputUnits == 5)
             {
                 // Output in Celsius.
-                fprintf(fp, "T =\t%.3f\tdeg C\n", celsius);
+                writerPrintf(&w, "T =\t%.3f\tdeg C\n", celsius);
             }
             if(outputUnits == 3 || outputUnits == 5)
             {
                 // Output in Kelvin.
-                fprintf(fp, "T =\t%.3f\tK\n", kelvin);
+                writerPrintf(&w, "T =\t%.3f\tK\n", kelvin);
             }
             if(outputUnits == 4 || outputUnits == 5)
             {
                 // Output in Rankine.
-                fprintf(fp, "T =\t%.3f\tR\n", rankine);
+                writerPrintf(&w, "T =\t%.3f\tR\n", rankine);
             }
             
         }
         if(initialUnits == 3)
         {
             // Input in Kelvin.
-            fprintf(fp, "T =\t%.3f\tK\n", measurement);
+            writerPrintf(&w, "T =\t%.3f\tK\n", measurement);
             
-            fprintf(fp, "\n\tOutput parameters:\n");
-            fprintf(fp, "Converted temperature:\n");
+            writerPrintf(&w, "\n\tOutput parameters:\n");
+            writerPrintf(&w, "Converted temperature:\n");
             if(outputUnits == 1 || outputUnits == 5)
             {
                 // Output in Celsius.
-                fprintf(fp, "T =\t%.3f\tdeg C\n", celsius);
+                writerPrintf(&w, "T =\t%.3f\tdeg C\n", celsius);
             }
             if(outputUnits == 2 || outputUnits == 5)
             {
                 // Output in Fahrenheit.
-                fprintf(fp, "T =\t%.3f\tdeg F\n", fahrenheit);
+                writerPrintf(&w, "T =\t%.3f\tdeg F\n", fahrenheit);
             }
             if(outputUnits == 4 || outputUnits == 5)
             {
                 // Output in Rankine.
-                fprintf(fp, "T =\t%.3f\tR\n", rankine);
+                writerPrintf(&w, "T =\t%.3f\tR\n", rankine);
             }
         }
         if(initialUnits == 4)
         {
             // Input in Rankine.
-            fprintf(fp, "T =\t%.3f\tR\n", measurement);
+            writerPrintf(&w, "T =\t%.3f\tR\n", measurement);
             
-            fprintf(fp, "\n\tOutput parameters:\n");
-            fprintf(fp, "Converted temperature:\n");
+            writerPrintf(&w, "\n\tOutput parameters:\n");
+            writerPrintf(&w, "Converted temperature:\n");
             if(outputUnits == 1 || outputUnits == 5)
             {
                 // Output in Celsius.
-                fprintf(fp, "T =\t%.3f\tdeg C\n", celsius);
+                writerPrintf(&w, "T =\t%.3f\tdeg C\n", celsius);
             }
             if(outputUnits == 2 || outputUnits == 5)
             {
                 // Output in Fahrenheit.
-                fprintf(fp, "T =\t%.3f\tdeg F\n", fahrenheit);
+                writerPrintf(&w, "T =\t%.3f\tdeg F\n", fahrenheit);
             }
             if(outputUnits == 3 || outputUnits == 5)
             {
                 // Output in Kelvin.
-                fprintf(fp, "T =\t%.3f\tK\n", kelvin);
+                writerPrintf(&w, "T =\t%.3f\tK\n", kelvin);
             }
         }
     }
     
-    //Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    //  Close file
+    writerClose(&w);
 }
 
 void TempConvWriteSwitch(int initialUnits, int outputUnits, double measurement, double celsius, double fahrenheit, double kelvin, double rankine)
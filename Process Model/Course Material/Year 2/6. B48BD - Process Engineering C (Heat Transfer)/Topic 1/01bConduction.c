@@ -28,6 +28,7 @@
 
 //Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BD_T1.h"
 #include "01bConduction.h"
 
@@ -89,78 +90,35 @@ void FouriersLawDisplay(double k, double A, double x, double T1, double T2, doub
 void FouriersLawWrite(double k, double A, double x, double T1, double T2, double Q)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
     //  Set file name as timestamp + Conduction Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Conduction Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-    *filepath = (char)malloc(sizeof *filepath);
-    
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-    printf("File path: \"%s\"\n", filepath);
-    
-    strcat(filepath, filename);
-    void free(void *filename); // Removing 'filename' from the heap
-    
-    printf("File name: \"%s\"\n", filename);
-    printf("Full file path: \"%s\"\n\n", filepath);
-    
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, "Conduction Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //Open file
-    fp = fopen(filename, "w+");
-    
-    //Write to file
-    fprintf(fp, "_Fourier's_Law_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Thermal conductivity:\n");
-    fprintf(fp, "k =\t%.3f\tW/m.K\n", k);
-    fprintf(fp, "Heat transfer area:\n");
-    fprintf(fp, "A =\t%.3f\tm2\n", A);
-    fprintf(fp, "Surface thickness:\n");
-    fprintf(fp, "x =\t%.3f\tmm\n\n", x*1000);
-    
-    fprintf(fp, "Initial temperature:\n");
-    fprintf(fp, "T1 =\t%.3f\tdeg C\n", T1);
-    fprintf(fp, "Final temperature:\n");
-    fprintf(fp, "T2 =\t%.3f\tdeg C\n\n", T2);
-    
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "Rate of heat transfer:\n");
-    fprintf(fp, "Q =\t%.3f\tW\n", Q);
     
-    //Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    //  Write to file
+    writerPrintf(&w, "_Fourier's_Law_Results_\n");
+    writerPrintf(&w, "\tInput parameters:\n");
+    writerPrintf(&w, "Thermal conductivity:\n");
+    writerPrintf(&w, "k =\t%.3f\tW/m.K\n", k);
+    writerPrintf(&w, "Heat transfer area:\n");
+    writerPrintf(&w, "A =\t%.3f\tm2\n", A);
+    writerPrintf(&w, "Surface thickness:\n");
+    writerPrintf(&w, "x =\t%.3f\tmm\n\n", x*1000);
+    
+    writerPrintf(&w, "Initial temperature:\n");
+    writerPrintf(&w, "T1 =\t%.3f\tdeg C\n", T1);
+    writerPrintf(&w, "Final temperature:\n");
+    writerPrintf(&w, "T2 =\t%.3f\tdeg C\n\n", T2);
+    
+    writerPrintf(&w, "\tOutput parameters:\n");
+    writerPrintf(&w, "Rate of heat transfer:\n");
+    writerPrintf(&w, "Q =\t%.3f\tW\n", Q);
+    
+    //  Close file
+    writerClose(&w);
 }
 
 void FouriersLawWriteSwitch(double k, double A, double x, double T1, double T2, double Q)
@@ -28,6 +28,7 @@
 
 //Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BD_T1.h"
 #include "01cConvection.h"
 
@@ -81,76 +82,33 @@ void SSConvectionDisplay(double h, double A, double T1, double T2, double Q)
 void SSConvectionWrite(double h, double A, double T1, double T2, double Q)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
     //  Set file name as timestamp + Steady State Convection Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Steady State Convection Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-    *filepath = (char)malloc(sizeof *filepath);
-    
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-    printf("File path: \"%s\"\n", filepath);
-    
-    strcat(filepath, filename);
-    void free(void *filename); // Removing 'filename' from the heap
-    
-    printf("File name: \"%s\"\n", filename);
-    printf("Full file path: \"%s\"\n\n", filepath);
-    
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, "Steady State Convection Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //Open file
-    fp = fopen(filename, "w+");
-    
-    //Write to file
-    fprintf(fp, "_Steady-state_Convection_Law_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Fluid heat transfer coefficient:\n");
-    fprintf(fp, "h =\t%.3f\tW/m2.K\n", h);
-    fprintf(fp, "Heat transfer area:\n");
-    fprintf(fp, "A =\t%.3f\tm2\n\n", A);
-    
-    fprintf(fp, "Initial temperature:\n");
-    fprintf(fp, "T1 =\t%.3f\tdeg C\n", T1);
-    fprintf(fp, "Final temperature:\n");
-    fprintf(fp, "T2 =\t%.3f\tdeg C\n\n", T2);
-    
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "Rate of heat transfer:\n");
-    fprintf(fp, "Q =\t%.3f\tW\n", Q);
     
-    //Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    //  Write to file
+    writerPrintf(&w, "_Steady-state_Convection_Law_Results_\n");
+    writerPrintf(&w, "\tInput parameters:\n");
+    writerPrintf(&w, "Fluid heat transfer coefficient:\n");
+    writerPrintf(&w, "h =\t%.3f\tW/m2.K\n", h);
+    writerPrintf(&w, "Heat transfer area:\n");
+    writerPrintf(&w, "A =\t%.3f\tm2\n\n", A);
+    
+    writerPrintf(&w, "Initial temperature:\n");
+    writerPrintf(&w, "T1 =\t%.3f\tdeg C\n", T1);
+    writerPrintf(&w, "Final temperature:\n");
+    writerPrintf(&w, "T2 =\t%.3f\tdeg C\n\n", T2);
+    
+    writerPrintf(&w, "\tOutput parameters:\n");
+    writerPrintf(&w, "Rate of heat transfer:\n");
+    writerPrintf(&w, "Q =\t%.3f\tW\n", Q);
+    
+    //  Close file
+    writerClose(&w);
 }
 
 void SSConvectionWriteSwitch(double h, double A, double T1, double T2, double Q)
@@ -28,6 +28,7 @@
 
 //Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BD_T1.h"
 #include "01aTemperatureConversion.h"
 #include "01dRadiation.h"
@@ -99,78 +100,35 @@ void ThermRadiationDisplay(double A, double Ts, double Tf, double Q)
 void ThermRadiationWrite(double A, double Ts, double Tf, double Q)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
     //  Set file name as timestamp + Thermal Radiation Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Thermal Radiation Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-    *filepath = (char)malloc(sizeof *filepath);
-    
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-    printf("File path: \"%s\"\n", filepath);
-    
-    strcat(filepath, filename);
-    void free(void *filename); // Removing 'filename' from the heap
-    
-    printf("File name: \"%s\"\n", filename);
-    printf("Full file path: \"%s\"\n\n", filepath);
-    
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, "Thermal Radiation Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //Open file
-    fp = fopen(filename, "w+");
     
-    //Write to file
-    fprintf(fp, "_Thermal_Radiation_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Heat transfer area:\n");
-    fprintf(fp, "A =\t%.3f\tm2\n\n", A);
+    //  Write to file
+    writerPrintf(&w, "_Thermal_Radiation_Results_\n");
+    writerPrintf(&w, "\tInput parameters:\n");
+    writerPrintf(&w, "Heat transfer area:\n");
+    writerPrintf(&w, "A =\t%.3f\tm2\n\n", A);
     
-    fprintf(fp, "Temperature of the heat transfer surface:\n");
-    fprintf(fp, "Ts =\t%.3f\tdeg C\n", Ts - 273.15);
-    fprintf(fp, "Temperature of the surrounding fluid:\n");
-    fprintf(fp, "Tf =\t%.3f\tdeg C\n\n", Tf - 273.15);
+    writerPrintf(&w, "Temperature of the heat transfer surface:\n");
+    writerPrintf(&w, "Ts =\t%.3f\tdeg C\n", Ts - 273.15);
+    writerPrintf(&w, "Temperature of the surrounding fluid:\n");
+    writerPrintf(&w, "Tf =\t%.3f\tdeg C\n\n", Tf - 273.15);
     
-    fprintf(fp, "\tIntermediate parameters:\n");
-    fprintf(fp, "Stefan-Boltzmann constant:\n");
-    fprintf(fp, "\\sigma =\t5.6703 x 10^{-8}\tW/m2.K4\n\n");
+    writerPrintf(&w, "\tIntermediate parameters:\n");
+    writerPrintf(&w, "Stefan-Boltzmann constant:\n");
+    writerPrintf(&w, "\\sigma =\t5.6703 x 10^{-8}\tW/m2.K4\n\n");
     
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "Rate of heat transfer:\n");
-    fprintf(fp, "Q =\t%.3f\tW\n", Q);
+    writerPrintf(&w, "\tOutput parameters:\n");
+    writerPrintf(&w, "Rate of heat transfer:\n");
+    writerPrintf(&w, "Q =\t%.3f\tW\n", Q);
     
-    //Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    //  Close file
+    writerClose(&w);
 }
 
 void ThermRadiationWriteSwitch(double A, double Ts, double Tf, double Q)
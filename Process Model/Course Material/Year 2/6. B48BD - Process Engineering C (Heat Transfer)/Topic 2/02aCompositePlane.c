@@ -28,6 +28,7 @@
 
 //Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "01aTemperatureConversion.h"
 #include "B48BD_T2.h"
 #include "02aCompositePlane.h"
@@ -178,102 +179,73 @@ void CompPlaneDisplay(int numMediums, CondPlaneMedium data, double Q, double A,
 void CompPlaneWrite(int numMediums, CondPlaneMedium data, double Q, double A, double T1, double T2, double rowsused, B48BDTemps profile)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    char label[maxstrlen];      // Variable used to store the labels of each layer.
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
-    //  Set file name as timestamp + Composite Plane Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Composite Plane Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-    *filepath = (char)malloc(sizeof *filepath);
-    
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-    printf("File path: \"%s\"\n", filepath);
-    
-    strcat(filepath, filename);
-    void free(void *filename); // Removing 'filename' from the heap
+    WriterColumn cols[3] = {
+        {"k", "W/m.K", NULL, 1, WriterFixed, 3, 1.0, 0.0},
+        {"x", "mm", NULL, 1, WriterFixed, 3, 1.0, 0.0},
+        {"T", "deg C", NULL, 1, WriterFixed, 3, 1.0, 0.0}
+    };
     
-    printf("File name: \"%s\"\n", filename);
-    printf("Full file path: \"%s\"\n\n", filepath);
-    
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    //  Set file name as timestamp + Composite Plane Results
+    if(!writerOpen(&w, "Composite Plane Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //Open file
-    fp = fopen(filename, "w+");
     
     //Write to file
-    fprintf(fp, "_Composite_Plane_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Hot side temperature:\n");
-    fprintf(fp, "T1 =\t%.3f\tdeg C\n", T1 - 273.15);
-    fprintf(fp, "Cold side temperature:\n");
-    fprintf(fp, "T2 =\t%.3f\tdeg C\n\n", T2 - 273.15);
-    
-    fprintf(fp, "Heat transfer area:\n");
-    fprintf(fp, "A =\t%.3f\tm2\n\n", A);
+    writerText(&w, "_Composite_Plane_Results_\n");
+    writerText(&w, "\tInput parameters:\n");
+    writerText(&w, "Hot side temperature:\n");
+    writerValue(&w, "T1 =", T1 - 273.15, 3, "deg C");
+    writerText(&w, "Cold side temperature:\n");
+    writerValue(&w, "T2 =", T2 - 273.15, 3, "deg C");
+    writerEnd(&w);
+    
+    writerText(&w, "Heat transfer area:\n");
+    writerValue(&w, "A =", A, 3, "m2");
+    writerEnd(&w);
     
     for(int j = 0; j < numMediums; ++j)
     {
-        fprintf(fp, "Thermal conductivity of plane %d:\n", j + 1);
-        fprintf(fp, "k_%d =\t%.3f\tW/m.K\n", j + 1, data.k[j]);
-        fprintf(fp, "Thickness of layer %d:\n", j + 1);
-        fprintf(fp, "x_%d =\t%.3f\tm\n\n", j + 1, data.x[j]);
+        writerPrintf(&w, "Thermal conductivity of plane %d:\n", j + 1);
+        snprintf(label, sizeof(label), "k_%d =", j + 1);
+        writerValue(&w, label, data.k[j], 3, "W/m.K");
+        writerPrintf(&w, "Thickness of layer %d:\n", j + 1);
+        snprintf(label, sizeof(label), "x_%d =", j + 1);
+        writerValue(&w, label, data.x[j], 3, "m");
+        writerEnd(&w);
         
-        fprintf(fp, "Layer %d resistance to heat transfer:\n", j + 1);
-        fprintf(fp, "R_%d =\t%.3f\tK/W\n\n", j + 1, data.R[j]);
+        writerPrintf(&w, "Layer %d resistance to heat transfer:\n", j + 1);
+        snprintf(label, sizeof(label), "R_%d =", j + 1);
+        writerValue(&w, label, data.R[j], 3, "K/W");
+        writerEnd(&w);
     }
     
-    fprintf(fp, "\tIntermediate parameters:\n");
-    fprintf(fp, "Rate of heat transfer:\n");
-    fprintf(fp, "Q =\t%.3f\tW\n\n", Q);
+    writerText(&w, "\tIntermediate parameters:\n");
+    writerText(&w, "Rate of heat transfer:\n");
+    writerValue(&w, "Q =", Q, 3, "W");
+    writerEnd(&w);
     
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "k (W/m.K)\tx (mm)\tT (deg C)\n");
-    for(int i = 0; i < rowsused; ++i){
-        if(i == 0){
-            fprintf(fp, "%.3f\t", profile.k[i]);
-        }else{
-            if(profile.k[i] == profile.k[i - 1])
-            {
-                fprintf(fp, "\t");
-            }else{
-                fprintf(fp, "%.3f\t", profile.k[i]);
-            }
+    writerText(&w, "\tOutput parameters:\n");
+    writerHeader(&w, 3, cols);
+    for(int i = 0; i < rowsused; ++i)
+    {
+        //  Repeated layer properties are left blank
+        if(!(i > 0 && profile.k[i] == profile.k[i - 1]))
+        {
+            writerNumber(&w, profile.k[i], WriterFixed, 3);
         }
-        fprintf(fp, "%.3f\t", 1000*profile.x[i]);
-        fprintf(fp, "%.3f\n", KelvinCelsius(profile.T[i]));
+        writerSep(&w);
+        writerNumber(&w, 1000*profile.x[i], WriterFixed, 3);
+        writerSep(&w);
+        writerNumber(&w, KelvinCelsius(profile.T[i]), WriterFixed, 3);
+        writerEnd(&w);
     }
     
     //Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void CompPlaneSwitch(int mode, int numMediums, CondPlaneMedium data, double Q, double A, double T1, double T2, double rowsused, B48BDTemps profile)
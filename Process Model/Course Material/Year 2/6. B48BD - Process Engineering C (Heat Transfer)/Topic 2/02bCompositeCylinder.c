@@ -28,6 +28,7 @@
 
 //Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "01aTemperatureConversion.h"
 #include "02bCompositeCylinder.h"
 
@@ -202,105 +203,77 @@ void CompCylDisplay(int numMediums, CondCylMedium data, double Q, double L, doub
 void CompCylWrite(int numMediums, CondCylMedium data, double Q, double L, double T1, double T2, int rowsused, B48BDTemps profile)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    char label[maxstrlen];      // Variable used to store the labels of each layer.
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
-    //  Set file name as timestamp + Composite Cylinder Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Composite Cylinder Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-    *filepath = (char)malloc(sizeof *filepath);
-    
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-    printf("File path: \"%s\"\n", filepath);
-    
-    strcat(filepath, filename);
-    void free(void *filename); // Removing 'filename' from the heap
+    WriterColumn cols[3] = {
+        {"k", "W/m.K", NULL, 1, WriterFixed, 3, 1.0, 0.0},
+        {"r", "mm", NULL, 1, WriterFixed, 3, 1.0, 0.0},
+        {"T", "deg C", NULL, 1, WriterFixed, 5, 1.0, 0.0}
+    };
     
-    printf("File name: \"%s\"\n", filename);
-    printf("Full file path: \"%s\"\n\n", filepath);
-    
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    //  Set file name as timestamp + Composite Cylinder Results
+    if(!writerOpen(&w, "Composite Cylinder Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //Open file
-    fp = fopen(filename, "w+");
     
     //Write to file
-    fprintf(fp, "_Composite_Cylinder_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Hot side temperature:\n");
-    fprintf(fp, "T1 =\t%.3f\tdeg C\n", T1 - 273.15);
-    fprintf(fp, "Cold side temperature:\n");
-    fprintf(fp, "T2 =\t%.3f\tdeg C\n\n", T2 - 273.15);
-    
-    fprintf(fp, "Pipe length:\n");
-    fprintf(fp, "L =\t%.3f\tm\n\n", L);
-    
-    fprintf(fp, "Inner radius:\n");
-    fprintf(fp, "r_1 =\t%.3f\tm\n\n", data.r[0]);
+    writerText(&w, "_Composite_Cylinder_Results_\n");
+    writerText(&w, "\tInput parameters:\n");
+    writerText(&w, "Hot side temperature:\n");
+    writerValue(&w, "T1 =", T1 - 273.15, 3, "deg C");
+    writerText(&w, "Cold side temperature:\n");
+    writerValue(&w, "T2 =", T2 - 273.15, 3, "deg C");
+    writerEnd(&w);
+    
+    writerText(&w, "Pipe length:\n");
+    writerValue(&w, "L =", L, 3, "m");
+    writerEnd(&w);
+    
+    writerText(&w, "Inner radius:\n");
+    writerValue(&w, "r_1 =", data.r[0], 3, "m");
+    writerEnd(&w);
     
     for(int j = 1; j < numMediums+1; ++j)
     {
-        fprintf(fp, "Thermal conductivity of layer %d:\n", j);
-        fprintf(fp, "k_%d =\t%.3f\tW/m.K\n", j, data.k[j]);
-        fprintf(fp, "Outer radius of layer %d:\n", j);
-        fprintf(fp, "r_%d =\t%.3f\tm\n\n", j + 1, data.r[j]);
+        writerPrintf(&w, "Thermal conductivity of layer %d:\n", j);
+        snprintf(label, sizeof(label), "k_%d =", j);
+        writerValue(&w, label, data.k[j], 3, "W/m.K");
+        writerPrintf(&w, "Outer radius of layer %d:\n", j);
+        snprintf(label, sizeof(label), "r_%d =", j + 1);
+        writerValue(&w, label, data.r[j], 3, "m");
+        writerEnd(&w);
         
-        fprintf(fp, "Layer %d resistance to heat transfer:\n", j);
-        fprintf(fp, "R_%d =\t%.3f\tK/W\n\n", j + 1, data.R[j]);
+        writerPrintf(&w, "Layer %d resistance to heat transfer:\n", j);
+        snprintf(label, sizeof(label), "R_%d =", j + 1);
+        writerValue(&w, label, data.R[j], 3, "K/W");
+        writerEnd(&w);
     }
     
-    fprintf(fp, "\tIntermediate parameters:\n");
-    fprintf(fp, "Rate of heat transfer:\n");
-    fprintf(fp, "Q =\t%.3f\tW\n\n", Q);
+    writerText(&w, "\tIntermediate parameters:\n");
+    writerText(&w, "Rate of heat transfer:\n");
+    writerValue(&w, "Q =", Q, 3, "W");
+    writerEnd(&w);
     
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "k (W/m.K)\tr (mm)\tT (deg C)\n");
-    for(int i = 0; i < rowsused; ++i){
-        if(i == 0){
-            fprintf(fp, "%.3f\t", profile.k[i]);
-        }else{
-            if(profile.k[i] == profile.k[i - 1])
-            {
-                fprintf(fp, "\t");
-            }else{
-                fprintf(fp, "%.3f\t", profile.k[i]);
-            }
+    writerText(&w, "\tOutput parameters:\n");
+    writerHeader(&w, 3, cols);
+    for(int i = 0; i < rowsused; ++i)
+    {
+        //  Repeated layer properties are left blank
+        if(!(i > 0 && profile.k[i] == profile.k[i - 1]))
+        {
+            writerNumber(&w, profile.k[i], WriterFixed, 3);
         }
-        fprintf(fp, "%.3f\t", 1000*profile.x[i]);
-        fprintf(fp, "%.5f\n", KelvinCelsius(profile.T[i]));
+        writerSep(&w);
+        writerNumber(&w, 1000*profile.x[i], WriterFixed, 3);
+        writerSep(&w);
+        writerNumber(&w, KelvinCelsius(profile.T[i]), WriterFixed, 5);
+        writerEnd(&w);
     }
     
     //Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void CompCylSwitch(int mode, int numMediums, CondCylMedium data, double Q, double L, double T1, double T2, int rowsused, B48BDTemps profile)
@@ -28,6 +28,7 @@
 
 //Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BD_T3.h"
 #include "01aTemperatureConversion.h"
 #include "03aLagging.h"
@@ -207,88 +208,45 @@ void LaggingDisplay(double T1, double T2, LaggingData data, LaggingTable results
 void LaggingWrite(double T1, double T2, LaggingData data, LaggingTable results)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
-    //  Set file name as timestamp + Polytropic Process Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Optimal Lagging Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-    *filepath = (char)malloc(sizeof *filepath);
-    
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-    printf("File path: \"%s\"\n", filepath);
-    
-    strcat(filepath, filename);
-    void free(void *filename); // Removing 'filename' from the heap
-    
-    printf("File name: \"%s\"\n", filename);
-    printf("Full file path: \"%s\"\n\n", filepath);
-    
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    //  Set file name as timestamp + Optimal Lagging Results
+    if(!writerOpen(&w, "Optimal Lagging Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //Open file
-    fp = fopen(filename, "w+");
     
-    //Write to file
-    fprintf(fp, "_Optimal_Lagging_Thickness_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Hot surface temperature:\n");
-    fprintf(fp, "T1 =\t%.3f\tdeg C\n", KelvinCelsius(T1));
-    fprintf(fp, "Cold surface temperature:\n");
-    fprintf(fp, "T2 =\t%.3f\tdeg C\n\n", KelvinCelsius(T2));
+    //  Write to file
+    writerPrintf(&w, "_Optimal_Lagging_Thickness_Results_\n");
+    writerPrintf(&w, "\tInput parameters:\n");
+    writerPrintf(&w, "Hot surface temperature:\n");
+    writerPrintf(&w, "T1 =\t%.3f\tdeg C\n", KelvinCelsius(T1));
+    writerPrintf(&w, "Cold surface temperature:\n");
+    writerPrintf(&w, "T2 =\t%.3f\tdeg C\n\n", KelvinCelsius(T2));
     
-    fprintf(fp, "k (W/m.K)\th (W/m2.K)\tr (m)\n");
+    writerPrintf(&w, "k (W/m.K)\th (W/m2.K)\tr (m)\n");
     for(int i = 0; i < 4; ++i)
     {
-        fprintf(fp, "%.3f\t", data.k[i]);
-        fprintf(fp, "%.3f\t", data.h[i]);
-        fprintf(fp, "%.3f\n", data.r[i]);
+        writerPrintf(&w, "%.3f\t", data.k[i]);
+        writerPrintf(&w, "%.3f\t", data.h[i]);
+        writerPrintf(&w, "%.3f\n", data.r[i]);
     }
-    fprintf(fp, "\n");
+    writerPrintf(&w, "\n");
     
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "x (cm)\tR_{lag} (K.m/W)\tR_{out} (K.m/W)\tR_{tot} (K.m/W)\tQ (W/m)\t%%R_{lag}\n");
+    writerPrintf(&w, "\tOutput parameters:\n");
+    writerPrintf(&w, "x (cm)\tR_{lag} (K.m/W)\tR_{out} (K.m/W)\tR_{tot} (K.m/W)\tQ (W/m)\t%%R_{lag}\n");
     for(int i = 0; i < 32; ++i)
     {
-        fprintf(fp, "%.3f\t", 100*results.x[i]);
-        fprintf(fp, "%.3f\t", results.R_lag[i]);
-        fprintf(fp, "%.3f\t", results.R_out[i]);
-        fprintf(fp, "%.3f\t", results.R_tot[i]);
-        fprintf(fp, "%.3f\t", results.Q[i]);
-        fprintf(fp, "%.3f\n", results.pctLag[i]);
+        writerPrintf(&w, "%.3f\t", 100*results.x[i]);
+        writerPrintf(&w, "%.3f\t", results.R_lag[i]);
+        writerPrintf(&w, "%.3f\t", results.R_out[i]);
+        writerPrintf(&w, "%.3f\t", results.R_tot[i]);
+        writerPrintf(&w, "%.3f\t", results.Q[i]);
+        writerPrintf(&w, "%.3f\n", results.pctLag[i]);
     }
     
-    //Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    //  Close file
+    writerClose(&w);
 }
 
 void LaggingSwitch(int mode, double T1, double T2, LaggingData data, LaggingTable results)
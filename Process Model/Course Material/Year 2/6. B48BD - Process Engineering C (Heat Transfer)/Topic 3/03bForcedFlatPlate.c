@@ -27,6 +27,7 @@
 
 //Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "DimensionlessNum.h"
 #include "03bFilmHTCoefficient.h"
 
@@ -181,116 +182,73 @@ void PlateHTCoeffDisplay(int eqnset, double rho, double u, double mu, double cp,
 
 void PlateHTCoeffWrite(int eqnset, double rho, double u, double mu, double cp, double k, double d, double Re, double Pr, double Nu, double h)
 {
-    //Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
-    
-    FILE *fp;                   // Pointer to the file location.
-    //Set file name as timestamp + Fluid heat transfer coefficient (Forced Convection over a flat plate) Estimation
-        //Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //Creating file name with base format "YYYYmmDD HHMMSS "
-    //Allocating memory for the file name
-    *filename = (char)malloc(sizeof *filename);
-    
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Fluid heat transfer coefficient (Forced Convection over a flat plate) Estimation");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-    
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-    
-    strcat(filepath, filename);
-     
-    printf("Full file path: \"%s\"\n\n", filepath);
-    
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
-        strcat(filepath, filename);
+    //  Function variables
+    ResultWriter w;             // Buffered writer for the results file.
+    
+    //  Set file name as timestamp + Fluid heat transfer coefficient (Forced Convection over a flat plate) Estimation
+    if(!writerOpen(&w, "Fluid heat transfer coefficient (Forced Convection over a flat plate) Estimation"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //Open file
-    fp = fopen(filename, "w+");
-    
-    //Write to file
-    fprintf(fp, "_Film_Heat_Transfer_Coefficient_Estimation_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Fluid density:\n");
-    fprintf(fp, "rho =\t%.3f\tkg/m3\n", rho);
-    fprintf(fp, "Fluid velocity:\n");
-    fprintf(fp, "u =\t%.3f\tm/s\n", u);
-    fprintf(fp, "Fluid viscosity:\n");
-    fprintf(fp, "mu =\t%.3f\tcP\n\n", 1000*mu);
-    
-    fprintf(fp, "Fluid heat capacity at constant pressure:\n");
-    fprintf(fp, "cp =\t%.3f\tJ/kg.K\n", cp);
-    fprintf(fp, "Fluid thermal conductivity:\n");
-    fprintf(fp, "k =\t%.3f\tW/m.K\n\n", k);
-    
-    fprintf(fp, "Pipe internal diameter:\n");
-    fprintf(fp, "d =\t%.3f\tmm\n\n", 1000*d);
-    
-    fprintf(fp, "\tIntermediate parameters:\n");
-    fprintf(fp, "Reynolds number:\n");
-    fprintf(fp, "Re =\t%.3f\t[ ]\n", Re);
-    fprintf(fp, "Prandtl number:\n");
-    fprintf(fp, "Pr =\t%.3f\t[ ]\n", Pr);
-    fprintf(fp, "Nusselt number:\n");
-    fprintf(fp, "Nu =\t%.3f\t[ ]\n\n", Nu);
-    
-    fprintf(fp, "\tOutput parameters:\n");
+    
+    //  Write to file
+    writerPrintf(&w, "_Film_Heat_Transfer_Coefficient_Estimation_\n");
+    writerPrintf(&w, "\tInput parameters:\n");
+    writerPrintf(&w, "Fluid density:\n");
+    writerPrintf(&w, "rho =\t%.3f\tkg/m3\n", rho);
+    writerPrintf(&w, "Fluid velocity:\n");
+    writerPrintf(&w, "u =\t%.3f\tm/s\n", u);
+    writerPrintf(&w, "Fluid viscosity:\n");
+    writerPrintf(&w, "mu =\t%.3f\tcP\n\n", 1000*mu);
+    
+    writerPrintf(&w, "Fluid heat capacity at constant pressure:\n");
+    writerPrintf(&w, "cp =\t%.3f\tJ/kg.K\n", cp);
+    writerPrintf(&w, "Fluid thermal conductivity:\n");
+    writerPrintf(&w, "k =\t%.3f\tW/m.K\n\n", k);
+    
+    writerPrintf(&w, "Pipe internal diameter:\n");
+    writerPrintf(&w, "d =\t%.3f\tmm\n\n", 1000*d);
+    
+    writerPrintf(&w, "\tIntermediate parameters:\n");
+    writerPrintf(&w, "Reynolds number:\n");
+    writerPrintf(&w, "Re =\t%.3f\t[ ]\n", Re);
+    writerPrintf(&w, "Prandtl number:\n");
+    writerPrintf(&w, "Pr =\t%.3f\t[ ]\n", Pr);
+    writerPrintf(&w, "Nusselt number:\n");
+    writerPrintf(&w, "Nu =\t%.3f\t[ ]\n\n", Nu);
+    
+    writerPrintf(&w, "\tOutput parameters:\n");
     if(eqnset == 1)
     {
         if(Pr > 0.6){
-            fprintf(fp, "Nu = 0.664Re^{0.5}Pr^{1/3}\n");
+            writerPrintf(&w, "Nu = 0.664Re^{0.5}Pr^{1/3}\n");
         }
         if(Pr <= 0.6){
-            fprintf(fp, "Nu = 0.332Re^{0.5}Pr^{1/3}\n");
+            writerPrintf(&w, "Nu = 0.332Re^{0.5}Pr^{1/3}\n");
         }
     }
     if(eqnset == 2)
     {
-        fprintf(fp, "Nu = 0.037(Re^{0.8} - 871)Pr^{1/3}\n");
+        writerPrintf(&w, "Nu = 0.037(Re^{0.8} - 871)Pr^{1/3}\n");
         if(Pr > 0.6 && Pr < 60){
             // Correlation is valid
         }else{
-            fprintf(fp, "Correlation condition is being violated. (0.6 < Pr < 60).\n\n");
+            writerPrintf(&w, "Correlation condition is being violated. (0.6 < Pr < 60).\n\n");
         }
     }
     if(eqnset == 3)
     {
         if(Pr > 0.6 && Pr < 60){
-            fprintf(fp, "Nu = 0.037Re^{0.8}Pr^{1/3}\n");
+            writerPrintf(&w, "Nu = 0.037Re^{0.8}Pr^{1/3}\n");
         }else{
-            fprintf(fp, "Nu = 0.0296Re^{0.8}Pr^{1/3}\n");
+            writerPrintf(&w, "Nu = 0.0296Re^{0.8}Pr^{1/3}\n");
         }
     }
-    fprintf(fp, "Fluid heat transfer coefficient:\n");
-    fprintf(fp, "h =\t%.3f\tJ/m2.K\n", h);
+    writerPrintf(&w, "Fluid heat transfer coefficient:\n");
+    writerPrintf(&w, "h =\t%.3f\tJ/m2.K\n", h);
     
-    //Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    //  Close file
+    writerClose(&w);
 }
 
 void PlateHTCoeffWriteSwitch(int eqnset, double rho, double u, double mu, double cp, double k, double d, double Re, double Pr, double Nu, double h)
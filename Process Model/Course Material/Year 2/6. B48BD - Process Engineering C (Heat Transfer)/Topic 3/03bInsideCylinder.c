@@ -27,6 +27,7 @@
 
 //Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "DimensionlessNum.h"
 #include "03bFilmHTCoefficient.h"
 
@@ -198,100 +199,57 @@ void InCylHTCoeffDisplay(int eqn, double rho, double u, double mu, double mu_wal
 
 void InCylHTCoeffWrite(int eqn, double rho, double u, double mu, double mu_wall, double cp, double k, double d, double Re, double Pr, double St, double Nu, double h)
 {
-    //Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
-    
-    FILE *fp;                   // Pointer to the file location.
-    //Set file name as timestamp + Polytropic Process Results
-        //Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //Creating file name with base format "YYYYmmDD HHMMSS "
-    //Allocating memory for the file name
-    *filename = (char)malloc(sizeof *filename);
-    
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Fluid heat transfer coefficient (Forced Convection inside cylindrical tubes) Estimation");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-    
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-    
-    strcat(filepath, filename);
-     
-    printf("Full file path: \"%s\"\n\n", filepath);
-    
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
-        strcat(filepath, filename);
+    //  Function variables
+    ResultWriter w;             // Buffered writer for the results file.
+    
+    //  Set file name as timestamp + Fluid heat transfer coefficient (Forced Convection inside cylindrical tubes) Estimation
+    if(!writerOpen(&w, "Fluid heat transfer coefficient (Forced Convection inside cylindrical tubes) Estimation"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //Open file
-    fp = fopen(filename, "w+");
-    
-    //Write to file
-    fprintf(fp, "_Film_Heat_Transfer_Coefficient_Estimation_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Fluid density:\n");
-    fprintf(fp, "rho =\t%.3f\tkg/m3\n", rho);
-    fprintf(fp, "Fluid velocity:\n");
-    fprintf(fp, "u =\t%.3f\tm/s\n", u);
-    fprintf(fp, "Fluid viscosity:\n");
-    fprintf(fp, "mu =\t%.3f\tcP\n", 1000*mu);
+    
+    //  Write to file
+    writerPrintf(&w, "_Film_Heat_Transfer_Coefficient_Estimation_\n");
+    writerPrintf(&w, "\tInput parameters:\n");
+    writerPrintf(&w, "Fluid density:\n");
+    writerPrintf(&w, "rho =\t%.3f\tkg/m3\n", rho);
+    writerPrintf(&w, "Fluid velocity:\n");
+    writerPrintf(&w, "u =\t%.3f\tm/s\n", u);
+    writerPrintf(&w, "Fluid viscosity:\n");
+    writerPrintf(&w, "mu =\t%.3f\tcP\n", 1000*mu);
     if(eqn == 4){
-        fprintf(fp, "Fluid viscosity at wall:\n");
-        fprintf(fp, "mu_wall =\t%.3f\tcP\n\n", 1000*mu_wall);
+        writerPrintf(&w, "Fluid viscosity at wall:\n");
+        writerPrintf(&w, "mu_wall =\t%.3f\tcP\n\n", 1000*mu_wall);
     }
     
-    fprintf(fp, "Fluid heat capacity at constant pressure:\n");
-    fprintf(fp, "cp =\t%.3f\tJ/kg.K\n", cp);
-    fprintf(fp, "Fluid thermal conductivity:\n");
-    fprintf(fp, "k =\t%.3f\tW/m.K\n\n", k);
+    writerPrintf(&w, "Fluid heat capacity at constant pressure:\n");
+    writerPrintf(&w, "cp =\t%.3f\tJ/kg.K\n", cp);
+    writerPrintf(&w, "Fluid thermal conductivity:\n");
+    writerPrintf(&w, "k =\t%.3f\tW/m.K\n\n", k);
     
-    fprintf(fp, "Pipe internal diameter:\n");
-    fprintf(fp, "d =\t%.3f\tmm\n\n", 1000*d);
+    writerPrintf(&w, "Pipe internal diameter:\n");
+    writerPrintf(&w, "d =\t%.3f\tmm\n\n", 1000*d);
     
-    fprintf(fp, "\tIntermediate parameters:\n");
-    fprintf(fp, "Reynolds number:\n");
-    fprintf(fp, "Re =\t%.3f\t[ ]\n", Re);
-    fprintf(fp, "Prandtl number:\n");
-    fprintf(fp, "Pr =\t%.3f\t[ ]\n", Pr);
+    writerPrintf(&w, "\tIntermediate parameters:\n");
+    writerPrintf(&w, "Reynolds number:\n");
+    writerPrintf(&w, "Re =\t%.3f\t[ ]\n", Re);
+    writerPrintf(&w, "Prandtl number:\n");
+    writerPrintf(&w, "Pr =\t%.3f\t[ ]\n", Pr);
     if(eqn == 3){
-        fprintf(fp, "Stanton number:\n");
-        fprintf(fp, "St =\t%.3f\t[ ]\n", St);
+        writerPrintf(&w, "Stanton number:\n");
+        writerPrintf(&w, "St =\t%.3f\t[ ]\n", St);
     }else{
-        fprintf(fp, "Nusselt number:\n");
-        fprintf(fp, "Nu =\t%.3f\t[ ]\n", Nu);
+        writerPrintf(&w, "Nusselt number:\n");
+        writerPrintf(&w, "Nu =\t%.3f\t[ ]\n", Nu);
     }
-    fprintf(fp, "\n");
+    writerPrintf(&w, "\n");
     
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "Fluid heat transfer coefficient:\n");
-    fprintf(fp, "h =\t%.3f\tJ/m2.K\n", h);
+    writerPrintf(&w, "\tOutput parameters:\n");
+    writerPrintf(&w, "Fluid heat transfer coefficient:\n");
+    writerPrintf(&w, "h =\t%.3f\tJ/m2.K\n", h);
     
-    //Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    //  Close file
+    writerClose(&w);
 }
 
 void InCylHTCoeffWriteSwitch(int eqn, double rho, double u, double mu, double mu_wall, double cp, double k, double d, double Re, double Pr, double St, double Nu, double h)
@@ -27,6 +27,7 @@
 
 //Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "DimensionlessNum.h"
 #include "01aTemperatureConversion.h"
 #include "03bFilmHTCoefficient.h"
@@ -134,104 +135,61 @@ void NaturalHTCoeffDisplay(double rho, double u, double mu, double beta, double
 
 void NaturalHTCoeffWrite(double rho, double u, double mu, double beta, double cp, double k, double d, double T1, double T2, double constant, double n, double m, double Gr, double Pr, double Nu, double h)
 {
-    //Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
-    
-    FILE *fp;                   // Pointer to the file location.
-    //Set file name as timestamp + Heat Transfer Coefficient Results (Natural Convection)
-        //Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //Creating file name with base format "YYYYmmDD HHMMSS "
-    //Allocating memory for the file name
-    *filename = (char)malloc(sizeof *filename);
-    
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Heat Transfer Coefficient Results (Natural Convection)");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-    
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-    
-    strcat(filepath, filename);
-     
-    printf("Full file path: \"%s\"\n\n", filepath);
-    
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
-        strcat(filepath, filename);
+    //  Function variables
+    ResultWriter w;             // Buffered writer for the results file.
+    
+    //  Set file name as timestamp + Heat Transfer Coefficient Results (Natural Convection)
+    if(!writerOpen(&w, "Heat Transfer Coefficient Results (Natural Convection)"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //Open file
-    fp = fopen(filename, "w+");
-    
-    //Write to file
-    fprintf(fp, "_Film_Heat_Transfer_Coefficient_(Natural_Convection)_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Fluid properties\n");
-    fprintf(fp, "Fluid density:\n");
-    fprintf(fp, "rho =\t%.3f\tkg/m3\n", rho);
-    fprintf(fp, "Fluid velocity:\n");
-    fprintf(fp, "u =\t%.3f\tm/s\n", u);
-    fprintf(fp, "Fluid viscosity:\n");
-    fprintf(fp, "mu =\t%.3f\tcP\n", mu);
-    fprintf(fp, "Coefficient of cubic expansion:\n");
-    fprintf(fp, "beta =\t%.3f\tm/K\n\n", beta);
-    
-    fprintf(fp, "Thermal properties\n");
-    fprintf(fp, "Heat capacity at constant pressure:\n");
-    fprintf(fp, "cp =\t%.3f\tJ/kg.K\n", cp);
-    fprintf(fp, "Fluid thermal conductivity:\n");
-    fprintf(fp, "k =\t%.3f\tW/m.K\n\n", k);
-    
-    fprintf(fp, "System properties\n");
-    fprintf(fp, "Internal pipe diameter:\n");
-    fprintf(fp, "d =\t%.3f\tmm\n", d*1000);
-    fprintf(fp, "Fluid film hot side temperature:\n");
-    fprintf(fp, "T1 =\t%.3f\tdeg C\n", KelvinCelsius(T1));
-    fprintf(fp, "Fluid film cold side temperature:\n");
-    fprintf(fp, "T2 =\t%.3f\tdeg C\n\n", KelvinCelsius(T2));
-    
-    fprintf(fp, "Correlation constants\n");
-    fprintf(fp, "constant =\t%.3f\t[ ]\n", constant);
-    fprintf(fp, "n =\t%.3f\t[ ]\n", n);
-    fprintf(fp, "m =\t%.3f\t[ ]\n\n", m);
-    
-    fprintf(fp, "\tIntermediate parameters:\n");
-    fprintf(fp, "Grashof number:\n");
-    fprintf(fp, "Gr =\t%.3f\t[ ]\n", Gr);
-    fprintf(fp, "Prandtl number:\n");
-    fprintf(fp, "Pr =\t%.3f\t[ ]\n", Pr);
-    fprintf(fp, "Nusselt number:\n");
-    fprintf(fp, "Nu =\t%.3f\t[ ]\n\n", Nu);
-    
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "Film heat transfer coefficient:\n");
-    fprintf(fp, "h =\t%.3f\tW/m2.K\n", h);
-    
-    //Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    
+    //  Write to file
+    writerPrintf(&w, "_Film_Heat_Transfer_Coefficient_(Natural_Convection)_Results_\n");
+    writerPrintf(&w, "\tInput parameters:\n");
+    writerPrintf(&w, "Fluid properties\n");
+    writerPrintf(&w, "Fluid density:\n");
+    writerPrintf(&w, "rho =\t%.3f\tkg/m3\n", rho);
+    writerPrintf(&w, "Fluid velocity:\n");
+    writerPrintf(&w, "u =\t%.3f\tm/s\n", u);
+    writerPrintf(&w, "Fluid viscosity:\n");
+    writerPrintf(&w, "mu =\t%.3f\tcP\n", mu);
+    writerPrintf(&w, "Coefficient of cubic expansion:\n");
+    writerPrintf(&w, "beta =\t%.3f\tm/K\n\n", beta);
+    
+    writerPrintf(&w, "Thermal properties\n");
+    writerPrintf(&w, "Heat capacity at constant pressure:\n");
+    writerPrintf(&w, "cp =\t%.3f\tJ/kg.K\n", cp);
+    writerPrintf(&w, "Fluid thermal conductivity:\n");
+    writerPrintf(&w, "k =\t%.3f\tW/m.K\n\n", k);
+    
+    writerPrintf(&w, "System properties\n");
+    writerPrintf(&w, "Internal pipe diameter:\n");
+    writerPrintf(&w, "d =\t%.3f\tmm\n", d*1000);
+    writerPrintf(&w, "Fluid film hot side temperature:\n");
+    writerPrintf(&w, "T1 =\t%.3f\tdeg C\n", KelvinCelsius(T1));
+    writerPrintf(&w, "Fluid film cold side temperature:\n");
+    writerPrintf(&w, "T2 =\t%.3f\tdeg C\n\n", KelvinCelsius(T2));
+    
+    writerPrintf(&w, "Correlation constants\n");
+    writerPrintf(&w, "constant =\t%.3f\t[ ]\n", constant);
+    writerPrintf(&w, "n =\t%.3f\t[ ]\n", n);
+    writerPrintf(&w, "m =\t%.3f\t[ ]\n\n", m);
+    
+    writerPrintf(&w, "\tIntermediate parameters:\n");
+    writerPrintf(&w, "Grashof number:\n");
+    writerPrintf(&w, "Gr =\t%.3f\t[ ]\n", Gr);
+    writerPrintf(&w, "Prandtl number:\n");
+    writerPrintf(&w, "Pr =\t%.3f\t[ ]\n", Pr);
+    writerPrintf(&w, "Nusselt number:\n");
+    writerPrintf(&w, "Nu =\t%.3f\t[ ]\n\n", Nu);
+    
+    writerPrintf(&w, "\tOutput parameters:\n");
+    writerPrintf(&w, "Film heat transfer coefficient:\n");
+    writerPrintf(&w, "h =\t%.3f\tW/m2.K\n", h);
+    
+    //  Close file
+    writerClose(&w);
 }
 
 void NaturalHTCoeffSwitch(int mode, double rho, double u, double mu, double beta, double cp, double k, double d, double T1, double T2, double constant, double n, double m, double Gr, double Pr, double Nu, double h)
@@ -27,6 +27,7 @@
 
 //Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "DimensionlessNum.h"
 #include "03bFilmHTCoefficient.h"
 
@@ -248,112 +249,69 @@ void OutCylHTCoeffDisplay(int eqn, double rho, double u, double mu, double mu_s,
 
 void OutCylHTCoeffWrite(int eqn, double rho, double u, double mu, double mu_s, double d, double cp, double k, double a, double m, double F1, double F2, double Re, double Pr, double Nu, double h)
 {
-    //Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
-    
-    FILE *fp;                   // Pointer to the file location.
-    //Set file name as timestamp + Fluid heat transfer coefficient (Forced Convection outside cylindrical tubes) Estimation
-        //Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //Creating file name with base format "YYYYmmDD HHMMSS "
-    //Allocating memory for the file name
-    *filename = (char)malloc(sizeof *filename);
-    
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Fluid heat transfer coefficient (Forced Convection outside cylindrical tubes) Estimation");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-    
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-    
-    strcat(filepath, filename);
-     
-    printf("Full file path: \"%s\"\n\n", filepath);
-    
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
-        strcat(filepath, filename);
-    }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
+    //  Function variables
+    ResultWriter w;             // Buffered writer for the results file.
     
-    //Open file
-    fp = fopen(filename, "w+");
+    //  Set file name as timestamp + Fluid heat transfer coefficient (Forced Convection outside cylindrical tubes) Estimation
+    if(!writerOpen(&w, "Fluid heat transfer coefficient (Forced Convection outside cylindrical tubes) Estimation"))
+    {
+        return;
+    }
     
-    //Write to file
-    fprintf(fp, "_Film_Heat_Transfer_Coefficient_Estimation_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Fluid density:\n");
-    fprintf(fp, "rho =\t%.3f\tkg/m3\n", rho);
-    fprintf(fp, "Fluid velocity:\n");
-    fprintf(fp, "u =\t%.3f\tm/s\n", u);
+    //  Write to file
+    writerPrintf(&w, "_Film_Heat_Transfer_Coefficient_Estimation_\n");
+    writerPrintf(&w, "\tInput parameters:\n");
+    writerPrintf(&w, "Fluid density:\n");
+    writerPrintf(&w, "rho =\t%.3f\tkg/m3\n", rho);
+    writerPrintf(&w, "Fluid velocity:\n");
+    writerPrintf(&w, "u =\t%.3f\tm/s\n", u);
     
     if(eqn == 3){
-        fprintf(fp, "Bulk fluid viscosity:\n");
-        fprintf(fp, "mu =\t%.3f\tcP\n", 1000*mu);
-        fprintf(fp, "Fluid viscosity at wall:\n");
-        fprintf(fp, "mu_s =\t%.3f\tcP\n\n", 1000*mu_s);
+        writerPrintf(&w, "Bulk fluid viscosity:\n");
+        writerPrintf(&w, "mu =\t%.3f\tcP\n", 1000*mu);
+        writerPrintf(&w, "Fluid viscosity at wall:\n");
+        writerPrintf(&w, "mu_s =\t%.3f\tcP\n\n", 1000*mu_s);
     }else{
-        fprintf(fp, "Fluid viscosity:\n");
-        fprintf(fp, "mu =\t%.3f\tcP\n\n", 1000*mu);
+        writerPrintf(&w, "Fluid viscosity:\n");
+        writerPrintf(&w, "mu =\t%.3f\tcP\n\n", 1000*mu);
     }
-    fprintf(fp, "Fluid heat capacity at constant pressure:\n");
-    fprintf(fp, "cp =\t%.3f\tJ/kg.K\n", cp);
-    fprintf(fp, "Thermal conductivity:\n");
-    fprintf(fp, "k =\t%.3f\tW/m.K\n\n", k);
+    writerPrintf(&w, "Fluid heat capacity at constant pressure:\n");
+    writerPrintf(&w, "cp =\t%.3f\tJ/kg.K\n", cp);
+    writerPrintf(&w, "Thermal conductivity:\n");
+    writerPrintf(&w, "k =\t%.3f\tW/m.K\n\n", k);
     
-    fprintf(fp, "Equivalent pipe diameter:\n");
-    fprintf(fp, "d =\t%.3f\tmm\n\n", 1000*d);
+    writerPrintf(&w, "Equivalent pipe diameter:\n");
+    writerPrintf(&w, "d =\t%.3f\tmm\n\n", 1000*d);
     
     if(eqn == 3 || eqn == 4){
-        fprintf(fp, "Correlation constants:\n");
+        writerPrintf(&w, "Correlation constants:\n");
     }
     if(eqn == 3){
-        fprintf(fp, "a =\t%.3f\t[ ]\n", a);
+        writerPrintf(&w, "a =\t%.3f\t[ ]\n", a);
     }
     if(eqn == 3 || eqn == 4){
-        fprintf(fp, "m =\t%.3f\t[ ]\n", m);
+        writerPrintf(&w, "m =\t%.3f\t[ ]\n", m);
     }
     if(eqn == 3){
-        fprintf(fp, "F1 =\t%.3f\t[ ]\n", F1);
-        fprintf(fp, "F2 =\t%.3f\t[ ]\n", F2);
+        writerPrintf(&w, "F1 =\t%.3f\t[ ]\n", F1);
+        writerPrintf(&w, "F2 =\t%.3f\t[ ]\n", F2);
     }
-    fprintf(fp, "\n");
-    
-    fprintf(fp, "\tIntermediate parameters:\n");
-    fprintf(fp, "Reynolds number:\n");
-    fprintf(fp, "Re =\t%.3f\t[ ]\n", Re);
-    fprintf(fp, "Prandtl number:\n");
-    fprintf(fp, "Pr =\t%.3f\t[ ]\n", Pr);
-    fprintf(fp, "Nusselt number:\n");
-    fprintf(fp, "Nu =\t%.3f\t[ ]\n\n", Nu);
-    
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "Fluid heat transfer coefficient:\n");
-    fprintf(fp, "h =\t%.3f\tW/m3.K\n", h);
-    
-    //Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerPrintf(&w, "\n");
+    
+    writerPrintf(&w, "\tIntermediate parameters:\n");
+    writerPrintf(&w, "Reynolds number:\n");
+    writerPrintf(&w, "Re =\t%.3f\t[ ]\n", Re);
+    writerPrintf(&w, "Prandtl number:\n");
+    writerPrintf(&w, "Pr =\t%.3f\t[ ]\n", Pr);
+    writerPrintf(&w, "Nusselt number:\n");
+    writerPrintf(&w, "Nu =\t%.3f\t[ ]\n\n", Nu);
+    
+    writerPrintf(&w, "\tOutput parameters:\n");
+    writerPrintf(&w, "Fluid heat transfer coefficient:\n");
+    writerPrintf(&w, "h =\t%.3f\tW/m3.K\n", h);
+    
+    //  Close file
+    writerClose(&w);
 }
 
 void OutCylHTCoeffWriteSwitch(int eqn, double rho, double u, double mu, double mu_s, double d, double cp, double k, double a, double m, double F1, double F2, double Re, double Pr, double Nu, double h)
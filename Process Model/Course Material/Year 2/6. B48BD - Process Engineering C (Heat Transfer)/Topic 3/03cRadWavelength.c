@@ -28,6 +28,7 @@
 
 //Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "B48BD_T3.h"
 #include "01aTemperatureConversion.h"
 #include "03cRadWavelength.h"
@@ -123,79 +124,29 @@ void EmissivePwrDisplay(EmissivePower data, int numIsotherms)
 void EmissivePwrWrite(EmissivePower data, int numIsotherms)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
+    WriterColumn cols[26];      // Wavelength column followed by one column for each isotherm.
+    char names[25][maxstrlen];  // Headings of the isotherm columns.
     
-    FILE *fp;                   // Pointer to the file location.
     //  Set file name as timestamp + Monochromatic Emissive Power Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Monochromatic Emissive Power Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-    *filepath = (char)malloc(sizeof *filepath);
-    
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-    printf("File path: \"%s\"\n", filepath);
-    
-    strcat(filepath, filename);
-    void free(void *filename); // Removing 'filename' from the heap
-    
-    printf("File name: \"%s\"\n", filename);
-    printf("Full file path: \"%s\"\n\n", filepath);
-    
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
-    }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //Open file
-    fp = fopen(filename, "w+");
-    
-    //Write to file
-    fprintf(fp, "_Monochromatic_Emissive_Power_Results_\n");
-    fprintf(fp, "T =\t");
-    for(int i = 0; i < numIsotherms; ++i)
+    if(!writerOpen(&w, "Monochromatic Emissive Power Results"))
     {
-        fprintf(fp, "%.3f\t", data.T[i]);
+        return;
     }
-    fprintf(fp, "\n");
     
-    fprintf(fp, "\\lambda (m)\tE_{\\lambda} (W/m3)\n");
-    for(int i = 0; i < 5000; ++i)
+    //  Write to file
+    writerText(&w, "_Monochromatic_Emissive_Power_Results_\n");
+    
+    cols[0] = (WriterColumn){"\\lambda", "m", data.wavelength, 1, WriterSci, 5, 1.0, 0.0};
+    for(int j = 0; j < numIsotherms; ++j)
     {
-        fprintf(fp, "%.5E\t", data.wavelength[i]);
-        for(int j = 0; j < numIsotherms; ++j)
-        {
-            fprintf(fp, "%.5E\t", data.EmPower[i][j]);
-        }
-        fprintf(fp, "\n");
+        snprintf(names[j], maxstrlen, "E_{\\lambda} at T = %.3f K", data.T[j]);
+        cols[j + 1] = (WriterColumn){names[j], "W/m3", &data.EmPower[0][j], 25, WriterSci, 5, 1.0, 0.0};
     }
+    writerTable(&w, numIsotherms + 1, cols, 5000);
     
     //Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void EmissivePwSwitch(int mode, EmissivePower results, int numIsotherms)
@@ -0,0 +1,833 @@
+//
+//  03dRadEnclosure.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+/// MARK: HEADER DECLARATIONS
+//Standard Header Files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//Custom Header Files
+#include "System.h"
+#include "ResultWriter.h"
+#include "LinearAlgebra.h"
+#include "Parallel.h"
+#include "B48BD_T3.h"
+#include "01aTemperatureConversion.h"
+#include "01dRadiation.h"
+#include "03dRadEnclosure.h"
+
+/// MARK: SUBROUTINE DEFINITIONS
+#define maxstrlen 128
+#define PI 3.14159265358979323846
+#define raybatch 4096       // Rays traced per random number stream.
+#define denselimit 400      // Largest enclosure solved by LU factorisation.
+
+/// MARK: VARIABLE INPUT
+RadSurface RadSurfaceVariable(int i, int askArea, RadSurface surface)
+{
+    char input[maxstrlen];
+    int control = 0;
+    
+    printf("Surface %i:\n", i + 1);
+    if(askArea == 1)
+    {
+        surface.A = inputDouble(0, 0, "surface area", "m2");
+    }
+    
+    control = 1;
+    while(control == 1)
+    {
+        surface.eps = inputDouble(0, 0, "surface emissivity", "[ ]");
+        if(surface.eps > 1.0)
+        {
+            printf("Emissivity cannot exceed unity. Please enter a different value.\n");
+        }else{
+            control = 0;
+        }
+    }
+    
+    control = 1;
+    while(control == 1)
+    {
+        printf("Is the surface temperature (1) or net rate of heat loss (2) known? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+                surface.known = 1;
+                surface.T = inputDouble(1, 1, "surface temperature", "deg C");
+                surface.T = CelsiusKelvin(surface.T);
+                control = 0;
+                break;
+            case '2':
+                surface.known = 2;
+                surface.Q = inputDouble(1, 1, "net rate of heat loss (0 for a re-radiating surface)", "W");
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+    
+    return surface;
+}
+
+RadSurface RadGeometryVariable(int i, RadSurface surface)
+{
+    char label[maxstrlen];
+    const char axis[3] = {'x', 'y', 'z'};
+    double cross[3];
+    
+    printf("Surface %i is described by a corner and two edge vectors. The cross product of the first and second edge must point into the enclosure.\n", i + 1);
+    for(int k = 0; k < 3; ++k)
+    {
+        sprintf(label, "corner %c-coordinate", axis[k]);
+        surface.origin[k] = inputDouble(1, 1, label, "m");
+    }
+    for(int k = 0; k < 3; ++k)
+    {
+        sprintf(label, "first edge %c-component", axis[k]);
+        surface.edge1[k] = inputDouble(1, 1, label, "m");
+    }
+    for(int k = 0; k < 3; ++k)
+    {
+        sprintf(label, "second edge %c-component", axis[k]);
+        surface.edge2[k] = inputDouble(1, 1, label, "m");
+    }
+    
+    //  The surface area follows from the parallelogram.
+    cross[0] = surface.edge1[1]*surface.edge2[2] - surface.edge1[2]*surface.edge2[1];
+    cross[1] = surface.edge1[2]*surface.edge2[0] - surface.edge1[0]*surface.edge2[2];
+    cross[2] = surface.edge1[0]*surface.edge2[1] - surface.edge1[1]*surface.edge2[0];
+    surface.A = sqrt(cross[0]*cross[0] + cross[1]*cross[1] + cross[2]*cross[2]);
+    printf("Surface area:\nA =\t%.3f\tm2\n", surface.A);
+    
+    return surface;
+}
+
+void ViewFactorVariable(int n, RadSurface *surfaces, double *F)
+{
+    char label[maxstrlen];
+    
+    for(int i = 0; i < n; ++i)
+    {
+        for(int j = i; j < n; ++j)
+        {
+            sprintf(label, "F_%i%i", i + 1, j + 1);
+            F[i*n + j] = inputDouble(1, 0, label, "[ ]");
+            F[j*n + i] = ViewFactorReciprocity(surfaces[i].A, F[i*n + j], surfaces[j].A);
+        }
+    }
+    for(int i = 0; i < n; ++i)
+    {
+        double sum = ViewFactorSummation(n, F, i);
+        if(fabs(sum - 1.0) > 0.01)
+        {
+            printf("Warning: view factors leaving surface %i sum to %.4f. The enclosure may not be closed.\n", i + 1, sum);
+        }
+    }
+}
+
+/// MARK: VIEW FACTORS
+double ViewFactorCoaxialDiscs(double ri, double rj, double L)
+{
+    double Ri = 0.0;
+    double Rj = 0.0;
+    double S = 0.0;
+    double F = 0.0;
+    
+    Ri = ri/L;
+    Rj = rj/L;
+    
+    S = pow(Rj, 2);
+    S = 1 + (S);
+    S = (S)/pow(Ri, 2);
+    S = 1 + (S);
+    
+    F = pow(S, 2);
+    F = (F) - 4*pow(rj/ri, 2);
+    F = sqrt(F);
+    F = S - (F);
+    F = 0.5*(F);
+    
+    return F;
+}
+
+double ViewFactorParallelRectangles(double X, double Y, double L)
+{
+    double Xb = 0.0;
+    double Yb = 0.0;
+    double F = 0.0;
+    double sto = 0.0;
+    
+    Xb = X/L;
+    Yb = Y/L;
+    
+    sto = (1 + pow(Xb, 2))*(1 + pow(Yb, 2));
+    sto = (sto)/(1 + pow(Xb, 2) + pow(Yb, 2));
+    F = 0.5*log(sto);
+    
+    sto = sqrt(1 + pow(Yb, 2));
+    F += Xb*(sto)*atan(Xb/(sto));
+    
+    sto = sqrt(1 + pow(Xb, 2));
+    F += Yb*(sto)*atan(Yb/(sto));
+    
+    F -= Xb*atan(Xb);
+    F -= Yb*atan(Yb);
+    
+    F = 2*(F);
+    F = (F)/(PI*Xb*Yb);
+    
+    return F;
+}
+
+double ViewFactorPerpendicularRectangles(double X, double Y, double Z)
+{
+    double H = 0.0;
+    double W = 0.0;
+    double H2 = 0.0;
+    double W2 = 0.0;
+    double F = 0.0;
+    double sto = 0.0;
+    double logterm = 0.0;
+    
+    H = Z/X;
+    W = Y/X;
+    H2 = pow(H, 2);
+    W2 = pow(W, 2);
+    
+    F = W*atan(1/W);
+    F += H*atan(1/H);
+    sto = sqrt(H2 + W2);
+    F -= (sto)*atan(1/(sto));
+    
+    logterm = log((1 + W2)*(1 + H2)/(1 + W2 + H2));
+    sto = W2*(1 + W2 + H2);
+    sto = (sto)/((1 + W2)*(W2 + H2));
+    logterm += W2*log(sto);
+    sto = H2*(1 + H2 + W2);
+    sto = (sto)/((1 + H2)*(H2 + W2));
+    logterm += H2*log(sto);
+    
+    F += 0.25*(logterm);
+    F = (F)/(PI*W);
+    
+    return F;
+}
+
+double ViewFactorConcentricCylinders(double ri, double ro)
+{
+    return ri/ro;
+}
+
+double ViewFactorConcentricSpheres(double ri, double ro)
+{
+    return pow(ri/ro, 2);
+}
+
+double ViewFactorReciprocity(double Ai, double Fij, double Aj)
+{
+    double Fji = 0.0;
+    
+    Fji = Ai*Fij;
+    Fji = (Fji)/Aj;
+    
+    return Fji;
+}
+
+double ViewFactorSummation(int n, const double *F, int i)
+{
+    double sum = 0.0;
+    
+    for(int j = 0; j < n; ++j)
+    {
+        sum += F[i*n + j];
+    }
+    
+    return sum;
+}
+
+/// MARK: MONTE CARLO RAY TRACING
+typedef struct RayStream{
+    unsigned long long s[2];    // State of the xorshift128+ generator.
+} RayStream;
+
+typedef struct RayTraceJob{
+    int n;                      // Number of surfaces.
+    const RadSurface *surfaces; // Enclosure geometry.
+    long rays;                  // Rays emitted per surface.
+    int batches;                // Batches per surface.
+    unsigned long long seed;    // Base seed.
+    long *hits;                 // Hit counts for each batch (batches*n x n).
+} RayTraceJob;
+
+static unsigned long long SplitMix64(unsigned long long *x)
+{
+    unsigned long long z = 0;
+    
+    *x += 0x9E3779B97F4A7C15ULL;
+    z = *x;
+    z = (z ^ (z >> 30))*0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27))*0x94D049BB133111EBULL;
+    
+    return z ^ (z >> 31);
+}
+
+static RayStream RayStreamSeed(unsigned long long seed, unsigned long long stream)
+{
+    RayStream rng;
+    unsigned long long x = 0;
+    
+    //  Every batch receives its own stream derived from the base seed and the batch number.
+    x = seed ^ SplitMix64(&stream);
+    rng.s[0] = SplitMix64(&x);
+    rng.s[1] = SplitMix64(&x);
+    
+    return rng;
+}
+
+static double RayStreamUniform(RayStream *rng)
+{
+    unsigned long long s1 = rng->s[0];
+    unsigned long long s0 = rng->s[1];
+    
+    rng->s[0] = s0;
+    s1 ^= s1 << 23;
+    rng->s[1] = s1 ^ s0 ^ (s1 >> 17) ^ (s0 >> 26);
+    
+    return ((rng->s[1] + s0) >> 11)*(1.0/9007199254740992.0);
+}
+
+static void RayCross(const double a[3], const double b[3], double c[3])
+{
+    c[0] = a[1]*b[2] - a[2]*b[1];
+    c[1] = a[2]*b[0] - a[0]*b[2];
+    c[2] = a[0]*b[1] - a[1]*b[0];
+}
+
+static double RayDot(const double a[3], const double b[3])
+{
+    return a[0]*b[0] + a[1]*b[1] + a[2]*b[2];
+}
+
+static void RayTraceKernel(int start, int end, void *context)
+{
+    RayTraceJob *job = (RayTraceJob *)context;
+    int n = job->n;
+    
+    for(int task = start; task < end; ++task)
+    {
+        int i = task/job->batches;
+        int b = task%job->batches;
+        long first = 0;
+        long last = 0;
+        long *hits = &job->hits[(long)task*n];
+        const RadSurface *src = &job->surfaces[i];
+        double nrm[3];
+        double t1[3];
+        double t2[3];
+        double len = 0.0;
+        RayStream rng;
+        
+        //  Rays assigned to this batch.
+        first = (job->rays*b)/job->batches;
+        last = (job->rays*(b + 1))/job->batches;
+        rng = RayStreamSeed(job->seed, (unsigned long long)task);
+        
+        //  Local orthonormal basis of the emitting surface.
+        RayCross(src->edge1, src->edge2, nrm);
+        len = sqrt(RayDot(nrm, nrm));
+        for(int k = 0; k < 3; ++k)
+        {
+            nrm[k] /= len;
+        }
+        len = sqrt(RayDot(src->edge1, src->edge1));
+        for(int k = 0; k < 3; ++k)
+        {
+            t1[k] = src->edge1[k]/len;
+        }
+        RayCross(nrm, t1, t2);
+        
+        for(long r = first; r < last; ++r)
+        {
+            double p[3];
+            double dir[3];
+            double u = RayStreamUniform(&rng);
+            double v = RayStreamUniform(&rng);
+            double phi = 2*PI*RayStreamUniform(&rng);
+            double sintheta = 0.0;
+            double costheta = 0.0;
+            double tmin = HUGE_VAL;
+            int target = -1;
+            
+            //  Uniformly distributed emission point and diffuse (cosine-weighted) direction.
+            sintheta = RayStreamUniform(&rng);
+            costheta = sqrt(1 - sintheta);
+            sintheta = sqrt(sintheta);
+            for(int k = 0; k < 3; ++k)
+            {
+                p[k] = src->origin[k] + u*src->edge1[k] + v*src->edge2[k];
+                dir[k] = sintheta*cos(phi)*t1[k] + sintheta*sin(phi)*t2[k] + costheta*nrm[k];
+            }
+            
+            //  Nearest surface struck by the ray. A planar surface cannot see itself.
+            for(int j = 0; j < n; ++j)
+            {
+                const RadSurface *dst = &job->surfaces[j];
+                double nj[3];
+                double w[3];
+                double wc[3];
+                double denom = 0.0;
+                double t = 0.0;
+                double nn = 0.0;
+                double a = 0.0;
+                double c = 0.0;
+                
+                if(j == i)
+                {
+                    continue;
+                }
+                RayCross(dst->edge1, dst->edge2, nj);
+                denom = RayDot(dir, nj);
+                if(denom == 0.0)
+                {
+                    continue;
+                }
+                for(int k = 0; k < 3; ++k)
+                {
+                    w[k] = dst->origin[k] - p[k];
+                }
+                t = RayDot(w, nj)/denom;
+                if(t <= 1e-12 || t >= tmin)
+                {
+                    continue;
+                }
+                for(int k = 0; k < 3; ++k)
+                {
+                    w[k] = p[k] + t*dir[k] - dst->origin[k];
+                }
+                nn = RayDot(nj, nj);
+                RayCross(w, dst->edge2, wc);
+                a = RayDot(wc, nj)/nn;
+                RayCross(dst->edge1, w, wc);
+                c = RayDot(wc, nj)/nn;
+                if(a >= 0.0 && a <= 1.0 && c >= 0.0 && c <= 1.0)
+                {
+                    tmin = t;
+                    target = j;
+                }
+            }
+            if(target >= 0)
+            {
+                ++hits[target];
+            }
+        }
+    }
+}
+
+int ViewFactorMonteCarlo(int n, const RadSurface *surfaces, long rays, unsigned long long seed, double *F)
+{
+    RayTraceJob job;
+    
+    job.n = n;
+    job.surfaces = surfaces;
+    job.rays = rays;
+    job.seed = seed;
+    
+    //  The batch count depends only on the problem size, so the estimate is reproducible on any machine.
+    job.batches = (int)((rays + raybatch - 1)/raybatch);
+    if(job.batches < 1)
+    {
+        job.batches = 1;
+    }
+    job.hits = calloc((size_t)n*job.batches*n, sizeof(long));
+    if(job.hits == NULL)
+    {
+        printf("Memory could not be allocated for the ray tracing hit counts.\n");
+        return 1;
+    }
+    
+    parallelFor(n*job.batches, 1, RayTraceKernel, &job);
+    
+    for(int i = 0; i < n; ++i)
+    {
+        for(int j = 0; j < n; ++j)
+        {
+            long count = 0;
+            
+            for(int b = 0; b < job.batches; ++b)
+            {
+                count += job.hits[((long)i*job.batches + b)*n + j];
+            }
+            F[i*n + j] = (double)count/(double)rays;
+        }
+    }
+    free(job.hits);
+    
+    //  Enforcing reciprocity by averaging A_i F_ij and A_j F_ji.
+    for(int i = 0; i < n; ++i)
+    {
+        for(int j = i + 1; j < n; ++j)
+        {
+            double AF = 0.0;
+            
+            AF = surfaces[i].A*F[i*n + j] + surfaces[j].A*F[j*n + i];
+            AF = 0.5*(AF);
+            F[i*n + j] = AF/surfaces[i].A;
+            F[j*n + i] = AF/surfaces[j].A;
+        }
+    }
+    
+    return 0;
+}
+
+/// MARK: GENERAL CALCULATIONS
+int RadiosityNetwork(int n, RadSurface *surfaces, const double *F)
+{
+    double *M = calloc((size_t)n*n, sizeof(double));    // Coefficient matrix of the radiosity network.
+    double *b = calloc(n, sizeof(double));              // Right-hand side.
+    int *pivot = calloc(n, sizeof(int));
+    double sigma = 0.0;
+    int error = 0;
+    
+    sigma = StefanBoltzmannConstant();
+    
+    //  Building the network equations
+    for(int i = 0; i < n; ++i)
+    {
+        if(surfaces[i].known == 1)
+        {
+            //  J_i - (1 - eps_i) sum(F_ij J_j) = eps_i sigma T_i^4
+            for(int j = 0; j < n; ++j)
+            {
+                M[i*n + j] = -(1 - surfaces[i].eps)*F[i*n + j];
+            }
+            M[i*n + i] += 1.0;
+            b[i] = surfaces[i].eps*sigma*pow(surfaces[i].T, 4);
+        }else{
+            //  sum(F_ij (J_i - J_j)) = Q_i/A_i
+            for(int j = 0; j < n; ++j)
+            {
+                if(j != i)
+                {
+                    M[i*n + j] = -F[i*n + j];
+                    M[i*n + i] += F[i*n + j];
+                }
+            }
+            b[i] = surfaces[i].Q/surfaces[i].A;
+        }
+    }
+    
+    //  Solving the network
+    if(n <= denselimit)
+    {
+        error = LUDecompose(n, M, pivot);
+        if(error == 0)
+        {
+            LUSolve(n, M, pivot, b);
+            for(int i = 0; i < n; ++i)
+            {
+                surfaces[i].J = b[i];
+            }
+        }
+    }else{
+        //  Initial guess: black-body emission for known temperatures and the mean of these elsewhere.
+        double Jmean = 0.0;
+        int count = 0;
+        
+        for(int i = 0; i < n; ++i)
+        {
+            if(surfaces[i].known == 1)
+            {
+                Jmean += sigma*pow(surfaces[i].T, 4);
+                ++count;
+            }
+        }
+        if(count > 0)
+        {
+            Jmean /= count;
+        }
+        double *J = calloc(n, sizeof(double));
+        for(int i = 0; i < n; ++i)
+        {
+            J[i] = (surfaces[i].known == 1) ? sigma*pow(surfaces[i].T, 4) : Jmean;
+        }
+        error = (SORSolve(n, M, b, J, 1.2, 1e-10, 10000) < 0);
+        for(int i = 0; i < n; ++i)
+        {
+            surfaces[i].J = J[i];
+        }
+        free(J);
+    }
+    
+    //  Recovering the net heat rates and unknown temperatures
+    if(error == 0)
+    {
+        for(int i = 0; i < n; ++i)
+        {
+            double Q = 0.0;
+            
+            for(int j = 0; j < n; ++j)
+            {
+                Q += F[i*n + j]*(surfaces[i].J - surfaces[j].J);
+            }
+            Q *= surfaces[i].A;
+            
+            if(surfaces[i].known == 1)
+            {
+                surfaces[i].Q = Q;
+            }else{
+                double Eb = 0.0;
+                
+                Eb = (1 - surfaces[i].eps)/surfaces[i].eps;
+                Eb *= surfaces[i].Q/surfaces[i].A;
+                Eb += surfaces[i].J;
+                surfaces[i].T = pow(Eb/sigma, 0.25);
+            }
+        }
+    }
+    
+    free(M);
+    free(b);
+    free(pivot);
+    
+    return error;
+}
+
+/// MARK: DISPLAY AND WRITE
+void RadEnclosureDisplay(int n, RadSurface *surfaces, double *F)
+{
+    printf("_Radiation_Enclosure_Results_\n");
+    printf("\tView factor matrix:\n");
+    printf("i\\j\t");
+    for(int j = 0; j < n; ++j)
+    {
+        printf("%i\t", j + 1);
+    }
+    printf("Sum\n");
+    for(int i = 0; i < n; ++i)
+    {
+        printf("%i\t", i + 1);
+        for(int j = 0; j < n; ++j)
+        {
+            printf("%.4f\t", F[i*n + j]);
+        }
+        printf("%.4f\n", ViewFactorSummation(n, F, i));
+    }
+    printf("\n");
+    
+    printf("\tSurface parameters:\n");
+    printf("Surface\tA (m2)\teps ([ ])\tT (deg C)\tJ (W/m2)\tQ (W)\n");
+    for(int i = 0; i < n; ++i)
+    {
+        printf("%i\t%.3f\t%.3f\t%.3f\t%.3f\t%.3f\n", i + 1, surfaces[i].A, surfaces[i].eps, surfaces[i].T - 273.15, surfaces[i].J, surfaces[i].Q);
+    }
+    printf("\n");
+}
+
+void RadEnclosureWrite(int n, RadSurface *surfaces, double *F)
+{
+    //  Function variables
+    ResultWriter w;             // Buffered writer for the results file.
+    
+    //  Set file name as timestamp + Radiation Enclosure Results
+    if(!writerOpen(&w, "Radiation Enclosure Results"))
+    {
+        return;
+    }
+    
+    //  Write to file
+    writerPrintf(&w, "_Radiation_Enclosure_Results_\n");
+    writerPrintf(&w, "\tView factor matrix:\n");
+    writerPrintf(&w, "i\\j\t");
+    for(int j = 0; j < n; ++j)
+    {
+        writerPrintf(&w, "%i\t", j + 1);
+    }
+    writerPrintf(&w, "Sum\n");
+    for(int i = 0; i < n; ++i)
+    {
+        writerPrintf(&w, "%i\t", i + 1);
+        for(int j = 0; j < n; ++j)
+        {
+            writerPrintf(&w, "%.4f\t", F[i*n + j]);
+        }
+        writerPrintf(&w, "%.4f\n", ViewFactorSummation(n, F, i));
+    }
+    writerPrintf(&w, "\n");
+    
+    writerPrintf(&w, "\tSurface parameters:\n");
+    writerPrintf(&w, "Surface\tA (m2)\teps ([ ])\tT (deg C)\tJ (W/m2)\tQ (W)\n");
+    for(int i = 0; i < n; ++i)
+    {
+        writerPrintf(&w, "%i\t%.3f\t%.3f\t%.3f\t%.3f\t%.3f\n", i + 1, surfaces[i].A, surfaces[i].eps, surfaces[i].T - 273.15, surfaces[i].J, surfaces[i].Q);
+    }
+    
+    //  Close file
+    writerClose(&w);
+}
+
+void RadEnclosureWriteSwitch(int n, RadSurface *surfaces, double *F)
+{
+    int control = 0;
+    
+    control = 1;
+    while(control == 1)
+    {
+        char input[maxstrlen];
+        
+        printf("Do you want to save results to file? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+            case 'T':
+            case 'Y':
+            case 't':
+            case 'y':
+                RadEnclosureWrite(n, surfaces, F);
+                control = 0;
+                break;
+            case '0':
+            case 'F':
+            case 'N':
+            case 'f':
+            case 'n':
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+}
+
+/// MARK: PSEUDO-MAIN FUNCTION
+void RadEnclosure(void)
+{
+    int whilmain = 0;
+    printf("Radiation Enclosure\n");
+    
+    whilmain = 1;
+    while(whilmain == 1)
+    {
+        //  Variable declaration
+        char input[maxstrlen];
+        int control = 0;
+        int mode = 0;       // View factor source: entered by hand (1) or ray traced (2).
+        int n = 0;          // Number of surfaces.
+        long rays = 0;      // Rays emitted per surface.
+        RadSurface *surfaces = NULL;
+        double *F = NULL;   // View factor matrix.
+            //  Variables for timing function
+        struct timespec start, end;
+        double elapsed = 0.0;
+        
+        //  Data Collection
+        control = 1;
+        while(control == 1)
+        {
+            n = (int)inputDouble(0, 0, "number of surfaces in the enclosure", "");
+            if(n < 2)
+            {
+                printf("An enclosure requires at least two surfaces.\n");
+            }else{
+                control = 0;
+            }
+        }
+        surfaces = calloc(n, sizeof(RadSurface));
+        F = calloc((size_t)n*n, sizeof(double));
+        
+        control = 1;
+        while(control == 1)
+        {
+            printf("Should the view factors be entered by hand (1) or estimated by ray tracing (2)? ");
+            fgets(input, sizeof(input), stdin);
+            switch(input[0])
+            {
+                case '1':
+                case '2':
+                    mode = input[0] - '0';
+                    control = 0;
+                    break;
+                default:
+                    printf("Input not recognised\n");
+                    break;
+            }
+        }
+        
+        for(int i = 0; i < n; ++i)
+        {
+            if(mode == 2)
+            {
+                surfaces[i] = RadGeometryVariable(i, surfaces[i]);
+            }
+            surfaces[i] = RadSurfaceVariable(i, (mode == 1), surfaces[i]);
+        }
+        if(mode == 2)
+        {
+            rays = (long)inputDouble(0, 0, "number of rays emitted from each surface", "");
+        }else{
+            ViewFactorVariable(n, surfaces, F);
+        }
+        
+        //  Data Manipulation
+        clock_getres(CLOCK_MONOTONIC, &start);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        
+        // Calculation function(s)
+        if(mode == 2 && ViewFactorMonteCarlo(n, surfaces, rays, 20201130ULL, F) != 0){
+            control = -1;
+        }else{
+            control = RadiosityNetwork(n, surfaces, F);
+        }
+        
+        clock_getres(CLOCK_MONOTONIC, &end);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        elapsed = timer(start, end);
+
+        printf("Calculations completed in %.6f seconds.\n", elapsed);
+        
+        if(control == 0)
+        {
+            //  Displaying results
+            RadEnclosureDisplay(n, surfaces, F);
+            
+            //  Writing to File
+            RadEnclosureWriteSwitch(n, surfaces, F);
+        }
+        if(control > 0)
+        {
+            printf("The radiosity network could not be solved. At least one surface must have a known temperature.\n");
+        }
+        
+        //  Continue function
+        whilmain = Continue(whilmain);
+        free(surfaces);
+        free(F);
+    }
+    fflush(stdout);
+}
@@ -0,0 +1,150 @@
+//
+//  03dRadEnclosure.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef _3dRadEnclosureStruct_h
+#define _3dRadEnclosureStruct_h
+
+typedef struct RadSurface{
+    double A;           // Surface area (m2).
+    double eps;         // Surface emissivity ([ ]).
+    double T;           // Surface temperature (K).
+    double Q;           // Net rate of radiative heat loss from the surface (W).
+    double J;           // Surface radiosity (W/m2).
+    int known;          // Boundary condition: temperature specified (1) or net heat rate specified (2).
+    double origin[3];   // Corner of the parallelogram describing the surface (m).
+    double edge1[3];    // First edge vector of the parallelogram (m).
+    double edge2[3];    // Second edge vector of the parallelogram (m). edge1 x edge2 points into the enclosure.
+} RadSurface;
+
+#endif /* _3dRadEnclosureStruct_h */
+
+#ifndef _3dRadEnclosureVariable_h
+#define _3dRadEnclosureVariable_h
+
+/// This subroutine is used to collect the radiative properties and boundary condition of a single surface within the enclosure.
+/// @param i Surface identifier.
+/// @param askArea Integer used to control whether the surface area is collected (1) or has already been calculated from the surface geometry (0).
+/// @param surface Struct where the surface data should be entered.
+RadSurface RadSurfaceVariable(int i, int askArea, RadSurface surface);
+
+/// This subroutine is used to collect the parallelogram describing the position of a single surface within the enclosure.
+/// @param i Surface identifier.
+/// @param surface Struct where the surface geometry should be entered.
+RadSurface RadGeometryVariable(int i, RadSurface surface);
+
+/// This subroutine is used to collect the view factor matrix by hand. Only the upper triangle is collected, with the remaining view factors calculated by the reciprocity rule.
+/// @param n Number of surfaces within the enclosure.
+/// @param surfaces Array of surfaces within the enclosure.
+/// @param F View factor matrix stored in row-major order (n x n).
+void ViewFactorVariable(int n, RadSurface *surfaces, double *F);
+
+#endif /* _3dRadEnclosureVariable_h */
+
+#ifndef _3dRadEnclosureViewFactor_h
+#define _3dRadEnclosureViewFactor_h
+
+/// This subroutine is used to calculate the view factor from a disc to a parallel coaxial disc.
+/// @param ri Radius of the emitting disc (m).
+/// @param rj Radius of the receiving disc (m).
+/// @param L Separation between discs (m).
+double ViewFactorCoaxialDiscs(double ri, double rj, double L);
+
+/// This subroutine is used to calculate the view factor between two aligned parallel rectangles of equal size.
+/// @param X Length of the rectangles (m).
+/// @param Y Width of the rectangles (m).
+/// @param L Separation between rectangles (m).
+double ViewFactorParallelRectangles(double X, double Y, double L);
+
+/// This subroutine is used to calculate the view factor between two perpendicular rectangles sharing a common edge.
+/// @param X Length of the common edge (m).
+/// @param Y Width of the emitting rectangle (m).
+/// @param Z Width of the receiving rectangle (m).
+double ViewFactorPerpendicularRectangles(double X, double Y, double Z);
+
+/// This subroutine is used to calculate the view factor from the outer to the inner surface of two long concentric cylinders. The view factor from the inner to the outer cylinder is unity.
+/// @param ri Inner cylinder radius (m).
+/// @param ro Outer cylinder radius (m).
+double ViewFactorConcentricCylinders(double ri, double ro);
+
+/// This subroutine is used to calculate the view factor from the outer to the inner surface of two concentric spheres. The view factor from the inner to the outer sphere is unity.
+/// @param ri Inner sphere radius (m).
+/// @param ro Outer sphere radius (m).
+double ViewFactorConcentricSpheres(double ri, double ro);
+
+/// This subroutine is used to calculate the view factor F_ji from F_ij using the reciprocity rule.
+/// @param Ai Area of surface i (m2).
+/// @param Fij View factor from surface i to surface j ([ ]).
+/// @param Aj Area of surface j (m2).
+double ViewFactorReciprocity(double Ai, double Fij, double Aj);
+
+/// This subroutine is used to calculate the sum of the view factors leaving a surface. This value should be unity for a closed enclosure.
+/// @param n Number of surfaces within the enclosure.
+/// @param F View factor matrix stored in row-major order (n x n).
+/// @param i Surface identifier.
+double ViewFactorSummation(int n, const double *F, int i);
+
+/// This subroutine is used to estimate the view factor matrix between planar surfaces of any orientation by Monte Carlo ray tracing. Rays are traced in fixed-size batches, each with an independent random number stream, so that the batches can be run in parallel and the result does not depend on the number of threads. Reciprocity is enforced on the final matrix. This function returns 0 on success, or 1 if the hit counts could not be allocated.
+/// @param n Number of surfaces within the enclosure.
+/// @param surfaces Array of surfaces within the enclosure (geometry only).
+/// @param rays Number of rays emitted from each surface.
+/// @param seed Seed for the random number streams.
+/// @param F View factor matrix stored in row-major order (n x n).
+int ViewFactorMonteCarlo(int n, const RadSurface *surfaces, long rays, unsigned long long seed, double *F);
+
+#endif /* _3dRadEnclosureViewFactor_h */
+
+#ifndef _3dRadEnclosureCalculation_h
+#define _3dRadEnclosureCalculation_h
+
+/// This subroutine is used to solve the radiosity network for an enclosure of grey, diffuse surfaces. Surfaces with a specified temperature have their net heat rate calculated and surfaces with a specified net heat rate have their temperature calculated. A dense LU factorisation is used for small enclosures and successive over-relaxation is used for large enclosures. This function returns 0 on success and 1 if the network could not be solved.
+/// @param n Number of surfaces within the enclosure.
+/// @param surfaces Array of surfaces within the enclosure.
+/// @param F View factor matrix stored in row-major order (n x n).
+int RadiosityNetwork(int n, RadSurface *surfaces, const double *F);
+
+#endif /* _3dRadEnclosureCalculation_h */
+
+#ifndef _3dRadEnclosureDisplay_h
+#define _3dRadEnclosureDisplay_h
+
+/// This subroutine is used to display the view factor matrix and the calculated surface parameters on the user console.
+/// @param n Number of surfaces within the enclosure.
+/// @param surfaces Array of surfaces within the enclosure.
+/// @param F View factor matrix stored in row-major order (n x n).
+void RadEnclosureDisplay(int n, RadSurface *surfaces, double *F);
+
+#endif /* _3dRadEnclosureDisplay_h */
+
+#ifndef _3dRadEnclosureWrite_h
+#define _3dRadEnclosureWrite_h
+
+/// This subroutine is used to write the view factor matrix and the calculated surface parameters to a .txt file.
+/// @param n Number of surfaces within the enclosure.
+/// @param surfaces Array of surfaces within the enclosure.
+/// @param F View factor matrix stored in row-major order (n x n).
+void RadEnclosureWrite(int n, RadSurface *surfaces, double *F);
+
+/// This subroutine is used to ask the user whether or not they would like to write the view factor matrix and calculated surface parameters to disk.
+/// @param n Number of surfaces within the enclosure.
+/// @param surfaces Array of surfaces within the enclosure.
+/// @param F View factor matrix stored in row-major order (n x n).
+void RadEnclosureWriteSwitch(int n, RadSurface *surfaces, double *F);
+
+#endif /* _3dRadEnclosureWrite_h */
@@ -17,4 +17,7 @@ void FluidHTCoefficient(void);
 /// This subroutine is used to guide the user through generating the graph for the black-body spectral radiance using Planck's distribution law.
 void RadWavelength(void);
 
+/// This subroutine is used to guide the user through calculating the net radiative heat exchange within an enclosure of grey surfaces using the radiosity network method.
+void RadEnclosure(void);
+
 #endif /* B48BD_T3_h */
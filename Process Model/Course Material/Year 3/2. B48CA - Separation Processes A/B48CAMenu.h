@@ -0,0 +1,35 @@
+//
+//  B48CAMenu.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef B48CATopComm_h
+#define B48CATopComm_h
+
+void B48CATopComm(void);
+
+#endif /* B48CATopComm_h */
+
+//  The following prototypes are used to declare topic menu functions for B48CA
+
+#ifndef B48CAtopic1_h
+#define B48CAtopic1_h
+
+void B48CAtopic1(void);
+
+#endif /* B48CAtopic1_h */
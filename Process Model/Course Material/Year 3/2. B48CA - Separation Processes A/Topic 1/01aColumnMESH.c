@@ -0,0 +1,819 @@
+//
+//  01aColumnMESH.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+/// MARK: HEADER DECLARATIONS
+//Standard Header Files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//Custom Header Files
+#include "LinearAlgebra.h"
+#include "01aAcentricFactor.h"
+#include "01aColumnMESH.h"
+
+/// MARK: SUBROUTINE DEFINITIONS
+#define R 8.3145
+#define Tref 298.15         // Reference temperature for enthalpies (K).
+#define mmHg 133.322        // Conversion (mmHg to Pa).
+#define hscale 10000.0      // Scale of the energy balance residuals (J/mol).
+
+typedef struct ColNSWork{
+    int N;                  // Number of stages.
+    int C;                  // Number of components.
+    int m;                  // Variables per stage (2C + 1).
+    double B;               // Bottoms flowrate (mol/s).
+    double Fs;              // Total feed flowrate (mol/s).
+    double *hF;             // Feed enthalpy on each stage (J/mol).
+    double *Tcache;         // Temperature at which the cached properties of each stage were calculated (K).
+    double *Kid;            // Cached ideal equilibrium ratios, Psat/P.
+    double *lam;            // Cached Wilson parameters.
+    double *gkey;           // Liquid flows and temperature at which the cached activity coefficients were calculated.
+    double *gamma;          // Cached activity coefficients.
+    double *x;              // Liquid mole fractions.
+    double *K;              // Equilibrium ratios.
+    double *Lt;             // Total liquid flow leaving each stage (mol/s).
+    double *Vt;             // Total vapour flow leaving each stage (mol/s).
+    double *h;              // Liquid enthalpy (J/mol).
+    double *H;              // Vapour enthalpy (J/mol).
+} ColNSWork;
+
+/// This subroutine is used to calculate the Wilson parameters, Lambda_ij = (V_j/V_i) exp(-a_ij/RT).
+static void ColWilsonLambda(const ColThermo *th, double T, double *lam)
+{
+    int n = th->ncomp;
+    
+    for(int i = 0; i < n; ++i)
+    {
+        for(int j = 0; j < n; ++j)
+        {
+            lam[i*n + j] = (i == j) ? 1.0 : th->comp[j].Vm/th->comp[i].Vm*exp(-th->a[i*n + j]/(R*T));
+        }
+    }
+}
+
+/// This subroutine is used to calculate the Wilson activity coefficients from precalculated parameters.
+static void ColWilsonGamma(int n, const double *lam, const double *x, double *gamma)
+{
+    double S[ColMaxComp];
+    
+    for(int i = 0; i < n; ++i)
+    {
+        S[i] = 0.0;
+        for(int j = 0; j < n; ++j)
+        {
+            S[i] += x[j]*lam[i*n + j];
+        }
+    }
+    for(int i = 0; i < n; ++i)
+    {
+        double sum = 0.0;
+        
+        for(int k = 0; k < n; ++k)
+        {
+            sum += x[k]*lam[k*n + i]/S[k];
+        }
+        gamma[i] = exp(1 - log(S[i]) - sum);
+    }
+}
+
+/// MARK: THERMODYNAMIC PROPERTIES
+void ColActivity(const ColThermo *th, double T, const double *x, double *gamma)
+{
+    double lam[ColMaxComp*ColMaxComp];
+    
+    if(th->model != ColWilson)
+    {
+        for(int i = 0; i < th->ncomp; ++i)
+        {
+            gamma[i] = 1.0;
+        }
+        return;
+    }
+    ColWilsonLambda(th, T, lam);
+    ColWilsonGamma(th->ncomp, lam, x, gamma);
+}
+
+void ColKValues(const ColThermo *th, double T, double P, const double *x, double *K)
+{
+    double gamma[ColMaxComp];
+    
+    ColActivity(th, T, x, gamma);
+    for(int i = 0; i < th->ncomp; ++i)
+    {
+        const ColComponent *c = &th->comp[i];
+        
+        K[i] = gamma[i]*AntoineEquation(c->ANTA, c->ANTB, c->ANTC, T - 273.15)*mmHg/P;
+    }
+}
+
+double ColLiquidEnthalpy(const ColThermo *th, double T, const double *x)
+{
+    double h = 0.0;
+    
+    for(int i = 0; i < th->ncomp; ++i)
+    {
+        h += x[i]*th->comp[i].cpL*(T - Tref);
+    }
+    
+    return h;
+}
+
+double ColVapourEnthalpy(const ColThermo *th, double T, const double *y)
+{
+    double H = 0.0;
+    
+    for(int i = 0; i < th->ncomp; ++i)
+    {
+        H += y[i]*(th->comp[i].dHvap + th->comp[i].cpV*(T - Tref));
+    }
+    
+    return H;
+}
+
+double ColBubblePoint(const ColThermo *th, double P, const double *x, double Tguess, double *K)
+{
+    double T = Tguess;
+    double K2[ColMaxComp];
+    
+    for(int it = 0; it < 50; ++it)
+    {
+        double sum = 0.0;
+        double sum2 = 0.0;
+        double f = 0.0;
+        double df = 0.0;
+        double step = 0.0;
+        
+        ColKValues(th, T, P, x, K);
+        ColKValues(th, T + 0.01, P, x, K2);
+        for(int i = 0; i < th->ncomp; ++i)
+        {
+            sum += K[i]*x[i];
+            sum2 += K2[i]*x[i];
+        }
+        f = log(sum);
+        if(fabs(f) < 1e-10)
+        {
+            break;
+        }
+        df = (log(sum2) - f)/0.01;
+        step = (df > 0) ? -f/df : -10*f;
+        step = fmin(fmax(step, -25.0), 25.0);
+        T = fmax(T + step, 50.0);
+    }
+    ColKValues(th, T, P, x, K);
+    
+    return T;
+}
+
+double ColFeedEnthalpy(const ColThermo *th, double P, const double *z, double q)
+{
+    double K[ColMaxComp];
+    double Tb = 0.0;
+    double hL = 0.0;
+    double HV = 0.0;
+    
+    Tb = ColBubblePoint(th, P, z, 350.0, K);
+    hL = ColLiquidEnthalpy(th, Tb, z);
+    HV = ColVapourEnthalpy(th, Tb, z);
+    
+    return hL + (1 - q)*(HV - hL);
+}
+
+/// MARK: COLUMN PROFILES
+void ColProfileAlloc(ColProfile *prof, int nstages, int ncomp)
+{
+    memset(prof, 0, sizeof(ColProfile));
+    prof->nstages = nstages;
+    prof->ncomp = ncomp;
+    prof->T = calloc(nstages, sizeof(double));
+    prof->L = calloc(nstages, sizeof(double));
+    prof->V = calloc(nstages, sizeof(double));
+    prof->x = calloc((size_t)nstages*ncomp, sizeof(double));
+    prof->y = calloc((size_t)nstages*ncomp, sizeof(double));
+}
+
+void ColProfileFree(ColProfile *prof)
+{
+    free(prof->T);
+    free(prof->L);
+    free(prof->V);
+    free(prof->x);
+    free(prof->y);
+    memset(prof, 0, sizeof(ColProfile));
+}
+
+/// This subroutine is used to calculate the condenser and reboiler duties from the condenser and overall energy balances.
+static void ColDuties(const ColThermo *th, const ColSpec *spec, const double *hF, ColProfile *prof)
+{
+    int N = spec->nstages;
+    int C = th->ncomp;
+    double h0 = ColLiquidEnthalpy(th, prof->T[0], &prof->x[0]);
+    double H1 = ColVapourEnthalpy(th, prof->T[1], &prof->y[C]);
+    double hN = ColLiquidEnthalpy(th, prof->T[N - 1], &prof->x[(size_t)(N - 1)*C]);
+    double feed = 0.0;
+    
+    for(int j = 0; j < N; ++j)
+    {
+        feed += spec->F[j]*hF[j];
+    }
+    prof->Qc = (prof->L[0] + spec->D)*h0 - prof->V[1]*H1;
+    prof->Qr = spec->D*h0 + prof->L[N - 1]*hN - feed - prof->Qc;
+}
+
+/// This subroutine is used to calculate the feed enthalpy on each stage.
+static void ColFeedEnthalpies(const ColThermo *th, const ColSpec *spec, double *hF)
+{
+    for(int j = 0; j < spec->nstages; ++j)
+    {
+        hF[j] = 0.0;
+        if(spec->F[j] > 0)
+        {
+            hF[j] = ColFeedEnthalpy(th, spec->P + j*spec->dP, &spec->z[(size_t)j*th->ncomp], spec->q[j]);
+        }
+    }
+}
+
+/// MARK: BUBBLE-POINT METHOD
+/// This subroutine is used to solve a tridiagonal system a_j x_(j-1) + b_j x_j + c_j x_(j+1) = d_j by the Thomas algorithm. The coefficient arrays are overwritten and the solution is returned in d.
+static void ColThomas(int n, const double *a, double *b, const double *c, double *d)
+{
+    for(int j = 1; j < n; ++j)
+    {
+        double w = a[j]/b[j - 1];
+        
+        b[j] -= w*c[j - 1];
+        d[j] -= w*d[j - 1];
+    }
+    d[n - 1] /= b[n - 1];
+    for(int j = n - 2; j >= 0; --j)
+    {
+        d[j] = (d[j] - c[j]*d[j + 1])/b[j];
+    }
+}
+
+/// This subroutine is used to correct the liquid compositions from the component balances by the theta method of Holland. Component distillate flows, d_i = F z_i/(1 + theta b_i/d_i), are found for the theta that gives the specified distillate flowrate, and each component profile is scaled by its correction.
+static void ColThetaCorrection(int C, int N, double D, double B, const double *fz, double *x)
+{
+    double ratio[ColMaxComp];
+    double lo = -50.0;
+    double hi = 50.0;
+    double theta = 1.0;
+    
+    for(int i = 0; i < C; ++i)
+    {
+        double d = D*x[i];
+        double b = B*x[(size_t)(N - 1)*C + i];
+        
+        ratio[i] = (d > 0) ? b/d : 1e300;
+    }
+    
+    //  Bisection on ln(theta); the corrected distillate flowrate falls as theta rises.
+    for(int it = 0; it < 100; ++it)
+    {
+        double sum = 0.0;
+        
+        theta = exp(0.5*(lo + hi));
+        for(int i = 0; i < C; ++i)
+        {
+            sum += fz[i]/(1 + theta*ratio[i]);
+        }
+        if(sum > D)
+        {
+            lo = log(theta);
+        }else{
+            hi = log(theta);
+        }
+    }
+    for(int i = 0; i < C; ++i)
+    {
+        double dca = D*x[i];
+        double dco = fz[i]/(1 + theta*ratio[i]);
+        double scale = (dca > 0) ? dco/dca : 0.0;
+        
+        for(int j = 0; j < N; ++j)
+        {
+            x[(size_t)j*C + i] *= scale;
+        }
+    }
+}
+
+int ColBubblePointSolve(const ColThermo *th, const ColSpec *spec, const ColOptions *opt, ColProfile *prof)
+{
+    int N = spec->nstages;
+    int C = th->ncomp;
+    double *a = malloc(N*sizeof(double));
+    double *b = malloc(N*sizeof(double));
+    double *c = malloc(N*sizeof(double));
+    double *d = malloc(N*sizeof(double));
+    double *K = malloc((size_t)N*C*sizeof(double));
+    double *hF = malloc(N*sizeof(double));
+    double *h = malloc(N*sizeof(double));
+    double *H = malloc(N*sizeof(double));
+    double *S = malloc(N*sizeof(double));   // Cumulative feed down to each stage (mol/s).
+    double fz[ColMaxComp];                  // Total feed of each component (mol/s).
+    
+    ColFeedEnthalpies(th, spec, hF);
+    memset(fz, 0, sizeof(fz));
+    for(int j = 0; j < N; ++j)
+    {
+        S[j] = spec->F[j] + ((j > 0) ? S[j - 1] : 0.0);
+        for(int i = 0; i < C; ++i)
+        {
+            fz[i] += spec->F[j]*spec->z[(size_t)j*C + i];
+        }
+    }
+    
+    prof->status = -1;
+    for(prof->iter = 1; prof->iter <= opt->maxiter; ++prof->iter)
+    {
+        double dTmax = 0.0;
+        
+        //  Equilibrium ratios and liquid flows from the total material balances
+        for(int j = 0; j < N; ++j)
+        {
+            ColKValues(th, prof->T[j], spec->P + j*spec->dP, &prof->x[(size_t)j*C], &K[(size_t)j*C]);
+            prof->L[j] = ((j < N - 1) ? prof->V[j + 1] : 0.0) + S[j] - spec->D;
+        }
+        
+        //  Component balances, one tridiagonal system per component
+        for(int i = 0; i < C; ++i)
+        {
+            for(int j = 0; j < N; ++j)
+            {
+                a[j] = (j > 0) ? prof->L[j - 1] : 0.0;
+                b[j] = -(prof->L[j] + ((j == 0) ? spec->D : 0.0) + prof->V[j]*K[(size_t)j*C + i]);
+                c[j] = (j < N - 1) ? prof->V[j + 1]*K[(size_t)(j + 1)*C + i] : 0.0;
+                d[j] = -spec->F[j]*spec->z[(size_t)j*C + i];
+            }
+            ColThomas(N, a, b, c, d);
+            for(int j = 0; j < N; ++j)
+            {
+                prof->x[(size_t)j*C + i] = fmax(d[j], 0.0);
+            }
+        }
+        
+        //  Theta method: the calculated distillate flows are corrected by a single factor so that the distillate flowrate is met exactly.
+        ColThetaCorrection(C, N, spec->D, S[N - 1] - spec->D, fz, prof->x);
+        
+        //  New temperatures from the bubble points of the normalised liquid
+        for(int j = 0; j < N; ++j)
+        {
+            double *x = &prof->x[(size_t)j*C];
+            double *y = &prof->y[(size_t)j*C];
+            double sum = 0.0;
+            double Tnew = 0.0;
+            
+            for(int i = 0; i < C; ++i)
+            {
+                sum += x[i];
+            }
+            for(int i = 0; i < C; ++i)
+            {
+                x[i] = (sum > 0) ? x[i]/sum : 1.0/C;
+            }
+            Tnew = ColBubblePoint(th, spec->P + j*spec->dP, x, prof->T[j], &K[(size_t)j*C]);
+            dTmax = fmax(dTmax, fabs(Tnew - prof->T[j]));
+            prof->T[j] = Tnew;
+            
+            sum = 0.0;
+            for(int i = 0; i < C; ++i)
+            {
+                y[i] = K[(size_t)j*C + i]*x[i];
+                sum += y[i];
+            }
+            for(int i = 0; i < C; ++i)
+            {
+                y[i] = (y[i])/sum;
+            }
+            h[j] = ColLiquidEnthalpy(th, prof->T[j], x);
+            H[j] = ColVapourEnthalpy(th, prof->T[j], y);
+        }
+        
+        //  Vapour flows from the energy balances, stepping down from the condenser
+        prof->V[0] = 0.0;
+        prof->V[1] = (spec->reflux + 1)*spec->D;
+        for(int j = 1; j < N - 1; ++j)
+        {
+            double rhs = (S[j] - spec->D)*h[j] - (S[j - 1] - spec->D)*h[j - 1] - spec->F[j]*hF[j];
+            
+            prof->V[j + 1] = (rhs - prof->V[j]*(h[j - 1] - H[j]))/(H[j + 1] - h[j]);
+            prof->V[j + 1] = fmax(prof->V[j + 1], 1e-9*S[N - 1]);
+        }
+        
+        prof->err = dTmax;
+        if(prof->iter > 1 && dTmax < opt->tol)
+        {
+            prof->status = 0;
+            break;
+        }
+    }
+    if(prof->iter > opt->maxiter)
+    {
+        prof->iter = opt->maxiter;
+    }
+    for(int j = 0; j < N; ++j)
+    {
+        prof->L[j] = ((j < N - 1) ? prof->V[j + 1] : 0.0) + S[j] - spec->D;
+    }
+    ColDuties(th, spec, hF, prof);
+    
+    free(a);
+    free(b);
+    free(c);
+    free(d);
+    free(K);
+    free(hF);
+    free(h);
+    free(H);
+    free(S);
+    
+    return prof->status;
+}
+
+/// MARK: NAPHTALI-SANDHOLM METHOD
+/// This subroutine is used to calculate the total flows, mole fractions, equilibrium ratios and enthalpies of a stage from its variables, [v_1 ... v_C, T, l_1 ... l_C].
+static void ColNSStage(const ColThermo *th, const ColSpec *spec, ColNSWork *w, const double *u, int j)
+{
+    int C = w->C;
+    const double *v = &u[(size_t)j*w->m];
+    double T = v[C];
+    const double *l = &v[C + 1];
+    double *x = &w->x[(size_t)j*C];
+    double *K = &w->K[(size_t)j*C];
+    double *Kid = &w->Kid[(size_t)j*C];
+    double *lam = &w->lam[(size_t)j*C*C];
+    double *gkey = &w->gkey[(size_t)j*(C + 1)];
+    double *gamma = &w->gamma[(size_t)j*C];
+    double y[ColMaxComp];
+    double L = 0.0;
+    double V = 0.0;
+    double sum = 0.0;
+    
+    for(int i = 0; i < C; ++i)
+    {
+        L += l[i];
+        V += v[i];
+    }
+    for(int i = 0; i < C; ++i)
+    {
+        x[i] = (L > 0) ? l[i]/L : 1.0/C;
+    }
+    
+    //  Vapour pressures and Wilson parameters only depend on temperature, so they are reused while the stage temperature is unchanged. Most Jacobian columns perturb a flow rather than a temperature.
+    if(T != w->Tcache[j])
+    {
+        for(int i = 0; i < C; ++i)
+        {
+            const ColComponent *c = &th->comp[i];
+            
+            Kid[i] = AntoineEquation(c->ANTA, c->ANTB, c->ANTC, T - 273.15)*mmHg/(spec->P + j*spec->dP);
+        }
+        if(th->model == ColWilson)
+        {
+            ColWilsonLambda(th, T, lam);
+        }
+        w->Tcache[j] = T;
+    }
+    
+    //  Activity coefficients are unchanged when only the vapour flows are perturbed.
+    if(th->model == ColWilson && (gkey[C] != T || memcmp(gkey, l, C*sizeof(double)) != 0))
+    {
+        ColWilsonGamma(C, lam, x, gamma);
+        memcpy(gkey, l, C*sizeof(double));
+        gkey[C] = T;
+    }
+    for(int i = 0; i < C; ++i)
+    {
+        K[i] = gamma[i]*Kid[i];
+    }
+    
+    //  Vapour composition; the total condenser has no vapour product, so its equilibrium vapour is used.
+    for(int i = 0; i < C; ++i)
+    {
+        y[i] = (V > 0) ? v[i] : K[i]*x[i];
+        sum += y[i];
+    }
+    for(int i = 0; i < C; ++i)
+    {
+        y[i] = (sum > 0) ? y[i]/sum : 1.0/C;
+    }
+    w->Lt[j] = L;
+    w->Vt[j] = V;
+    w->h[j] = ColLiquidEnthalpy(th, T, x);
+    w->H[j] = ColVapourEnthalpy(th, T, y);
+}
+
+/// This subroutine is used to calculate the residuals of a stage, [M_1 ... M_C, H, E_1 ... E_C], from the stage properties held in the work arrays. The condenser energy balance is replaced by its bubble point and the reboiler energy balance by the bottoms flowrate.
+static void ColNSRows(const ColSpec *spec, const ColNSWork *w, const double *u, int j, double *f)
+{
+    int C = w->C;
+    int m = w->m;
+    int N = w->N;
+    const double *v = &u[(size_t)j*m];
+    const double *l = &v[C + 1];
+    const double *K = &w->K[(size_t)j*C];
+    const double *x = &w->x[(size_t)j*C];
+    double s = (j == 0) ? 1/spec->reflux : 0.0;     // Liquid side draw ratio; the distillate is drawn from the condenser.
+    
+    for(int i = 0; i < C; ++i)
+    {
+        f[i] = l[i]*(1 + s) + v[i] - spec->F[j]*spec->z[(size_t)j*C + i];
+        if(j > 0)
+        {
+            f[i] -= u[(size_t)(j - 1)*m + C + 1 + i];
+        }
+        if(j < N - 1)
+        {
+            f[i] -= u[(size_t)(j + 1)*m + i];
+        }
+        f[C + 1 + i] = (j == 0) ? v[i] : K[i]*l[i]*w->Vt[j]/w->Lt[j] - v[i];
+    }
+    if(j == 0)
+    {
+        double sum = 0.0;
+        
+        for(int i = 0; i < C; ++i)
+        {
+            sum += K[i]*x[i];
+        }
+        f[C] = sum - 1;
+    }else if(j == N - 1){
+        f[C] = (w->Lt[j] - w->B)/w->Fs;
+    }else{
+        f[C] = w->h[j]*w->Lt[j] + w->H[j]*w->Vt[j] - w->h[j - 1]*w->Lt[j - 1] - w->H[j + 1]*w->Vt[j + 1] - w->hF[j]*spec->F[j];
+        f[C] = (f[C])/(hscale*w->Fs);
+    }
+}
+
+/// This subroutine is used to calculate every residual. This function returns the scaled 2-norm of the residuals.
+static double ColNSResidual(const ColThermo *th, const ColSpec *spec, ColNSWork *w, const double *u, double *f)
+{
+    double norm = 0.0;
+    
+    for(int j = 0; j < w->N; ++j)
+    {
+        ColNSStage(th, spec, w, u, j);
+    }
+    for(int j = 0; j < w->N; ++j)
+    {
+        ColNSRows(spec, w, u, j, &f[(size_t)j*w->m]);
+    }
+    for(int j = 0; j < w->N; ++j)
+    {
+        for(int k = 0; k < w->m; ++k)
+        {
+            double r = f[(size_t)j*w->m + k];
+            
+            r = (k == w->C) ? r : r/w->Fs;
+            norm += r*r;
+        }
+    }
+    
+    return sqrt(norm);
+}
+
+int ColNaphtaliSandholmSolve(const ColThermo *th, const ColSpec *spec, const ColOptions *opt, ColProfile *prof)
+{
+    ColNSWork w;
+    ColOptions init = {ColBubblePointMethod, 0.0, 1};
+    int N = spec->nstages;
+    int C = th->ncomp;
+    int m = 2*C + 1;
+    size_t n = (size_t)N*m;
+    size_t mm = (size_t)m*m;
+    double *u = malloc(n*sizeof(double));
+    double *unew = malloc(n*sizeof(double));
+    double *f = malloc(n*sizeof(double));
+    double *ftrial = malloc(n*sizeof(double));
+    double *fp = malloc(m*sizeof(double));
+    double *delta = malloc(N*sizeof(double));
+    double *dx = malloc(n*sizeof(double));
+    double *A = calloc(N*mm, sizeof(double));
+    double *B = calloc(N*mm, sizeof(double));
+    double *Cb = calloc(N*mm, sizeof(double));
+    double norm = 0.0;
+    
+    //  Work arrays
+    w.N = N;
+    w.C = C;
+    w.m = m;
+    w.Fs = 0.0;
+    for(int j = 0; j < N; ++j)
+    {
+        w.Fs += spec->F[j];
+    }
+    w.B = w.Fs - spec->D;
+    w.hF = malloc(N*sizeof(double));
+    w.Tcache = malloc(N*sizeof(double));
+    w.Kid = malloc((size_t)N*C*sizeof(double));
+    w.lam = malloc((size_t)N*C*C*sizeof(double));
+    w.gkey = malloc((size_t)N*(C + 1)*sizeof(double));
+    w.gamma = malloc((size_t)N*C*sizeof(double));
+    w.x = malloc((size_t)N*C*sizeof(double));
+    w.K = malloc((size_t)N*C*sizeof(double));
+    w.Lt = malloc(N*sizeof(double));
+    w.Vt = malloc(N*sizeof(double));
+    w.h = malloc(N*sizeof(double));
+    w.H = malloc(N*sizeof(double));
+    for(int j = 0; j < N; ++j)
+    {
+        w.Tcache[j] = -1.0;
+        w.gkey[(size_t)j*(C + 1) + C] = -1.0;
+        for(int i = 0; i < C; ++i)
+        {
+            w.gamma[(size_t)j*C + i] = 1.0;
+        }
+    }
+    ColFeedEnthalpies(th, spec, w.hF);
+    
+    //  Newton's method needs trace component flows of the right order of magnitude, so the estimate is first passed through one bubble-point iteration, which solves the component balances exactly.
+    ColBubblePointSolve(th, spec, &init, prof);
+    
+    //  Initial component flows from the profile
+    for(int j = 0; j < N; ++j)
+    {
+        double *v = &u[(size_t)j*m];
+        
+        for(int i = 0; i < C; ++i)
+        {
+            v[i] = (j == 0) ? 0.0 : prof->y[(size_t)j*C + i]*prof->V[j];
+            v[C + 1 + i] = prof->x[(size_t)j*C + i]*prof->L[j];
+        }
+        v[C] = prof->T[j];
+    }
+    
+    prof->status = -1;
+    norm = ColNSResidual(th, spec, &w, u, f);
+    for(prof->iter = 1; prof->iter <= opt->maxiter; ++prof->iter)
+    {
+        double t = 1.0;
+        double trial = 0.0;
+        
+        //  Jacobian by finite differences. Stages three apart share no equations, so a third of the stages are perturbed together.
+        memset(A, 0, N*mm*sizeof(double));
+        memset(B, 0, N*mm*sizeof(double));
+        memset(Cb, 0, N*mm*sizeof(double));
+        for(int colour = 0; colour < 3; ++colour)
+        {
+            for(int k = 0; k < m; ++k)
+            {
+                for(int j = colour; j < N; j += 3)
+                {
+                    double *uk = &u[(size_t)j*m + k];
+                    double base = (k == C) ? 1.0 : 1e-6*w.Fs;
+                    
+                    delta[j] = 1e-7*fmax(fabs(*uk), base);
+                    dx[(size_t)j*m + k] = *uk;  // The unperturbed value is held in the step array until it is restored.
+                    *uk += delta[j];
+                    ColNSStage(th, spec, &w, u, j);
+                }
+                for(int j = colour; j < N; j += 3)
+                {
+                    for(int r = j - 1; r <= j + 1; ++r)
+                    {
+                        double *block = NULL;
+                        
+                        if(r < 0 || r >= N)
+                        {
+                            continue;
+                        }
+                        block = (r == j) ? &B[j*mm] : ((r == j + 1) ? &A[r*mm] : &Cb[r*mm]);
+                        ColNSRows(spec, &w, u, r, fp);
+                        for(int row = 0; row < m; ++row)
+                        {
+                            block[row*m + k] = (fp[row] - f[(size_t)r*m + row])/delta[j];
+                        }
+                    }
+                }
+                for(int j = colour; j < N; j += 3)
+                {
+                    u[(size_t)j*m + k] = dx[(size_t)j*m + k];
+                    ColNSStage(th, spec, &w, u, j);
+                }
+            }
+        }
+        
+        //  Newton step
+        for(size_t k = 0; k < n; ++k)
+        {
+            dx[k] = -f[k];
+        }
+        if(BlockTridiagonalSolve(N, m, A, B, Cb, dx) != 0)
+        {
+            break;
+        }
+        
+        //  Temperature changes are limited to 10 K on each stage, and flows that would become negative are reduced geometrically instead.
+        for(int ls = 0; ls < 6; ++ls)
+        {
+            for(size_t k = 0; k < n; ++k)
+            {
+                int var = (int)(k % m);
+                double step = t*dx[k];
+                
+                if(var == C)
+                {
+                    unew[k] = u[k] + fmin(fmax(step, -10.0*t), 10.0*t);
+                }else if(u[k] + step > 0)
+                {
+                    unew[k] = u[k] + step;
+                }else{
+                    unew[k] = (u[k] > 0) ? u[k]*exp(step/u[k]) : 0.0;
+                }
+            }
+            trial = ColNSResidual(th, spec, &w, unew, ftrial);
+            if(trial < norm || ls == 5)
+            {
+                break;
+            }
+            t = 0.5*t;
+        }
+        memcpy(u, unew, n*sizeof(double));
+        memcpy(f, ftrial, n*sizeof(double));
+        norm = trial;
+        
+        prof->err = 0.0;
+        for(size_t k = 0; k < n; ++k)
+        {
+            double r = ((int)(k % m) == C) ? fabs(f[k]) : fabs(f[k])/w.Fs;
+            
+            prof->err = fmax(prof->err, r);
+        }
+        if(prof->err < opt->tol)
+        {
+            prof->status = 0;
+            break;
+        }
+    }
+    if(prof->iter > opt->maxiter)
+    {
+        prof->iter = opt->maxiter;
+    }
+    
+    //  Profile from the final component flows
+    ColNSResidual(th, spec, &w, u, f);
+    for(int j = 0; j < N; ++j)
+    {
+        const double *v = &u[(size_t)j*m];
+        double sum = 0.0;
+        
+        prof->T[j] = v[C];
+        prof->L[j] = w.Lt[j];
+        prof->V[j] = w.Vt[j];
+        for(int i = 0; i < C; ++i)
+        {
+            prof->x[(size_t)j*C + i] = w.x[(size_t)j*C + i];
+            prof->y[(size_t)j*C + i] = (j == 0) ? w.K[i]*w.x[i] : v[i];
+            sum += prof->y[(size_t)j*C + i];
+        }
+        for(int i = 0; i < C; ++i)
+        {
+            prof->y[(size_t)j*C + i] /= sum;
+        }
+    }
+    ColDuties(th, spec, w.hF, prof);
+    
+    free(u);
+    free(unew);
+    free(f);
+    free(ftrial);
+    free(fp);
+    free(delta);
+    free(dx);
+    free(A);
+    free(B);
+    free(Cb);
+    free(w.hF);
+    free(w.Tcache);
+    free(w.Kid);
+    free(w.lam);
+    free(w.gkey);
+    free(w.gamma);
+    free(w.x);
+    free(w.K);
+    free(w.Lt);
+    free(w.Vt);
+    free(w.h);
+    free(w.H);
+    
+    return prof->status;
+}
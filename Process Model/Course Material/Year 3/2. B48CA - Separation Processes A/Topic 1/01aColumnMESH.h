@@ -0,0 +1,158 @@
+//
+//  01aColumnMESH.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef ColumnMESHStruct_h
+#define ColumnMESHStruct_h
+
+#define ColMaxComp 32           // Largest number of components in a column.
+
+#define ColIdeal 1              // Raoult's law.
+#define ColWilson 2             // Modified Raoult's law with Wilson activity coefficients.
+
+#define ColBubblePointMethod 1  // Wang-Henke bubble-point method with the Thomas algorithm.
+#define ColNaphtaliSandholm 2   // Simultaneous correction of all MESH equations by Newton's method.
+
+typedef struct ColComponent{
+    char name[16];              // Component name.
+    double ANTA;                // Antoine equation constant A (mmHg).
+    double ANTB;                // Antoine equation constant B (deg C.mmHg).
+    double ANTC;                // Antoine equation constant C (deg C).
+    double cpL;                 // Liquid molar heat capacity (J/mol.K).
+    double cpV;                 // Vapour molar heat capacity (J/mol.K).
+    double dHvap;               // Enthalpy of vaporisation at 25 deg C (J/mol).
+    double Vm;                  // Liquid molar volume (m3/mol).
+} ColComponent;
+
+typedef struct ColThermo{
+    int ncomp;                  // Number of components.
+    int model;                  // Liquid phase model (ColIdeal or ColWilson).
+    ColComponent comp[ColMaxComp];  // Component properties.
+    double a[ColMaxComp*ColMaxComp];// Wilson interaction energies a_ij (J/mol), row-major.
+} ColThermo;
+
+typedef struct ColSpec{
+    int nstages;                // Number of equilibrium stages, counting the total condenser as stage 1 and the partial reboiler as the last stage.
+    double P;                   // Condenser pressure (Pa).
+    double dP;                  // Pressure drop per stage (Pa).
+    double reflux;              // Reflux ratio ([ ]).
+    double D;                   // Distillate flowrate (mol/s).
+    double *F;                  // Feed flowrate entering each stage (mol/s).
+    double *z;                  // Feed mole fractions on each stage (nstages x ncomp).
+    double *q;                  // Feed thermal condition on each stage ([ ]). Saturated liquid is 1, saturated vapour is 0.
+} ColSpec;
+
+typedef struct ColProfile{
+    int nstages;                // Number of stages.
+    int ncomp;                  // Number of components.
+    double *T;                  // Stage temperature (K).
+    double *L;                  // Liquid leaving each stage (mol/s). The reflux leaves the condenser.
+    double *V;                  // Vapour leaving each stage (mol/s).
+    double *x;                  // Liquid mole fractions (nstages x ncomp).
+    double *y;                  // Vapour mole fractions (nstages x ncomp).
+    double Qc;                  // Condenser duty (W).
+    double Qr;                  // Reboiler duty (W).
+    int iter;                   // Iterations taken.
+    double err;                 // Final convergence measure.
+    int status;                 // Converged (0) or iteration limit reached (-1).
+} ColProfile;
+
+typedef struct ColOptions{
+    int method;                 // Solution method (ColBubblePointMethod or ColNaphtaliSandholm).
+    double tol;                 // Convergence tolerance.
+    int maxiter;                // Largest number of iterations.
+} ColOptions;
+
+#endif /* ColumnMESHStruct_h */
+
+#ifndef ColumnMESHThermo_h
+#define ColumnMESHThermo_h
+
+/// This subroutine is used to calculate the liquid phase activity coefficients.
+/// @param th Component properties and liquid phase model.
+/// @param T Temperature (K).
+/// @param x Liquid mole fractions ([ ]).
+/// @param gamma Array where the activity coefficients should be stored.
+void ColActivity(const ColThermo *th, double T, const double *x, double *gamma);
+
+/// This subroutine is used to calculate the vapour-liquid equilibrium ratios, K = gamma Psat/P, with the vapour pressures from "AntoineEquation(...)".
+/// @param th Component properties and liquid phase model.
+/// @param T Temperature (K).
+/// @param P Pressure (Pa).
+/// @param x Liquid mole fractions ([ ]).
+/// @param K Array where the equilibrium ratios should be stored.
+void ColKValues(const ColThermo *th, double T, double P, const double *x, double *K);
+
+/// This subroutine is used to calculate the molar enthalpy of a liquid relative to liquid at 25 deg C (J/mol).
+/// @param th Component properties.
+/// @param T Temperature (K).
+/// @param x Liquid mole fractions ([ ]).
+double ColLiquidEnthalpy(const ColThermo *th, double T, const double *x);
+
+/// This subroutine is used to calculate the molar enthalpy of a vapour relative to liquid at 25 deg C (J/mol).
+/// @param th Component properties.
+/// @param T Temperature (K).
+/// @param y Vapour mole fractions ([ ]).
+double ColVapourEnthalpy(const ColThermo *th, double T, const double *y);
+
+/// This subroutine is used to calculate the bubble point temperature by Newton's method on ln(sum K x). This function returns the bubble point temperature (K).
+/// @param th Component properties and liquid phase model.
+/// @param P Pressure (Pa).
+/// @param x Liquid mole fractions ([ ]).
+/// @param Tguess Initial estimate of the temperature (K).
+/// @param K Array where the equilibrium ratios at the bubble point should be stored.
+double ColBubblePoint(const ColThermo *th, double P, const double *x, double Tguess, double *K);
+
+/// This subroutine is used to calculate the molar enthalpy of a feed from its thermal condition, q = (H_V - h_F)/(H_V - h_L), using the bubble point liquid and the heat of vaporisation of the mixture (J/mol).
+/// @param th Component properties and liquid phase model.
+/// @param P Pressure (Pa).
+/// @param z Feed mole fractions ([ ]).
+/// @param q Feed thermal condition ([ ]).
+double ColFeedEnthalpy(const ColThermo *th, double P, const double *z, double q);
+
+#endif /* ColumnMESHThermo_h */
+
+#ifndef ColumnMESHSolve_h
+#define ColumnMESHSolve_h
+
+/// This subroutine is used to allocate the arrays of a column profile. Arrays are released by "ColProfileFree(...)".
+/// @param prof Struct where the profile should be stored.
+/// @param nstages Number of stages.
+/// @param ncomp Number of components.
+void ColProfileAlloc(ColProfile *prof, int nstages, int ncomp);
+
+/// This subroutine is used to release the arrays of a column profile.
+/// @param prof Column profile.
+void ColProfileFree(ColProfile *prof);
+
+/// This subroutine is used to solve the MESH equations by the bubble-point method, which suits ideal and nearly ideal mixtures. Each iteration solves the tridiagonal component balances with the Thomas algorithm, corrects them with the theta method, finds new temperatures from bubble points and new vapour flows from the energy balances. Converges when the largest temperature change falls below the tolerance (K). This function returns the final status.
+/// @param th Component properties and liquid phase model.
+/// @param spec Column specification.
+/// @param opt Convergence settings.
+/// @param prof Initial profile. Overwritten with the solution.
+int ColBubblePointSolve(const ColThermo *th, const ColSpec *spec, const ColOptions *opt, ColProfile *prof);
+
+/// This subroutine is used to solve the MESH equations by the Naphtali-Sandholm method, which also suits strongly non-ideal mixtures. The component flows and temperature of every stage are corrected together by Newton's method; the Jacobian is block tridiagonal and is built by finite differences on every third stage at once and solved with "BlockTridiagonalSolve(...)". Steps are limited to 10 K per stage and halved until the residuals fall. Converges when the largest scaled residual falls below the tolerance. This function returns the final status.
+/// @param th Component properties and liquid phase model.
+/// @param spec Column specification.
+/// @param opt Convergence settings.
+/// @param prof Initial profile. Overwritten with the solution.
+int ColNaphtaliSandholmSolve(const ColThermo *th, const ColSpec *spec, const ColOptions *opt, ColProfile *prof);
+
+#endif /* ColumnMESHSolve_h */
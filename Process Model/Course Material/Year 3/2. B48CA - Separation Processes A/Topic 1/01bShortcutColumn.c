@@ -0,0 +1,551 @@
+//
+//  01bShortcutColumn.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+/// MARK: HEADER DECLARATIONS
+//Standard Header Files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//Custom Header Files
+#include "System.h"
+#include "ResultWriter.h"
+#include "01aColumnMESH.h"
+#include "B48CA_T1.h"
+#include "01bShortcutColumn.h"
+
+/// MARK: SUBROUTINE DEFINITIONS
+#define maxstrlen 128
+
+/// MARK: VARIABLE INPUT
+void ColThermoVariable(ColThermo *th, int rigorous)
+{
+    char input[maxstrlen];
+    char prompt[maxstrlen];
+    int control = 0;
+    
+    memset(th, 0, sizeof(ColThermo));
+    th->ncomp = (int)inputDouble(0, 0, "number of components", "");
+    th->ncomp = (th->ncomp > ColMaxComp) ? ColMaxComp : th->ncomp;
+    
+    th->model = ColIdeal;
+    control = rigorous;
+    while(control == 1)
+    {
+        printf("Liquid phase: ideal (1) or Wilson (2)? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+                th->model = ColIdeal;
+                control = 0;
+                break;
+            case '2':
+                th->model = ColWilson;
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+    
+    for(int i = 0; i < th->ncomp; ++i)
+    {
+        ColComponent *c = &th->comp[i];
+        
+        printf("Component %i name: ", i + 1);
+        fgets(input, sizeof(input), stdin);
+        input[strcspn(input, "\r\n")] = '\0';
+        snprintf(c->name, sizeof(c->name), "%.*s", (int)sizeof(c->name) - 1, input);
+        
+        c->ANTA = inputDouble(0, 1, "Antoine constant A", "mmHg");
+        c->ANTB = inputDouble(0, 1, "Antoine constant B", "deg C.mmHg");
+        c->ANTC = inputDouble(1, 1, "Antoine constant C", "deg C");
+        if(rigorous)
+        {
+            c->cpL = inputDouble(0, 0, "liquid heat capacity", "J/mol.K");
+            c->cpV = inputDouble(0, 0, "vapour heat capacity", "J/mol.K");
+            
+            c->dHvap = inputDouble(0, 0, "heat of vaporisation at 25 deg C", "kJ/mol");
+            c->dHvap = (c->dHvap)*1000; // Conversion (kJ/mol to J/mol)
+            
+            if(th->model == ColWilson)
+            {
+                c->Vm = inputDouble(0, 0, "liquid molar volume", "cm3/mol");
+                c->Vm = (c->Vm)*0.000001; // Conversion (cm3/mol to m3/mol)
+            }
+        }
+    }
+    
+    if(th->model == ColWilson)
+    {
+        for(int i = 0; i < th->ncomp; ++i)
+        {
+            for(int j = 0; j < th->ncomp; ++j)
+            {
+                if(i == j)
+                {
+                    continue;
+                }
+                snprintf(prompt, sizeof(prompt), "Wilson energy a(%s, %s)", th->comp[i].name, th->comp[j].name);
+                th->a[i*th->ncomp + j] = inputDouble(1, 1, prompt, "J/mol");
+            }
+        }
+    }
+}
+
+void ShortcutColumnVariable(ColThermo *th, double *P, double *F, double *z, double *q, ColShortcut *sc)
+{
+    char prompt[maxstrlen];
+    double sum = 0.0;
+    
+    ColThermoVariable(th, 0);
+    
+    *P = inputDouble(0, 0, "column pressure", "bar");
+    *P = (*P)*100000; // Conversion (bar to Pa)
+    
+    *F = inputDouble(0, 0, "feed flowrate", "mol/s");
+    for(int i = 0; i < th->ncomp; ++i)
+    {
+        snprintf(prompt, sizeof(prompt), "feed mole fraction of %s", th->comp[i].name);
+        z[i] = inputDouble(1, 0, prompt, "[ ]");
+        sum += z[i];
+    }
+    for(int i = 0; i < th->ncomp; ++i)
+    {
+        z[i] = (z[i])/sum;
+    }
+    *q = inputDouble(1, 1, "feed thermal condition, q", "[ ]");
+    
+    sc->LK = 0;
+    sc->HK = 0;
+    while(sc->LK == sc->HK)
+    {
+        sc->LK = (int)inputDouble(0, 0, "light key component number", "") - 1;
+        sc->HK = (int)inputDouble(0, 0, "heavy key component number", "") - 1;
+        if(sc->LK < 0 || sc->HK < 0 || sc->LK >= th->ncomp || sc->HK >= th->ncomp || sc->LK == sc->HK)
+        {
+            printf("The keys must be two different components numbered 1 to %i.\n", th->ncomp);
+            sc->LK = sc->HK = 0;
+        }
+    }
+    
+    sc->rLK = 1.0;
+    while(sc->rLK >= 1.0)
+    {
+        sc->rLK = inputDouble(0, 0, "light key recovery in the distillate", "[ ]");
+    }
+    sc->rHK = 1.0;
+    while(sc->rHK >= 1.0)
+    {
+        sc->rHK = inputDouble(0, 0, "heavy key recovery in the bottoms", "[ ]");
+    }
+    sc->ratio = 0.0;
+    while(sc->ratio <= 1.0)
+    {
+        sc->ratio = inputDouble(0, 0, "ratio of operating to minimum reflux", "[ ]");
+    }
+}
+
+/// MARK: GENERAL CALCULATIONS
+/// This subroutine is used to split the feed between the products with the Fenske equation at a given minimum number of stages.
+static void ColFenskeSplit(int ncomp, double F, const double *z, const double *alpha, double Nmin, double dHK, double bHK, double *d, double *b)
+{
+    for(int i = 0; i < ncomp; ++i)
+    {
+        double ratio = exp(Nmin*log(alpha[i]))*dHK/bHK;
+        
+        d[i] = F*z[i]*ratio/(1 + ratio);
+        b[i] = F*z[i] - d[i];
+    }
+}
+
+int ColShortcutCalculation(const ColThermo *th, double P, double F, const double *z, double q, ColShortcut *sc)
+{
+    int C = th->ncomp;
+    int LK = sc->LK;
+    int HK = sc->HK;
+    double K[ColMaxComp];
+    double Kb[ColMaxComp];
+    double xD[ColMaxComp];
+    double xB[ColMaxComp];
+    double dLK = sc->rLK*F*z[LK];
+    double bLK = F*z[LK] - dLK;
+    double bHK = sc->rHK*F*z[HK];
+    double dHK = F*z[HK] - bHK;
+    double Nold = -1.0;
+    double lo = 1.0;
+    double hi = 0.0;
+    double sum = 0.0;
+    double X = 0.0;
+    double Y = 0.0;
+    double r = 0.0;
+    
+    //  Relative volatilities at the feed bubble point to begin
+    sc->Ttop = sc->Tbot = ColBubblePoint(th, P, z, 350.0, K);
+    for(int i = 0; i < C; ++i)
+    {
+        sc->alpha[i] = K[i]/K[HK];
+    }
+    
+    //  Fenske, updating the volatilities with the product bubble points
+    for(int it = 0; it < 20; ++it)
+    {
+        if(sc->alpha[LK] <= 1.0)
+        {
+            return 1;
+        }
+        sc->Nmin = log((dLK/bLK)*(bHK/dHK))/log(sc->alpha[LK]);
+        ColFenskeSplit(C, F, z, sc->alpha, sc->Nmin, dHK, bHK, sc->d, sc->b);
+        sc->d[LK] = dLK;
+        sc->b[LK] = bLK;
+        sc->d[HK] = dHK;
+        sc->b[HK] = bHK;
+        
+        sc->D = sc->B = 0.0;
+        for(int i = 0; i < C; ++i)
+        {
+            sc->D += sc->d[i];
+            sc->B += sc->b[i];
+        }
+        for(int i = 0; i < C; ++i)
+        {
+            xD[i] = sc->d[i]/sc->D;
+            xB[i] = sc->b[i]/sc->B;
+        }
+        if(fabs(sc->Nmin - Nold) < 1e-6)
+        {
+            break;
+        }
+        Nold = sc->Nmin;
+        
+        sc->Ttop = ColBubblePoint(th, P, xD, sc->Ttop, K);
+        sc->Tbot = ColBubblePoint(th, P, xB, sc->Tbot, Kb);
+        for(int i = 0; i < C; ++i)
+        {
+            sc->alpha[i] = sqrt((K[i]/K[HK])*(Kb[i]/Kb[HK]));
+        }
+    }
+    
+    //  Underwood root between the heavy key and the next more volatile component
+    hi = sc->alpha[LK];
+    for(int i = 0; i < C; ++i)
+    {
+        if(z[i] > 0 && sc->alpha[i] > 1.0 && sc->alpha[i] < hi)
+        {
+            hi = sc->alpha[i];
+        }
+    }
+    for(int it = 0; it < 100; ++it)
+    {
+        sc->theta = 0.5*(lo + hi);
+        sum = 0.0;
+        for(int i = 0; i < C; ++i)
+        {
+            sum += sc->alpha[i]*z[i]/(sc->alpha[i] - sc->theta);
+        }
+        if(sum > 1 - q)
+        {
+            hi = sc->theta;
+        }else{
+            lo = sc->theta;
+        }
+    }
+    sum = 0.0;
+    for(int i = 0; i < C; ++i)
+    {
+        sum += sc->alpha[i]*xD[i]/(sc->alpha[i] - sc->theta);
+    }
+    sc->Rmin = fmax(sum - 1, 0.0);
+    sc->R = sc->ratio*sc->Rmin;
+    
+    //  Gilliland correlation (Molokanov form)
+    X = (sc->R - sc->Rmin)/(sc->R + 1);
+    Y = 1 - exp((1 + 54.4*X)/(11 + 117.2*X)*(X - 1)/sqrt(X));
+    sc->N = (Y + sc->Nmin)/(1 - Y);
+    
+    //  Kirkbride feed location
+    r = pow((z[HK]/z[LK])*pow(xB[LK]/xD[HK], 2)*(sc->B/sc->D), 0.206);
+    sc->NR = sc->N*r/(1 + r);
+    
+    return 0;
+}
+
+void ColInitialProfile(const ColThermo *th, const ColSpec *spec, ColProfile *prof)
+{
+    int N = spec->nstages;
+    int C = th->ncomp;
+    double z[ColMaxComp];
+    double K[ColMaxComp];
+    double xD[ColMaxComp];
+    double xB[ColMaxComp];
+    double Ft = 0.0;
+    double Nm = 0.5*N;
+    double lo = -700.0;
+    double hi = 700.0;
+    double Ttop = 0.0;
+    double Tbot = 0.0;
+    double S = 0.0;
+    double Vdown = 0.0;
+    
+    //  Combined feed
+    memset(z, 0, sizeof(z));
+    for(int j = 0; j < N; ++j)
+    {
+        Ft += spec->F[j];
+        for(int i = 0; i < C; ++i)
+        {
+            z[i] += spec->F[j]*spec->z[(size_t)j*C + i];
+        }
+    }
+    for(int i = 0; i < C; ++i)
+    {
+        z[i] = (z[i])/Ft;
+    }
+    
+    //  Fenske distribution, d/b = c K^Nm, with c chosen to give the distillate flowrate
+    ColBubblePoint(th, spec->P, z, 350.0, K);
+    for(int it = 0; it < 100; ++it)
+    {
+        double lnc = 0.5*(lo + hi);
+        double D = 0.0;
+        
+        for(int i = 0; i < C; ++i)
+        {
+            xD[i] = Ft*z[i]/(1 + exp(-(lnc + Nm*log(K[i]))));
+            D += xD[i];
+        }
+        if(D > spec->D)
+        {
+            hi = lnc;
+        }else{
+            lo = lnc;
+        }
+    }
+    for(int i = 0; i < C; ++i)
+    {
+        xB[i] = (Ft*z[i] - xD[i])/(Ft - spec->D);
+        xD[i] = (xD[i])/spec->D;
+    }
+    Ttop = ColBubblePoint(th, spec->P, xD, 350.0, K);
+    Tbot = ColBubblePoint(th, spec->P + (N - 1)*spec->dP, xB, Ttop, K);
+    
+    //  Linear temperature and composition profiles
+    for(int j = 0; j < N; ++j)
+    {
+        double f = (double)j/(N - 1);
+        double *x = &prof->x[(size_t)j*C];
+        double *y = &prof->y[(size_t)j*C];
+        double sum = 0.0;
+        
+        prof->T[j] = Ttop + f*(Tbot - Ttop);
+        for(int i = 0; i < C; ++i)
+        {
+            x[i] = xD[i] + f*(xB[i] - xD[i]);
+        }
+        ColKValues(th, prof->T[j], spec->P + j*spec->dP, x, K);
+        for(int i = 0; i < C; ++i)
+        {
+            y[i] = K[i]*x[i];
+            sum += y[i];
+        }
+        for(int i = 0; i < C; ++i)
+        {
+            y[i] = (y[i])/sum;
+        }
+    }
+    
+    //  Constant molar overflow
+    prof->V[0] = 0.0;
+    for(int j = 1; j < N; ++j)
+    {
+        Vdown += (1 - spec->q[j - 1])*spec->F[j - 1];
+        prof->V[j] = fmax((spec->reflux + 1)*spec->D - Vdown, 1e-3*spec->D);
+    }
+    for(int j = 0; j < N; ++j)
+    {
+        S += spec->F[j];
+        prof->L[j] = ((j < N - 1) ? prof->V[j + 1] : 0.0) + S - spec->D;
+    }
+}
+
+/// MARK: DISPLAY AND WRITE
+/// This subroutine is used to print the shortcut design to a console or file.
+static void ShortcutColumnPrint(ResultWriter *w, const ColThermo *th, double P, double F, const double *z, double q, const ColShortcut *sc)
+{
+    writerPrintf(w, "_Shortcut_Column_Design_\n");
+    writerPrintf(w, "\tInput parameters:\n");
+    writerPrintf(w, "Column pressure:\n");
+    writerPrintf(w, "P =\t%.3f\tbar\n", P*0.00001);
+    writerPrintf(w, "Feed flowrate:\n");
+    writerPrintf(w, "F =\t%.3f\tmol/s\n", F);
+    writerPrintf(w, "Feed thermal condition:\n");
+    writerPrintf(w, "q =\t%.3f\t[ ]\n", q);
+    writerPrintf(w, "Light key:\n");
+    writerPrintf(w, "%s\trecovery =\t%.4f\n", th->comp[sc->LK].name, sc->rLK);
+    writerPrintf(w, "Heavy key:\n");
+    writerPrintf(w, "%s\trecovery =\t%.4f\n\n", th->comp[sc->HK].name, sc->rHK);
+    
+    writerPrintf(w, "\tOutput parameters:\n");
+    writerPrintf(w, "Distillate bubble point:\n");
+    writerPrintf(w, "T =\t%.2f\tdeg C\n", sc->Ttop - 273.15);
+    writerPrintf(w, "Bottoms bubble point:\n");
+    writerPrintf(w, "T =\t%.2f\tdeg C\n", sc->Tbot - 273.15);
+    writerPrintf(w, "Minimum number of stages (Fenske):\n");
+    writerPrintf(w, "Nmin =\t%.3f\t[ ]\n", sc->Nmin);
+    writerPrintf(w, "Minimum reflux ratio (Underwood):\n");
+    writerPrintf(w, "Rmin =\t%.4f\t[ ]\n", sc->Rmin);
+    writerPrintf(w, "Operating reflux ratio:\n");
+    writerPrintf(w, "R =\t%.4f\t[ ]\n", sc->R);
+    writerPrintf(w, "Number of equilibrium stages (Gilliland):\n");
+    writerPrintf(w, "N =\t%.3f\t[ ]\n", sc->N);
+    writerPrintf(w, "Equilibrium stages above the feed (Kirkbride):\n");
+    writerPrintf(w, "NR =\t%.3f\t[ ]\n\n", sc->NR);
+    
+    writerPrintf(w, "Component\tz (-)\talpha (-)\td (mol/s)\tb (mol/s)\txD (-)\txB (-)\n");
+    for(int i = 0; i < th->ncomp; ++i)
+    {
+        writerPrintf(w, "%s\t%.4f\t%.4f\t%.5g\t%.5g\t%.5g\t%.5g\n", th->comp[i].name, z[i], sc->alpha[i], sc->d[i], sc->b[i], sc->d[i]/sc->D, sc->b[i]/sc->B);
+    }
+    writerPrintf(w, "Total\t\t\t%.5g\t%.5g\n", sc->D, sc->B);
+}
+
+void ShortcutColumnDisplay(const ColThermo *th, double P, double F, const double *z, double q, const ColShortcut *sc)
+{
+    ResultWriter w;             // Console writer for the results.
+    
+    if(writerConsole(&w))
+    {
+        ShortcutColumnPrint(&w, th, P, F, z, q, sc);
+        writerClose(&w);
+    }
+}
+
+void ShortcutColumnWrite(const ColThermo *th, double P, double F, const double *z, double q, const ColShortcut *sc)
+{
+    //  Function variables
+    ResultWriter w;             // Buffered writer for the results file.
+    
+    //  Set file name as timestamp + Shortcut Column Results
+    if(!writerOpen(&w, "Shortcut Column Results"))
+    {
+        return;
+    }
+    
+    //  Write to file
+    ShortcutColumnPrint(&w, th, P, F, z, q, sc);
+    
+    //  Close file
+    writerClose(&w);
+}
+
+void ShortcutColumnWriteSwitch(const ColThermo *th, double P, double F, const double *z, double q, const ColShortcut *sc)
+{
+    int control = 0;
+    
+    control = 1;
+    while(control == 1)
+    {
+        char input[maxstrlen];
+        
+        printf("Do you want to save results to file? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+            case 'T':
+            case 'Y':
+            case 't':
+            case 'y':
+                ShortcutColumnWrite(th, P, F, z, q, sc);
+                control = 0;
+                break;
+            case '0':
+            case 'F':
+            case 'N':
+            case 'f':
+            case 'n':
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+}
+
+/// MARK: PSEUDO-MAIN FUNCTION
+void ShortcutColumn(void)
+{
+    int whilmain = 0;
+    printf("Shortcut Column Design (Fenske-Underwood-Gilliland)\n");
+    
+    whilmain = 1;
+    while(whilmain == 1)
+    {
+        //  Variable declaration
+        ColThermo th;
+        ColShortcut sc;
+        double z[ColMaxComp];
+        double P = 0.0;
+        double F = 0.0;
+        double q = 0.0;
+        int status = 0;
+            //  Variables for timing function
+        struct timespec start, end;
+        double elapsed = 0.0;
+        
+        memset(&sc, 0, sizeof(ColShortcut));
+        
+        //  Data Collection
+        ShortcutColumnVariable(&th, &P, &F, z, &q, &sc);
+        
+        //  Data Manipulation
+        clock_getres(CLOCK_MONOTONIC, &start);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        
+        status = ColShortcutCalculation(&th, P, F, z, q, &sc);
+        
+        clock_getres(CLOCK_MONOTONIC, &end);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        elapsed = timer(start, end);
+
+        printf("Calculations completed in %.6f seconds.\n", elapsed);
+        
+        if(status != 0)
+        {
+            printf("The light key is not more volatile than the heavy key at these conditions.\n");
+        }else{
+            //  Displaying results
+            ShortcutColumnDisplay(&th, P, F, z, q, &sc);
+            
+            //  Writing to File
+            ShortcutColumnWriteSwitch(&th, P, F, z, q, &sc);
+        }
+        
+        //  Continue function
+        whilmain = Continue(whilmain);
+    }
+    fflush(stdout);
+}
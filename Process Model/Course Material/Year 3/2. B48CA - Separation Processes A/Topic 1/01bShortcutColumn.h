@@ -0,0 +1,111 @@
+//
+//  01bShortcutColumn.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef ShortcutColumnStruct_h
+#define ShortcutColumnStruct_h
+
+typedef struct ColShortcut{
+    int LK;                     // Index of the light key.
+    int HK;                     // Index of the heavy key.
+    double rLK;                 // Recovery of the light key in the distillate ([ ]).
+    double rHK;                 // Recovery of the heavy key in the bottoms ([ ]).
+    double ratio;               // Ratio of the operating to minimum reflux ([ ]).
+    double alpha[ColMaxComp];   // Relative volatility to the heavy key ([ ]), calculated.
+    double d[ColMaxComp];       // Component flowrate in the distillate (mol/s), calculated.
+    double b[ColMaxComp];       // Component flowrate in the bottoms (mol/s), calculated.
+    double D;                   // Distillate flowrate (mol/s), calculated.
+    double B;                   // Bottoms flowrate (mol/s), calculated.
+    double Ttop;                // Distillate bubble point (K), calculated.
+    double Tbot;                // Bottoms bubble point (K), calculated.
+    double Nmin;                // Minimum number of equilibrium stages, Fenske ([ ]), calculated.
+    double theta;               // Underwood root ([ ]), calculated.
+    double Rmin;                // Minimum reflux ratio, Underwood ([ ]), calculated.
+    double R;                   // Operating reflux ratio ([ ]), calculated.
+    double N;                   // Number of equilibrium stages, Gilliland ([ ]), calculated.
+    double NR;                  // Equilibrium stages above the feed, Kirkbride ([ ]), calculated.
+} ColShortcut;
+
+#endif /* ShortcutColumnStruct_h */
+
+#ifndef ShortcutColumnCalc_h
+#define ShortcutColumnCalc_h
+
+/// This subroutine is used to estimate the design of a column with the Fenske-Underwood-Gilliland method. Relative volatilities are the geometric mean of those at the distillate and bottoms bubble points and are updated with the product compositions until the minimum number of stages settles. This function returns 0 on success or 1 if the keys cannot be separated.
+/// @param th Component properties and liquid phase model.
+/// @param P Column pressure (Pa).
+/// @param F Feed flowrate (mol/s).
+/// @param z Feed mole fractions ([ ]).
+/// @param q Feed thermal condition ([ ]).
+/// @param sc Key components, recoveries and reflux ratio. Overwritten with the design.
+int ColShortcutCalculation(const ColThermo *th, double P, double F, const double *z, double q, ColShortcut *sc);
+
+/// This subroutine is used to generate an initial profile for the rigorous solvers. Products are split by the Fenske distribution with half of the stages at minimum reflux, temperatures vary linearly between the product bubble points and flows follow constant molar overflow.
+/// @param th Component properties and liquid phase model.
+/// @param spec Column specification.
+/// @param prof Allocated column profile where the initial estimate should be stored.
+void ColInitialProfile(const ColThermo *th, const ColSpec *spec, ColProfile *prof);
+
+/// This subroutine is used to collect the component properties and liquid phase model.
+/// @param th Struct where the component properties should be stored.
+/// @param rigorous Set to 1 to also collect heat capacities, heats of vaporisation and activity coefficient parameters.
+void ColThermoVariable(ColThermo *th, int rigorous);
+
+#endif /* ShortcutColumnCalc_h */
+
+#ifndef ShortcutColumn_h
+#define ShortcutColumn_h
+
+/// This subroutine is used to collect the data for a shortcut column design.
+/// @param th Struct where the component properties should be stored.
+/// @param P Column pressure (Pa).
+/// @param F Feed flowrate (mol/s).
+/// @param z Feed mole fractions ([ ]).
+/// @param q Feed thermal condition ([ ]).
+/// @param sc Struct where the key components and specifications should be stored.
+void ShortcutColumnVariable(ColThermo *th, double *P, double *F, double *z, double *q, ColShortcut *sc);
+
+/// This subroutine is used to output the shortcut column design to the user console.
+/// @param th Component properties.
+/// @param P Column pressure (Pa).
+/// @param F Feed flowrate (mol/s).
+/// @param z Feed mole fractions ([ ]).
+/// @param q Feed thermal condition ([ ]).
+/// @param sc Shortcut column design.
+void ShortcutColumnDisplay(const ColThermo *th, double P, double F, const double *z, double q, const ColShortcut *sc);
+
+/// This subroutine is used to write the shortcut column design to a .txt file.
+/// @param th Component properties.
+/// @param P Column pressure (Pa).
+/// @param F Feed flowrate (mol/s).
+/// @param z Feed mole fractions ([ ]).
+/// @param q Feed thermal condition ([ ]).
+/// @param sc Shortcut column design.
+void ShortcutColumnWrite(const ColThermo *th, double P, double F, const double *z, double q, const ColShortcut *sc);
+
+/// This subroutine is used to check if the user would like to write the results to a file.
+/// @param th Component properties.
+/// @param P Column pressure (Pa).
+/// @param F Feed flowrate (mol/s).
+/// @param z Feed mole fractions ([ ]).
+/// @param q Feed thermal condition ([ ]).
+/// @param sc Shortcut column design.
+void ShortcutColumnWriteSwitch(const ColThermo *th, double P, double F, const double *z, double q, const ColShortcut *sc);
+
+#endif /* ShortcutColumn_h */
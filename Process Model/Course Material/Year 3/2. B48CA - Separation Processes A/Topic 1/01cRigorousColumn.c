@@ -0,0 +1,327 @@
+//
+//  01cRigorousColumn.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+/// MARK: HEADER DECLARATIONS
+//Standard Header Files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//Custom Header Files
+#include "System.h"
+#include "ResultWriter.h"
+#include "01aColumnMESH.h"
+#include "01bShortcutColumn.h"
+#include "B48CA_T1.h"
+#include "01cRigorousColumn.h"
+
+/// MARK: SUBROUTINE DEFINITIONS
+#define maxstrlen 128
+
+/// MARK: VARIABLE INPUT
+void RigorousColumnVariable(ColThermo *th, ColSpec *spec, ColOptions *opt)
+{
+    char input[maxstrlen];
+    char prompt[maxstrlen];
+    double F = 0.0;
+    double sum = 0.0;
+    int feed = 0;
+    int control = 0;
+    
+    ColThermoVariable(th, 1);
+    
+    //  Column arrangement
+    spec->nstages = 0;
+    while(spec->nstages < 3)
+    {
+        spec->nstages = (int)inputDouble(0, 0, "number of stages, including the total condenser and partial reboiler", "");
+    }
+    spec->F = calloc(spec->nstages, sizeof(double));
+    spec->z = calloc((size_t)spec->nstages*th->ncomp, sizeof(double));
+    spec->q = calloc(spec->nstages, sizeof(double));
+    
+    while(feed < 2 || feed > spec->nstages - 1)
+    {
+        snprintf(prompt, sizeof(prompt), "feed stage, counted from the condenser [2 - %i]", spec->nstages - 1);
+        feed = (int)inputDouble(0, 0, prompt, "");
+    }
+    feed = feed - 1;
+    
+    //  Feed
+    F = inputDouble(0, 0, "feed flowrate", "mol/s");
+    spec->F[feed] = F;
+    for(int i = 0; i < th->ncomp; ++i)
+    {
+        snprintf(prompt, sizeof(prompt), "feed mole fraction of %s", th->comp[i].name);
+        spec->z[(size_t)feed*th->ncomp + i] = inputDouble(1, 0, prompt, "[ ]");
+        sum += spec->z[(size_t)feed*th->ncomp + i];
+    }
+    for(int i = 0; i < th->ncomp; ++i)
+    {
+        spec->z[(size_t)feed*th->ncomp + i] /= sum;
+    }
+    spec->q[feed] = inputDouble(1, 1, "feed thermal condition, q", "[ ]");
+    
+    //  Operation
+    spec->P = inputDouble(0, 0, "condenser pressure", "bar");
+    spec->P = (spec->P)*100000; // Conversion (bar to Pa)
+    
+    spec->dP = inputDouble(1, 0, "pressure drop per stage", "kPa");
+    spec->dP = (spec->dP)*1000; // Conversion (kPa to Pa)
+    
+    spec->reflux = inputDouble(0, 0, "reflux ratio", "[ ]");
+    spec->D = F;
+    while(spec->D >= F)
+    {
+        spec->D = inputDouble(0, 0, "distillate flowrate", "mol/s");
+    }
+    
+    //  Solution method. The bubble-point method is only offered for ideal mixtures.
+    opt->method = ColNaphtaliSandholm;
+    control = (th->model == ColIdeal);
+    while(control == 1)
+    {
+        printf("Solution method: bubble-point (1) or Naphtali-Sandholm (2)? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+                opt->method = ColBubblePointMethod;
+                control = 0;
+                break;
+            case '2':
+                opt->method = ColNaphtaliSandholm;
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+    opt->tol = inputDouble(0, 0, "convergence tolerance", "");
+    opt->maxiter = (int)inputDouble(0, 0, "maximum number of iterations", "");
+}
+
+void RigorousColumnFree(ColSpec *spec)
+{
+    free(spec->F);
+    free(spec->z);
+    free(spec->q);
+}
+
+/// MARK: DISPLAY AND WRITE
+/// This subroutine is used to print the column profile to a console or file.
+static void RigorousColumnPrint(ResultWriter *w, const ColThermo *th, const ColSpec *spec, const ColOptions *opt, const ColProfile *prof)
+{
+    const char *method[] = {"", "Bubble-point", "Naphtali-Sandholm"};
+    const char *model[] = {"", "Ideal", "Wilson"};
+    int N = spec->nstages;
+    int C = th->ncomp;
+    
+    writerPrintf(w, "_Rigorous_Column_Results_\n");
+    writerPrintf(w, "Solution method:\n");
+    writerPrintf(w, "%s\n", method[opt->method]);
+    writerPrintf(w, "Liquid phase:\n");
+    writerPrintf(w, "%s\n", model[th->model]);
+    writerPrintf(w, "Iterations:\n");
+    writerPrintf(w, "iter =\t%i\n", prof->iter);
+    writerPrintf(w, "Final error:\n");
+    writerPrintf(w, "err =\t%.3g\n", prof->err);
+    writerPrintf(w, "%s\n\n", (prof->status == 0) ? "Converged" : "Iteration limit reached");
+    
+    writerPrintf(w, "\tInput parameters:\n");
+    writerPrintf(w, "Number of stages:\n");
+    writerPrintf(w, "N =\t%i\t[ ]\n", N);
+    writerPrintf(w, "Condenser pressure:\n");
+    writerPrintf(w, "P =\t%.3f\tbar\n", spec->P*0.00001);
+    writerPrintf(w, "Reflux ratio:\n");
+    writerPrintf(w, "R =\t%.4f\t[ ]\n", spec->reflux);
+    writerPrintf(w, "Distillate flowrate:\n");
+    writerPrintf(w, "D =\t%.4f\tmol/s\n\n", spec->D);
+    
+    writerPrintf(w, "\tOutput parameters:\n");
+    writerPrintf(w, "Condenser duty:\n");
+    writerPrintf(w, "Qc =\t%.3f\tkW\n", prof->Qc*0.001);
+    writerPrintf(w, "Reboiler duty:\n");
+    writerPrintf(w, "Qr =\t%.3f\tkW\n", prof->Qr*0.001);
+    writerPrintf(w, "Bottoms flowrate:\n");
+    writerPrintf(w, "B =\t%.4f\tmol/s\n\n", prof->L[N - 1]);
+    
+    writerPrintf(w, "Component\txD (-)\txB (-)\n");
+    for(int i = 0; i < C; ++i)
+    {
+        writerPrintf(w, "%s\t%.6g\t%.6g\n", th->comp[i].name, prof->x[i], prof->x[(size_t)(N - 1)*C + i]);
+    }
+    writerPrintf(w, "\n");
+    
+    writerPrintf(w, "Stage\tT (deg C)\tP (bar)\tL (mol/s)\tV (mol/s)");
+    for(int i = 0; i < C; ++i)
+    {
+        writerPrintf(w, "\tx %s (-)", th->comp[i].name);
+    }
+    for(int i = 0; i < C; ++i)
+    {
+        writerPrintf(w, "\ty %s (-)", th->comp[i].name);
+    }
+    writerPrintf(w, "\n");
+    for(int j = 0; j < N; ++j)
+    {
+        writerPrintf(w, "%i\t%.3f\t%.4f\t%.5g\t%.5g", j + 1, prof->T[j] - 273.15, (spec->P + j*spec->dP)*0.00001, prof->L[j], prof->V[j]);
+        for(int i = 0; i < C; ++i)
+        {
+            writerPrintf(w, "\t%.5g", prof->x[(size_t)j*C + i]);
+        }
+        for(int i = 0; i < C; ++i)
+        {
+            writerPrintf(w, "\t%.5g", prof->y[(size_t)j*C + i]);
+        }
+        writerPrintf(w, "\n");
+    }
+}
+
+void RigorousColumnDisplay(const ColThermo *th, const ColSpec *spec, const ColOptions *opt, const ColProfile *prof)
+{
+    ResultWriter w;             // Console writer for the results.
+    
+    if(writerConsole(&w))
+    {
+        RigorousColumnPrint(&w, th, spec, opt, prof);
+        writerClose(&w);
+    }
+}
+
+void RigorousColumnWrite(const ColThermo *th, const ColSpec *spec, const ColOptions *opt, const ColProfile *prof)
+{
+    //  Function variables
+    ResultWriter w;             // Buffered writer for the results file.
+    
+    //  Set file name as timestamp + Rigorous Column Results
+    if(!writerOpen(&w, "Rigorous Column Results"))
+    {
+        return;
+    }
+    
+    //  Write to file
+    RigorousColumnPrint(&w, th, spec, opt, prof);
+    
+    //  Close file
+    writerClose(&w);
+}
+
+void RigorousColumnWriteSwitch(const ColThermo *th, const ColSpec *spec, const ColOptions *opt, const ColProfile *prof)
+{
+    int control = 0;
+    
+    control = 1;
+    while(control == 1)
+    {
+        char input[maxstrlen];
+        
+        printf("Do you want to save results to file? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+            case 'T':
+            case 'Y':
+            case 't':
+            case 'y':
+                RigorousColumnWrite(th, spec, opt, prof);
+                control = 0;
+                break;
+            case '0':
+            case 'F':
+            case 'N':
+            case 'f':
+            case 'n':
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+}
+
+/// MARK: PSEUDO-MAIN FUNCTION
+void RigorousColumn(void)
+{
+    int whilmain = 0;
+    printf("Rigorous Column Simulation (MESH Equations)\n");
+    
+    whilmain = 1;
+    while(whilmain == 1)
+    {
+        //  Variable declaration
+        ColThermo th;
+        ColSpec spec;
+        ColOptions opt;
+        ColProfile prof;
+        int status = 0;
+            //  Variables for timing function
+        struct timespec start, end;
+        double elapsed = 0.0;
+        
+        memset(&spec, 0, sizeof(ColSpec));
+        memset(&opt, 0, sizeof(ColOptions));
+        
+        //  Data Collection
+        RigorousColumnVariable(&th, &spec, &opt);
+        
+        //  Data Manipulation
+        clock_getres(CLOCK_MONOTONIC, &start);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        
+        ColProfileAlloc(&prof, spec.nstages, th.ncomp);
+        ColInitialProfile(&th, &spec, &prof);
+        if(opt.method == ColNaphtaliSandholm)
+        {
+            status = ColNaphtaliSandholmSolve(&th, &spec, &opt, &prof);
+        }else{
+            status = ColBubblePointSolve(&th, &spec, &opt, &prof);
+        }
+        
+        clock_getres(CLOCK_MONOTONIC, &end);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        elapsed = timer(start, end);
+
+        printf("Calculations completed in %.6f seconds.\n", elapsed);
+        if(status != 0)
+        {
+            printf("The column did not converge within %i iterations.\n", opt.maxiter);
+        }
+        
+        //  Displaying results
+        RigorousColumnDisplay(&th, &spec, &opt, &prof);
+        
+        //  Writing to File
+        RigorousColumnWriteSwitch(&th, &spec, &opt, &prof);
+        
+        //  Continue function
+        whilmain = Continue(whilmain);
+        
+        ColProfileFree(&prof);
+        RigorousColumnFree(&spec);
+    }
+    fflush(stdout);
+}
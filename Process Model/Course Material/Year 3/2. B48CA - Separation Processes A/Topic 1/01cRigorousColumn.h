@@ -0,0 +1,65 @@
+//
+//  01cRigorousColumn.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef RigorousColumnVariable_h
+#define RigorousColumnVariable_h
+
+/// This subroutine is used to collect the data for a rigorous column simulation. A single feed is placed on one stage; the feed arrays of the specification are allocated here and released by "RigorousColumnFree(...)".
+/// @param th Struct where the component properties should be stored.
+/// @param spec Struct where the column specification should be stored.
+/// @param opt Struct where the solution method and convergence settings should be stored.
+void RigorousColumnVariable(ColThermo *th, ColSpec *spec, ColOptions *opt);
+
+/// This subroutine is used to release the feed arrays of a column specification.
+/// @param spec Column specification.
+void RigorousColumnFree(ColSpec *spec);
+
+#endif /* RigorousColumnVariable_h */
+
+#ifndef RigorousColumnDisplay_h
+#define RigorousColumnDisplay_h
+
+/// This subroutine is used to output the column profile to the user console.
+/// @param th Component properties.
+/// @param spec Column specification.
+/// @param opt Solution method and convergence settings.
+/// @param prof Column profile.
+void RigorousColumnDisplay(const ColThermo *th, const ColSpec *spec, const ColOptions *opt, const ColProfile *prof);
+
+#endif /* RigorousColumnDisplay_h */
+
+#ifndef RigorousColumnWrite_h
+#define RigorousColumnWrite_h
+
+/// This subroutine is used to write the column profile to a .txt file.
+/// @param th Component properties.
+/// @param spec Column specification.
+/// @param opt Solution method and convergence settings.
+/// @param prof Column profile.
+void RigorousColumnWrite(const ColThermo *th, const ColSpec *spec, const ColOptions *opt, const ColProfile *prof);
+
+/// This subroutine is used to check if the user would like to write the results to a file.
+/// @param th Component properties.
+/// @param spec Column specification.
+/// @param opt Solution method and convergence settings.
+/// @param prof Column profile.
+void RigorousColumnWriteSwitch(const ColThermo *th, const ColSpec *spec, const ColOptions *opt, const ColProfile *prof);
+
+#endif /* RigorousColumnWrite_h */
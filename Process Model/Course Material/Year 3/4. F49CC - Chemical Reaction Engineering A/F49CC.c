@@ -0,0 +1,92 @@
+//
+//  F49CC.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+//  Standard header files
+#include <stdio.h>
+#include <stdlib.h>
+
+//  Custom header files
+#include "Courses.h"
+#include "F49CCMenu.h"
+#include "F49CC_T1.h"
+
+#define maxstrlen 128
+
+void F49CCTopComm(){
+    printf("Please select from the following programs: \n");
+}
+
+void F49CCtopic1(){
+    char input[maxstrlen];
+    int control = 0;
+    
+    control = 1;
+    while(control == 1){
+        F49CCTopComm();
+        printf("1. Kinetic Reactor Design (Batch, PFR, CSTR).\n2. Reactor Parametric Sweep.\n");
+        printf("q. Exit topic. \n\n");
+        printf("Selection [1 - 2]: ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0]){
+            case '1':
+                KineticReactor();
+                break;
+            case '2':
+                ReactorSweep();
+                break;
+            case '0':
+            case 'Q':
+            case 'q':
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised. Please enter an integer between 1 and 2.\n");
+                break;
+        }
+    }
+}
+
+void F49CC(){
+    char input[maxstrlen];      // Variable where character input is stored.
+    int control = 0;            // Variable used to control user input.
+    printf("Chemical Reaction Engineering A\n\n");
+    
+    control = 1;
+    while(control == 1){
+        printf("Please select from the following topics:\n");
+        printf("T1: Kinetic Reactor Design\n\nq. Quit course\n\n");
+        printf("Topic ");
+        fgets(input,sizeof(input),stdin);
+        switch(input[0]){
+            case '1':
+                F49CCtopic1();
+                break;
+            case '0':
+            case 'Q':
+            case 'q':
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised. Please enter 1 or q.\n");
+                break;
+        }
+        fflush(stdout);
+    }
+}
@@ -0,0 +1,35 @@
+//
+//  F49CCMenu.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef F49CCTopComm_h
+#define F49CCTopComm_h
+
+void F49CCTopComm(void);
+
+#endif /* F49CCTopComm_h */
+
+//  The following prototypes are used to declare topic menu functions for F49CC
+
+#ifndef F49CCtopic1_h
+#define F49CCtopic1_h
+
+void F49CCtopic1(void);
+
+#endif /* F49CCtopic1_h */
@@ -0,0 +1,251 @@
+//
+//  01aReactionKinetics.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+/// MARK: HEADER DECLARATIONS
+//  Standard header files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//  Custom header files
+#include "System.h"
+#include "01aReactionKinetics.h"
+
+/// MARK: SUBROUTINE DEFINITIONS
+#define maxstrlen 128
+#define R 8.3145            // J/(mol.K)
+
+/// MARK: VARIABLE INPUT
+void RxnSystemVariable(RxnSystem *sys)
+{
+    char input[maxstrlen];
+    char prompt[maxstrlen];
+    int ns = 0;
+    int nr = 0;
+    
+    memset(sys, 0, sizeof(RxnSystem));
+    ns = (int)inputDouble(0, 0, "number of species", "");
+    ns = (ns > RxnMaxSpecies) ? RxnMaxSpecies : ns;
+    sys->nspecies = ns;
+    for(int i = 0; i < ns; ++i)
+    {
+        printf("Species %i name: ", i + 1);
+        fgets(input, sizeof(input), stdin);
+        input[strcspn(input, "\r\n")] = '\0';
+        snprintf(sys->name[i], RxnNameLength, "%.*s", RxnNameLength - 1, input);
+    }
+    
+    nr = (int)inputDouble(0, 0, "number of reactions", "");
+    nr = (nr > RxnMaxReactions) ? RxnMaxReactions : nr;
+    sys->nrxn = nr;
+    for(int j = 0; j < nr; ++j)
+    {
+        printf("Reaction %i (reactants have negative coefficients):\n", j + 1);
+        for(int i = 0; i < ns; ++i)
+        {
+            snprintf(prompt, sizeof(prompt), "stoichiometric coefficient of %s", sys->name[i]);
+            sys->nu[j*ns + i] = inputDouble(1, 1, prompt, "[ ]");
+        }
+        for(int i = 0; i < ns; ++i)
+        {
+            snprintf(prompt, sizeof(prompt), "reaction order in %s", sys->name[i]);
+            sys->order[j*ns + i] = inputDouble(1, 0, prompt, "[ ]");
+        }
+        sys->k0[j] = inputDouble(0, 0, "pre-exponential factor", "(mol/m3)^(1-n)/s");
+        sys->Ea[j] = inputDouble(1, 0, "activation energy", "kJ/mol");
+        sys->Ea[j] = (sys->Ea[j])*1000; // Conversion (kJ to J)
+        sys->dH[j] = inputDouble(1, 1, "enthalpy of reaction", "kJ/mol");
+        sys->dH[j] = (sys->dH[j])*1000; // Conversion (kJ to J)
+    }
+}
+
+/// MARK: GENERAL CALCULATIONS
+void RxnCompile(const RxnSystem *sys, RxnCompiled *rx)
+{
+    int ns = sys->nspecies;
+    int nt = 0;
+    int nc = 0;
+    
+    rx->nspecies = ns;
+    rx->nrxn = sys->nrxn;
+    for(int j = 0; j < sys->nrxn; ++j)
+    {
+        rx->lnk0[j] = log(sys->k0[j]);
+        rx->EaR[j] = sys->Ea[j]/R;
+        rx->dH[j] = sys->dH[j];
+        
+        rx->rstart[j] = nt;
+        rx->sstart[j] = nc;
+        for(int i = 0; i < ns; ++i)
+        {
+            double order = sys->order[j*ns + i];
+            double nu = sys->nu[j*ns + i];
+            
+            if(order != 0.0)
+            {
+                rx->rspecies[nt] = i;
+                rx->rorder[nt] = order;
+                rx->rpower[nt] = (order > 0.0 && order <= 4.0 && order == floor(order)) ? (int)order : -1;
+                ++nt;
+            }
+            if(nu != 0.0)
+            {
+                rx->sspecies[nc] = i;
+                rx->snu[nc] = nu;
+                ++nc;
+            }
+        }
+    }
+    rx->rstart[sys->nrxn] = nt;
+    rx->sstart[sys->nrxn] = nc;
+}
+
+/// This subroutine is used to raise a concentration to the power of a compiled term.
+/// @param c Concentration (mol/m3). Negative values are treated as zero.
+/// @param power Integer order, or -1 for a fractional order.
+/// @param order Order of the term.
+static double RxnPower(double c, int power, double order)
+{
+    c = (c > 0.0) ? c : 0.0;
+    switch(power)
+    {
+        case 1:
+            return c;
+        case 2:
+            return c*c;
+        case 3:
+            return c*c*c;
+        case 4:
+            return (c*c)*(c*c);
+        default:
+            return pow(c, order);
+    }
+}
+
+void RxnRates(const RxnCompiled *rx, double T, const double *C, double *r)
+{
+    for(int j = 0; j < rx->nrxn; ++j)
+    {
+        double rate = exp(rx->lnk0[j] - rx->EaR[j]/T);
+        
+        for(int t = rx->rstart[j]; t < rx->rstart[j + 1]; ++t)
+        {
+            rate *= RxnPower(C[rx->rspecies[t]], rx->rpower[t], rx->rorder[t]);
+        }
+        r[j] = rate;
+    }
+}
+
+double RxnProduction(const RxnCompiled *rx, double T, const double *C, double *Rnet)
+{
+    double r[RxnMaxReactions];
+    double q = 0.0;
+    
+    RxnRates(rx, T, C, r);
+    for(int i = 0; i < rx->nspecies; ++i)
+    {
+        Rnet[i] = 0.0;
+    }
+    for(int j = 0; j < rx->nrxn; ++j)
+    {
+        for(int t = rx->sstart[j]; t < rx->sstart[j + 1]; ++t)
+        {
+            Rnet[rx->sspecies[t]] += rx->snu[t]*r[j];
+        }
+        q -= rx->dH[j]*r[j];
+    }
+    
+    return q;
+}
+
+void RxnJacobian(const RxnCompiled *rx, double T, const double *C, double *dRdC, double *dRdT, double *dqdC, double *dqdT)
+{
+    int ns = rx->nspecies;
+    double drdC[RxnMaxSpecies];
+    
+    memset(dRdC, 0, ns*ns*sizeof(double));
+    memset(dRdT, 0, ns*sizeof(double));
+    if(dqdC != NULL)
+    {
+        memset(dqdC, 0, ns*sizeof(double));
+    }
+    if(dqdT != NULL)
+    {
+        *dqdT = 0.0;
+    }
+    
+    for(int j = 0; j < rx->nrxn; ++j)
+    {
+        double k = exp(rx->lnk0[j] - rx->EaR[j]/T);
+        double rate = k;
+        double drdT = 0.0;
+        int t0 = rx->rstart[j];
+        int t1 = rx->rstart[j + 1];
+        
+        //  Each concentration derivative is the product of the other terms, so zero concentrations need no special treatment.
+        for(int t = t0; t < t1; ++t)
+        {
+            double c = C[rx->rspecies[t]];
+            double d = k;
+            
+            c = (c > 0.0) ? c : 0.0;
+            rate *= RxnPower(c, rx->rpower[t], rx->rorder[t]);
+            for(int u = t0; u < t1; ++u)
+            {
+                if(u != t)
+                {
+                    d *= RxnPower(C[rx->rspecies[u]], rx->rpower[u], rx->rorder[u]);
+                }
+            }
+            if(rx->rpower[t] == 1)
+            {
+                drdC[t - t0] = d;
+            }else if(c > 0.0 || rx->rorder[t] > 1.0){
+                drdC[t - t0] = d*rx->rorder[t]*RxnPower(c, -1, rx->rorder[t] - 1.0);
+            }else{
+                drdC[t - t0] = 0.0;
+            }
+        }
+        drdT = rate*rx->EaR[j]/(T*T);
+        
+        for(int s = rx->sstart[j]; s < rx->sstart[j + 1]; ++s)
+        {
+            int i = rx->sspecies[s];
+            
+            for(int t = t0; t < t1; ++t)
+            {
+                dRdC[i*ns + rx->rspecies[t]] += rx->snu[s]*drdC[t - t0];
+            }
+            dRdT[i] += rx->snu[s]*drdT;
+        }
+        if(dqdC != NULL)
+        {
+            for(int t = t0; t < t1; ++t)
+            {
+                dqdC[rx->rspecies[t]] -= rx->dH[j]*drdC[t - t0];
+            }
+        }
+        if(dqdT != NULL)
+        {
+            *dqdT -= rx->dH[j]*drdT;
+        }
+    }
+}
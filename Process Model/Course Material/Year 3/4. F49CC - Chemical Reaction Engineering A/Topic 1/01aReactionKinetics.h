@@ -0,0 +1,100 @@
+//
+//  01aReactionKinetics.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef _1aReactionKineticsStruct_h
+#define _1aReactionKineticsStruct_h
+
+#define RxnMaxSpecies 16                            // Largest number of species in a reaction network.
+#define RxnMaxReactions 16                          // Largest number of reactions in a reaction network.
+#define RxnMaxTerms (RxnMaxSpecies*RxnMaxReactions) // Storage of the compiled concentration and stoichiometry terms.
+#define RxnNameLength 24
+
+typedef struct RxnSystem{
+    int nspecies;                                   // Number of species.
+    int nrxn;                                       // Number of reactions.
+    char name[RxnMaxSpecies][RxnNameLength];        // Species names.
+    double nu[RxnMaxReactions*RxnMaxSpecies];       // Stoichiometric coefficients nu[j*nspecies + i], negative for reactants ([ ]).
+    double order[RxnMaxReactions*RxnMaxSpecies];    // Power-law orders of each species in the rate of reaction j ([ ]).
+    double k0[RxnMaxReactions];                     // Pre-exponential factors ((mol/m3)^(1 - n)/s).
+    double Ea[RxnMaxReactions];                     // Activation energies (J/mol).
+    double dH[RxnMaxReactions];                     // Enthalpies of reaction per unit extent (J/mol).
+} RxnSystem;
+
+typedef struct RxnCompiled{
+    int nspecies;                                   // Number of species.
+    int nrxn;                                       // Number of reactions.
+    double lnk0[RxnMaxReactions];                   // Natural logarithms of the pre-exponential factors.
+    double EaR[RxnMaxReactions];                    // Activation temperatures, Ea/R (K).
+    double dH[RxnMaxReactions];                     // Enthalpies of reaction (J/mol).
+    //  Concentration terms of each rate, excluding zero orders
+    int rstart[RxnMaxReactions + 1];                // Terms of reaction j are rstart[j] to rstart[j + 1] - 1.
+    int rspecies[RxnMaxTerms];                      // Species of each term.
+    int rpower[RxnMaxTerms];                        // Integer order of each term, or -1 when the order is fractional.
+    double rorder[RxnMaxTerms];                     // Order of each term.
+    //  Stoichiometry, excluding zero coefficients
+    int sstart[RxnMaxReactions + 1];                // Coefficients of reaction j are sstart[j] to sstart[j + 1] - 1.
+    int sspecies[RxnMaxTerms];                      // Species of each coefficient.
+    double snu[RxnMaxTerms];                        // Stoichiometric coefficients.
+} RxnCompiled;
+
+#endif /* _1aReactionKineticsStruct_h */
+
+#ifndef _1aReactionKineticsVariable_h
+#define _1aReactionKineticsVariable_h
+
+/// This subroutine is used to collect the species, stoichiometry and power-law Arrhenius rate expressions of a reaction network.
+/// @param sys Struct where the reaction network should be stored.
+void RxnSystemVariable(RxnSystem *sys);
+
+#endif /* _1aReactionKineticsVariable_h */
+
+#ifndef _1aReactionKineticsCalc_h
+#define _1aReactionKineticsCalc_h
+
+/// This subroutine is used to compile a reaction network into flat term lists. Zero orders and coefficients are dropped, integer orders are evaluated by repeated multiplication instead of "pow(...)" and the Arrhenius constants are stored as ln(k0) and Ea/R.
+/// @param sys Reaction network.
+/// @param rx Struct where the compiled network should be stored.
+void RxnCompile(const RxnSystem *sys, RxnCompiled *rx);
+
+/// This subroutine is used to calculate the rate of every reaction. Negative concentrations are treated as zero.
+/// @param rx Compiled reaction network.
+/// @param T Temperature (K).
+/// @param C Concentrations (mol/m3).
+/// @param r Rates of reaction (mol/m3.s).
+void RxnRates(const RxnCompiled *rx, double T, const double *C, double *r);
+
+/// This subroutine is used to calculate the net rate of production of every species and the rate of heat release. This function returns the rate of heat release (W/m3).
+/// @param rx Compiled reaction network.
+/// @param T Temperature (K).
+/// @param C Concentrations (mol/m3).
+/// @param Rnet Net rates of production (mol/m3.s).
+double RxnProduction(const RxnCompiled *rx, double T, const double *C, double *Rnet);
+
+/// This subroutine is used to calculate the analytic derivatives of the net rates of production and the rate of heat release.
+/// @param rx Compiled reaction network.
+/// @param T Temperature (K).
+/// @param C Concentrations (mol/m3).
+/// @param dRdC Derivatives dRnet_i/dC_k stored as dRdC[i*nspecies + k] (1/s).
+/// @param dRdT Derivatives dRnet_i/dT (mol/m3.s.K).
+/// @param dqdC Derivatives of the rate of heat release with concentration (W/mol). Not calculated when NULL.
+/// @param dqdT Derivative of the rate of heat release with temperature (W/m3.K). Not calculated when NULL.
+void RxnJacobian(const RxnCompiled *rx, double T, const double *C, double *dRdC, double *dRdT, double *dqdC, double *dqdT);
+
+#endif /* _1aReactionKineticsCalc_h */
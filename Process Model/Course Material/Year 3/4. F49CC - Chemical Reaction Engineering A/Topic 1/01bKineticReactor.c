@@ -0,0 +1,642 @@
+//
+//  01bKineticReactor.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+/// MARK: HEADER DECLARATIONS
+//  Standard header files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//  Custom header files
+#include "System.h"
+#include "ResultWriter.h"
+#include "LinearAlgebra.h"
+#include "DynamicSolver.h"
+#include "01aReactionKinetics.h"
+#include "F49CC_T1.h"
+#include "01bKineticReactor.h"
+
+/// MARK: SUBROUTINE DEFINITIONS
+#define maxstrlen 128
+#define PI 3.14159265358979323846
+#define newtontol 1e-10     // Relative convergence tolerance of the mole balances.
+#define newtonmaxiter 100
+#define scanpoints 400      // Temperatures used to bracket the CSTR steady states.
+#define illinoismaxiter 200
+#define profilepoints 20    // Intervals recorded for batch and plug flow profiles.
+
+/// MARK: VARIABLE INPUT
+void ReactorSpecVariable(const RxnSystem *sys, ReactorSpec *spec)
+{
+    char input[maxstrlen];
+    char prompt[maxstrlen];
+    int ns = sys->nspecies;
+    int control = 0;
+    
+    memset(spec, 0, sizeof(ReactorSpec));
+    control = 1;
+    while(control == 1)
+    {
+        printf("Reactor type: batch (1), plug flow (2) or continuous stirred tank (3)? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+                spec->type = ReactorBatch;
+                control = 0;
+                break;
+            case '2':
+                spec->type = ReactorPFR;
+                control = 0;
+                break;
+            case '3':
+                spec->type = ReactorCSTR;
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+    
+    control = 1;
+    while(control == 1)
+    {
+        printf("Energy balance: isothermal (1), adiabatic (2) or cooled (3)? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+                spec->energy = ReactorIsothermal;
+                control = 0;
+                break;
+            case '2':
+                spec->energy = ReactorAdiabatic;
+                control = 0;
+                break;
+            case '3':
+                spec->energy = ReactorCooled;
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+    
+    for(int i = 0; i < ns; ++i)
+    {
+        printf("%i. %s\n", i + 1, sys->name[i]);
+    }
+    spec->key = (int)inputDouble(0, 0, "key species for the conversion", "") - 1;
+    spec->key = (spec->key >= ns) ? ns - 1 : spec->key;
+    for(int i = 0; i < ns; ++i)
+    {
+        snprintf(prompt, sizeof(prompt), "%s concentration of %s", (spec->type == ReactorBatch) ? "initial" : "feed", sys->name[i]);
+        spec->C0[i] = inputDouble(1, 0, prompt, "mol/m3");
+    }
+    spec->T0 = inputDouble(1, 1, (spec->type == ReactorBatch) ? "initial temperature" : "feed temperature", "deg C");
+    spec->T0 = (spec->T0) + 273.15;
+    
+    switch(spec->type)
+    {
+        case ReactorBatch:
+            spec->V = inputDouble(0, 0, "reactor volume", "m3");
+            spec->tend = inputDouble(0, 0, "batch time", "s");
+            break;
+        case ReactorPFR:
+            spec->Q = inputDouble(0, 0, "volumetric flowrate", "m3/s");
+            spec->L = inputDouble(0, 0, "tube length", "m");
+            spec->D = inputDouble(0, 0, "tube diameter", "m");
+            spec->V = 0.25*PI*(spec->D)*(spec->D)*(spec->L);
+            break;
+        case ReactorCSTR:
+            spec->Q = inputDouble(0, 0, "volumetric flowrate", "m3/s");
+            spec->V = inputDouble(0, 0, "reactor volume", "m3");
+            break;
+        default:
+            break;
+    }
+    
+    spec->Tc = spec->T0;
+    if(spec->energy != ReactorIsothermal)
+    {
+        spec->rhoCp = inputDouble(0, 0, "volumetric heat capacity", "kJ/m3.K");
+        spec->rhoCp = (spec->rhoCp)*1000; // Conversion (kJ to J)
+    }
+    if(spec->energy == ReactorCooled)
+    {
+        spec->U = inputDouble(0, 0, "overall heat transfer coefficient", "W/m2.K");
+        if(spec->type != ReactorPFR)
+        {
+            spec->A = inputDouble(0, 0, "heat transfer area", "m2");
+        }
+        spec->Tc = inputDouble(1, 1, "coolant temperature", "deg C");
+        spec->Tc = (spec->Tc) + 273.15;
+    }
+}
+
+/// MARK: GENERAL CALCULATIONS
+double ReactorConversion(const ReactorSpec *spec, const double *C)
+{
+    double C0 = spec->C0[spec->key];
+    
+    return (C0 > 0.0) ? (C0 - C[spec->key])/C0 : 0.0;
+}
+
+typedef struct ReactorModelContext{
+    const RxnCompiled *rx;
+    const ReactorSpec *spec;
+} ReactorModelContext;
+
+/// This subroutine is used to evaluate the mole and energy balances of a batch or plug flow reactor. Used as the unit model of "DynIntegrate(...)".
+static void ReactorModel(double t, const double *y, double *f, int offset, void *params)
+{
+    ReactorModelContext *ctx = params;
+    const ReactorSpec *spec = ctx->spec;
+    int ns = ctx->rx->nspecies;
+    double Rnet[RxnMaxSpecies];
+    double T = y[offset + ns];
+    double q = 0.0;
+    double scale = 1.0;
+    double dTdx = 0.0;
+    (void)t;
+    
+    q = RxnProduction(ctx->rx, T, &y[offset], Rnet);
+    if(spec->type == ReactorPFR)
+    {
+        //  Balances per unit length of tube
+        double area = 0.25*PI*(spec->D)*(spec->D);
+        
+        scale = area/spec->Q;
+        dTdx = area*q;
+        if(spec->energy == ReactorCooled)
+        {
+            dTdx -= spec->U*PI*spec->D*(T - spec->Tc);
+        }
+        dTdx /= spec->Q*spec->rhoCp;
+    }else{
+        dTdx = q;
+        if(spec->energy == ReactorCooled)
+        {
+            dTdx -= spec->U*spec->A*(T - spec->Tc)/spec->V;
+        }
+        dTdx /= spec->rhoCp;
+    }
+    
+    for(int i = 0; i < ns; ++i)
+    {
+        f[offset + i] = scale*Rnet[i];
+    }
+    f[offset + ns] = (spec->energy == ReactorIsothermal) ? 0.0 : dTdx;
+}
+
+int ReactorIntegrate(const RxnCompiled *rx, const ReactorSpec *spec, int npoints, DynResult *res)
+{
+    DynSystem sys;
+    DynOptions opt;
+    ReactorModelContext ctx = {rx, spec};
+    int ns = rx->nspecies;
+    int u = 0;
+    double Ctot = 0.0;
+    
+    memset(&sys, 0, sizeof(DynSystem));
+    u = DynAddUnit(&sys, "Reactor", ns + 1, ReactorModel, &ctx);
+    for(int i = 0; i < ns; ++i)
+    {
+        DynSetState(&sys, u, i, "C", spec->C0[i], 1.0);
+        Ctot += spec->C0[i];
+    }
+    DynSetState(&sys, u, ns, "T", spec->T0, 1.0);
+    
+    opt.method = DynRosenbrock;
+    opt.rtol = 1e-6;
+    opt.atol = 1e-9*(Ctot + 1.0);
+    opt.tend = (spec->type == ReactorPFR) ? spec->L : spec->tend;
+    opt.dtout = opt.tend/((npoints > 0) ? npoints : 1);
+    opt.hmax = 0.0;
+    opt.maxsteps = 1000000;
+    
+    DynIntegrate(&sys, &opt, res);
+    DynSystemFree(&sys);
+    
+    return res->status;
+}
+
+int ReactorMassBalance(const RxnCompiled *rx, const ReactorSpec *spec, double T, double *C)
+{
+    int ns = rx->nspecies;
+    int pivot[RxnMaxSpecies];
+    double J[RxnMaxSpecies*RxnMaxSpecies];
+    double dRdT[RxnMaxSpecies];
+    double Rnet[RxnMaxSpecies];
+    double dC[RxnMaxSpecies];
+    double scale = 0.0;
+    
+    for(int i = 0; i < ns; ++i)
+    {
+        scale += spec->C0[i];
+    }
+    scale = (scale > 0.0) ? scale : 1.0;
+    
+    for(int iter = 0; iter < newtonmaxiter; ++iter)
+    {
+        double err = 0.0;
+        
+        //  0 = Q(C0 - C) + V R(C, T)
+        RxnProduction(rx, T, C, Rnet);
+        RxnJacobian(rx, T, C, J, dRdT, NULL, NULL);
+        for(int i = 0; i < ns; ++i)
+        {
+            dC[i] = -(spec->Q*(spec->C0[i] - C[i]) + spec->V*Rnet[i]);
+            for(int k = 0; k < ns; ++k)
+            {
+                J[i*ns + k] *= spec->V;
+            }
+            J[i*ns + i] -= spec->Q;
+        }
+        if(LUDecompose(ns, J, pivot) != 0)
+        {
+            return 1;
+        }
+        LUSolve(ns, J, pivot, dC);
+        
+        //  Concentrations are kept positive by limiting each step to 90 % of the way to zero.
+        for(int i = 0; i < ns; ++i)
+        {
+            if(C[i] + dC[i] < 0.0)
+            {
+                dC[i] = -0.9*C[i];
+            }
+            C[i] += dC[i];
+            err = fmax(err, fabs(dC[i]));
+        }
+        if(err < newtontol*scale)
+        {
+            return 0;
+        }
+    }
+    
+    return 1;
+}
+
+/// This subroutine is used to solve the mole balances at a temperature and return the heat generated less the heat removed (W).
+/// @param rx Compiled reaction network.
+/// @param spec Reactor specification.
+/// @param T Temperature (K).
+/// @param C Initial estimate of the outlet concentrations, overwritten with the solution (mol/m3).
+static double ReactorHeatBalance(const RxnCompiled *rx, const ReactorSpec *spec, double T, double *C)
+{
+    int ns = rx->nspecies;
+    double Rnet[RxnMaxSpecies];
+    double q = 0.0;
+    
+    if(ReactorMassBalance(rx, spec, T, C) != 0)
+    {
+        //  Restart from the feed if the previous solution was a poor estimate.
+        memcpy(C, spec->C0, ns*sizeof(double));
+        ReactorMassBalance(rx, spec, T, C);
+    }
+    q = RxnProduction(rx, T, C, Rnet);
+    
+    return spec->V*q - spec->Q*spec->rhoCp*(T - spec->T0) - ((spec->energy == ReactorCooled) ? spec->U*spec->A*(T - spec->Tc) : 0.0);
+}
+
+int ReactorCSTRSolve(const RxnCompiled *rx, const ReactorSpec *spec, ReactorSteady *ss)
+{
+    int ns = rx->nspecies;
+    double C[RxnMaxSpecies];
+    double Cprev[RxnMaxSpecies];
+    double Ctot = 0.0;
+    double dTexo = 0.0;
+    double dTendo = 0.0;
+    double Tlo = 0.0;
+    double Thi = 0.0;
+    double Tprev = 0.0;
+    double Fprev = 0.0;
+    
+    ss->nss = 0;
+    memcpy(C, spec->C0, ns*sizeof(double));
+    if(spec->energy == ReactorIsothermal)
+    {
+        ReactorMassBalance(rx, spec, spec->T0, C);
+        ss->T[0] = spec->T0;
+        memcpy(ss->C, C, ns*sizeof(double));
+        ss->X[0] = ReactorConversion(spec, C);
+        ss->stable[0] = 1;
+        ss->nss = 1;
+        return 1;
+    }
+    
+    //  Bounding the temperature range with the largest possible adiabatic temperature change of each reaction
+    for(int i = 0; i < ns; ++i)
+    {
+        Ctot += spec->C0[i];
+    }
+    for(int j = 0; j < rx->nrxn; ++j)
+    {
+        double numin = 0.0;
+        
+        for(int s = rx->sstart[j]; s < rx->sstart[j + 1]; ++s)
+        {
+            if(rx->snu[s] < 0.0 && (numin == 0.0 || -rx->snu[s] < numin))
+            {
+                numin = -rx->snu[s];
+            }
+        }
+        numin = (numin > 0.0) ? numin : 1.0;
+        if(rx->dH[j] < 0.0)
+        {
+            dTexo -= rx->dH[j]*Ctot/(numin*spec->rhoCp);
+        }else{
+            dTendo += rx->dH[j]*Ctot/(numin*spec->rhoCp);
+        }
+    }
+    Tlo = fmin(spec->T0, spec->Tc) - dTendo - 1.0;
+    Tlo = (Tlo > 1.0) ? Tlo : 1.0;
+    Thi = fmax(spec->T0, spec->Tc) + dTexo + 1.0;
+    
+    //  Scanning the heat balance with the mole balances continued from one temperature to the next
+    Tprev = Tlo;
+    Fprev = ReactorHeatBalance(rx, spec, Tprev, C);
+    memcpy(Cprev, C, ns*sizeof(double));
+    for(int k = 1; k <= scanpoints && ss->nss < ReactorMaxSteady; ++k)
+    {
+        double T = Tlo + (Thi - Tlo)*k/scanpoints;
+        double F = ReactorHeatBalance(rx, spec, T, C);
+        
+        if((Fprev > 0.0 && F <= 0.0) || (Fprev < 0.0 && F >= 0.0))
+        {
+            //  Illinois refinement of the bracket [Tprev, T]
+            double Ta = Tprev;
+            double Tb = T;
+            double Fa = Fprev;
+            double Fb = F;
+            double Tr = T;
+            double Cr[RxnMaxSpecies];
+            int side = 0;
+            
+            memcpy(Cr, Cprev, ns*sizeof(double));
+            for(int iter = 0; iter < illinoismaxiter && Fb != 0.0; ++iter)
+            {
+                double Fr = 0.0;
+                
+                Tr = (Ta*Fb - Tb*Fa)/(Fb - Fa);
+                Fr = ReactorHeatBalance(rx, spec, Tr, Cr);
+                if(Fr*Fb > 0.0)
+                {
+                    Tb = Tr;
+                    Fb = Fr;
+                    if(side == -1)
+                    {
+                        Fa *= 0.5;
+                    }
+                    side = -1;
+                }else{
+                    Ta = Tb;
+                    Fa = Fb;
+                    Tb = Tr;
+                    Fb = Fr;
+                    side = 1;
+                }
+                if(fabs(Tb - Ta) < 1e-10*Tr || Fr == 0.0)
+                {
+                    break;
+                }
+            }
+            ss->T[ss->nss] = Tr;
+            memcpy(&ss->C[ss->nss*ns], Cr, ns*sizeof(double));
+            ss->X[ss->nss] = ReactorConversion(spec, Cr);
+            //  Heat removal rising faster than heat generation
+            ss->stable[ss->nss] = (Fprev > 0.0);
+            ss->nss++;
+        }
+        Tprev = T;
+        Fprev = F;
+        memcpy(Cprev, C, ns*sizeof(double));
+    }
+    
+    return ss->nss;
+}
+
+/// MARK: DISPLAY AND WRITE
+static void KineticReactorPrint(ResultWriter *w, const RxnSystem *sys, const ReactorSpec *spec, const DynResult *res, const ReactorSteady *ss)
+{
+    const char *type[4] = {"", "Batch reactor", "Plug flow reactor", "Continuous stirred tank reactor"};
+    const char *energy[3] = {"Isothermal", "Adiabatic", "Cooled"};
+    int ns = sys->nspecies;
+    
+    writerPrintf(w, "_Kinetic_Reactor_Results_\n");
+    writerPrintf(w, "%s\n", type[spec->type]);
+    writerPrintf(w, "%s\n\n", energy[spec->energy]);
+    
+    writerPrintf(w, "\tInput parameters:\n");
+    writerPrintf(w, "%s temperature:\n", (spec->type == ReactorBatch) ? "Initial" : "Feed");
+    writerPrintf(w, "T0 =\t%.3f\tdeg C\n", spec->T0 - 273.15);
+    if(spec->type != ReactorBatch)
+    {
+        writerPrintf(w, "Volumetric flowrate:\n");
+        writerPrintf(w, "Q =\t%.5g\tm3/s\n", spec->Q);
+        writerPrintf(w, "Space time:\n");
+        writerPrintf(w, "tau =\t%.5g\ts\n", spec->V/spec->Q);
+    }else{
+        writerPrintf(w, "Batch time:\n");
+        writerPrintf(w, "t =\t%.5g\ts\n", spec->tend);
+    }
+    writerPrintf(w, "Reactor volume:\n");
+    writerPrintf(w, "V =\t%.5g\tm3\n", spec->V);
+    if(spec->energy == ReactorCooled)
+    {
+        writerPrintf(w, "Coolant temperature:\n");
+        writerPrintf(w, "Tc =\t%.3f\tdeg C\n", spec->Tc - 273.15);
+    }
+    writerPrintf(w, "\n");
+    
+    writerPrintf(w, "\tOutput parameters:\n");
+    if(spec->type == ReactorCSTR)
+    {
+        writerPrintf(w, "Steady states found:\n");
+        writerPrintf(w, "n =\t%i\n\n", ss->nss);
+        writerPrintf(w, "State\tT (deg C)\tX (-)\tStability");
+        for(int i = 0; i < ns; ++i)
+        {
+            writerPrintf(w, "\t%s (mol/m3)", sys->name[i]);
+        }
+        writerPrintf(w, "\n");
+        for(int k = 0; k < ss->nss; ++k)
+        {
+            writerPrintf(w, "%i\t%.3f\t%.6f\t%s", k + 1, ss->T[k] - 273.15, ss->X[k], (ss->stable[k]) ? "Stable" : "Unstable");
+            for(int i = 0; i < ns; ++i)
+            {
+                writerPrintf(w, "\t%.6g", ss->C[k*ns + i]);
+            }
+            writerPrintf(w, "\n");
+        }
+        return;
+    }
+    
+    writerPrintf(w, "Integrator steps:\n");
+    writerPrintf(w, "n =\t%i\n", res->stats.nsteps);
+    if(res->status < 0)
+    {
+        writerPrintf(w, "The integrator failed before the end of the %s.\n", (spec->type == ReactorPFR) ? "tube" : "batch");
+    }
+    writerPrintf(w, "\n%s\tT (deg C)\tX (-)", (spec->type == ReactorPFR) ? "z (m)" : "t (s)");
+    for(int i = 0; i < ns; ++i)
+    {
+        writerPrintf(w, "\t%s (mol/m3)", sys->name[i]);
+    }
+    writerPrintf(w, "\n");
+    for(int k = 0; k < res->nout; ++k)
+    {
+        const double *y = &res->y[k*res->n];
+        
+        writerPrintf(w, "%.5g\t%.3f\t%.6f", res->t[k], y[ns] - 273.15, ReactorConversion(spec, y));
+        for(int i = 0; i < ns; ++i)
+        {
+            writerPrintf(w, "\t%.6g", y[i]);
+        }
+        writerPrintf(w, "\n");
+    }
+}
+
+void KineticReactorDisplay(const RxnSystem *sys, const ReactorSpec *spec, const DynResult *res, const ReactorSteady *ss)
+{
+    ResultWriter w;             // Console writer for the results.
+    
+    if(writerConsole(&w))
+    {
+        KineticReactorPrint(&w, sys, spec, res, ss);
+        writerClose(&w);
+    }
+}
+
+void KineticReactorWrite(const RxnSystem *sys, const ReactorSpec *spec, const DynResult *res, const ReactorSteady *ss)
+{
+    //  Function variables
+    ResultWriter w;             // Buffered writer for the results file.
+    
+    //  Set file name as timestamp + Kinetic Reactor Results
+    if(!writerOpen(&w, "Kinetic Reactor Results"))
+    {
+        return;
+    }
+    
+    //  Write to file
+    KineticReactorPrint(&w, sys, spec, res, ss);
+    
+    //  Close file
+    writerClose(&w);
+}
+
+void KineticReactorWriteSwitch(const RxnSystem *sys, const ReactorSpec *spec, const DynResult *res, const ReactorSteady *ss)
+{
+    int control = 0;
+    
+    control = 1;
+    while(control == 1)
+    {
+        char input[maxstrlen];
+        
+        printf("Do you want to save results to file? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+            case 'T':
+            case 'Y':
+            case 't':
+            case 'y':
+                KineticReactorWrite(sys, spec, res, ss);
+                control = 0;
+                break;
+            case '0':
+            case 'F':
+            case 'N':
+            case 'f':
+            case 'n':
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+}
+
+/// MARK: PSEUDO-MAIN FUNCTION
+void KineticReactor(void)
+{
+    int whilmain = 0;
+    printf("Kinetic Reactor Design\n");
+    
+    whilmain = 1;
+    while(whilmain == 1)
+    {
+        //  Variable declaration
+        RxnSystem sys;
+        RxnCompiled rx;
+        ReactorSpec spec;
+        DynResult res;
+        ReactorSteady ss;
+            //  Variables for timing function
+        struct timespec start, end;
+        double elapsed = 0.0;
+        
+        //  Data Collection
+        RxnSystemVariable(&sys);
+        ReactorSpecVariable(&sys, &spec);
+        
+        //  Data Manipulation
+        clock_getres(CLOCK_MONOTONIC, &start);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        
+        memset(&res, 0, sizeof(DynResult));
+        ss.nss = 0;
+        RxnCompile(&sys, &rx);
+        if(spec.type == ReactorCSTR)
+        {
+            ReactorCSTRSolve(&rx, &spec, &ss);
+        }else{
+            ReactorIntegrate(&rx, &spec, profilepoints, &res);
+        }
+        
+        clock_getres(CLOCK_MONOTONIC, &end);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        elapsed = timer(start, end);
+
+        printf("Calculations completed in %.6f seconds.\n", elapsed);
+        
+        //  Displaying results
+        KineticReactorDisplay(&sys, &spec, &res, &ss);
+        
+        //  Writing to File
+        KineticReactorWriteSwitch(&sys, &spec, &res, &ss);
+        
+        DynResultFree(&res);
+        
+        //  Continue function
+        whilmain = Continue(whilmain);
+    }
+    fflush(stdout);
+}
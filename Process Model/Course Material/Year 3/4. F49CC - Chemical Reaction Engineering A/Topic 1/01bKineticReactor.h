@@ -0,0 +1,127 @@
+//
+//  01bKineticReactor.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef _1bKineticReactorStruct_h
+#define _1bKineticReactorStruct_h
+
+//  Reactor types
+#define ReactorBatch 1          // Well-mixed batch reactor, integrated in time.
+#define ReactorPFR 2            // Plug flow reactor, integrated along its length.
+#define ReactorCSTR 3           // Continuous stirred tank reactor at steady state.
+
+//  Energy balances
+#define ReactorIsothermal 0     // Temperature held at the feed temperature.
+#define ReactorAdiabatic 1      // No heat exchange with the surroundings.
+#define ReactorCooled 2         // Heat exchange with a coolant at constant temperature.
+
+#define ReactorMaxSteady 8      // Largest number of CSTR steady states reported.
+
+typedef struct ReactorSpec{
+    int type;                       // Reactor type.
+    int energy;                     // Energy balance.
+    int key;                        // Species used to report the conversion.
+    double C0[RxnMaxSpecies];       // Feed or initial concentrations (mol/m3).
+    double T0;                      // Feed or initial temperature (K).
+    double Q;                       // Volumetric flowrate (m3/s). PFR and CSTR only.
+    double V;                       // Reactor volume (m3). Batch and CSTR only.
+    double L;                       // Tube length (m). PFR only.
+    double D;                       // Tube diameter (m). PFR only.
+    double tend;                    // Batch time (s). Batch only.
+    double rhoCp;                   // Volumetric heat capacity of the reacting liquid (J/m3.K).
+    double U;                       // Overall heat transfer coefficient (W/m2.K).
+    double A;                       // Heat transfer area (m2). Batch and CSTR only; the PFR uses its wall.
+    double Tc;                      // Coolant temperature (K).
+} ReactorSpec;
+
+typedef struct ReactorSteady{
+    int nss;                                        // Number of steady states found.
+    double T[ReactorMaxSteady];                     // Temperature of each steady state (K).
+    double C[ReactorMaxSteady*RxnMaxSpecies];       // Outlet concentrations of each steady state (mol/m3).
+    double X[ReactorMaxSteady];                     // Conversion of the key species ([ ]).
+    int stable[ReactorMaxSteady];                   // Slope criterion: stable (1) or unstable (0).
+} ReactorSteady;
+
+#endif /* _1bKineticReactorStruct_h */
+
+#ifndef _1bKineticReactorCalc_h
+#define _1bKineticReactorCalc_h
+
+/// This subroutine is used to calculate the conversion of the key species.
+/// @param spec Reactor specification.
+/// @param C Concentrations (mol/m3).
+double ReactorConversion(const ReactorSpec *spec, const double *C);
+
+/// This subroutine is used to integrate the mole and energy balances of a batch reactor in time or of a plug flow reactor along its length with the stiff Rosenbrock integrator. This function returns the integrator status.
+/// @param rx Compiled reaction network.
+/// @param spec Reactor specification.
+/// @param npoints Number of recorded intervals.
+/// @param res Struct where the profile should be stored. The states are the concentrations followed by the temperature. Released by "DynResultFree(...)".
+int ReactorIntegrate(const RxnCompiled *rx, const ReactorSpec *spec, int npoints, DynResult *res);
+
+/// This subroutine is used to solve the CSTR mole balances at a fixed temperature by Newton's method with the analytic rate Jacobian. This function returns 0 on success or 1 if Newton's method fails.
+/// @param rx Compiled reaction network.
+/// @param spec Reactor specification.
+/// @param T Temperature (K).
+/// @param C Initial estimate of the outlet concentrations, overwritten with the solution (mol/m3).
+int ReactorMassBalance(const RxnCompiled *rx, const ReactorSpec *spec, double T, double *C);
+
+/// This subroutine is used to find every steady state of a CSTR. The heat generation and removal curves are scanned across the feasible temperature range and each crossing is refined with the Illinois method. This function returns the number of steady states found.
+/// @param rx Compiled reaction network.
+/// @param spec Reactor specification.
+/// @param ss Struct where the steady states should be stored.
+int ReactorCSTRSolve(const RxnCompiled *rx, const ReactorSpec *spec, ReactorSteady *ss);
+
+#endif /* _1bKineticReactorCalc_h */
+
+#ifndef _1bKineticReactorVariable_h
+#define _1bKineticReactorVariable_h
+
+/// This subroutine is used to collect the reactor type and specification. The reaction network must already be stored.
+/// @param sys Reaction network.
+/// @param spec Struct where the reactor specification should be stored.
+void ReactorSpecVariable(const RxnSystem *sys, ReactorSpec *spec);
+
+#endif /* _1bKineticReactorVariable_h */
+
+#ifndef _1bKineticReactorDisplay_h
+#define _1bKineticReactorDisplay_h
+
+/// This subroutine is used to output the reactor profile or steady states to the user console.
+/// @param sys Reaction network.
+/// @param spec Reactor specification.
+/// @param res Batch or plug flow profile.
+/// @param ss CSTR steady states.
+void KineticReactorDisplay(const RxnSystem *sys, const ReactorSpec *spec, const DynResult *res, const ReactorSteady *ss);
+
+/// This subroutine is used to write the reactor profile or steady states to a .txt file.
+/// @param sys Reaction network.
+/// @param spec Reactor specification.
+/// @param res Batch or plug flow profile.
+/// @param ss CSTR steady states.
+void KineticReactorWrite(const RxnSystem *sys, const ReactorSpec *spec, const DynResult *res, const ReactorSteady *ss);
+
+/// This subroutine is used to check if the user would like to write the results to a file.
+/// @param sys Reaction network.
+/// @param spec Reactor specification.
+/// @param res Batch or plug flow profile.
+/// @param ss CSTR steady states.
+void KineticReactorWriteSwitch(const RxnSystem *sys, const ReactorSpec *spec, const DynResult *res, const ReactorSteady *ss);
+
+#endif /* _1bKineticReactorDisplay_h */
@@ -0,0 +1,302 @@
+//
+//  01cReactorSweep.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+/// MARK: HEADER DECLARATIONS
+//  Standard header files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//  Custom header files
+#include "System.h"
+#include "ResultWriter.h"
+#include "Parallel.h"
+#include "DynamicSolver.h"
+#include "01aReactionKinetics.h"
+#include "01bKineticReactor.h"
+#include "F49CC_T1.h"
+#include "01cReactorSweep.h"
+
+/// MARK: SUBROUTINE DEFINITIONS
+#define maxstrlen 128
+#define sweepbatch 2        // Smallest number of grid points handed to one thread.
+
+/// MARK: VARIABLE INPUT
+static void ReactorSweepVariable(RxnSystem *sys, ReactorSpec *spec, int *ntau, double **tau, int *nT, double **T0)
+{
+    double tmin = 0.0;
+    double tmax = 0.0;
+    double Tmin = 0.0;
+    double Tmax = 0.0;
+    
+    RxnSystemVariable(sys);
+    ReactorSpecVariable(sys, spec);
+    
+    printf("The %s is replaced by each residence time of the sweep.\n", (spec->type == ReactorBatch) ? "batch time" : "flowrate");
+    tmin = inputDouble(0, 0, "shortest residence time", "s");
+    tmax = inputDouble(0, 0, "longest residence time", "s");
+    *ntau = (int)inputDouble(0, 0, "number of residence times", "");
+    Tmin = inputDouble(1, 1, "lowest feed temperature", "deg C");
+    Tmax = inputDouble(1, 1, "highest feed temperature", "deg C");
+    *nT = (int)inputDouble(0, 0, "number of feed temperatures", "");
+    
+    //  Residence times are spaced logarithmically, feed temperatures linearly.
+    *tau = calloc(*ntau, sizeof(double));
+    *T0 = calloc(*nT, sizeof(double));
+    for(int i = 0; i < *ntau; ++i)
+    {
+        (*tau)[i] = (*ntau > 1) ? tmin*pow(tmax/tmin, (double)i/(*ntau - 1)) : tmin;
+    }
+    for(int k = 0; k < *nT; ++k)
+    {
+        (*T0)[k] = ((*nT > 1) ? Tmin + (Tmax - Tmin)*k/(*nT - 1) : Tmin) + 273.15;
+    }
+}
+
+/// MARK: GENERAL CALCULATIONS
+typedef struct ReactorSweepContext{
+    const RxnCompiled *rx;
+    const ReactorSpec *spec;
+    int nT;
+    const double *tau;
+    const double *T0;
+    ReactorSweepPoint *pts;
+} ReactorSweepContext;
+
+/// This subroutine is used to solve a block of grid points. Used as the kernel of "parallelFor(...)".
+static void ReactorSweepBlock(int start, int end, void *context)
+{
+    ReactorSweepContext *ctx = context;
+    int ns = ctx->rx->nspecies;
+    
+    for(int p = start; p < end; ++p)
+    {
+        ReactorSweepPoint *pt = &ctx->pts[p];
+        ReactorSpec spec = *ctx->spec;
+        
+        pt->tau = ctx->tau[p/ctx->nT];
+        pt->T0 = ctx->T0[p%ctx->nT];
+        spec.T0 = pt->T0;
+        if(spec.energy != ReactorCooled)
+        {
+            spec.Tc = spec.T0;
+        }
+        if(spec.type == ReactorBatch)
+        {
+            spec.tend = pt->tau;
+        }else{
+            spec.Q = spec.V/pt->tau;
+        }
+        
+        if(spec.type == ReactorCSTR)
+        {
+            ReactorSteady ss;
+            
+            ReactorCSTRSolve(ctx->rx, &spec, &ss);
+            pt->nss = ss.nss;
+            pt->status = (ss.nss > 0) ? 0 : -1;
+            if(ss.nss > 0)
+            {
+                pt->X = ss.X[0];
+                pt->T = ss.T[0];
+                pt->Xhi = ss.X[ss.nss - 1];
+                pt->Thi = ss.T[ss.nss - 1];
+            }
+        }else{
+            DynResult res;
+            const double *y = NULL;
+            
+            pt->status = (ReactorIntegrate(ctx->rx, &spec, 1, &res) < 0) ? -1 : 0;
+            y = &res.y[(res.nout - 1)*res.n];
+            pt->X = ReactorConversion(&spec, y);
+            pt->T = y[ns];
+            pt->Xhi = pt->X;
+            pt->Thi = pt->T;
+            pt->nss = 1;
+            DynResultFree(&res);
+        }
+    }
+}
+
+void ReactorSweepCalculation(const RxnCompiled *rx, const ReactorSpec *spec, int ntau, const double *tau, int nT, const double *T0, ReactorSweepPoint *pts)
+{
+    ReactorSweepContext ctx = {rx, spec, nT, tau, T0, pts};
+    
+    memset(pts, 0, (size_t)ntau*nT*sizeof(ReactorSweepPoint));
+    parallelFor(ntau*nT, sweepbatch, ReactorSweepBlock, &ctx);
+}
+
+/// MARK: DISPLAY AND WRITE
+static void ReactorSweepPrint(ResultWriter *w, const ReactorSpec *spec, int npts, const ReactorSweepPoint *pts)
+{
+    const char *type[4] = {"", "Batch reactor", "Plug flow reactor", "Continuous stirred tank reactor"};
+    const char *energy[3] = {"Isothermal", "Adiabatic", "Cooled"};
+    int failed = 0;
+    
+    for(int p = 0; p < npts; ++p)
+    {
+        failed += (pts[p].status != 0);
+    }
+    
+    writerPrintf(w, "_Reactor_Parametric_Sweep_Results_\n");
+    writerPrintf(w, "%s\n", type[spec->type]);
+    writerPrintf(w, "%s\n\n", energy[spec->energy]);
+    writerPrintf(w, "Grid points:\n");
+    writerPrintf(w, "n =\t%i\n", npts);
+    writerPrintf(w, "Failed points:\n");
+    writerPrintf(w, "n =\t%i\n\n", failed);
+    
+    if(spec->type == ReactorCSTR)
+    {
+        writerPrintf(w, "tau (s)\tT0 (deg C)\tSteady states\tX low (-)\tT low (deg C)\tX high (-)\tT high (deg C)\n");
+        for(int p = 0; p < npts; ++p)
+        {
+            writerPrintf(w, "%.5g\t%.3f\t%i\t%.6f\t%.3f\t%.6f\t%.3f\n", pts[p].tau, pts[p].T0 - 273.15, pts[p].nss, pts[p].X, pts[p].T - 273.15, pts[p].Xhi, pts[p].Thi - 273.15);
+        }
+    }else{
+        writerPrintf(w, "%s\tT0 (deg C)\tX (-)\tT out (deg C)\n", (spec->type == ReactorBatch) ? "t (s)" : "tau (s)");
+        for(int p = 0; p < npts; ++p)
+        {
+            writerPrintf(w, "%.5g\t%.3f\t%.6f\t%.3f\n", pts[p].tau, pts[p].T0 - 273.15, pts[p].X, pts[p].T - 273.15);
+        }
+    }
+}
+
+void ReactorSweepDisplay(const ReactorSpec *spec, int npts, const ReactorSweepPoint *pts)
+{
+    ResultWriter w;             // Console writer for the results.
+    
+    if(writerConsole(&w))
+    {
+        ReactorSweepPrint(&w, spec, npts, pts);
+        writerClose(&w);
+    }
+}
+
+void ReactorSweepWrite(const ReactorSpec *spec, int npts, const ReactorSweepPoint *pts)
+{
+    //  Function variables
+    ResultWriter w;             // Buffered writer for the results file.
+    
+    //  Set file name as timestamp + Reactor Sweep Results
+    if(!writerOpen(&w, "Reactor Sweep Results"))
+    {
+        return;
+    }
+    
+    //  Write to file
+    ReactorSweepPrint(&w, spec, npts, pts);
+    
+    //  Close file
+    writerClose(&w);
+}
+
+void ReactorSweepWriteSwitch(const ReactorSpec *spec, int npts, const ReactorSweepPoint *pts)
+{
+    int control = 0;
+    
+    control = 1;
+    while(control == 1)
+    {
+        char input[maxstrlen];
+        
+        printf("Do you want to save results to file? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+            case 'T':
+            case 'Y':
+            case 't':
+            case 'y':
+                ReactorSweepWrite(spec, npts, pts);
+                control = 0;
+                break;
+            case '0':
+            case 'F':
+            case 'N':
+            case 'f':
+            case 'n':
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+}
+
+/// MARK: PSEUDO-MAIN FUNCTION
+void ReactorSweep(void)
+{
+    int whilmain = 0;
+    printf("Reactor Parametric Sweep\n");
+    
+    whilmain = 1;
+    while(whilmain == 1)
+    {
+        //  Variable declaration
+        RxnSystem sys;
+        RxnCompiled rx;
+        ReactorSpec spec;
+        ReactorSweepPoint *pts = NULL;
+        double *tau = NULL;
+        double *T0 = NULL;
+        int ntau = 0;
+        int nT = 0;
+            //  Variables for timing function
+        struct timespec start, end;
+        double elapsed = 0.0;
+        
+        //  Data Collection
+        ReactorSweepVariable(&sys, &spec, &ntau, &tau, &nT, &T0);
+        
+        //  Data Manipulation
+        clock_getres(CLOCK_MONOTONIC, &start);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        
+        pts = calloc((size_t)ntau*nT, sizeof(ReactorSweepPoint));
+        RxnCompile(&sys, &rx);
+        ReactorSweepCalculation(&rx, &spec, ntau, tau, nT, T0, pts);
+        
+        clock_getres(CLOCK_MONOTONIC, &end);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        elapsed = timer(start, end);
+
+        printf("Calculations completed in %.6f seconds.\n", elapsed);
+        
+        //  Displaying results
+        ReactorSweepDisplay(&spec, ntau*nT, pts);
+        
+        //  Writing to File
+        ReactorSweepWriteSwitch(&spec, ntau*nT, pts);
+        
+        free(pts);
+        free(tau);
+        free(T0);
+        
+        //  Continue function
+        whilmain = Continue(whilmain);
+    }
+    fflush(stdout);
+}
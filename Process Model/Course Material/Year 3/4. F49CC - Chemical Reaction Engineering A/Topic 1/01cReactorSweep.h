@@ -0,0 +1,73 @@
+//
+//  01cReactorSweep.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef _1cReactorSweepStruct_h
+#define _1cReactorSweepStruct_h
+
+typedef struct ReactorSweepPoint{
+    double tau;                 // Residence time or batch time (s).
+    double T0;                  // Feed or initial temperature (K).
+    double X;                   // Conversion of the key species at the outlet, or at the coolest steady state ([ ]).
+    double T;                   // Outlet temperature, or temperature of the coolest steady state (K).
+    double Xhi;                 // Conversion at the hottest steady state ([ ]). CSTR only.
+    double Thi;                 // Temperature of the hottest steady state (K). CSTR only.
+    int nss;                    // Number of steady states. CSTR only.
+    int status;                 // Solved (0) or failed (-1).
+} ReactorSweepPoint;
+
+#endif /* _1cReactorSweepStruct_h */
+
+#ifndef _1cReactorSweepCalc_h
+#define _1cReactorSweepCalc_h
+
+/// This subroutine is used to solve a reactor over a grid of residence times and feed temperatures. Grid points are independent and are solved in parallel.
+/// @param rx Compiled reaction network.
+/// @param spec Reactor specification. The flowrate (or batch time) and feed temperature are replaced at each grid point.
+/// @param ntau Number of residence times.
+/// @param tau Residence times (s).
+/// @param nT Number of feed temperatures.
+/// @param T0 Feed temperatures (K).
+/// @param pts Array of ntau x nT points where the results should be stored, with the feed temperature varying fastest.
+void ReactorSweepCalculation(const RxnCompiled *rx, const ReactorSpec *spec, int ntau, const double *tau, int nT, const double *T0, ReactorSweepPoint *pts);
+
+#endif /* _1cReactorSweepCalc_h */
+
+#ifndef _1cReactorSweepDisplay_h
+#define _1cReactorSweepDisplay_h
+
+/// This subroutine is used to output the parametric sweep to the user console.
+/// @param spec Reactor specification.
+/// @param npts Number of grid points.
+/// @param pts Grid points.
+void ReactorSweepDisplay(const ReactorSpec *spec, int npts, const ReactorSweepPoint *pts);
+
+/// This subroutine is used to write the parametric sweep to a .txt file.
+/// @param spec Reactor specification.
+/// @param npts Number of grid points.
+/// @param pts Grid points.
+void ReactorSweepWrite(const ReactorSpec *spec, int npts, const ReactorSweepPoint *pts);
+
+/// This subroutine is used to check if the user would like to write the results to a file.
+/// @param spec Reactor specification.
+/// @param npts Number of grid points.
+/// @param pts Grid points.
+void ReactorSweepWriteSwitch(const ReactorSpec *spec, int npts, const ReactorSweepPoint *pts);
+
+#endif /* _1cReactorSweepDisplay_h */
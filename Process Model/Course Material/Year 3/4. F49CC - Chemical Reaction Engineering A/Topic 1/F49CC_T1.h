@@ -0,0 +1,30 @@
+//
+//  F49CC_T1.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef F49CC_T1_h
+#define F49CC_T1_h
+
+/// This subroutine is used to guide the user through simulating a batch, plug flow or continuous stirred tank reactor with power-law Arrhenius kinetics.
+void KineticReactor(void);
+
+/// This subroutine is used to guide the user through sweeping a reactor over a grid of residence times and feed temperatures.
+void ReactorSweep(void);
+
+#endif /* F49CC_T1_h */
@@ -0,0 +1,89 @@
+//
+//  B49CE.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+//  Standard header files
+#include <stdio.h>
+#include <stdlib.h>
+
+//  Custom header files
+#include "Courses.h"
+#include "B49CEMenu.h"
+#include "B49CE_T1.h"
+
+#define maxstrlen 128
+
+void B49CETopComm(){
+    printf("Please select from the following programs: \n");
+}
+
+void B49CEtopic1(){
+    char input[maxstrlen];
+    int control = 0;
+    
+    control = 1;
+    while(control == 1){
+        B49CETopComm();
+        printf("1. Activity Coefficient Models (NRTL, Wilson, UNIQUAC, UNIFAC).\n");
+        printf("q. Exit topic. \n\n");
+        printf("Selection [1]: ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0]){
+            case '1':
+                ActivityModels();
+                break;
+            case '0':
+            case 'Q':
+            case 'q':
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised. Please enter 1 or q.\n");
+                break;
+        }
+    }
+}
+
+void B49CE(){
+    char input[maxstrlen];      // Variable where character input is stored.
+    int control = 0;            // Variable used to control user input.
+    printf("Multiphase Thermodynamics\n\n");
+    
+    control = 1;
+    while(control == 1){
+        printf("Please select from the following topics:\n");
+        printf("T1: Activity Coefficient Models\n\nq. Quit course\n\n");
+        printf("Topic ");
+        fgets(input,sizeof(input),stdin);
+        switch(input[0]){
+            case '1':
+                B49CEtopic1();
+                break;
+            case '0':
+            case 'Q':
+            case 'q':
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised. Please enter 1 or q.\n");
+                break;
+        }
+        fflush(stdout);
+    }
+}
@@ -0,0 +1,866 @@
+//
+//  01aActivity.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+/// MARK: HEADER DECLARATIONS
+//  Standard header files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//  Custom header files
+#include "System.h"
+#include "ResultWriter.h"
+#include "B49CE_T1.h"
+#include "01aActivity.h"
+
+/// MARK: SUBROUTINE DEFINITIONS
+#define maxstrlen 128
+#define R 8.3145            // J/(mol.K)
+#define zcoord 10.0         // Lattice coordination number used by UNIQUAC and UNIFAC.
+
+/// MARK: VARIABLE INPUT
+static int ActModelSelect(void)
+{
+    char input[maxstrlen];
+    int model = ActNRTL;
+    int control = 0;
+    
+    control = 1;
+    while(control == 1)
+    {
+        printf("Activity coefficient model: NRTL (1), Wilson (2), UNIQUAC (3) or UNIFAC (4)? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+                model = ActNRTL;
+                control = 0;
+                break;
+            case '2':
+                model = ActWilson;
+                control = 0;
+                break;
+            case '3':
+                model = ActUNIQUAC;
+                control = 0;
+                break;
+            case '4':
+                model = ActUNIFAC;
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+    return model;
+}
+
+static void ActGroupVariable(ActModel *act)
+{
+    char prompt[maxstrlen];
+    int n = act->ncomp;
+    int g = 0;
+    
+    g = (int)inputDouble(0, 0, "number of distinct UNIFAC subgroups", "");
+    g = (g > ActMaxGroups) ? ActMaxGroups : g;
+    act->ngroup = g;
+    for(int k = 0; k < g; ++k)
+    {
+        printf("Subgroup %i:\n", k + 1);
+        act->main[k] = (int)inputDouble(0, 0, "main group number", "");
+        act->Rk[k] = inputDouble(0, 0, "volume parameter R", "[ ]");
+        act->Qk[k] = inputDouble(1, 0, "surface area parameter Q", "[ ]");
+    }
+    
+    //  Interaction parameters belong to main groups, so each pair of main groups is only asked for once.
+    for(int m = 0; m < g; ++m)
+    {
+        for(int k = 0; k < g; ++k)
+        {
+            int found = 0;
+            
+            if(act->main[m] == act->main[k])
+            {
+                act->amn[m*g + k] = 0.0;
+                continue;
+            }
+            for(int mm = 0; mm <= m && found == 0; ++mm)
+            {
+                for(int kk = 0; kk < g; ++kk)
+                {
+                    if(mm == m && kk == k)
+                    {
+                        break;
+                    }
+                    if(act->main[mm] == act->main[m] && act->main[kk] == act->main[k])
+                    {
+                        act->amn[m*g + k] = act->amn[mm*g + kk];
+                        found = 1;
+                        break;
+                    }
+                }
+            }
+            if(found == 0)
+            {
+                snprintf(prompt, sizeof(prompt), "group interaction a(%i, %i)", act->main[m], act->main[k]);
+                act->amn[m*g + k] = inputDouble(1, 1, prompt, "K");
+            }
+        }
+    }
+    
+    for(int i = 0; i < n; ++i)
+    {
+        for(int k = 0; k < g; ++k)
+        {
+            snprintf(prompt, sizeof(prompt), "occurrences of subgroup %i in %s", k + 1, act->name[i]);
+            act->nu[i*g + k] = inputDouble(1, 0, prompt, "");
+        }
+    }
+    ActGroupParameters(act);
+}
+
+void ActModelVariable(ActModel *act)
+{
+    char prompt[maxstrlen];
+    int n = act->ncomp;
+    
+    act->model = ActModelSelect();
+    switch(act->model)
+    {
+        case ActNRTL:
+            for(int i = 0; i < n; ++i)
+            {
+                for(int j = i + 1; j < n; ++j)
+                {
+                    snprintf(prompt, sizeof(prompt), "NRTL non-randomness alpha(%s, %s)", act->name[i], act->name[j]);
+                    act->alpha[i*n + j] = inputDouble(1, 0, prompt, "[ ]");
+                    act->alpha[j*n + i] = act->alpha[i*n + j];
+                }
+            }
+            break;
+        case ActWilson:
+            for(int i = 0; i < n; ++i)
+            {
+                snprintf(prompt, sizeof(prompt), "liquid molar volume of %s", act->name[i]);
+                act->V[i] = inputDouble(0, 0, prompt, "cm3/mol");
+            }
+            break;
+        case ActUNIQUAC:
+            for(int i = 0; i < n; ++i)
+            {
+                snprintf(prompt, sizeof(prompt), "UNIQUAC volume parameter r of %s", act->name[i]);
+                act->r[i] = inputDouble(0, 0, prompt, "[ ]");
+                snprintf(prompt, sizeof(prompt), "UNIQUAC surface area parameter q of %s", act->name[i]);
+                act->q[i] = inputDouble(0, 0, prompt, "[ ]");
+            }
+            break;
+        case ActUNIFAC:
+            ActGroupVariable(act);
+            return;
+        default:
+            break;
+    }
+    
+    for(int i = 0; i < n; ++i)
+    {
+        for(int j = 0; j < n; ++j)
+        {
+            if(i == j)
+            {
+                continue;
+            }
+            snprintf(prompt, sizeof(prompt), "energy parameter a(%s, %s)", act->name[i], act->name[j]);
+            act->a[i*n + j] = inputDouble(1, 1, prompt, "K");
+        }
+    }
+}
+
+static void ActivityVariable(ActModel *act, double *T, double *x)
+{
+    char input[maxstrlen];
+    char prompt[maxstrlen];
+    double sum = 0.0;
+    int n = 0;
+    
+    n = (int)inputDouble(0, 0, "number of components", "");
+    n = (n > ActMaxComp) ? ActMaxComp : n;
+    ActModelInit(act, n, ActNRTL);
+    for(int i = 0; i < n; ++i)
+    {
+        printf("Component %i name: ", i + 1);
+        fgets(input, sizeof(input), stdin);
+        input[strcspn(input, "\r\n")] = '\0';
+        snprintf(act->name[i], ActNameLength, "%.*s", ActNameLength - 1, input);
+    }
+    ActModelVariable(act);
+    
+    *T = inputDouble(1, 1, "temperature", "deg C");
+    *T = (*T) + 273.15;
+    for(int i = 0; i < n; ++i)
+    {
+        snprintf(prompt, sizeof(prompt), "mole fraction of %s", act->name[i]);
+        x[i] = inputDouble(1, 0, prompt, "[ ]");
+        sum += x[i];
+    }
+    if(sum <= 0.0)
+    {
+        printf("The mole fractions sum to zero. An equimolar mixture is used instead.\n");
+        for(int i = 0; i < n; ++i)
+        {
+            x[i] = 1.0;
+        }
+        sum = n;
+    }
+    for(int i = 0; i < n; ++i)
+    {
+        x[i] = x[i]/sum;
+    }
+}
+
+/// MARK: GENERAL CALCULATIONS
+void ActModelInit(ActModel *act, int ncomp, int model)
+{
+    memset(act, 0, sizeof(*act));
+    act->ncomp = ncomp;
+    act->model = model;
+}
+
+void ActGroupParameters(ActModel *act)
+{
+    int g = act->ngroup;
+    
+    for(int i = 0; i < act->ncomp; ++i)
+    {
+        act->r[i] = 0.0;
+        act->q[i] = 0.0;
+        for(int k = 0; k < g; ++k)
+        {
+            act->r[i] += act->nu[i*g + k]*act->Rk[k];
+            act->q[i] += act->nu[i*g + k]*act->Qk[k];
+        }
+    }
+}
+
+void ActStateReset(ActState *st)
+{
+    st->T = -1.0;
+}
+
+/// This subroutine is used to calculate the residual term shared by UNIQUAC and the UNIFAC groups, lnG_k = Q_k[1 - ln(s_k) - sum_m theta_m tau_km/s_m] with s_k = sum_m theta_m tau_mk.
+/// @param n Number of species (components for UNIQUAC, subgroups for UNIFAC).
+/// @param Q Surface area parameters.
+/// @param theta Surface area fractions.
+/// @param tau Interaction table at the current temperature.
+/// @param s Weighted sums s_k. Needed by "ActAreaDerivative(...)".
+/// @param lnG Residual activity coefficients.
+static void ActAreaResidual(int n, const double *Q, const double *theta, const double *tau, double *s, double *lnG)
+{
+    double t[ActMaxGroups];
+    
+    for(int k = 0; k < n; ++k)
+    {
+        s[k] = 0.0;
+        for(int m = 0; m < n; ++m)
+        {
+            s[k] += theta[m]*tau[m*n + k];
+        }
+    }
+    for(int m = 0; m < n; ++m)
+    {
+        t[m] = (s[m] > 0.0) ? theta[m]/s[m] : 0.0;
+    }
+    for(int k = 0; k < n; ++k)
+    {
+        double sum = 0.0;
+        
+        for(int m = 0; m < n; ++m)
+        {
+            sum += t[m]*tau[k*n + m];
+        }
+        lnG[k] = (s[k] > 0.0) ? Q[k]*(1.0 - log(s[k]) - sum) : 0.0;
+    }
+}
+
+/// This subroutine is used to calculate the directional derivative of "ActAreaResidual(...)" for a change dtheta in the surface area fractions and dtau in the interaction table.
+/// @param n Number of species.
+/// @param Q Surface area parameters.
+/// @param theta Surface area fractions.
+/// @param tau Interaction table.
+/// @param s Weighted sums from "ActAreaResidual(...)".
+/// @param dtheta Change in the surface area fractions. Treated as zero when NULL.
+/// @param dtau Change in the interaction table. Treated as zero when NULL.
+/// @param dlnG Change in the residual activity coefficients.
+static void ActAreaDerivative(int n, const double *Q, const double *theta, const double *tau, const double *s, const double *dtheta, const double *dtau, double *dlnG)
+{
+    double ds[ActMaxGroups];
+    double t[ActMaxGroups];
+    double dt[ActMaxGroups];
+    
+    for(int k = 0; k < n; ++k)
+    {
+        ds[k] = 0.0;
+        for(int m = 0; m < n; ++m)
+        {
+            ds[k] += (dtheta == NULL) ? 0.0 : dtheta[m]*tau[m*n + k];
+            ds[k] += (dtau == NULL) ? 0.0 : theta[m]*dtau[m*n + k];
+        }
+    }
+    for(int m = 0; m < n; ++m)
+    {
+        if(s[m] > 0.0)
+        {
+            t[m] = theta[m]/s[m];
+            dt[m] = (((dtheta == NULL) ? 0.0 : dtheta[m]) - t[m]*ds[m])/s[m];
+        }
+        else
+        {
+            t[m] = 0.0;
+            dt[m] = 0.0;
+        }
+    }
+    for(int k = 0; k < n; ++k)
+    {
+        double sum = 0.0;
+        
+        for(int m = 0; m < n; ++m)
+        {
+            sum += tau[k*n + m]*dt[m];
+            sum += (dtau == NULL) ? 0.0 : dtau[k*n + m]*t[m];
+        }
+        dlnG[k] = (s[k] > 0.0) ? -Q[k]*(ds[k]/s[k] + sum) : 0.0;
+    }
+}
+
+void ActTemperature(const ActModel *act, ActState *st, double T)
+{
+    int n = act->ncomp;
+    int g = act->ngroup;
+    
+    if(st->T == T)
+    {
+        return;
+    }
+    
+    switch(act->model)
+    {
+        case ActNRTL:
+            for(int k = 0; k < n*n; ++k)
+            {
+                st->tau[k] = act->a[k]/T;
+                st->dtau[k] = -st->tau[k]/T;
+                st->G[k] = exp(-act->alpha[k]*st->tau[k]);
+                st->dG[k] = -act->alpha[k]*st->dtau[k]*st->G[k];
+            }
+            break;
+        case ActWilson:
+            for(int i = 0; i < n; ++i)
+            {
+                for(int j = 0; j < n; ++j)
+                {
+                    st->tau[i*n + j] = (act->V[j]/act->V[i])*exp(-act->a[i*n + j]/T);
+                    st->dtau[i*n + j] = st->tau[i*n + j]*act->a[i*n + j]/(T*T);
+                }
+            }
+            break;
+        case ActUNIQUAC:
+            for(int k = 0; k < n*n; ++k)
+            {
+                st->tau[k] = exp(-act->a[k]/T);
+                st->dtau[k] = st->tau[k]*act->a[k]/(T*T);
+            }
+            break;
+        case ActUNIFAC:
+            for(int k = 0; k < g*g; ++k)
+            {
+                st->tau[k] = exp(-act->amn[k]/T);
+                st->dtau[k] = st->tau[k]*act->amn[k]/(T*T);
+            }
+            //  Group residual activity coefficients in each pure component
+            for(int i = 0; i < n; ++i)
+            {
+                double theta[ActMaxGroups];
+                double s[ActMaxGroups];
+                
+                for(int k = 0; k < g; ++k)
+                {
+                    theta[k] = (act->q[i] > 0.0) ? act->Qk[k]*act->nu[i*g + k]/act->q[i] : 0.0;
+                }
+                ActAreaResidual(g, act->Qk, theta, st->tau, s, &st->lnGpure[i*g]);
+                ActAreaDerivative(g, act->Qk, theta, st->tau, s, NULL, st->dtau, &st->dlnGpure[i*g]);
+            }
+            break;
+        default:
+            break;
+    }
+    st->T = T;
+}
+
+static void ActNRTLGamma(const ActModel *act, ActState *st, const double *x)
+{
+    int n = act->ncomp;
+    double phi[ActMaxComp];
+    double dphi[ActMaxComp];
+    double eps[ActMaxComp];
+    double deps[ActMaxComp];
+    const double *tau = st->tau;
+    const double *G = st->G;
+    
+    for(int j = 0; j < n; ++j)
+    {
+        double theta = 0.0;
+        double dtheta = 0.0;
+        
+        phi[j] = 0.0;
+        dphi[j] = 0.0;
+        for(int k = 0; k < n; ++k)
+        {
+            phi[j] += x[k]*G[k*n + j];
+            dphi[j] += x[k]*st->dG[k*n + j];
+            theta += x[k]*tau[k*n + j]*G[k*n + j];
+            dtheta += x[k]*(st->dtau[k*n + j]*G[k*n + j] + tau[k*n + j]*st->dG[k*n + j]);
+        }
+        eps[j] = theta/phi[j];
+        deps[j] = (dtheta - eps[j]*dphi[j])/phi[j];
+    }
+    
+    for(int i = 0; i < n; ++i)
+    {
+        st->lngamma[i] = eps[i];
+        st->dlngdT[i] = deps[i];
+        for(int j = 0; j < n; ++j)
+        {
+            double d = tau[i*n + j] - eps[j];
+            
+            st->lngamma[i] += x[j]*G[i*n + j]*d/phi[j];
+            st->dlngdT[i] += x[j]*((st->dG[i*n + j]*d + G[i*n + j]*(st->dtau[i*n + j] - deps[j]))/phi[j] - G[i*n + j]*d*dphi[j]/(phi[j]*phi[j]));
+        }
+    }
+    
+    //  Mole fraction derivatives, converted to mole number derivatives by "ActActivityProject(...)"
+    for(int i = 0; i < n; ++i)
+    {
+        for(int l = i; l < n; ++l)
+        {
+            double D = G[l*n + i]*(tau[l*n + i] - eps[i])/phi[i] + G[i*n + l]*(tau[i*n + l] - eps[l])/phi[l];
+            
+            for(int j = 0; j < n; ++j)
+            {
+                D -= x[j]*G[i*n + j]*G[l*n + j]*(tau[l*n + j] + tau[i*n + j] - 2.0*eps[j])/(phi[j]*phi[j]);
+            }
+            st->dlngdn[i*n + l] = D;
+            st->dlngdn[l*n + i] = D;
+        }
+    }
+}
+
+static void ActWilsonGamma(const ActModel *act, ActState *st, const double *x)
+{
+    int n = act->ncomp;
+    double S[ActMaxComp];
+    double dS[ActMaxComp];
+    const double *L = st->tau;
+    const double *dL = st->dtau;
+    
+    for(int k = 0; k < n; ++k)
+    {
+        S[k] = 0.0;
+        dS[k] = 0.0;
+        for(int j = 0; j < n; ++j)
+        {
+            S[k] += x[j]*L[k*n + j];
+            dS[k] += x[j]*dL[k*n + j];
+        }
+    }
+    
+    for(int i = 0; i < n; ++i)
+    {
+        st->lngamma[i] = 1.0 - log(S[i]);
+        st->dlngdT[i] = -dS[i]/S[i];
+        for(int k = 0; k < n; ++k)
+        {
+            st->lngamma[i] -= x[k]*L[k*n + i]/S[k];
+            st->dlngdT[i] -= x[k]*(dL[k*n + i] - L[k*n + i]*dS[k]/S[k])/S[k];
+        }
+    }
+    
+    for(int i = 0; i < n; ++i)
+    {
+        for(int l = i; l < n; ++l)
+        {
+            double D = -L[i*n + l]/S[i] - L[l*n + i]/S[l];
+            
+            for(int k = 0; k < n; ++k)
+            {
+                D += x[k]*L[k*n + i]*L[k*n + l]/(S[k]*S[k]);
+            }
+            st->dlngdn[i*n + l] = D;
+            st->dlngdn[l*n + i] = D;
+        }
+    }
+}
+
+/// This subroutine is used to convert mole fraction derivatives d ln(gamma_i)/dx_l into mole number derivatives n d ln(gamma_i)/dn_l = d ln(gamma_i)/dx_l - sum_k x_k d ln(gamma_i)/dx_k.
+/// @param n Number of components.
+/// @param x Mole fractions.
+/// @param D Mole fraction derivatives, overwritten with the mole number derivatives.
+static void ActActivityProject(int n, const double *x, double *D)
+{
+    for(int i = 0; i < n; ++i)
+    {
+        double sum = 0.0;
+        
+        for(int k = 0; k < n; ++k)
+        {
+            sum += x[k]*D[i*n + k];
+        }
+        for(int l = 0; l < n; ++l)
+        {
+            D[i*n + l] -= sum;
+        }
+    }
+}
+
+/// This subroutine is used to calculate the UNIQUAC combinatorial term. Its mole number derivatives are added directly to the derivative matrix.
+/// @param act Model description.
+/// @param st Model state.
+/// @param x Mole fractions.
+static void ActCombinatorial(const ActModel *act, ActState *st, const double *x)
+{
+    int n = act->ncomp;
+    double l[ActMaxComp];
+    double rbar = 0.0;
+    double qbar = 0.0;
+    double lbar = 0.0;
+    
+    for(int i = 0; i < n; ++i)
+    {
+        l[i] = 0.5*zcoord*(act->r[i] - act->q[i]) - (act->r[i] - 1.0);
+        rbar += x[i]*act->r[i];
+        qbar += x[i]*act->q[i];
+        lbar += x[i]*l[i];
+    }
+    
+    for(int i = 0; i < n; ++i)
+    {
+        double ri = act->r[i];
+        double qi = act->q[i];
+        
+        st->lngamma[i] += log(ri/rbar) + 0.5*zcoord*qi*log(qi*rbar/(ri*qbar)) + l[i] - ri*lbar/rbar;
+        for(int j = 0; j < n; ++j)
+        {
+            //  The mole fraction derivatives of this term always sum to -1 when weighted by x.
+            st->dlngdn[i*n + j] += 1.0 - act->r[j]/rbar + 0.5*zcoord*qi*(act->r[j]/rbar - act->q[j]/qbar) - ri*l[j]/rbar + ri*lbar*act->r[j]/(rbar*rbar);
+        }
+    }
+}
+
+static void ActUNIQUACGamma(const ActModel *act, ActState *st, const double *x)
+{
+    int n = act->ncomp;
+    double theta[ActMaxComp] = {0};
+    double dtheta[ActMaxComp];
+    double s[ActMaxComp];
+    double dlnG[ActMaxComp];
+    double qbar = 0.0;
+    
+    for(int i = 0; i < n; ++i)
+    {
+        qbar += x[i]*act->q[i];
+    }
+    for(int i = 0; i < n; ++i)
+    {
+        theta[i] = x[i]*act->q[i]/qbar;
+    }
+    
+    ActAreaResidual(n, act->q, theta, st->tau, s, st->lngamma);
+    ActAreaDerivative(n, act->q, theta, st->tau, s, NULL, st->dtau, st->dlngdT);
+    for(int l = 0; l < n; ++l)
+    {
+        //  Change in the area fractions on adding component l
+        for(int m = 0; m < n; ++m)
+        {
+            dtheta[m] = (((m == l) ? act->q[m] : 0.0) - theta[m]*act->q[l])/qbar;
+        }
+        ActAreaDerivative(n, act->q, theta, st->tau, s, dtheta, NULL, dlnG);
+        for(int i = 0; i < n; ++i)
+        {
+            st->dlngdn[i*n + l] = dlnG[i];
+        }
+    }
+    ActCombinatorial(act, st, x);
+}
+
+static void ActUNIFACGamma(const ActModel *act, ActState *st, const double *x)
+{
+    int n = act->ncomp;
+    int g = act->ngroup;
+    double theta[ActMaxGroups];
+    double dtheta[ActMaxGroups];
+    double s[ActMaxGroups];
+    double lnG[ActMaxGroups];
+    double dlnG[ActMaxGroups];
+    double W = 0.0;
+    
+    //  Group surface area fractions
+    for(int k = 0; k < g; ++k)
+    {
+        theta[k] = 0.0;
+        for(int i = 0; i < n; ++i)
+        {
+            theta[k] += act->nu[i*g + k]*x[i];
+        }
+        theta[k] *= act->Qk[k];
+        W += theta[k];
+    }
+    for(int k = 0; k < g; ++k)
+    {
+        theta[k] /= W;
+    }
+    
+    ActAreaResidual(g, act->Qk, theta, st->tau, s, lnG);
+    ActAreaDerivative(g, act->Qk, theta, st->tau, s, NULL, st->dtau, dlnG);
+    for(int i = 0; i < n; ++i)
+    {
+        const double *nu = &act->nu[i*g];
+        
+        st->lngamma[i] = 0.0;
+        st->dlngdT[i] = 0.0;
+        for(int k = 0; k < g; ++k)
+        {
+            st->lngamma[i] += nu[k]*(lnG[k] - st->lnGpure[i*g + k]);
+            st->dlngdT[i] += nu[k]*(dlnG[k] - st->dlnGpure[i*g + k]);
+        }
+    }
+    
+    for(int l = 0; l < n; ++l)
+    {
+        for(int k = 0; k < g; ++k)
+        {
+            dtheta[k] = (act->Qk[k]*act->nu[l*g + k] - theta[k]*act->q[l])/W;
+        }
+        ActAreaDerivative(g, act->Qk, theta, st->tau, s, dtheta, NULL, dlnG);
+        for(int i = 0; i < n; ++i)
+        {
+            double sum = 0.0;
+            
+            for(int k = 0; k < g; ++k)
+            {
+                sum += act->nu[i*g + k]*dlnG[k];
+            }
+            st->dlngdn[i*n + l] = sum;
+        }
+    }
+    ActCombinatorial(act, st, x);
+}
+
+void ActivityCoefficients(const ActModel *act, ActState *st, double T, const double *x)
+{
+    int n = act->ncomp;
+    
+    ActTemperature(act, st, T);
+    switch(act->model)
+    {
+        case ActNRTL:
+            ActNRTLGamma(act, st, x);
+            ActActivityProject(n, x, st->dlngdn);
+            break;
+        case ActWilson:
+            ActWilsonGamma(act, st, x);
+            ActActivityProject(n, x, st->dlngdn);
+            break;
+        case ActUNIQUAC:
+            ActUNIQUACGamma(act, st, x);
+            break;
+        case ActUNIFAC:
+            ActUNIFACGamma(act, st, x);
+            break;
+        default:
+            break;
+    }
+    
+    st->gE = 0.0;
+    st->hE = 0.0;
+    for(int i = 0; i < n; ++i)
+    {
+        st->gE += x[i]*st->lngamma[i];
+        st->hE -= T*x[i]*st->dlngdT[i];
+    }
+}
+
+/// MARK: DISPLAY AND WRITE
+static void ActivityPrint(ResultWriter *w, const ActModel *act, const ActState *st, double T, const double *x)
+{
+    const char *model[4] = {"NRTL", "Wilson", "UNIQUAC", "UNIFAC"};
+    int n = act->ncomp;
+    
+    writerPrintf(w, "_Activity_Coefficient_Results_\n");
+    writerPrintf(w, "Activity coefficient model:\n");
+    writerPrintf(w, "%s\n\n", model[act->model]);
+    
+    writerPrintf(w, "\tInput parameters:\n");
+    writerPrintf(w, "Temperature:\n");
+    writerPrintf(w, "T =\t%.3f\tdeg C\n\n", T - 273.15);
+    
+    writerPrintf(w, "\tOutput parameters:\n");
+    writerPrintf(w, "Excess Gibbs energy:\n");
+    writerPrintf(w, "gE/RT =\t%.6f\t[ ]\n", st->gE);
+    writerPrintf(w, "gE =\t%.4f\tJ/mol\n", st->gE*R*T);
+    writerPrintf(w, "Excess enthalpy:\n");
+    writerPrintf(w, "hE =\t%.4f\tJ/mol\n", st->hE*R*T);
+    writerPrintf(w, "Excess entropy:\n");
+    writerPrintf(w, "sE =\t%.5f\tJ/mol.K\n\n", (st->hE - st->gE)*R);
+    
+    writerPrintf(w, "Component\tx (-)\tgamma (-)\tdln(gamma)/dT (1/K)\n");
+    for(int i = 0; i < n; ++i)
+    {
+        writerPrintf(w, "%s\t%.6f\t%.6f\t%.6g\n", act->name[i], x[i], exp(st->lngamma[i]), st->dlngdT[i]);
+    }
+    
+    writerPrintf(w, "\nComposition derivatives, n dln(gamma_i)/dn_j:\n");
+    writerPrintf(w, "i \\ j");
+    for(int j = 0; j < n; ++j)
+    {
+        writerPrintf(w, "\t%s", act->name[j]);
+    }
+    writerPrintf(w, "\n");
+    for(int i = 0; i < n; ++i)
+    {
+        writerPrintf(w, "%s", act->name[i]);
+        for(int j = 0; j < n; ++j)
+        {
+            writerPrintf(w, "\t%.6g", st->dlngdn[i*n + j]);
+        }
+        writerPrintf(w, "\n");
+    }
+}
+
+void ActivityDisplay(const ActModel *act, const ActState *st, double T, const double *x)
+{
+    ResultWriter w;             // Console writer for the results.
+    
+    if(writerConsole(&w))
+    {
+        ActivityPrint(&w, act, st, T, x);
+        writerClose(&w);
+    }
+}
+
+void ActivityWrite(const ActModel *act, const ActState *st, double T, const double *x)
+{
+    //  Function variables
+    ResultWriter w;             // Buffered writer for the results file.
+    
+    //  Set file name as timestamp + Activity Coefficient Results
+    if(!writerOpen(&w, "Activity Coefficient Results"))
+    {
+        return;
+    }
+    
+    //  Write to file
+    ActivityPrint(&w, act, st, T, x);
+    
+    //  Close file
+    writerClose(&w);
+}
+
+void ActivityWriteSwitch(const ActModel *act, const ActState *st, double T, const double *x)
+{
+    int control = 0;
+    
+    control = 1;
+    while(control == 1)
+    {
+        char input[maxstrlen];
+        
+        printf("Do you want to save results to file? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+            case 'T':
+            case 'Y':
+            case 't':
+            case 'y':
+                ActivityWrite(act, st, T, x);
+                control = 0;
+                break;
+            case '0':
+            case 'F':
+            case 'N':
+            case 'f':
+            case 'n':
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+}
+
+/// MARK: PSEUDO-MAIN FUNCTION
+void ActivityModels(void)
+{
+    int whilmain = 0;
+    printf("Activity Coefficient Models\n");
+    
+    whilmain = 1;
+    while(whilmain == 1)
+    {
+        //  Variable declaration
+        ActModel act;
+        ActState st;
+        double x[ActMaxComp];
+        double T = 0.0;
+            //  Variables for timing function
+        struct timespec start, end;
+        double elapsed = 0.0;
+        
+        //  Data Collection
+        ActivityVariable(&act, &T, x);
+        
+        //  Data Manipulation
+        clock_getres(CLOCK_MONOTONIC, &start);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        
+        ActStateReset(&st);
+        ActivityCoefficients(&act, &st, T, x);
+        
+        clock_getres(CLOCK_MONOTONIC, &end);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        elapsed = timer(start, end);
+
+        printf("Calculations completed in %.6f seconds.\n", elapsed);
+        
+        //  Displaying results
+        ActivityDisplay(&act, &st, T, x);
+        
+        //  Writing to File
+        ActivityWriteSwitch(&act, &st, T, x);
+        
+        //  Continue function
+        whilmain = Continue(whilmain);
+    }
+    fflush(stdout);
+}
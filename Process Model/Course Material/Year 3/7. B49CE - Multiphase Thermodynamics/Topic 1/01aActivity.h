@@ -0,0 +1,136 @@
+//
+//  01aActivity.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef _1aActivityStruct_h
+#define _1aActivityStruct_h
+
+#define ActMaxComp 32               // Largest number of components in a mixture.
+#define ActMaxGroups 32             // Largest number of distinct UNIFAC subgroups in a mixture.
+#define ActNameLength 32
+
+//  Activity coefficient models
+#define ActNRTL 0                   // Non-random two-liquid.
+#define ActWilson 1                 // Wilson.
+#define ActUNIQUAC 2                // Universal quasi-chemical.
+#define ActUNIFAC 3                 // UNIQUAC functional-group activity coefficients.
+
+typedef struct ActModel{
+    int ncomp;                                  // Number of components.
+    int model;                                  // Activity coefficient model.
+    char name[ActMaxComp][ActNameLength];       // Component names.
+    double a[ActMaxComp*ActMaxComp];            // Binary energy parameters a_ij = a[i*ncomp + j] (K). Not used by UNIFAC.
+    double alpha[ActMaxComp*ActMaxComp];        // Non-randomness parameters ([ ]). NRTL only.
+    double V[ActMaxComp];                       // Liquid molar volumes (cm3/mol). Wilson only.
+    double r[ActMaxComp];                       // Volume parameters ([ ]). UNIQUAC and UNIFAC.
+    double q[ActMaxComp];                       // Surface area parameters ([ ]). UNIQUAC and UNIFAC.
+    //  UNIFAC group description
+    int ngroup;                                 // Number of distinct subgroups.
+    int main[ActMaxGroups];                     // Main group of each subgroup.
+    double Rk[ActMaxGroups];                    // Subgroup volume parameters ([ ]).
+    double Qk[ActMaxGroups];                    // Subgroup surface area parameters ([ ]).
+    double nu[ActMaxComp*ActMaxGroups];         // Occurrences of subgroup k in component i, nu[i*ngroup + k].
+    double amn[ActMaxGroups*ActMaxGroups];      // Group interaction parameters a_mn = amn[m*ngroup + n] (K).
+} ActModel;
+
+typedef struct ActState{
+    //  Cached at one temperature
+    double T;                                   // Temperature of the cached parameters (K). Negative when empty.
+    double tau[ActMaxGroups*ActMaxGroups];      // NRTL tau_ij, Wilson Lambda_ij, UNIQUAC tau_ij or UNIFAC Psi_mn.
+    double dtau[ActMaxGroups*ActMaxGroups];     // Temperature derivatives of tau.
+    double G[ActMaxComp*ActMaxComp];            // NRTL G_ij = exp(-alpha_ij tau_ij).
+    double dG[ActMaxComp*ActMaxComp];           // Temperature derivatives of G.
+    double lnGpure[ActMaxComp*ActMaxGroups];    // UNIFAC group residual activity coefficients in each pure component.
+    double dlnGpure[ActMaxComp*ActMaxGroups];   // Temperature derivatives of lnGpure.
+    //  Calculated for one composition
+    double lngamma[ActMaxComp];                 // Natural logarithms of the activity coefficients.
+    double dlngdT[ActMaxComp];                  // Temperature derivatives of ln(gamma_i) (1/K).
+    double dlngdn[ActMaxComp*ActMaxComp];       // Composition derivatives n d ln(gamma_i)/dn_j = dlngdn[i*ncomp + j] ([ ]).
+    double gE;                                  // Excess Gibbs energy, gE/RT ([ ]).
+    double hE;                                  // Excess enthalpy, hE/RT ([ ]).
+} ActState;
+
+#endif /* _1aActivityStruct_h */
+
+#ifndef _1aActivityVariable_h
+#define _1aActivityVariable_h
+
+/// This subroutine is used to collect the activity coefficient model and its parameters. The number of components and their names must already be stored.
+/// @param act Struct where the model should be stored.
+void ActModelVariable(ActModel *act);
+
+#endif /* _1aActivityVariable_h */
+
+#ifndef _1aActivityCalc_h
+#define _1aActivityCalc_h
+
+/// This subroutine is used to clear an activity coefficient model. All parameters are set to zero.
+/// @param act Model description.
+/// @param ncomp Number of components.
+/// @param model Activity coefficient model.
+void ActModelInit(ActModel *act, int ncomp, int model);
+
+/// This subroutine is used to calculate the UNIQUAC volume and surface area parameters of each component from its UNIFAC subgroups.
+/// @param act Model description.
+void ActGroupParameters(ActModel *act);
+
+/// This subroutine is used to empty the temperature cache of an activity coefficient state. It must be called before first use and whenever the model description changes.
+/// @param st Model state.
+void ActStateReset(ActState *st);
+
+/// This subroutine is used to calculate the interaction tables at a temperature. For UNIFAC this includes the group residual activity coefficients of every pure component. Nothing is recalculated if the state already holds that temperature.
+/// @param act Model description.
+/// @param st Model state.
+/// @param T Temperature (K).
+void ActTemperature(const ActModel *act, ActState *st, double T);
+
+/// This subroutine is used to calculate the activity coefficients of a liquid mixture and their analytic temperature and composition derivatives.
+/// @param act Model description.
+/// @param st Model state.
+/// @param T Temperature (K).
+/// @param x Mole fractions.
+void ActivityCoefficients(const ActModel *act, ActState *st, double T, const double *x);
+
+#endif /* _1aActivityCalc_h */
+
+#ifndef _1aActivityDisplay_h
+#define _1aActivityDisplay_h
+
+/// This subroutine is used to output the activity coefficients and excess properties to the user console.
+/// @param act Model description.
+/// @param st Model state evaluated at the mixture.
+/// @param T Temperature (K).
+/// @param x Mole fractions.
+void ActivityDisplay(const ActModel *act, const ActState *st, double T, const double *x);
+
+/// This subroutine is used to write the activity coefficients and excess properties to a .txt file.
+/// @param act Model description.
+/// @param st Model state evaluated at the mixture.
+/// @param T Temperature (K).
+/// @param x Mole fractions.
+void ActivityWrite(const ActModel *act, const ActState *st, double T, const double *x);
+
+/// This subroutine is used to check if the user would like to write the results to a file.
+/// @param act Model description.
+/// @param st Model state evaluated at the mixture.
+/// @param T Temperature (K).
+/// @param x Mole fractions.
+void ActivityWriteSwitch(const ActModel *act, const ActState *st, double T, const double *x);
+
+#endif /* _1aActivityDisplay_h */
@@ -0,0 +1,35 @@
+//
+//  B49CFMenu.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef B49CFTopComm_h
+#define B49CFTopComm_h
+
+void B49CFTopComm(void);
+
+#endif /* B49CFTopComm_h */
+
+//  The following prototypes are used to declare topic menu functions for B49CF
+
+#ifndef B49CFtopic1_h
+#define B49CFtopic1_h
+
+void B49CFtopic1(void);
+
+#endif /* B49CFtopic1_h */
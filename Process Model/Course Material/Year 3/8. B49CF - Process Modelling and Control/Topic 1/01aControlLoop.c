@@ -0,0 +1,627 @@
+//
+//  01aControlLoop.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+/// MARK: HEADER DECLARATIONS
+//  Standard header files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//  Custom header files
+#include "System.h"
+#include "Parallel.h"
+#include "01aControlLoop.h"
+
+/// MARK: SUBROUTINE DEFINITIONS
+#define maxstrlen 128
+#define filterfactor 10.0   // Derivative filter factor used for every controller.
+#define tunegrid 12         // Candidate gains and integral times in each refinement.
+#define tunegridD 6         // Candidate derivative times in each refinement (PID only).
+#define tunerounds 4        // Refinements of the candidate grid.
+#define tunebatch 8         // Smallest number of candidates handed to one thread.
+
+/// MARK: VARIABLE INPUT
+static void CtrlSignalVariable(CtrlSignal *sig, const char *name)
+{
+    char input[maxstrlen];
+    int control = 0;
+    
+    control = 1;
+    while(control == 1)
+    {
+        printf("%s: none (1), step (2) or ramp (3)? ", name);
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+                sig->shape = CtrlNone;
+                control = 0;
+                break;
+            case '2':
+                sig->shape = CtrlStep;
+                control = 0;
+                break;
+            case '3':
+                sig->shape = CtrlRamp;
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+    if(sig->shape == CtrlNone)
+    {
+        return;
+    }
+    sig->t0 = inputDouble(1, 0, "time of change", "s");
+    sig->size = inputDouble(1, 1, "size of change", "");
+    if(sig->shape == CtrlRamp)
+    {
+        sig->rate = inputDouble(0, 0, "ramp rate", "1/s");
+    }
+}
+
+static void CtrlFOPDTVariable(CtrlFOPDT *p, const char *name)
+{
+    char prompt[maxstrlen];
+    
+    memset(p, 0, sizeof(CtrlFOPDT));
+    snprintf(prompt, sizeof(prompt), "%s gain", name);
+    p->K = inputDouble(1, 1, prompt, "");
+    snprintf(prompt, sizeof(prompt), "%s time constant", name);
+    p->tau = inputDouble(1, 0, prompt, "s");
+    snprintf(prompt, sizeof(prompt), "%s dead time", name);
+    p->theta = inputDouble(1, 0, prompt, "s");
+}
+
+static void CtrlPIDVariable(CtrlPID *pid, const char *name)
+{
+    char prompt[maxstrlen];
+    
+    snprintf(prompt, sizeof(prompt), "%s controller gain", name);
+    pid->Kc = inputDouble(1, 1, prompt, "");
+    snprintf(prompt, sizeof(prompt), "%s integral time (0 for none)", name);
+    pid->taui = inputDouble(1, 0, prompt, "s");
+    snprintf(prompt, sizeof(prompt), "%s derivative time", name);
+    pid->taud = inputDouble(1, 0, prompt, "s");
+}
+
+void CtrlLoopVariable(CtrlLoop *loop, int controller)
+{
+    char input[maxstrlen];
+    int control = 0;
+    
+    memset(loop, 0, sizeof(CtrlLoop));
+    control = 1;
+    while(control == 1)
+    {
+        printf("Loop structure: feedback (1), cascade (2) or ratio (3)? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+                loop->type = CtrlSingle;
+                control = 0;
+                break;
+            case '2':
+                loop->type = CtrlCascade;
+                control = 0;
+                break;
+            case '3':
+                loop->type = CtrlRatio;
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+    
+    loop->dt = inputDouble(0, 0, "sample time", "s");
+    loop->tend = inputDouble(0, 0, "simulation time", "s");
+    
+    CtrlFOPDTVariable(&loop->plant, (loop->type == CtrlRatio) ? "Flow loop" : "Process");
+    switch(loop->type)
+    {
+        case CtrlSingle:
+            CtrlFOPDTVariable(&loop->dist, "Disturbance");
+            if(YesNo("Do you want static feedforward from the measured disturbance? ") && loop->plant.K != 0.0)
+            {
+                loop->Kff = -loop->dist.K/loop->plant.K;
+            }
+            break;
+        case CtrlCascade:
+            CtrlFOPDTVariable(&loop->inplant, "Secondary process");
+            CtrlPIDVariable(&loop->inner, "Secondary");
+            break;
+        case CtrlRatio:
+            loop->ratio = inputDouble(0, 1, "flow ratio", "[ ]");
+            break;
+        default:
+            break;
+    }
+    
+    if(controller == 1)
+    {
+        CtrlPIDVariable(&loop->pid, (loop->type == CtrlCascade) ? "Primary" : "Feedback");
+    }
+    loop->pid.umin = -HUGE_VAL;
+    loop->pid.umax = HUGE_VAL;
+    if(YesNo("Do you want to limit the controller output? "))
+    {
+        loop->pid.umin = inputDouble(1, 1, "lower output limit (deviation)", "");
+        loop->pid.umax = inputDouble(1, 1, "upper output limit (deviation)", "");
+    }
+    loop->inner.umin = -HUGE_VAL;
+    loop->inner.umax = HUGE_VAL;
+    loop->pid.N = filterfactor;
+    loop->inner.N = filterfactor;
+    
+    if(loop->type == CtrlRatio)
+    {
+        loop->load.base = inputDouble(0, 1, "initial wild flow", "");
+        CtrlSignalVariable(&loop->load, "Wild flow change");
+    }else{
+        CtrlSignalVariable(&loop->sp, "Setpoint change");
+        CtrlSignalVariable(&loop->load, "Disturbance");
+    }
+}
+
+/// MARK: GENERAL CALCULATIONS
+double CtrlSignalValue(const CtrlSignal *sig, double t)
+{
+    double change = 0.0;
+    
+    if(sig->shape == CtrlNone || t <= sig->t0)
+    {
+        return sig->base;
+    }
+    if(sig->shape == CtrlStep)
+    {
+        return sig->base + sig->size;
+    }
+    change = fmin(fabs(sig->rate)*(t - sig->t0), fabs(sig->size));
+    
+    return sig->base + copysign(change, sig->size);
+}
+
+void CtrlPIDReset(CtrlPID *pid)
+{
+    pid->I = 0.0;
+    pid->D = 0.0;
+    pid->yprev = 0.0;
+}
+
+double CtrlPIDUpdate(CtrlPID *pid, double sp, double y, double uff, double dt)
+{
+    double e = sp - y;
+    double v = 0.0;
+    double u = 0.0;
+    
+    if(pid->taud > 0.0)
+    {
+        double Tf = (pid->N > 0.0) ? pid->taud/pid->N : 0.0;
+        
+        pid->D = (Tf*pid->D - pid->Kc*pid->taud*(y - pid->yprev))/(Tf + dt);
+    }else{
+        pid->D = 0.0;
+    }
+    pid->yprev = y;
+    
+    v = pid->Kc*e + pid->I + pid->D + uff;
+    u = fmin(fmax(v, pid->umin), pid->umax);
+    
+    if(pid->taui > 0.0)
+    {
+        double Tt = pid->Tt;
+        
+        if(Tt <= 0.0)
+        {
+            Tt = (pid->taud > 0.0) ? sqrt(pid->taui*pid->taud) : pid->taui;
+        }
+        //  Back-calculation: the integral is pulled towards the limit while the output saturates.
+        pid->I += pid->Kc*dt*e/pid->taui + dt*(u - v)/Tt;
+    }
+    
+    return u;
+}
+
+int CtrlFOPDTInit(CtrlFOPDT *p, double dt)
+{
+    p->y = 0.0;
+    p->a = (p->tau > 0.0) ? exp(-dt/p->tau) : 0.0;
+    p->ndelay = (int)floor(p->theta/dt + 0.5);
+    p->head = 0;
+    p->buf = NULL;
+    if(p->ndelay > 0)
+    {
+        p->buf = calloc(p->ndelay, sizeof(double));
+        if(p->buf == NULL)
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/// This subroutine is used to place a process at steady state with a constant input.
+/// @param p Process model.
+/// @param u Process input.
+static void CtrlFOPDTSteady(CtrlFOPDT *p, double u)
+{
+    for(int i = 0; i < p->ndelay; ++i)
+    {
+        p->buf[i] = u;
+    }
+    p->y = p->K*u;
+}
+
+double CtrlFOPDTStep(CtrlFOPDT *p, double u)
+{
+    double ud = u;
+    
+    if(p->ndelay > 0)
+    {
+        ud = p->buf[p->head];
+        p->buf[p->head] = u;
+        p->head = (p->head + 1 == p->ndelay) ? 0 : p->head + 1;
+    }
+    p->y = p->a*p->y + (1.0 - p->a)*p->K*ud;
+    
+    return p->y;
+}
+
+void CtrlFOPDTFree(CtrlFOPDT *p)
+{
+    free(p->buf);
+    p->buf = NULL;
+}
+
+int CtrlSimulate(const CtrlLoop *loop, double dtout, CtrlTrace *trace, CtrlPerformance *perf)
+{
+    CtrlPID pid = loop->pid;
+    CtrlPID inner = loop->inner;
+    CtrlFOPDT plant = loop->plant;
+    CtrlFOPDT inplant = loop->inplant;
+    CtrlFOPDT dist = loop->dist;
+    double dt = loop->dt;
+    double sp0 = 0.0;
+    double u0 = 0.0;
+    double y20 = 0.0;
+    double d0 = CtrlSignalValue(&loop->load, 0.0);
+    double bound = 0.0;
+    int nsteps = (int)floor(loop->tend/dt + 0.5);
+    int stride = 0;
+    int fail = 0;
+    
+    stride = (int)floor(dtout/dt + 0.5);
+    stride = (stride > 0) ? stride : 1;
+    memset(perf, 0, sizeof(CtrlPerformance));
+    
+    CtrlPIDReset(&pid);
+    CtrlPIDReset(&inner);
+    fail += CtrlFOPDTInit(&plant, dt);
+    fail += CtrlFOPDTInit(&inplant, dt);
+    fail += CtrlFOPDTInit(&dist, dt);
+    if(trace != NULL)
+    {
+        trace->n = 0;
+        trace->t = calloc(nsteps/stride + 1, sizeof(double));
+        trace->sp = calloc(nsteps/stride + 1, sizeof(double));
+        trace->y = calloc(nsteps/stride + 1, sizeof(double));
+        trace->u = calloc(nsteps/stride + 1, sizeof(double));
+        trace->y2 = calloc(nsteps/stride + 1, sizeof(double));
+        if(trace->t == NULL || trace->sp == NULL || trace->y == NULL || trace->u == NULL || trace->y2 == NULL)
+        {
+            CtrlTraceFree(trace);
+            fail = 1;
+        }
+    }
+    if(fail != 0)
+    {
+        CtrlFOPDTFree(&plant);
+        CtrlFOPDTFree(&inplant);
+        CtrlFOPDTFree(&dist);
+        perf->status = -2;
+        perf->ITAE = HUGE_VAL;
+        
+        return perf->status;
+    }
+    
+    //  Starting from the steady state at the initial setpoint and disturbance
+    switch(loop->type)
+    {
+        case CtrlSingle:
+            sp0 = CtrlSignalValue(&loop->sp, 0.0);
+            CtrlFOPDTSteady(&dist, d0);
+            u0 = (plant.K != 0.0) ? (sp0 - dist.y)/plant.K : 0.0;
+            CtrlFOPDTSteady(&plant, u0);
+            pid.I = u0 - loop->Kff*d0;
+            break;
+        case CtrlCascade:
+            sp0 = CtrlSignalValue(&loop->sp, 0.0);
+            y20 = (plant.K != 0.0) ? sp0/plant.K : 0.0;
+            u0 = (inplant.K != 0.0) ? y20/inplant.K - d0 : 0.0;
+            CtrlFOPDTSteady(&plant, y20);
+            CtrlFOPDTSteady(&inplant, u0 + d0);
+            pid.I = y20;
+            inner.I = u0;
+            inner.yprev = inplant.y;
+            break;
+        case CtrlRatio:
+            sp0 = loop->ratio*d0;
+            u0 = (plant.K != 0.0) ? sp0/plant.K : 0.0;
+            CtrlFOPDTSteady(&plant, u0);
+            pid.I = u0;
+            break;
+        default:
+            break;
+    }
+    pid.yprev = sp0;
+    bound = 1e6*(1.0 + fabs(sp0) + fabs(loop->sp.size) + fabs(d0) + fabs(loop->load.size));
+    
+    for(int k = 0; k < nsteps; ++k)
+    {
+        double t = k*dt;
+        double d = CtrlSignalValue(&loop->load, t);
+        double sp = (loop->type == CtrlRatio) ? loop->ratio*d : CtrlSignalValue(&loop->sp, t);
+        double y = plant.y + dist.y;
+        double y2 = d;
+        double u = 0.0;
+        double e = sp - y;
+        
+        switch(loop->type)
+        {
+            case CtrlSingle:
+                u = CtrlPIDUpdate(&pid, sp, y, loop->Kff*d, dt);
+                CtrlFOPDTStep(&plant, u);
+                CtrlFOPDTStep(&dist, d);
+                break;
+            case CtrlCascade:
+                y2 = inplant.y;
+                u = CtrlPIDUpdate(&inner, CtrlPIDUpdate(&pid, sp, y, 0.0, dt), y2, 0.0, dt);
+                CtrlFOPDTStep(&inplant, u + d);
+                CtrlFOPDTStep(&plant, inplant.y);
+                break;
+            case CtrlRatio:
+                u = CtrlPIDUpdate(&pid, sp, y, 0.0, dt);
+                CtrlFOPDTStep(&plant, u);
+                break;
+            default:
+                break;
+        }
+        
+        if(trace != NULL && k%stride == 0)
+        {
+            trace->t[trace->n] = t;
+            trace->sp[trace->n] = sp;
+            trace->y[trace->n] = y;
+            trace->u[trace->n] = u;
+            trace->y2[trace->n] = y2;
+            trace->n++;
+        }
+        
+        perf->IAE += fabs(e)*dt;
+        perf->ISE += e*e*dt;
+        perf->ITAE += t*fabs(e)*dt;
+        perf->emax = fmax(perf->emax, fabs(e));
+        if(!isfinite(plant.y) || fabs(plant.y) > bound)
+        {
+            perf->status = -1;
+            perf->ITAE = HUGE_VAL;
+            break;
+        }
+    }
+    
+    CtrlFOPDTFree(&plant);
+    CtrlFOPDTFree(&inplant);
+    CtrlFOPDTFree(&dist);
+    
+    return perf->status;
+}
+
+void CtrlTraceFree(CtrlTrace *trace)
+{
+    free(trace->t);
+    free(trace->sp);
+    free(trace->y);
+    free(trace->u);
+    free(trace->y2);
+    memset(trace, 0, sizeof(CtrlTrace));
+}
+
+void CtrlIMCTuning(const CtrlFOPDT *p, int pid, double *Kc, double *taui, double *taud)
+{
+    double tauc = p->theta;
+    
+    tauc = (tauc > 0.0) ? tauc : 0.1*p->tau;
+    if(p->K == 0.0 || tauc + p->theta <= 0.0)
+    {
+        *Kc = 0.0;
+        *taui = 0.0;
+        *taud = 0.0;
+    }else if(pid == 1)
+    {
+        *Kc = (2.0*p->tau + p->theta)/(p->K*(2.0*tauc + p->theta));
+        *taui = p->tau + 0.5*p->theta;
+        *taud = (p->tau > 0.0 || p->theta > 0.0) ? p->tau*p->theta/(2.0*p->tau + p->theta) : 0.0;
+    }else{
+        //  Skogestad (SIMC) PI rule
+        *Kc = p->tau/(p->K*(tauc + p->theta));
+        *taui = fmin(p->tau, 4.0*(tauc + p->theta));
+        *taud = 0.0;
+    }
+}
+
+typedef struct CtrlTuneContext{
+    const CtrlLoop *loop;
+    const double *Kc;
+    const double *taui;
+    const double *taud;
+    double *J;
+} CtrlTuneContext;
+
+/// This subroutine is used to simulate a block of candidate settings. Used as the kernel of "parallelFor(...)".
+static void CtrlTuneBlock(int start, int end, void *context)
+{
+    CtrlTuneContext *ctx = context;
+    
+    for(int c = start; c < end; ++c)
+    {
+        CtrlLoop loop = *ctx->loop;
+        CtrlPerformance perf;
+        
+        loop.pid.Kc = ctx->Kc[c];
+        loop.pid.taui = ctx->taui[c];
+        loop.pid.taud = ctx->taud[c];
+        CtrlSimulate(&loop, loop.tend, NULL, &perf);
+        ctx->J[c] = perf.ITAE;
+    }
+}
+
+/// This subroutine is used to tune one loop by refining a logarithmic grid of candidate settings around the IMC settings.
+/// @param loop Loop description.
+/// @param pid Set to 1 to tune a PID controller or 0 for a PI controller.
+/// @param res Struct where the tuning should be stored.
+/// @param parallel Set to 1 to simulate the candidates in parallel.
+static void CtrlTuneLoop(const CtrlLoop *loop, int pid, CtrlTuning *res, int parallel)
+{
+    CtrlTuneContext ctx;
+    int nD = (pid == 1) ? tunegridD : 1;
+    int ncand = tunegrid*tunegrid*nD;
+    double *Kc = malloc(ncand*sizeof(double));
+    double *taui = malloc(ncand*sizeof(double));
+    double *taud = malloc(ncand*sizeof(double));
+    double *J = malloc(ncand*sizeof(double));
+    double span = log(4.0);     // Half width of the grid in each direction (natural logarithm).
+    double cKc = 0.0;
+    double ci = 0.0;
+    double cd = 0.0;
+    
+    memset(res, 0, sizeof(CtrlTuning));
+    CtrlIMCTuning(&loop->plant, pid, &res->KcIMC, &res->tauiIMC, &res->taudIMC);
+    ctx.loop = loop;
+    ctx.Kc = &res->KcIMC;
+    ctx.taui = &res->tauiIMC;
+    ctx.taud = &res->taudIMC;
+    ctx.J = &res->ITAEIMC;
+    CtrlTuneBlock(0, 1, &ctx);
+    if(Kc == NULL || taui == NULL || taud == NULL || J == NULL)
+    {
+        free(Kc);
+        free(taui);
+        free(taud);
+        free(J);
+        res->status = -1;
+        return;
+    }
+    
+    res->Kc = res->KcIMC;
+    res->taui = res->tauiIMC;
+    res->taud = res->taudIMC;
+    res->ITAE = res->ITAEIMC;
+    res->nsim = 1;
+    cKc = res->KcIMC;
+    ci = (res->tauiIMC > 0.0) ? res->tauiIMC : loop->dt;
+    cd = (res->taudIMC > 0.0) ? res->taudIMC : 0.1*ci;
+    
+    ctx.Kc = Kc;
+    ctx.taui = taui;
+    ctx.taud = taud;
+    ctx.J = J;
+    for(int round = 0; round < tunerounds; ++round)
+    {
+        int c = 0;
+        
+        for(int a = 0; a < tunegrid; ++a)
+        {
+            for(int b = 0; b < tunegrid; ++b)
+            {
+                for(int g = 0; g < nD; ++g)
+                {
+                    Kc[c] = cKc*exp(span*(2.0*a/(tunegrid - 1) - 1.0));
+                    taui[c] = ci*exp(span*(2.0*b/(tunegrid - 1) - 1.0));
+                    taud[c] = (pid == 1) ? cd*exp(span*(2.0*g/(nD - 1) - 1.0)) : 0.0;
+                    ++c;
+                }
+            }
+        }
+        
+        if(parallel == 1)
+        {
+            parallelFor(ncand, tunebatch, CtrlTuneBlock, &ctx);
+        }else{
+            CtrlTuneBlock(0, ncand, &ctx);
+        }
+        res->nsim += ncand;
+        
+        for(c = 0; c < ncand; ++c)
+        {
+            if(J[c] < res->ITAE)
+            {
+                res->ITAE = J[c];
+                res->Kc = Kc[c];
+                res->taui = taui[c];
+                res->taud = taud[c];
+            }
+        }
+        cKc = res->Kc;
+        ci = res->taui;
+        cd = (res->taud > 0.0) ? res->taud : cd;
+        span /= 3.0;
+    }
+    
+    free(Kc);
+    free(taui);
+    free(taud);
+    free(J);
+}
+
+void CtrlTune(const CtrlLoop *loop, int pid, CtrlTuning *res)
+{
+    CtrlTuneLoop(loop, pid, res, 1);
+}
+
+typedef struct CtrlTuneBatchContext{
+    const CtrlLoop *loops;
+    int pid;
+    CtrlTuning *res;
+} CtrlTuneBatchContext;
+
+/// This subroutine is used to tune a block of loops. Used as the kernel of "parallelFor(...)".
+static void CtrlTuneBatchBlock(int start, int end, void *context)
+{
+    CtrlTuneBatchContext *ctx = context;
+    
+    for(int i = start; i < end; ++i)
+    {
+        CtrlTuneLoop(&ctx->loops[i], ctx->pid, &ctx->res[i], 0);
+    }
+}
+
+void CtrlTuneBatch(int nloops, const CtrlLoop *loops, int pid, CtrlTuning *res)
+{
+    CtrlTuneBatchContext ctx = {loops, pid, res};
+    
+    parallelFor(nloops, 1, CtrlTuneBatchBlock, &ctx);
+}
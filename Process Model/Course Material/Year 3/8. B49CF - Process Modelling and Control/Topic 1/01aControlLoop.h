@@ -0,0 +1,191 @@
+//
+//  01aControlLoop.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef _1aControlLoopStruct_h
+#define _1aControlLoopStruct_h
+
+//  Loop structures
+#define CtrlSingle 1            // Feedback loop with optional static feedforward.
+#define CtrlCascade 2           // Primary controller setting the setpoint of a secondary loop.
+#define CtrlRatio 3             // Controlled flow following a multiple of a measured wild flow.
+
+//  Signal shapes
+#define CtrlNone 0              // No change.
+#define CtrlStep 1              // Step change.
+#define CtrlRamp 2              // Ramp that stops at its final value.
+
+typedef struct CtrlSignal{
+    int shape;                  // Signal shape.
+    double base;                // Value before the change.
+    double t0;                  // Time of the change (s).
+    double size;                // Total change.
+    double rate;                // Rate of change of a ramp (1/s).
+} CtrlSignal;
+
+typedef struct CtrlPID{
+    double Kc;                  // Controller gain.
+    double taui;                // Integral time (s). Zero removes integral action.
+    double taud;                // Derivative time (s).
+    double N;                   // Derivative filter factor. The filter time constant is taud/N.
+    double Tt;                  // Anti-windup tracking time constant (s). Zero selects sqrt(taui taud), or taui without derivative action.
+    double umin;                // Lower output limit.
+    double umax;                // Upper output limit.
+    //  Controller state
+    double I;                   // Integral term.
+    double D;                   // Filtered derivative term.
+    double yprev;               // Previous measurement.
+} CtrlPID;
+
+typedef struct CtrlFOPDT{
+    double K;                   // Process gain.
+    double tau;                 // Time constant (s).
+    double theta;               // Dead time (s).
+    //  Process state
+    double y;                   // Output.
+    double a;                   // Discrete pole, exp(-dt/tau).
+    int ndelay;                 // Length of the dead time buffer (time steps).
+    int head;                   // Oldest entry of the dead time buffer.
+    double *buf;                // Ring buffer of delayed inputs.
+} CtrlFOPDT;
+
+typedef struct CtrlLoop{
+    int type;                   // Loop structure.
+    double dt;                  // Sample time (s).
+    double tend;                // Simulation time (s).
+    CtrlPID pid;                // Primary controller.
+    CtrlPID inner;              // Secondary controller. Cascade only.
+    CtrlFOPDT plant;            // Primary process, or controlled flow of a ratio loop.
+    CtrlFOPDT inplant;          // Secondary process. Cascade only.
+    CtrlFOPDT dist;             // Disturbance to primary output. Single loop only.
+    double Kff;                 // Static feedforward gain. Single loop only.
+    double ratio;               // Ratio of controlled to wild flow. Ratio only.
+    CtrlSignal sp;              // Setpoint. Not used by ratio loops.
+    CtrlSignal load;            // Disturbance, entering the secondary process of a cascade; the wild flow of a ratio loop.
+} CtrlLoop;
+
+typedef struct CtrlTrace{
+    int n;                      // Number of recorded samples.
+    double *t;                  // Time (s).
+    double *sp;                 // Setpoint.
+    double *y;                  // Controlled variable.
+    double *u;                  // Controller output (secondary controller for a cascade).
+    double *y2;                 // Secondary controlled variable, or disturbance.
+} CtrlTrace;
+
+typedef struct CtrlPerformance{
+    double IAE;                 // Integral of the absolute error.
+    double ISE;                 // Integral of the squared error.
+    double ITAE;                // Integral of time-weighted absolute error.
+    double emax;                // Largest absolute error.
+    int status;                 // Bounded (0), diverged (-1) or not run because memory could not be allocated (-2).
+} CtrlPerformance;
+
+typedef struct CtrlTuning{
+    double Kc;                  // Tuned controller gain.
+    double taui;                // Tuned integral time (s).
+    double taud;                // Tuned derivative time (s).
+    double ITAE;                // ITAE of the tuned loop.
+    double KcIMC;               // IMC controller gain.
+    double tauiIMC;             // IMC integral time (s).
+    double taudIMC;             // IMC derivative time (s).
+    double ITAEIMC;             // ITAE of the loop with IMC settings.
+    int nsim;                   // Closed loop simulations used.
+    int status;                 // Tuned (0) or abandoned because memory could not be allocated (-1).
+} CtrlTuning;
+
+#endif /* _1aControlLoopStruct_h */
+
+#ifndef _1aControlLoopVariable_h
+#define _1aControlLoopVariable_h
+
+/// This subroutine is used to collect the loop structure, process models, controllers and test signals.
+/// @param loop Struct where the loop should be stored.
+/// @param controller Set to 1 to also collect the primary controller settings.
+void CtrlLoopVariable(CtrlLoop *loop, int controller);
+
+#endif /* _1aControlLoopVariable_h */
+
+#ifndef _1aControlLoopCalc_h
+#define _1aControlLoopCalc_h
+
+/// This subroutine is used to calculate the value of a test signal.
+/// @param sig Signal description.
+/// @param t Time (s).
+double CtrlSignalValue(const CtrlSignal *sig, double t);
+
+/// This subroutine is used to clear the state of a controller.
+/// @param pid Controller.
+void CtrlPIDReset(CtrlPID *pid);
+
+/// This subroutine is used to calculate the next output of a PID controller. Proportional action acts on the error, derivative action on the filtered measurement and the integral is corrected by back-calculation when the output saturates. This function returns the controller output.
+/// @param pid Controller.
+/// @param sp Setpoint.
+/// @param y Measurement.
+/// @param uff Feedforward added to the output before the limits are applied.
+/// @param dt Sample time (s).
+double CtrlPIDUpdate(CtrlPID *pid, double sp, double y, double uff, double dt);
+
+/// This subroutine is used to allocate the dead time buffer of a process and set it to rest. This function returns 0 on success or 1 if the buffer cannot be allocated.
+/// @param p Process model.
+/// @param dt Sample time (s).
+int CtrlFOPDTInit(CtrlFOPDT *p, double dt);
+
+/// This subroutine is used to advance a process by one sample with a zero-order hold on its input. This function returns the new output.
+/// @param p Process model.
+/// @param u Process input.
+double CtrlFOPDTStep(CtrlFOPDT *p, double u);
+
+/// This subroutine is used to release the dead time buffer of a process.
+/// @param p Process model.
+void CtrlFOPDTFree(CtrlFOPDT *p);
+
+/// This subroutine is used to simulate a closed loop. The loop description is not modified. This function returns the performance status.
+/// @param loop Loop description.
+/// @param dtout Interval between recorded samples (s).
+/// @param trace Struct where the recorded samples should be stored, released by "CtrlTraceFree(...)". Not recorded when NULL.
+/// @param perf Struct where the performance indices should be stored.
+int CtrlSimulate(const CtrlLoop *loop, double dtout, CtrlTrace *trace, CtrlPerformance *perf);
+
+/// This subroutine is used to release the arrays of a recorded simulation.
+/// @param trace Recorded simulation.
+void CtrlTraceFree(CtrlTrace *trace);
+
+/// This subroutine is used to calculate IMC settings for a first order plus dead time process with the closed loop time constant equal to the dead time.
+/// @param p Process model.
+/// @param pid Set to 1 for PID settings or 0 for PI settings.
+/// @param Kc Controller gain.
+/// @param taui Integral time (s).
+/// @param taud Derivative time (s).
+void CtrlIMCTuning(const CtrlFOPDT *p, int pid, double *Kc, double *taui, double *taud);
+
+/// This subroutine is used to tune the primary controller of a loop by minimising the ITAE of its test signals. Candidate settings on a logarithmic grid around the IMC settings are simulated in parallel, and the grid is refined around the best candidate.
+/// @param loop Loop description.
+/// @param pid Set to 1 to tune a PID controller or 0 for a PI controller.
+/// @param res Struct where the tuning should be stored.
+void CtrlTune(const CtrlLoop *loop, int pid, CtrlTuning *res);
+
+/// This subroutine is used to tune many loops. Loops are tuned in parallel, each simulating its own candidates in turn.
+/// @param nloops Number of loops.
+/// @param loops Loop descriptions.
+/// @param pid Set to 1 to tune PID controllers or 0 for PI controllers.
+/// @param res Array of nloops structs where the tunings should be stored.
+void CtrlTuneBatch(int nloops, const CtrlLoop *loops, int pid, CtrlTuning *res);
+
+#endif /* _1aControlLoopCalc_h */
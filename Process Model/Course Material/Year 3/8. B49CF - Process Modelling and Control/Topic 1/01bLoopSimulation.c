@@ -0,0 +1,199 @@
+//
+//  01bLoopSimulation.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+/// MARK: HEADER DECLARATIONS
+//  Standard header files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//  Custom header files
+#include "System.h"
+#include "ResultWriter.h"
+#include "01aControlLoop.h"
+#include "B49CF_T1.h"
+#include "01bLoopSimulation.h"
+
+/// MARK: SUBROUTINE DEFINITIONS
+#define maxstrlen 128
+
+/// MARK: DISPLAY AND WRITE
+static void LoopSimulationPrint(ResultWriter *w, const CtrlLoop *loop, const CtrlTrace *trace, const CtrlPerformance *perf)
+{
+    const char *type[4] = {"", "Feedback", "Cascade", "Ratio"};
+    const char *second[4] = {"", "d (-)", "y2 (-)", "Wild flow (-)"};
+    
+    writerPrintf(w, "_Control_Loop_Simulation_Results_\n");
+    writerPrintf(w, "Loop structure:\n");
+    writerPrintf(w, "%s\n\n", type[loop->type]);
+    
+    writerPrintf(w, "\tInput parameters:\n");
+    writerPrintf(w, "Controller gain:\n");
+    writerPrintf(w, "Kc =\t%.5g\n", loop->pid.Kc);
+    writerPrintf(w, "Integral time:\n");
+    writerPrintf(w, "taui =\t%.5g\ts\n", loop->pid.taui);
+    writerPrintf(w, "Derivative time:\n");
+    writerPrintf(w, "taud =\t%.5g\ts\n", loop->pid.taud);
+    if(loop->type == CtrlSingle && loop->Kff != 0.0)
+    {
+        writerPrintf(w, "Feedforward gain:\n");
+        writerPrintf(w, "Kff =\t%.5g\n", loop->Kff);
+    }
+    writerPrintf(w, "Sample time:\n");
+    writerPrintf(w, "dt =\t%.5g\ts\n\n", loop->dt);
+    
+    writerPrintf(w, "\tOutput parameters:\n");
+    if(perf->status != 0)
+    {
+        writerPrintf(w, "The closed loop is unstable.\n");
+    }
+    writerPrintf(w, "Integral of the absolute error:\n");
+    writerPrintf(w, "IAE =\t%.6g\n", perf->IAE);
+    writerPrintf(w, "Integral of the squared error:\n");
+    writerPrintf(w, "ISE =\t%.6g\n", perf->ISE);
+    writerPrintf(w, "Integral of time-weighted absolute error:\n");
+    writerPrintf(w, "ITAE =\t%.6g\n", perf->ITAE);
+    writerPrintf(w, "Largest absolute error:\n");
+    writerPrintf(w, "e =\t%.6g\n\n", perf->emax);
+    
+    writerPrintf(w, "t (s)\tSetpoint (-)\ty (-)\tu (-)\t%s\n", second[loop->type]);
+    for(int k = 0; k < trace->n; ++k)
+    {
+        writerPrintf(w, "%.5g\t%.6g\t%.6g\t%.6g\t%.6g\n", trace->t[k], trace->sp[k], trace->y[k], trace->u[k], trace->y2[k]);
+    }
+}
+
+void LoopSimulationDisplay(const CtrlLoop *loop, const CtrlTrace *trace, const CtrlPerformance *perf)
+{
+    ResultWriter w;             // Console writer for the results.
+    
+    if(writerConsole(&w))
+    {
+        LoopSimulationPrint(&w, loop, trace, perf);
+        writerClose(&w);
+    }
+}
+
+void LoopSimulationWrite(const CtrlLoop *loop, const CtrlTrace *trace, const CtrlPerformance *perf)
+{
+    //  Function variables
+    ResultWriter w;             // Buffered writer for the results file.
+    
+    //  Set file name as timestamp + Control Loop Results
+    if(!writerOpen(&w, "Control Loop Results"))
+    {
+        return;
+    }
+    
+    //  Write to file
+    LoopSimulationPrint(&w, loop, trace, perf);
+    
+    //  Close file
+    writerClose(&w);
+}
+
+void LoopSimulationWriteSwitch(const CtrlLoop *loop, const CtrlTrace *trace, const CtrlPerformance *perf)
+{
+    int control = 0;
+    
+    control = 1;
+    while(control == 1)
+    {
+        char input[maxstrlen];
+        
+        printf("Do you want to save results to file? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+            case 'T':
+            case 'Y':
+            case 't':
+            case 'y':
+                LoopSimulationWrite(loop, trace, perf);
+                control = 0;
+                break;
+            case '0':
+            case 'F':
+            case 'N':
+            case 'f':
+            case 'n':
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+}
+
+/// MARK: PSEUDO-MAIN FUNCTION
+void LoopSimulation(void)
+{
+    int whilmain = 0;
+    printf("Control Loop Simulation\n");
+    
+    whilmain = 1;
+    while(whilmain == 1)
+    {
+        //  Variable declaration
+        CtrlLoop loop;
+        CtrlTrace trace;
+        CtrlPerformance perf;
+        double dtout = 0.0;
+            //  Variables for timing function
+        struct timespec start, end;
+        double elapsed = 0.0;
+        
+        //  Data Collection
+        CtrlLoopVariable(&loop, 1);
+        dtout = inputDouble(0, 0, "output interval", "s");
+        
+        //  Data Manipulation
+        clock_getres(CLOCK_MONOTONIC, &start);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        
+        if(CtrlSimulate(&loop, dtout, &trace, &perf) == -2)
+        {
+            printf("Memory could not be allocated for the simulation.\n");
+        }else{
+            clock_getres(CLOCK_MONOTONIC, &end);
+            clock_gettime(CLOCK_MONOTONIC, &end);
+
+            elapsed = timer(start, end);
+
+            printf("Calculations completed in %.6f seconds.\n", elapsed);
+            
+            //  Displaying results
+            LoopSimulationDisplay(&loop, &trace, &perf);
+            
+            //  Writing to File
+            LoopSimulationWriteSwitch(&loop, &trace, &perf);
+            
+            CtrlTraceFree(&trace);
+        }
+        
+        //  Continue function
+        whilmain = Continue(whilmain);
+    }
+    fflush(stdout);
+}
@@ -0,0 +1,42 @@
+//
+//  01bLoopSimulation.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef _1bLoopSimulation_h
+#define _1bLoopSimulation_h
+
+/// This subroutine is used to output the closed loop response to the user console.
+/// @param loop Loop description.
+/// @param trace Recorded simulation.
+/// @param perf Performance indices.
+void LoopSimulationDisplay(const CtrlLoop *loop, const CtrlTrace *trace, const CtrlPerformance *perf);
+
+/// This subroutine is used to write the closed loop response to a .txt file.
+/// @param loop Loop description.
+/// @param trace Recorded simulation.
+/// @param perf Performance indices.
+void LoopSimulationWrite(const CtrlLoop *loop, const CtrlTrace *trace, const CtrlPerformance *perf);
+
+/// This subroutine is used to check if the user would like to write the results to a file.
+/// @param loop Loop description.
+/// @param trace Recorded simulation.
+/// @param perf Performance indices.
+void LoopSimulationWriteSwitch(const CtrlLoop *loop, const CtrlTrace *trace, const CtrlPerformance *perf);
+
+#endif /* _1bLoopSimulation_h */
@@ -0,0 +1,285 @@
+//
+//  01cLoopTuning.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+/// MARK: HEADER DECLARATIONS
+//  Standard header files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//  Custom header files
+#include "System.h"
+#include "ResultWriter.h"
+#include "01aControlLoop.h"
+#include "B49CF_T1.h"
+#include "01cLoopTuning.h"
+
+/// MARK: SUBROUTINE DEFINITIONS
+#define maxstrlen 128
+
+/// MARK: VARIABLE INPUT
+static CtrlLoop *LoopTuningVariable(int *pid, int *nloops)
+{
+    char input[maxstrlen];
+    CtrlLoop loop;
+    CtrlLoop *loops = NULL;
+    int control = 0;
+    int range = 0;
+    
+    CtrlLoopVariable(&loop, 0);
+    
+    control = 1;
+    while(control == 1)
+    {
+        printf("Controller: PI (1) or PID (2)? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+                *pid = 0;
+                control = 0;
+                break;
+            case '2':
+                *pid = 1;
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+    
+    control = 1;
+    while(control == 1)
+    {
+        printf("Tune this loop (1) or a range of dead time to time constant ratios (2)? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+                range = 0;
+                control = 0;
+                break;
+            case '2':
+                range = 1;
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+    
+    if(range == 0)
+    {
+        *nloops = 1;
+        loops = malloc(sizeof(CtrlLoop));
+        if(loops != NULL)
+        {
+            loops[0] = loop;
+        }
+    }else{
+        double rmin = inputDouble(0, 0, "smallest dead time ratio", "[ ]");
+        double rmax = inputDouble(0, 0, "largest dead time ratio", "[ ]");
+        
+        *nloops = (int)inputDouble(0, 0, "number of loops", "");
+        loops = malloc(*nloops*sizeof(CtrlLoop));
+        for(int i = 0; loops != NULL && i < *nloops; ++i)
+        {
+            loops[i] = loop;
+            loops[i].plant.theta = loop.plant.tau*((*nloops > 1) ? rmin + (rmax - rmin)*i/(*nloops - 1) : rmin);
+        }
+    }
+    
+    return loops;
+}
+
+/// MARK: DISPLAY AND WRITE
+static void LoopTuningPrint(ResultWriter *w, int pid, int nloops, const CtrlLoop *loops, const CtrlTuning *res)
+{
+    int nsim = 0;
+    
+    for(int i = 0; i < nloops; ++i)
+    {
+        nsim += res[i].nsim;
+    }
+    
+    writerPrintf(w, "_Controller_Tuning_Results_\n");
+    writerPrintf(w, "%s controllers tuned for minimum ITAE\n\n", (pid == 1) ? "PID" : "PI");
+    writerPrintf(w, "Closed loop simulations:\n");
+    writerPrintf(w, "n =\t%i\n\n", nsim);
+    
+    if(nloops == 1)
+    {
+        writerPrintf(w, "\tIMC settings:\n");
+        writerPrintf(w, "Kc =\t%.5g\n", res->KcIMC);
+        writerPrintf(w, "taui =\t%.5g\ts\n", res->tauiIMC);
+        writerPrintf(w, "taud =\t%.5g\ts\n", res->taudIMC);
+        writerPrintf(w, "ITAE =\t%.6g\n\n", res->ITAEIMC);
+        writerPrintf(w, "\tMinimum ITAE settings:\n");
+        writerPrintf(w, "Kc =\t%.5g\n", res->Kc);
+        writerPrintf(w, "taui =\t%.5g\ts\n", res->taui);
+        writerPrintf(w, "taud =\t%.5g\ts\n", res->taud);
+        writerPrintf(w, "ITAE =\t%.6g\n", res->ITAE);
+        return;
+    }
+    
+    writerPrintf(w, "theta/tau (-)\tKc K (-)\ttaui/tau (-)\ttaud/tau (-)\tITAE (-)\tITAE IMC (-)\n");
+    for(int i = 0; i < nloops; ++i)
+    {
+        const CtrlFOPDT *p = &loops[i].plant;
+        
+        writerPrintf(w, "%.4f\t%.5g\t%.5g\t%.5g\t%.6g\t%.6g\n", p->theta/p->tau, res[i].Kc*p->K, res[i].taui/p->tau, res[i].taud/p->tau, res[i].ITAE, res[i].ITAEIMC);
+    }
+}
+
+void LoopTuningDisplay(int pid, int nloops, const CtrlLoop *loops, const CtrlTuning *res)
+{
+    ResultWriter w;             // Console writer for the results.
+    
+    if(writerConsole(&w))
+    {
+        LoopTuningPrint(&w, pid, nloops, loops, res);
+        writerClose(&w);
+    }
+}
+
+void LoopTuningWrite(int pid, int nloops, const CtrlLoop *loops, const CtrlTuning *res)
+{
+    //  Function variables
+    ResultWriter w;             // Buffered writer for the results file.
+    
+    //  Set file name as timestamp + Controller Tuning Results
+    if(!writerOpen(&w, "Controller Tuning Results"))
+    {
+        return;
+    }
+    
+    //  Write to file
+    LoopTuningPrint(&w, pid, nloops, loops, res);
+    
+    //  Close file
+    writerClose(&w);
+}
+
+void LoopTuningWriteSwitch(int pid, int nloops, const CtrlLoop *loops, const CtrlTuning *res)
+{
+    int control = 0;
+    
+    control = 1;
+    while(control == 1)
+    {
+        char input[maxstrlen];
+        
+        printf("Do you want to save results to file? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+            case 'T':
+            case 'Y':
+            case 't':
+            case 'y':
+                LoopTuningWrite(pid, nloops, loops, res);
+                control = 0;
+                break;
+            case '0':
+            case 'F':
+            case 'N':
+            case 'f':
+            case 'n':
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+}
+
+/// MARK: PSEUDO-MAIN FUNCTION
+void LoopTuning(void)
+{
+    int whilmain = 0;
+    printf("Controller Tuning\n");
+    
+    whilmain = 1;
+    while(whilmain == 1)
+    {
+        //  Variable declaration
+        CtrlLoop *loops = NULL;
+        CtrlTuning *res = NULL;
+        int nloops = 0;
+        int pid = 0;
+        int failed = 0;
+            //  Variables for timing function
+        struct timespec start, end;
+        double elapsed = 0.0;
+        
+        //  Data Collection
+        loops = LoopTuningVariable(&pid, &nloops);
+        
+        //  Data Manipulation
+        clock_getres(CLOCK_MONOTONIC, &start);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        
+        res = (loops != NULL) ? calloc(nloops, sizeof(CtrlTuning)) : NULL;
+        if(res != NULL)
+        {
+            if(nloops == 1)
+            {
+                CtrlTune(loops, pid, res);
+            }else{
+                CtrlTuneBatch(nloops, loops, pid, res);
+            }
+            for(int i = 0; i < nloops; ++i)
+            {
+                failed += (res[i].status != 0);
+            }
+        }
+        
+        if(res == NULL || failed > 0)
+        {
+            printf("Memory could not be allocated for the tuning.\n");
+        }else{
+            clock_getres(CLOCK_MONOTONIC, &end);
+            clock_gettime(CLOCK_MONOTONIC, &end);
+
+            elapsed = timer(start, end);
+
+            printf("Calculations completed in %.6f seconds.\n", elapsed);
+            
+            //  Displaying results
+            LoopTuningDisplay(pid, nloops, loops, res);
+            
+            //  Writing to File
+            LoopTuningWriteSwitch(pid, nloops, loops, res);
+        }
+        
+        free(loops);
+        free(res);
+        
+        //  Continue function
+        whilmain = Continue(whilmain);
+    }
+    fflush(stdout);
+}
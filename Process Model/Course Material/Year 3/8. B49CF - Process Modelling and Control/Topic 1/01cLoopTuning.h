@@ -0,0 +1,45 @@
+//
+//  01cLoopTuning.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef _1cLoopTuning_h
+#define _1cLoopTuning_h
+
+/// This subroutine is used to output the controller tunings to the user console.
+/// @param pid Set to 1 for PID tunings or 0 for PI tunings.
+/// @param nloops Number of loops tuned.
+/// @param loops Loop descriptions.
+/// @param res Tuning of each loop.
+void LoopTuningDisplay(int pid, int nloops, const CtrlLoop *loops, const CtrlTuning *res);
+
+/// This subroutine is used to write the controller tunings to a .txt file.
+/// @param pid Set to 1 for PID tunings or 0 for PI tunings.
+/// @param nloops Number of loops tuned.
+/// @param loops Loop descriptions.
+/// @param res Tuning of each loop.
+void LoopTuningWrite(int pid, int nloops, const CtrlLoop *loops, const CtrlTuning *res);
+
+/// This subroutine is used to check if the user would like to write the results to a file.
+/// @param pid Set to 1 for PID tunings or 0 for PI tunings.
+/// @param nloops Number of loops tuned.
+/// @param loops Loop descriptions.
+/// @param res Tuning of each loop.
+void LoopTuningWriteSwitch(int pid, int nloops, const CtrlLoop *loops, const CtrlTuning *res);
+
+#endif /* _1cLoopTuning_h */
@@ -55,16 +55,14 @@ void Year3()
                 printf("Bear with me, this is still being written...\n");
                 break;
             case '2':
-                //B48CA();
-                printf("Bear with me, this is still being written...\n");
+                B48CA();
                 break;
             case '3':
                 //B49CB();
                 printf("Bear with me, this is still being written...\n");
                 break;
             case '4':
-                //B18OB();
-                printf("Bear with me, this is still being written...\n");
+                F49CC();
                 break;
             case '5':
                 //B18OB();
@@ -75,12 +73,10 @@ void Year3()
                 printf("Bear with me, this is still being written...\n");
                 break;
             case '7':
-                //B49CD();
-                printf("Bear with me, this is still being written...\n");
+                B49CE();
                 break;
             case '8':
-                //B49CF();
-                printf("Bear with me, this is still being written...\n");
+                B49CF();
                 break;
             case '0':
             case 'Q':
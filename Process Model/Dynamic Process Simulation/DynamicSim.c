@@ -0,0 +1,66 @@
+//
+//  DynamicSim.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+//  Standard header files
+#include <stdio.h>
+#include <stdlib.h>
+
+//  Custom header files
+#include "main.h"
+#include "DynamicSim.h"
+
+#define maxstrlen 128
+
+void DynProcessSim()
+{
+    char input[maxstrlen];
+    
+    int control = 0;
+    
+    control = 1;
+    while(control == 1)
+    {
+        printf("Dynamic Process Simulation\n");
+        printf("Please select from the following programs:\n");
+        printf("1. Water hammer (method of characteristics)\n");
+        printf("2. Tank, heater and reactor flowsheet (ODE/DAE integration)\n");
+        printf("q. Exit menu\n");
+        
+        printf("\nSelection [1 - 2]: ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+                WaterHammer();
+                break;
+            case '2':
+                DynamicFlowsheet();
+                break;
+            case '0':
+            case 'Q':
+            case 'q':
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+}
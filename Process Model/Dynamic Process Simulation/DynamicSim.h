@@ -0,0 +1,30 @@
+//
+//  DynamicSim.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef DynamicSim_h
+#define DynamicSim_h
+
+/// This subroutine is used to simulate pressure transients in a pipeline by the method of characteristics.
+void WaterHammer(void);
+
+/// This subroutine is used to simulate a flowsheet of tanks, heaters and reactors with the general ODE/DAE integrators.
+void DynamicFlowsheet(void);
+
+#endif /* DynamicSim_h */
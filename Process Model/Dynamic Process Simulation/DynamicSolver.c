@@ -0,0 +1,1380 @@
+//
+//  DynamicSolver.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+/// MARK: HEADER DECLARATIONS
+//Standard Header Files
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//Custom Header Files
+#include "Parallel.h"
+#include "LinearAlgebra.h"
+#include "DynamicSolver.h"
+
+/// MARK: SUBROUTINE DEFINITIONS
+#define unitbatch 1024      // Units evaluated by each parallel task. Smaller flowsheets are evaluated serially.
+#define bdfmaxorder 5
+#define bdfnewtonmax 4      // Newton iterations allowed in each BDF step.
+#define outputblock 256     // Outputs allocated at a time.
+
+typedef struct DynJacobian{
+    SparseMatrix J;     // Jacobian values on the sparsity pattern implied by the unit connections.
+    int *cscptr;        // Start of each column within "cscrow" and "cscpos" (n + 1 entries).
+    int *cscrow;        // Row of each entry, stored column by column.
+    int *cscpos;        // Position of each entry within "J.val", stored column by column.
+    int ncolour;        // Number of column groups. Columns in a group share no rows and are perturbed together.
+    int *colptr;        // Start of each group within "colidx" (ncolour + 1 entries).
+    int *colidx;        // Columns sorted by group.
+    BandMatrix W;       // Iteration matrix, M - c J, and its factors.
+} DynJacobian;
+
+typedef struct DynStepper{
+    const DynSystem *sys;
+    const DynOptions *opt;
+    DynStats *stats;
+    int n;
+    int method;
+    double t;           // Time at the start of the step (s).
+    double tnew;        // Time at the end of the step (s).
+    double h;           // Step size for the next attempt (s).
+    double hused;       // Step size of the last accepted step (s).
+    double *y;
+    double *ynew;
+    double *F;          // Model equations at the start of the step.
+    double *Fnew;       // Model equations at the end of the step.
+    double *k[7];       // Stage vectors.
+    double *tmp;
+    double *tmp2;
+    DynJacobian jac;
+    int jacage;         // Accepted steps since the Jacobian was evaluated (-1 when never evaluated).
+    double Wc;          // Value of c used to form the iteration matrix (0 when not factorised).
+    double *dFdt;       // Time derivative of the model equations (Rosenbrock).
+    int order;          // BDF order.
+    int nequal;         // BDF steps taken at the present step size.
+    double *D;          // BDF modified divided differences ((bdfmaxorder + 3) x n).
+} DynStepper;
+
+/// MARK: SYSTEM DEFINITION
+int DynAddUnit(DynSystem *sys, const char *name, int nstates, DynUnitResidual residual, void *params)
+{
+    DynUnit *unit = NULL;
+    int n = sys->n + nstates;
+    
+    sys->unit = realloc(sys->unit, (sys->nunits + 1)*sizeof(DynUnit));
+    sys->mass = realloc(sys->mass, n*sizeof(double));
+    sys->y0 = realloc(sys->y0, n*sizeof(double));
+    sys->label = realloc(sys->label, n*sizeof(*sys->label));
+    
+    unit = &sys->unit[sys->nunits];
+    memset(unit, 0, sizeof(DynUnit));
+    snprintf(unit->name, sizeof(unit->name), "%s", name);
+    unit->offset = sys->n;
+    unit->nstates = nstates;
+    unit->residual = residual;
+    unit->params = params;
+    
+    for(int i = sys->n; i < n; ++i)
+    {
+        sys->mass[i] = 1.0;
+        sys->y0[i] = 0.0;
+        snprintf(sys->label[i], sizeof(sys->label[i]), "y%i", i + 1);
+    }
+    sys->n = n;
+    
+    return sys->nunits++;
+}
+
+void DynSetState(DynSystem *sys, int unit, int k, const char *label, double y0, double mass)
+{
+    int i = sys->unit[unit].offset + k;
+    
+    snprintf(sys->label[i], sizeof(sys->label[i]), "%s", label);
+    sys->y0[i] = y0;
+    sys->mass[i] = mass;
+}
+
+void DynConnect(DynSystem *sys, int from, int to)
+{
+    DynUnit *unit = &sys->unit[to];
+    
+    for(int i = 0; i < unit->ninputs; ++i)
+    {
+        if(unit->input[i] == from)
+        {
+            return;
+        }
+    }
+    if(unit->ninputs < DynMaxInputs)
+    {
+        unit->input[unit->ninputs] = from;
+        unit->ninputs += 1;
+    }else{
+        printf("Unit \"%s\" already has %i inputs. The connection from \"%s\" was not added.\n", unit->name, DynMaxInputs, sys->unit[from].name);
+    }
+}
+
+int DynAddEvent(DynSystem *sys, const char *name, DynEventFunction fn, DynEventAction action, void *params, int direction, int terminal)
+{
+    DynEvent *event = NULL;
+    
+    sys->event = realloc(sys->event, (sys->nevents + 1)*sizeof(DynEvent));
+    event = &sys->event[sys->nevents];
+    snprintf(event->name, sizeof(event->name), "%s", name);
+    event->g = fn;
+    event->action = action;
+    event->params = params;
+    event->direction = direction;
+    event->terminal = terminal;
+    
+    return sys->nevents++;
+}
+
+typedef struct DynEvaluateContext{
+    const DynSystem *sys;
+    double t;
+    const double *y;
+    double *f;
+} DynEvaluateContext;
+
+/// This subroutine is used to evaluate a block of unit models. Used as the kernel of "parallelFor(...)".
+static void DynEvaluateBlock(int start, int end, void *context)
+{
+    DynEvaluateContext *ctx = context;
+    
+    for(int u = start; u < end; ++u)
+    {
+        const DynUnit *unit = &ctx->sys->unit[u];
+        
+        unit->residual(ctx->t, ctx->y, ctx->f, unit->offset, unit->params);
+    }
+}
+
+void DynEvaluate(const DynSystem *sys, double t, const double *y, double *f)
+{
+    DynEvaluateContext ctx = {sys, t, y, f};
+    
+    parallelFor(sys->nunits, unitbatch, DynEvaluateBlock, &ctx);
+}
+
+void DynSystemFree(DynSystem *sys)
+{
+    free(sys->unit);
+    free(sys->event);
+    free(sys->mass);
+    free(sys->y0);
+    free(sys->label);
+    memset(sys, 0, sizeof(DynSystem));
+}
+
+/// MARK: SPARSE JACOBIAN
+/// This subroutine is used to build the Jacobian sparsity pattern, the column groups used for finite differencing and the band iteration matrix. Every equation of a unit may depend on every state of the unit and of its upstream units.
+static void DynJacobianPattern(const DynSystem *sys, DynJacobian *jac)
+{
+    int n = sys->n;
+    int kl = 0;
+    int ku = 0;
+    int *cols = NULL;
+    int *stamp = NULL;
+    int *colour = NULL;
+    
+    memset(jac, 0, sizeof(DynJacobian));
+    jac->J.n = n;
+    jac->J.rowptr = calloc(n + 1, sizeof(int));
+    cols = malloc(n*sizeof(int));
+    
+    //  Row pattern: the unit's own columns followed by those of each upstream unit, sorted
+    for(int pass = 0; pass < 2; ++pass)
+    {
+        int nnz = 0;
+        
+        for(int u = 0; u < sys->nunits; ++u)
+        {
+            const DynUnit *unit = &sys->unit[u];
+            int ncols = 0;
+            
+            for(int m = -1; m < unit->ninputs; ++m)
+            {
+                const DynUnit *src = (m < 0) ? unit : &sys->unit[unit->input[m]];
+                
+                for(int c = src->offset; c < src->offset + src->nstates; ++c)
+                {
+                    int pos = ncols;
+                    
+                    //  Insertion keeps the columns sorted
+                    while(pos > 0 && cols[pos - 1] > c)
+                    {
+                        cols[pos] = cols[pos - 1];
+                        --pos;
+                    }
+                    cols[pos] = c;
+                    ++ncols;
+                }
+            }
+            for(int r = unit->offset; r < unit->offset + unit->nstates; ++r)
+            {
+                if(pass == 0)
+                {
+                    jac->J.rowptr[r + 1] = ncols;
+                }else{
+                    memcpy(&jac->J.col[jac->J.rowptr[r]], cols, ncols*sizeof(int));
+                    kl = (r - cols[0] > kl) ? r - cols[0] : kl;
+                    ku = (cols[ncols - 1] - r > ku) ? cols[ncols - 1] - r : ku;
+                }
+                nnz += ncols;
+            }
+        }
+        if(pass == 0)
+        {
+            for(int r = 0; r < n; ++r)
+            {
+                jac->J.rowptr[r + 1] += jac->J.rowptr[r];
+            }
+            jac->J.nnz = nnz;
+            jac->J.col = malloc(nnz*sizeof(int));
+            jac->J.val = calloc(nnz, sizeof(double));
+        }
+    }
+    
+    //  Column view of the pattern
+    jac->cscptr = calloc(n + 1, sizeof(int));
+    jac->cscrow = malloc(jac->J.nnz*sizeof(int));
+    jac->cscpos = malloc(jac->J.nnz*sizeof(int));
+    for(int e = 0; e < jac->J.nnz; ++e)
+    {
+        jac->cscptr[jac->J.col[e] + 1] += 1;
+    }
+    for(int c = 0; c < n; ++c)
+    {
+        jac->cscptr[c + 1] += jac->cscptr[c];
+    }
+    memcpy(cols, jac->cscptr, n*sizeof(int));
+    for(int r = 0; r < n; ++r)
+    {
+        for(int e = jac->J.rowptr[r]; e < jac->J.rowptr[r + 1]; ++e)
+        {
+            int c = jac->J.col[e];
+            
+            jac->cscrow[cols[c]] = r;
+            jac->cscpos[cols[c]] = e;
+            cols[c] += 1;
+        }
+    }
+    
+    //  Greedy colouring: columns sharing a row must be perturbed separately
+    colour = malloc(n*sizeof(int));
+    stamp = malloc((n + 1)*sizeof(int));
+    for(int c = 0; c < n; ++c)
+    {
+        colour[c] = -1;
+        stamp[c] = -1;
+    }
+    for(int c = 0; c < n; ++c)
+    {
+        int k = 0;
+        
+        for(int e = jac->cscptr[c]; e < jac->cscptr[c + 1]; ++e)
+        {
+            int r = jac->cscrow[e];
+            
+            for(int q = jac->J.rowptr[r]; q < jac->J.rowptr[r + 1]; ++q)
+            {
+                int other = colour[jac->J.col[q]];
+                
+                if(other >= 0)
+                {
+                    stamp[other] = c;
+                }
+            }
+        }
+        while(stamp[k] == c)
+        {
+            ++k;
+        }
+        colour[c] = k;
+        jac->ncolour = (k + 1 > jac->ncolour) ? k + 1 : jac->ncolour;
+    }
+    jac->colptr = calloc(jac->ncolour + 1, sizeof(int));
+    jac->colidx = malloc(n*sizeof(int));
+    for(int c = 0; c < n; ++c)
+    {
+        jac->colptr[colour[c] + 1] += 1;
+    }
+    for(int k = 0; k < jac->ncolour; ++k)
+    {
+        jac->colptr[k + 1] += jac->colptr[k];
+    }
+    memcpy(cols, jac->colptr, jac->ncolour*sizeof(int));
+    for(int c = 0; c < n; ++c)
+    {
+        jac->colidx[cols[colour[c]]++] = c;
+    }
+    
+    BandMatrixAlloc(&jac->W, n, kl, ku);
+    
+    free(cols);
+    free(stamp);
+    free(colour);
+}
+
+static void DynJacobianFree(DynJacobian *jac)
+{
+    free(jac->J.rowptr);
+    free(jac->J.col);
+    free(jac->J.val);
+    free(jac->cscptr);
+    free(jac->cscrow);
+    free(jac->cscpos);
+    free(jac->colptr);
+    free(jac->colidx);
+    BandMatrixFree(&jac->W);
+}
+
+/// This subroutine is used to evaluate the Jacobian by grouped forward differences. Each group of columns costs one model evaluation.
+static void DynJacobianEvaluate(DynStepper *s, double t, const double *y, const double *F)
+{
+    DynJacobian *jac = &s->jac;
+    double *yp = s->tmp;
+    double *Fp = s->tmp2;
+    
+    memcpy(yp, y, s->n*sizeof(double));
+    for(int k = 0; k < jac->ncolour; ++k)
+    {
+        for(int q = jac->colptr[k]; q < jac->colptr[k + 1]; ++q)
+        {
+            int c = jac->colidx[q];
+            
+            yp[c] = y[c] + sqrt(DBL_EPSILON)*fmax(fabs(y[c]), 1.0);
+        }
+        DynEvaluate(s->sys, t, yp, Fp);
+        s->stats->nfev += 1;
+        for(int q = jac->colptr[k]; q < jac->colptr[k + 1]; ++q)
+        {
+            int c = jac->colidx[q];
+            double dy = yp[c] - y[c];
+            
+            for(int e = jac->cscptr[c]; e < jac->cscptr[c + 1]; ++e)
+            {
+                jac->J.val[jac->cscpos[e]] = (Fp[jac->cscrow[e]] - F[jac->cscrow[e]])/dy;
+            }
+            yp[c] = y[c];
+        }
+    }
+    s->stats->njev += 1;
+    s->jacage = 0;
+    s->Wc = 0.0;
+}
+
+/// This subroutine is used to form and factorise the iteration matrix M - c J. This function returns 0 on success and 1 if the matrix is singular.
+static int DynIterationMatrix(DynStepper *s, double c)
+{
+    DynJacobian *jac = &s->jac;
+    
+    memset(jac->W.ab, 0, (size_t)jac->W.ld*s->n*sizeof(double));
+    for(int r = 0; r < s->n; ++r)
+    {
+        for(int e = jac->J.rowptr[r]; e < jac->J.rowptr[r + 1]; ++e)
+        {
+            BandAdd(&jac->W, r, jac->J.col[e], -c*jac->J.val[e]);
+        }
+        BandAdd(&jac->W, r, r, s->sys->mass[r]);
+    }
+    s->stats->nlu += 1;
+    s->Wc = c;
+    
+    if(BandLUDecompose(&jac->W) != 0)
+    {
+        s->Wc = 0.0;
+        return 1;
+    }
+    return 0;
+}
+
+/// MARK: GENERAL CALCULATIONS
+/// This subroutine is used to calculate the root mean square of an error vector scaled by the mixed tolerance.
+static double DynErrorNorm(const DynStepper *s, const double *err, const double *ya, const double *yb)
+{
+    double sum = 0.0;
+    
+    for(int i = 0; i < s->n; ++i)
+    {
+        double scale = s->opt->atol + s->opt->rtol*fmax(fabs(ya[i]), fabs(yb[i]));
+        
+        sum += pow(err[i]/scale, 2);
+    }
+    return sqrt(sum/s->n);
+}
+
+/// This subroutine is used to make the algebraic states consistent with the differential states by Newton's method. This function returns 0 on success and 1 on failure.
+static int DynConsistentStart(DynStepper *s, double t, double *y)
+{
+    DynJacobian *jac = &s->jac;
+    int nalg = 0;
+    
+    for(int i = 0; i < s->n; ++i)
+    {
+        nalg += (s->sys->mass[i] == 0.0);
+    }
+    if(nalg == 0)
+    {
+        return 0;
+    }
+    
+    for(int iter = 0; iter < 20; ++iter)
+    {
+        double res = 0.0;
+        
+        DynEvaluate(s->sys, t, y, s->F);
+        s->stats->nfev += 1;
+        for(int i = 0; i < s->n; ++i)
+        {
+            if(s->sys->mass[i] == 0.0)
+            {
+                res = fmax(res, fabs(s->F[i])/(s->opt->atol + s->opt->rtol*fabs(y[i])));
+            }
+        }
+        if(res < 1e-3)
+        {
+            return 0;
+        }
+        
+        //  Differential rows hold their states fixed, algebraic rows take the Jacobian
+        DynJacobianEvaluate(s, t, y, s->F);
+        memset(jac->W.ab, 0, (size_t)jac->W.ld*s->n*sizeof(double));
+        for(int r = 0; r < s->n; ++r)
+        {
+            if(s->sys->mass[r] == 0.0)
+            {
+                for(int e = jac->J.rowptr[r]; e < jac->J.rowptr[r + 1]; ++e)
+                {
+                    BandAdd(&jac->W, r, jac->J.col[e], jac->J.val[e]);
+                }
+                s->tmp[r] = -s->F[r];
+            }else{
+                BandAdd(&jac->W, r, r, 1.0);
+                s->tmp[r] = 0.0;
+            }
+        }
+        s->stats->nlu += 1;
+        if(BandLUDecompose(&jac->W) != 0)
+        {
+            return 1;
+        }
+        BandLUSolve(&jac->W, s->tmp);
+        for(int i = 0; i < s->n; ++i)
+        {
+            y[i] += s->tmp[i];
+        }
+    }
+    s->Wc = 0.0;
+    
+    return 1;
+}
+
+/// MARK: EXPLICIT RUNGE-KUTTA (DORMAND-PRINCE)
+/// This subroutine is used to calculate dy/dt = M^-1 f from the model equations.
+static void DynRK45Rate(DynStepper *s, double t, const double *y, double *F, double *dydt)
+{
+    DynEvaluate(s->sys, t, y, F);
+    s->stats->nfev += 1;
+    for(int i = 0; i < s->n; ++i)
+    {
+        dydt[i] = F[i]/s->sys->mass[i];
+    }
+}
+
+/// This subroutine is used to take one accepted Dormand-Prince step. Stage 7 is evaluated at the new point and reused as stage 1 of the next step. This function returns 0 on success and 1 if the step size underflows.
+static int DynRK45Step(DynStepper *s, double tend)
+{
+    static const double c[7] = {0, 1.0/5, 3.0/10, 4.0/5, 8.0/9, 1, 1};
+    static const double a[7][6] = {
+        {0},
+        {1.0/5},
+        {3.0/40, 9.0/40},
+        {44.0/45, -56.0/15, 32.0/9},
+        {19372.0/6561, -25360.0/2187, 64448.0/6561, -212.0/729},
+        {9017.0/3168, -355.0/33, 46732.0/5247, 49.0/176, -5103.0/18656},
+        {35.0/384, 0, 500.0/1113, 125.0/192, -2187.0/6784, 11.0/84}};
+    static const double e[7] = {71.0/57600, 0, -71.0/16695, 71.0/1920, -17253.0/339200, 22.0/525, -1.0/40};
+    int n = s->n;
+    
+    while(1)
+    {
+        double h = s->h;
+        double err = 0.0;
+        
+        if(s->opt->hmax > 0 && h > s->opt->hmax)
+        {
+            h = s->opt->hmax;
+        }
+        if(s->t + h > tend)
+        {
+            h = tend - s->t;
+        }
+        if(h < 10*DBL_EPSILON*fmax(fabs(s->t), 1.0))
+        {
+            return 1;
+        }
+        
+        for(int st = 1; st < 7; ++st)
+        {
+            for(int i = 0; i < n; ++i)
+            {
+                double sum = 0.0;
+                
+                for(int j = 0; j < st; ++j)
+                {
+                    sum += a[st][j]*s->k[j][i];
+                }
+                s->ynew[i] = s->y[i] + h*sum;
+            }
+            DynRK45Rate(s, s->t + c[st]*h, s->ynew, s->Fnew, s->k[st]);
+        }
+        
+        for(int i = 0; i < n; ++i)
+        {
+            double sum = 0.0;
+            
+            for(int j = 0; j < 7; ++j)
+            {
+                sum += e[j]*s->k[j][i];
+            }
+            s->tmp[i] = h*sum;
+        }
+        err = DynErrorNorm(s, s->tmp, s->y, s->ynew);
+        
+        if(err <= 1.0)
+        {
+            s->tnew = s->t + h;
+            s->hused = h;
+            s->h = h*fmin(10.0, fmax(0.2, 0.9*pow(fmax(err, 1e-10), -0.2)));
+            return 0;
+        }
+        s->stats->nreject += 1;
+        s->h = h*fmax(0.2, 0.9*pow(err, -0.2));
+    }
+}
+
+/// MARK: ROSENBROCK
+/// This subroutine is used to take one accepted step of the stiffly accurate Rodas3 Rosenbrock method (order 3 with an embedded order 2 solution), which also integrates index-1 algebraic equations. Rodas3 is not a W-method, so its order relies on the exact Jacobian: the Jacobian is evaluated once at each accepted point and only kept when a rejected step is retried from the same point. The model equations at the new point are reused as the first stage of the next step. This function returns 0 on success and 1 if the step size underflows.
+static int DynRosenbrockStep(DynStepper *s, double tend)
+{
+    static const double a[4][3] = {{0}, {0}, {2, 0}, {2, 0, 1}};
+    static const double c[4][3] = {{0}, {4}, {1, -1}, {1, -1, -8.0/3}};
+    static const double alpha[4] = {0, 0, 1, 1};
+    static const double gamma[4] = {0.5, 1.5, 0, 0};
+    static const double m[4] = {2, 0, 1, 1};
+    const double *M = s->sys->mass;
+    int n = s->n;
+    
+    while(1)
+    {
+        double h = s->h;
+        double err = 0.0;
+        double *Fi = s->Fnew;
+        
+        if(s->opt->hmax > 0 && h > s->opt->hmax)
+        {
+            h = s->opt->hmax;
+        }
+        if(s->t + h > tend)
+        {
+            h = tend - s->t;
+        }
+        if(h < 10*DBL_EPSILON*fmax(fabs(s->t), 1.0))
+        {
+            return 1;
+        }
+        
+        if(s->jacage < 0)
+        {
+            double dt = sqrt(DBL_EPSILON)*fmax(fabs(s->t), 1.0);
+            
+            DynJacobianEvaluate(s, s->t, s->y, s->F);
+            DynEvaluate(s->sys, s->t + dt, s->y, s->dFdt);
+            s->stats->nfev += 1;
+            for(int i = 0; i < n; ++i)
+            {
+                s->dFdt[i] = (s->dFdt[i] - s->F[i])/dt;
+            }
+        }
+        if(s->Wc != gamma[0]*h && DynIterationMatrix(s, gamma[0]*h) != 0)
+        {
+            s->h = 0.5*h;
+            continue;
+        }
+        
+        //  Stages: (M - h gamma J) K_i = h gamma [f(Y_i) + M sum(c_ij K_j)/h + h gamma_i df/dt]
+        for(int st = 0; st < 4; ++st)
+        {
+            double *K = s->k[st];
+            
+            if(st == 0 || st == 1)
+            {
+                //  Stages 1 and 2 share the model evaluation at the start of the step
+                Fi = s->F;
+            }else{
+                for(int i = 0; i < n; ++i)
+                {
+                    double sum = 0.0;
+                    
+                    for(int j = 0; j < st; ++j)
+                    {
+                        sum += a[st][j]*s->k[j][i];
+                    }
+                    s->ynew[i] = s->y[i] + sum;
+                }
+                DynEvaluate(s->sys, s->t + alpha[st]*h, s->ynew, s->Fnew);
+                s->stats->nfev += 1;
+                Fi = s->Fnew;
+            }
+            for(int i = 0; i < n; ++i)
+            {
+                double sum = 0.0;
+                
+                for(int j = 0; j < st; ++j)
+                {
+                    sum += c[st][j]*s->k[j][i];
+                }
+                K[i] = gamma[0]*h*(Fi[i] + M[i]*sum/h + h*gamma[st]*s->dFdt[i]);
+            }
+            BandLUSolve(&s->jac.W, K);
+        }
+        
+        //  New solution and the embedded error estimate, which is the last stage
+        for(int i = 0; i < n; ++i)
+        {
+            double sum = 0.0;
+            
+            for(int j = 0; j < 4; ++j)
+            {
+                sum += m[j]*s->k[j][i];
+            }
+            s->ynew[i] = s->y[i] + sum;
+        }
+        err = DynErrorNorm(s, s->k[3], s->y, s->ynew);
+        
+        if(err <= 1.0 && isfinite(err))
+        {
+            double factor = fmin(5.0, 0.9*pow(fmax(err, 1e-10), -1.0/3));
+            
+            DynEvaluate(s->sys, s->t + h, s->ynew, s->Fnew);
+            s->stats->nfev += 1;
+            s->tnew = s->t + h;
+            s->hused = h;
+            s->h = h*factor;
+            //  The Jacobian at the new point is evaluated at the start of the next step
+            s->jacage = -1;
+            return 0;
+        }
+        //  The step is retried from the same point, so the Jacobian is still exact and only the iteration matrix changes
+        s->stats->nreject += 1;
+        s->h = h*(isfinite(err) ? fmax(0.2, 0.9*pow(err, -1.0/3)) : 0.25);
+    }
+}
+
+/// MARK: BACKWARD DIFFERENTIATION FORMULAE
+static const double bdfkappa[bdfmaxorder + 2] = {0, -0.1850, -1.0/9, -0.0823, -0.0415, 0, 0};
+
+/// This subroutine is used to calculate the BDF coefficients gamma_k, alpha_k and the error constant of each order.
+static void DynBDFCoefficients(double *gamma, double *alpha, double *errconst)
+{
+    gamma[0] = 0.0;
+    for(int k = 1; k <= bdfmaxorder + 1; ++k)
+    {
+        gamma[k] = gamma[k - 1] + 1.0/k;
+    }
+    for(int k = 0; k <= bdfmaxorder + 1; ++k)
+    {
+        alpha[k] = (1 - bdfkappa[k])*gamma[k];
+        errconst[k] = bdfkappa[k]*gamma[k] + 1.0/(k + 1);
+    }
+}
+
+/// This subroutine is used to rescale the difference array when the step size changes by the given factor.
+static void DynBDFRescale(DynStepper *s, double factor)
+{
+    int q = s->order;
+    double R[bdfmaxorder + 1][bdfmaxorder + 1];
+    double U[bdfmaxorder + 1][bdfmaxorder + 1];
+    double RU[bdfmaxorder + 1][bdfmaxorder + 1];
+    
+    //  R_ij = prod_{m = 1..i} (m - 1 - factor j)/m, U is R with factor = 1
+    for(int j = 0; j <= q; ++j)
+    {
+        R[0][j] = 1.0;
+        U[0][j] = 1.0;
+        for(int i = 1; i <= q; ++i)
+        {
+            R[i][j] = R[i - 1][j]*((i - 1 - factor*j)/i);
+            U[i][j] = U[i - 1][j]*((i - 1 - (double)j)/i);
+        }
+    }
+    for(int i = 0; i <= q; ++i)
+    {
+        for(int j = 0; j <= q; ++j)
+        {
+            RU[i][j] = 0.0;
+            for(int m = 0; m <= q; ++m)
+            {
+                RU[i][j] += R[i][m]*U[m][j];
+            }
+        }
+    }
+    
+    //  D <- (RU)^T D over the first q + 1 rows
+    for(int i = 0; i < s->n; ++i)
+    {
+        double old[bdfmaxorder + 1];
+        
+        for(int j = 0; j <= q; ++j)
+        {
+            old[j] = s->D[j*s->n + i];
+        }
+        for(int j = 0; j <= q; ++j)
+        {
+            double sum = 0.0;
+            
+            for(int m = 0; m <= q; ++m)
+            {
+                sum += RU[m][j]*old[m];
+            }
+            s->D[j*s->n + i] = sum;
+        }
+    }
+    s->nequal = 0;
+    s->Wc = 0.0;
+}
+
+/// This subroutine is used to take one accepted step of the variable order BDF method in the quasi-constant step form used by ode15s. The Jacobian is only re-evaluated when the Newton iteration fails to converge. This function returns 0 on success and 1 if the step size underflows.
+static int DynBDFStep(DynStepper *s, double tend)
+{
+    double gamma[bdfmaxorder + 2];
+    double alpha[bdfmaxorder + 2];
+    double errconst[bdfmaxorder + 2];
+    double newtontol = fmax(10*DBL_EPSILON/s->opt->rtol, fmin(0.03, sqrt(s->opt->rtol)));
+    const double *M = s->sys->mass;
+    int n = s->n;
+    int niter = 0;
+    int current = (s->jacage == 0);
+    double *ypred = s->k[0];
+    double *psi = s->k[1];
+    double *dsum = s->k[2];
+    double *scale = s->k[3];
+    double err = 0.0;
+    double h = s->h;
+    
+    DynBDFCoefficients(gamma, alpha, errconst);
+    
+    if(s->opt->hmax > 0 && h > s->opt->hmax)
+    {
+        DynBDFRescale(s, s->opt->hmax/h);
+        h = s->opt->hmax;
+    }
+    
+    while(1)
+    {
+        int converged = 0;
+        double c = 0.0;
+        
+        if(h < 10*DBL_EPSILON*fmax(fabs(s->t), 1.0))
+        {
+            return 1;
+        }
+        if(s->t + h > tend)
+        {
+            DynBDFRescale(s, (tend - s->t)/h);
+            h = tend - s->t;
+        }
+        
+        //  Predictor and the history term psi
+        for(int i = 0; i < n; ++i)
+        {
+            double sum = 0.0;
+            double p = 0.0;
+            
+            for(int j = 0; j <= s->order; ++j)
+            {
+                sum += s->D[j*n + i];
+            }
+            for(int j = 1; j <= s->order; ++j)
+            {
+                p += gamma[j]*s->D[j*n + i];
+            }
+            ypred[i] = sum;
+            psi[i] = p/alpha[s->order];
+            scale[i] = s->opt->atol + s->opt->rtol*fabs(sum);
+        }
+        c = h/alpha[s->order];
+        
+        //  Simplified Newton iteration on M (psi + d) = c f(y)
+        while(converged == 0)
+        {
+            double dynorm = 0.0;
+            double dynormold = -1.0;
+            
+            if(s->Wc != c && DynIterationMatrix(s, c) != 0)
+            {
+                break;
+            }
+            memcpy(s->ynew, ypred, n*sizeof(double));
+            memset(dsum, 0, n*sizeof(double));
+            for(niter = 1; niter <= bdfnewtonmax; ++niter)
+            {
+                double rate = -1.0;
+                
+                DynEvaluate(s->sys, s->t + h, s->ynew, s->Fnew);
+                s->stats->nfev += 1;
+                for(int i = 0; i < n; ++i)
+                {
+                    s->tmp[i] = c*s->Fnew[i] - M[i]*(psi[i] + dsum[i]);
+                }
+                BandLUSolve(&s->jac.W, s->tmp);
+                
+                dynorm = 0.0;
+                for(int i = 0; i < n; ++i)
+                {
+                    dynorm += pow(s->tmp[i]/scale[i], 2);
+                }
+                dynorm = sqrt(dynorm/n);
+                if(!isfinite(dynorm))
+                {
+                    break;
+                }
+                if(dynormold > 0)
+                {
+                    rate = dynorm/dynormold;
+                    if(rate >= 1 || pow(rate, bdfnewtonmax - niter + 1)/(1 - rate)*dynorm > newtontol)
+                    {
+                        break;
+                    }
+                }
+                for(int i = 0; i < n; ++i)
+                {
+                    s->ynew[i] += s->tmp[i];
+                    dsum[i] += s->tmp[i];
+                }
+                if(dynorm == 0 || (rate > 0 && rate/(1 - rate)*dynorm < newtontol))
+                {
+                    converged = 1;
+                    break;
+                }
+                dynormold = dynorm;
+            }
+            if(converged == 0)
+            {
+                if(current == 1)
+                {
+                    break;
+                }
+                //  Refreshing the Jacobian at the predicted point
+                DynEvaluate(s->sys, s->t + h, ypred, s->tmp2);
+                s->stats->nfev += 1;
+                memcpy(s->Fnew, s->tmp2, n*sizeof(double));
+                DynJacobianEvaluate(s, s->t + h, ypred, s->Fnew);
+                current = 1;
+            }
+        }
+        
+        if(converged == 0)
+        {
+            s->stats->nreject += 1;
+            DynBDFRescale(s, 0.5);
+            h = 0.5*h;
+            continue;
+        }
+        
+        //  Local error estimate
+        for(int i = 0; i < n; ++i)
+        {
+            s->tmp[i] = errconst[s->order]*dsum[i];
+        }
+        err = DynErrorNorm(s, s->tmp, s->ynew, s->ynew);
+        if(err > 1.0)
+        {
+            double safety = 0.9*(2*bdfnewtonmax + 1)/(2*bdfnewtonmax + niter);
+            double factor = fmax(0.2, safety*pow(err, -1.0/(s->order + 1)));
+            
+            s->stats->nreject += 1;
+            DynBDFRescale(s, factor);
+            h = h*factor;
+            continue;
+        }
+        break;
+    }
+    
+    //  Accepting the step and updating the differences
+    s->tnew = s->t + h;
+    s->hused = h;
+    s->jacage += 1;
+    s->nequal += 1;
+    for(int i = 0; i < n; ++i)
+    {
+        int q = s->order;
+        
+        s->D[(q + 2)*n + i] = dsum[i] - s->D[(q + 1)*n + i];
+        s->D[(q + 1)*n + i] = dsum[i];
+        for(int j = q; j >= 0; --j)
+        {
+            s->D[j*n + i] += s->D[(j + 1)*n + i];
+        }
+    }
+    s->h = h;
+    
+    //  Order and step size selection once the step has been held for order + 1 steps
+    if(s->nequal >= s->order + 1)
+    {
+        double safety = 0.9*(2*bdfnewtonmax + 1)/(2*bdfnewtonmax + niter);
+        double norms[3] = {INFINITY, err, INFINITY};
+        double best = 0.0;
+        int change = 0;
+        
+        if(s->order > 1)
+        {
+            for(int i = 0; i < n; ++i)
+            {
+                s->tmp[i] = errconst[s->order - 1]*s->D[s->order*n + i];
+            }
+            norms[0] = DynErrorNorm(s, s->tmp, s->ynew, s->ynew);
+        }
+        if(s->order < bdfmaxorder)
+        {
+            for(int i = 0; i < n; ++i)
+            {
+                s->tmp[i] = errconst[s->order + 1]*s->D[(s->order + 2)*n + i];
+            }
+            norms[2] = DynErrorNorm(s, s->tmp, s->ynew, s->ynew);
+        }
+        for(int m = 0; m < 3; ++m)
+        {
+            double factor = (norms[m] > 0) ? pow(norms[m], -1.0/(s->order + m)) : 10.0;
+            
+            if(factor > best)
+            {
+                best = factor;
+                change = m - 1;
+            }
+        }
+        s->order += change;
+        best = fmin(10.0, safety*best);
+        DynBDFRescale(s, best);
+        s->h = h*best;
+    }
+    
+    return 0;
+}
+
+/// MARK: STEPPER
+/// This subroutine is used to start or restart the integrator from the given point.
+static void DynStepperStart(DynStepper *s, double t, const double *y)
+{
+    int n = s->n;
+    double d0 = 0.0;
+    double d1 = 0.0;
+    
+    s->t = t;
+    memcpy(s->y, y, n*sizeof(double));
+    DynEvaluate(s->sys, t, s->y, s->F);
+    s->stats->nfev += 1;
+    
+    //  Initial step size from the scale of the solution and its rate of change
+    for(int i = 0; i < n; ++i)
+    {
+        double scale = s->opt->atol + s->opt->rtol*fabs(y[i]);
+        
+        d0 += pow(y[i]/scale, 2);
+        if(s->sys->mass[i] != 0.0)
+        {
+            d1 += pow(s->F[i]/s->sys->mass[i]/scale, 2);
+        }
+    }
+    d0 = sqrt(d0/n);
+    d1 = sqrt(d1/n);
+    s->h = (d0 < 1e-5 || d1 < 1e-5) ? 1e-6 : 0.01*d0/d1;
+    s->h = fmin(s->h, s->opt->tend - t);
+    if(s->opt->hmax > 0)
+    {
+        s->h = fmin(s->h, s->opt->hmax);
+    }
+    
+    switch(s->method)
+    {
+        case DynRK45:
+            for(int i = 0; i < n; ++i)
+            {
+                s->k[0][i] = s->F[i]/s->sys->mass[i];
+            }
+            break;
+        case DynRosenbrock:
+            s->jacage = -1;
+            s->Wc = 0.0;
+            break;
+        case DynBDF:
+            DynJacobianEvaluate(s, t, s->y, s->F);
+            s->order = 1;
+            s->nequal = 0;
+            memset(s->D, 0, (bdfmaxorder + 3)*n*sizeof(double));
+            for(int i = 0; i < n; ++i)
+            {
+                s->D[i] = y[i];
+                s->D[n + i] = (s->sys->mass[i] != 0.0) ? s->h*s->F[i]/s->sys->mass[i] : 0.0;
+            }
+            break;
+    }
+}
+
+/// This subroutine is used to interpolate the solution within the last step from the dense output of each method.
+static void DynStepperInterpolate(const DynStepper *s, double t, double *yout)
+{
+    int n = s->n;
+    double h = s->hused;
+    double x = (t - s->t)/h;
+    
+    switch(s->method)
+    {
+        case DynRK45:
+            //  Cubic Hermite interpolation through both ends of the step
+            for(int i = 0; i < n; ++i)
+            {
+                double h00 = (1 + 2*x)*(1 - x)*(1 - x);
+                double h10 = x*(1 - x)*(1 - x);
+                double h01 = x*x*(3 - 2*x);
+                double h11 = x*x*(x - 1);
+                
+                yout[i] = h00*s->y[i] + h10*h*s->k[0][i] + h01*s->ynew[i] + h11*h*s->k[6][i];
+            }
+            break;
+        case DynRosenbrock:
+            //  Cubic Hermite interpolation for differential states and linear interpolation for algebraic states
+            for(int i = 0; i < n; ++i)
+            {
+                double mass = s->sys->mass[i];
+                
+                if(mass != 0.0)
+                {
+                    double h00 = (1 + 2*x)*(1 - x)*(1 - x);
+                    double h10 = x*(1 - x)*(1 - x);
+                    double h01 = x*x*(3 - 2*x);
+                    double h11 = x*x*(x - 1);
+                    
+                    yout[i] = h00*s->y[i] + h10*h*s->F[i]/mass + h01*s->ynew[i] + h11*h*s->Fnew[i]/mass;
+                }else{
+                    yout[i] = (1 - x)*s->y[i] + x*s->ynew[i];
+                }
+            }
+            break;
+        case DynBDF:
+        {
+            //  Newton form of the interpolating polynomial through the back points
+            double hb = s->h;
+            double coef[bdfmaxorder + 1];
+            
+            coef[0] = 1.0;
+            for(int j = 1; j <= s->order; ++j)
+            {
+                coef[j] = coef[j - 1]*(t - (s->tnew - hb*(j - 1)))/(hb*j);
+            }
+            for(int i = 0; i < n; ++i)
+            {
+                double sum = 0.0;
+                
+                for(int j = 0; j <= s->order; ++j)
+                {
+                    sum += coef[j]*s->D[j*n + i];
+                }
+                yout[i] = sum;
+            }
+            break;
+        }
+    }
+}
+
+/// This subroutine is used to move the integrator to the end of the accepted step.
+static void DynStepperCommit(DynStepper *s)
+{
+    double *sto = NULL;
+    
+    s->t = s->tnew;
+    sto = s->y;
+    s->y = s->ynew;
+    s->ynew = sto;
+    sto = s->F;
+    s->F = s->Fnew;
+    s->Fnew = sto;
+    if(s->method == DynRK45)
+    {
+        //  First same as last
+        sto = s->k[0];
+        s->k[0] = s->k[6];
+        s->k[6] = sto;
+    }
+}
+
+/// MARK: INTEGRATION
+/// This subroutine is used to append an output to the results.
+static void DynRecord(DynResult *res, double t, const double *y)
+{
+    if(res->nout == res->maxout)
+    {
+        res->maxout += outputblock;
+        res->t = realloc(res->t, res->maxout*sizeof(double));
+        res->y = realloc(res->y, (size_t)res->maxout*res->n*sizeof(double));
+    }
+    res->t[res->nout] = t;
+    memcpy(&res->y[(size_t)res->nout*res->n], y, res->n*sizeof(double));
+    res->nout += 1;
+}
+
+/// This subroutine is used to locate an event within the last step by the Illinois method on the dense output. The returned time lies just after the crossing.
+static double DynLocateEvent(const DynStepper *s, const DynEvent *event, double ga, double gb, double *ywork)
+{
+    double a = s->t;
+    double b = s->tnew;
+    int side = 0;
+    
+    for(int iter = 0; iter < 100 && b - a > 4*DBL_EPSILON*fmax(fabs(b), 1.0); ++iter)
+    {
+        double m = (a*gb - b*ga)/(gb - ga);
+        double gm = 0.0;
+        
+        if(!(m > a && m < b))
+        {
+            m = 0.5*(a + b);
+        }
+        DynStepperInterpolate(s, m, ywork);
+        gm = event->g(m, ywork, event->params);
+        if((gm > 0) == (gb > 0) && gm != 0)
+        {
+            b = m;
+            gb = gm;
+            if(side == 1)
+            {
+                ga = 0.5*ga;
+            }
+            side = 1;
+        }else{
+            a = m;
+            ga = gm;
+            if(side == -1)
+            {
+                gb = 0.5*gb;
+            }
+            side = -1;
+        }
+    }
+    return b;
+}
+
+int DynIntegrate(DynSystem *sys, const DynOptions *opt, DynResult *res)
+{
+    DynStepper s;
+    int n = sys->n;
+    int kout = 1;       // Index of the next regular output.
+    double tout = 0.0;
+    double *y = NULL;
+    double *gold = NULL;
+    double *gnew = NULL;
+    
+    memset(res, 0, sizeof(DynResult));
+    res->n = n;
+    memset(&s, 0, sizeof(DynStepper));
+    s.sys = sys;
+    s.opt = opt;
+    s.stats = &res->stats;
+    s.n = n;
+    s.method = opt->method;
+    s.y = calloc(n, sizeof(double));
+    s.ynew = calloc(n, sizeof(double));
+    s.F = calloc(n, sizeof(double));
+    s.Fnew = calloc(n, sizeof(double));
+    s.tmp = calloc(n, sizeof(double));
+    s.tmp2 = calloc(n, sizeof(double));
+    s.dFdt = calloc(n, sizeof(double));
+    s.D = calloc((bdfmaxorder + 3)*n, sizeof(double));
+    for(int j = 0; j < 7; ++j)
+    {
+        s.k[j] = calloc(n, sizeof(double));
+    }
+    y = malloc(n*sizeof(double));
+    gold = calloc(sys->nevents + 1, sizeof(double));
+    gnew = calloc(sys->nevents + 1, sizeof(double));
+    DynJacobianPattern(sys, &s.jac);
+    res->stats.ncolour = s.jac.ncolour;
+    
+    //  The explicit method cannot integrate algebraic equations
+    for(int i = 0; i < n && s.method == DynRK45; ++i)
+    {
+        if(sys->mass[i] == 0.0)
+        {
+            printf("The flowsheet contains algebraic equations. Switching to the Rosenbrock method.\n");
+            s.method = DynRosenbrock;
+        }
+    }
+    
+    memcpy(y, sys->y0, n*sizeof(double));
+    if(DynConsistentStart(&s, 0.0, y) != 0)
+    {
+        printf("The initial algebraic states could not be made consistent.\n");
+    }
+    DynRecord(res, 0.0, y);
+    tout = opt->dtout;
+    DynStepperStart(&s, 0.0, y);
+    for(int e = 0; e < sys->nevents; ++e)
+    {
+        gold[e] = sys->event[e].g(0.0, y, sys->event[e].params);
+    }
+    
+    res->status = 0;
+    while(s.t < opt->tend)
+    {
+        int fired = -1;
+        double tevent = s.tnew;
+        int status = 0;
+        
+        if(res->stats.nsteps >= opt->maxsteps)
+        {
+            printf("The step limit was reached at t = %.6f s.\n", s.t);
+            res->status = -1;
+            break;
+        }
+        switch(s.method)
+        {
+            case DynRK45:
+                status = DynRK45Step(&s, opt->tend);
+                break;
+            case DynRosenbrock:
+                status = DynRosenbrockStep(&s, opt->tend);
+                break;
+            default:
+                status = DynBDFStep(&s, opt->tend);
+                break;
+        }
+        if(status != 0)
+        {
+            printf("The step size became too small at t = %.6f s.\n", s.t);
+            res->status = -1;
+            break;
+        }
+        res->stats.nsteps += 1;
+        tevent = s.tnew;
+        
+        //  Event detection on the dense output
+        for(int e = 0; e < sys->nevents; ++e)
+        {
+            const DynEvent *event = &sys->event[e];
+            int up = 0;
+            int down = 0;
+            
+            gnew[e] = event->g(s.tnew, s.ynew, event->params);
+            up = (gold[e] < 0 && gnew[e] >= 0);
+            down = (gold[e] > 0 && gnew[e] <= 0);
+            if((up == 1 && event->direction >= 0) || (down == 1 && event->direction <= 0))
+            {
+                double te = DynLocateEvent(&s, event, gold[e], gnew[e], y);
+                
+                if(te < tevent || fired < 0)
+                {
+                    tevent = te;
+                    fired = e;
+                }
+            }
+        }
+        
+        //  Outputs within the step
+        while(tout <= tevent*(1 + 4*DBL_EPSILON) && tout < opt->tend)
+        {
+            DynStepperInterpolate(&s, tout, y);
+            DynRecord(res, tout, y);
+            kout += 1;
+            tout = opt->dtout*kout;
+        }
+        
+        if(fired >= 0)
+        {
+            const DynEvent *event = &sys->event[fired];
+            
+            DynStepperInterpolate(&s, tevent, y);
+            if(tevent - res->t[res->nout - 1] > 1e-9*fmax(fabs(tevent), 1.0))
+            {
+                DynRecord(res, tevent, y);
+            }
+            res->tevent = realloc(res->tevent, (res->nfired + 1)*sizeof(double));
+            res->ievent = realloc(res->ievent, (res->nfired + 1)*sizeof(int));
+            res->tevent[res->nfired] = tevent;
+            res->ievent[res->nfired] = fired;
+            res->nfired += 1;
+            if(event->terminal == 1)
+            {
+                res->status = 1;
+                break;
+            }
+            
+            //  Restarting from the event with the action applied. Interpolated algebraic states are only approximately consistent.
+            if(event->action != NULL)
+            {
+                event->action(tevent, y, event->params);
+            }
+            DynConsistentStart(&s, tevent, y);
+            DynStepperStart(&s, tevent, y);
+            for(int e = 0; e < sys->nevents; ++e)
+            {
+                gold[e] = sys->event[e].g(tevent, y, sys->event[e].params);
+            }
+            continue;
+        }
+        
+        DynStepperCommit(&s);
+        memcpy(gold, gnew, sys->nevents*sizeof(double));
+    }
+    if(res->status != 1 && res->t[res->nout - 1] < s.t)
+    {
+        DynRecord(res, s.t, s.y);
+    }
+    
+    DynJacobianFree(&s.jac);
+    free(s.y);
+    free(s.ynew);
+    free(s.F);
+    free(s.Fnew);
+    free(s.tmp);
+    free(s.tmp2);
+    free(s.dFdt);
+    free(s.D);
+    for(int j = 0; j < 7; ++j)
+    {
+        free(s.k[j]);
+    }
+    free(y);
+    free(gold);
+    free(gnew);
+    
+    return res->status;
+}
+
+void DynResultFree(DynResult *res)
+{
+    free(res->t);
+    free(res->y);
+    free(res->tevent);
+    free(res->ievent);
+    memset(res, 0, sizeof(DynResult));
+}
@@ -0,0 +1,165 @@
+//
+//  DynamicSolver.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef DynamicSolverStruct_h
+#define DynamicSolverStruct_h
+
+#define DynRK45 1           // Dormand-Prince explicit Runge-Kutta pair (non-stiff ODEs only).
+#define DynRosenbrock 2     // Stiffly accurate third order Rosenbrock method (Rodas3) with a second order error estimate.
+#define DynBDF 3            // Variable order (1 - 5) backward differentiation formulae.
+
+#define DynMaxInputs 4      // Largest number of upstream units that can feed a single unit.
+
+/// Function pointer type used to describe a unit model. The model writes its own equations, f[offset] to f[offset + nstates - 1], in the form M dy/dt = f(t, y). Rows with a zero mass are algebraic equations, 0 = f(t, y).
+typedef void (*DynUnitResidual)(double t, const double *y, double *f, int offset, void *params);
+
+/// Function pointer type used to describe an event function. An event occurs when the function changes sign.
+typedef double (*DynEventFunction)(double t, const double *y, void *params);
+
+/// Function pointer type used to describe the action taken when a non-terminal event occurs. The action can change the model parameters or the state vector; the integrator restarts afterwards.
+typedef void (*DynEventAction)(double t, double *y, void *params);
+
+typedef struct DynUnit{
+    char name[32];              // Unit name.
+    int offset;                 // Position of the first state of the unit within the state vector.
+    int nstates;                // Number of states owned by the unit.
+    DynUnitResidual residual;   // Unit model.
+    void *params;               // Unit parameters passed to the model.
+    int ninputs;                // Number of upstream units.
+    int input[DynMaxInputs];    // Upstream units whose states appear in the equations of this unit.
+} DynUnit;
+
+typedef struct DynEvent{
+    char name[32];              // Event name.
+    DynEventFunction g;         // Event function.
+    DynEventAction action;      // Action taken when the event occurs (NULL for none).
+    void *params;               // Parameters passed to the event function and action.
+    int direction;              // Crossings detected: rising (1), falling (-1) or both (0).
+    int terminal;               // Integration stops at the event (1) or continues (0).
+} DynEvent;
+
+typedef struct DynSystem{
+    int n;                      // Number of states.
+    int nunits;                 // Number of units.
+    int nevents;                // Number of events.
+    DynUnit *unit;              // Array of units.
+    DynEvent *event;            // Array of events.
+    double *mass;               // Diagonal of the mass matrix. Differential states have a mass of 1, algebraic states a mass of 0.
+    double *y0;                 // Initial state vector.
+    char (*label)[24];          // Name of each state.
+} DynSystem;
+
+typedef struct DynOptions{
+    int method;                 // Integration method (DynRK45, DynRosenbrock or DynBDF).
+    double rtol;                // Relative error tolerance.
+    double atol;                // Absolute error tolerance.
+    double tend;                // Final time (s).
+    double dtout;               // Interval between recorded outputs (s).
+    double hmax;                // Largest step size (s). Zero places no limit.
+    int maxsteps;               // Largest number of accepted steps.
+} DynOptions;
+
+typedef struct DynStats{
+    int nsteps;                 // Accepted steps.
+    int nreject;                // Rejected steps.
+    int nfev;                   // Model evaluations.
+    int njev;                   // Jacobian evaluations.
+    int nlu;                    // Matrix factorisations.
+    int ncolour;                // Model evaluations needed for each Jacobian.
+} DynStats;
+
+typedef struct DynResult{
+    int n;                      // Number of states.
+    int nout;                   // Number of recorded outputs.
+    int maxout;                 // Allocated number of outputs.
+    double *t;                  // Time of each output (s).
+    double *y;                  // State vector at each output, stored row-major (nout x n).
+    int nfired;                 // Number of events that occurred.
+    double *tevent;             // Time of each event (s).
+    int *ievent;                // Event that occurred.
+    int status;                 // Final time reached (0), terminal event (1) or step size failure (-1).
+    DynStats stats;             // Solver statistics.
+} DynResult;
+
+#endif /* DynamicSolverStruct_h */
+
+#ifndef DynamicSolverSystem_h
+#define DynamicSolverSystem_h
+
+/// This subroutine is used to register a unit model. States are appended to the state vector and default to differential states with an initial value of zero. This function returns the index of the unit.
+/// @param sys Flowsheet description.
+/// @param name Unit name.
+/// @param nstates Number of states owned by the unit.
+/// @param residual Unit model.
+/// @param params Unit parameters passed to the model.
+int DynAddUnit(DynSystem *sys, const char *name, int nstates, DynUnitResidual residual, void *params);
+
+/// This subroutine is used to set the name, initial value and type of a state owned by a unit.
+/// @param sys Flowsheet description.
+/// @param unit Index of the unit.
+/// @param k Position of the state within the unit.
+/// @param label State name.
+/// @param y0 Initial value.
+/// @param mass Mass matrix entry (1 for a differential state, 0 for an algebraic state).
+void DynSetState(DynSystem *sys, int unit, int k, const char *label, double y0, double mass);
+
+/// This subroutine is used to declare that the equations of one unit depend on the states of another. The connections define the sparsity pattern of the Jacobian.
+/// @param sys Flowsheet description.
+/// @param from Index of the upstream unit.
+/// @param to Index of the downstream unit.
+void DynConnect(DynSystem *sys, int from, int to);
+
+/// This subroutine is used to register an event. This function returns the index of the event.
+/// @param sys Flowsheet description.
+/// @param name Event name.
+/// @param fn Event function.
+/// @param action Action taken when the event occurs (NULL for none).
+/// @param params Parameters passed to the event function and action.
+/// @param direction Crossings detected: rising (1), falling (-1) or both (0).
+/// @param terminal Integration stops at the event (1) or continues (0).
+int DynAddEvent(DynSystem *sys, const char *name, DynEventFunction fn, DynEventAction action, void *params, int direction, int terminal);
+
+/// This subroutine is used to evaluate every unit model. Large flowsheets are evaluated in parallel.
+/// @param sys Flowsheet description.
+/// @param t Time (s).
+/// @param y State vector.
+/// @param f Vector where the model equations should be stored.
+void DynEvaluate(const DynSystem *sys, double t, const double *y, double *f);
+
+/// This subroutine is used to release the arrays allocated for a flowsheet. Unit and event parameters belong to the caller.
+/// @param sys Flowsheet description.
+void DynSystemFree(DynSystem *sys);
+
+#endif /* DynamicSolverSystem_h */
+
+#ifndef DynamicSolverIntegrate_h
+#define DynamicSolverIntegrate_h
+
+/// This subroutine is used to integrate the flowsheet from t = 0 to the final time. The algebraic states are first made consistent with the differential states. Outputs are interpolated from the dense output of each step, and events are located on the same interpolant. This function returns the final status.
+/// @param sys Flowsheet description.
+/// @param opt Integration settings.
+/// @param res Struct where the outputs and statistics should be stored. Arrays are allocated by this subroutine and released by "DynResultFree(...)".
+int DynIntegrate(DynSystem *sys, const DynOptions *opt, DynResult *res);
+
+/// This subroutine is used to release the arrays allocated for the integration results.
+/// @param res Integration results.
+void DynResultFree(DynResult *res);
+
+#endif /* DynamicSolverIntegrate_h */
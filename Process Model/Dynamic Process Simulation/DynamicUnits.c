@@ -0,0 +1,582 @@
+//
+//  DynamicUnits.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+/// MARK: HEADER DECLARATIONS
+//Standard Header Files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//Custom Header Files
+#include "System.h"
+#include "ResultWriter.h"
+#include "DimensionlessNum.h"
+#include "03fOrifice.h"
+#include "03bFilmHTCoefficient.h"
+#include "06cEquilibriumConstant.h"
+#include "DynamicSolver.h"
+#include "DynamicSim.h"
+#include "DynamicUnits.h"
+
+/// MARK: SUBROUTINE DEFINITIONS
+#define maxstrlen 128
+#define g 9.80665
+#define PI 3.14159265358979323846
+#define R 8.3145
+
+/// This subroutine is used to read the stream entering a unit, either from the feed or from the outlet block of the upstream unit.
+static void DynInlet(int in, const DynFeed *feed, const double *y, double *stream)
+{
+    if(in < 0)
+    {
+        stream[0] = feed->F;
+        stream[1] = feed->T;
+        stream[2] = feed->CA;
+        stream[3] = feed->CB;
+    }else{
+        memcpy(stream, &y[in], DynStreamSize*sizeof(double));
+    }
+}
+
+/// MARK: UNIT MODELS
+void DynTankModel(double t, const double *y, double *f, int offset, void *params)
+{
+    const DynTank *tank = params;
+    const double *x = &y[offset];
+    double in[DynStreamSize];
+    double h = x[4];
+    double V = 0.0;
+    double Q = 0.0;
+    double u = 0.0;
+    double m = 0.0;
+    (void)t;
+    
+    DynInlet(tank->in, tank->feed, y, in);
+    
+    //  Outlet flow through the orifice under the liquid head
+    if(h > 0)
+    {
+        OrificeCalculation(tank->Cd, tank->d1, tank->d2, tank->fluid->rho, tank->fluid->rho*g*h, 0.0, 0.0, &u, &Q, &m);
+    }
+    V = tank->A*fmax(h, 1e-6);
+    
+    f[offset] = x[0] - Q;
+    f[offset + 1] = in[0]*(in[1] - x[1])/V;
+    f[offset + 2] = in[0]*(in[2] - x[2])/V;
+    f[offset + 3] = in[0]*(in[3] - x[3])/V;
+    f[offset + 4] = (in[0] - x[0])/tank->A;
+}
+
+void DynHeaterModel(double t, const double *y, double *f, int offset, void *params)
+{
+    const DynHeater *heater = params;
+    const DynFluid *fluid = heater->fluid;
+    const double *x = &y[offset];
+    double in[DynStreamSize];
+    double u = 0.0;
+    double Re = 0.0;
+    double Pr = 0.0;
+    double Nu = 0.0;
+    double hi = 0.0;
+    double UA = 0.0;
+    (void)t;
+    
+    DynInlet(heater->in, heater->feed, y, in);
+    
+    //  Tube-side film coefficient at the present flowrate
+    u = fabs(in[0])/(heater->ntubes*PI*heater->d*heater->d/4);
+    Re = ReynoldsNum(fluid->rho, u, heater->d, fluid->mu);
+    Pr = PrandtlNum(fluid->cp, fluid->mu, fluid->k);
+    hi = DittusBoelter(1, Re, Pr, fluid->k, heater->d, &Nu);
+    if(hi > 0)
+    {
+        UA = 1/(1/hi + 1/heater->ho);
+        UA = (UA)*heater->ntubes*PI*heater->d*heater->L;
+    }
+    
+    f[offset] = x[0] - in[0];
+    f[offset + 1] = in[0]*(in[1] - x[1])/heater->V + UA*(heater->Ts - x[1])/(fluid->rho*fluid->cp*heater->V);
+    f[offset + 2] = in[0]*(in[2] - x[2])/heater->V;
+    f[offset + 3] = in[0]*(in[3] - x[3])/heater->V;
+}
+
+void DynReactorModel(double t, const double *y, double *f, int offset, void *params)
+{
+    const DynReactor *reactor = params;
+    const DynFluid *fluid = reactor->fluid;
+    const double *x = &y[offset];
+    double in[DynStreamSize];
+    double kf = 0.0;
+    double K = 0.0;
+    double r = x[4];
+    (void)t;
+    
+    DynInlet(reactor->in, reactor->feed, y, in);
+    
+    //  Reversible rate r = kf (C_A - C_B/K)
+    kf = reactor->k0*exp(-reactor->Ea/(R*x[1]));
+    K = VantHoffCalculation(reactor->h_rxn, reactor->K1, reactor->T1, x[1]);
+    
+    f[offset] = x[0] - in[0];
+    f[offset + 1] = in[0]*(in[1] - x[1])/reactor->V - reactor->h_rxn*r/(fluid->rho*fluid->cp) + reactor->UA*(reactor->Tj - x[1])/(fluid->rho*fluid->cp*reactor->V);
+    f[offset + 2] = in[0]*(in[2] - x[2])/reactor->V - r;
+    f[offset + 3] = in[0]*(in[3] - x[3])/reactor->V + r;
+    f[offset + 4] = r - kf*(x[2] - x[3]/K);
+}
+
+/// MARK: EVENTS
+/// This subroutine is used to detect the feed step change.
+static double DynFeedStepEvent(double t, const double *y, void *params)
+{
+    const DynFeed *feed = params;
+    (void)y;
+    
+    return t - feed->tstep;
+}
+
+/// This subroutine is used to apply the feed step change.
+static void DynFeedStepAction(double t, double *y, void *params)
+{
+    DynFeed *feed = params;
+    (void)t;
+    (void)y;
+    
+    feed->F = feed->Fstep;
+    feed->T = feed->Tstep;
+}
+
+/// This subroutine is used to detect a tank overflowing.
+static double DynOverflowEvent(double t, const double *y, void *params)
+{
+    const DynTank *tank = params;
+    (void)t;
+    
+    return y[tank->level] - tank->hmax;
+}
+
+/// MARK: VARIABLE INPUT
+void DynFlowsheetVariable(DynFluid *fluid, DynFeed *feed, DynTank *tank, DynHeater *heater, DynReactor *reactor, double *h0, int *ntrains, DynOptions *opt)
+{
+    char input[maxstrlen];
+    int control = 0;
+    
+    //  Fluid
+    fluid->rho = inputDouble(0, 0, "fluid density", "kg/m3");
+    
+    fluid->mu = inputDouble(0, 0, "fluid viscosity", "cP");
+    fluid->mu = (fluid->mu)*0.001; // Conversion (cP to Pa.s)
+    
+    fluid->cp = inputDouble(0, 0, "fluid heat capacity", "kJ/kg.K");
+    fluid->cp = (fluid->cp)*1000; // Conversion (kJ to J)
+    
+    fluid->k = inputDouble(0, 0, "fluid thermal conductivity", "W/m.K");
+    
+    //  Feed
+    feed->F = inputDouble(0, 0, "feed flowrate", "m3/s");
+    
+    feed->T = inputDouble(0, 1, "feed temperature", "deg C");
+    feed->T = (feed->T) + 273.15; // Conversion (deg C to K)
+    
+    feed->CA = inputDouble(1, 0, "feed concentration of A", "mol/m3");
+    feed->CB = inputDouble(1, 0, "feed concentration of B", "mol/m3");
+    
+    feed->tstep = -1;
+    if(YesNo("Is there a step change in the feed? [Y/N] ") == 1)
+    {
+        feed->tstep = inputDouble(0, 0, "time of the step change", "s");
+        feed->Fstep = inputDouble(1, 0, "feed flowrate after the step", "m3/s");
+        feed->Tstep = inputDouble(0, 1, "feed temperature after the step", "deg C");
+        feed->Tstep = (feed->Tstep) + 273.15;
+    }
+    
+    *ntrains = (int)inputDouble(0, 0, "number of tank, heater and reactor trains in series", "");
+    
+    //  Tank
+    printf("Holding tank.\n");
+    tank->A = inputDouble(0, 0, "tank cross-sectional area", "m2");
+    *h0 = inputDouble(0, 0, "initial liquid level", "m");
+    tank->hmax = inputDouble(0, 0, "overflow level", "m");
+    tank->Cd = inputDouble(0, 0, "outlet orifice discharge coefficient", "[ ]");
+    
+    tank->d1 = inputDouble(0, 0, "outlet pipe diameter", "mm");
+    tank->d1 = (tank->d1)*0.001; // Conversion (mm to m)
+    
+    tank->d2 = inputDouble(0, 0, "outlet orifice diameter", "mm");
+    tank->d2 = (tank->d2)*0.001;
+    
+    //  Heater
+    printf("Steam heater.\n");
+    heater->V = inputDouble(0, 0, "tube-side holdup", "m3");
+    heater->ntubes = (int)inputDouble(0, 0, "number of tubes", "");
+    
+    heater->d = inputDouble(0, 0, "tube internal diameter", "mm");
+    heater->d = (heater->d)*0.001;
+    
+    heater->L = inputDouble(0, 0, "tube length", "m");
+    heater->ho = inputDouble(0, 0, "steam film coefficient", "W/m2.K");
+    
+    heater->Ts = inputDouble(0, 1, "steam temperature", "deg C");
+    heater->Ts = (heater->Ts) + 273.15;
+    
+    //  Reactor
+    printf("Jacketed CSTR, A <=> B.\n");
+    reactor->V = inputDouble(0, 0, "reactor volume", "m3");
+    reactor->k0 = inputDouble(0, 0, "forward pre-exponential factor", "1/s");
+    
+    reactor->Ea = inputDouble(1, 0, "forward activation energy", "kJ/mol");
+    reactor->Ea = (reactor->Ea)*1000; // Conversion (kJ to J)
+    
+    reactor->h_rxn = inputDouble(1, 1, "enthalpy change of reaction", "kJ/mol");
+    reactor->h_rxn = (reactor->h_rxn)*1000;
+    
+    reactor->K1 = inputDouble(0, 0, "reference equilibrium constant", "[ ]");
+    
+    reactor->T1 = inputDouble(0, 1, "reference equilibrium constant temperature", "deg C");
+    reactor->T1 = (reactor->T1) + 273.15;
+    
+    reactor->UA = inputDouble(1, 0, "jacket heat transfer coefficient times area", "kW/K");
+    reactor->UA = (reactor->UA)*1000;
+    
+    reactor->Tj = inputDouble(0, 1, "jacket temperature", "deg C");
+    reactor->Tj = (reactor->Tj) + 273.15;
+    
+    //  Integration
+    control = 1;
+    while(control == 1)
+    {
+        printf("Integration method: Dormand-Prince RK45 (1), Rosenbrock (2) or BDF (3)? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+                opt->method = DynRK45;
+                control = 0;
+                break;
+            case '2':
+                opt->method = DynRosenbrock;
+                control = 0;
+                break;
+            case '3':
+                opt->method = DynBDF;
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+    opt->rtol = inputDouble(0, 0, "relative tolerance", "");
+    opt->atol = inputDouble(0, 0, "absolute tolerance", "");
+    opt->tend = inputDouble(0, 0, "simulation time", "s");
+    opt->dtout = inputDouble(0, 0, "output interval", "s");
+    opt->hmax = 0.0;
+    opt->maxsteps = 1000000;
+}
+
+/// MARK: GENERAL CALCULATIONS
+void DynFlowsheetBuild(DynSystem *sys, DynFeed *feed, const DynTank *tank, const DynHeater *heater, const DynReactor *reactor, double h0, int ntrains, DynTank **tanks, DynHeater **heaters, DynReactor **reactors)
+{
+    char label[24];
+    int last = -1;      // Last unit registered.
+    
+    *tanks = calloc(ntrains, sizeof(DynTank));
+    *heaters = calloc(ntrains, sizeof(DynHeater));
+    *reactors = calloc(ntrains, sizeof(DynReactor));
+    
+    for(int i = 0; i < ntrains; ++i)
+    {
+        DynTank *tk = &(*tanks)[i];
+        DynHeater *hx = &(*heaters)[i];
+        DynReactor *rx = &(*reactors)[i];
+        int u = 0;
+        
+        //  Every unit starts full of feed; the algebraic states are made consistent by the integrator.
+        *tk = *tank;
+        tk->feed = feed;
+        tk->in = (last < 0) ? -1 : sys->unit[last].offset;
+        u = DynAddUnit(sys, "Tank", 5, DynTankModel, tk);
+        tk->level = sys->unit[u].offset + 4;
+        snprintf(label, sizeof(label), "Tank%i.F", i + 1);
+        DynSetState(sys, u, 0, label, feed->F, 0.0);
+        snprintf(label, sizeof(label), "Tank%i.T", i + 1);
+        DynSetState(sys, u, 1, label, feed->T, 1.0);
+        snprintf(label, sizeof(label), "Tank%i.CA", i + 1);
+        DynSetState(sys, u, 2, label, feed->CA, 1.0);
+        snprintf(label, sizeof(label), "Tank%i.CB", i + 1);
+        DynSetState(sys, u, 3, label, feed->CB, 1.0);
+        snprintf(label, sizeof(label), "Tank%i.h", i + 1);
+        DynSetState(sys, u, 4, label, h0, 1.0);
+        if(last >= 0)
+        {
+            DynConnect(sys, last, u);
+        }
+        DynAddEvent(sys, "Tank overflow", DynOverflowEvent, NULL, tk, 1, 1);
+        last = u;
+        
+        *hx = *heater;
+        hx->feed = feed;
+        hx->in = sys->unit[last].offset;
+        u = DynAddUnit(sys, "Heater", 4, DynHeaterModel, hx);
+        snprintf(label, sizeof(label), "Heat%i.F", i + 1);
+        DynSetState(sys, u, 0, label, feed->F, 0.0);
+        snprintf(label, sizeof(label), "Heat%i.T", i + 1);
+        DynSetState(sys, u, 1, label, feed->T, 1.0);
+        snprintf(label, sizeof(label), "Heat%i.CA", i + 1);
+        DynSetState(sys, u, 2, label, feed->CA, 1.0);
+        snprintf(label, sizeof(label), "Heat%i.CB", i + 1);
+        DynSetState(sys, u, 3, label, feed->CB, 1.0);
+        DynConnect(sys, last, u);
+        last = u;
+        
+        *rx = *reactor;
+        rx->feed = feed;
+        rx->in = sys->unit[last].offset;
+        u = DynAddUnit(sys, "CSTR", 5, DynReactorModel, rx);
+        snprintf(label, sizeof(label), "CSTR%i.F", i + 1);
+        DynSetState(sys, u, 0, label, feed->F, 0.0);
+        snprintf(label, sizeof(label), "CSTR%i.T", i + 1);
+        DynSetState(sys, u, 1, label, feed->T, 1.0);
+        snprintf(label, sizeof(label), "CSTR%i.CA", i + 1);
+        DynSetState(sys, u, 2, label, feed->CA, 1.0);
+        snprintf(label, sizeof(label), "CSTR%i.CB", i + 1);
+        DynSetState(sys, u, 3, label, feed->CB, 1.0);
+        snprintf(label, sizeof(label), "CSTR%i.r", i + 1);
+        DynSetState(sys, u, 4, label, 0.0, 0.0);
+        DynConnect(sys, last, u);
+        last = u;
+    }
+    
+    if(feed->tstep >= 0)
+    {
+        DynAddEvent(sys, "Feed step", DynFeedStepEvent, DynFeedStepAction, feed, 1, 0);
+    }
+}
+
+/// MARK: DISPLAY AND WRITE
+void DynFlowsheetDisplay(const DynSystem *sys, const DynOptions *opt, const DynResult *res, double elapsed)
+{
+    const char *method[] = {"", "Dormand-Prince RK45", "Rosenbrock", "BDF"};
+    int last = sys->unit[sys->nunits - 1].offset;
+    
+    printf("_Dynamic_Flowsheet_Results_\n");
+    printf("Integration method:\n");
+    printf("%s\n", method[opt->method]);
+    printf("Number of states:\n");
+    printf("n =\t%i\n", sys->n);
+    printf("Model evaluations per Jacobian:\n");
+    printf("colours =\t%i\n", res->stats.ncolour);
+    printf("Accepted steps:\t%i\n", res->stats.nsteps);
+    printf("Rejected steps:\t%i\n", res->stats.nreject);
+    printf("Model evaluations:\t%i\n", res->stats.nfev);
+    printf("Jacobian evaluations:\t%i\n", res->stats.njev);
+    printf("Matrix factorisations:\t%i\n", res->stats.nlu);
+    if(elapsed > 0)
+    {
+        printf("Simulated time / wall-clock time:\n");
+        printf("%.1f\n", res->t[res->nout - 1]/elapsed);
+    }
+    printf("\n");
+    
+    if(res->nfired > 0)
+    {
+        printf("\tEvents:\n");
+        printf("t (s)\tEvent\n");
+        for(int e = 0; e < res->nfired; ++e)
+        {
+            printf("%.4f\t%s\n", res->tevent[e], sys->event[res->ievent[e]].name);
+        }
+        printf("\n");
+    }
+    if(res->status == 1)
+    {
+        printf("The simulation stopped at a terminal event.\n\n");
+    }
+    
+    printf("\tOutlet of the last unit:\n");
+    printf("t (s)\tF (m3/s)\tT (deg C)\tC_A (mol/m3)\tC_B (mol/m3)\n");
+    for(int k = 0; k < res->nout; ++k)
+    {
+        const double *y = &res->y[(size_t)k*res->n + last];
+        
+        printf("%.4f\t%.6f\t%.3f\t%.4f\t%.4f\n", res->t[k], y[0], y[1] - 273.15, y[2], y[3]);
+    }
+    printf("\n");
+}
+
+void DynFlowsheetWrite(const DynSystem *sys, const DynOptions *opt, const DynResult *res, double elapsed)
+{
+    //  Function variables
+    const char *method[] = {"", "Dormand-Prince RK45", "Rosenbrock", "BDF"};
+    ResultWriter w;             // Buffered writer for the results file.
+    
+    //  Set file name as timestamp + Dynamic Flowsheet Results
+    if(!writerOpen(&w, "Dynamic Flowsheet Results"))
+    {
+        return;
+    }
+    
+    //  Write to file
+    writerPrintf(&w, "_Dynamic_Flowsheet_Results_\n");
+    writerPrintf(&w, "Integration method:\n");
+    writerPrintf(&w, "%s\n", method[opt->method]);
+    writerPrintf(&w, "Relative and absolute tolerances:\n");
+    writerPrintf(&w, "rtol =\t%.3g\t[ ]\n", opt->rtol);
+    writerPrintf(&w, "atol =\t%.3g\t[ ]\n", opt->atol);
+    writerPrintf(&w, "Number of states:\n");
+    writerPrintf(&w, "n =\t%i\n", sys->n);
+    writerPrintf(&w, "Accepted steps:\t%i\n", res->stats.nsteps);
+    writerPrintf(&w, "Rejected steps:\t%i\n", res->stats.nreject);
+    writerPrintf(&w, "Model evaluations:\t%i\n", res->stats.nfev);
+    writerPrintf(&w, "Jacobian evaluations:\t%i\n", res->stats.njev);
+    writerPrintf(&w, "Matrix factorisations:\t%i\n", res->stats.nlu);
+    writerPrintf(&w, "Wall-clock time:\t%.6f\ts\n\n", elapsed);
+    
+    for(int e = 0; e < res->nfired; ++e)
+    {
+        writerPrintf(&w, "Event at t = %.6f s:\t%s\n", res->tevent[e], sys->event[res->ievent[e]].name);
+    }
+    writerPrintf(&w, "\n");
+    
+    //  Temperatures are written in kelvin, as integrated.
+    writerPrintf(&w, "t (s)");
+    for(int i = 0; i < sys->n; ++i)
+    {
+        writerPrintf(&w, "\t%s", sys->label[i]);
+    }
+    writerPrintf(&w, "\n");
+    for(int k = 0; k < res->nout; ++k)
+    {
+        writerPrintf(&w, "%.6f", res->t[k]);
+        for(int i = 0; i < sys->n; ++i)
+        {
+            writerPrintf(&w, "\t%.6g", res->y[(size_t)k*res->n + i]);
+        }
+        writerPrintf(&w, "\n");
+    }
+    
+    //  Close file
+    writerClose(&w);
+}
+
+void DynFlowsheetWriteSwitch(const DynSystem *sys, const DynOptions *opt, const DynResult *res, double elapsed)
+{
+    int control = 0;
+    
+    control = 1;
+    while(control == 1)
+    {
+        char input[maxstrlen];
+        
+        printf("Do you want to save results to file? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+            case 'T':
+            case 'Y':
+            case 't':
+            case 'y':
+                DynFlowsheetWrite(sys, opt, res, elapsed);
+                control = 0;
+                break;
+            case '0':
+            case 'F':
+            case 'N':
+            case 'f':
+            case 'n':
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+}
+
+/// MARK: PSEUDO-MAIN FUNCTION
+void DynamicFlowsheet(void)
+{
+    int whilmain = 0;
+    printf("Dynamic Flowsheet Simulation\n");
+    
+    whilmain = 1;
+    while(whilmain == 1)
+    {
+        //  Variable declaration
+        DynFluid fluid;
+        DynFeed feed;
+        DynTank tank;
+        DynHeater heater;
+        DynReactor reactor;
+        DynTank *tanks = NULL;
+        DynHeater *heaters = NULL;
+        DynReactor *reactors = NULL;
+        DynOptions opt;
+        DynSystem sys;
+        DynResult res;
+        double h0 = 0.0;
+        int ntrains = 0;
+            //  Variables for timing function
+        struct timespec start, end;
+        double elapsed = 0.0;
+        
+        memset(&tank, 0, sizeof(DynTank));
+        memset(&heater, 0, sizeof(DynHeater));
+        memset(&reactor, 0, sizeof(DynReactor));
+        memset(&sys, 0, sizeof(DynSystem));
+        
+        //  Data Collection
+        DynFlowsheetVariable(&fluid, &feed, &tank, &heater, &reactor, &h0, &ntrains, &opt);
+        tank.fluid = &fluid;
+        heater.fluid = &fluid;
+        reactor.fluid = &fluid;
+        DynFlowsheetBuild(&sys, &feed, &tank, &heater, &reactor, h0, ntrains, &tanks, &heaters, &reactors);
+        
+        //  Data Manipulation
+        clock_getres(CLOCK_MONOTONIC, &start);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        
+        DynIntegrate(&sys, &opt, &res);
+        
+        clock_getres(CLOCK_MONOTONIC, &end);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        elapsed = timer(start, end);
+
+        printf("Calculations completed in %.6f seconds.\n", elapsed);
+        
+        //  Displaying results
+        DynFlowsheetDisplay(&sys, &opt, &res, elapsed);
+        
+        //  Writing to File
+        DynFlowsheetWriteSwitch(&sys, &opt, &res, elapsed);
+        
+        //  Continue function
+        whilmain = Continue(whilmain);
+        DynResultFree(&res);
+        DynSystemFree(&sys);
+        free(tanks);
+        free(heaters);
+        free(reactors);
+    }
+    fflush(stdout);
+}
@@ -0,0 +1,165 @@
+//
+//  DynamicUnits.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef DynamicUnitsStruct_h
+#define DynamicUnitsStruct_h
+
+#define DynStreamSize 4     // Every unit begins with its outlet stream: flowrate, temperature and the concentrations of A and B.
+
+typedef struct DynFluid{
+    double rho;         // Fluid density (kg/m3).
+    double mu;          // Fluid viscosity (Pa.s).
+    double cp;          // Fluid heat capacity at constant pressure (J/kg.K).
+    double k;           // Fluid thermal conductivity (W/m.K).
+} DynFluid;
+
+typedef struct DynFeed{
+    double F;           // Feed flowrate (m3/s).
+    double T;           // Feed temperature (K).
+    double CA;          // Feed concentration of A (mol/m3).
+    double CB;          // Feed concentration of B (mol/m3).
+    double tstep;       // Time of the feed step change (s). Negative values disable the step.
+    double Fstep;       // Feed flowrate after the step (m3/s).
+    double Tstep;       // Feed temperature after the step (K).
+} DynFeed;
+
+typedef struct DynTank{
+    int in;                 // First state of the upstream outlet stream (-1 for the feed).
+    int level;              // Position of the liquid level within the state vector.
+    DynFeed *feed;
+    const DynFluid *fluid;
+    double A;               // Tank cross-sectional area (m2).
+    double Cd;              // Outlet orifice discharge coefficient ([ ]).
+    double d1;              // Outlet pipe diameter (m).
+    double d2;              // Outlet orifice diameter (m).
+    double hmax;            // Liquid level at which the tank overflows (m).
+} DynTank;
+
+typedef struct DynHeater{
+    int in;                 // First state of the upstream outlet stream (-1 for the feed).
+    DynFeed *feed;
+    const DynFluid *fluid;
+    double V;               // Tube-side holdup (m3).
+    int ntubes;             // Number of tubes ([ ]).
+    double d;               // Tube internal diameter (m).
+    double L;               // Tube length (m).
+    double ho;              // Condensing steam film coefficient (W/m2.K).
+    double Ts;              // Steam temperature (K).
+} DynHeater;
+
+typedef struct DynReactor{
+    int in;                 // First state of the upstream outlet stream (-1 for the feed).
+    DynFeed *feed;
+    const DynFluid *fluid;
+    double V;               // Reactor volume (m3).
+    double k0;              // Forward pre-exponential factor (1/s).
+    double Ea;              // Forward activation energy (J/mol).
+    double h_rxn;           // Enthalpy change of reaction (J/mol).
+    double K1;              // Reference equilibrium constant ([ ]).
+    double T1;              // Reference equilibrium constant temperature (K).
+    double UA;              // Jacket heat transfer coefficient times area (W/K).
+    double Tj;              // Jacket temperature (K).
+} DynReactor;
+
+#endif /* DynamicUnitsStruct_h */
+
+#ifndef DynamicUnitsModels_h
+#define DynamicUnitsModels_h
+
+/// This subroutine is used to describe a holding tank drained through an orifice. States: outlet flowrate (algebraic, from "OrificeCalculation(...)"), temperature, concentrations of A and B, liquid level.
+/// @param t Time (s).
+/// @param y State vector.
+/// @param f Vector where the model equations should be stored.
+/// @param offset Position of the first state of the unit.
+/// @param params Pointer to a "DynTank" struct.
+void DynTankModel(double t, const double *y, double *f, int offset, void *params);
+
+/// This subroutine is used to describe a steam-heated tube bundle lumped as a single well-mixed volume. The tube-side coefficient follows "DittusBoelter(...)" at the instantaneous flowrate. States: outlet flowrate (algebraic), temperature, concentrations of A and B.
+/// @param t Time (s).
+/// @param y State vector.
+/// @param f Vector where the model equations should be stored.
+/// @param offset Position of the first state of the unit.
+/// @param params Pointer to a "DynHeater" struct.
+void DynHeaterModel(double t, const double *y, double *f, int offset, void *params);
+
+/// This subroutine is used to describe a jacketed CSTR carrying out the reversible reaction A <=> B. The equilibrium constant follows "VantHoffCalculation(...)". States: outlet flowrate (algebraic), temperature, concentrations of A and B, reaction rate (algebraic).
+/// @param t Time (s).
+/// @param y State vector.
+/// @param f Vector where the model equations should be stored.
+/// @param offset Position of the first state of the unit.
+/// @param params Pointer to a "DynReactor" struct.
+void DynReactorModel(double t, const double *y, double *f, int offset, void *params);
+
+#endif /* DynamicUnitsModels_h */
+
+#ifndef DynamicUnitsFlowsheet_h
+#define DynamicUnitsFlowsheet_h
+
+/// This subroutine is used to collect the fluid, feed, unit and integration data for a line of tank, heater and reactor trains.
+/// @param fluid Struct where the fluid properties should be stored.
+/// @param feed Struct where the feed and its step change should be stored.
+/// @param tank Struct where the tank design should be stored.
+/// @param heater Struct where the heater design should be stored.
+/// @param reactor Struct where the reactor design should be stored.
+/// @param h0 Initial tank level (m).
+/// @param ntrains Number of trains in series.
+/// @param opt Struct where the integration settings should be stored.
+void DynFlowsheetVariable(DynFluid *fluid, DynFeed *feed, DynTank *tank, DynHeater *heater, DynReactor *reactor, double *h0, int *ntrains, DynOptions *opt);
+
+/// This subroutine is used to register the trains with the integrator, together with the feed step and tank overflow events. Unit parameter arrays are allocated by this subroutine and must be freed by the caller.
+/// @param sys Flowsheet description.
+/// @param feed Feed and its step change.
+/// @param tank Tank design shared by every train.
+/// @param heater Heater design shared by every train.
+/// @param reactor Reactor design shared by every train.
+/// @param h0 Initial tank level (m).
+/// @param ntrains Number of trains in series.
+/// @param tanks Array where the tank parameters of each train should be stored.
+/// @param heaters Array where the heater parameters of each train should be stored.
+/// @param reactors Array where the reactor parameters of each train should be stored.
+void DynFlowsheetBuild(DynSystem *sys, DynFeed *feed, const DynTank *tank, const DynHeater *heater, const DynReactor *reactor, double h0, int ntrains, DynTank **tanks, DynHeater **heaters, DynReactor **reactors);
+
+#endif /* DynamicUnitsFlowsheet_h */
+
+#ifndef DynamicUnitsDisplay_h
+#define DynamicUnitsDisplay_h
+
+/// This subroutine is used to display the solver statistics, events and the outlet of the last unit.
+/// @param sys Flowsheet description.
+/// @param opt Integration settings.
+/// @param res Integration results.
+/// @param elapsed Wall-clock time of the integration (s).
+void DynFlowsheetDisplay(const DynSystem *sys, const DynOptions *opt, const DynResult *res, double elapsed);
+
+/// This subroutine is used to write every recorded state to a .txt file.
+/// @param sys Flowsheet description.
+/// @param opt Integration settings.
+/// @param res Integration results.
+/// @param elapsed Wall-clock time of the integration (s).
+void DynFlowsheetWrite(const DynSystem *sys, const DynOptions *opt, const DynResult *res, double elapsed);
+
+/// This subroutine is used to check if the user would like to write the results to a file.
+/// @param sys Flowsheet description.
+/// @param opt Integration settings.
+/// @param res Integration results.
+/// @param elapsed Wall-clock time of the integration (s).
+void DynFlowsheetWriteSwitch(const DynSystem *sys, const DynOptions *opt, const DynResult *res, double elapsed);
+
+#endif /* DynamicUnitsDisplay_h */
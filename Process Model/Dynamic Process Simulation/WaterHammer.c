@@ -0,0 +1,868 @@
+//
+//  WaterHammer.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+/// MARK: HEADER DECLARATIONS
+//Standard Header Files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//Custom Header Files
+#include "System.h"
+#include "ResultWriter.h"
+#include "Parallel.h"
+#include "03aFrictFactor.h"
+#include "DynamicSim.h"
+#include "WaterHammer.h"
+
+/// MARK: SUBROUTINE DEFINITIONS
+#define maxstrlen 128
+#define g 9.80665
+#define PI 3.14159265358979323846
+#define pointbatch 16384    // Grid points updated by each parallel task. Smaller grids are updated serially.
+#define maxrecords 2000     // Largest number of time levels recorded at each node.
+
+/// MARK: VARIABLE INPUT
+void SurgeVariable(SurgeSystem *sys)
+{
+    char input[maxstrlen];
+    char label[maxstrlen];
+    int control = 0;
+    
+    sys->rho = inputDouble(0, 0, "fluid density", "kg/m3");
+    
+    sys->mu = inputDouble(0, 0, "fluid viscosity", "cP");
+    sys->mu = (sys->mu)*0.001; // Conversion (cP to Pa.s)
+    
+    sys->Pvap = inputDouble(0, 0, "fluid vapour pressure", "kPa");
+    sys->Pvap = (sys->Pvap)*1000;
+    
+    sys->Hb = inputDouble(0, 0, "atmospheric pressure", "kPa");
+    sys->Hb = (sys->Hb)*1000/(sys->rho*g); // Conversion (kPa to m of fluid)
+    
+    //  Pipeline
+    sys->npipes = (int)inputDouble(0, 0, "number of pipes in series", "");
+    sys->pipe = calloc(sys->npipes, sizeof(SurgePipe));
+    sys->vessel = calloc(sys->npipes, sizeof(SurgeVessel));
+    for(int i = 0; i < sys->npipes; ++i)
+    {
+        SurgePipe *p = &sys->pipe[i];
+        
+        printf("Pipe %i.\n", i + 1);
+        p->L = inputDouble(0, 0, "pipe length", "m");
+        
+        p->d = inputDouble(0, 0, "internal pipe diameter", "mm");
+        p->d = (p->d)*0.001; // Conversion (mm to m)
+        
+        p->vareps = inputDouble(1, 0, "pipe absolute roughness", "mm");
+        p->vareps = (p->vareps)*0.001; // Conversion (mm to m)
+        
+        p->a = inputDouble(0, 0, "pressure wave speed", "m/s");
+        
+        if(i == 0)
+        {
+            p->z1 = inputDouble(1, 1, "elevation at the upstream end", "m");
+        }else{
+            p->z1 = sys->pipe[i - 1].z2;
+        }
+        p->z2 = inputDouble(1, 1, "elevation at the downstream end", "m");
+        
+        if(i > 0)
+        {
+            snprintf(label, sizeof(label), "Is there a surge vessel between pipes %i and %i? [Y/N] ", i, i + 1);
+            sys->vessel[i - 1].present = YesNo(label);
+            if(sys->vessel[i - 1].present == 1)
+            {
+                sys->vessel[i - 1].V0 = inputDouble(0, 0, "initial gas volume in the vessel", "m3");
+                sys->vessel[i - 1].n = inputDouble(0, 0, "polytropic index of the gas (1 = isothermal, 1.4 = adiabatic air)", "");
+            }
+        }
+    }
+    
+    //  Upstream boundary
+    control = 1;
+    while(control == 1)
+    {
+        printf("Upstream boundary: reservoir (1) or pump (2)? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+                sys->upstream = SurgeReservoir;
+                sys->Hup = inputDouble(1, 1, "upstream reservoir head", "m");
+                control = 0;
+                break;
+            case '2':
+                sys->upstream = SurgePump;
+                sys->Hup = inputDouble(1, 1, "suction reservoir head", "m");
+                sys->h0 = inputDouble(0, 0, "pump shut-off head", "m");
+                sys->r = inputDouble(1, 0, "pump curve coefficient, H = h0 - r Q^2", "s2/m5");
+                if(YesNo("Does the pump trip? [Y/N] ") == 1)
+                {
+                    sys->ttrip = inputDouble(1, 0, "time of the pump trip", "s");
+                    sys->tau = inputDouble(1, 0, "pump run-down time constant", "s");
+                }else{
+                    sys->ttrip = -1;
+                }
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+    
+    //  Downstream boundary
+    control = 1;
+    while(control == 1)
+    {
+        printf("Downstream boundary: reservoir (1), valve discharging to a reservoir (2) or dead end (3)? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+                sys->downstream = SurgeReservoir;
+                sys->Hdown = inputDouble(1, 1, "downstream reservoir head", "m");
+                control = 0;
+                break;
+            case '2':
+                sys->downstream = SurgeValve;
+                sys->Hdown = inputDouble(1, 1, "downstream reservoir head", "m");
+                sys->Q0 = inputDouble(0, 0, "initial steady flowrate", "m3/s");
+                if(YesNo("Does the valve close? [Y/N] ") == 1)
+                {
+                    sys->tclose = inputDouble(1, 0, "time that the valve starts to close", "s");
+                    sys->Tc = inputDouble(1, 0, "valve closure time", "s");
+                    sys->Em = inputDouble(0, 0, "valve closure exponent (1 = linear)", "");
+                }else{
+                    sys->tclose = INFINITY;
+                    sys->Em = 1;
+                }
+                control = 0;
+                break;
+            case '3':
+                sys->downstream = SurgeDeadEnd;
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+    
+    //  Simulation settings
+    sys->dt = inputDouble(0, 0, "time step", "s");
+    sys->tmax = inputDouble(0, 0, "simulation time", "s");
+}
+
+void SurgeSystemFree(SurgeSystem *sys)
+{
+    free(sys->pipe);
+    free(sys->vessel);
+    sys->pipe = NULL;
+    sys->vessel = NULL;
+}
+
+/// MARK: GENERAL CALCULATIONS
+/// This subroutine is used to calculate the head delivered to the upstream end of the pipeline at a given flowrate.
+static double SurgeUpstreamHead(const SurgeSystem *sys, double Q)
+{
+    if(sys->upstream == SurgePump)
+    {
+        return sys->Hup + sys->h0 - sys->r*Q*fabs(Q);
+    }
+    return sys->Hup;
+}
+
+/// This subroutine is used to calculate the steady friction factor and head loss in a pipe. A line at rest takes the friction factor at Re = 100,000.
+static double SurgePipeLoss(const SurgeSystem *sys, SurgePipe *p, double Q)
+{
+    double area = 0.0;
+    double u = 0.0;
+    double Re = 0.0;
+    double hf = 0.0;
+    
+    area = PI*pow(p->d, 2);
+    area = (area)/4;
+    u = Q/area;
+    
+    Re = sys->rho*fabs(u)*p->d/sys->mu;
+    p->phi = FrictFactorSolve((Re < 1) ? 1e5 : Re, p->vareps/p->d);
+    
+    //  h_f = 8 phi (L/d) u^2/(2g)
+    hf = u*fabs(u)/(2*g);
+    hf = 8*p->phi*(p->L/p->d)*(hf);
+    
+    return hf;
+}
+
+/// This subroutine is used to calculate the head remaining at the downstream end of the pipeline at a given flowrate.
+static double SurgeDownstreamHead(SurgeSystem *sys, double Q)
+{
+    double H = SurgeUpstreamHead(sys, Q);
+    
+    for(int i = 0; i < sys->npipes; ++i)
+    {
+        H -= SurgePipeLoss(sys, &sys->pipe[i], Q);
+    }
+    return H;
+}
+
+int SurgeSteadyState(SurgeSystem *sys)
+{
+    double lo = 0.0;
+    double hi = 1e-3;
+    double dH = 0.0;
+    
+    switch(sys->downstream)
+    {
+        case SurgeDeadEnd:
+            sys->Q0 = 0.0;
+            break;
+        case SurgeReservoir:
+            //  Bracketing and bisection on the steady energy balance
+            if(SurgeDownstreamHead(sys, 0.0) <= sys->Hdown)
+            {
+                return 1;
+            }
+            for(int i = 0; i < 60 && SurgeDownstreamHead(sys, hi) > sys->Hdown; ++i)
+            {
+                lo = hi;
+                hi = 2*(hi);
+            }
+            for(int i = 0; i < 100; ++i)
+            {
+                sys->Q0 = 0.5*(lo + hi);
+                if(SurgeDownstreamHead(sys, sys->Q0) > sys->Hdown)
+                {
+                    lo = sys->Q0;
+                }else{
+                    hi = sys->Q0;
+                }
+            }
+            break;
+        case SurgeValve:
+            dH = SurgeDownstreamHead(sys, sys->Q0) - sys->Hdown;
+            if(dH <= 0)
+            {
+                return 1;
+            }
+            sys->Cv = sys->Q0/sqrt(dH);
+            break;
+        default:
+            return 1;
+    }
+    
+    //  Friction factors are left at the initial steady flowrate.
+    SurgeDownstreamHead(sys, sys->Q0);
+    
+    return 0;
+}
+
+int SurgeGrid(SurgeSystem *sys)
+{
+    int npoints = 0;
+    
+    for(int i = 0; i < sys->npipes; ++i)
+    {
+        SurgePipe *p = &sys->pipe[i];
+        
+        p->N = (int)floor(p->L/(p->a*sys->dt) + 0.5);
+        if(p->N < 1)
+        {
+            p->N = 1;
+        }
+        p->a = p->L/(p->N*sys->dt);
+        npoints += p->N + 1;
+    }
+    
+    return npoints;
+}
+
+typedef struct SurgeContext{
+    const char *interior;   // Grid point lies inside a pipe (1) or at a pipe end (0).
+    const double *Ca;       // Characteristic impedance, gA/a, of the pipe holding each point (m2).
+    const double *R;        // Friction coefficient, f dt/(2 d A), of the pipe holding each point (1/m3).
+    const double *H;        // Head at the previous time level (m).
+    const double *Q;        // Flowrate at the previous time level (m3/s).
+    double *Hn;             // Head at the new time level (m).
+    double *Qn;             // Flowrate at the new time level (m3/s).
+    double *Hmax;
+    double *Hmin;
+} SurgeContext;
+
+/// This subroutine is used to update a contiguous block of interior grid points. Used as the kernel of "parallelFor(...)".
+static void SurgeInteriorBlock(int start, int end, void *context)
+{
+    SurgeContext *ctx = context;
+    
+    for(int k = start; k < end; ++k)
+    {
+        double Cp = 0.0;
+        double Cn = 0.0;
+        
+        if(ctx->interior[k] == 0)
+        {
+            continue;
+        }
+        
+        //  C+ from the point upstream and C- from the point downstream
+        Cp = ctx->Q[k - 1] + ctx->Ca[k]*ctx->H[k - 1] - ctx->R[k]*ctx->Q[k - 1]*fabs(ctx->Q[k - 1]);
+        Cn = ctx->Q[k + 1] - ctx->Ca[k]*ctx->H[k + 1] - ctx->R[k]*ctx->Q[k + 1]*fabs(ctx->Q[k + 1]);
+        
+        ctx->Hn[k] = (Cp - Cn)/(2*ctx->Ca[k]);
+        ctx->Qn[k] = 0.5*(Cp + Cn);
+        
+        ctx->Hmax[k] = (ctx->Hn[k] > ctx->Hmax[k]) ? ctx->Hn[k] : ctx->Hmax[k];
+        ctx->Hmin[k] = (ctx->Hn[k] < ctx->Hmin[k]) ? ctx->Hn[k] : ctx->Hmin[k];
+    }
+}
+
+/// This subroutine is used to solve the head at a junction holding a surge vessel. The gas follows (H - z + H_b) V^n = C with the gas volume integrated by the trapezium rule.
+static double SurgeVesselHead(SurgeVessel *v, double Cp, double Cn, double S, double z, double Hb, double dt)
+{
+    double Qs = v->Qs;
+    double H = 0.0;
+    double V = 0.0;
+    
+    for(int i = 0; i < 50; ++i)
+    {
+        double f = 0.0;
+        double df = 0.0;
+        double step = 0.0;
+        
+        H = (Cp - Cn - Qs)/S;
+        V = v->V - 0.5*dt*(v->Qs + Qs);
+        if(V < 1e-9*v->V0)
+        {
+            V = 1e-9*v->V0;
+        }
+        
+        f = (H - z + Hb)*pow(V, v->n) - v->C;
+        df = -pow(V, v->n)/S - 0.5*dt*(H - z + Hb)*v->n*pow(V, v->n - 1);
+        step = f/df;
+        Qs = Qs - step;
+        if(fabs(step) < 1e-12*(fabs(Qs) + 1e-9))
+        {
+            break;
+        }
+    }
+    
+    H = (Cp - Cn - Qs)/S;
+    v->V = v->V - 0.5*dt*(v->Qs + Qs);
+    v->Qs = Qs;
+    
+    return H;
+}
+
+int SurgeSimulate(SurgeSystem *sys, SurgeResult *res)
+{
+    int np = 0;
+    int nsteps = 0;
+    int every = 0;              // Time steps between records.
+    int *first = NULL;          // First grid point of each pipe.
+    char *interior = NULL;
+    double *Ca = NULL;
+    double *R = NULL;
+    double *H = NULL;
+    double *Q = NULL;
+    double *Hn = NULL;
+    double *Qn = NULL;
+    double *swap = NULL;
+    double Hnode = 0.0;
+    SurgeContext ctx;
+    
+    np = SurgeGrid(sys);
+    nsteps = (int)ceil(sys->tmax/sys->dt);
+    every = nsteps/maxrecords + 1;
+    
+    memset(res, 0, sizeof(SurgeResult));
+    res->npoints = np;
+    res->nnodes = sys->npipes + 1;
+    res->nrecords = nsteps/every + 1;
+    res->x = calloc(np, sizeof(double));
+    res->z = calloc(np, sizeof(double));
+    res->Hmax = calloc(np, sizeof(double));
+    res->Hmin = calloc(np, sizeof(double));
+    res->t = calloc(res->nrecords, sizeof(double));
+    res->Hnode = calloc((size_t)res->nnodes*res->nrecords, sizeof(double));
+    res->Qnode = calloc((size_t)res->nnodes*res->nrecords, sizeof(double));
+    
+    first = calloc(sys->npipes + 1, sizeof(int));
+    interior = calloc(np, sizeof(char));
+    Ca = calloc(np, sizeof(double));
+    R = calloc(np, sizeof(double));
+    H = calloc(np, sizeof(double));
+    Q = calloc(np, sizeof(double));
+    Hn = calloc(np, sizeof(double));
+    Qn = calloc(np, sizeof(double));
+    if(res->x == NULL || res->z == NULL || res->Hmax == NULL || res->Hmin == NULL || res->t == NULL || res->Hnode == NULL || res->Qnode == NULL || first == NULL || interior == NULL || Ca == NULL || R == NULL || H == NULL || Q == NULL || Hn == NULL || Qn == NULL)
+    {
+        printf("Memory could not be allocated for the simulation.\n");
+        free(first);
+        free(interior);
+        free(Ca);
+        free(R);
+        free(H);
+        free(Q);
+        free(Hn);
+        free(Qn);
+        SurgeResultFree(res);
+        return 1;
+    }
+    
+    //  Initial steady state and pipe constants
+    Hnode = SurgeUpstreamHead(sys, sys->Q0);
+    for(int i = 0, k = 0; i < sys->npipes; ++i)
+    {
+        SurgePipe *p = &sys->pipe[i];
+        double area = PI*p->d*p->d/4;
+        double hf = SurgePipeLoss(sys, p, sys->Q0);
+        double dx = p->L/p->N;
+        double x0 = (i == 0) ? 0.0 : res->x[k - 1];
+        
+        first[i] = k;
+        for(int j = 0; j <= p->N; ++j, ++k)
+        {
+            interior[k] = (j > 0 && j < p->N);
+            Ca[k] = g*area/p->a;
+            R[k] = 8*p->phi*sys->dt/(2*p->d*area);
+            res->x[k] = x0 + j*dx;
+            res->z[k] = p->z1 + (p->z2 - p->z1)*j/p->N;
+            H[k] = Hnode - hf*j/p->N;
+            Q[k] = sys->Q0;
+            res->Hmax[k] = H[k];
+            res->Hmin[k] = H[k];
+        }
+        Hnode -= hf;
+        
+        if(i > 0 && sys->vessel[i - 1].present == 1)
+        {
+            SurgeVessel *v = &sys->vessel[i - 1];
+            
+            v->V = v->V0;
+            v->Qs = 0.0;
+            v->C = (H[first[i]] - p->z1 + sys->Hb)*pow(v->V0, v->n);
+        }
+    }
+    first[sys->npipes] = np;
+    
+    ctx.interior = interior;
+    ctx.Ca = Ca;
+    ctx.R = R;
+    ctx.Hmax = res->Hmax;
+    ctx.Hmin = res->Hmin;
+    
+    for(int s = 0; s <= nsteps; ++s)
+    {
+        double t = s*sys->dt;
+        
+        //  Recording node histories
+        if(s % every == 0)
+        {
+            int r = s/every;
+            
+            res->t[r] = t;
+            for(int i = 0; i <= sys->npipes; ++i)
+            {
+                int k = (i < sys->npipes) ? first[i] : np - 1;
+                
+                res->Hnode[i*res->nrecords + r] = H[k];
+                res->Qnode[i*res->nrecords + r] = Q[k];
+            }
+        }
+        if(s == nsteps)
+        {
+            break;
+        }
+        t = t + sys->dt;
+        
+        //  Interior points
+        ctx.H = H;
+        ctx.Q = Q;
+        ctx.Hn = Hn;
+        ctx.Qn = Qn;
+        parallelFor(np, pointbatch, SurgeInteriorBlock, &ctx);
+        
+        //  Upstream boundary
+        {
+            double Cn = Q[1] - Ca[0]*H[1] - R[0]*Q[1]*fabs(Q[1]);
+            
+            if(sys->upstream == SurgePump)
+            {
+                double alpha = 1.0;     // Pump speed ratio.
+                double B = 0.0;
+                
+                if(sys->ttrip >= 0 && t > sys->ttrip)
+                {
+                    alpha = (sys->tau > 0) ? 1/(1 + (t - sys->ttrip)/sys->tau) : 0.0;
+                }
+                
+                //  Q = Cn + Ca H with H = H_s + alpha^2 h0 - r Q^2, check valve closed when Q would reverse
+                B = Cn + Ca[0]*(sys->Hup + alpha*alpha*sys->h0);
+                if(B <= 0)
+                {
+                    Qn[0] = 0.0;
+                }else if(sys->r > 0){
+                    Qn[0] = (-1 + sqrt(1 + 4*Ca[0]*sys->r*B))/(2*Ca[0]*sys->r);
+                }else{
+                    Qn[0] = B;
+                }
+                Hn[0] = (Qn[0] - Cn)/Ca[0];
+            }else{
+                Hn[0] = sys->Hup;
+                Qn[0] = Cn + Ca[0]*Hn[0];
+            }
+        }
+        
+        //  Junctions between pipes
+        for(int i = 1; i < sys->npipes; ++i)
+        {
+            int e = first[i] - 1;   // Last point of the upstream pipe.
+            int f = first[i];       // First point of the downstream pipe.
+            double Cp = Q[e - 1] + Ca[e]*H[e - 1] - R[e]*Q[e - 1]*fabs(Q[e - 1]);
+            double Cn = Q[f + 1] - Ca[f]*H[f + 1] - R[f]*Q[f + 1]*fabs(Q[f + 1]);
+            double Hj = 0.0;
+            
+            if(sys->vessel[i - 1].present == 1)
+            {
+                Hj = SurgeVesselHead(&sys->vessel[i - 1], Cp, Cn, Ca[e] + Ca[f], res->z[f], sys->Hb, sys->dt);
+            }else{
+                Hj = (Cp - Cn)/(Ca[e] + Ca[f]);
+            }
+            Hn[e] = Hj;
+            Hn[f] = Hj;
+            Qn[e] = Cp - Ca[e]*Hj;
+            Qn[f] = Cn + Ca[f]*Hj;
+        }
+        
+        //  Downstream boundary
+        {
+            int e = np - 1;
+            double Cp = Q[e - 1] + Ca[e]*H[e - 1] - R[e]*Q[e - 1]*fabs(Q[e - 1]);
+            
+            if(sys->downstream == SurgeReservoir)
+            {
+                Hn[e] = sys->Hdown;
+                Qn[e] = Cp - Ca[e]*Hn[e];
+            }else if(sys->downstream == SurgeValve){
+                double tv = 1.0;    // Relative valve opening.
+                double k = 0.0;
+                
+                if(t >= sys->tclose)
+                {
+                    tv = (sys->Tc > 0 && t < sys->tclose + sys->Tc) ? pow(1 - (t - sys->tclose)/sys->Tc, sys->Em) : 0.0;
+                }
+                k = pow(sys->Cv*tv, 2);
+                if(k > 0)
+                {
+                    //  Q = Cv tau sqrt(H - H_d) combined with the C+ characteristic
+                    double a2 = Ca[e]/k;
+                    double B = Cp - Ca[e]*sys->Hdown;
+                    
+                    if(B >= 0)
+                    {
+                        Qn[e] = (-1 + sqrt(1 + 4*a2*B))/(2*a2);
+                    }else{
+                        Qn[e] = (1 - sqrt(1 - 4*a2*B))/(2*a2);
+                    }
+                }else{
+                    Qn[e] = 0.0;
+                }
+                Hn[e] = (Cp - Qn[e])/Ca[e];
+            }else{
+                Qn[e] = 0.0;
+                Hn[e] = Cp/Ca[e];
+            }
+        }
+        
+        //  Envelope at pipe ends
+        for(int i = 0; i <= sys->npipes; ++i)
+        {
+            int k = (i < sys->npipes) ? first[i] : np - 1;
+            
+            for(int m = (i > 0 && i < sys->npipes) ? k - 1 : k; m <= k; ++m)
+            {
+                res->Hmax[m] = (Hn[m] > res->Hmax[m]) ? Hn[m] : res->Hmax[m];
+                res->Hmin[m] = (Hn[m] < res->Hmin[m]) ? Hn[m] : res->Hmin[m];
+            }
+        }
+        
+        swap = H;
+        H = Hn;
+        Hn = swap;
+        swap = Q;
+        Q = Qn;
+        Qn = swap;
+    }
+    
+    free(first);
+    free(interior);
+    free(Ca);
+    free(R);
+    free(H);
+    free(Q);
+    free(Hn);
+    free(Qn);
+    
+    return 0;
+}
+
+void SurgeResultFree(SurgeResult *res)
+{
+    free(res->x);
+    free(res->z);
+    free(res->Hmax);
+    free(res->Hmin);
+    free(res->t);
+    free(res->Hnode);
+    free(res->Qnode);
+    memset(res, 0, sizeof(SurgeResult));
+}
+
+/// MARK: DISPLAY AND WRITE
+/// This subroutine is used to find the grid point at each pipe end.
+static int SurgeNodePoint(const SurgeSystem *sys, const SurgeResult *res, int node)
+{
+    int k = 0;
+    
+    if(node == sys->npipes)
+    {
+        return res->npoints - 1;
+    }
+    for(int i = 0; i < node; ++i)
+    {
+        k += sys->pipe[i].N + 1;
+    }
+    return k;
+}
+
+void SurgeDisplay(const SurgeSystem *sys, const SurgeResult *res)
+{
+    int cavitation = 0;
+    double area = 0.0;
+    double dH = 0.0;
+    
+    printf("_Water_Hammer_Results_\n");
+    printf("Fluid density:\n");
+    printf("rho =\t%.3f\tkg/m3\n", sys->rho);
+    printf("Initial steady flowrate:\n");
+    printf("Q0 =\t%.5f\tm3/s\n", sys->Q0);
+    printf("Time step:\n");
+    printf("dt =\t%.5f\ts\n", sys->dt);
+    printf("Number of grid points:\n");
+    printf("n =\t%i\n\n", res->npoints);
+    
+    printf("\tPipes:\n");
+    printf("Pipe\tL (m)\td (mm)\ta (m/s)\tReaches\tphi ([ ])\n");
+    for(int i = 0; i < sys->npipes; ++i)
+    {
+        const SurgePipe *p = &sys->pipe[i];
+        
+        printf("%i\t%.3f\t%.3f\t%.3f\t%i\t%.5f\n", i + 1, p->L, p->d*1000, p->a, p->N, p->phi);
+    }
+    printf("\n");
+    
+    printf("\tNodes:\n");
+    printf("Node\tx (m)\tz (m)\tH0 (m)\tHmax (m)\tHmin (m)\tPmax (kPa)\tPmin (kPa)\n");
+    for(int i = 0; i < res->nnodes; ++i)
+    {
+        int k = SurgeNodePoint(sys, res, i);
+        double Pmax = sys->rho*g*(res->Hmax[k] - res->z[k]);
+        double Pmin = sys->rho*g*(res->Hmin[k] - res->z[k]);
+        
+        printf("%i\t%.3f\t%.3f\t%.3f\t%.3f\t%.3f\t%.3f\t%.3f\n", i + 1, res->x[k], res->z[k], res->Hnode[i*res->nrecords], res->Hmax[k], res->Hmin[k], Pmax*0.001, Pmin*0.001);
+    }
+    printf("\n");
+    
+    //  Joukowsky estimate for an instantaneous stop of the initial flow in the last pipe
+    area = PI*pow(sys->pipe[sys->npipes - 1].d, 2)/4;
+    dH = sys->pipe[sys->npipes - 1].a*(sys->Q0/area)/g;
+    printf("Joukowsky head rise for an instantaneous stop:\n");
+    printf("dH =\t%.3f\tm\n\n", dH);
+    
+    for(int k = 0; k < res->npoints; ++k)
+    {
+        //  Pressures are gauge, so the vapour pressure is compared against absolute pressure.
+        if(sys->rho*g*(res->Hmin[k] - res->z[k] + sys->Hb) < sys->Pvap)
+        {
+            ++cavitation;
+        }
+    }
+    if(cavitation > 0)
+    {
+        printf("Warning: the pressure falls below the vapour pressure at %i grid points. Column separation is not modelled so results after this point are not physical.\n\n", cavitation);
+    }
+}
+
+void SurgeWrite(const SurgeSystem *sys, const SurgeResult *res)
+{
+    //  Function variables
+    ResultWriter w;             // Buffered writer for the results file.
+    
+    //  Set file name as timestamp + Water Hammer Results
+    if(!writerOpen(&w, "Water Hammer Results"))
+    {
+        return;
+    }
+    
+    //  Write to file
+    writerPrintf(&w, "_Water_Hammer_Results_\n");
+    writerPrintf(&w, "Fluid density:\n");
+    writerPrintf(&w, "rho =\t%.3f\tkg/m3\n", sys->rho);
+    writerPrintf(&w, "Initial steady flowrate:\n");
+    writerPrintf(&w, "Q0 =\t%.5f\tm3/s\n", sys->Q0);
+    writerPrintf(&w, "Time step:\n");
+    writerPrintf(&w, "dt =\t%.5f\ts\n\n", sys->dt);
+    
+    writerPrintf(&w, "\tPipes:\n");
+    writerPrintf(&w, "Pipe\tL (m)\td (mm)\ta (m/s)\tReaches\tphi ([ ])\n");
+    for(int i = 0; i < sys->npipes; ++i)
+    {
+        const SurgePipe *p = &sys->pipe[i];
+        
+        writerPrintf(&w, "%i\t%.3f\t%.3f\t%.3f\t%i\t%.5f\n", i + 1, p->L, p->d*1000, p->a, p->N, p->phi);
+    }
+    writerPrintf(&w, "\n");
+    
+    writerPrintf(&w, "\tHead envelope:\n");
+    writerPrintf(&w, "x (m)\tz (m)\tHmax (m)\tHmin (m)\tPmax (kPa)\tPmin (kPa)\n");
+    for(int k = 0; k < res->npoints; ++k)
+    {
+        writerPrintf(&w, "%.3f\t%.3f\t%.3f\t%.3f\t%.3f\t%.3f\n", res->x[k], res->z[k], res->Hmax[k], res->Hmin[k], sys->rho*g*(res->Hmax[k] - res->z[k])*0.001, sys->rho*g*(res->Hmin[k] - res->z[k])*0.001);
+    }
+    writerPrintf(&w, "\n");
+    
+    writerPrintf(&w, "\tNode histories:\n");
+    writerPrintf(&w, "t (s)");
+    for(int i = 0; i < res->nnodes; ++i)
+    {
+        writerPrintf(&w, "\tH%i (m)\tQ%i (m3/s)", i + 1, i + 1);
+    }
+    writerPrintf(&w, "\n");
+    for(int r = 0; r < res->nrecords; ++r)
+    {
+        writerPrintf(&w, "%.5f", res->t[r]);
+        for(int i = 0; i < res->nnodes; ++i)
+        {
+            writerPrintf(&w, "\t%.3f\t%.6f", res->Hnode[i*res->nrecords + r], res->Qnode[i*res->nrecords + r]);
+        }
+        writerPrintf(&w, "\n");
+    }
+    
+    //  Close file
+    writerClose(&w);
+}
+
+void SurgeWriteSwitch(const SurgeSystem *sys, const SurgeResult *res)
+{
+    int control = 0;
+    
+    control = 1;
+    while(control == 1)
+    {
+        char input[maxstrlen];
+        
+        printf("Do you want to save results to file? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+            case 'T':
+            case 'Y':
+            case 't':
+            case 'y':
+                SurgeWrite(sys, res);
+                control = 0;
+                break;
+            case '0':
+            case 'F':
+            case 'N':
+            case 'f':
+            case 'n':
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+}
+
+/// MARK: PSEUDO-MAIN FUNCTION
+void WaterHammer(void)
+{
+    int whilmain = 0;
+    printf("Water Hammer (Method of Characteristics)\n");
+    
+    whilmain = 1;
+    while(whilmain == 1)
+    {
+        //  Variable declaration
+        SurgeSystem sys;
+        SurgeResult res;
+        int control = 0;
+            //  Variables for timing function
+        struct timespec start, end;
+        double elapsed = 0.0;
+        
+        memset(&sys, 0, sizeof(SurgeSystem));
+        memset(&res, 0, sizeof(SurgeResult));
+        
+        //  Data Collection
+        SurgeVariable(&sys);
+        
+        if(SurgeSteadyState(&sys) == 0)
+        {
+            //  Data Manipulation
+            clock_getres(CLOCK_MONOTONIC, &start);
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            
+            control = SurgeSimulate(&sys, &res);
+            
+            clock_getres(CLOCK_MONOTONIC, &end);
+            clock_gettime(CLOCK_MONOTONIC, &end);
+
+            elapsed = timer(start, end);
+
+            printf("Calculations completed in %.6f seconds.\n", elapsed);
+            
+            if(control == 0)
+            {
+                //  Displaying results
+                SurgeDisplay(&sys, &res);
+                
+                //  Writing to File
+                SurgeWriteSwitch(&sys, &res);
+                
+                SurgeResultFree(&res);
+            }
+        }else{
+            printf("No steady forward flow exists for this pipeline. Check the reservoir heads and the initial flowrate.\n");
+        }
+        
+        //  Continue function
+        whilmain = Continue(whilmain);
+        SurgeSystemFree(&sys);
+    }
+    fflush(stdout);
+}
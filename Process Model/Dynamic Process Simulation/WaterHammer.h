@@ -0,0 +1,142 @@
+//
+//  WaterHammer.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef WaterHammerStruct_h
+#define WaterHammerStruct_h
+
+#define SurgeReservoir 1    // Boundary held at a fixed head.
+#define SurgePump 2         // Upstream pump, with check valve, drawing from a suction reservoir.
+#define SurgeValve 3        // Downstream valve discharging to a reservoir.
+#define SurgeDeadEnd 4      // Downstream closed end.
+
+typedef struct SurgePipe{
+    double L;           // Pipe length (m).
+    double d;           // Internal pipe diameter (m).
+    double vareps;      // Pipe absolute roughness (m).
+    double a;           // Pressure wave speed (m/s). Adjusted slightly so that the pipe holds a whole number of reaches.
+    double z1;          // Elevation at the upstream end (m).
+    double z2;          // Elevation at the downstream end (m).
+    int N;              // Number of reaches.
+    double phi;         // Steady-state friction factor ([ ]).
+} SurgePipe;
+
+typedef struct SurgeVessel{
+    int present;        // Vessel installed at the junction (1) or not (0).
+    double V0;          // Initial gas volume (m3).
+    double n;           // Polytropic index of the gas ([ ]).
+    double C;           // Gas constant, (H - z + H_b) V^n.
+    double V;           // Gas volume (m3).
+    double Qs;          // Flowrate into the vessel (m3/s).
+} SurgeVessel;
+
+typedef struct SurgeSystem{
+    double rho;             // Fluid density (kg/m3).
+    double mu;              // Fluid viscosity (Pa.s).
+    double Pvap;            // Fluid vapour pressure (Pa).
+    double Hb;              // Barometric head (m).
+    int npipes;             // Number of pipes in series.
+    SurgePipe *pipe;        // Array of pipes.
+    SurgeVessel *vessel;    // Surge vessel at each junction between pipes (npipes - 1).
+    int upstream;           // Upstream boundary (SurgeReservoir or SurgePump).
+    double Hup;             // Upstream or suction reservoir head (m).
+    double h0;              // Pump shut-off head at full speed (m).
+    double r;               // Pump curve coefficient, H = h0 - r Q^2 (s2/m5).
+    double ttrip;           // Time of the pump trip (s). Negative values keep the pump running.
+    double tau;             // Pump run-down time constant (s).
+    int downstream;         // Downstream boundary (SurgeReservoir, SurgeValve or SurgeDeadEnd).
+    double Hdown;           // Downstream reservoir head (m).
+    double tclose;          // Time that the valve starts to close (s).
+    double Tc;              // Valve closure time (s).
+    double Em;              // Valve closure exponent ([ ]).
+    double Cv;              // Valve discharge coefficient when open, Q = Cv sqrt(dH) (m2.5/s).
+    double Q0;              // Initial steady flowrate (m3/s).
+    double dt;              // Time step (s).
+    double tmax;            // Simulation time (s).
+} SurgeSystem;
+
+typedef struct SurgeResult{
+    int npoints;        // Number of grid points.
+    int nnodes;         // Number of pipe ends (npipes + 1).
+    int nrecords;       // Number of recorded time levels.
+    double *x;          // Distance of each grid point from the upstream end (m).
+    double *z;          // Elevation of each grid point (m).
+    double *Hmax;       // Largest head reached at each grid point (m).
+    double *Hmin;       // Smallest head reached at each grid point (m).
+    double *t;          // Time of each record (s).
+    double *Hnode;      // Head at each node and record, stored node-major (nnodes x nrecords) (m).
+    double *Qnode;      // Flowrate at each node and record (m3/s).
+} SurgeResult;
+
+#endif /* WaterHammerStruct_h */
+
+#ifndef WaterHammerVariable_h
+#define WaterHammerVariable_h
+
+/// This subroutine is used to collect the pipeline, boundary conditions and simulation settings. Arrays are allocated by this subroutine and released by "SurgeSystemFree(...)".
+/// @param sys Struct where the pipeline description should be entered.
+void SurgeVariable(SurgeSystem *sys);
+
+/// This subroutine is used to release the arrays allocated for a pipeline.
+/// @param sys Pipeline description.
+void SurgeSystemFree(SurgeSystem *sys);
+
+#endif /* WaterHammerVariable_h */
+
+#ifndef WaterHammerCalc_h
+#define WaterHammerCalc_h
+
+/// This subroutine is used to calculate the initial steady flow through the pipeline using "FrictFactorSolve(...)". The flowrate is solved for when the line ends in a reservoir, otherwise the given flowrate is used and the valve coefficient is found. This function returns 0 on success or 1 if no steady state exists.
+/// @param sys Pipeline description.
+int SurgeSteadyState(SurgeSystem *sys);
+
+/// This subroutine is used to discretise each pipe into reaches of length a dt. The wave speed in each pipe is adjusted so that a whole number of reaches fits the pipe length. This function returns the total number of grid points.
+/// @param sys Pipeline description.
+int SurgeGrid(SurgeSystem *sys);
+
+/// This subroutine is used to simulate the transient by the method of characteristics. Interior points are updated in parallel and boundary points are solved afterwards each time step. This function returns 0 on success, or 1 if the arrays could not be allocated.
+/// @param sys Pipeline description. "SurgeSteadyState(...)" and "SurgeGrid(...)" must be called first.
+/// @param res Struct where the head envelope and node histories should be entered. Arrays are allocated by this subroutine and released by "SurgeResultFree(...)".
+int SurgeSimulate(SurgeSystem *sys, SurgeResult *res);
+
+/// This subroutine is used to release the arrays allocated for the simulation results.
+/// @param res Simulation results.
+void SurgeResultFree(SurgeResult *res);
+
+#endif /* WaterHammerCalc_h */
+
+#ifndef WaterHammerDisplay_h
+#define WaterHammerDisplay_h
+
+/// This subroutine is used to display a summary of the transient at each node.
+/// @param sys Pipeline description.
+/// @param res Simulation results.
+void SurgeDisplay(const SurgeSystem *sys, const SurgeResult *res);
+
+/// This subroutine is used to write the head envelope and node histories to a .txt file.
+/// @param sys Pipeline description.
+/// @param res Simulation results.
+void SurgeWrite(const SurgeSystem *sys, const SurgeResult *res);
+
+/// This subroutine is used to check if the user would like to write the simulation results to a file.
+/// @param sys Pipeline description.
+/// @param res Simulation results.
+void SurgeWriteSwitch(const SurgeSystem *sys, const SurgeResult *res);
+
+#endif /* WaterHammerDisplay_h */
@@ -29,6 +29,7 @@
 
 //Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "01PureComponent.h"
 #include "01aAcentricFactor.h"
 
@@ -200,93 +201,50 @@ void AcFactorDisplay(int mode, double Pc, double Tc, double TBoil, double ANTA,
 void AcFactorWrite(int mode, double Pc, double Tc, double TBoil, double ANTA, double ANTB, double ANTC, double omegaANT, double omegaCRI, double omegaLK)
 {
     //  Function variables
-    char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
     //  Set file name as timestamp + Acentric Factor Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Acentric Factor Results");
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-    *filepath = (char)malloc(sizeof *filepath);
-    
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-    printf("File path: \"%s\"\n", filepath);
-    
-    strcat(filepath, filename);
-    void free(void *filename); // Removing 'filename' from the heap
-    
-    printf("File name: \"%s\"\n", filename);
-    printf("Full file path: \"%s\"\n\n", filepath);
-    
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    if(!writerOpen(&w, "Acentric Factor Results"))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
-    fprintf(fp, "_Acentric_Factor_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
+    writerPrintf(&w, "_Acentric_Factor_Results_\n");
+    writerPrintf(&w, "\tInput parameters:\n");
     if(mode == 1 || mode == 4)
     {
-        fprintf(fp, "Antoine Equation Constants:\n");
-        fprintf(fp, "ANTA =\t%.5f\tmmHg\n", ANTA);
-        fprintf(fp, "ANTB =\t%.2f\tmmHg.K\n", ANTB);
-        fprintf(fp, "ANTC =\t%.3f\tK\n\n", ANTC);
+        writerPrintf(&w, "Antoine Equation Constants:\n");
+        writerPrintf(&w, "ANTA =\t%.5f\tmmHg\n", ANTA);
+        writerPrintf(&w, "ANTB =\t%.2f\tmmHg.K\n", ANTB);
+        writerPrintf(&w, "ANTC =\t%.3f\tK\n\n", ANTC);
     }
     
-    fprintf(fp, "Critical pressure:\n");
-    fprintf(fp, "Pc =\t%.3f\tbar\n", Pc);
-    fprintf(fp, "Critical temperature:\n");
-    fprintf(fp, "Tc =\t%.3f\tK\n", Tc);
+    writerPrintf(&w, "Critical pressure:\n");
+    writerPrintf(&w, "Pc =\t%.3f\tbar\n", Pc);
+    writerPrintf(&w, "Critical temperature:\n");
+    writerPrintf(&w, "Tc =\t%.3f\tK\n", Tc);
     if(mode == 2 || mode == 3 || mode == 4)
     {
-        fprintf(fp, "Normal boiling point:\n");
-        fprintf(fp, "Tboil =\t%.3f\tdeg C\n", TBoil - 273.15);
+        writerPrintf(&w, "Normal boiling point:\n");
+        writerPrintf(&w, "Tboil =\t%.3f\tdeg C\n", TBoil - 273.15);
     }
     
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "Acentric Factor:\n");
+    writerPrintf(&w, "\tOutput parameters:\n");
+    writerPrintf(&w, "Acentric Factor:\n");
     
     if(mode == 1 || mode == 4){
-        fprintf(fp, "omegaANT =\t%.4f\t[ ]\n", omegaANT);
+        writerPrintf(&w, "omegaANT =\t%.4f\t[ ]\n", omegaANT);
     }
     if(mode == 2 || mode == 4){
-        fprintf(fp, "omegaCRI =\t%.4f\t[ ]\n", omegaCRI);
+        writerPrintf(&w, "omegaCRI =\t%.4f\t[ ]\n", omegaCRI);
     }
     if(mode == 3 || mode == 4){
-        fprintf(fp, "omegaLK =\t%.4f\t[ ]\n", omegaLK);
+        writerPrintf(&w, "omegaLK =\t%.4f\t[ ]\n", omegaLK);
     }
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void AcFactorSwitch(int mode1, int mode2, double Pc, double Tc, double TBoil, double ANTA, double ANTB, double ANTC, double omegaANT, double omegaCRI, double omegaLK)
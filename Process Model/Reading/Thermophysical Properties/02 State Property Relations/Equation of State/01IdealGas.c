@@ -29,6 +29,7 @@
 
 //  Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "02PVTRelations.h"
 #include "EquationofState.h"
 #include "01IdealGas.h"
@@ -102,74 +103,42 @@ void IdealEOSWrite(double T, EOSIsotherm data)
 {
     //  Function variables
     char filename[maxstrlen];   // Variable used to store the file name as it is built.
-    char filetemp[maxstrlen];
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
+    ResultWriter w;             // Buffered writer for the results file.
     
-    FILE *fp;                   // Pointer to the file location.
-    //  Set file name as timestamp + Ideal Gas EOS T ... K Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Ideal Gas EOS");
-    //printf("File name: \"%s\"\n", filename);
+    WriterColumn cols[3] = {
+        {"P", "bar", NULL, 1, WriterFixed, 3, 1.0, 0.0},
+        {"V_m", "cm3/mol", NULL, 1, WriterFixed, 3, 1.0, 0.0},
+        {"Z", "[ ]", NULL, 1, WriterFixed, 3, 1.0, 0.0}
+    };
     
-    sprintf(filetemp, " T %.0f K", T);
-    strcat(filename, filetemp);
-    
-    strcat(filename," Results.txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-
-    strcat(filepath, filename);
-
-    printf("Full file path: \"%s\"\n\n", filepath);
-
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    //  Set file name as timestamp + Ideal Gas EOS T ... K Results
+    snprintf(filename, sizeof(filename), "Ideal Gas EOS T %.0f K Results", T);
+    if(!writerOpen(&w, filename))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
-    fprintf(fp, "_Ideal_Gas_Equation_of_State_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Isotherm produced at:\n");
-    fprintf(fp, "T =\t%.3f\tK\n\n", T);
+    writerText(&w, "_Ideal_Gas_Equation_of_State_Results_\n");
+    writerText(&w, "\tInput parameters:\n");
+    writerText(&w, "Isotherm produced at:\n");
+    writerValue(&w, "T =", T, 3, "K");
+    writerEnd(&w);
     
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "P (bar)\tV_m (cm3/mol)\tZ ([ ])\n");
+    writerText(&w, "\tOutput parameters:\n");
+    writerHeader(&w, 3, cols);
     for(int i = 0; i < 1000; ++i)
     {
-        fprintf(fp, "%.3f\t", data.P[i]);
-        fprintf(fp, "%.3f\t", data.V[i]);
-        //fprintf(fp, "%.3f\t", data.T[i]);
-        fprintf(fp, "%.3f\n", ( (data.P[i])*(data.V[i]) )/( R*(data.T[i]) ));
+        writerNumber(&w, data.P[i], WriterFixed, 3);
+        writerSep(&w);
+        writerNumber(&w, data.V[i], WriterFixed, 3);
+        writerSep(&w);
+        writerNumber(&w, ( (data.P[i])*(data.V[i]) )/( R*(data.T[i]) ), WriterFixed, 3);
+        writerEnd(&w);
     }
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void IdealEOSSwitch(int mode, double T, EOSIsotherm data)
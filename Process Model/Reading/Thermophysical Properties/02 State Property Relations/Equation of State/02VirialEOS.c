@@ -29,6 +29,7 @@
 
 //  Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 #include "02PVTRelations.h"
 #include "EquationofState.h"
 #include "02Compressibility.h"
@@ -526,193 +527,110 @@ void VirialEOSCompDisplay(int polar, double Pc, double Tc, double Vc, double T,
     fflush(stdout);
 }
 
-void VirialEOSWrite(int polar, double Pc, double Tc, double Vc, double T, double omega, double a, double b, EOSIsotherm data, double B, double C)
+/// This subroutine is used to write the input and intermediate parameters shared by "VirialEOSWrite(...)" and "VirialEOSCompWrite(...)".
+/// @param w Writer from "writerOpen(...)".
+/// @param vclabel Description of the critical molar volume.
+/// @param polar Set to 1 if the polar constants "a" and "b" were used.
+/// @param Pc Critical pressure (bar).
+/// @param Tc Critical temperature (K).
+/// @param Vc Critical molar volume (cm3/mol)
+/// @param T Temperature at which the isotherm was calculated at (K).
+/// @param omega Accentric factor.
+/// @param a Constant used for calculating B^(2).
+/// @param b Constant used for calculating B^(2).
+/// @param B Second virial coefficient (cm3/mol).
+/// @param C Third virial coefficient (cm6/mol2).
+static void VirialEOSWriteParameters(ResultWriter *w, const char *vclabel, int polar, double Pc, double Tc, double Vc, double T, double omega, double a, double b, double B, double C)
 {
-    //Function variables
-    char filename[maxstrlen] = {""};   // Variable used to store the file name as it is built.
-    char filetemp[maxstrlen] = {""};
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
-    
-    FILE *fp;                   // Pointer to the file location.
-    //Set file name as timestamp + Virial EOS T ... K Results
-        //Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //Creating file name with base format "YYYYmmDD HHMMSS "
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Virial EOS");
-    //printf("File name: \"%s\"\n", filename);
-    
-    sprintf(filetemp, " T %.0f K", T);
-    strcat(filename, filetemp);
-    
-    strcat(filename," Results.txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-    
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-    
-    strcat(filepath, filename);
-     
-    printf("Full file path: \"%s\"\n\n", filepath);
-    
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
-    }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //Open file
-    fp = fopen(filename, "w+");
-    
-    //Write to file
-    fprintf(fp, "_Virial_Equation_of_State_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Critical pressure:\n");
-    fprintf(fp, "Pc =\t%.3f\tbar\n", Pc);
-    fprintf(fp, "Critical temperature:\n");
-    fprintf(fp, "Tc =\t%.3f\tK\n", Tc);
-    fprintf(fp, "Critical molar volume:\n");
-    fprintf(fp, "Vc =\t%.3f\tcm3/mol\n", Vc);
-    fprintf(fp, "Acentric factor:\n");
-    fprintf(fp, "omega =\t%.3f\t[ ]\n\n", omega);
+    writerText(w, "_Virial_Equation_of_State_Results_\n");
+    writerText(w, "\tInput parameters:\n");
+    writerText(w, "Critical pressure:\n");
+    writerValue(w, "Pc =", Pc, 3, "bar");
+    writerText(w, "Critical temperature:\n");
+    writerValue(w, "Tc =", Tc, 3, "K");
+    writerText(w, vclabel);
+    writerValue(w, "Vc =", Vc, 3, "cm3/mol");
+    writerText(w, "Acentric factor:\n");
+    writerValue(w, "omega =", omega, 3, "[ ]");
+    writerEnd(w);
     
     if(polar == 1)
     {
-        fprintf(fp, "a =\t%.3f\t[ ]\n", a);
-        fprintf(fp, "b =\t%.3f\t[ ]\n\n", b);
+        writerValue(w, "a =", a, 3, "[ ]");
+        writerValue(w, "b =", b, 3, "[ ]");
+        writerEnd(w);
     }
     
-    fprintf(fp, "\tIntermediate parameters:\n");
-    fprintf(fp, "Second virial coefficient:\n");
-    fprintf(fp, "B =\t%.3f\tcm3/mol\n", B);
-    fprintf(fp, "Third virial coefficient:\n");
-    fprintf(fp, "C =\t%.3f\tcm6/mol2\n\n", C);
+    writerText(w, "\tIntermediate parameters:\n");
+    writerText(w, "Second virial coefficient:\n");
+    writerValue(w, "B =", B, 3, "cm3/mol");
+    writerText(w, "Third virial coefficient:\n");
+    writerValue(w, "C =", C, 3, "cm6/mol2");
+    writerEnd(w);
+    
+    writerText(w, "\tOutput parameters:\n");
+    writerText(w, "Isotherm produced at:\n");
+    writerValue(w, "T =", T, 3, "K");
+    writerEnd(w);
+}
+
+void VirialEOSWrite(int polar, double Pc, double Tc, double Vc, double T, double omega, double a, double b, EOSIsotherm data, double B, double C)
+{
+    char filename[maxstrlen];   // Variable used to store the file name as it is built.
+    ResultWriter w;             // Buffered writer for the results file.
+    
+    WriterColumn cols[3] = {
+        {"P", "bar", NULL, 1, WriterFixed, 3, 1.0, 0.0},
+        {"V_m", "cm3/mol", NULL, 1, WriterFixed, 3, 1.0, 0.0},
+        {"Z", "[ ]", NULL, 1, WriterFixed, 3, 1.0, 0.0}
+    };
+    
+    //  Set file name as timestamp + Virial EOS T ... K Results
+    snprintf(filename, sizeof(filename), "Virial EOS T %.0f K Results", T);
+    if(!writerOpen(&w, filename))
+    {
+        return;
+    }
     
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "Isotherm produced at:\n");
-    fprintf(fp, "T =\t%.3f\tK\n\n", T);
+    //  Write to file
+    VirialEOSWriteParameters(&w, "Critical molar volume:\n", polar, Pc, Tc, Vc, T, omega, a, b, B, C);
     
-    fprintf(fp, "P (bar)\tV_m (cm3/mol)\tZ ([ ])\n");
+    writerHeader(&w, 3, cols);
     for(int i = 0; i < 1000; ++i)
     {
-        fprintf(fp, "%.3f\t", data.P[i]);
-        fprintf(fp, "%.3f\t", data.V[i]);
-        //fprintf(fp, "%.3f\t", data.T[i]);
-        fprintf(fp, "%.3f\n", ( (data.P[i])*(data.V[i]) )/( R*(data.T[i]) ));
+        writerNumber(&w, data.P[i], WriterFixed, 3);
+        writerSep(&w);
+        writerNumber(&w, data.V[i], WriterFixed, 3);
+        writerSep(&w);
+        writerNumber(&w, ( (data.P[i])*(data.V[i]) )/( R*(data.T[i]) ), WriterFixed, 3);
+        writerEnd(&w);
     }
     
-    //Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void VirialEOSCompWrite(int polar, double Pc, double Tc, double Vc, double T, double omega, double a, double b, ZFactor data, double B, double C)
 {
-    //  Function variables
-    char filename[maxstrlen] = {""};   // Variable used to store the file name as it is built.
-    char filetemp[maxstrlen] = {""};
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
-    
-    FILE *fp;                   // Pointer to the file location.
-    //  Set file name as timestamp + Virial EOS (Z) T ... K Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    strcat(filename, " Virial EOS (Z)");
-    //printf("File name: \"%s\"\n", filename);
-    
-    sprintf(filetemp, " T %.0f K", T);
-    strcat(filename, filetemp);
-    
-    strcat(filename," Results.txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-    
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-    
-    strcat(filepath, filename);
-     
-    printf("Full file path: \"%s\"\n\n", filepath);
-    
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
-    }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
+    char filename[maxstrlen];   // Variable used to store the file name as it is built.
+    ResultWriter w;             // Buffered writer for the results file.
     
-    printf("Beginning file write...\n");
+    WriterColumn cols[2] = {
+        {"P", "bar", data.P, 1, WriterFixed, 3, 1.0, 0.0},
+        {"Z", "[ ]", data.Z, 1, WriterFixed, 3, 1.0, 0.0}
+    };
     
-    //  Open file
-    fp = fopen(filename, "w+");
-    
-    //  Write to file
-    fprintf(fp, "_Virial_Equation_of_State_Results_\n");
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Critical pressure:\n");
-    fprintf(fp, "Pc =\t%.3f\tbar\n", Pc);
-    fprintf(fp, "Critical temperature:\n");
-    fprintf(fp, "Tc =\t%.3f\tK\n", Tc);
-    fprintf(fp, "Critical molar volume (Not used):\n");
-    fprintf(fp, "Vc =\t%.3f\tcm3/mol\n", Vc);
-    fprintf(fp, "Acentric factor:\n");
-    fprintf(fp, "omega =\t%.3f\t[ ]\n\n", omega);
-    
-    if(polar == 1)
+    //  Set file name as timestamp + Virial EOS (Z) T ... K Results
+    snprintf(filename, sizeof(filename), "Virial EOS (Z) T %.0f K Results", T);
+    if(!writerOpen(&w, filename))
     {
-        fprintf(fp, "a =\t%.3f\t[ ]\n", a);
-        fprintf(fp, "b =\t%.3f\t[ ]\n\n", b);
+        return;
     }
     
-    fprintf(fp, "\tIntermediate parameters:\n");
-    fprintf(fp, "Second virial coefficient:\n");
-    fprintf(fp, "B =\t%.3f\tcm3/mol\n", B);
-    fprintf(fp, "Third virial coefficient:\n");
-    fprintf(fp, "C =\t%.3f\tcm6/mol2\n\n", C);
-    
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "Isotherm produced at:\n");
-    fprintf(fp, "T =\t%.3f\tK\n\n", T);
-    
-    fprintf(fp, "P (bar)\tZ ([ ])\n");
-    for(int i = 0; i < 2501; ++i)
-    {
-        fprintf(fp, "%.3f\t", data.P[i]);
-        //fprintf(fp, "%.3f\t", data.T[i]);
-        fprintf(fp, "%.3f\n", data.Z[i]);
-    }
+    //  Write to file
+    VirialEOSWriteParameters(&w, "Critical molar volume (Not used):\n", polar, Pc, Tc, Vc, T, omega, a, b, B, C);
+    writerTable(&w, 2, cols, 2501);
     
-    //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void VirialEOSSwitch(int mode1, int mode2, int polar, double Pc, double Tc, double Vc, double T, double omega, double a, double b, EOSIsotherm dataV, ZFactor dataZ, double B, double C)
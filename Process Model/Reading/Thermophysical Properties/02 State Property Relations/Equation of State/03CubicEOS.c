@@ -29,6 +29,7 @@
 
 //  Custom Header Files
 #include "System.h"
+#include "ResultWriter.h"
 //#include "EquationofState.h"  // This header is included in "03CubicEOS.h"
 #include "02PVTRelations.h"
 #include "03CubicEOS.h"
@@ -169,116 +170,56 @@ void CubicEOSDisplay(int eqn, double Pc, double Tc, double omega, double T, doub
 void CubicEOSWrite(int eqn, double Pc, double Tc, double omega, double T, double a, double b, EOSIsotherm Isotherm)
 {
     //  Function variables
-    char filename[maxstrlen] = {""};   // Variable used to store the file name as it is built.
-    char filetemp[maxstrlen] = {""};
-    //char filepath[maxstrlen*(2)];
-    //char driveloc[maxstrlen];
-    
-    FILE *fp;                   // Pointer to the file location.
-    //  Set file name as timestamp + "..." EOS (Z) T ... K Results
-        //  Get current time
-    time_t rawtime;
-    struct tm *info;
-    time(&rawtime);
-    info = localtime(&rawtime);
-    
-        //  Creating file name
-    strftime(filename, 15, "%Y%m%d %H%M%S", info);
-    //printf("File name: \"%s\"\n", filename);
-    
-    if(eqn == 1){
-        strcat(filename, " van der Waals EOS");
-    }
-    if(eqn == 2){
-        strcat(filename, " Redlich Kwong EOS");
-    }
-    if(eqn == 3){
-        strcat(filename, " Soave Redlich Kwong EOS");
-    }
-    if(eqn == 4){
-        strcat(filename, " Peng Robinson EOS");
+    const char *model[5] = {"", "van der Waals", "Redlich Kwong", "Soave Redlich Kwong", "Peng Robinson"};
+    const char *title[5] = {"", "_van_der_Waals_EOS_Results_\n", "_Redlich-Kwong_EOS_Results_\n", "_Soave-Redlich-Kwong_EOS_Results_\n", "_Peng-Robinson_EOS_Results_\n"};
+    char filename[maxstrlen];   // Variable used to store the file name as it is built.
+    ResultWriter w;             // Buffered writer for the results file.
+    
+    WriterColumn cols[3] = {
+        {"P", "bar", Isotherm.P, 1, WriterFixed, 6, 1.0, 0.0},
+        {"v", "cm3/mol", Isotherm.V, 1, WriterFixed, 6, 1.0, 0.0},
+        {"Z", "[ ]", Isotherm.Z, 1, WriterFixed, 6, 1.0, 0.0}
+    };
+    
+    if(eqn < 1 || eqn > 4)
+    {
+        return;
     }
-    //printf("File name: \"%s\"\n", filename);
-    
-    sprintf(filetemp, " T %.0f K", T);
-    strcat(filename, filetemp);
-    
-    strcat(filename,".txt");
-    printf("File name: \"%s\"\n", filename);
-    /*
-    //driveloc is not suitable when determining the file path for mac
-    *filepath = (char)malloc(sizeof *filepath);
     
-    //printf("Save file to: /Users/user/Documents/ ");
-    strcpy(filepath, "/Users/user/Documents/ModelFiles/");
-    printf("File path: \"%s\"\n", filepath);
-    
-    strcat(filepath, filename);
-    void free(void *filename); // Removing 'filename' from the heap
-    
-    printf("File name: \"%s\"\n", filename);
-    printf("Full file path: \"%s\"\n\n", filepath);
-    
-    //Testing if directory is not present
-    if(fopen(filepath, "r") == NULL){
-        printf("Directory does not exist, writing data to \"Documents\" folder instead.\n");
-        strcpy(filepath, "/Users/user/Documents/");
-        printf("File is now being outputted to: %s\n", filepath);
+    //  Set file name as timestamp + "..." EOS (Z) T ... K Results
+    snprintf(filename, sizeof(filename), "%s EOS T %.0f K", model[eqn], T);
+    if(!writerOpen(&w, filename))
+    {
+        return;
     }
-    */
-    printf("Note that write sequence may be disabled by zsh\n");
-    
-    printf("Beginning file write...\n");
-    
-    //  Open file
-    fp = fopen(filename, "w+");
     
     //  Write to file
-    if(eqn == 1){
-        fprintf(fp, "_van_der_Waals_EOS_Results_\n");
-    }
-    if(eqn == 2){
-        fprintf(fp, "_Redlich-Kwong_EOS_Results_\n");
-    }
-    if(eqn == 3){
-        fprintf(fp, "_Soave-Redlich-Kwong_EOS_Results_\n");
-    }
-    if(eqn == 4){
-        fprintf(fp, "_Peng-Robinson_EOS_Results_\n");
-    }
-    fprintf(fp, "\tInput parameters:\n");
-    fprintf(fp, "Critical pressure:\n");
-    fprintf(fp, "Pc =\t%.3f\tbar\n", Pc);
-    fprintf(fp, "Critical temperature:\n");
-    fprintf(fp, "Tc =\t%.3f\tK\n", Tc);
-    fprintf(fp, "Acentric factor:\n");
-    fprintf(fp, "omega =\t%.3f\t[ ]\n\n", omega);
-    
-    fprintf(fp, "Isotherm temperature:\n");
-    fprintf(fp, "T =\t%.3f\tK\n\n", T);
-    
-    fprintf(fp, "\tIntermediate parameters:\n");
-    fprintf(fp, "Volume repulsivity:\n");
-    fprintf(fp, "a =\t%.3f\tbar.cm6/mol2\n", a);
-    fprintf(fp, "Real molecular volume:\n");
-    fprintf(fp, "b =\t%.3f\tcm3/mol\n\n", b);
-    
-    fprintf(fp, "\tOutput parameters:\n");
-    fprintf(fp, "P (bar)\tv (cm3/mol)\t\tZ([ ])\n");
-    for(int i = 0; i < 1000; ++i)
-    {
-        fprintf(fp, "%f\t", Isotherm.P[i]);
-        fprintf(fp, "%f\t", Isotherm.V[i]);
-        //fprintf(fp, "%f\t", Isotherm.T[i]);
-        //fprintf(fp, "%f\t", Isotherm.T[i] - 273.15);
-        fprintf(fp, "\t");
-        fprintf(fp, "%f\n", Isotherm.Z[i]);
-    }
+    writerText(&w, title[eqn]);
+    writerText(&w, "\tInput parameters:\n");
+    writerText(&w, "Critical pressure:\n");
+    writerValue(&w, "Pc =", Pc, 3, "bar");
+    writerText(&w, "Critical temperature:\n");
+    writerValue(&w, "Tc =", Tc, 3, "K");
+    writerText(&w, "Acentric factor:\n");
+    writerValue(&w, "omega =", omega, 3, "[ ]");
+    writerEnd(&w);
+    
+    writerText(&w, "Isotherm temperature:\n");
+    writerValue(&w, "T =", T, 3, "K");
+    writerEnd(&w);
+    
+    writerText(&w, "\tIntermediate parameters:\n");
+    writerText(&w, "Volume repulsivity:\n");
+    writerValue(&w, "a =", a, 3, "bar.cm6/mol2");
+    writerText(&w, "Real molecular volume:\n");
+    writerValue(&w, "b =", b, 3, "cm3/mol");
+    writerEnd(&w);
+    
+    writerText(&w, "\tOutput parameters:\n");
+    writerTable(&w, 3, cols, 1000);
     
     //  Close file
-    fclose(fp);
-     
-    printf("Write Complete\n");
+    writerClose(&w);
 }
 
 void CubicEOSSwitch(int mode, int eqn, double Pc, double Tc, double omega, double T, double VdWa, double VdWb, double RKa, double RKb, double SRKa, double SRKb, double PRa, double PRb, EOSIsotherm VdWIsotherm, EOSIsotherm RKIsotherm, EOSIsotherm SRKIsotherm, EOSIsotherm PRIsotherm)
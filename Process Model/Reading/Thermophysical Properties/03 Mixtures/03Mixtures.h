@@ -0,0 +1,35 @@
+//
+//  03Mixtures.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef _3Mixtures_h
+#define _3Mixtures_h
+
+/// This subroutine is a menu function which informs the user of the available enclosed subroutines.
+void mixtures(void);
+
+#endif /* _3Mixtures_h */
+
+#ifndef MixtureEOS_h
+#define MixtureEOS_h
+
+/// This subroutine is used to guide the user through calculating the volumetric properties and fugacity coefficients of a mixture with a cubic equation of state.
+void MixtureEOS(void);
+
+#endif /* MixtureEOS_h */
@@ -0,0 +1,720 @@
+//
+//  03aMixingRules.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+/// MARK: HEADER DECLARATIONS
+//  Standard header files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//  Custom header files
+#include "System.h"
+#include "ResultWriter.h"
+#include "03CubicEOS.h"
+#include "03Mixtures.h"
+#include "03aMixingRules.h"
+
+/// MARK: SUBROUTINE DEFINITIONS
+#define maxstrlen 128
+#define R 8.3145            // J/(mol.K)
+
+/// MARK: VARIABLE INPUT
+void MixRuleVariable(MixRule *mix)
+{
+    char input[maxstrlen];
+    char prompt[maxstrlen];
+    int n = mix->ncomp;
+    int control = 0;
+    
+    control = 1;
+    while(control == 1)
+    {
+        printf("Mixing rule: van der Waals one-fluid (1) or Wong-Sandler (2)? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+                mix->rule = MixVdW;
+                control = 0;
+                break;
+            case '2':
+                mix->rule = MixWongSandler;
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+    
+    control = 1;
+    while(control == 1)
+    {
+        printf("Do you want to enter binary interaction parameters? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+            case 'T':
+            case 'Y':
+            case 't':
+            case 'y':
+                for(int i = 0; i < n; ++i)
+                {
+                    for(int j = i + 1; j < n; ++j)
+                    {
+                        snprintf(prompt, sizeof(prompt), "k(%s, %s)", mix->name[i], mix->name[j]);
+                        MixSetInteraction(mix, i, j, inputDouble(1, 1, prompt, "[ ]"));
+                    }
+                }
+                control = 0;
+                break;
+            case '0':
+            case 'F':
+            case 'N':
+            case 'f':
+            case 'n':
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+    
+    if(mix->rule == MixWongSandler)
+    {
+        for(int i = 0; i < n; ++i)
+        {
+            for(int j = 0; j < n; ++j)
+            {
+                if(i == j)
+                {
+                    continue;
+                }
+                snprintf(prompt, sizeof(prompt), "NRTL parameter tau(%s, %s) x T", mix->name[i], mix->name[j]);
+                mix->tau[i*n + j] = inputDouble(1, 1, prompt, "K");
+            }
+        }
+        for(int i = 0; i < n; ++i)
+        {
+            for(int j = i + 1; j < n; ++j)
+            {
+                snprintf(prompt, sizeof(prompt), "NRTL non-randomness alpha(%s, %s)", mix->name[i], mix->name[j]);
+                mix->alpha[i*n + j] = inputDouble(1, 0, prompt, "[ ]");
+                mix->alpha[j*n + i] = mix->alpha[i*n + j];
+            }
+        }
+    }
+}
+
+/// This subroutine is used to collect the equation of state, component data, state and composition for "MixtureEOS(...)".
+static void MixtureEOSVariable(MixRule *mix, double *T, double *P, double *x)
+{
+    char input[maxstrlen];
+    char prompt[maxstrlen];
+    double sum = 0.0;
+    int eos = 0;
+    int n = 0;
+    int control = 0;
+    
+    control = 1;
+    while(control == 1)
+    {
+        printf("Equation of state: Soave-Redlich-Kwong (1) or Peng-Robinson (2)? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+                eos = MixSRK;
+                control = 0;
+                break;
+            case '2':
+                eos = MixPR;
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+    
+    n = (int)inputDouble(0, 0, "number of components", "");
+    n = (n > MixMaxComp) ? MixMaxComp : n;
+    MixRuleInit(mix, n, eos, MixVdW);
+    for(int i = 0; i < n; ++i)
+    {
+        printf("Component %i name: ", i + 1);
+        fgets(input, sizeof(input), stdin);
+        input[strcspn(input, "\r\n")] = '\0';
+        snprintf(mix->name[i], MixNameLength, "%.*s", MixNameLength - 1, input);
+        
+        mix->Tc[i] = inputDouble(0, 0, "critical temperature", "K");
+        mix->Pc[i] = inputDouble(0, 0, "critical pressure", "bar");
+        mix->Pc[i] = (mix->Pc[i])*100000; // Conversion (bar to Pa)
+        mix->omega[i] = inputDouble(1, 1, "acentric factor", "[ ]");
+    }
+    MixRuleVariable(mix);
+    
+    *T = inputDouble(1, 1, "temperature", "deg C");
+    *T = (*T) + 273.15;
+    *P = inputDouble(0, 0, "pressure", "bar");
+    *P = (*P)*100000; // Conversion (bar to Pa)
+    for(int i = 0; i < n; ++i)
+    {
+        snprintf(prompt, sizeof(prompt), "mole fraction of %s", mix->name[i]);
+        x[i] = inputDouble(1, 0, prompt, "[ ]");
+        sum += x[i];
+    }
+    if(sum <= 0.0)
+    {
+        printf("The mole fractions sum to zero. An equimolar mixture is used instead.\n");
+        for(int i = 0; i < n; ++i)
+        {
+            x[i] = 1.0;
+        }
+        sum = n;
+    }
+    for(int i = 0; i < n; ++i)
+    {
+        x[i] = x[i]/sum;
+    }
+}
+
+/// MARK: GENERAL CALCULATIONS
+void MixRuleInit(MixRule *mix, int ncomp, int eos, int rule)
+{
+    memset(mix, 0, sizeof(MixRule));
+    mix->ncomp = ncomp;
+    mix->eos = eos;
+    mix->rule = rule;
+}
+
+int MixPackedIndex(int n, int i, int j)
+{
+    int k = 0;
+    
+    if(i > j)
+    {
+        k = i;
+        i = j;
+        j = k;
+    }
+    
+    return i*n - i*(i - 1)/2 + (j - i);
+}
+
+void MixSetInteraction(MixRule *mix, int i, int j, double kij)
+{
+    mix->kij[MixPackedIndex(mix->ncomp, i, j)] = kij;
+}
+
+void MixStateReset(MixState *st)
+{
+    st->T = -1.0;
+    st->ready = 0;
+}
+
+void MixRuleTemperature(const MixRule *mix, MixState *st, double T)
+{
+    int n = mix->ncomp;
+    double Omegaa = (mix->eos == MixSRK) ? 0.42748 : 0.45724;
+    double Omegab = (mix->eos == MixSRK) ? 0.08664 : 0.07780;
+    double sqa[MixMaxComp];
+    double dsqa[MixMaxComp];
+    int k = 0;
+    
+    if(st->T == T)
+    {
+        return;
+    }
+    st->T = T;
+    
+    //  Temperature independent parts, calculated once per mixture description.
+    if(st->ready == 0)
+    {
+        for(int i = 0; i < n; ++i)
+        {
+            st->kappa[i] = (mix->eos == MixSRK) ? SRKcalculateAcFunc(mix->omega[i]) : PRcalculateAcFunc(mix->omega[i]);
+            st->sqac[i] = sqrt(Omegaa)*R*mix->Tc[i]/sqrt(mix->Pc[i]);
+            st->b[i] = Omegab*R*mix->Tc[i]/mix->Pc[i];
+        }
+        st->ready = 1;
+    }
+    
+    //  Pure component parameters, a_i = a_c,i [1 + kappa_i (1 - sqrt(T/Tc,i))]^2.
+    for(int i = 0; i < n; ++i)
+    {
+        double sqTr = sqrt(T/mix->Tc[i]);
+        
+        sqa[i] = st->sqac[i]*(1 + st->kappa[i]*(1 - sqTr));
+        dsqa[i] = -st->sqac[i]*st->kappa[i]*sqTr/(2.0*T);
+        st->a[i] = sqa[i]*sqa[i];
+        st->dadT[i] = 2.0*sqa[i]*dsqa[i];
+    }
+    
+    //  Packed cross parameters, row by row along the upper triangle.
+    for(int i = 0; i < n; ++i)
+    {
+        for(int j = i; j < n; ++j)
+        {
+            double f = 1.0 - mix->kij[k];
+            
+            if(mix->rule == MixVdW)
+            {
+                st->A[k] = f*sqa[i]*sqa[j];
+                st->dA[k] = f*(dsqa[i]*sqa[j] + sqa[i]*dsqa[j]);
+            }else{
+                st->A[k] = f*(0.5*(st->b[i] + st->b[j]) - 0.5*(st->a[i] + st->a[j])/(R*T));
+                st->dA[k] = -f*0.5*((st->dadT[i] + st->dadT[j])/T - (st->a[i] + st->a[j])/(T*T))/R;
+            }
+            ++k;
+        }
+    }
+    
+    if(mix->rule == MixWongSandler)
+    {
+        for(int i = 0; i < n*n; ++i)
+        {
+            st->tauT[i] = mix->tau[i]/T;
+            st->G[i] = exp(-mix->alpha[i]*st->tauT[i]);
+        }
+    }
+}
+
+/// This subroutine is used to evaluate the symmetric double sum over the packed matrix M. The row sums s_i = sum_j M_ij x_j are stored and the double sum sum_i x_i s_i is returned.
+static double MixPackedSum(int n, const double *M, const double *x, double *s)
+{
+    double sum = 0.0;
+    int k = 0;
+    
+    for(int i = 0; i < n; ++i)
+    {
+        s[i] = 0.0;
+    }
+    for(int i = 0; i < n; ++i)
+    {
+        double xi = x[i];
+        double si = M[k]*xi;
+        
+        ++k;
+        for(int j = i + 1; j < n; ++j)
+        {
+            si += M[k]*x[j];
+            s[j] += M[k]*xi;
+            ++k;
+        }
+        s[i] += si;
+    }
+    for(int i = 0; i < n; ++i)
+    {
+        sum += x[i]*s[i];
+    }
+    
+    return sum;
+}
+
+/// This subroutine is used to calculate the NRTL excess Gibbs energy gE/RT, its temperature derivative and the activity coefficients of the Wong-Sandler mixing rule.
+static double MixNRTL(const MixRule *mix, const MixState *st, double T, const double *x, double *lngamma, double *dgdT)
+{
+    int n = mix->ncomp;
+    double theta[MixMaxComp];
+    double phi[MixMaxComp];
+    double dtheta[MixMaxComp];
+    double dphi[MixMaxComp];
+    double g = 0.0;
+    
+    *dgdT = 0.0;
+    for(int i = 0; i < n; ++i)
+    {
+        theta[i] = 0.0;
+        phi[i] = 0.0;
+        dtheta[i] = 0.0;
+        dphi[i] = 0.0;
+        for(int j = 0; j < n; ++j)
+        {
+            double tau = st->tauT[j*n + i];
+            double G = st->G[j*n + i];
+            double dtau = -tau/T;
+            double dG = mix->alpha[j*n + i]*tau*G/T;
+            
+            theta[i] += x[j]*tau*G;
+            phi[i] += x[j]*G;
+            dtheta[i] += x[j]*(dtau*G + tau*dG);
+            dphi[i] += x[j]*dG;
+        }
+        g += x[i]*theta[i]/phi[i];
+        *dgdT += x[i]*(dtheta[i]/phi[i] - theta[i]*dphi[i]/(phi[i]*phi[i]));
+    }
+    for(int i = 0; i < n; ++i)
+    {
+        lngamma[i] = theta[i]/phi[i];
+        for(int j = 0; j < n; ++j)
+        {
+            lngamma[i] += x[j]*st->G[i*n + j]/phi[j]*(st->tauT[i*n + j] - theta[j]/phi[j]);
+        }
+    }
+    
+    return g;
+}
+
+void MixRuleEvaluate(const MixRule *mix, MixState *st, double T, const double *x)
+{
+    int n = mix->ncomp;
+    double s[MixMaxComp];
+    double ds[MixMaxComp];
+    
+    MixRuleTemperature(mix, st, T);
+    if(mix->rule == MixVdW)
+    {
+        //  am = sum_i sum_j x_i x_j (1 - k_ij) sqrt(a_i a_j), bm = sum_i x_i b_i
+        st->am = MixPackedSum(n, st->A, x, s);
+        st->damdT = MixPackedSum(n, st->dA, x, ds);
+        st->bm = 0.0;
+        st->dbmdT = 0.0;
+        for(int i = 0; i < n; ++i)
+        {
+            st->abar[i] = 2.0*s[i];
+            st->bbar[i] = st->b[i];
+            st->bm += x[i]*st->b[i];
+        }
+    }else{
+        //  bm = Q/(1 - D) and am = RT bm D, where Q = sum_i sum_j x_i x_j [b - a/RT]_ij and D = sum_i x_i a_i/(b_i RT) + gE/(C RT).
+        double C = (mix->eos == MixSRK) ? -log(2.0) : log(sqrt(2.0) - 1)/sqrt(2.0);
+        double lngamma[MixMaxComp];
+        double Q = 0.0;
+        double dQ = 0.0;
+        double D = 0.0;
+        double dD = 0.0;
+        double g = 0.0;
+        double dg = 0.0;
+        
+        Q = MixPackedSum(n, st->A, x, s);
+        dQ = MixPackedSum(n, st->dA, x, ds);
+        g = MixNRTL(mix, st, T, x, lngamma, &dg);
+        D = g/C;
+        dD = dg/C;
+        for(int i = 0; i < n; ++i)
+        {
+            D += x[i]*st->a[i]/(st->b[i]*R*T);
+            dD += x[i]*(st->dadT[i]/T - st->a[i]/(T*T))/(st->b[i]*R);
+        }
+        st->bm = Q/(1 - D);
+        st->am = R*T*st->bm*D;
+        st->dbmdT = dQ/(1 - D) + Q*dD/((1 - D)*(1 - D));
+        st->damdT = R*st->bm*D + R*T*(st->dbmdT*D + st->bm*dD);
+        for(int i = 0; i < n; ++i)
+        {
+            double Di = st->a[i]/(st->b[i]*R*T) + lngamma[i]/C;
+            
+            st->bbar[i] = 2.0*s[i]/(1 - D) - Q*(1 - Di)/((1 - D)*(1 - D));
+            st->abar[i] = R*T*(D*st->bbar[i] + st->bm*Di);
+        }
+    }
+}
+
+/// This subroutine is used to find the real roots of Z^3 + c2 Z^2 + c1 Z + c0 = 0. The number of roots found is returned.
+static int MixCubicRoots(double c2, double c1, double c0, double *root)
+{
+    double p = 0.0;
+    double q = 0.0;
+    double disc = 0.0;
+    double r = 0.0;
+    double phi = 0.0;
+    int n = 0;
+    
+    p = c1 - c2*c2/3.0;
+    q = 2.0*c2*c2*c2/27.0 - c2*c1/3.0 + c0;
+    disc = q*q/4.0 + p*p*p/27.0;
+    if(disc >= 0.0 || p >= 0.0)
+    {
+        r = sqrt(fmax(disc, 0.0));
+        root[0] = cbrt(-q/2.0 + r) + cbrt(-q/2.0 - r) - c2/3.0;
+        n = 1;
+    }else{
+        r = 2.0*sqrt(-p/3.0);
+        phi = 3.0*q/(p*r);
+        phi = acos(fmax(-1.0, fmin(1.0, phi)))/3.0;
+        for(int k = 0; k < 3; ++k)
+        {
+            root[k] = r*cos(phi - 2.0*M_PI*k/3.0) - c2/3.0;
+        }
+        n = 3;
+    }
+    
+    //  Polishing the roots by Newton's method.
+    for(int k = 0; k < n; ++k)
+    {
+        for(int it = 0; it < 2; ++it)
+        {
+            double f = ((root[k] + c2)*root[k] + c1)*root[k] + c0;
+            double df = (3.0*root[k] + 2.0*c2)*root[k] + c1;
+            
+            if(df != 0.0)
+            {
+                root[k] -= f/df;
+            }
+        }
+    }
+    
+    return n;
+}
+
+double MixCubicPhase(const MixRule *mix, MixState *st, double T, double P, const double *x, int root, double *lnphi, double *hres, double *sres)
+{
+    double d1 = (mix->eos == MixSRK) ? 1.0 : 1.0 + sqrt(2.0);
+    double d2 = (mix->eos == MixSRK) ? 0.0 : 1.0 - sqrt(2.0);
+    double A = 0.0;
+    double B = 0.0;
+    double Zr[3];
+    double Z = 0.0;
+    double L = 0.0;
+    double dS = 0.0;
+    int n = 0;
+    
+    MixRuleEvaluate(mix, st, T, x);
+    A = st->am*P/(R*R*T*T);
+    B = st->bm*P/(R*T);
+    n = MixCubicRoots((d1 + d2 - 1)*B - 1, d1*d2*B*B - (d1 + d2)*B*(1 + B) + A, -(d1*d2*B*B*(1 + B) + A*B), Zr);
+    
+    //  Only roots with a positive free volume are physical.
+    Z = -1.0;
+    for(int k = 0; k < n; ++k)
+    {
+        if(Zr[k] <= B)
+        {
+            continue;
+        }
+        if(Z < 0.0)
+        {
+            Z = Zr[k];
+        }else if(root == MixLiquidRoot){
+            Z = fmin(Z, Zr[k]);
+        }else if(root == MixVapourRoot){
+            Z = fmax(Z, Zr[k]);
+        }else{
+            double g1 = Z - 1 - log(Z - B) - A/(B*(d1 - d2))*log((Z + d1*B)/(Z + d2*B));
+            double g2 = Zr[k] - 1 - log(Zr[k] - B) - A/(B*(d1 - d2))*log((Zr[k] + d1*B)/(Zr[k] + d2*B));
+            
+            Z = (g2 < g1) ? Zr[k] : Z;
+        }
+    }
+    if(Z < 0.0)
+    {
+        Z = B*(1 + 1e-10);
+    }
+    
+    L = log((Z + d1*B)/(Z + d2*B))/(d1 - d2);
+    if(lnphi != NULL)
+    {
+        for(int i = 0; i < mix->ncomp; ++i)
+        {
+            lnphi[i] = st->bbar[i]/st->bm*(Z - 1) - log(Z - B) - A/B*(st->abar[i]/st->am - st->bbar[i]/st->bm)*L;
+        }
+    }
+    
+    //  Entropy terms arising from a temperature dependent co-volume (Wong-Sandler).
+    if(st->dbmdT != 0.0)
+    {
+        dS = st->dbmdT*(-P/(Z - B) - st->am/(st->bm*st->bm)*L + st->am/st->bm*P/(R*T)*Z/((Z + d1*B)*(Z + d2*B)));
+    }
+    if(hres != NULL)
+    {
+        *hres = R*T*(Z - 1) + (T*st->damdT - st->am)/st->bm*L + T*dS;
+    }
+    if(sres != NULL)
+    {
+        *sres = R*log(Z - B) + st->damdT/st->bm*L + dS;
+    }
+    
+    return Z;
+}
+
+/// MARK: DISPLAY AND WRITE
+static void MixtureEOSPrint(ResultWriter *w, const MixRule *mix, MixState *st, double T, double P, const double *x)
+{
+    const char *eos[2] = {"Soave-Redlich-Kwong", "Peng-Robinson"};
+    const char *rule[2] = {"van der Waals one-fluid", "Wong-Sandler (NRTL)"};
+    double lnphiL[MixMaxComp];
+    double lnphiV[MixMaxComp];
+    double ZL = 0.0;
+    double ZV = 0.0;
+    double Zs = 0.0;
+    double hL = 0.0;
+    double hV = 0.0;
+    double sL = 0.0;
+    double sV = 0.0;
+    
+    ZL = MixCubicPhase(mix, st, T, P, x, MixLiquidRoot, lnphiL, &hL, &sL);
+    ZV = MixCubicPhase(mix, st, T, P, x, MixVapourRoot, lnphiV, &hV, &sV);
+    Zs = MixCubicPhase(mix, st, T, P, x, MixStableRoot, NULL, NULL, NULL);
+    
+    writerPrintf(w, "_Mixture_Equation_of_State_Results_\n");
+    writerPrintf(w, "Equation of state:\n");
+    writerPrintf(w, "%s\n", eos[mix->eos]);
+    writerPrintf(w, "Mixing rule:\n");
+    writerPrintf(w, "%s\n\n", rule[mix->rule]);
+    
+    writerPrintf(w, "\tInput parameters:\n");
+    writerPrintf(w, "Temperature:\n");
+    writerPrintf(w, "T =\t%.3f\tdeg C\n", T - 273.15);
+    writerPrintf(w, "Pressure:\n");
+    writerPrintf(w, "P =\t%.5g\tbar\n\n", P*0.00001);
+    
+    writerPrintf(w, "\tOutput parameters:\n");
+    writerPrintf(w, "Mixture attraction parameter:\n");
+    writerPrintf(w, "a =\t%.6g\tPa.m6/mol2\n", st->am);
+    writerPrintf(w, "Temperature derivative:\n");
+    writerPrintf(w, "da/dT =\t%.6g\tPa.m6/mol2.K\n", st->damdT);
+    writerPrintf(w, "Mixture co-volume:\n");
+    writerPrintf(w, "b =\t%.6g\tcm3/mol\n", st->bm*1e6);
+    writerPrintf(w, "Liquid root:\n");
+    writerPrintf(w, "Z =\t%.6f\t[ ]\n", ZL);
+    writerPrintf(w, "V =\t%.5g\tcm3/mol\n", ZL*R*T/P*1e6);
+    writerPrintf(w, "Hres =\t%.4f\tkJ/mol\n", hL*0.001);
+    writerPrintf(w, "Sres =\t%.4f\tJ/mol.K\n", sL);
+    writerPrintf(w, "Vapour root:\n");
+    writerPrintf(w, "Z =\t%.6f\t[ ]\n", ZV);
+    writerPrintf(w, "V =\t%.5g\tcm3/mol\n", ZV*R*T/P*1e6);
+    writerPrintf(w, "Hres =\t%.4f\tkJ/mol\n", hV*0.001);
+    writerPrintf(w, "Sres =\t%.4f\tJ/mol.K\n", sV);
+    writerPrintf(w, "Stable root:\n");
+    writerPrintf(w, "%s\n\n", (ZL == ZV) ? "Single root" : ((Zs == ZL) ? "Liquid" : "Vapour"));
+    
+    writerPrintf(w, "Component\tx (-)\tabar (Pa.m6/mol2)\tbbar (cm3/mol)\tphi L (-)\tphi V (-)\n");
+    for(int i = 0; i < mix->ncomp; ++i)
+    {
+        writerPrintf(w, "%s\t%.6f\t%.6g\t%.6g\t%.6g\t%.6g\n", mix->name[i], x[i], st->abar[i], st->bbar[i]*1e6, exp(lnphiL[i]), exp(lnphiV[i]));
+    }
+}
+
+void MixtureEOSDisplay(const MixRule *mix, MixState *st, double T, double P, const double *x)
+{
+    ResultWriter w;             // Console writer for the results.
+    
+    if(writerConsole(&w))
+    {
+        MixtureEOSPrint(&w, mix, st, T, P, x);
+        writerClose(&w);
+    }
+}
+
+void MixtureEOSWrite(const MixRule *mix, MixState *st, double T, double P, const double *x)
+{
+    //  Function variables
+    ResultWriter w;             // Buffered writer for the results file.
+    
+    //  Set file name as timestamp + Mixture EOS Results
+    if(!writerOpen(&w, "Mixture EOS Results"))
+    {
+        return;
+    }
+    
+    //  Write to file
+    MixtureEOSPrint(&w, mix, st, T, P, x);
+    
+    //  Close file
+    writerClose(&w);
+}
+
+void MixtureEOSWriteSwitch(const MixRule *mix, MixState *st, double T, double P, const double *x)
+{
+    int control = 0;
+    
+    control = 1;
+    while(control == 1)
+    {
+        char input[maxstrlen];
+        
+        printf("Do you want to save results to file? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+            case 'T':
+            case 'Y':
+            case 't':
+            case 'y':
+                MixtureEOSWrite(mix, st, T, P, x);
+                control = 0;
+                break;
+            case '0':
+            case 'F':
+            case 'N':
+            case 'f':
+            case 'n':
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+}
+
+/// MARK: PSEUDO-MAIN FUNCTION
+void MixtureEOS(void)
+{
+    int whilmain = 0;
+    printf("Volumetric Properties of Mixtures\n");
+    
+    whilmain = 1;
+    while(whilmain == 1)
+    {
+        //  Variable declaration
+        MixRule mix;
+        MixState st;
+        double x[MixMaxComp];
+        double T = 0.0;
+        double P = 0.0;
+            //  Variables for timing function
+        struct timespec start, end;
+        double elapsed = 0.0;
+        
+        //  Data Collection
+        MixtureEOSVariable(&mix, &T, &P, x);
+        
+        //  Data Manipulation
+        clock_getres(CLOCK_MONOTONIC, &start);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        
+        MixStateReset(&st);
+        MixRuleEvaluate(&mix, &st, T, x);
+        
+        clock_getres(CLOCK_MONOTONIC, &end);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        elapsed = timer(start, end);
+
+        printf("Calculations completed in %.6f seconds.\n", elapsed);
+        
+        //  Displaying results
+        MixtureEOSDisplay(&mix, &st, T, P, x);
+        
+        //  Writing to File
+        MixtureEOSWriteSwitch(&mix, &st, T, P, x);
+        
+        //  Continue function
+        whilmain = Continue(whilmain);
+    }
+    fflush(stdout);
+}
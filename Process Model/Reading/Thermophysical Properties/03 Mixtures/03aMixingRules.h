@@ -0,0 +1,169 @@
+//
+//  03aMixingRules.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef _3aMixingRulesStruct_h
+#define _3aMixingRulesStruct_h
+
+#define MixMaxComp 32                                   // Largest number of components in a mixture.
+#define MixPackedSize (MixMaxComp*(MixMaxComp + 1)/2)   // Storage of a packed symmetric matrix.
+#define MixNameLength 32
+
+//  Equations of state
+#define MixSRK 0                // Soave-Redlich-Kwong.
+#define MixPR 1                 // Peng-Robinson.
+
+//  Mixing rules
+#define MixVdW 0                // van der Waals one-fluid.
+#define MixWongSandler 1        // Wong-Sandler with an NRTL excess Gibbs energy.
+
+//  Root selection
+#define MixLiquidRoot 0         // Smallest compressibility factor.
+#define MixVapourRoot 1         // Largest compressibility factor.
+#define MixStableRoot -1        // Root with the lowest Gibbs energy.
+
+typedef struct MixRule{
+    int ncomp;                                  // Number of components.
+    int eos;                                    // Equation of state.
+    int rule;                                   // Mixing rule.
+    char name[MixMaxComp][MixNameLength];       // Component names.
+    double Tc[MixMaxComp];                      // Critical temperatures (K).
+    double Pc[MixMaxComp];                      // Critical pressures (Pa).
+    double omega[MixMaxComp];                   // Acentric factors ([ ]).
+    _Alignas(64) double kij[MixPackedSize];     // Binary interaction parameters, packed upper triangle of the ncomp x ncomp matrix.
+    double tau[MixMaxComp*MixMaxComp];          // NRTL energy parameters, tau_ij = tau[i*ncomp + j]/T (K). Wong-Sandler only.
+    double alpha[MixMaxComp*MixMaxComp];        // NRTL non-randomness parameters ([ ]). Wong-Sandler only.
+} MixRule;
+
+typedef struct MixState{
+    //  Cached for the mixture description
+    int ready;                                  // Set once the temperature independent parameters below are stored.
+    double sqac[MixMaxComp];                    // Square roots of the critical attraction parameters.
+    double kappa[MixMaxComp];                   // Slopes of the alpha functions ([ ]).
+    //  Cached at one temperature
+    double T;                                   // Temperature of the cached parameters (K). Negative when empty.
+    double a[MixMaxComp];                       // Pure component attraction parameters (Pa.m6/mol2).
+    double dadT[MixMaxComp];                    // Temperature derivatives of a.
+    double b[MixMaxComp];                       // Pure component co-volumes (m3/mol).
+    _Alignas(64) double A[MixPackedSize];       // Packed cross parameters: (1 - kij) sqrt(a_i a_j) (van der Waals) or (1 - kij)[b - a/RT]_ij (Wong-Sandler).
+    _Alignas(64) double dA[MixPackedSize];      // Temperature derivatives of A.
+    double tauT[MixMaxComp*MixMaxComp];         // NRTL tau_ij at T. Wong-Sandler only.
+    double G[MixMaxComp*MixMaxComp];            // NRTL G_ij = exp(-alpha_ij tau_ij) at T. Wong-Sandler only.
+    //  Calculated for one composition
+    double am;                                  // Mixture attraction parameter (Pa.m6/mol2).
+    double bm;                                  // Mixture co-volume (m3/mol).
+    double damdT;                               // Temperature derivative of am.
+    double dbmdT;                               // Temperature derivative of bm (Wong-Sandler only).
+    double abar[MixMaxComp];                    // (1/n) d(n^2 am)/dn_i used by the fugacity coefficients.
+    double bbar[MixMaxComp];                    // d(n bm)/dn_i used by the fugacity coefficients.
+} MixState;
+
+#endif /* _3aMixingRulesStruct_h */
+
+#ifndef _3aMixingRulesVariable_h
+#define _3aMixingRulesVariable_h
+
+/// This subroutine is used to collect the mixing rule and its interaction parameters. The number of components, names and critical properties must already be stored.
+/// @param mix Struct where the mixing rule should be stored.
+void MixRuleVariable(MixRule *mix);
+
+#endif /* _3aMixingRulesVariable_h */
+
+#ifndef _3aMixingRulesCalc_h
+#define _3aMixingRulesCalc_h
+
+/// This subroutine is used to clear a mixture description. All interaction parameters are set to zero.
+/// @param mix Mixture description.
+/// @param ncomp Number of components.
+/// @param eos Equation of state.
+/// @param rule Mixing rule.
+void MixRuleInit(MixRule *mix, int ncomp, int eos, int rule);
+
+/// This subroutine is used to find the position of element (i, j) of a symmetric matrix stored as a packed upper triangle.
+/// @param n Order of the matrix.
+/// @param i Row.
+/// @param j Column.
+int MixPackedIndex(int n, int i, int j);
+
+/// This subroutine is used to set the symmetric binary interaction parameter of a pair of components.
+/// @param mix Mixture description.
+/// @param i First component.
+/// @param j Second component.
+/// @param kij Binary interaction parameter ([ ]).
+void MixSetInteraction(MixRule *mix, int i, int j, double kij);
+
+/// This subroutine is used to empty the parameter caches of a mixture state. It must be called before first use and whenever the mixture description changes.
+/// @param st Mixture state.
+void MixStateReset(MixState *st);
+
+/// This subroutine is used to calculate the pure component parameters and packed cross parameters at a temperature. Nothing is recalculated if the state already holds that temperature, and the temperature independent parts of the parameters are only calculated on first use.
+/// @param mix Mixture description.
+/// @param st Mixture state.
+/// @param T Temperature (K).
+void MixRuleTemperature(const MixRule *mix, MixState *st, double T);
+
+/// This subroutine is used to calculate the mixture parameters, their temperature derivatives and their composition derivatives. The double sum over the packed cross parameters is evaluated once, and its row sums give the composition derivatives.
+/// @param mix Mixture description.
+/// @param st Mixture state.
+/// @param T Temperature (K).
+/// @param x Mole fractions.
+void MixRuleEvaluate(const MixRule *mix, MixState *st, double T, const double *x);
+
+/// This subroutine is used to calculate the compressibility factor of a mixture and, optionally, its fugacity coefficients and residual properties with the generic cubic equation of state.
+/// @param mix Mixture description.
+/// @param st Mixture state.
+/// @param T Temperature (K).
+/// @param P Pressure (Pa).
+/// @param x Mole fractions.
+/// @param root Root used (MixLiquidRoot, MixVapourRoot or MixStableRoot).
+/// @param lnphi Natural logarithms of the fugacity coefficients. Not calculated when NULL.
+/// @param hres Residual molar enthalpy (J/mol). Not calculated when NULL.
+/// @param sres Residual molar entropy (J/mol.K). Not calculated when NULL.
+double MixCubicPhase(const MixRule *mix, MixState *st, double T, double P, const double *x, int root, double *lnphi, double *hres, double *sres);
+
+#endif /* _3aMixingRulesCalc_h */
+
+#ifndef _3aMixingRulesDisplay_h
+#define _3aMixingRulesDisplay_h
+
+/// This subroutine is used to output the mixture parameters and phase properties to the user console.
+/// @param mix Mixture description.
+/// @param st Mixture state evaluated at the feed.
+/// @param T Temperature (K).
+/// @param P Pressure (Pa).
+/// @param x Mole fractions.
+void MixtureEOSDisplay(const MixRule *mix, MixState *st, double T, double P, const double *x);
+
+/// This subroutine is used to write the mixture parameters and phase properties to a .txt file.
+/// @param mix Mixture description.
+/// @param st Mixture state evaluated at the feed.
+/// @param T Temperature (K).
+/// @param P Pressure (Pa).
+/// @param x Mole fractions.
+void MixtureEOSWrite(const MixRule *mix, MixState *st, double T, double P, const double *x);
+
+/// This subroutine is used to check if the user would like to write the results to a file.
+/// @param mix Mixture description.
+/// @param st Mixture state evaluated at the feed.
+/// @param T Temperature (K).
+/// @param P Pressure (Pa).
+/// @param x Mole fractions.
+void MixtureEOSWriteSwitch(const MixRule *mix, MixState *st, double T, double P, const double *x);
+
+#endif /* _3aMixingRulesDisplay_h */
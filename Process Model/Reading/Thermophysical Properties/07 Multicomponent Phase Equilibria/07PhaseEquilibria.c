@@ -0,0 +1,62 @@
+//
+//  07PhaseEquilibria.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+//  Standard header files
+#include <stdio.h>
+
+//  Custom header files
+#include "07PhaseEquilibria.h"
+
+#define maxstrlen 128
+
+void multiphaseEquilibria()
+{
+    char input[maxstrlen];
+    int control = 0;
+    
+    control = 1;
+    while(control == 1)
+    {
+        printf("Subroutines available:\n");
+        printf("1. Isothermal, isenthalpic and isentropic flash.\n");
+        printf("2. Flash map over a temperature-pressure grid.\n");
+        printf("Q. Exit menu.\n\n");
+        
+        printf("Selection [1 - 2]: ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+                Flash();
+                break;
+            case '2':
+                FlashMap();
+                break;
+            case '0':
+            case 'Q':
+            case 'q':
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised. Please enter an integer value between 1 and 2.\n");
+                break;
+        }
+    }
+}
@@ -0,0 +1,38 @@
+//
+//  07PhaseEquilibria.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef _7PhaseEquilibria_h
+#define _7PhaseEquilibria_h
+
+/// This subroutine is a menu function which informs the user of the available enclosed subroutines.
+void multiphaseEquilibria(void);
+
+#endif /* _7PhaseEquilibria_h */
+
+#ifndef Flash_h
+#define Flash_h
+
+/// This subroutine is used to guide the user through an isothermal (PT), isenthalpic (PH) or isentropic (PS) flash of a multicomponent feed.
+void Flash(void);
+
+/// This subroutine is used to guide the user through flashing a feed over a grid of temperatures and pressures.
+void FlashMap(void);
+
+#endif /* Flash_h */
@@ -0,0 +1,1148 @@
+//
+//  07aFlash.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+/// MARK: HEADER DECLARATIONS
+//  Standard header files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//  Custom header files
+#include "System.h"
+#include "ResultWriter.h"
+#include "Parallel.h"
+#include "LinearAlgebra.h"
+#include "03aMixingRules.h"
+#include "07PhaseEquilibria.h"
+#include "07aFlash.h"
+
+/// MARK: SUBROUTINE DEFINITIONS
+#define maxstrlen 128
+#define R 8.3145            // J/(mol.K)
+#define Tref 298.15         // Reference temperature for enthalpy and entropy (K).
+#define Pref 100000.0       // Reference pressure for entropy (Pa).
+#define mmHg 133.322        // Pa per mmHg.
+#define flashtol 1e-10      // Largest ln K residual accepted by the isothermal flash.
+#define flashmaxiter 200    // Iteration limit of each flash loop.
+#define ssmaxiter 25        // Successive substitution steps taken before switching to Newton's method.
+#define flashbatch 16       // Flash calculations performed by each parallel task.
+
+/// MARK: VARIABLE INPUT
+void FlashSystemVariable(FlashSystem *sys)
+{
+    char input[maxstrlen];
+    int control = 0;
+    
+    memset(sys, 0, sizeof(FlashSystem));
+    
+    control = 1;
+    while(control == 1)
+    {
+        printf("K-values: Raoult's law (1), Wilson correlation (2), Soave-Redlich-Kwong (3) or Peng-Robinson (4)? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+                sys->model = FlashRaoult;
+                control = 0;
+                break;
+            case '2':
+                sys->model = FlashWilsonK;
+                control = 0;
+                break;
+            case '3':
+                sys->model = FlashSRK;
+                control = 0;
+                break;
+            case '4':
+                sys->model = FlashPR;
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+    
+    sys->ncomp = (int)inputDouble(0, 0, "number of components", "");
+    sys->ncomp = (sys->ncomp > FlashMaxComp) ? FlashMaxComp : sys->ncomp;
+    MixRuleInit(&sys->mix, sys->ncomp, (sys->model == FlashSRK) ? MixSRK : MixPR, MixVdW);
+    for(int i = 0; i < sys->ncomp; ++i)
+    {
+        FlashComponent *c = &sys->comp[i];
+        
+        printf("Component %i name: ", i + 1);
+        fgets(input, sizeof(input), stdin);
+        input[strcspn(input, "\r\n")] = '\0';
+        snprintf(c->name, sizeof(c->name), "%.*s", (int)sizeof(c->name) - 1, input);
+        
+        snprintf(sys->mix.name[i], MixNameLength, "%s", c->name);
+        
+        if(sys->model == FlashRaoult)
+        {
+            c->ANTA = inputDouble(0, 1, "Antoine constant A", "mmHg");
+            c->ANTB = inputDouble(0, 1, "Antoine constant B", "deg C.mmHg");
+            c->ANTC = inputDouble(1, 1, "Antoine constant C", "deg C");
+        }else{
+            sys->mix.Tc[i] = inputDouble(0, 0, "critical temperature", "K");
+            sys->mix.Pc[i] = inputDouble(0, 0, "critical pressure", "bar");
+            sys->mix.Pc[i] = (sys->mix.Pc[i])*100000; // Conversion (bar to Pa)
+            sys->mix.omega[i] = inputDouble(1, 1, "acentric factor", "[ ]");
+        }
+        c->cp[0] = inputDouble(1, 1, "ideal gas heat capacity constant A", "J/mol.K");
+        c->cp[1] = inputDouble(1, 1, "ideal gas heat capacity constant B", "J/mol.K2");
+        c->cp[2] = inputDouble(1, 1, "ideal gas heat capacity constant C", "J/mol.K3");
+        c->cp[3] = inputDouble(1, 1, "ideal gas heat capacity constant D", "J/mol.K4");
+    }
+    
+    if(sys->model == FlashSRK || sys->model == FlashPR)
+    {
+        MixRuleVariable(&sys->mix);
+    }
+}
+
+/// This subroutine is used to collect and normalise the feed composition.
+static void FlashFeedVariable(const FlashSystem *sys, double *z)
+{
+    char prompt[maxstrlen];
+    double sum = 0.0;
+    
+    for(int i = 0; i < sys->ncomp; ++i)
+    {
+        snprintf(prompt, sizeof(prompt), "feed mole fraction of %s", sys->comp[i].name);
+        z[i] = inputDouble(1, 0, prompt, "[ ]");
+        sum += z[i];
+    }
+    if(sum <= 0.0)
+    {
+        printf("The feed mole fractions sum to zero. An equimolar feed is used instead.\n");
+        for(int i = 0; i < sys->ncomp; ++i)
+        {
+            z[i] = 1.0/sys->ncomp;
+        }
+        sum = 1.0;
+    }
+    if(fabs(sum - 1.0) > 1e-9)
+    {
+        printf("The feed mole fractions have been normalised.\n");
+    }
+    for(int i = 0; i < sys->ncomp; ++i)
+    {
+        z[i] = z[i]/sum;
+    }
+}
+
+void FlashSpecVariable(const FlashSystem *sys, FlashSpec *spec)
+{
+    char input[maxstrlen];
+    int control = 0;
+    
+    memset(spec, 0, sizeof(FlashSpec));
+    
+    control = 1;
+    while(control == 1)
+    {
+        printf("Flash specification: temperature (1), enthalpy (2) or entropy (3)? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+                spec->type = FlashPT;
+                control = 0;
+                break;
+            case '2':
+                spec->type = FlashPH;
+                control = 0;
+                break;
+            case '3':
+                spec->type = FlashPS;
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+    
+    FlashFeedVariable(sys, spec->z);
+    
+    spec->P = inputDouble(0, 0, "flash pressure", "bar");
+    spec->P = (spec->P)*100000; // Conversion (bar to Pa)
+    
+    if(spec->type == FlashPT)
+    {
+        spec->T = inputDouble(1, 1, "flash temperature", "deg C");
+    }else{
+        if(spec->type == FlashPH)
+        {
+            spec->H = inputDouble(1, 1, "specified molar enthalpy (ideal gas at 25 deg C = 0)", "kJ/mol");
+            spec->H = (spec->H)*1000; // Conversion (kJ/mol to J/mol)
+        }else{
+            spec->S = inputDouble(1, 1, "specified molar entropy (ideal gas at 25 deg C and 1 bar = 0)", "J/mol.K");
+        }
+        spec->T = inputDouble(1, 1, "initial temperature estimate", "deg C");
+    }
+    spec->T = (spec->T) + 273.15;
+}
+
+/// MARK: GENERAL CALCULATIONS
+/// This subroutine is used to calculate the ideal gas enthalpy of a component relative to 25 deg C.
+static double FlashIdealH(const FlashComponent *c, double T)
+{
+    double h = 0.0;
+    
+    h = c->cp[0]*(T - Tref);
+    h += c->cp[1]*(T*T - Tref*Tref)/2.0;
+    h += c->cp[2]*(T*T*T - Tref*Tref*Tref)/3.0;
+    h += c->cp[3]*(T*T*T*T - Tref*Tref*Tref*Tref)/4.0;
+    
+    return h;
+}
+
+/// This subroutine is used to calculate the ideal gas entropy of a component at 1 bar relative to 25 deg C.
+static double FlashIdealS(const FlashComponent *c, double T)
+{
+    double s = 0.0;
+    
+    s = c->cp[0]*log(T/Tref);
+    s += c->cp[1]*(T - Tref);
+    s += c->cp[2]*(T*T - Tref*Tref)/2.0;
+    s += c->cp[3]*(T*T*T - Tref*Tref*Tref)/3.0;
+    
+    return s;
+}
+
+/// This subroutine is used to calculate the natural logarithm of the vapour pressure (Pa) used by the ideal K-value models and its temperature derivative.
+static double FlashLnPsat(const FlashSystem *sys, int i, double T, double *dlnPdT)
+{
+    const FlashComponent *c = &sys->comp[i];
+    double lnP = 0.0;
+    double t = 0.0;
+    
+    if(sys->model == FlashRaoult)
+    {
+        t = T - 273.15 + c->ANTC;
+        lnP = log(10.0)*(c->ANTA - c->ANTB/t) + log(mmHg);
+        *dlnPdT = log(10.0)*c->ANTB/(t*t);
+    }else{
+        lnP = log(sys->mix.Pc[i]) + 5.373*(1 + sys->mix.omega[i])*(1 - sys->mix.Tc[i]/T);
+        *dlnPdT = 5.373*(1 + sys->mix.omega[i])*sys->mix.Tc[i]/(T*T);
+    }
+    
+    return lnP;
+}
+
+/// This subroutine is used to calculate the molar enthalpy and entropy of an ideal phase. The liquid is reached from the ideal gas through the Clausius-Clapeyron heat of vaporisation of the vapour pressure correlation, so the two phases are consistent with the K-values.
+static void FlashIdealPhase(const FlashSystem *sys, double T, double P, const double *x, int phase, double *h, double *s)
+{
+    double lnP = 0.0;
+    double dlnP = 0.0;
+    double dHvap = 0.0;
+    
+    *h = 0.0;
+    *s = 0.0;
+    for(int i = 0; i < sys->ncomp; ++i)
+    {
+        if(x[i] <= 0.0)
+        {
+            continue;
+        }
+        *h += x[i]*FlashIdealH(&sys->comp[i], T);
+        *s += x[i]*(FlashIdealS(&sys->comp[i], T) - R*log(x[i]));
+        if(phase == FlashVapour)
+        {
+            *s -= x[i]*R*log(P/Pref);
+        }else{
+            lnP = FlashLnPsat(sys, i, T, &dlnP);
+            dHvap = R*T*T*dlnP;
+            *h -= x[i]*dHvap;
+            *s -= x[i]*(R*(lnP - log(Pref)) + dHvap/T);
+        }
+    }
+}
+
+/// This subroutine is used to calculate the molar enthalpy and entropy of a phase with an equation of state.
+static double FlashCubicProperties(const FlashSystem *sys, MixState *st, double T, double P, const double *x, int root, double *h, double *s)
+{
+    double hres = 0.0;
+    double sres = 0.0;
+    double Z = 0.0;
+    
+    Z = MixCubicPhase(&sys->mix, st, T, P, x, root, NULL, &hres, &sres);
+    *h = hres;
+    *s = sres - R*log(P/Pref);
+    for(int i = 0; i < sys->ncomp; ++i)
+    {
+        if(x[i] <= 0.0)
+        {
+            continue;
+        }
+        *h += x[i]*FlashIdealH(&sys->comp[i], T);
+        *s += x[i]*(FlashIdealS(&sys->comp[i], T) - R*log(x[i]));
+    }
+    
+    return Z;
+}
+
+int FlashRachfordRice(int n, const double *z, const double *K, double *beta)
+{
+    double Kmin = K[0];
+    double Kmax = K[0];
+    double lo = 0.0;
+    double hi = 0.0;
+    double b = 0.0;
+    double g = 0.0;
+    double dg = 0.0;
+    double step = 0.0;
+    
+    for(int i = 1; i < n; ++i)
+    {
+        Kmin = fmin(Kmin, K[i]);
+        Kmax = fmax(Kmax, K[i]);
+    }
+    if(Kmax <= 1.0)
+    {
+        *beta = 0.0;
+        return 1;
+    }
+    if(Kmin >= 1.0)
+    {
+        *beta = 1.0;
+        return 1;
+    }
+    
+    //  Leibovici-Neoschil window, narrowed to keep every mole fraction below one.
+    lo = 1.0/(1.0 - Kmax);
+    hi = 1.0/(1.0 - Kmin);
+    for(int i = 0; i < n; ++i)
+    {
+        if(K[i] > 1.0)
+        {
+            lo = fmax(lo, (K[i]*z[i] - 1.0)/(K[i] - 1.0));
+        }else if(K[i] < 1.0){
+            hi = fmin(hi, (1.0 - z[i])/(1.0 - K[i]));
+        }
+    }
+    
+    b = (*beta > lo && *beta < hi) ? *beta : 0.5*(lo + hi);
+    for(int it = 0; it < 100; ++it)
+    {
+        g = 0.0;
+        dg = 0.0;
+        for(int i = 0; i < n; ++i)
+        {
+            double t = 1.0/(1.0 + b*(K[i] - 1.0));
+            
+            g += z[i]*(K[i] - 1.0)*t;
+            dg -= z[i]*(K[i] - 1.0)*(K[i] - 1.0)*t*t;
+        }
+        
+        //  g decreases monotonically, so the sign of g moves one side of the window.
+        if(g > 0.0)
+        {
+            lo = b;
+        }else{
+            hi = b;
+        }
+        step = (dg < 0.0) ? -g/dg : 0.0;
+        if(b + step <= lo || b + step >= hi || dg >= 0.0)
+        {
+            step = 0.5*(lo + hi) - b;
+        }
+        b += step;
+        if(fabs(step) < 1e-14*fmax(1.0, fabs(b)) || hi - lo < 1e-15)
+        {
+            break;
+        }
+    }
+    *beta = b;
+    
+    return 0;
+}
+
+/// This subroutine is used to calculate normalised phase compositions from the Rachford-Rice solution.
+static void FlashPhaseCompositions(int n, const double *z, const double *K, double beta, double *x, double *y)
+{
+    double sx = 0.0;
+    double sy = 0.0;
+    
+    for(int i = 0; i < n; ++i)
+    {
+        x[i] = z[i]/(1.0 + beta*(K[i] - 1.0));
+        y[i] = K[i]*x[i];
+        sx += x[i];
+        sy += y[i];
+    }
+    for(int i = 0; i < n; ++i)
+    {
+        x[i] = x[i]/sx;
+        y[i] = y[i]/sy;
+    }
+}
+
+/// This subroutine is used to calculate the equilibrium residuals, r_i = ln K_i - ln phi_i(L) + ln phi_i(V), for a set of K-values. This function returns the Rachford-Rice status.
+static int FlashCubicResidual(const FlashSystem *sys, MixState *st, double T, double P, const double *z, const double *lnK, double *beta, double *x, double *y, double *r)
+{
+    double K[FlashMaxComp];
+    double lnphiL[FlashMaxComp];
+    double lnphiV[FlashMaxComp];
+    int status = 0;
+    
+    for(int i = 0; i < sys->ncomp; ++i)
+    {
+        K[i] = exp(lnK[i]);
+    }
+    status = FlashRachfordRice(sys->ncomp, z, K, beta);
+    if(status != 0)
+    {
+        return status;
+    }
+    FlashPhaseCompositions(sys->ncomp, z, K, *beta, x, y);
+    MixCubicPhase(&sys->mix, st, T, P, x, MixLiquidRoot, lnphiL, NULL, NULL);
+    MixCubicPhase(&sys->mix, st, T, P, y, MixVapourRoot, lnphiV, NULL, NULL);
+    for(int i = 0; i < sys->ncomp; ++i)
+    {
+        r[i] = lnK[i] - lnphiL[i] + lnphiV[i];
+    }
+    
+    return 0;
+}
+
+/// This subroutine is used to converge the K-values of an isothermal flash with an equation of state. Successive substitution is accelerated every fifth step by the dominant eigenvalue method (GDEM). If the residual is still above tolerance after "ssmaxiter" steps, the solver switches to Newton's method on ln K with a finite-difference Jacobian, unless the vapour fraction lies outside [0, 1]. This function returns the Rachford-Rice status of the final K-values.
+static int FlashCubicSolve(const FlashSystem *sys, MixState *st, double T, double P, const double *z, double *lnK, FlashResult *res)
+{
+    int C = sys->ncomp;
+    double r[FlashMaxComp];
+    double rp[FlashMaxComp];
+    double lnKp[FlashMaxComp];
+    double xp[FlashMaxComp];
+    double yp[FlashMaxComp];
+    double d[FlashMaxComp];
+    double dprev[FlashMaxComp];
+    double J[FlashMaxComp*FlashMaxComp];
+    int pivot[FlashMaxComp];
+    double betap = 0.0;
+    double err = 0.0;
+    double trivial = 0.0;
+    int status = 0;
+    int iter = 0;
+    
+    res->status = 1;
+    for(iter = 1; iter <= flashmaxiter; ++iter)
+    {
+        status = FlashCubicResidual(sys, st, T, P, z, lnK, &res->beta, res->x, res->y, r);
+        if(status != 0)
+        {
+            res->status = 0;
+            break;
+        }
+        err = 0.0;
+        trivial = 0.0;
+        for(int i = 0; i < C; ++i)
+        {
+            err = fmax(err, fabs(r[i]));
+            trivial += lnK[i]*lnK[i];
+        }
+        if(err < flashtol)
+        {
+            res->status = 0;
+            break;
+        }
+        if(trivial < 1e-4)
+        {
+            //  Both phases have collapsed onto the feed.
+            status = 2;
+            res->status = 0;
+            break;
+        }
+        
+        if(iter > ssmaxiter && (res->beta < 0.0 || res->beta > 1.0))
+        {
+            //  A negative flash that is still outside [0, 1] after successive substitution only creeps towards the trivial solution, so the feed is taken to be a single phase.
+            res->status = 0;
+            break;
+        }
+        
+        if(iter > ssmaxiter)
+        {
+            //  Newton's method on ln K.
+            for(int j = 0; j < C; ++j)
+            {
+                double h = 1e-7*fmax(1.0, fabs(lnK[j]));
+                
+                memcpy(lnKp, lnK, C*sizeof(double));
+                lnKp[j] += h;
+                betap = res->beta;
+                if(FlashCubicResidual(sys, st, T, P, z, lnKp, &betap, xp, yp, rp) != 0)
+                {
+                    h = -h;
+                    lnKp[j] = lnK[j] + h;
+                    betap = res->beta;
+                    FlashCubicResidual(sys, st, T, P, z, lnKp, &betap, xp, yp, rp);
+                }
+                for(int i = 0; i < C; ++i)
+                {
+                    J[i*C + j] = (rp[i] - r[i])/h;
+                }
+            }
+            if(LUDecompose(C, J, pivot) == 0)
+            {
+                double scale = 1.0;
+                
+                for(int i = 0; i < C; ++i)
+                {
+                    d[i] = -r[i];
+                }
+                LUSolve(C, J, pivot, d);
+                for(int i = 0; i < C; ++i)
+                {
+                    scale = fmin(scale, 1.0/fmax(1.0, fabs(d[i])));
+                }
+                for(int i = 0; i < C; ++i)
+                {
+                    lnK[i] += scale*d[i];
+                }
+                continue;
+            }
+        }
+        
+        //  Successive substitution, ln K = ln phi(L) - ln phi(V).
+        for(int i = 0; i < C; ++i)
+        {
+            d[i] = -r[i];
+        }
+        if(iter % 5 == 0)
+        {
+            double num = 0.0;
+            double den = 0.0;
+            double lambda = 0.0;
+            
+            for(int i = 0; i < C; ++i)
+            {
+                num += d[i]*dprev[i];
+                den += dprev[i]*dprev[i];
+            }
+            lambda = (den > 0.0) ? num/den : 0.0;
+            if(lambda > 0.0 && lambda < 0.95)
+            {
+                for(int i = 0; i < C; ++i)
+                {
+                    lnK[i] += d[i]/(1.0 - lambda);
+                    dprev[i] = d[i];
+                }
+                continue;
+            }
+        }
+        for(int i = 0; i < C; ++i)
+        {
+            lnK[i] += d[i];
+            dprev[i] = d[i];
+        }
+    }
+    res->iter = (iter > flashmaxiter) ? flashmaxiter : iter;
+    
+    return status;
+}
+
+/// This subroutine is used to perform an isothermal flash. When warm is non-zero the K-values in lnK are used as the initial estimate; otherwise the Wilson correlation is used. On return lnK holds the converged K-values and warm is set if they describe a two-phase solution.
+static void FlashPTSolve(const FlashSystem *sys, double T, double P, const double *z, double *lnK, int *warm, FlashResult *res)
+{
+    int C = sys->ncomp;
+    double K[FlashMaxComp];
+    double hL = 0.0;
+    double sL = 0.0;
+    double hV = 0.0;
+    double sV = 0.0;
+    double dlnP = 0.0;
+    int status = 0;
+    MixState st;
+    
+    MixStateReset(&st);
+    res->T = T;
+    res->P = P;
+    res->iter = 1;
+    res->status = 0;
+    if(sys->model == FlashRaoult || sys->model == FlashWilsonK)
+    {
+        //  The ideal K-values do not depend on composition, so a single Rachford-Rice solution is exact.
+        for(int i = 0; i < C; ++i)
+        {
+            lnK[i] = FlashLnPsat(sys, i, T, &dlnP) - log(P);
+        }
+        for(int i = 0; i < C; ++i)
+        {
+            K[i] = exp(lnK[i]);
+        }
+        status = FlashRachfordRice(C, z, K, &res->beta);
+        if(status == 0)
+        {
+            FlashPhaseCompositions(C, z, K, res->beta, res->x, res->y);
+        }
+    }else{
+        if(*warm == 0)
+        {
+            for(int i = 0; i < C; ++i)
+            {
+                lnK[i] = FlashLnPsat(sys, i, T, &dlnP) - log(P);
+            }
+            res->beta = 0.5;
+        }
+        status = FlashCubicSolve(sys, &st, T, P, z, lnK, res);
+    }
+    
+    //  Classifying the product.
+    if(status == 0 && res->beta > 0.0 && res->beta < 1.0)
+    {
+        res->phase = FlashTwoPhase;
+    }else if(status == 2){
+        //  The trivial solution is labelled by its reduced volume, V/b.
+        double Z = MixCubicPhase(&sys->mix, &st, T, P, z, MixStableRoot, NULL, NULL, NULL);
+        
+        res->phase = (Z/(st.bm*P/(R*T)) > 1.75) ? FlashVapour : FlashLiquid;
+    }else if(res->beta >= 1.0){
+        res->phase = FlashVapour;
+    }else{
+        res->phase = FlashLiquid;
+    }
+    *warm = (res->phase == FlashTwoPhase);
+    
+    for(int i = 0; i < C; ++i)
+    {
+        res->K[i] = exp(lnK[i]);
+    }
+    if(res->phase != FlashTwoPhase)
+    {
+        res->beta = (res->phase == FlashVapour) ? 1.0 : 0.0;
+        memcpy(res->x, z, C*sizeof(double));
+        memcpy(res->y, z, C*sizeof(double));
+    }
+    
+    //  Molar enthalpy and entropy of the product.
+    if(sys->model == FlashRaoult || sys->model == FlashWilsonK)
+    {
+        FlashIdealPhase(sys, T, P, res->x, FlashLiquid, &hL, &sL);
+        FlashIdealPhase(sys, T, P, res->y, FlashVapour, &hV, &sV);
+    }else{
+        FlashCubicProperties(sys, &st, T, P, res->x, MixLiquidRoot, &hL, &sL);
+        FlashCubicProperties(sys, &st, T, P, res->y, MixVapourRoot, &hV, &sV);
+    }
+    res->H = res->beta*hV + (1 - res->beta)*hL;
+    res->S = res->beta*sV + (1 - res->beta)*sL;
+}
+
+/// This subroutine is used to perform an isothermal flash at T and return its deviation from the enthalpy or entropy specification.
+static double FlashSpecResidual(const FlashSystem *sys, const FlashSpec *spec, double T, double *lnK, int *warm, FlashResult *res)
+{
+    FlashPTSolve(sys, T, spec->P, spec->z, lnK, warm, res);
+    
+    return (spec->type == FlashPH) ? res->H - spec->H : res->S - spec->S;
+}
+
+/// This subroutine is used to perform a flash calculation of any specification. Isenthalpic and isentropic flashes are solved by bracketing the temperature and applying the Illinois variant of regula falsi, since the enthalpy and entropy both rise monotonically with temperature.
+static void FlashSolve(const FlashSystem *sys, const FlashSpec *spec, double *lnK, int *warm, FlashResult *res)
+{
+    double a = 0.0;
+    double b = 0.0;
+    double c = 0.0;
+    double fa = 0.0;
+    double fb = 0.0;
+    double fc = 0.0;
+    double dT = 0.0;
+    double tol = 0.0;
+    int bracket = 0;
+    
+    if(spec->type == FlashPT)
+    {
+        FlashPTSolve(sys, spec->T, spec->P, spec->z, lnK, warm, res);
+        return;
+    }
+    tol = 1e-9*fmax(1.0, fabs((spec->type == FlashPH) ? spec->H : spec->S));
+    
+    //  Bracketing the temperature.
+    a = (spec->T > 0.0) ? spec->T : 300.0;
+    fa = FlashSpecResidual(sys, spec, a, lnK, warm, res);
+    if(fabs(fa) < tol)
+    {
+        return;
+    }
+    dT = (fa < 0.0) ? 10.0 : -10.0;
+    for(int it = 0; it < 60; ++it)
+    {
+        b = fmin(fmax(a + dT, 10.0), 5000.0);
+        fb = FlashSpecResidual(sys, spec, b, lnK, warm, res);
+        if(fa*fb <= 0.0)
+        {
+            bracket = 1;
+            break;
+        }
+        if(b == a)
+        {
+            break;
+        }
+        a = b;
+        fa = fb;
+        dT = 2*dT;
+    }
+    if(bracket == 0)
+    {
+        res->status = 1;
+        return;
+    }
+    if(fabs(fb) < tol)
+    {
+        return;
+    }
+    
+    //  Illinois iteration.
+    c = b;
+    fc = fb;
+    for(int it = 0; it < flashmaxiter; ++it)
+    {
+        c = b - fb*(b - a)/(fb - fa);
+        fc = FlashSpecResidual(sys, spec, c, lnK, warm, res);
+        if(fabs(fc) < tol)
+        {
+            return;
+        }
+        if(fc*fb < 0.0)
+        {
+            a = b;
+            fa = fb;
+        }else{
+            fa = 0.5*fa;
+        }
+        b = c;
+        fb = fc;
+        if(fabs(b - a) < 1e-10*b)
+        {
+            break;
+        }
+    }
+    
+    //  The bracket has collapsed without meeting the tolerance. A pure component changes phase at a single temperature, where the enthalpy and entropy jump, so the product is a mixture of the saturated phases found on either side of the bracket.
+    {
+        FlashResult lo;
+        FlashResult hi;
+        double lnKs[FlashMaxComp];
+        double fl = 0.0;
+        double fh = 0.0;
+        int w = 0;
+        
+        fl = FlashSpecResidual(sys, spec, fmin(a, b), lnKs, &w, &lo);
+        w = 0;
+        fh = FlashSpecResidual(sys, spec, fmax(a, b), lnKs, &w, &hi);
+        if(lo.phase == FlashLiquid && hi.phase == FlashVapour && fl < 0.0 && fh > 0.0)
+        {
+            *res = hi;
+            res->beta = -fl/(fh - fl);
+            res->phase = FlashTwoPhase;
+            memcpy(res->x, lo.x, sys->ncomp*sizeof(double));
+            res->H = (1 - res->beta)*lo.H + res->beta*hi.H;
+            res->S = (1 - res->beta)*lo.S + res->beta*hi.S;
+            res->status = 0;
+            return;
+        }
+    }
+    res->status = (fabs(fc) < 1e3*tol) ? 0 : 1;
+}
+
+int FlashCalculation(const FlashSystem *sys, const FlashSpec *spec, FlashResult *res)
+{
+    double lnK[FlashMaxComp];
+    int warm = 0;
+    
+    memset(res, 0, sizeof(FlashResult));
+    FlashSolve(sys, spec, lnK, &warm, res);
+    
+    return res->status;
+}
+
+typedef struct FlashBatchContext{
+    const FlashSystem *sys;
+    const FlashSpec *spec;
+    FlashResult *res;
+} FlashBatchContext;
+
+/// This subroutine is used to perform a contiguous block of flash calculations. Used as the kernel of "parallelFor(...)".
+static void FlashBatchBlock(int start, int end, void *context)
+{
+    FlashBatchContext *ctx = context;
+    double lnK[FlashMaxComp];
+    int warm = 0;
+    
+    for(int i = start; i < end; ++i)
+    {
+        memset(&ctx->res[i], 0, sizeof(FlashResult));
+        FlashSolve(ctx->sys, &ctx->spec[i], lnK, &warm, &ctx->res[i]);
+    }
+}
+
+void FlashBatch(const FlashSystem *sys, int n, const FlashSpec *spec, FlashResult *res)
+{
+    FlashBatchContext ctx;
+    
+    ctx.sys = sys;
+    ctx.spec = spec;
+    ctx.res = res;
+    parallelFor(n, flashbatch, FlashBatchBlock, &ctx);
+}
+
+/// MARK: DISPLAY AND WRITE
+static void FlashPrint(ResultWriter *w, const FlashSystem *sys, const FlashSpec *spec, const FlashResult *res)
+{
+    const char *model[4] = {"Raoult's law", "Wilson correlation", "Soave-Redlich-Kwong", "Peng-Robinson"};
+    const char *type[3] = {"Isothermal (PT)", "Isenthalpic (PH)", "Isentropic (PS)"};
+    const char *phase[3] = {"Liquid", "Vapour", "Vapour-liquid"};
+    
+    writerPrintf(w, "_Flash_Calculation_Results_\n");
+    writerPrintf(w, "K-value model:\n");
+    writerPrintf(w, "%s\n", model[sys->model]);
+    writerPrintf(w, "Flash specification:\n");
+    writerPrintf(w, "%s\n", type[spec->type]);
+    writerPrintf(w, "%s\n\n", (res->status == 0) ? "Converged" : "Iteration limit reached");
+    
+    writerPrintf(w, "\tInput parameters:\n");
+    writerPrintf(w, "Flash pressure:\n");
+    writerPrintf(w, "P =\t%.5g\tbar\n", spec->P*0.00001);
+    if(spec->type == FlashPT)
+    {
+        writerPrintf(w, "Flash temperature:\n");
+        writerPrintf(w, "T =\t%.3f\tdeg C\n\n", spec->T - 273.15);
+    }else if(spec->type == FlashPH){
+        writerPrintf(w, "Specified molar enthalpy:\n");
+        writerPrintf(w, "H =\t%.5f\tkJ/mol\n\n", spec->H*0.001);
+    }else{
+        writerPrintf(w, "Specified molar entropy:\n");
+        writerPrintf(w, "S =\t%.5f\tJ/mol.K\n\n", spec->S);
+    }
+    
+    writerPrintf(w, "\tOutput parameters:\n");
+    writerPrintf(w, "Phase state:\n");
+    writerPrintf(w, "%s\n", phase[res->phase]);
+    writerPrintf(w, "Temperature:\n");
+    writerPrintf(w, "T =\t%.4f\tdeg C\n", res->T - 273.15);
+    writerPrintf(w, "Molar vapour fraction:\n");
+    writerPrintf(w, "beta =\t%.6f\t[ ]\n", res->beta);
+    writerPrintf(w, "Molar enthalpy:\n");
+    writerPrintf(w, "H =\t%.5f\tkJ/mol\n", res->H*0.001);
+    writerPrintf(w, "Molar entropy:\n");
+    writerPrintf(w, "S =\t%.5f\tJ/mol.K\n\n", res->S);
+    
+    writerPrintf(w, "Component\tz (-)\tx (-)\ty (-)\tK (-)\n");
+    for(int i = 0; i < sys->ncomp; ++i)
+    {
+        writerPrintf(w, "%s\t%.6f\t%.6f\t%.6f\t%.6g\n", sys->comp[i].name, spec->z[i], res->x[i], res->y[i], res->K[i]);
+    }
+}
+
+void FlashDisplay(const FlashSystem *sys, const FlashSpec *spec, const FlashResult *res)
+{
+    ResultWriter w;             // Console writer for the results.
+    
+    if(writerConsole(&w))
+    {
+        FlashPrint(&w, sys, spec, res);
+        writerClose(&w);
+    }
+}
+
+void FlashWrite(const FlashSystem *sys, const FlashSpec *spec, const FlashResult *res)
+{
+    //  Function variables
+    ResultWriter w;             // Buffered writer for the results file.
+    
+    //  Set file name as timestamp + Flash Results
+    if(!writerOpen(&w, "Flash Results"))
+    {
+        return;
+    }
+    
+    //  Write to file
+    FlashPrint(&w, sys, spec, res);
+    
+    //  Close file
+    writerClose(&w);
+}
+
+void FlashWriteSwitch(const FlashSystem *sys, const FlashSpec *spec, const FlashResult *res)
+{
+    int control = 0;
+    
+    control = 1;
+    while(control == 1)
+    {
+        char input[maxstrlen];
+        
+        printf("Do you want to save results to file? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+            case 'T':
+            case 'Y':
+            case 't':
+            case 'y':
+                FlashWrite(sys, spec, res);
+                control = 0;
+                break;
+            case '0':
+            case 'F':
+            case 'N':
+            case 'f':
+            case 'n':
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+}
+
+void FlashMapDisplay(int nT, int nP, const FlashResult *res)
+{
+    printf("_Flash_Map_Results_\n");
+    printf("Molar vapour fraction (L = liquid, V = vapour)\n");
+    printf("T (deg C) \\ P (bar)");
+    for(int j = 0; j < nP; ++j)
+    {
+        printf("\t%.4g", res[j].P*0.00001);
+    }
+    printf("\n");
+    for(int i = 0; i < nT; ++i)
+    {
+        printf("%.3f", res[i*nP].T - 273.15);
+        for(int j = 0; j < nP; ++j)
+        {
+            const FlashResult *r = &res[i*nP + j];
+            
+            if(r->phase == FlashLiquid)
+            {
+                printf("\tL");
+            }else if(r->phase == FlashVapour){
+                printf("\tV");
+            }else{
+                printf("\t%.4f", r->beta);
+            }
+        }
+        printf("\n");
+    }
+}
+
+void FlashMapWrite(const FlashSystem *sys, int nT, int nP, const FlashResult *res)
+{
+    //  Function variables
+    ResultWriter w;             // Buffered writer for the results file.
+    
+    //  Set file name as timestamp + Flash Map Results
+    if(!writerOpen(&w, "Flash Map Results"))
+    {
+        return;
+    }
+    
+    //  Write to file
+    writerPrintf(&w, "_Flash_Map_Results_\n");
+    writerPrintf(&w, "T (deg C)\tP (bar)\tbeta (-)\tH (kJ/mol)\tS (J/mol.K)");
+    for(int k = 0; k < sys->ncomp; ++k)
+    {
+        writerPrintf(&w, "\tx %s (-)", sys->comp[k].name);
+    }
+    for(int k = 0; k < sys->ncomp; ++k)
+    {
+        writerPrintf(&w, "\ty %s (-)", sys->comp[k].name);
+    }
+    writerPrintf(&w, "\n");
+    for(int i = 0; i < nT*nP; ++i)
+    {
+        writerPrintf(&w, "%.3f\t%.5g\t%.6f\t%.5f\t%.5f", res[i].T - 273.15, res[i].P*0.00001, res[i].beta, res[i].H*0.001, res[i].S);
+        for(int k = 0; k < sys->ncomp; ++k)
+        {
+            writerPrintf(&w, "\t%.6f", res[i].x[k]);
+        }
+        for(int k = 0; k < sys->ncomp; ++k)
+        {
+            writerPrintf(&w, "\t%.6f", res[i].y[k]);
+        }
+        writerPrintf(&w, "\n");
+    }
+    
+    //  Close file
+    writerClose(&w);
+}
+
+void FlashMapWriteSwitch(const FlashSystem *sys, int nT, int nP, const FlashResult *res)
+{
+    int control = 0;
+    
+    control = 1;
+    while(control == 1)
+    {
+        char input[maxstrlen];
+        
+        printf("Do you want to save results to file? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+            case 'T':
+            case 'Y':
+            case 't':
+            case 'y':
+                FlashMapWrite(sys, nT, nP, res);
+                control = 0;
+                break;
+            case '0':
+            case 'F':
+            case 'N':
+            case 'f':
+            case 'n':
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+}
+
+/// MARK: PSEUDO-MAIN FUNCTION
+void Flash(void)
+{
+    int whilmain = 0;
+    printf("Isothermal, Isenthalpic and Isentropic Flash\n");
+    
+    whilmain = 1;
+    while(whilmain == 1)
+    {
+        //  Variable declaration
+        FlashSystem sys;
+        FlashSpec spec;
+        FlashResult res;
+            //  Variables for timing function
+        struct timespec start, end;
+        double elapsed = 0.0;
+        
+        //  Data Collection
+        FlashSystemVariable(&sys);
+        FlashSpecVariable(&sys, &spec);
+        
+        //  Data Manipulation
+        clock_getres(CLOCK_MONOTONIC, &start);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        
+        FlashCalculation(&sys, &spec, &res);
+        
+        clock_getres(CLOCK_MONOTONIC, &end);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        elapsed = timer(start, end);
+
+        printf("Calculations completed in %.6f seconds.\n", elapsed);
+        
+        //  Displaying results
+        FlashDisplay(&sys, &spec, &res);
+        
+        //  Writing to File
+        FlashWriteSwitch(&sys, &spec, &res);
+        
+        //  Continue function
+        whilmain = Continue(whilmain);
+    }
+    fflush(stdout);
+}
+
+void FlashMap(void)
+{
+    int whilmain = 0;
+    printf("Flash Map over a Temperature-Pressure Grid\n");
+    
+    whilmain = 1;
+    while(whilmain == 1)
+    {
+        //  Variable declaration
+        FlashSystem sys;
+        FlashSpec feed;
+        FlashSpec *spec = NULL;
+        FlashResult *res = NULL;
+        double Tmin = 0.0;
+        double Tmax = 0.0;
+        double Pmin = 0.0;
+        double Pmax = 0.0;
+        int nT = 0;
+        int nP = 0;
+            //  Variables for timing function
+        struct timespec start, end;
+        double elapsed = 0.0;
+        
+        //  Data Collection
+        FlashSystemVariable(&sys);
+        memset(&feed, 0, sizeof(FlashSpec));
+        FlashFeedVariable(&sys, feed.z);
+        Tmin = inputDouble(1, 1, "lowest temperature", "deg C");
+        Tmax = inputDouble(1, 1, "highest temperature", "deg C");
+        nT = (int)inputDouble(0, 0, "number of temperatures", "");
+        Pmin = inputDouble(0, 0, "lowest pressure", "bar");
+        Pmax = inputDouble(0, 0, "highest pressure", "bar");
+        nP = (int)inputDouble(0, 0, "number of pressures", "");
+        
+        //  Data Manipulation
+        clock_getres(CLOCK_MONOTONIC, &start);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        
+        //  Neighbouring pressures at one temperature are stored together so that each worker can warm start from the previous flash.
+        spec = malloc((size_t)nT*nP*sizeof(FlashSpec));
+        res = malloc((size_t)nT*nP*sizeof(FlashResult));
+        for(int i = 0; i < nT; ++i)
+        {
+            for(int j = 0; j < nP; ++j)
+            {
+                FlashSpec *s = &spec[i*nP + j];
+                
+                *s = feed;
+                s->type = FlashPT;
+                s->T = ((nT > 1) ? Tmin + (Tmax - Tmin)*i/(nT - 1) : Tmin) + 273.15;
+                s->P = ((nP > 1) ? Pmin + (Pmax - Pmin)*j/(nP - 1) : Pmin)*100000;
+            }
+        }
+        FlashBatch(&sys, nT*nP, spec, res);
+        
+        clock_getres(CLOCK_MONOTONIC, &end);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        elapsed = timer(start, end);
+
+        printf("Calculations completed in %.6f seconds.\n", elapsed);
+        
+        //  Displaying results
+        FlashMapDisplay(nT, nP, res);
+        
+        //  Writing to File
+        FlashMapWriteSwitch(&sys, nT, nP, res);
+        
+        //  Continue function
+        whilmain = Continue(whilmain);
+        
+        free(spec);
+        free(res);
+    }
+    fflush(stdout);
+}
@@ -0,0 +1,163 @@
+//
+//  07aFlash.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef _7aFlashStruct_h
+#define _7aFlashStruct_h
+
+#define FlashMaxComp MixMaxComp // Largest number of components in a flash calculation.
+#define FlashNameLength 32
+
+//  K-value models
+#define FlashRaoult 0           // Ideal liquid and vapour with Antoine vapour pressures.
+#define FlashWilsonK 1          // Wilson K-value correlation from critical properties.
+#define FlashSRK 2              // Soave-Redlich-Kwong equation of state.
+#define FlashPR 3               // Peng-Robinson equation of state.
+
+//  Flash specifications
+#define FlashPT 0               // Isothermal flash.
+#define FlashPH 1               // Isenthalpic (adiabatic) flash.
+#define FlashPS 2               // Isentropic flash.
+
+//  Phase states
+#define FlashLiquid 0
+#define FlashVapour 1
+#define FlashTwoPhase 2
+
+typedef struct FlashComponent{
+    char name[FlashNameLength];
+    double ANTA;        // Antoine constant A (log10, mmHg and deg C).
+    double ANTB;        // Antoine constant B.
+    double ANTC;        // Antoine constant C.
+    double cp[4];       // Ideal gas heat capacity, cp = cp[0] + cp[1] T + cp[2] T^2 + cp[3] T^3 (J/mol.K).
+} FlashComponent;
+
+typedef struct FlashSystem{
+    int ncomp;                                      // Number of components.
+    int model;                                      // K-value model.
+    FlashComponent comp[FlashMaxComp];              // Pure component data.
+    MixRule mix;                                    // Critical properties and mixing rule used by the Wilson correlation and the equations of state.
+} FlashSystem;
+
+typedef struct FlashSpec{
+    int type;                   // Flash specification.
+    double P;                   // Pressure (Pa).
+    double T;                   // Temperature for an isothermal flash or the initial estimate otherwise (K).
+    double H;                   // Specified molar enthalpy (J/mol).
+    double S;                   // Specified molar entropy (J/mol.K).
+    double z[FlashMaxComp];     // Feed mole fractions.
+} FlashSpec;
+
+typedef struct FlashResult{
+    int status;                 // Converged (0) or iteration limit reached (1).
+    int phase;                  // Phase state of the product.
+    int iter;                   // Iterations used by the innermost solver.
+    double T;                   // Temperature (K).
+    double P;                   // Pressure (Pa).
+    double beta;                // Molar vapour fraction ([ ]).
+    double H;                   // Molar enthalpy relative to the ideal gas at 25 deg C (J/mol).
+    double S;                   // Molar entropy relative to the ideal gas at 25 deg C and 1 bar (J/mol.K).
+    double x[FlashMaxComp];     // Liquid mole fractions.
+    double y[FlashMaxComp];     // Vapour mole fractions.
+    double K[FlashMaxComp];     // Equilibrium ratios, K = y/x.
+} FlashResult;
+
+#endif /* _7aFlashStruct_h */
+
+#ifndef _7aFlashVariable_h
+#define _7aFlashVariable_h
+
+/// This subroutine is used to collect the K-value model and the pure component data for a flash calculation.
+/// @param sys Struct where the component data should be stored.
+void FlashSystemVariable(FlashSystem *sys);
+
+/// This subroutine is used to collect the feed composition and flash pressure. The remaining specification depends on the flash type.
+/// @param sys Component data.
+/// @param spec Struct where the flash specification should be stored.
+void FlashSpecVariable(const FlashSystem *sys, FlashSpec *spec);
+
+#endif /* _7aFlashVariable_h */
+
+#ifndef _7aFlashCalc_h
+#define _7aFlashCalc_h
+
+/// This subroutine is used to solve the Rachford-Rice equation, sum z_i (K_i - 1)/(1 + beta (K_i - 1)) = 0, by Newton's method kept inside the Leibovici-Neoschil window. The window is narrowed so that neither phase has a mole fraction above one, and bisection is used whenever a Newton step would leave it. The root may lie outside [0, 1] (negative flash). This function returns 0 when a root exists, or 1 when every K-value lies on the same side of one, in which case beta is set to 0 (liquid) or 1 (vapour).
+/// @param n Number of components.
+/// @param z Feed mole fractions.
+/// @param K Equilibrium ratios.
+/// @param beta Molar vapour fraction.
+int FlashRachfordRice(int n, const double *z, const double *K, double *beta);
+
+/// This subroutine is used to perform a single flash calculation. Isothermal flashes with an equation of state are solved by successive substitution with GDEM acceleration, switching to Newton's method on ln K when convergence is slow near the critical region. Isenthalpic and isentropic flashes wrap the isothermal flash in a bracketed Illinois iteration on temperature. This function returns the status of the result.
+/// @param sys Component data.
+/// @param spec Flash specification.
+/// @param res Struct where the flash result should be stored.
+int FlashCalculation(const FlashSystem *sys, const FlashSpec *spec, FlashResult *res);
+
+/// This subroutine is used to perform many independent flash calculations in parallel. Each worker reuses the converged K-values of its previous flash as the initial estimate for the next, so neighbouring specifications should be stored next to each other.
+/// @param sys Component data.
+/// @param n Number of flash specifications.
+/// @param spec Array of n flash specifications.
+/// @param res Array of n flash results.
+void FlashBatch(const FlashSystem *sys, int n, const FlashSpec *spec, FlashResult *res);
+
+#endif /* _7aFlashCalc_h */
+
+#ifndef _7aFlashDisplay_h
+#define _7aFlashDisplay_h
+
+/// This subroutine is used to output the flash result to the user console.
+/// @param sys Component data.
+/// @param spec Flash specification.
+/// @param res Flash result.
+void FlashDisplay(const FlashSystem *sys, const FlashSpec *spec, const FlashResult *res);
+
+/// This subroutine is used to write the flash result to a .txt file.
+/// @param sys Component data.
+/// @param spec Flash specification.
+/// @param res Flash result.
+void FlashWrite(const FlashSystem *sys, const FlashSpec *spec, const FlashResult *res);
+
+/// This subroutine is used to check if the user would like to write the flash result to a file.
+/// @param sys Component data.
+/// @param spec Flash specification.
+/// @param res Flash result.
+void FlashWriteSwitch(const FlashSystem *sys, const FlashSpec *spec, const FlashResult *res);
+
+/// This subroutine is used to output a temperature-pressure flash map to the user console as a grid of vapour fractions.
+/// @param nT Number of temperatures.
+/// @param nP Number of pressures.
+/// @param res Array of nT x nP flash results, stored temperature by temperature.
+void FlashMapDisplay(int nT, int nP, const FlashResult *res);
+
+/// This subroutine is used to write every point of a temperature-pressure flash map to a .txt file.
+/// @param sys Component data.
+/// @param nT Number of temperatures.
+/// @param nP Number of pressures.
+/// @param res Array of nT x nP flash results, stored temperature by temperature.
+void FlashMapWrite(const FlashSystem *sys, int nT, int nP, const FlashResult *res);
+
+/// This subroutine is used to check if the user would like to write the flash map to a file.
+/// @param sys Component data.
+/// @param nT Number of temperatures.
+/// @param nP Number of pressures.
+/// @param res Array of nT x nP flash results, stored temperature by temperature.
+void FlashMapWriteSwitch(const FlashSystem *sys, int nT, int nP, const FlashResult *res);
+
+#endif /* _7aFlashDisplay_h */
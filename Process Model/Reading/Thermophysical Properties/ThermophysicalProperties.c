@@ -46,8 +46,7 @@ void ThermoProps()
                 statePropertyRelations();
                 break;
             case 3:
-                //mixtures();
-                printf("Bear with me, this is still being written...\n");
+                mixtures();
                 break;
             case 4:
                 //thermodynamicProperties();
@@ -62,8 +61,7 @@ void ThermoProps()
                 printf("Bear with me, this is still being written...\n");
                 break;
             case 7:
-                //multiphaseEquilibria();
-                printf("Bear with me, this is still being written...\n");
+                multiphaseEquilibria();
                 break;
             case 8:
                 //Viscosity();
@@ -24,5 +24,7 @@
 
 #include "01PureComponent.h"
 #include "02PVTRelations.h"
+#include "03Mixtures.h"
+#include "07PhaseEquilibria.h"
 
 #endif /* ThermophysicalProperties_h */
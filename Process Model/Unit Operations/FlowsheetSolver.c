@@ -0,0 +1,998 @@
+//
+//  FlowsheetSolver.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+/// MARK: HEADER DECLARATIONS
+//Standard Header Files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//Custom Header Files
+#include "Parallel.h"
+#include "FlowsheetSolver.h"
+
+/// MARK: SUBROUTINE DEFINITIONS
+#define R 8.3145
+#define blockgrain 8        // Blocks are cheap to calculate, so a level is only split across threads when it is wide.
+
+typedef struct FsLevelContext{
+    FsFlowsheet *fs;
+    const FsUnit *unit;
+    int level;
+} FsLevelContext;
+
+typedef struct FsGraph{
+    int *index;                 // Order in which each block was reached by the depth-first search.
+    int *low;                   // Earliest block reachable from each block.
+    int *stack;                 // Blocks waiting to be assigned to a component.
+    int *frame;                 // Blocks on the depth-first search path.
+    int *port;                  // Next outlet to be followed for each block on the path.
+    char *onstack;              // Block is held on the stack (1) or not (0).
+    int *comp;                  // Component of each block.
+    int *cyclic;                // Component holds a cycle (1) or not (0).
+    int *level;                 // Calculation level of each block.
+    int *indeg;                 // Unprocessed inlets of each block.
+} FsGraph;
+
+typedef struct FsUnitContext{
+    FsFlowsheet *fs;
+    const FsOptions *opt;
+    const int *shadow;          // Position in the stream array of the first shadow stream of each unit.
+    int level;
+} FsUnitContext;
+
+/// MARK: FLOWSHEET DESCRIPTION
+int FsAddComponent(FsFlowsheet *fs, const char *name, double Mw, double cp, double rho)
+{
+    FsComponent *comp = &fs->comp[fs->ncomp];
+    
+    snprintf(comp->name, sizeof(comp->name), "%s", name);
+    comp->Mw = Mw;
+    comp->cp = cp;
+    comp->rho = rho;
+    
+    return fs->ncomp++;
+}
+
+int FsAddStream(FsFlowsheet *fs, const char *name)
+{
+    FsStream *s = NULL;
+    
+    fs->stream = realloc(fs->stream, (fs->nstreams + 1)*sizeof(FsStream));
+    s = &fs->stream[fs->nstreams];
+    memset(s, 0, sizeof(FsStream));
+    snprintf(s->name, sizeof(s->name), "%s", name);
+    s->T = 298.15;
+    s->P = 101325;
+    s->x[0] = 1.0;
+    s->source = -1;
+    s->sink = -1;
+    
+    return fs->nstreams++;
+}
+
+int FsAddBlock(FsFlowsheet *fs, const char *name, FsBlockModel model, void *params)
+{
+    FsBlock *block = NULL;
+    
+    fs->block = realloc(fs->block, (fs->nblocks + 1)*sizeof(FsBlock));
+    block = &fs->block[fs->nblocks];
+    memset(block, 0, sizeof(FsBlock));
+    snprintf(block->name, sizeof(block->name), "%s", name);
+    block->model = model;
+    block->params = params;
+    
+    return fs->nblocks++;
+}
+
+void FsBlockInlet(FsFlowsheet *fs, int block, int stream)
+{
+    FsBlock *b = &fs->block[block];
+    
+    if(b->nin < FsMaxPorts)
+    {
+        b->in[b->nin++] = stream;
+        fs->stream[stream].sink = block;
+    }
+}
+
+void FsBlockOutlet(FsFlowsheet *fs, int block, int stream)
+{
+    FsBlock *b = &fs->block[block];
+    
+    if(b->nout < FsMaxPorts)
+    {
+        b->out[b->nout++] = stream;
+        fs->stream[stream].source = block;
+    }
+}
+
+void FsSetStream(FsFlowsheet *fs, int stream, double F, double T, double P, const double *x)
+{
+    FsStream *s = &fs->stream[stream];
+    double sum = 0.0;
+    
+    for(int i = 0; i < fs->ncomp; ++i)
+    {
+        sum += x[i];
+    }
+    for(int i = 0; i < fs->ncomp; ++i)
+    {
+        s->x[i] = (sum > 0) ? x[i]/sum : 0.0;
+    }
+    s->F = F;
+    s->T = T;
+    s->P = P;
+}
+
+/// This subroutine is used to release the calculation sequence.
+static void FsSequenceFree(FsFlowsheet *fs)
+{
+    for(int u = 0; u < fs->nunits; ++u)
+    {
+        free(fs->unit[u].block);
+        free(fs->unit[u].levelstart);
+        free(fs->unit[u].tear);
+    }
+    free(fs->unit);
+    free(fs->levelstart);
+    fs->unit = NULL;
+    fs->levelstart = NULL;
+    fs->nunits = 0;
+    fs->nlevels = 0;
+}
+
+void FsFlowsheetFree(FsFlowsheet *fs)
+{
+    FsSequenceFree(fs);
+    free(fs->stream);
+    free(fs->block);
+    memset(fs, 0, sizeof(FsFlowsheet));
+}
+
+/// MARK: STREAM PROPERTIES
+double FsMolarMass(const FsFlowsheet *fs, const FsStream *s)
+{
+    double Mw = 0.0;
+    
+    for(int i = 0; i < fs->ncomp; ++i)
+    {
+        Mw += s->x[i]*fs->comp[i].Mw;
+    }
+    
+    return Mw;
+}
+
+double FsHeatCapacity(const FsFlowsheet *fs, const FsStream *s)
+{
+    double cp = 0.0;
+    
+    for(int i = 0; i < fs->ncomp; ++i)
+    {
+        cp += s->x[i]*fs->comp[i].cp;
+    }
+    
+    return cp;
+}
+
+double FsDensity(const FsFlowsheet *fs, const FsStream *s)
+{
+    double v = 0.0;     // Molar volume (m3/mol).
+    
+    for(int i = 0; i < fs->ncomp; ++i)
+    {
+        if(fs->comp[i].rho > 0)
+        {
+            v += s->x[i]*fs->comp[i].Mw/fs->comp[i].rho;
+        }else{
+            v += s->x[i]*R*s->T/s->P;
+        }
+    }
+    
+    return FsMolarMass(fs, s)/v;
+}
+
+/// MARK: CALCULATION SEQUENCE
+/// This subroutine is used to allocate the work arrays used by the graph searches. This function returns 0 on success and -1 if any array could not be allocated.
+static int FsGraphAlloc(FsGraph *gr, int nb)
+{
+    gr->index = malloc(nb*sizeof(int));
+    gr->low = malloc(nb*sizeof(int));
+    gr->stack = malloc(nb*sizeof(int));
+    gr->frame = malloc(nb*sizeof(int));
+    gr->port = malloc(nb*sizeof(int));
+    gr->onstack = calloc(nb, 1);
+    gr->comp = malloc(nb*sizeof(int));
+    gr->cyclic = malloc(nb*sizeof(int));
+    gr->level = calloc(nb, sizeof(int));
+    gr->indeg = calloc(nb, sizeof(int));
+    
+    if(gr->index == NULL || gr->low == NULL || gr->stack == NULL || gr->frame == NULL || gr->port == NULL || gr->onstack == NULL || gr->comp == NULL || gr->cyclic == NULL || gr->level == NULL || gr->indeg == NULL)
+    {
+        return -1;
+    }
+    return 0;
+}
+
+/// This subroutine is used to release the work arrays used by the graph searches.
+static void FsGraphFree(FsGraph *gr)
+{
+    free(gr->index);
+    free(gr->low);
+    free(gr->stack);
+    free(gr->frame);
+    free(gr->port);
+    free(gr->onstack);
+    free(gr->comp);
+    free(gr->cyclic);
+    free(gr->level);
+    free(gr->indeg);
+}
+
+/// This subroutine is used to find the strongly connected components of a set of blocks with Tarjan's algorithm, ignoring torn streams and blocks outside the set. Components are numbered in reverse calculation order and stored in "gr->comp". A component is cyclic if it holds more than one block or a block that feeds itself. This function returns the number of components.
+/// @param fs Flowsheet description.
+/// @param nlist Number of blocks in the set.
+/// @param list Blocks in the set.
+/// @param active Blocks in the set (1) or outside it (0).
+/// @param torn Streams that have been torn (1) or are intact (0).
+/// @param gr Work arrays.
+static int FsTarjan(const FsFlowsheet *fs, int nlist, const int *list, const char *active, const char *torn, FsGraph *gr)
+{
+    int count = 0;
+    int nstack = 0;
+    int ncomp = 0;
+    
+    for(int k = 0; k < nlist; ++k)
+    {
+        gr->index[list[k]] = -1;
+    }
+    for(int k = 0; k < nlist; ++k)
+    {
+        int root = list[k];
+        int depth = 0;
+        
+        if(gr->index[root] >= 0)
+        {
+            continue;
+        }
+        gr->frame[0] = root;
+        gr->port[0] = 0;
+        gr->index[root] = gr->low[root] = count++;
+        gr->stack[nstack++] = root;
+        gr->onstack[root] = 1;
+        depth = 1;
+        
+        while(depth > 0)
+        {
+            int v = gr->frame[depth - 1];
+            const FsBlock *b = &fs->block[v];
+            
+            if(gr->port[depth - 1] < b->nout)
+            {
+                int s = b->out[gr->port[depth - 1]++];
+                int w = fs->stream[s].sink;
+                
+                if(torn[s] || w < 0 || !active[w])
+                {
+                    continue;
+                }
+                if(gr->index[w] < 0)
+                {
+                    gr->index[w] = gr->low[w] = count++;
+                    gr->stack[nstack++] = w;
+                    gr->onstack[w] = 1;
+                    gr->frame[depth] = w;
+                    gr->port[depth] = 0;
+                    ++depth;
+                }else if(gr->onstack[w]){
+                    gr->low[v] = (gr->index[w] < gr->low[v]) ? gr->index[w] : gr->low[v];
+                }
+            }else{
+                --depth;
+                if(gr->low[v] == gr->index[v])
+                {
+                    int size = 0;
+                    int w = 0;
+                    
+                    do{
+                        w = gr->stack[--nstack];
+                        gr->onstack[w] = 0;
+                        gr->comp[w] = ncomp;
+                        ++size;
+                    }while(w != v);
+                    gr->cyclic[ncomp] = (size > 1);
+                    ++ncomp;
+                }
+                if(depth > 0)
+                {
+                    int u = gr->frame[depth - 1];
+                    
+                    gr->low[u] = (gr->low[v] < gr->low[u]) ? gr->low[v] : gr->low[u];
+                }
+            }
+        }
+    }
+    
+    //  Blocks feeding themselves directly
+    for(int k = 0; k < nlist; ++k)
+    {
+        const FsBlock *b = &fs->block[list[k]];
+        
+        for(int p = 0; p < b->nout; ++p)
+        {
+            if(!torn[b->out[p]] && fs->stream[b->out[p]].sink == list[k])
+            {
+                gr->cyclic[gr->comp[list[k]]] = 1;
+            }
+        }
+    }
+    
+    return ncomp;
+}
+
+/// This subroutine is used to count the blocks of a unit that still lie on a cycle once the torn streams are removed.
+static int FsBlocksInLoops(const FsFlowsheet *fs, const FsUnit *unit, const char *active, const char *torn, FsGraph *gr)
+{
+    int count = 0;
+    
+    FsTarjan(fs, unit->nblocks, unit->block, active, torn, gr);
+    for(int k = 0; k < unit->nblocks; ++k)
+    {
+        count += gr->cyclic[gr->comp[unit->block[k]]];
+    }
+    
+    return count;
+}
+
+/// This subroutine is used to choose the tear streams of a recycle loop. The stream whose removal leaves the fewest blocks on a cycle is torn first; ties are broken in favour of streams entering blocks with the most inlets, which places tears on recycle streams returning to mixers.
+static void FsSelectTears(const FsFlowsheet *fs, FsUnit *unit, const char *active, char *torn, FsGraph *gr)
+{
+    unit->ntear = 0;
+    unit->tear = NULL;
+    while(FsBlocksInLoops(fs, unit, active, torn, gr) > 0)
+    {
+        int best = -1;
+        int bestscore = 0;
+        int bestnin = 0;
+        
+        for(int k = 0; k < unit->nblocks; ++k)
+        {
+            const FsBlock *b = &fs->block[unit->block[k]];
+            
+            for(int p = 0; p < b->nout; ++p)
+            {
+                int s = b->out[p];
+                int w = fs->stream[s].sink;
+                int score = 0;
+                
+                if(torn[s] || w < 0 || !active[w])
+                {
+                    continue;
+                }
+                torn[s] = 1;
+                score = FsBlocksInLoops(fs, unit, active, torn, gr);
+                torn[s] = 0;
+                if(best < 0 || score < bestscore || (score == bestscore && (fs->block[w].nin > bestnin || (fs->block[w].nin == bestnin && s < best))))
+                {
+                    best = s;
+                    bestscore = score;
+                    bestnin = fs->block[w].nin;
+                }
+            }
+        }
+        torn[best] = 1;
+        unit->tear = realloc(unit->tear, (unit->ntear + 1)*sizeof(int));
+        unit->tear[unit->ntear++] = best;
+    }
+}
+
+/// This subroutine is used to place the blocks of a unit into levels by the longest path from the start of the unit, ignoring torn streams. The block order and level boundaries are stored in the unit.
+static void FsLevels(const FsFlowsheet *fs, const char *active, const char *torn, FsUnit *unit, FsGraph *gr)
+{
+    int *queue = malloc(unit->nblocks*sizeof(int));
+    int *count = NULL;
+    int head = 0;
+    int tail = 0;
+    
+    //  Kahn's algorithm on the torn graph
+    for(int k = 0; k < unit->nblocks; ++k)
+    {
+        gr->level[unit->block[k]] = 0;
+        gr->indeg[unit->block[k]] = 0;
+    }
+    for(int k = 0; k < unit->nblocks; ++k)
+    {
+        const FsBlock *b = &fs->block[unit->block[k]];
+        
+        for(int p = 0; p < b->nout; ++p)
+        {
+            int w = fs->stream[b->out[p]].sink;
+            
+            if(!torn[b->out[p]] && w >= 0 && active[w])
+            {
+                ++gr->indeg[w];
+            }
+        }
+    }
+    for(int k = 0; k < unit->nblocks; ++k)
+    {
+        if(gr->indeg[unit->block[k]] == 0)
+        {
+            queue[tail++] = unit->block[k];
+        }
+    }
+    unit->nlevels = 0;
+    while(head < tail)
+    {
+        int v = queue[head++];
+        const FsBlock *b = &fs->block[v];
+        
+        unit->nlevels = (gr->level[v] + 1 > unit->nlevels) ? gr->level[v] + 1 : unit->nlevels;
+        for(int p = 0; p < b->nout; ++p)
+        {
+            int w = fs->stream[b->out[p]].sink;
+            
+            if(torn[b->out[p]] || w < 0 || !active[w])
+            {
+                continue;
+            }
+            gr->level[w] = (gr->level[v] + 1 > gr->level[w]) ? gr->level[v] + 1 : gr->level[w];
+            if(--gr->indeg[w] == 0)
+            {
+                queue[tail++] = w;
+            }
+        }
+    }
+    
+    //  Counting sort of the blocks by level
+    count = calloc(unit->nlevels + 1, sizeof(int));
+    unit->levelstart = calloc(unit->nlevels + 1, sizeof(int));
+    for(int k = 0; k < unit->nblocks; ++k)
+    {
+        ++count[gr->level[queue[k]] + 1];
+    }
+    for(int l = 0; l < unit->nlevels; ++l)
+    {
+        count[l + 1] += count[l];
+        unit->levelstart[l + 1] = count[l + 1];
+    }
+    for(int k = 0; k < unit->nblocks; ++k)
+    {
+        unit->block[count[gr->level[queue[k]]]++] = queue[k];
+    }
+    
+    free(queue);
+    free(count);
+}
+
+int FsSequence(FsFlowsheet *fs)
+{
+    int nb = fs->nblocks;
+    char *active = malloc(nb);
+    char *torn = calloc(fs->nstreams, 1);
+    int *all = calloc(nb, sizeof(int));
+    int *size = NULL;
+    int *level = NULL;
+    int *order = NULL;
+    FsUnit *unit = NULL;
+    FsGraph gr;
+    int ncomp = 0;
+    int ntear = 0;
+    
+    FsSequenceFree(fs);
+    if(FsGraphAlloc(&gr, nb) != 0 || active == NULL || torn == NULL || all == NULL)
+    {
+        FsGraphFree(&gr);
+        free(active);
+        free(torn);
+        free(all);
+        return -1;
+    }
+    memset(active, 1, nb);
+    for(int v = 0; v < nb; ++v)
+    {
+        all[v] = v;
+    }
+    ncomp = FsTarjan(fs, nb, all, active, torn, &gr);
+    
+    //  Components are numbered in reverse order, so unit u holds component ncomp - 1 - u.
+    size = calloc(ncomp, sizeof(int));
+    unit = calloc(ncomp, sizeof(FsUnit));
+    level = calloc(ncomp, sizeof(int));
+    if(size == NULL || unit == NULL || level == NULL)
+    {
+        FsGraphFree(&gr);
+        free(active);
+        free(torn);
+        free(all);
+        free(size);
+        free(unit);
+        free(level);
+        return -1;
+    }
+    for(int v = 0; v < nb; ++v)
+    {
+        ++size[ncomp - 1 - gr.comp[v]];
+    }
+    for(int u = 0; u < ncomp; ++u)
+    {
+        unit[u].block = malloc(size[u]*sizeof(int));
+        unit[u].status = gr.cyclic[ncomp - 1 - u];     // Held temporarily until the tears are chosen.
+    }
+    for(int v = 0; v < nb; ++v)
+    {
+        FsUnit *un = &unit[ncomp - 1 - gr.comp[v]];
+        
+        un->block[un->nblocks++] = v;
+    }
+    
+    //  Levels of the units by the longest path through the sequence
+    fs->nlevels = 0;
+    for(int u = 0; u < ncomp; ++u)
+    {
+        fs->nlevels = (level[u] + 1 > fs->nlevels) ? level[u] + 1 : fs->nlevels;
+        for(int k = 0; k < unit[u].nblocks; ++k)
+        {
+            const FsBlock *b = &fs->block[unit[u].block[k]];
+            
+            for(int p = 0; p < b->nout; ++p)
+            {
+                int w = fs->stream[b->out[p]].sink;
+                int uw = 0;
+                
+                if(w < 0)
+                {
+                    continue;
+                }
+                uw = ncomp - 1 - gr.comp[w];
+                if(uw != u && level[u] + 1 > level[uw])
+                {
+                    level[uw] = level[u] + 1;
+                }
+            }
+        }
+    }
+    
+    //  Tear streams and calculation order within each unit
+    memset(active, 0, nb);
+    for(int u = 0; u < ncomp; ++u)
+    {
+        for(int k = 0; k < unit[u].nblocks; ++k)
+        {
+            active[unit[u].block[k]] = 1;
+        }
+        if(unit[u].status)
+        {
+            FsSelectTears(fs, &unit[u], active, torn, &gr);
+            ntear += unit[u].ntear;
+        }
+        unit[u].status = 0;
+        FsLevels(fs, active, torn, &unit[u], &gr);
+        for(int k = 0; k < unit[u].nblocks; ++k)
+        {
+            active[unit[u].block[k]] = 0;
+        }
+    }
+    
+    //  Counting sort of the units by level
+    order = calloc(fs->nlevels + 1, sizeof(int));
+    fs->levelstart = calloc(fs->nlevels + 1, sizeof(int));
+    fs->unit = malloc(ncomp*sizeof(FsUnit));
+    fs->nunits = ncomp;
+    for(int u = 0; u < ncomp; ++u)
+    {
+        ++order[level[u] + 1];
+    }
+    for(int l = 0; l < fs->nlevels; ++l)
+    {
+        order[l + 1] += order[l];
+        fs->levelstart[l + 1] = order[l + 1];
+    }
+    for(int u = 0; u < ncomp; ++u)
+    {
+        fs->unit[order[level[u]]++] = unit[u];
+    }
+    
+    FsGraphFree(&gr);
+    free(active);
+    free(torn);
+    free(all);
+    free(size);
+    free(level);
+    free(order);
+    free(unit);
+    
+    return ntear;
+}
+
+/// MARK: CALCULATION
+/// This subroutine is used to calculate the blocks on one level of a unit.
+static void FsBlockKernel(int start, int end, void *context)
+{
+    FsLevelContext *ctx = context;
+    const FsUnit *unit = ctx->unit;
+    
+    for(int k = start; k < end; ++k)
+    {
+        FsBlock *b = &ctx->fs->block[unit->block[unit->levelstart[ctx->level] + k]];
+        
+        b->model(ctx->fs, b);
+        ++b->nevals;
+    }
+}
+
+/// This subroutine is used to calculate every block of a unit once, level by level.
+static void FsSweep(FsFlowsheet *fs, const FsUnit *unit)
+{
+    FsLevelContext ctx;
+    
+    ctx.fs = fs;
+    ctx.unit = unit;
+    for(int l = 0; l < unit->nlevels; ++l)
+    {
+        int count = unit->levelstart[l + 1] - unit->levelstart[l];
+        
+        //  Narrow levels are calculated directly, avoiding the thread count query inside the recycle iterations.
+        ctx.level = l;
+        if(count < 2*blockgrain)
+        {
+            FsBlockKernel(0, count, &ctx);
+        }else{
+            parallelFor(count, blockgrain, FsBlockKernel, &ctx);
+        }
+    }
+}
+
+/// This subroutine is used to gather the component flowrates, temperature and pressure of a stream into the tear vector.
+static void FsPack(const FsFlowsheet *fs, const FsStream *s, double *v)
+{
+    for(int i = 0; i < fs->ncomp; ++i)
+    {
+        v[i] = s->F*s->x[i];
+    }
+    v[fs->ncomp] = s->T;
+    v[fs->ncomp + 1] = s->P;
+}
+
+/// This subroutine is used to set a stream from a slice of the tear vector. Negative flowrates, temperatures and pressures are clipped.
+static void FsUnpack(const FsFlowsheet *fs, const double *v, FsStream *s)
+{
+    double F = 0.0;
+    
+    for(int i = 0; i < fs->ncomp; ++i)
+    {
+        F += fmax(v[i], 0.0);
+    }
+    if(F > 0)
+    {
+        for(int i = 0; i < fs->ncomp; ++i)
+        {
+            s->x[i] = fmax(v[i], 0.0)/F;
+        }
+    }
+    s->F = F;
+    s->T = fmax(v[fs->ncomp], 1.0);
+    s->P = fmax(v[fs->ncomp + 1], 1.0);
+}
+
+/// This subroutine is used to converge a recycle loop. Each iteration sets the tear streams from the current estimate, calculates the loop and compares the recalculated tear streams, which the source blocks write to shadow streams, with the estimate.
+/// @param fs Flowsheet description.
+/// @param unit Recycle loop.
+/// @param opt Convergence settings.
+/// @param shadow Position in the stream array of the first shadow stream of the loop.
+static void FsConverge(FsFlowsheet *fs, FsUnit *unit, const FsOptions *opt, int shadow)
+{
+    int nc = fs->ncomp + 2;     // Variables per tear stream.
+    int nv = unit->ntear*nc;
+    double *x = malloc(nv*sizeof(double));
+    double *gx = malloc(nv*sizeof(double));
+    double *xold = malloc(nv*sizeof(double));
+    double *gold = malloc(nv*sizeof(double));
+    double *scale = malloc(nv*sizeof(double));
+    double *H = NULL;           // Inverse Jacobian estimate for Broyden's method (scaled variables).
+    double *Hdf = NULL;
+    double *dxH = NULL;
+    
+    if(opt->method == FsBroyden)
+    {
+        H = calloc((size_t)nv*nv, sizeof(double));
+        Hdf = malloc(nv*sizeof(double));
+        dxH = malloc(nv*sizeof(double));
+    }
+    if(x == NULL || gx == NULL || xold == NULL || gold == NULL || scale == NULL || (opt->method == FsBroyden && (H == NULL || Hdf == NULL || dxH == NULL)))
+    {
+        unit->status = -2;
+        unit->iter = 0;
+        unit->err = 0.0;
+        free(x);
+        free(gx);
+        free(xold);
+        free(gold);
+        free(scale);
+        free(H);
+        free(Hdf);
+        free(dxH);
+        return;
+    }
+    
+    for(int t = 0; t < unit->ntear; ++t)
+    {
+        FsPack(fs, &fs->stream[unit->tear[t]], &x[t*nc]);
+    }
+    unit->status = -1;
+    unit->err = 0.0;
+    for(unit->iter = 1; unit->iter <= opt->maxiter; ++unit->iter)
+    {
+        for(int t = 0; t < unit->ntear; ++t)
+        {
+            FsUnpack(fs, &x[t*nc], &fs->stream[unit->tear[t]]);
+        }
+        FsSweep(fs, unit);
+        for(int t = 0; t < unit->ntear; ++t)
+        {
+            FsPack(fs, &fs->stream[shadow + t], &gx[t*nc]);
+        }
+        
+        //  Scaled change in the tear streams. Flowrates are scaled by the total tear flow.
+        unit->err = 0.0;
+        for(int t = 0; t < unit->ntear; ++t)
+        {
+            double Ft = 0.0;
+            
+            for(int i = 0; i < fs->ncomp; ++i)
+            {
+                Ft += fabs(gx[t*nc + i]);
+            }
+            for(int i = 0; i < nc; ++i)
+            {
+                double ref = (i < fs->ncomp) ? Ft : fabs(gx[t*nc + i]);
+                double e = fabs(gx[t*nc + i] - x[t*nc + i])/fmax(ref, 1e-10);
+                
+                unit->err = (e > unit->err) ? e : unit->err;
+            }
+            if(unit->iter == 1)
+            {
+                for(int i = 0; i < nc; ++i)
+                {
+                    scale[t*nc + i] = fmax((i < fs->ncomp) ? Ft : fabs(gx[t*nc + i]), 1e-10);
+                }
+            }
+        }
+        if(unit->err < opt->tol)
+        {
+            unit->status = 0;
+            break;
+        }
+        
+        if(opt->method == FsBroyden)
+        {
+            //  Broyden's update of the inverse Jacobian of f(x) = g(x) - x, starting from the direct substitution estimate H = -I.
+            if(unit->iter == 1)
+            {
+                for(int i = 0; i < nv; ++i)
+                {
+                    H[(size_t)i*nv + i] = -1.0;
+                }
+            }else{
+                double denom = 0.0;
+                
+                for(int i = 0; i < nv; ++i)
+                {
+                    Hdf[i] = 0.0;
+                    for(int j = 0; j < nv; ++j)
+                    {
+                        double df = ((gx[j] - x[j]) - (gold[j] - xold[j]))/scale[j];
+                        
+                        Hdf[i] += H[(size_t)i*nv + j]*df;
+                    }
+                }
+                for(int j = 0; j < nv; ++j)
+                {
+                    dxH[j] = 0.0;
+                    for(int i = 0; i < nv; ++i)
+                    {
+                        dxH[j] += (x[i] - xold[i])/scale[i]*H[(size_t)i*nv + j];
+                    }
+                    denom += dxH[j]*((gx[j] - x[j]) - (gold[j] - xold[j]))/scale[j];
+                }
+                if(fabs(denom) > 1e-30)
+                {
+                    for(int i = 0; i < nv; ++i)
+                    {
+                        double u = ((x[i] - xold[i])/scale[i] - Hdf[i])/denom;
+                        
+                        for(int j = 0; j < nv; ++j)
+                        {
+                            H[(size_t)i*nv + j] += u*dxH[j];
+                        }
+                    }
+                }else{
+                    memset(H, 0, (size_t)nv*nv*sizeof(double));
+                    for(int i = 0; i < nv; ++i)
+                    {
+                        H[(size_t)i*nv + i] = -1.0;
+                    }
+                }
+            }
+            memcpy(xold, x, nv*sizeof(double));
+            memcpy(gold, gx, nv*sizeof(double));
+            for(int i = 0; i < nv; ++i)
+            {
+                double step = 0.0;
+                
+                for(int j = 0; j < nv; ++j)
+                {
+                    step -= H[(size_t)i*nv + j]*(gold[j] - xold[j])/scale[j];
+                }
+                x[i] = xold[i] + step*scale[i];
+            }
+        }else{
+            //  Bounded Wegstein acceleration, x = q x + (1 - q) g(x), with direct substitution on the first iteration.
+            for(int i = 0; i < nv; ++i)
+            {
+                double xi = gx[i];
+                
+                if(unit->iter > 1 && fabs(x[i] - xold[i]) > 1e-12*scale[i])
+                {
+                    double s = (gx[i] - gold[i])/(x[i] - xold[i]);
+                    double q = (s != 1.0) ? s/(s - 1) : opt->qmin;
+                    
+                    q = fmin(fmax(q, opt->qmin), opt->qmax);
+                    xi = q*x[i] + (1 - q)*gx[i];
+                }
+                xold[i] = x[i];
+                gold[i] = gx[i];
+                x[i] = xi;
+            }
+        }
+    }
+    if(unit->iter > opt->maxiter)
+    {
+        unit->iter = opt->maxiter;
+    }
+    
+    //  The tear streams take their recalculated values.
+    for(int t = 0; t < unit->ntear; ++t)
+    {
+        FsStream *s = &fs->stream[unit->tear[t]];
+        
+        FsUnpack(fs, &gx[t*nc], s);
+    }
+    
+    free(x);
+    free(gx);
+    free(xold);
+    free(gold);
+    free(scale);
+    free(H);
+    free(Hdf);
+    free(dxH);
+}
+
+/// This subroutine is used to calculate the units on one level of the sequence.
+static void FsUnitKernel(int start, int end, void *context)
+{
+    FsUnitContext *ctx = context;
+    
+    for(int k = start; k < end; ++k)
+    {
+        int u = ctx->fs->levelstart[ctx->level] + k;
+        FsUnit *unit = &ctx->fs->unit[u];
+        
+        if(unit->ntear > 0)
+        {
+            FsConverge(ctx->fs, unit, ctx->opt, ctx->shadow[u]);
+        }else{
+            FsSweep(ctx->fs, unit);
+            unit->status = 0;
+        }
+    }
+}
+
+int FsSolve(FsFlowsheet *fs, const FsOptions *opt)
+{
+    FsUnitContext ctx;
+    FsStream *stream = NULL;
+    int *shadow = NULL;
+    int nshadow = 0;
+    int status = 0;
+    
+    if(fs->unit == NULL && FsSequence(fs) < 0)
+    {
+        return -1;
+    }
+    for(int b = 0; b < fs->nblocks; ++b)
+    {
+        fs->block[b].nevals = 0;
+    }
+    
+    //  Redirecting the source of each tear stream to a shadow stream stored after the flowsheet streams
+    shadow = malloc((fs->nunits + 1)*sizeof(int));
+    if(shadow == NULL)
+    {
+        return -2;
+    }
+    for(int u = 0; u < fs->nunits; ++u)
+    {
+        shadow[u] = fs->nstreams + nshadow;
+        nshadow += fs->unit[u].ntear;
+    }
+    stream = realloc(fs->stream, (fs->nstreams + nshadow + 1)*sizeof(FsStream));
+    if(stream == NULL)
+    {
+        free(shadow);
+        return -2;
+    }
+    fs->stream = stream;
+    for(int u = 0; u < fs->nunits; ++u)
+    {
+        for(int t = 0; t < fs->unit[u].ntear; ++t)
+        {
+            int s = fs->unit[u].tear[t];
+            FsBlock *b = &fs->block[fs->stream[s].source];
+            
+            fs->stream[shadow[u] + t] = fs->stream[s];
+            for(int p = 0; p < b->nout; ++p)
+            {
+                if(b->out[p] == s)
+                {
+                    b->out[p] = shadow[u] + t;
+                }
+            }
+        }
+    }
+    
+    ctx.fs = fs;
+    ctx.opt = opt;
+    ctx.shadow = shadow;
+    for(int l = 0; l < fs->nlevels; ++l)
+    {
+        ctx.level = l;
+        parallelFor(fs->levelstart[l + 1] - fs->levelstart[l], 1, FsUnitKernel, &ctx);
+    }
+    
+    //  Restoring the tear streams
+    for(int u = 0; u < fs->nunits; ++u)
+    {
+        for(int t = 0; t < fs->unit[u].ntear; ++t)
+        {
+            int s = fs->unit[u].tear[t];
+            FsBlock *b = &fs->block[fs->stream[s].source];
+            
+            for(int p = 0; p < b->nout; ++p)
+            {
+                if(b->out[p] == shadow[u] + t)
+                {
+                    b->out[p] = s;
+                }
+            }
+        }
+        if(fs->unit[u].status == -2){
+            status = -2;
+        }else if(fs->unit[u].status != 0 && status == 0){
+            status = -1;
+        }
+    }
+    
+    free(shadow);
+    
+    return status;
+}
@@ -0,0 +1,183 @@
+//
+//  FlowsheetSolver.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef FlowsheetSolverStruct_h
+#define FlowsheetSolverStruct_h
+
+#define FsWegstein 1        // Bounded Wegstein acceleration of each tear variable.
+#define FsBroyden 2         // Broyden's quasi-Newton method on the full tear vector.
+
+#define FsMaxComp 8         // Largest number of components in a flowsheet.
+#define FsMaxPorts 4        // Largest number of inlets or outlets of a single block.
+
+typedef struct FsFlowsheet FsFlowsheet;
+typedef struct FsBlock FsBlock;
+
+/// Function pointer type used to describe a unit operation. The model reads the streams listed in "block->in" and must only write the streams listed in "block->out" together with the results held in the block itself.
+typedef void (*FsBlockModel)(FsFlowsheet *fs, FsBlock *block);
+
+typedef struct FsComponent{
+    char name[16];              // Component name.
+    double Mw;                  // Molar mass (kg/mol).
+    double cp;                  // Molar heat capacity at constant pressure (J/mol.K).
+    double rho;                 // Liquid density (kg/m3). Zero or negative values treat the component as an ideal gas.
+} FsComponent;
+
+typedef struct FsStream{
+    char name[16];              // Stream name.
+    double F;                   // Molar flowrate (mol/s).
+    double T;                   // Temperature (K).
+    double P;                   // Pressure (Pa).
+    double x[FsMaxComp];        // Mole fractions ([ ]).
+    int source;                 // Block producing the stream (-1 for a feed).
+    int sink;                   // Block consuming the stream (-1 for a product).
+} FsStream;
+
+struct FsBlock{
+    char name[16];              // Block name.
+    FsBlockModel model;         // Unit operation.
+    void *params;               // Unit parameters passed to the model.
+    int nin;                    // Number of inlet streams.
+    int in[FsMaxPorts];         // Inlet streams.
+    int nout;                   // Number of outlet streams.
+    int out[FsMaxPorts];        // Outlet streams.
+    double duty;                // Heat added to the process fluid (W).
+    double work;                // Shaft work done on the process fluid (W).
+    int nevals;                 // Number of times the block has been calculated.
+};
+
+typedef struct FsUnit{
+    int nblocks;                // Number of blocks in the unit. Units holding more than one block are recycle loops.
+    int *block;                 // Blocks in calculation order.
+    int nlevels;                // Number of calculation levels within the unit. Blocks on the same level are independent.
+    int *levelstart;            // Position in "block" of the first block of each level (nlevels + 1 entries).
+    int ntear;                  // Number of tear streams.
+    int *tear;                  // Tear streams.
+    int iter;                   // Iterations taken to converge the loop.
+    double err;                 // Final scaled change in the tear streams.
+    int status;                 // Converged (0), iteration limit reached (-1) or work arrays not allocated (-2).
+} FsUnit;
+
+struct FsFlowsheet{
+    int ncomp;                  // Number of components.
+    FsComponent comp[FsMaxComp];// Component properties.
+    int nstreams;               // Number of streams.
+    FsStream *stream;           // Array of streams.
+    int nblocks;                // Number of blocks.
+    FsBlock *block;             // Array of blocks.
+    int nunits;                 // Number of units in the calculation sequence.
+    FsUnit *unit;               // Single blocks and recycle loops in calculation order.
+    int nlevels;                // Number of levels in the calculation sequence. Units on the same level are independent.
+    int *levelstart;            // Position in "unit" of the first unit of each level (nlevels + 1 entries).
+};
+
+typedef struct FsOptions{
+    int method;                 // Tear stream acceleration (FsWegstein or FsBroyden).
+    double tol;                 // Convergence tolerance on the scaled change in the tear streams.
+    int maxiter;                // Largest number of iterations for each recycle loop.
+    double qmin;                // Lower bound on the Wegstein acceleration factor.
+    double qmax;                // Upper bound on the Wegstein acceleration factor.
+} FsOptions;
+
+#endif /* FlowsheetSolverStruct_h */
+
+#ifndef FlowsheetSolverBuild_h
+#define FlowsheetSolverBuild_h
+
+/// This subroutine is used to register the components of the flowsheet. This function returns the index of the component.
+/// @param fs Flowsheet description.
+/// @param name Component name.
+/// @param Mw Molar mass (kg/mol).
+/// @param cp Molar heat capacity at constant pressure (J/mol.K).
+/// @param rho Liquid density (kg/m3). Zero treats the component as an ideal gas.
+int FsAddComponent(FsFlowsheet *fs, const char *name, double Mw, double cp, double rho);
+
+/// This subroutine is used to register a stream. Streams start with no flow at 25 deg C and 1 atm. This function returns the index of the stream.
+/// @param fs Flowsheet description.
+/// @param name Stream name.
+int FsAddStream(FsFlowsheet *fs, const char *name);
+
+/// This subroutine is used to register a unit operation. This function returns the index of the block.
+/// @param fs Flowsheet description.
+/// @param name Block name.
+/// @param model Unit operation.
+/// @param params Unit parameters passed to the model.
+int FsAddBlock(FsFlowsheet *fs, const char *name, FsBlockModel model, void *params);
+
+/// This subroutine is used to connect a stream to an inlet of a block.
+/// @param fs Flowsheet description.
+/// @param block Index of the block.
+/// @param stream Index of the stream.
+void FsBlockInlet(FsFlowsheet *fs, int block, int stream);
+
+/// This subroutine is used to connect a stream to an outlet of a block.
+/// @param fs Flowsheet description.
+/// @param block Index of the block.
+/// @param stream Index of the stream.
+void FsBlockOutlet(FsFlowsheet *fs, int block, int stream);
+
+/// This subroutine is used to set the flowrate, temperature, pressure and composition of a stream. The mole fractions are normalised.
+/// @param fs Flowsheet description.
+/// @param stream Index of the stream.
+/// @param F Molar flowrate (mol/s).
+/// @param T Temperature (K).
+/// @param P Pressure (Pa).
+/// @param x Mole fractions ([ ]).
+void FsSetStream(FsFlowsheet *fs, int stream, double F, double T, double P, const double *x);
+
+/// This subroutine is used to release the arrays allocated for a flowsheet. Block parameters belong to the caller.
+/// @param fs Flowsheet description.
+void FsFlowsheetFree(FsFlowsheet *fs);
+
+#endif /* FlowsheetSolverBuild_h */
+
+#ifndef FlowsheetSolverProperties_h
+#define FlowsheetSolverProperties_h
+
+/// This subroutine is used to calculate the molar mass of a stream (kg/mol).
+/// @param fs Flowsheet description.
+/// @param s Stream.
+double FsMolarMass(const FsFlowsheet *fs, const FsStream *s);
+
+/// This subroutine is used to calculate the molar heat capacity of a stream (J/mol.K).
+/// @param fs Flowsheet description.
+/// @param s Stream.
+double FsHeatCapacity(const FsFlowsheet *fs, const FsStream *s);
+
+/// This subroutine is used to calculate the density of a stream (kg/m3) assuming ideal mixing. Gaseous components follow the ideal gas law.
+/// @param fs Flowsheet description.
+/// @param s Stream.
+double FsDensity(const FsFlowsheet *fs, const FsStream *s);
+
+#endif /* FlowsheetSolverProperties_h */
+
+#ifndef FlowsheetSolverSequence_h
+#define FlowsheetSolverSequence_h
+
+/// This subroutine is used to find the calculation sequence. Recycle loops are found as the strongly connected components of the block graph, and tear streams are chosen greedily within each loop so that every cycle is broken. Single blocks and loops are then grouped into levels; units on the same level do not depend on each other. This function returns the total number of tear streams, or -1 if the work arrays could not be allocated.
+/// @param fs Flowsheet description.
+int FsSequence(FsFlowsheet *fs);
+
+/// This subroutine is used to calculate the flowsheet following the sequence from "FsSequence(...)". Independent units on each level are calculated in parallel, and each recycle loop is converged on its tear streams. This function returns 0 if every loop converged, -1 if a loop reached the iteration limit and -2 if memory could not be allocated.
+/// @param fs Flowsheet description.
+/// @param opt Convergence settings.
+int FsSolve(FsFlowsheet *fs, const FsOptions *opt);
+
+#endif /* FlowsheetSolverSequence_h */
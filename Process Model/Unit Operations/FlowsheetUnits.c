@@ -0,0 +1,845 @@
+//
+//  FlowsheetUnits.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+/// MARK: HEADER DECLARATIONS
+//Standard Header Files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//Custom Header Files
+#include "System.h"
+#include "ResultWriter.h"
+#include "DimensionlessNum.h"
+#include "02bPolyShaftWork.h"
+#include "03aFrictFactor.h"
+#include "03bGenPressureLoss.h"
+#include "03bFilmHTCoefficient.h"
+#include "04bPumpSizing.h"
+#include "06bEquilibriumConversion.h"
+#include "06cEquilibriumConstant.h"
+#include "FlowsheetSolver.h"
+#include "UnitOps.h"
+#include "FlowsheetUnits.h"
+
+/// MARK: SUBROUTINE DEFINITIONS
+#define maxstrlen 128
+#define g 9.80665
+#define PI 3.14159265358979323846
+#define R 8.3145
+#define Tref 298.15         // Reference temperature for stream enthalpies (K).
+
+/// This subroutine is used to copy the composition, temperature and pressure of one stream into another without changing its flowrate.
+static void FsCopyState(const FsFlowsheet *fs, const FsStream *in, FsStream *out)
+{
+    memcpy(out->x, in->x, fs->ncomp*sizeof(double));
+    out->T = in->T;
+    out->P = in->P;
+}
+
+/// MARK: UNIT MODELS
+void FsMixerModel(FsFlowsheet *fs, FsBlock *block)
+{
+    FsStream *out = &fs->stream[block->out[0]];
+    double n[FsMaxComp] = {0};
+    double H = 0.0;         // Enthalpy flow relative to the reference temperature (W).
+    double F = 0.0;
+    double P = 0.0;
+    
+    for(int k = 0; k < block->nin; ++k)
+    {
+        const FsStream *in = &fs->stream[block->in[k]];
+        
+        for(int i = 0; i < fs->ncomp; ++i)
+        {
+            n[i] += in->F*in->x[i];
+        }
+        H += in->F*FsHeatCapacity(fs, in)*(in->T - Tref);
+        F += in->F;
+        P = (k == 0 || in->P < P) ? in->P : P;
+    }
+    
+    out->F = F;
+    out->P = P;
+    if(F > 0)
+    {
+        for(int i = 0; i < fs->ncomp; ++i)
+        {
+            out->x[i] = n[i]/F;
+        }
+        out->T = Tref + H/(F*FsHeatCapacity(fs, out));
+    }
+    block->duty = 0.0;
+    block->work = 0.0;
+}
+
+void FsSplitterModel(FsFlowsheet *fs, FsBlock *block)
+{
+    const FsSplitter *split = block->params;
+    const FsStream *in = &fs->stream[block->in[0]];
+    double rest = 1.0;
+    
+    for(int k = 0; k < block->nout; ++k)
+    {
+        FsStream *out = &fs->stream[block->out[k]];
+        double frac = (k < block->nout - 1) ? split->frac[k] : rest;
+        
+        FsCopyState(fs, in, out);
+        out->F = frac*in->F;
+        rest -= frac;
+    }
+    block->duty = 0.0;
+    block->work = 0.0;
+}
+
+void FsCompressorModel(FsFlowsheet *fs, FsBlock *block)
+{
+    const FsCompressor *comp = block->params;
+    const FsStream *in = &fs->stream[block->in[0]];
+    FsStream *out = &fs->stream[block->out[0]];
+    double cp = FsHeatCapacity(fs, in);
+    
+    FsCopyState(fs, in, out);
+    out->F = in->F;
+    out->P = comp->P2;
+    if(comp->alpha == 1.0)
+    {
+        block->work = IdealShaftCalculation(in->F, R, in->T, in->P, comp->P2);
+    }else{
+        out->T = in->T*pow(comp->P2/in->P, (comp->alpha - 1)/comp->alpha);
+        block->work = PolyShaftCalculation(in->F, R, in->T, in->P, comp->P2, comp->alpha);
+    }
+    
+    //  Heat removed by the casing or jacket
+    block->duty = in->F*cp*(out->T - in->T) - block->work;
+}
+
+void FsPumpModel(FsFlowsheet *fs, FsBlock *block)
+{
+    const FsPump *pump = block->params;
+    const FsStream *in = &fs->stream[block->in[0]];
+    FsStream *out = &fs->stream[block->out[0]];
+    double rho = FsDensity(fs, in);
+    double Q = in->F*FsMolarMass(fs, in)/rho;
+    double dP = 0.0;
+    
+    dP = PumpPressureCalculation(rho, pump->head);
+    block->work = PumpPower(dP, Q, pump->eta);
+    block->duty = 0.0;
+    
+    FsCopyState(fs, in, out);
+    out->F = in->F;
+    out->P = in->P + dP;
+    if(in->F > 0)
+    {
+        out->T = in->T + (block->work - dP*Q)/(in->F*FsHeatCapacity(fs, in));
+    }
+}
+
+void FsHeaterModel(FsFlowsheet *fs, FsBlock *block)
+{
+    FsHeater *heater = block->params;
+    const FsStream *in = &fs->stream[block->in[0]];
+    FsStream *out = &fs->stream[block->out[0]];
+    double Mw = FsMolarMass(fs, in);
+    double cp = FsHeatCapacity(fs, in);
+    double rho = FsDensity(fs, in);
+    double u = 0.0;
+    double Re = 0.0;
+    double Pr = 0.0;
+    double Nu = 0.0;
+    double hi = 0.0;
+    double A = heater->ntubes*PI*heater->d*heater->L;
+    
+    FsCopyState(fs, in, out);
+    out->F = in->F;
+    heater->U = 0.0;
+    block->work = 0.0;
+    block->duty = 0.0;
+    if(in->F <= 0)
+    {
+        return;
+    }
+    
+    //  Tube-side film coefficient at the present flowrate
+    u = in->F*Mw/rho;
+    u = (u)/(heater->ntubes*PI*heater->d*heater->d/4);
+    Re = ReynoldsNum(rho, u, heater->d, heater->mu);
+    Pr = PrandtlNum(cp/Mw, heater->mu, heater->k);
+    hi = DittusBoelter((heater->Tu > in->T) ? 1 : 2, Re, Pr, heater->k, heater->d, &Nu);
+    if(hi > 0)
+    {
+        heater->U = 1/(1/hi + 1/heater->ho);
+    }
+    
+    //  Outlet temperature for a utility at constant temperature
+    out->T = heater->Tu - (heater->Tu - in->T)*exp(-heater->U*A/(in->F*cp));
+    block->duty = in->F*cp*(out->T - in->T);
+}
+
+void FsPipeModel(FsFlowsheet *fs, FsBlock *block)
+{
+    FsPipe *pipe = block->params;
+    const FsStream *in = &fs->stream[block->in[0]];
+    FsStream *out = &fs->stream[block->out[0]];
+    double rho = FsDensity(fs, in);
+    double u = 0.0;
+    double Re = 0.0;
+    double phi = 0.0;
+    
+    pipe->dP = rho*g*pipe->dz;
+    if(in->F > 0)
+    {
+        u = in->F*FsMolarMass(fs, in)/rho;
+        u = (u)/(PI*pipe->d*pipe->d/4);
+        Re = ReynoldsNum(rho, u, pipe->d, pipe->mu);
+        phi = FrictFactorSolve(Re, pipe->vareps/pipe->d);
+        pipe->dP += LossCalculation(phi, pipe->L, pipe->d, rho, u);
+    }
+    
+    FsCopyState(fs, in, out);
+    out->F = in->F;
+    out->P = in->P - pipe->dP;
+    block->duty = 0.0;
+    block->work = 0.0;
+}
+
+/// This subroutine is used to calculate the equilibrium residual of a reaction at a given extent. The residual increases with the extent.
+static double FsReactorResidual(int ncomp, const double *n0, const double *nu, double dnu, double lnKP, double P, double EoR)
+{
+    double ntot = 0.0;
+    double f = 0.0;
+    
+    for(int i = 0; i < ncomp; ++i)
+    {
+        double n = n0[i] + nu[i]*EoR;
+        
+        ntot += n;
+        if(nu[i] != 0)
+        {
+            f += nu[i]*log(n);
+        }
+    }
+    f += dnu*(log(P) - log(ntot));
+    
+    return f - lnKP;
+}
+
+void FsReactorModel(FsFlowsheet *fs, FsBlock *block)
+{
+    FsReactor *rx = block->params;
+    const FsStream *in = &fs->stream[block->in[0]];
+    FsStream *out = &fs->stream[block->out[0]];
+    double n0[FsMaxComp] = {0};
+    double dnu = 0.0;
+    double lo = -INFINITY;
+    double hi = INFINITY;
+    double KP = 0.0;
+    double F = 0.0;
+    
+    FsCopyState(fs, in, out);
+    out->T = rx->T;
+    for(int i = 0; i < fs->ncomp; ++i)
+    {
+        n0[i] = in->F*in->x[i];
+        dnu += rx->nu[i];
+        
+        //  Extents at which a species is used up
+        if(rx->nu[i] < 0)
+        {
+            hi = fmin(hi, -n0[i]/rx->nu[i]);
+        }
+        if(rx->nu[i] > 0)
+        {
+            lo = fmax(lo, -n0[i]/rx->nu[i]);
+        }
+    }
+    rx->K = VantHoffCalculation(rx->h_rxn, rx->K1, rx->T1, rx->T);
+    KP = KPCalculation(rx->Pref, dnu, rx->K);
+    rx->EoR = 0.0;
+    
+    //  Bisection on the monotonic residual between the two limits
+    if(in->F > 0 && isfinite(lo) && isfinite(hi) && hi > lo)
+    {
+        double a = lo;
+        double b = hi;
+        
+        for(int it = 0; it < 200 && b - a > 1e-15*fmax(fabs(a) + fabs(b), 1e-300); ++it)
+        {
+            double mid = 0.5*(a + b);
+            
+            if(FsReactorResidual(fs->ncomp, n0, rx->nu, dnu, log(KP), in->P, mid) > 0)
+            {
+                b = mid;
+            }else{
+                a = mid;
+            }
+        }
+        rx->EoR = 0.5*(a + b);
+    }
+    
+    for(int i = 0; i < fs->ncomp; ++i)
+    {
+        n0[i] += rx->nu[i]*rx->EoR;
+        F += n0[i];
+    }
+    out->F = F;
+    if(F > 0)
+    {
+        for(int i = 0; i < fs->ncomp; ++i)
+        {
+            out->x[i] = fmax(n0[i], 0.0)/F;
+        }
+    }
+    rx->conv = (in->x[rx->key] > 0) ? EquiConvCalc2(rx->nu[rx->key], rx->EoR, in->F*in->x[rx->key]) : 0.0;
+    
+    block->work = 0.0;
+    block->duty = rx->EoR*rx->h_rxn + out->F*FsHeatCapacity(fs, out)*(out->T - Tref) - in->F*FsHeatCapacity(fs, in)*(in->T - Tref);
+}
+
+/// MARK: VARIABLE INPUT
+/// This subroutine is used to ask for a stream number until a stream that is free at the requested end is given. This function returns the index of the stream.
+/// @param fs Flowsheet description.
+/// @param prompt Description of the connection.
+/// @param inlet Stream enters the block (1) or leaves it (0).
+static int FsStreamInput(const FsFlowsheet *fs, const char *prompt, int inlet)
+{
+    int s = 0;
+    
+    while(1)
+    {
+        s = (int)inputDouble(0, 0, (char *)prompt, "");
+        if(s < 1 || s > fs->nstreams)
+        {
+            printf("Streams are numbered 1 to %i.\n", fs->nstreams);
+        }else if((inlet && fs->stream[s - 1].sink >= 0) || (!inlet && fs->stream[s - 1].source >= 0)){
+            printf("Stream %i is already connected.\n", s);
+        }else{
+            return s - 1;
+        }
+    }
+}
+
+/// This subroutine is used to collect the type, connections and design of a single block. This function returns the index of the block.
+static int FsBlockVariable(int scope, FsFlowsheet *fs, int number)
+{
+    char input[maxstrlen];
+    char name[24];      // Long enough for the longest block type followed by any block number.
+    char prompt[maxstrlen];
+    int block = -1;
+    int nin = 1;
+    int nout = 1;
+    
+    while(block < 0)
+    {
+        printf("Block %i. Mixer (1), splitter (2), pump (3), pipe (4), heater or cooler (5)", number);
+        if(scope == FsMajorScope)
+        {
+            printf(", compressor (6), equilibrium reactor (7)");
+        }
+        printf("? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+                snprintf(name, sizeof(name), "Mixer%i", number);
+                block = FsAddBlock(fs, name, FsMixerModel, NULL);
+                nin = (int)inputDouble(0, 0, "number of inlets", "");
+                break;
+            case '2':
+            {
+                FsSplitter *split = calloc(1, sizeof(FsSplitter));
+                
+                snprintf(name, sizeof(name), "Split%i", number);
+                block = FsAddBlock(fs, name, FsSplitterModel, split);
+                nout = (int)inputDouble(0, 0, "number of outlets", "");
+                for(int k = 0; k < nout - 1 && k < FsMaxPorts; ++k)
+                {
+                    snprintf(prompt, sizeof(prompt), "fraction of the inlet sent to outlet %i", k + 1);
+                    split->frac[k] = inputDouble(1, 0, prompt, "[ ]");
+                }
+                break;
+            }
+            case '3':
+            {
+                FsPump *pump = calloc(1, sizeof(FsPump));
+                
+                snprintf(name, sizeof(name), "Pump%i", number);
+                block = FsAddBlock(fs, name, FsPumpModel, pump);
+                pump->head = inputDouble(1, 0, "pump head", "m");
+                pump->eta = inputDouble(0, 0, "pump efficiency", "%");
+                pump->eta = (pump->eta)*0.01; // Conversion (% to [ ])
+                break;
+            }
+            case '4':
+            {
+                FsPipe *pipe = calloc(1, sizeof(FsPipe));
+                
+                snprintf(name, sizeof(name), "Pipe%i", number);
+                block = FsAddBlock(fs, name, FsPipeModel, pipe);
+                pipe->L = inputDouble(0, 0, "pipe length", "m");
+                
+                pipe->d = inputDouble(0, 0, "pipe internal diameter", "mm");
+                pipe->d = (pipe->d)*0.001; // Conversion (mm to m)
+                
+                pipe->vareps = inputDouble(1, 0, "absolute roughness", "mm");
+                pipe->vareps = (pipe->vareps)*0.001;
+                
+                pipe->dz = inputDouble(1, 1, "rise in elevation", "m");
+                
+                pipe->mu = inputDouble(0, 0, "fluid viscosity", "cP");
+                pipe->mu = (pipe->mu)*0.001; // Conversion (cP to Pa.s)
+                break;
+            }
+            case '5':
+            {
+                FsHeater *heater = calloc(1, sizeof(FsHeater));
+                
+                snprintf(name, sizeof(name), "Heater%i", number);
+                block = FsAddBlock(fs, name, FsHeaterModel, heater);
+                heater->Tu = inputDouble(0, 1, "utility temperature", "deg C");
+                heater->Tu = (heater->Tu) + 273.15; // Conversion (deg C to K)
+                
+                heater->ho = inputDouble(0, 0, "utility film coefficient", "W/m2.K");
+                heater->ntubes = (int)inputDouble(0, 0, "number of tubes", "");
+                
+                heater->d = inputDouble(0, 0, "tube internal diameter", "mm");
+                heater->d = (heater->d)*0.001;
+                
+                heater->L = inputDouble(0, 0, "tube length", "m");
+                
+                heater->mu = inputDouble(0, 0, "fluid viscosity", "cP");
+                heater->mu = (heater->mu)*0.001;
+                
+                heater->k = inputDouble(0, 0, "fluid thermal conductivity", "W/m.K");
+                break;
+            }
+            case '6':
+            {
+                FsCompressor *comp = NULL;
+                
+                if(scope != FsMajorScope)
+                {
+                    printf("Input not recognised\n");
+                    break;
+                }
+                comp = calloc(1, sizeof(FsCompressor));
+                snprintf(name, sizeof(name), "Comp%i", number);
+                block = FsAddBlock(fs, name, FsCompressorModel, comp);
+                comp->P2 = inputDouble(0, 0, "discharge pressure", "bar");
+                comp->P2 = (comp->P2)*100000; // Conversion (bar to Pa)
+                
+                comp->alpha = inputDouble(0, 0, "polytropic index (1 for isothermal)", "[ ]");
+                break;
+            }
+            case '7':
+            {
+                FsReactor *rx = NULL;
+                
+                if(scope != FsMajorScope)
+                {
+                    printf("Input not recognised\n");
+                    break;
+                }
+                rx = calloc(1, sizeof(FsReactor));
+                snprintf(name, sizeof(name), "Reactor%i", number);
+                block = FsAddBlock(fs, name, FsReactorModel, rx);
+                rx->key = -1;
+                for(int i = 0; i < fs->ncomp; ++i)
+                {
+                    snprintf(prompt, sizeof(prompt), "stoichiometric coefficient of %s (reagents negative)", fs->comp[i].name);
+                    rx->nu[i] = inputDouble(1, 1, prompt, "[ ]");
+                    if(rx->key < 0 && rx->nu[i] < 0)
+                    {
+                        rx->key = i;
+                    }
+                }
+                rx->key = (rx->key < 0) ? 0 : rx->key;
+                
+                rx->h_rxn = inputDouble(1, 1, "enthalpy change of reaction", "kJ/mol");
+                rx->h_rxn = (rx->h_rxn)*1000; // Conversion (kJ to J)
+                
+                rx->K1 = inputDouble(0, 0, "reference equilibrium constant", "[ ]");
+                
+                rx->T1 = inputDouble(0, 1, "reference equilibrium constant temperature", "deg C");
+                rx->T1 = (rx->T1) + 273.15;
+                
+                rx->T = inputDouble(0, 1, "reactor temperature", "deg C");
+                rx->T = (rx->T) + 273.15;
+                
+                rx->Pref = inputDouble(0, 0, "standard state pressure", "bar");
+                rx->Pref = (rx->Pref)*100000;
+                break;
+            }
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+    
+    //  Connections
+    nin = (nin > FsMaxPorts) ? FsMaxPorts : nin;
+    nout = (nout > FsMaxPorts) ? FsMaxPorts : nout;
+    for(int k = 0; k < nin; ++k)
+    {
+        snprintf(prompt, sizeof(prompt), "%s inlet %i stream number", fs->block[block].name, k + 1);
+        FsBlockInlet(fs, block, FsStreamInput(fs, prompt, 1));
+    }
+    for(int k = 0; k < nout; ++k)
+    {
+        snprintf(prompt, sizeof(prompt), "%s outlet %i stream number", fs->block[block].name, k + 1);
+        FsBlockOutlet(fs, block, FsStreamInput(fs, prompt, 0));
+    }
+    
+    return block;
+}
+
+void FsFlowsheetVariable(int scope, FsFlowsheet *fs, FsOptions *opt)
+{
+    char input[maxstrlen];
+    char name[16];
+    char prompt[maxstrlen];
+    double x[FsMaxComp];
+    int nstreams = 0;
+    int nblocks = 0;
+    int ncomp = 0;
+    int control = 0;
+    
+    //  Components
+    ncomp = (int)inputDouble(0, 0, "number of components", "");
+    ncomp = (ncomp > FsMaxComp) ? FsMaxComp : ncomp;
+    for(int i = 0; i < ncomp; ++i)
+    {
+        double Mw = 0.0;
+        double cp = 0.0;
+        double rho = 0.0;
+        
+        printf("Component %i name: ", i + 1);
+        fgets(input, sizeof(input), stdin);
+        input[strcspn(input, "\r\n")] = '\0';
+        
+        Mw = inputDouble(0, 0, "molar mass", "g/mol");
+        Mw = (Mw)*0.001; // Conversion (g/mol to kg/mol)
+        
+        cp = inputDouble(0, 0, "molar heat capacity", "J/mol.K");
+        rho = inputDouble(1, 0, "liquid density (0 for a gas)", "kg/m3");
+        FsAddComponent(fs, input, Mw, cp, rho);
+    }
+    
+    //  Streams and blocks
+    nstreams = (int)inputDouble(0, 0, "number of streams", "");
+    for(int s = 0; s < nstreams; ++s)
+    {
+        snprintf(name, sizeof(name), "S%i", s + 1);
+        FsAddStream(fs, name);
+    }
+    nblocks = (int)inputDouble(0, 0, "number of blocks", "");
+    for(int b = 0; b < nblocks; ++b)
+    {
+        FsBlockVariable(scope, fs, b + 1);
+    }
+    
+    //  Feeds
+    for(int s = 0; s < fs->nstreams; ++s)
+    {
+        double F = 0.0;
+        double T = 0.0;
+        double P = 0.0;
+        
+        if(fs->stream[s].source >= 0)
+        {
+            continue;
+        }
+        printf("Feed stream %s.\n", fs->stream[s].name);
+        F = inputDouble(1, 0, "molar flowrate", "mol/s");
+        
+        T = inputDouble(0, 1, "temperature", "deg C");
+        T = (T) + 273.15; // Conversion (deg C to K)
+        
+        P = inputDouble(0, 0, "pressure", "bar");
+        P = (P)*100000; // Conversion (bar to Pa)
+        
+        for(int i = 0; i < fs->ncomp; ++i)
+        {
+            snprintf(prompt, sizeof(prompt), "mole fraction of %s", fs->comp[i].name);
+            x[i] = inputDouble(1, 0, prompt, "[ ]");
+        }
+        FsSetStream(fs, s, F, T, P, x);
+    }
+    
+    //  Convergence
+    control = 1;
+    while(control == 1)
+    {
+        printf("Recycle acceleration: Wegstein (1) or Broyden (2)? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+                opt->method = FsWegstein;
+                control = 0;
+                break;
+            case '2':
+                opt->method = FsBroyden;
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+    opt->tol = inputDouble(0, 0, "convergence tolerance", "");
+    opt->maxiter = (int)inputDouble(0, 0, "maximum number of iterations", "");
+    opt->qmin = -5.0;
+    opt->qmax = 0.0;
+}
+
+/// MARK: DISPLAY AND WRITE
+/// This subroutine is used to print the results to a console or file.
+static void FsFlowsheetPrint(ResultWriter *w, const FsFlowsheet *fs, const FsOptions *opt)
+{
+    const char *method[] = {"", "Wegstein", "Broyden"};
+    
+    writerPrintf(w, "_Steady_State_Flowsheet_Results_\n");
+    writerPrintf(w, "Recycle acceleration:\n");
+    writerPrintf(w, "%s\n", method[opt->method]);
+    writerPrintf(w, "Convergence tolerance:\n");
+    writerPrintf(w, "tol =\t%.3g\n\n", opt->tol);
+    
+    writerPrintf(w, "\tCalculation sequence:\n");
+    for(int l = 0; l < fs->nlevels; ++l)
+    {
+        writerPrintf(w, "Level %i:", l + 1);
+        for(int u = fs->levelstart[l]; u < fs->levelstart[l + 1]; ++u)
+        {
+            const FsUnit *unit = &fs->unit[u];
+            
+            writerPrintf(w, (unit->ntear > 0) ? "\t[" : "\t");
+            for(int k = 0; k < unit->nblocks; ++k)
+            {
+                writerPrintf(w, (k > 0) ? " %s" : "%s", fs->block[unit->block[k]].name);
+            }
+            writerPrintf(w, (unit->ntear > 0) ? "]" : "");
+        }
+        writerPrintf(w, "\n");
+    }
+    writerPrintf(w, "\n");
+    
+    for(int u = 0; u < fs->nunits; ++u)
+    {
+        const FsUnit *unit = &fs->unit[u];
+        
+        if(unit->ntear == 0)
+        {
+            continue;
+        }
+        writerPrintf(w, "\tRecycle loop starting at %s:\n", fs->block[unit->block[0]].name);
+        writerPrintf(w, "Tear streams:");
+        for(int t = 0; t < unit->ntear; ++t)
+        {
+            writerPrintf(w, "\t%s", fs->stream[unit->tear[t]].name);
+        }
+        writerPrintf(w, "\n");
+        writerPrintf(w, "Iterations:\t%i\n", unit->iter);
+        writerPrintf(w, "Scaled change in tear streams:\t%.3g\n", unit->err);
+        writerPrintf(w, "%s\n\n", (unit->status == 0) ? "Converged." : "Iteration limit reached.");
+    }
+    
+    writerPrintf(w, "\tBlocks:\n");
+    writerPrintf(w, "Block\tDuty (kW)\tWork (kW)\tEvaluations\tNotes\n");
+    for(int b = 0; b < fs->nblocks; ++b)
+    {
+        const FsBlock *block = &fs->block[b];
+        
+        writerPrintf(w, "%s\t%.4f\t%.4f\t%i\t", block->name, block->duty*0.001, block->work*0.001, block->nevals);
+        if(block->model == FsHeaterModel)
+        {
+            writerPrintf(w, "U = %.2f W/m2.K", ((const FsHeater *)block->params)->U);
+        }
+        if(block->model == FsPipeModel)
+        {
+            writerPrintf(w, "dP = %.4f kPa", ((const FsPipe *)block->params)->dP*0.001);
+        }
+        if(block->model == FsReactorModel)
+        {
+            const FsReactor *rx = block->params;
+            
+            writerPrintf(w, "K = %.4g, conversion of %s = %.4f", rx->K, fs->comp[rx->key].name, rx->conv);
+        }
+        writerPrintf(w, "\n");
+    }
+    writerPrintf(w, "\n");
+    
+    writerPrintf(w, "\tStreams:\n");
+    writerPrintf(w, "Stream\tFrom\tTo\tF (mol/s)\tT (deg C)\tP (bar)");
+    for(int i = 0; i < fs->ncomp; ++i)
+    {
+        writerPrintf(w, "\tx_%s", fs->comp[i].name);
+    }
+    writerPrintf(w, "\n");
+    for(int s = 0; s < fs->nstreams; ++s)
+    {
+        const FsStream *st = &fs->stream[s];
+        
+        writerPrintf(w, "%s\t%s\t%s\t%.6f\t%.3f\t%.5f", st->name, (st->source >= 0) ? fs->block[st->source].name : "Feed", (st->sink >= 0) ? fs->block[st->sink].name : "Product", st->F, st->T - 273.15, st->P*0.00001);
+        for(int i = 0; i < fs->ncomp; ++i)
+        {
+            writerPrintf(w, "\t%.5f", st->x[i]);
+        }
+        writerPrintf(w, "\n");
+    }
+    writerPrintf(w, "\n");
+}
+
+void FsFlowsheetDisplay(const FsFlowsheet *fs, const FsOptions *opt)
+{
+    ResultWriter w;             // Console writer for the results.
+    
+    if(writerConsole(&w))
+    {
+        FsFlowsheetPrint(&w, fs, opt);
+        writerClose(&w);
+    }
+}
+
+void FsFlowsheetWrite(const FsFlowsheet *fs, const FsOptions *opt)
+{
+    //  Function variables
+    ResultWriter w;             // Buffered writer for the results file.
+    
+    //  Set file name as timestamp + Flowsheet Results
+    if(!writerOpen(&w, "Flowsheet Results"))
+    {
+        return;
+    }
+    
+    //  Write to file
+    FsFlowsheetPrint(&w, fs, opt);
+    
+    //  Close file
+    writerClose(&w);
+}
+
+void FsFlowsheetWriteSwitch(const FsFlowsheet *fs, const FsOptions *opt)
+{
+    int control = 0;
+    
+    control = 1;
+    while(control == 1)
+    {
+        char input[maxstrlen];
+        
+        printf("Do you want to save results to file? ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+            case 'T':
+            case 'Y':
+            case 't':
+            case 'y':
+                FsFlowsheetWrite(fs, opt);
+                control = 0;
+                break;
+            case '0':
+            case 'F':
+            case 'N':
+            case 'f':
+            case 'n':
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+}
+
+/// MARK: PSEUDO-MAIN FUNCTION
+void SteadyFlowsheet(int scope)
+{
+    int whilmain = 0;
+    printf("Steady-State Flowsheet Simulation\n");
+    
+    whilmain = 1;
+    while(whilmain == 1)
+    {
+        //  Variable declaration
+        FsFlowsheet fs;
+        FsOptions opt;
+        int ntear = 0;
+        int status = 0;
+            //  Variables for timing function
+        struct timespec start, end;
+        double elapsed = 0.0;
+        
+        memset(&fs, 0, sizeof(FsFlowsheet));
+        memset(&opt, 0, sizeof(FsOptions));
+        
+        //  Data Collection
+        FsFlowsheetVariable(scope, &fs, &opt);
+        
+        //  Data Manipulation
+        clock_getres(CLOCK_MONOTONIC, &start);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        
+        ntear = FsSequence(&fs);
+        if(ntear < 0)
+        {
+            printf("Memory could not be allocated for the calculation sequence.\n");
+        }else{
+            status = FsSolve(&fs, &opt);
+            
+            clock_getres(CLOCK_MONOTONIC, &end);
+            clock_gettime(CLOCK_MONOTONIC, &end);
+
+            elapsed = timer(start, end);
+
+            printf("Calculations completed in %.6f seconds.\n", elapsed);
+            printf("%i tear stream(s) selected.\n", ntear);
+            if(status == -2){
+                printf("Memory could not be allocated for the recycle loops.\n");
+            }else{
+                if(status != 0)
+                {
+                    printf("At least one recycle loop did not converge.\n");
+                }
+                
+                //  Displaying results
+                FsFlowsheetDisplay(&fs, &opt);
+                
+                //  Writing to File
+                FsFlowsheetWriteSwitch(&fs, &opt);
+            }
+        }
+        
+        //  Continue function
+        whilmain = Continue(whilmain);
+        
+        for(int b = 0; b < fs.nblocks; ++b)
+        {
+            free(fs.block[b].params);
+        }
+        FsFlowsheetFree(&fs);
+    }
+    fflush(stdout);
+}
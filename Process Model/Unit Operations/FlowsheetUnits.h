@@ -0,0 +1,145 @@
+//
+//  FlowsheetUnits.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef FlowsheetUnitsStruct_h
+#define FlowsheetUnitsStruct_h
+
+#define FsMinorScope 1      // Mixers, splitters, pumps, pipes and heaters.
+#define FsMajorScope 2      // Every unit operation, including compressors and equilibrium reactors.
+
+typedef struct FsSplitter{
+    double frac[FsMaxPorts];    // Fraction of the inlet sent to each outlet ([ ]). The last outlet takes the remainder.
+} FsSplitter;
+
+typedef struct FsCompressor{
+    double P2;                  // Discharge pressure (Pa).
+    double alpha;               // Polytropic index ([ ]). A value of 1 gives isothermal compression.
+} FsCompressor;
+
+typedef struct FsPump{
+    double head;                // Pump head (m).
+    double eta;                 // Pump efficiency ([ ]).
+} FsPump;
+
+typedef struct FsHeater{
+    double Tu;                  // Utility temperature (K).
+    double ho;                  // Utility film coefficient (W/m2.K).
+    int ntubes;                 // Number of tubes ([ ]).
+    double d;                   // Tube internal diameter (m).
+    double L;                   // Tube length (m).
+    double mu;                  // Process fluid viscosity (Pa.s).
+    double k;                   // Process fluid thermal conductivity (W/m.K).
+    double U;                   // Overall heat transfer coefficient (W/m2.K), calculated.
+} FsHeater;
+
+typedef struct FsPipe{
+    double L;                   // Pipe length (m).
+    double d;                   // Pipe internal diameter (m).
+    double vareps;              // Absolute roughness (m).
+    double dz;                  // Rise in elevation from inlet to outlet (m).
+    double mu;                  // Process fluid viscosity (Pa.s).
+    double dP;                  // Pressure loss (Pa), calculated.
+} FsPipe;
+
+typedef struct FsReactor{
+    double nu[FsMaxComp];       // Stoichiometric coefficients of a single gas-phase reaction ([ ]). Reagents are negative.
+    int key;                    // Key reagent used to report the conversion.
+    double h_rxn;               // Enthalpy change of reaction at 25 deg C (J/mol).
+    double K1;                  // Reference equilibrium constant ([ ]).
+    double T1;                  // Reference equilibrium constant temperature (K).
+    double T;                   // Reactor temperature (K).
+    double Pref;                // Standard state pressure (Pa).
+    double K;                   // Equilibrium constant at the reactor temperature ([ ]), calculated.
+    double EoR;                 // Extent of reaction (mol/s), calculated.
+    double conv;                // Equilibrium conversion of the key reagent ([ ]), calculated.
+} FsReactor;
+
+#endif /* FlowsheetUnitsStruct_h */
+
+#ifndef FlowsheetUnitsModels_h
+#define FlowsheetUnitsModels_h
+
+/// This subroutine is used to mix every inlet into a single outlet. The outlet leaves at the lowest inlet pressure, and its temperature follows from an enthalpy balance with constant heat capacities.
+/// @param fs Flowsheet description.
+/// @param block Block description.
+void FsMixerModel(FsFlowsheet *fs, FsBlock *block);
+
+/// This subroutine is used to divide the inlet between the outlets without a change in composition, temperature or pressure.
+/// @param fs Flowsheet description.
+/// @param block Block description. The parameters are a pointer to a "FsSplitter" struct.
+void FsSplitterModel(FsFlowsheet *fs, FsBlock *block);
+
+/// This subroutine is used to describe a polytropic compressor. The shaft work follows "PolyShaftCalculation(...)", or "IdealShaftCalculation(...)" for isothermal compression, and the heat removed closes the energy balance.
+/// @param fs Flowsheet description.
+/// @param block Block description. The parameters are a pointer to a "FsCompressor" struct.
+void FsCompressorModel(FsFlowsheet *fs, FsBlock *block);
+
+/// This subroutine is used to describe a pump of fixed head. The pressure rise follows "PumpPressureCalculation(...)" and the power "PumpPower(...)". The inefficiency is dissipated into the fluid.
+/// @param fs Flowsheet description.
+/// @param block Block description. The parameters are a pointer to a "FsPump" struct.
+void FsPumpModel(FsFlowsheet *fs, FsBlock *block);
+
+/// This subroutine is used to describe a tube bundle heated or cooled by a utility at constant temperature. The tube-side coefficient follows "DittusBoelter(...)".
+/// @param fs Flowsheet description.
+/// @param block Block description. The parameters are a pointer to a "FsHeater" struct.
+void FsHeaterModel(FsFlowsheet *fs, FsBlock *block);
+
+/// This subroutine is used to describe a straight pipe. The friction factor follows "FrictFactorSolve(...)" and the frictional loss "LossCalculation(...)"; the static head of any rise in elevation is added.
+/// @param fs Flowsheet description.
+/// @param block Block description. The parameters are a pointer to a "FsPipe" struct.
+void FsPipeModel(FsFlowsheet *fs, FsBlock *block);
+
+/// This subroutine is used to describe an isothermal equilibrium reactor for a single ideal gas reaction. The equilibrium constant follows "VantHoffCalculation(...)" and "KPCalculation(...)", and the conversion "EquiConvCalc2(...)".
+/// @param fs Flowsheet description.
+/// @param block Block description. The parameters are a pointer to a "FsReactor" struct.
+void FsReactorModel(FsFlowsheet *fs, FsBlock *block);
+
+#endif /* FlowsheetUnitsModels_h */
+
+#ifndef FlowsheetUnitsVariable_h
+#define FlowsheetUnitsVariable_h
+
+/// This subroutine is used to collect the components, streams, unit operations, feeds and convergence settings of a flowsheet. Block parameters are allocated by this subroutine and must be freed by the caller.
+/// @param scope Unit operations offered to the user (FsMinorScope or FsMajorScope).
+/// @param fs Struct where the flowsheet should be stored.
+/// @param opt Struct where the convergence settings should be stored.
+void FsFlowsheetVariable(int scope, FsFlowsheet *fs, FsOptions *opt);
+
+#endif /* FlowsheetUnitsVariable_h */
+
+#ifndef FlowsheetUnitsDisplay_h
+#define FlowsheetUnitsDisplay_h
+
+/// This subroutine is used to display the calculation sequence, the convergence of each recycle loop, the block results and the streams.
+/// @param fs Flowsheet description.
+/// @param opt Convergence settings.
+void FsFlowsheetDisplay(const FsFlowsheet *fs, const FsOptions *opt);
+
+/// This subroutine is used to write the calculation sequence, the convergence of each recycle loop, the block results and the streams to a .txt file.
+/// @param fs Flowsheet description.
+/// @param opt Convergence settings.
+void FsFlowsheetWrite(const FsFlowsheet *fs, const FsOptions *opt);
+
+/// This subroutine is used to check if the user would like to write the results to a file.
+/// @param fs Flowsheet description.
+/// @param opt Convergence settings.
+void FsFlowsheetWriteSwitch(const FsFlowsheet *fs, const FsOptions *opt);
+
+#endif /* FlowsheetUnitsDisplay_h */
@@ -0,0 +1,95 @@
+//
+//  UnitOps.c
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+//  Standard header files
+#include <stdio.h>
+#include <stdlib.h>
+
+//  Custom header files
+#include "main.h"
+#include "UnitOps.h"
+
+#define maxstrlen 128
+
+void MinorUnitOps()
+{
+    char input[maxstrlen];
+    
+    int control = 0;
+    
+    control = 1;
+    while(control == 1)
+    {
+        printf("Minor Unit Operations\n");
+        printf("Please select from the following programs:\n");
+        printf("1. Steady-state flowsheet (mixers, splitters, pumps, pipes and heaters)\n");
+        printf("q. Exit menu\n");
+        
+        printf("\nSelection [1]: ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+                SteadyFlowsheet(1);
+                break;
+            case '0':
+            case 'Q':
+            case 'q':
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+}
+
+void MajorUnitOps()
+{
+    char input[maxstrlen];
+    
+    int control = 0;
+    
+    control = 1;
+    while(control == 1)
+    {
+        printf("Major Unit Operations\n");
+        printf("Please select from the following programs:\n");
+        printf("1. Steady-state flowsheet (including compressors and equilibrium reactors)\n");
+        printf("q. Exit menu\n");
+        
+        printf("\nSelection [1]: ");
+        fgets(input, sizeof(input), stdin);
+        switch(input[0])
+        {
+            case '1':
+                SteadyFlowsheet(2);
+                break;
+            case '0':
+            case 'Q':
+            case 'q':
+                control = 0;
+                break;
+            default:
+                printf("Input not recognised\n");
+                break;
+        }
+    }
+}
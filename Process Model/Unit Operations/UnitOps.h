@@ -0,0 +1,28 @@
+//
+//  UnitOps.h
+//  Process Model
+//
+//  Created by Matthew Cheung on 19/10/2026.
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  any later version.
+//  
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//  
+
+#ifndef UnitOps_h
+#define UnitOps_h
+
+/// This subroutine is used to simulate a steady-state flowsheet by the sequential-modular method, converging recycle loops on automatically selected tear streams.
+/// @param scope Unit operations offered to the user: mixers, splitters, pumps, pipes and heaters (1) or every unit operation (2).
+void SteadyFlowsheet(int scope);
+
+#endif /* UnitOps_h */
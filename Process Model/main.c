@@ -29,21 +29,6 @@
 
 #define maxstrlen 128
 
-void MinorUnitOps()
-{
-    printf("Minor\n\n");
-}
-
-void MajorUnitOps()
-{
-    printf("Major\n\n");
-}
-
-void DynProcessSim()
-{
-    printf("Dynamic Process Simulator\n\n");
-}
-
 void NiceThings()
 {
     printf("Bonus Content!\n\n");
@@ -73,7 +58,7 @@ int main()
         printf("6. Other nice things\n");
         printf("7. GNU General Public License\n");
         printf("q. Exit Program\n\n");
-        printf("Selection [3 - 4, 7]: ");
+        printf("Selection [1 - 7]: ");
         fflush(stdout);
         fgets(MainSelect, sizeof(MainSelect), stdin);
         switch(MainSelect[0])